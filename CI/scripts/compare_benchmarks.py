@@ -0,0 +1,75 @@
+import sys, json, argparse
+
+# Сравнение результатов SRBenchmarks с сохраненным эталоном.
+# Использование: compare_benchmarks.py baseline.json current.json [--threshold 10]
+# Эталон лежит в Engine/Benchmarks/Baseline.json. Время зависит от машины, поэтому эталон
+# перезаписывается результатами той же машины, на которой идет сравнение: SRBenchmarks -out Baseline.json
+# Код возврата 1, если хотя бы один бенчмарк замедлился сильнее порога, отсутствует в эталоне
+# или эталон снят на машине с другим числом аппаратных потоков.
+
+def print_log(msg: str):
+    print(f'[LOG] {msg}')
+
+def load_results(path: str) -> tuple:
+    with open(path, 'r') as file:
+        data = json.load(file)
+
+    return data.get('context', {}), { item['name']: item for item in data.get('benchmarks', []) }
+
+def compare(baseline: dict, current: dict, threshold: float) -> int:
+    failures = 0
+
+    print(f'{"Benchmark":<40} {"Baseline":>14} {"Current":>14} {"Change":>9}')
+
+    for name, item in current.items():
+        if name not in baseline:
+            print(f'{name:<40} {"-":>14} {item["ns_per_op"]:>11.3f} ns  MISSING IN BASELINE')
+            failures += 1
+            continue
+
+        before = baseline[name]['ns_per_op']
+        after = item['ns_per_op']
+        change = (after - before) / before * 100.0 if before > 0 else 0.0
+
+        status = ''
+        if change > threshold:
+            status = ' REGRESSION'
+            failures += 1
+
+        print(f'{name:<40} {before:>11.3f} ns {after:>11.3f} ns {change:>+8.1f}%{status}')
+
+    for name in baseline:
+        if name not in current:
+            print(f'{name:<40} {"missing in current results":>39}')
+
+    return failures
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description='Compare SRBenchmarks results against a stored baseline')
+    parser.add_argument('baseline', help='baseline results (JSON)')
+    parser.add_argument('current', help='current results (JSON)')
+    parser.add_argument('--threshold', type=float, default=10.0, help='allowed slowdown in percent')
+    args = parser.parse_args()
+
+    baseline_context, baseline = load_results(args.baseline)
+    current_context, current = load_results(args.current)
+
+    baseline_threads = baseline_context.get('hardware_threads')
+    current_threads = current_context.get('hardware_threads')
+
+    if baseline_threads != current_threads:
+        print_log(f'Baseline was recorded with {baseline_threads} hardware threads, current run has {current_threads}. '
+                  f'Regenerate the baseline on this machine: SRBenchmarks -out Baseline.json')
+        return 1
+
+    failures = compare(baseline, current, args.threshold)
+
+    if failures > 0:
+        print_log(f'{failures} benchmark(s) regressed by more than {args.threshold}% or have no baseline entry')
+        return 1
+
+    print_log('No regressions found')
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main())
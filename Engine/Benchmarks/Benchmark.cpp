@@ -0,0 +1,101 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Benchmark.h>
+
+namespace SR_BENCHMARKS_NS {
+    BenchmarkRegistry& BenchmarkRegistry::Instance() {
+        static BenchmarkRegistry registry;
+        return registry;
+    }
+
+    bool BenchmarkRegistry::Register(std::string name, BenchmarkFn function) {
+        m_entries.emplace_back(Entry { std::move(name), std::move(function) });
+        return true;
+    }
+
+    std::vector<BenchmarkResult> BenchmarkRegistry::Run(const BenchmarkOptions& options) const {
+        std::vector<BenchmarkResult> results;
+
+        for (auto&& entry : m_entries) {
+            if (!options.filter.empty() && entry.name.find(options.filter) == std::string::npos) {
+                continue;
+            }
+
+            std::cerr << "Running " << entry.name << "..." << std::endl;
+
+            auto&& result = results.emplace_back(Measure(entry, options));
+
+            std::cerr << "\t" << result.nsPerOp << " ns/op (" << result.iterations << " iterations)" << std::endl;
+        }
+
+        return results;
+    }
+
+    BenchmarkResult BenchmarkRegistry::Measure(const Entry& entry, const BenchmarkOptions& options) const {
+        auto&& measure = [&entry](uint64_t iterations) -> double_t {
+            BenchmarkState state(iterations);
+            state.StartTiming();
+            entry.function(state);
+            state.StopTiming();
+            return state.GetElapsedNs();
+        };
+
+        /// прогрев и подбор числа итераций под минимальное время замера
+        const double_t minTimeNs = options.minTimeMs * 1e6;
+        uint64_t iterations = 1;
+        double_t elapsed = measure(iterations);
+
+        while (elapsed < minTimeNs && iterations < (1ull << 40)) {
+            const double_t scale = elapsed > 0.0 ? std::min(minTimeNs * 1.2 / elapsed, 10.0) : 10.0;
+            iterations = std::max<uint64_t>(iterations + 1, static_cast<uint64_t>(static_cast<double_t>(iterations) * scale));
+            elapsed = measure(iterations);
+        }
+
+        std::vector<double_t> samples;
+        samples.reserve(options.repetitions);
+
+        for (uint32_t i = 0; i < std::max(options.repetitions, 1u); ++i) {
+            samples.emplace_back(measure(iterations) / static_cast<double_t>(iterations));
+        }
+
+        std::sort(samples.begin(), samples.end());
+
+        BenchmarkResult result;
+        result.name = entry.name;
+        result.iterations = iterations;
+        result.repetitions = static_cast<uint32_t>(samples.size());
+        result.nsPerOp = samples[samples.size() / 2];
+        result.minNsPerOp = samples.front();
+        result.maxNsPerOp = samples.back();
+
+        return result;
+    }
+
+    std::string ResultsToJson(const std::vector<BenchmarkResult>& results) {
+        std::stringstream stream;
+        stream << std::fixed << std::setprecision(3);
+
+        /// потоковые бенчмарки сравнимы только между машинами с одинаковым числом ядер
+        stream << "{\n\t\"context\": { \"hardware_threads\": " << std::thread::hardware_concurrency() << " },";
+        stream << "\n\t\"benchmarks\": [";
+
+        for (uint64_t i = 0; i < results.size(); ++i) {
+            auto&& result = results[i];
+
+            stream << (i == 0 ? "\n" : ",\n");
+            stream << "\t\t{ \"name\": \"" << result.name << "\""
+                   << ", \"iterations\": " << result.iterations
+                   << ", \"repetitions\": " << result.repetitions
+                   << ", \"ns_per_op\": " << result.nsPerOp
+                   << ", \"min_ns_per_op\": " << result.minNsPerOp
+                   << ", \"max_ns_per_op\": " << result.maxNsPerOp
+                   << " }";
+        }
+
+        stream << "\n\t]\n}\n";
+
+        return stream.str();
+    }
+}
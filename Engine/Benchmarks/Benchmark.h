@@ -0,0 +1,116 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SRENGINE_BENCHMARK_H
+#define SRENGINE_BENCHMARK_H
+
+#include <Utils/Common/NonCopyable.h>
+#include <Utils/Types/Function.h>
+
+#define SR_BENCHMARKS_NS SpaRcle::Benchmarks
+
+namespace SR_BENCHMARKS_NS {
+    /// Замер одного запуска бенчмарка. Время идет с момента вызова тела,
+    /// подготовку и очистку данных можно исключить через StartTiming/StopTiming.
+    class BenchmarkState : public SR_UTILS_NS::NonCopyable {
+        using Clock = std::chrono::steady_clock;
+    public:
+        explicit BenchmarkState(uint64_t iterations)
+            : m_iterations(iterations)
+        { }
+
+    public:
+        void StartTiming() {
+            m_elapsedNs = 0.0;
+            m_begin = Clock::now();
+            m_running = true;
+        }
+
+        /// Продолжает замер без сброса, для исключения подготовки данных внутри цикла
+        void ResumeTiming() {
+            if (!m_running) {
+                m_begin = Clock::now();
+                m_running = true;
+            }
+        }
+
+        void StopTiming() {
+            if (m_running) {
+                m_elapsedNs += std::chrono::duration<double_t, std::nano>(Clock::now() - m_begin).count();
+                m_running = false;
+            }
+        }
+
+        SR_NODISCARD uint64_t GetIterations() const noexcept { return m_iterations; }
+        SR_NODISCARD double_t GetElapsedNs() const noexcept { return m_elapsedNs; }
+
+    private:
+        uint64_t m_iterations = 0;
+        Clock::time_point m_begin;
+        double_t m_elapsedNs = 0.0;
+        bool m_running = false;
+
+    };
+
+    /// Тело бенчмарка выполняет ровно state.GetIterations() повторений измеряемой операции
+    using BenchmarkFn = SR_HTYPES_NS::Function<void(BenchmarkState& state)>;
+
+    struct BenchmarkResult {
+        std::string name;
+        uint64_t iterations = 0;
+        uint32_t repetitions = 0;
+        double_t nsPerOp = 0.0;
+        double_t minNsPerOp = 0.0;
+        double_t maxNsPerOp = 0.0;
+    };
+
+    struct BenchmarkOptions {
+        /// минимальное время одного замера, под него подбирается число итераций
+        double_t minTimeMs = 50.0;
+        uint32_t repetitions = 5;
+        std::string filter;
+    };
+
+    class BenchmarkRegistry : public SR_UTILS_NS::NonCopyable {
+        struct Entry {
+            std::string name;
+            BenchmarkFn function;
+        };
+    public:
+        static BenchmarkRegistry& Instance();
+
+        bool Register(std::string name, BenchmarkFn function);
+
+        /// Выполняет все бенчмарки, имя которых содержит filter, и выводит прогресс в stderr
+        SR_NODISCARD std::vector<BenchmarkResult> Run(const BenchmarkOptions& options) const;
+
+    private:
+        SR_NODISCARD BenchmarkResult Measure(const Entry& entry, const BenchmarkOptions& options) const;
+
+    private:
+        std::vector<Entry> m_entries;
+
+    };
+
+    /// Не дает компилятору выбросить вычисление результата
+    template<typename T> SR_FORCE_INLINE void DoNotOptimize(const T& value) {
+    #ifdef SR_MSVC
+        static volatile const void* pSink = nullptr;
+        pSink = static_cast<const void*>(&value);
+    #else
+        asm volatile("" : : "r,m"(value) : "memory");
+    #endif
+    }
+
+    SR_NODISCARD std::string ResultsToJson(const std::vector<BenchmarkResult>& results);
+}
+
+#define SR_BENCHMARK(name)                                                                                                      \
+    static void SR_MACRO_CONCAT(SRBenchmark_, name)(SR_BENCHMARKS_NS::BenchmarkState& state);                                  \
+    static const bool SR_MACRO_CONCAT(SRBenchmarkRegistered_, name) = SR_BENCHMARKS_NS::BenchmarkRegistry::Instance().Register( \
+        #name, &SR_MACRO_CONCAT(SRBenchmark_, name)                                                                             \
+    );                                                                                                                         \
+    static void SR_MACRO_CONCAT(SRBenchmark_, name)(SR_BENCHMARKS_NS::BenchmarkState& state)
+
+#endif //SRENGINE_BENCHMARK_H
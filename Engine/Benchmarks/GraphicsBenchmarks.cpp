@@ -0,0 +1,376 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Benchmark.h>
+
+#include <Graphics/Memory/MeshManager.h>
+#include <Graphics/Memory/UniformArena.h>
+#include <Graphics/Render/DrawList.h>
+#include <Graphics/Lighting/LightClusters.h>
+#include <Graphics/Render/RenderGraph.h>
+#include <Graphics/Pipeline/CommandList.h>
+
+using namespace SR_BENCHMARKS_NS;
+
+namespace SR_BENCHMARKS_NS {
+    /// Упаковка команд в буфер, как это делают vkCmd* драйвера: каждое слово проходит через проверку состояния
+    static void EncodeCommands(const SR_GRAPH_NS::CommandList& commandList, std::vector<uint32_t>& encoded) {
+        encoded.clear();
+
+        uint32_t state = 2166136261u;
+
+        for (auto&& command : commandList.GetCommands()) {
+            for (uint32_t word : { static_cast<uint32_t>(command.type), command.first, command.second }) {
+                for (uint32_t round = 0; round < 8; ++round) {
+                    state = (state ^ word) * 16777619u;
+                    state ^= state >> 13;
+                }
+                encoded.emplace_back(state);
+            }
+        }
+    }
+
+    /// 16k отрисовок, поделенных на диапазоны так же, как DrawCapture::AddJobs
+    static std::vector<SR_GRAPH_NS::CommandList> MakeEncodeLists() {
+        using namespace SR_GRAPH_NS;
+
+        std::array<float_t, 16> constants = { };
+        std::vector<CommandList> lists;
+
+        for (auto&& range : ParallelCommandRecorder::Split(16384, 256, 16)) {
+            auto&& commandList = lists.emplace_back();
+
+            for (uint32_t j = range.offset; j < range.offset + range.count; ++j) {
+                commandList.UseShader(j % 32);
+                commandList.BindVBO(j);
+                commandList.BindDescriptorSet(j);
+                commandList.PushConstants(constants.data(), sizeof(constants));
+                commandList.DrawIndices(36);
+            }
+        }
+
+        return lists;
+    }
+}
+
+/// 100k поисков по заполненному менеджеру, ключи посчитаны заранее, как это делает IndexedMesh
+SR_BENCHMARK(MeshManager_Find) {
+    using namespace SR_GRAPH_NS::Memory;
+    using namespace SR_GRAPH_NS;
+
+    constexpr uint32_t count = 4096;
+    constexpr uint64_t lookups = 100000;
+
+    auto&& manager = MeshManager::Instance();
+
+    std::vector<MeshKey> keys;
+    keys.reserve(count);
+
+    for (uint32_t i = 0; i < count; ++i) {
+        auto&& key = keys.emplace_back(MeshKey::Make<Vertices::VertexType::StaticMeshVertex, MeshMemoryType::VBO>(
+            "Models/Benchmark.fbx|" + std::to_string(i)
+        ));
+        manager.Register<MeshMemoryType::VBO>(key, i + 1, i);
+    }
+
+    state.StartTiming();
+
+    uint64_t size = 0;
+    for (uint64_t i = 0; i < state.GetIterations(); ++i) {
+        for (uint64_t j = 0; j < lookups; ++j) {
+            size += manager.Size<MeshMemoryType::VBO>(keys[j % count]);
+        }
+    }
+
+    state.StopTiming();
+
+    DoNotOptimize(size);
+
+    for (uint32_t i = 0; i < count; ++i) {
+        manager.Free<MeshMemoryType::VBO>(static_cast<int32_t>(i));
+    }
+}
+
+/// То же, но с построением ключа из строки на каждый вызов
+SR_BENCHMARK(MeshManager_FindByIdentifier) {
+    using namespace SR_GRAPH_NS::Memory;
+    using namespace SR_GRAPH_NS;
+
+    constexpr uint32_t count = 4096;
+    constexpr uint64_t lookups = 100000;
+
+    auto&& manager = MeshManager::Instance();
+
+    std::vector<std::string> identifiers;
+    identifiers.reserve(count);
+
+    for (uint32_t i = 0; i < count; ++i) {
+        auto&& identifier = identifiers.emplace_back("Models/Benchmark.fbx|" + std::to_string(i));
+        manager.Register<Vertices::VertexType::StaticMeshVertex, MeshMemoryType::VBO>(identifier, i + 1, i);
+    }
+
+    state.StartTiming();
+
+    uint64_t size = 0;
+    for (uint64_t i = 0; i < state.GetIterations(); ++i) {
+        for (uint64_t j = 0; j < lookups; ++j) {
+            size += manager.Size<Vertices::VertexType::StaticMeshVertex, MeshMemoryType::VBO>(identifiers[j % count]);
+        }
+    }
+
+    state.StopTiming();
+
+    DoNotOptimize(size);
+
+    for (uint32_t i = 0; i < count; ++i) {
+        manager.Free<MeshMemoryType::VBO>(static_cast<int32_t>(i));
+    }
+}
+
+/// Кадр из 1024 юниформ по 192 байта (модель + 2 матрицы + параметры), 3 кадра в полете
+SR_BENCHMARK(UniformArena_PushFrame) {
+    using namespace SR_GRAPH_NS::Memory;
+
+    constexpr uint32_t objects = 1024;
+    constexpr uint64_t uboSize = 192;
+
+    UniformArena arena(std::make_unique<UniformArenaCPUStorage>());
+    if (!arena.Init(objects * 256 * 3, 256, 3)) {
+        SRHalt("UniformArena_PushFrame : failed to initialize arena!");
+        return;
+    }
+
+    std::array<char, uboSize> data = { };
+
+    state.StartTiming();
+
+    uint64_t offsets = 0;
+    for (uint64_t i = 0; i < state.GetIterations(); ++i) {
+        arena.BeginFrame();
+
+        for (uint32_t j = 0; j < objects; ++j) {
+            data[0] = static_cast<char>(j);
+            offsets += arena.Push(data.data(), uboSize);
+        }
+
+        arena.EndFrame();
+    }
+
+    state.StopTiming();
+
+    DoNotOptimize(offsets);
+}
+
+/// Сортировка 100k ключей отрисовки, как в кадре с большой сценой
+SR_BENCHMARK(DrawList_Sort100k) {
+    using namespace SR_GRAPH_NS;
+
+    constexpr uint32_t count = 100000;
+
+    std::mt19937_64 random(42);
+
+    std::vector<DrawSortItem> source(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        const bool transparent = (i % 4) == 0;
+        const uint64_t shader = random() % 64;
+        const uint64_t material = random() % 512;
+        const uint64_t depth = random() % DrawSortKey::MaxDepth;
+
+        source[i].key = transparent
+            ? DrawSortKey::Transparent(0, DrawSortKey::PassTransparent, shader, material, depth)
+            : DrawSortKey::Opaque(0, DrawSortKey::PassOpaque, shader, material, depth);
+        source[i].index = i;
+    }
+
+    std::vector<DrawSortItem> items;
+    std::vector<DrawSortItem> temp;
+
+    /// в замер попадает только сортировка, копирование исходных ключей исключено
+    state.StartTiming();
+    state.StopTiming();
+
+    for (uint64_t i = 0; i < state.GetIterations(); ++i) {
+        items = source;
+
+        state.ResumeTiming();
+        RadixSortDrawItems(items, temp);
+        state.StopTiming();
+
+        DoNotOptimize(items.front());
+    }
+}
+
+/// 1k точечных источников и прожекторов по сетке 16x9x24
+SR_BENCHMARK(LightClusters_Bin1k) {
+    using namespace SR_GRAPH_NS;
+
+    LightClusterConfig config;
+    config.sizeX = 16;
+    config.sizeY = 9;
+    config.sizeZ = 24;
+    config.far = 200.f;
+
+    LightClusterGrid grid;
+    if (!grid.Init(config)) {
+        SRHalt("LightClusters_Bin1k : failed to initialize grid!");
+        return;
+    }
+
+    std::mt19937 random(7);
+    std::uniform_real_distribution<float_t> distribution(-1.f, 1.f);
+
+    std::vector<ClusterLight> lights(1000);
+    for (uint32_t i = 0; i < lights.size(); ++i) {
+        auto&& light = lights[i];
+
+        const float_t depth = std::abs(distribution(random)) * config.far;
+        light.position = SR_MATH_NS::FVector3(distribution(random) * depth * 1.5f, distribution(random) * depth, depth);
+        light.radius = 1.f + std::abs(distribution(random)) * 15.f;
+        light.index = i;
+
+        if (i % 3 == 0) {
+            const float_t halfAngle = 0.1f + std::abs(distribution(random)) * 0.6f;
+            light.direction = SR_MATH_NS::FVector3(distribution(random), distribution(random), distribution(random)).Normalize();
+            light.cosHalfAngle = std::cos(halfAngle);
+            light.sinHalfAngle = std::sin(halfAngle);
+            light.spot = true;
+        }
+    }
+
+    state.StartTiming();
+
+    for (uint64_t i = 0; i < state.GetIterations(); ++i) {
+        grid.Build(lights);
+        DoNotOptimize(grid.GetIndices().size());
+    }
+
+    state.StopTiming();
+}
+
+/// Сборка и компиляция графа из 64 проходов: цепочки постобработки поверх общего G-буфера
+SR_BENCHMARK(RenderGraph_Compile64) {
+    using namespace SR_GRAPH_NS;
+
+    constexpr uint32_t chains = 8;
+    constexpr uint32_t chainLength = 7;
+
+    std::vector<SR_UTILS_NS::StringAtom> names;
+    for (uint32_t i = 0; i < chains * chainLength + 2; ++i) {
+        names.emplace_back("Pass_" + std::to_string(i));
+    }
+
+    RenderGraphResourceDesc transient;
+    transient.transient = true;
+
+    RenderGraph graph;
+
+    for (uint64_t i = 0; i < state.GetIterations(); ++i) {
+        graph.Clear();
+
+        RenderGraphPassBuilder gBuffer(graph, graph.AddPass(names[0]));
+        gBuffer.Write(names[0], transient);
+
+        std::vector<SR_UTILS_NS::StringAtom> outputs;
+
+        for (uint32_t chain = 0; chain < chains; ++chain) {
+            SR_UTILS_NS::StringAtom input = names[0];
+
+            for (uint32_t link = 0; link < chainLength; ++link) {
+                auto&& name = names[2 + chain * chainLength + link];
+
+                RenderGraphPassBuilder pass(graph, graph.AddPass(name));
+                pass.Read(input);
+                pass.Write(name, transient);
+
+                input = name;
+            }
+
+            outputs.emplace_back(input);
+        }
+
+        /// композиция объявлена последней: временный ресурс нельзя читать до его записи в кадре
+        RenderGraphPassBuilder composite(graph, graph.AddPass(names[1], true));
+        for (auto&& output : outputs) {
+            composite.Read(output);
+        }
+
+        DoNotOptimize(graph.Compile());
+        DoNotOptimize(graph.GetPhysicalResourcesCount());
+    }
+}
+
+/// Запись 16k отрисовок тремя рабочими потоками и вызывающим, со слиянием в один список
+SR_BENCHMARK(CommandList_RecordParallel16k) {
+    using namespace SR_GRAPH_NS;
+
+    constexpr uint32_t draws = 16384;
+
+    std::array<float_t, 16> constants = { };
+
+    ParallelCommandRecorder recorder(3);
+    CommandList merged;
+
+    auto&& ranges = ParallelCommandRecorder::Split(draws, 512, 16);
+
+    for (uint64_t i = 0; i < state.GetIterations(); ++i) {
+        recorder.Begin();
+
+        for (auto&& range : ranges) {
+            recorder.AddJob([range, &constants](CommandList& commandList) {
+                for (uint32_t j = range.offset; j < range.offset + range.count; ++j) {
+                    commandList.UseShader(j % 32);
+                    commandList.BindVBO(j);
+                    commandList.BindUBO(j);
+                    commandList.PushConstants(constants.data(), sizeof(constants));
+                    commandList.DrawIndices(36);
+                }
+            });
+        }
+
+        recorder.Record();
+
+        merged.Clear();
+        recorder.Merge(merged);
+
+        DoNotOptimize(merged.GetDrawCalls());
+    }
+}
+
+/// Запись вторичных буферов из готовых списков на одном потоке, как до параллельной записи
+SR_BENCHMARK(CommandList_EncodeSerial16k) {
+    auto&& lists = MakeEncodeLists();
+    std::vector<std::vector<uint32_t>> encoded(lists.size());
+
+    for (uint64_t i = 0; i < state.GetIterations(); ++i) {
+        for (size_t list = 0; list < lists.size(); ++list) {
+            EncodeCommands(lists[list], encoded[list]);
+        }
+
+        DoNotOptimize(encoded.back().back());
+    }
+}
+
+/// То же самое заданиями ParallelCommandRecorder на трех рабочих потоках и вызывающем, как в VulkanPipeline::EndCommandBatch
+SR_BENCHMARK(CommandList_EncodeParallel16k) {
+    using namespace SR_GRAPH_NS;
+
+    auto&& lists = MakeEncodeLists();
+    std::vector<std::vector<uint32_t>> encoded(lists.size());
+
+    ParallelCommandRecorder recorder(3);
+
+    for (uint64_t i = 0; i < state.GetIterations(); ++i) {
+        recorder.Begin();
+
+        for (size_t list = 0; list < lists.size(); ++list) {
+            recorder.AddJob([&lists, &encoded, list](CommandList&) {
+                EncodeCommands(lists[list], encoded[list]);
+            });
+        }
+
+        recorder.Record();
+
+        DoNotOptimize(encoded.back().back());
+    }
+}
@@ -0,0 +1,845 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Benchmark.h>
+
+#include <Utils/Types/Marshal.h>
+#include <Utils/Types/SharedPtr.h>
+#include <Utils/Types/IntrusivePtr.h>
+#include <Utils/Types/StringAtom.h>
+#include <Utils/Types/SafeQueue.h>
+#include <Utils/Types/SPSCQueue.h>
+#include <Utils/Common/HashManager.h>
+#include <Utils/Debug.h>
+#include <Utils/ResourceManager/ResourceManager.h>
+#include <Utils/Math/Matrix4x4.h>
+#include <Utils/Math/SIMD.h>
+#include <Utils/Profile/MemoryTracker.h>
+#include <Utils/FileSystem/BakedMesh.h>
+#include <Utils/CompiledConfig.h>
+#include <Utils/Events/EventDispatcher.h>
+#include <Utils/Events/TypedEventDispatcher.h>
+
+#include <filesystem>
+
+namespace SR_BENCHMARKS_NS {
+    struct BenchmarkObject {
+        uint64_t value = 0;
+    };
+
+    struct BenchmarkIntrusiveObject : public SR_HTYPES_NS::IntrusiveRefCounter {
+        uint64_t value = 0;
+    };
+
+    static const std::vector<std::string>& GetBenchmarkStrings() {
+        static std::vector<std::string> strings = []() {
+            std::vector<std::string> result;
+            result.reserve(4096);
+            for (uint32_t i = 0; i < 4096; ++i) {
+                result.emplace_back("Engine/Benchmarks/Resource_" + std::to_string(i) + ".asset");
+            }
+            return result;
+        }();
+        return strings;
+    }
+
+    struct BenchmarkEvent {
+        uint64_t value = 0;
+    };
+
+    /// Слушатель старого диспетчера: событие ищется по имени типа, аргументы передаются по значению
+    class BenchmarkEventListener final : public SR_UTILS_NS::Event<uint64_t> {
+    public:
+        BenchmarkEventListener()
+            : Event(typeid(BenchmarkEvent).name())
+        { }
+
+    public:
+        void Trigger(uint64_t value) override { m_sum += value; }
+        void OnEvent(const BenchmarkEvent& event) { m_sum += event.value; }
+
+        SR_NODISCARD uint64_t GetSum() const noexcept { return m_sum; }
+
+    private:
+        uint64_t m_sum = 0;
+
+    };
+
+    static constexpr uint32_t BENCHMARK_EVENT_LISTENERS = 8;
+
+    static constexpr uint64_t BENCHMARK_MATH_BATCH = 100000;
+
+    /// Входы и выходы пакетных математических ядер, общие для скалярного и векторного вариантов
+    struct BenchmarkMathBatch {
+        std::vector<SR_MATH_NS::FVector3> translations;
+        std::vector<SR_MATH_NS::FVector3> scales;
+        std::vector<SR_MATH_NS::Quaternion> rotations;
+        std::vector<SR_MATH_NS::Quaternion> targetRotations;
+        std::vector<float_t> factors;
+        std::vector<SR_MATH_NS::Matrix4x4> matrices;
+        std::vector<SR_MATH_NS::Matrix4x4> locals;
+        std::vector<SR_MATH_NS::AABB> bounds;
+        std::vector<SR_MATH_NS::Sphere> spheres;
+        std::vector<SR_MATH_NS::Plane> planes;
+
+        std::vector<SR_MATH_NS::Matrix4x4> resultMatrices;
+        std::vector<SR_MATH_NS::FVector3> resultTranslations;
+        std::vector<SR_MATH_NS::FVector3> resultScales;
+        std::vector<SR_MATH_NS::Quaternion> resultRotations;
+        std::vector<SR_MATH_NS::AABB> resultBounds;
+        std::vector<uint8_t> visible;
+    };
+
+    static BenchmarkMathBatch& GetBenchmarkMathBatch() {
+        static BenchmarkMathBatch batch = []() {
+            BenchmarkMathBatch result;
+
+            std::mt19937 random(7);
+            std::uniform_real_distribution<float_t> distribution(-1.f, 1.f);
+
+            auto&& randomVector = [&](float_t scale) {
+                return SR_MATH_NS::FVector3(distribution(random), distribution(random), distribution(random)) * scale;
+            };
+
+            auto&& randomRotation = [&]() {
+                return SR_MATH_NS::Quaternion(randomVector(180.f).Radians().ToQuat());
+            };
+
+            for (uint64_t i = 0; i < BENCHMARK_MATH_BATCH; ++i) {
+                result.translations.emplace_back(randomVector(100.f));
+                result.scales.emplace_back(randomVector(1.f).Abs() + SR_MATH_NS::FVector3(0.5f));
+                result.rotations.emplace_back(randomRotation());
+                result.targetRotations.emplace_back(randomRotation());
+                result.factors.emplace_back(std::abs(distribution(random)));
+                result.matrices.emplace_back(SR_MATH_NS::Matrix4x4(result.translations.back(), result.rotations.back(), result.scales.back()));
+                result.locals.emplace_back(SR_MATH_NS::Matrix4x4(randomVector(10.f), randomRotation(), SR_MATH_NS::FVector3(1.f)));
+
+                const SR_MATH_NS::FVector3 center = randomVector(5.f);
+                const SR_MATH_NS::FVector3 extents = randomVector(1.f).Abs() + SR_MATH_NS::FVector3(0.1f);
+                result.bounds.emplace_back(SR_MATH_NS::AABB { center - extents, center + extents });
+
+                result.spheres.emplace_back(SR_MATH_NS::Sphere { randomVector(200.f), 0.5f + std::abs(distribution(random)) * 5.f });
+            }
+
+            /// грубый фрустум: шесть плоскостей, смотрящих внутрь куба со стороной 200
+            for (auto&& normal : { SR_MATH_NS::FVector3(1.f, 0.f, 0.f), SR_MATH_NS::FVector3(-1.f, 0.f, 0.f), SR_MATH_NS::FVector3(0.f, 1.f, 0.f),
+                                   SR_MATH_NS::FVector3(0.f, -1.f, 0.f), SR_MATH_NS::FVector3(0.f, 0.f, 1.f), SR_MATH_NS::FVector3(0.f, 0.f, -1.f) }) {
+                result.planes.emplace_back(SR_MATH_NS::Plane { normal, 100.f });
+            }
+
+            result.resultMatrices.resize(BENCHMARK_MATH_BATCH);
+            result.resultTranslations.resize(BENCHMARK_MATH_BATCH);
+            result.resultScales.resize(BENCHMARK_MATH_BATCH);
+            result.resultRotations.resize(BENCHMARK_MATH_BATCH);
+            result.resultBounds.resize(BENCHMARK_MATH_BATCH);
+            result.visible.resize(BENCHMARK_MATH_BATCH);
+
+            return result;
+        }();
+        return batch;
+    }
+
+    static constexpr uint32_t BENCHMARK_CONFIG_PASSES = 24;
+    static constexpr uint32_t BENCHMARK_STARTUP_CONFIGS = 16;
+
+    static const SR_XML_NS::ConfigSchema BENCHMARK_CONFIG_SCHEMA = { "Technique", { "Name" } };
+
+    /// Конфиг по образцу EditorRenderTechnique.xml
+    static const std::string& GetBenchmarkConfig() {
+        static std::string config = []() {
+            std::string result = "<?xml version=\"1.0\"?>\n<Technique Name=\"Benchmark\">\n";
+
+            for (uint32_t i = 0; i < BENCHMARK_CONFIG_PASSES; ++i) {
+                result += SR_FORMAT(
+                    "    <FramebufferPass Name=\"Pass{}\">\n"
+                    "        <FramebufferSettings DynamicResizing=\"true\" DepthEnabled=\"true\" SmoothSamples=\"{}\">\n"
+                    "            <Size X=\"{}\" Y=\"{}\"/>\n"
+                    "            <PreScale X=\"0.65\" Y=\"0.65\"/>\n"
+                    "            <Depth Format=\"Auto\" ClearValue=\"1.0\"/>\n"
+                    "            <Layer Format=\"RGBA8_UNORM\" R=\"0.0\" G=\"0.0\" B=\"0.0\" A=\"1.0\"/>\n"
+                    "        </FramebufferSettings>\n"
+                    "        <Passes>\n"
+                    "            <OpaquePass/>\n"
+                    "            <SkyboxPass Path=\"Engine/Skyboxes/Sun.png\" Shader=\"Engine/Shaders/skybox.srsl\"/>\n"
+                    "            <TransparentPass/>\n"
+                    "        </Passes>\n"
+                    "    </FramebufferPass>\n", i, i % 4, i * 64, i * 32);
+            }
+
+            return result + "</Technique>\n";
+        }();
+        return config;
+    }
+
+    /// Обходит конфиг так же, как загрузчики проходов: по именам узлов и атрибутов с преобразованием значений
+    static uint64_t ReadBenchmarkConfig(const SR_XML_NS::Document& document) {
+        uint64_t sum = 0;
+
+        auto&& technique = document.Root().GetNode("Technique");
+        sum += technique.GetAttribute("Name").ToString().size();
+
+        for (auto&& passNode : technique.GetNodes()) {
+            sum += passNode.GetAttribute("Name").ToString().size();
+
+            auto&& settingsNode = passNode.GetNode("FramebufferSettings");
+            sum += settingsNode.GetAttribute("DynamicResizing").ToBool() ? 1 : 0;
+            sum += settingsNode.GetAttribute("SmoothSamples").ToUInt64();
+            sum += settingsNode.GetNode("Size").GetAttribute<SR_MATH_NS::UVector2>().x;
+            sum += static_cast<uint64_t>(settingsNode.GetNode("PreScale").GetAttribute<SR_MATH_NS::FVector2>().x * 100.f);
+            sum += settingsNode.GetNode("Depth").GetAttribute("Format").ToString().size();
+
+            for (auto&& layerNode : settingsNode.GetNodes("Layer")) {
+                sum += static_cast<uint64_t>(layerNode.GetAttribute("A").ToFloat());
+            }
+
+            for (auto&& subPassNode : passNode.GetNode("Passes").GetNodes()) {
+                sum += subPassNode.NameView().size();
+            }
+        }
+
+        return sum;
+    }
+
+    static std::vector<uint64_t> CompileBenchmarkConfig() {
+        auto&& document = SR_XML_NS::Document::LoadFromString(GetBenchmarkConfig(), "Benchmark.xml");
+        auto&& config = SR_XML_NS::CompiledConfig::Compile(document, BENCHMARK_CONFIG_SCHEMA, 0);
+        auto&& pData = reinterpret_cast<const uint64_t*>(config.GetData());
+        return std::vector<uint64_t>(pData, pData + config.GetSize() / sizeof(uint64_t));
+    }
+
+    /// Конфиги запуска на диске: исходники и каталог кеша, который заполняется при первой загрузке
+    static const std::vector<SR_UTILS_NS::Path>& GetBenchmarkStartupConfigs() {
+        static std::vector<SR_UTILS_NS::Path> paths = []() {
+            std::vector<SR_UTILS_NS::Path> result;
+
+            const std::filesystem::path folder = std::filesystem::temp_directory_path() / "SRBenchmarks" / "Configs";
+            std::filesystem::create_directories(folder);
+
+            for (uint32_t i = 0; i < BENCHMARK_STARTUP_CONFIGS; ++i) {
+                auto&& path = result.emplace_back((folder / ("Technique" + std::to_string(i) + ".xml")).string());
+                std::ofstream(path.ToString(), std::ios::binary) << GetBenchmarkConfig();
+            }
+
+            return result;
+        }();
+        return paths;
+    }
+
+    /// Ресурс без файла, в бенчмарках нужен только для поиска в ResourceManager
+    class BenchmarkResource final : public SR_UTILS_NS::IResource {
+        using Super = SR_UTILS_NS::IResource;
+    public:
+        BenchmarkResource()
+            : Super(SR_COMPILE_TIME_CRC32_TYPE_NAME(BenchmarkResource))
+        {
+            m_isFromMemory = true;
+        }
+
+    public:
+        SR_NODISCARD bool IsFileResource() const noexcept override { return false; }
+
+    };
+
+    static constexpr uint32_t BENCHMARK_RESOURCES = 1024;
+
+    /// Ресурсы регистрируются один раз на весь запуск и держатся точкой использования до выхода
+    static const std::vector<std::string>& GetBenchmarkResourceIds() {
+        static std::vector<std::string> ids = []() {
+            auto&& resourceManager = SR_UTILS_NS::ResourceManager::Instance();
+            resourceManager.RegisterType<BenchmarkResource>();
+
+            std::vector<std::string> result;
+            result.reserve(BENCHMARK_RESOURCES);
+
+            for (uint32_t i = 0; i < BENCHMARK_RESOURCES; ++i) {
+                auto&& pResource = new BenchmarkResource();
+                pResource->SetId(GetBenchmarkStrings()[i]);
+                pResource->AddUsePoint();
+                result.emplace_back(GetBenchmarkStrings()[i]);
+            }
+
+            return result;
+        }();
+        return ids;
+    }
+
+    /// Делит итерации между потоками, время включает запуск и ожидание потоков
+    static void RunOnThreads(BenchmarkState& state, uint32_t threads, const SR_HTYPES_NS::Function<void(uint64_t begin, uint64_t end)>& function) {
+        const uint64_t perThread = state.GetIterations() / threads;
+
+        std::vector<std::thread> workers;
+        workers.reserve(threads);
+
+        for (uint32_t i = 0; i < threads; ++i) {
+            const uint64_t begin = perThread * i;
+            const uint64_t end = i + 1 == threads ? state.GetIterations() : begin + perThread;
+            workers.emplace_back([&function, begin, end]() {
+                function(begin, end);
+            });
+        }
+
+        for (auto&& worker : workers) {
+            worker.join();
+        }
+    }
+
+    static void FindResources(BenchmarkState& state, uint32_t threads) {
+        auto&& ids = GetBenchmarkResourceIds();
+        auto&& resourceManager = SR_UTILS_NS::ResourceManager::Instance();
+
+        state.StartTiming();
+
+        RunOnThreads(state, threads, [&](uint64_t begin, uint64_t end) {
+            for (uint64_t i = begin; i < end; ++i) {
+                DoNotOptimize(resourceManager.Find<BenchmarkResource>(ids[(i * 7) % ids.size()]));
+            }
+        });
+
+        state.StopTiming();
+    }
+
+    static void AddHashes(BenchmarkState& state, uint32_t threads) {
+        auto&& strings = GetBenchmarkStrings();
+        auto&& hashManager = SR_UTILS_NS::HashManager::Instance();
+
+        state.StartTiming();
+
+        RunOnThreads(state, threads, [&](uint64_t begin, uint64_t end) {
+            for (uint64_t i = begin; i < end; ++i) {
+                DoNotOptimize(hashManager.AddHash(strings[(i * 7) % strings.size()]));
+            }
+        });
+
+        state.StopTiming();
+    }
+
+    /// Время, которое Debug::Print занимает у пишущих потоков. Консоль выключена, в stdout пишутся результаты,
+    /// записи идут в лог-файл: синхронно под мьютексом Debug или через очередь, после замера очередь дописывается
+    static void PrintLogs(BenchmarkState& state, uint32_t threads, bool async) {
+        auto&& debug = SR_UTILS_NS::Debug::Instance();
+
+        debug.SetConsoleOutput(false);
+        debug.SetAsync(async);
+
+        state.StartTiming();
+
+        RunOnThreads(state, threads, [&debug](uint64_t begin, uint64_t end) {
+            for (uint64_t i = begin; i < end; ++i) {
+                debug.Print(SR_FORMAT("Benchmark log record {}", i), SR_UTILS_NS::DebugLogType::Log);
+            }
+        });
+
+        state.StopTiming();
+
+        debug.SetAsync(false);
+        debug.SetConsoleOutput(true);
+    }
+
+    template<SR_UTILS_NS::SharedPtrCounting Counting> static void CopySharedPtr(BenchmarkState& state) {
+        SR_HTYPES_NS::SharedPtr<BenchmarkObject> pObject(new BenchmarkObject(), SR_UTILS_NS::SharedPtrPolicy::Automatic, Counting);
+
+        for (uint64_t i = 0; i < state.GetIterations(); ++i) {
+            SR_HTYPES_NS::SharedPtr<BenchmarkObject> pCopy = pObject;
+            DoNotOptimize(pCopy);
+        }
+    }
+
+    /// Буфер Marshal выделяется через MemoryTracker, с isTracked = false трекер выключен на время замера
+    static void WriteReadMarshal(BenchmarkState& state, bool isTracked) {
+        const bool wasTracked = SR_UTILS_NS::MemoryTracker::IsEnabled();
+        SR_UTILS_NS::MemoryTracker::SetEnabled(isTracked);
+
+        constexpr uint64_t batch = 256;
+        const std::string text = "SpaRcle Engine";
+
+        for (uint64_t done = 0; done < state.GetIterations(); done += batch) {
+            const uint64_t count = std::min(batch, state.GetIterations() - done);
+
+            SR_HTYPES_NS::Marshal marshal;
+
+            for (uint64_t i = 0; i < count; ++i) {
+                marshal.Write<uint64_t>(i);
+                marshal.Write<float_t>(static_cast<float_t>(i) * 0.5f);
+                marshal.Write<std::string>(text);
+            }
+
+            marshal.SetPosition(0);
+
+            for (uint64_t i = 0; i < count; ++i) {
+                DoNotOptimize(marshal.Read<uint64_t>());
+                DoNotOptimize(marshal.Read<float_t>());
+                DoNotOptimize(marshal.Read<std::string>());
+            }
+        }
+
+        SR_UTILS_NS::MemoryTracker::SetEnabled(wasTracked);
+    }
+}
+
+using namespace SR_BENCHMARKS_NS;
+
+SR_BENCHMARK(Marshal_WriteRead) {
+    WriteReadMarshal(state, true);
+}
+
+SR_BENCHMARK(Marshal_WriteReadUntracked) {
+    WriteReadMarshal(state, false);
+}
+
+SR_BENCHMARK(SharedPtr_Copy_Plain) {
+    CopySharedPtr<SR_UTILS_NS::SharedPtrCounting::Plain>(state);
+}
+
+SR_BENCHMARK(SharedPtr_Copy_Atomic) {
+    CopySharedPtr<SR_UTILS_NS::SharedPtrCounting::Atomic>(state);
+}
+
+SR_BENCHMARK(SharedPtr_Create) {
+    for (uint64_t i = 0; i < state.GetIterations(); ++i) {
+        SR_HTYPES_NS::SharedPtr<BenchmarkObject> pObject(new BenchmarkObject());
+        DoNotOptimize(pObject);
+    }
+}
+
+SR_BENCHMARK(IntrusivePtr_Copy) {
+    SR_HTYPES_NS::IntrusivePtr<BenchmarkIntrusiveObject> pObject(new BenchmarkIntrusiveObject());
+
+    for (uint64_t i = 0; i < state.GetIterations(); ++i) {
+        SR_HTYPES_NS::IntrusivePtr<BenchmarkIntrusiveObject> pCopy = pObject;
+        DoNotOptimize(pCopy);
+    }
+}
+
+SR_BENCHMARK(HashManager_AddExisting) {
+    auto&& strings = GetBenchmarkStrings();
+    auto&& hashManager = SR_UTILS_NS::HashManager::Instance();
+
+    for (uint64_t i = 0; i < state.GetIterations(); ++i) {
+        DoNotOptimize(hashManager.AddHash(strings[i % strings.size()]));
+    }
+}
+
+SR_BENCHMARK(HashManager_HashToString) {
+    auto&& strings = GetBenchmarkStrings();
+    auto&& hashManager = SR_UTILS_NS::HashManager::Instance();
+
+    std::vector<uint64_t> hashes;
+    hashes.reserve(strings.size());
+    for (auto&& string : strings) {
+        hashes.emplace_back(hashManager.AddHash(string));
+    }
+
+    for (uint64_t i = 0; i < state.GetIterations(); ++i) {
+        DoNotOptimize(hashManager.HashToString(hashes[i % hashes.size()]));
+    }
+}
+
+/// Поиск живых ресурсов идет по шардам реестра, без общего мьютекса менеджера
+SR_BENCHMARK(ResourceManager_Find_1Thread) {
+    FindResources(state, 1);
+}
+
+SR_BENCHMARK(ResourceManager_Find_4Threads) {
+    FindResources(state, 4);
+}
+
+SR_BENCHMARK(ResourceManager_Find_16Threads) {
+    FindResources(state, 16);
+}
+
+SR_BENCHMARK(HashManager_AddExisting_4Threads) {
+    AddHashes(state, 4);
+}
+
+SR_BENCHMARK(HashManager_AddExisting_16Threads) {
+    AddHashes(state, 16);
+}
+
+SR_BENCHMARK(Log_Sync_1Thread) {
+    PrintLogs(state, 1, false);
+}
+
+SR_BENCHMARK(Log_Async_1Thread) {
+    PrintLogs(state, 1, true);
+}
+
+SR_BENCHMARK(Log_Sync_4Threads) {
+    PrintLogs(state, 4, false);
+}
+
+SR_BENCHMARK(Log_Async_4Threads) {
+    PrintLogs(state, 4, true);
+}
+
+SR_BENCHMARK(StringAtom_Create) {
+    auto&& strings = GetBenchmarkStrings();
+
+    for (uint64_t i = 0; i < state.GetIterations(); ++i) {
+        SR_UTILS_NS::StringAtom atom(strings[i % strings.size()]);
+        DoNotOptimize(atom);
+    }
+}
+
+SR_BENCHMARK(StringAtom_Compare) {
+    auto&& strings = GetBenchmarkStrings();
+
+    std::vector<SR_UTILS_NS::StringAtom> atoms(strings.begin(), strings.end());
+
+    uint64_t equal = 0;
+    for (uint64_t i = 0; i < state.GetIterations(); ++i) {
+        equal += atoms[i % atoms.size()] == atoms[(i * 7) % atoms.size()] ? 1 : 0;
+    }
+
+    DoNotOptimize(equal);
+}
+
+SR_BENCHMARK(SafeQueue_PushFlush) {
+    constexpr uint64_t batch = 1024;
+
+    SR_HTYPES_NS::SafeQueue<uint64_t> queue;
+    uint64_t sum = 0;
+
+    for (uint64_t done = 0; done < state.GetIterations(); done += batch) {
+        const uint64_t count = std::min(batch, state.GetIterations() - done);
+
+        for (uint64_t i = 0; i < count; ++i) {
+            queue.Push(i);
+        }
+
+        queue.Flush([&sum](uint64_t& value) {
+            sum += value;
+        });
+    }
+
+    DoNotOptimize(sum);
+}
+
+SR_BENCHMARK(SPSCQueue_PushFlush) {
+    constexpr uint64_t batch = 1024;
+
+    SR_HTYPES_NS::SPSCQueue<uint64_t> queue(batch);
+    uint64_t sum = 0;
+
+    for (uint64_t done = 0; done < state.GetIterations(); done += batch) {
+        const uint64_t count = std::min(batch, state.GetIterations() - done);
+
+        for (uint64_t i = 0; i < count; ++i) {
+            queue.Push(i);
+        }
+
+        queue.Flush([&sum](const uint64_t& value) {
+            sum += value;
+        });
+    }
+
+    DoNotOptimize(sum);
+}
+
+SR_BENCHMARK(Memory_MallocFree) {
+    constexpr uint64_t batch = 256;
+
+    std::array<void*, batch> blocks = { };
+
+    for (uint64_t done = 0; done < state.GetIterations(); done += batch) {
+        const uint64_t count = std::min(batch, state.GetIterations() - done);
+
+        for (uint64_t i = 0; i < count; ++i) {
+            blocks[i] = malloc(16 + (i % 8) * 16);
+        }
+
+        DoNotOptimize(blocks);
+
+        for (uint64_t i = 0; i < count; ++i) {
+            free(blocks[i]);
+        }
+    }
+}
+
+SR_BENCHMARK(Memory_TrackedAllocateFree) {
+    constexpr uint64_t batch = 256;
+
+    std::array<void*, batch> blocks = { };
+
+    for (uint64_t done = 0; done < state.GetIterations(); done += batch) {
+        const uint64_t count = std::min(batch, state.GetIterations() - done);
+
+        for (uint64_t i = 0; i < count; ++i) {
+            blocks[i] = SR_UTILS_NS::MemoryTracker::Allocate(SR_UTILS_NS::MemoryTag::Unknown, 16 + (i % 8) * 16);
+        }
+
+        DoNotOptimize(blocks);
+
+        for (uint64_t i = 0; i < count; ++i) {
+            SR_UTILS_NS::MemoryTracker::Free(blocks[i]);
+        }
+    }
+}
+
+SR_BENCHMARK(Math_MatrixCompose) {
+    SR_MATH_NS::Matrix4x4 matrix = SR_MATH_NS::Matrix4x4::Identity();
+
+    for (uint64_t i = 0; i < state.GetIterations(); ++i) {
+        const auto value = static_cast<float_t>(i & 1023);
+
+        const SR_MATH_NS::Matrix4x4 local(
+            SR_MATH_NS::FVector3(value, 1.f, 2.f),
+            SR_MATH_NS::FVector3(0.f, value, 0.f).Radians().ToQuat(),
+            SR_MATH_NS::FVector3(1.f)
+        );
+
+        matrix = local * matrix;
+        DoNotOptimize(matrix);
+    }
+}
+
+SR_BENCHMARK(Math_QuaternionRotate) {
+    const SR_MATH_NS::Quaternion rotation = SR_MATH_NS::FVector3(15.f, 30.f, 45.f).Radians().ToQuat();
+    SR_MATH_NS::FVector3 point(1.f, 2.f, 3.f);
+
+    for (uint64_t i = 0; i < state.GetIterations(); ++i) {
+        point = rotation * point;
+        DoNotOptimize(point);
+    }
+}
+
+SR_BENCHMARK(BakedMesh_Open64k) {
+    std::vector<SR_UTILS_NS::Vertex> vertices(65536);
+    std::vector<uint32_t> indices(vertices.size() * 3);
+
+    for (uint32_t i = 0; i < static_cast<uint32_t>(vertices.size()); ++i) {
+        vertices[i].position = SR_UTILS_NS::Vec3 { static_cast<float_t>(i), 1.f, 2.f };
+    }
+
+    for (uint32_t i = 0; i < static_cast<uint32_t>(indices.size()); ++i) {
+        indices[i] = i % static_cast<uint32_t>(vertices.size());
+    }
+
+    SR_UTILS_NS::BakedMeshBuilder builder;
+    builder.AddSubmesh("Benchmark", vertices, indices, { });
+
+    auto&& bakedMesh = builder.Build(0);
+    auto&& pData = reinterpret_cast<const uint64_t*>(bakedMesh.GetData());
+    const std::vector<uint64_t> blob(pData, pData + bakedMesh.GetSize() / sizeof(uint64_t));
+
+    /// копия блока заменяет чтение файла, остальное - проверка заголовка и доступ к вершинам
+    for (uint64_t i = 0; i < state.GetIterations(); ++i) {
+        auto&& opened = SR_UTILS_NS::BakedMesh::FromBlob(std::vector<uint64_t>(blob));
+        DoNotOptimize(opened.GetStaticVertices(0));
+    }
+}
+
+SR_BENCHMARK(EventDispatcher_Dispatch) {
+    std::vector<BenchmarkEventListener> listeners(BENCHMARK_EVENT_LISTENERS);
+
+    SR_UTILS_NS::EventDispatcher dispatcher;
+    for (auto&& listener : listeners) {
+        dispatcher.Register(&listener);
+    }
+
+    for (uint64_t i = 0; i < state.GetIterations(); ++i) {
+        dispatcher.Dispatch<BenchmarkEvent>(i);
+    }
+
+    DoNotOptimize(listeners.front().GetSum());
+
+    dispatcher.UnregisterAll();
+}
+
+SR_BENCHMARK(TypedEventDispatcher_Dispatch) {
+    std::vector<BenchmarkEventListener> listeners(BENCHMARK_EVENT_LISTENERS);
+
+    SR_UTILS_NS::TypedEventDispatcher<BenchmarkEvent> dispatcher;
+    for (auto&& listener : listeners) {
+        dispatcher.Subscribe<BenchmarkEvent, &BenchmarkEventListener::OnEvent>(&listener);
+    }
+
+    for (uint64_t i = 0; i < state.GetIterations(); ++i) {
+        dispatcher.Dispatch(BenchmarkEvent { i });
+    }
+
+    DoNotOptimize(listeners.front().GetSum());
+}
+
+SR_BENCHMARK(TypedEventDispatcher_PostFlush) {
+    std::vector<BenchmarkEventListener> listeners(BENCHMARK_EVENT_LISTENERS);
+
+    SR_UTILS_NS::TypedEventDispatcher<BenchmarkEvent> dispatcher;
+    for (auto&& listener : listeners) {
+        dispatcher.Subscribe<BenchmarkEvent, &BenchmarkEventListener::OnEvent>(&listener);
+    }
+
+    /// события доставляются пачками по 64, как при сбросе очереди раз в кадр
+    for (uint64_t i = 0; i < state.GetIterations(); ++i) {
+        dispatcher.Post(BenchmarkEvent { i });
+
+        if ((i & 63) == 63) {
+            dispatcher.Flush();
+        }
+    }
+
+    dispatcher.Flush();
+
+    DoNotOptimize(listeners.front().GetSum());
+}
+
+/// Одна итерация - пакет из BENCHMARK_MATH_BATCH элементов, _SIMD использует лучший доступный набор инструкций
+
+SR_BENCHMARK(Math_BatchMultiplyMatrices100k_Scalar) {
+    auto&& batch = GetBenchmarkMathBatch();
+
+    for (uint64_t i = 0; i < state.GetIterations(); ++i) {
+        SR_MATH_NS::SIMD::Scalar::MultiplyMatrices(batch.matrices.data(), batch.locals.data(), batch.resultMatrices.data(), BENCHMARK_MATH_BATCH);
+        DoNotOptimize(batch.resultMatrices.back());
+    }
+}
+
+SR_BENCHMARK(Math_BatchMultiplyMatrices100k_SIMD) {
+    auto&& batch = GetBenchmarkMathBatch();
+
+    for (uint64_t i = 0; i < state.GetIterations(); ++i) {
+        SR_MATH_NS::SIMD::MultiplyMatrices(batch.matrices.data(), batch.locals.data(), batch.resultMatrices.data(), BENCHMARK_MATH_BATCH);
+        DoNotOptimize(batch.resultMatrices.back());
+    }
+}
+
+SR_BENCHMARK(Math_BatchComposeTRS100k_Scalar) {
+    auto&& batch = GetBenchmarkMathBatch();
+
+    for (uint64_t i = 0; i < state.GetIterations(); ++i) {
+        SR_MATH_NS::SIMD::Scalar::ComposeTRS(batch.translations.data(), batch.rotations.data(), batch.scales.data(), batch.resultMatrices.data(), BENCHMARK_MATH_BATCH);
+        DoNotOptimize(batch.resultMatrices.back());
+    }
+}
+
+SR_BENCHMARK(Math_BatchComposeTRS100k_SIMD) {
+    auto&& batch = GetBenchmarkMathBatch();
+
+    for (uint64_t i = 0; i < state.GetIterations(); ++i) {
+        SR_MATH_NS::SIMD::ComposeTRS(batch.translations.data(), batch.rotations.data(), batch.scales.data(), batch.resultMatrices.data(), BENCHMARK_MATH_BATCH);
+        DoNotOptimize(batch.resultMatrices.back());
+    }
+}
+
+SR_BENCHMARK(Math_BatchDecomposeTRS100k_Scalar) {
+    auto&& batch = GetBenchmarkMathBatch();
+
+    for (uint64_t i = 0; i < state.GetIterations(); ++i) {
+        SR_MATH_NS::SIMD::Scalar::DecomposeTRS(batch.matrices.data(), batch.resultTranslations.data(), batch.resultRotations.data(), batch.resultScales.data(), BENCHMARK_MATH_BATCH);
+        DoNotOptimize(batch.resultRotations.back());
+    }
+}
+
+SR_BENCHMARK(Math_BatchDecomposeTRS100k_SIMD) {
+    auto&& batch = GetBenchmarkMathBatch();
+
+    for (uint64_t i = 0; i < state.GetIterations(); ++i) {
+        SR_MATH_NS::SIMD::DecomposeTRS(batch.matrices.data(), batch.resultTranslations.data(), batch.resultRotations.data(), batch.resultScales.data(), BENCHMARK_MATH_BATCH);
+        DoNotOptimize(batch.resultRotations.back());
+    }
+}
+
+SR_BENCHMARK(Math_BatchSlerp100k_Scalar) {
+    auto&& batch = GetBenchmarkMathBatch();
+
+    for (uint64_t i = 0; i < state.GetIterations(); ++i) {
+        SR_MATH_NS::SIMD::Scalar::SlerpQuaternions(batch.rotations.data(), batch.targetRotations.data(), batch.factors.data(), batch.resultRotations.data(), BENCHMARK_MATH_BATCH);
+        DoNotOptimize(batch.resultRotations.back());
+    }
+}
+
+SR_BENCHMARK(Math_BatchSlerp100k_SIMD) {
+    auto&& batch = GetBenchmarkMathBatch();
+
+    for (uint64_t i = 0; i < state.GetIterations(); ++i) {
+        SR_MATH_NS::SIMD::SlerpQuaternions(batch.rotations.data(), batch.targetRotations.data(), batch.factors.data(), batch.resultRotations.data(), BENCHMARK_MATH_BATCH);
+        DoNotOptimize(batch.resultRotations.back());
+    }
+}
+
+SR_BENCHMARK(Math_BatchTransformAABB100k_Scalar) {
+    auto&& batch = GetBenchmarkMathBatch();
+
+    for (uint64_t i = 0; i < state.GetIterations(); ++i) {
+        SR_MATH_NS::SIMD::Scalar::TransformAABBs(batch.matrices.data(), batch.bounds.data(), batch.resultBounds.data(), BENCHMARK_MATH_BATCH);
+        DoNotOptimize(batch.resultBounds.back());
+    }
+}
+
+SR_BENCHMARK(Math_BatchTransformAABB100k_SIMD) {
+    auto&& batch = GetBenchmarkMathBatch();
+
+    for (uint64_t i = 0; i < state.GetIterations(); ++i) {
+        SR_MATH_NS::SIMD::TransformAABBs(batch.matrices.data(), batch.bounds.data(), batch.resultBounds.data(), BENCHMARK_MATH_BATCH);
+        DoNotOptimize(batch.resultBounds.back());
+    }
+}
+
+SR_BENCHMARK(Math_BatchSpheresVsPlanes100k_Scalar) {
+    auto&& batch = GetBenchmarkMathBatch();
+
+    for (uint64_t i = 0; i < state.GetIterations(); ++i) {
+        SR_MATH_NS::SIMD::Scalar::TestSpheres(batch.planes.data(), static_cast<uint32_t>(batch.planes.size()), batch.spheres.data(), batch.visible.data(), BENCHMARK_MATH_BATCH);
+        DoNotOptimize(batch.visible.back());
+    }
+}
+
+SR_BENCHMARK(Math_BatchSpheresVsPlanes100k_SIMD) {
+    auto&& batch = GetBenchmarkMathBatch();
+
+    for (uint64_t i = 0; i < state.GetIterations(); ++i) {
+        SR_MATH_NS::SIMD::TestSpheres(batch.planes.data(), static_cast<uint32_t>(batch.planes.size()), batch.spheres.data(), batch.visible.data(), BENCHMARK_MATH_BATCH);
+        DoNotOptimize(batch.visible.back());
+    }
+}
+
+SR_BENCHMARK(Config_LoadXml) {
+    auto&& config = GetBenchmarkConfig();
+
+    for (uint64_t i = 0; i < state.GetIterations(); ++i) {
+        auto&& document = SR_XML_NS::Document::LoadFromString(config, "Benchmark.xml");
+        DoNotOptimize(ReadBenchmarkConfig(document));
+    }
+}
+
+SR_BENCHMARK(Config_LoadCompiled) {
+    const std::vector<uint64_t> blob = CompileBenchmarkConfig();
+
+    /// копия блока заменяет чтение файла кеша
+    for (uint64_t i = 0; i < state.GetIterations(); ++i) {
+        auto&& document = SR_XML_NS::CompiledConfig::FromBlob(std::vector<uint64_t>(blob)).ToDocument("Benchmark.xml");
+        DoNotOptimize(ReadBenchmarkConfig(document));
+    }
+}
+
+SR_BENCHMARK(Config_Compile) {
+    auto&& config = GetBenchmarkConfig();
+
+    for (uint64_t i = 0; i < state.GetIterations(); ++i) {
+        auto&& document = SR_XML_NS::Document::LoadFromString(config, "Benchmark.xml");
+        auto&& compiled = SR_XML_NS::CompiledConfig::Compile(document, BENCHMARK_CONFIG_SCHEMA, 0);
+        DoNotOptimize(compiled.GetSize());
+    }
+}
+
+SR_BENCHMARK(Config_StartupXml) {
+    auto&& paths = GetBenchmarkStartupConfigs();
+
+    for (uint64_t i = 0; i < state.GetIterations(); ++i) {
+        for (auto&& path : paths) {
+            auto&& document = SR_XML_NS::Document::Load(path);
+            DoNotOptimize(ReadBenchmarkConfig(document));
+        }
+    }
+}
+
+SR_BENCHMARK(Config_StartupCompiled) {
+    auto&& paths = GetBenchmarkStartupConfigs();
+
+    for (uint64_t i = 0; i < state.GetIterations(); ++i) {
+        for (auto&& path : paths) {
+            auto&& document = SR_XML_NS::CompiledConfig::LoadDocument(path, path.ConcatExt("compiled"), BENCHMARK_CONFIG_SCHEMA);
+            DoNotOptimize(ReadBenchmarkConfig(document));
+        }
+    }
+}
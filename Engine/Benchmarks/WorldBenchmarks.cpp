@@ -0,0 +1,319 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Benchmark.h>
+
+#include <Utils/World/Scene.h>
+#include <Utils/World/SceneAllocator.h>
+#include <Utils/World/SceneUpdater.h>
+#include <Utils/ECS/GameObject.h>
+#include <Utils/ECS/Transform3D.h>
+#include <Utils/ECS/ComponentManager.h>
+#include <Utils/ECS/PrefabTemplate.h>
+#include <Utils/Math/Noise.h>
+#include <Utils/Profile/MemoryTracker.h>
+
+namespace SR_BENCHMARKS_NS {
+    class BenchmarkScene final : public SR_WORLD_NS::Scene {
+    public:
+        BenchmarkScene() = default;
+
+    };
+
+    /// Синтетический компонент с дешевым Update, нагрузка в бенчмарках - обход сцены, а не сам компонент
+    class BenchmarkComponent final : public SR_UTILS_NS::Component {
+        SR_ENTITY_SET_VERSION(1000);
+        SR_INITIALIZE_COMPONENT(BenchmarkComponent);
+        using Super = SR_UTILS_NS::Component;
+    public:
+        static SR_UTILS_NS::Component* LoadComponent(SR_HTYPES_NS::Marshal& marshal, const SR_HTYPES_NS::DataStorage* dataStorage) {
+            return new BenchmarkComponent();
+        }
+
+    public:
+        void Update(float_t dt) override {
+            m_time += dt;
+        }
+
+        void OnDestroy() override {
+            Super::OnDestroy();
+            GetThis().AutoFree([](auto&& pData) {
+                delete pData;
+            });
+        }
+
+        SR_NODISCARD float_t GetTime() const noexcept { return m_time; }
+
+    private:
+        float_t m_time = 0.f;
+
+    };
+
+    SR_REGISTER_COMPONENT(BenchmarkComponent);
+
+    /// Сцена на время одного запуска бенчмарка
+    class BenchmarkWorld : public SR_UTILS_NS::NonCopyable {
+    public:
+        BenchmarkWorld() {
+            static const bool initialized = SR_WORLD_NS::SceneAllocator::Instance().Init([]() -> SR_WORLD_NS::Scene* {
+                return new BenchmarkScene();
+            });
+            SR_UNUSED_VARIABLE(initialized);
+
+            m_scene = SR_WORLD_NS::Scene::Empty();
+        }
+
+        ~BenchmarkWorld() override {
+            m_scene.AutoFree([](SR_WORLD_NS::Scene* pData) {
+                pData->Destroy();
+                delete pData;
+            });
+        }
+
+    public:
+        SR_NODISCARD SR_WORLD_NS::Scene::Ptr GetScene() const { return m_scene; }
+
+        /// Дерево объектов: width детей на каждом уровне, depth уровней
+        SR_UTILS_NS::GameObject::Ptr InstanceTree(const std::string& name, uint32_t width, uint32_t depth, bool withComponents) {
+            auto&& pRoot = m_scene->Instance(name);
+            FillTree(pRoot, width, depth, withComponents);
+            m_scene->Prepare();
+            return pRoot;
+        }
+
+    private:
+        void FillTree(const SR_UTILS_NS::GameObject::Ptr& pParent, uint32_t width, uint32_t depth, bool withComponents) {
+            if (withComponents) {
+                pParent->AddComponent(new BenchmarkComponent());
+            }
+
+            if (depth == 0) {
+                return;
+            }
+
+            for (uint32_t i = 0; i < width; ++i) {
+                auto&& pChild = m_scene->Instance(pParent->GetName() + "_" + std::to_string(i));
+                pChild->GetTransform()->SetTranslation(SR_MATH_NS::FVector3(static_cast<float_t>(i), 1.f, 0.f));
+                pParent->AddChild(pChild);
+                FillTree(pChild, width, depth - 1, withComponents);
+            }
+        }
+
+    private:
+        SR_WORLD_NS::Scene::Ptr m_scene;
+
+    };
+
+    /// Поле 256^3 в мировых координатах вдали от начала, 32 отсчета на единицу шума, 4 октавы
+    static SR_MATH_NS::NoiseGrid GetNoiseField() {
+        SR_MATH_NS::NoiseGrid grid;
+        grid.originX = 1000.5;
+        grid.originY = -200.25;
+        grid.originZ = 64.0;
+        grid.step = 1.0 / 32.0;
+        grid.sizeX = grid.sizeY = grid.sizeZ = 256;
+        return grid;
+    }
+
+    static SR_MATH_NS::NoiseParams GetNoiseFieldParams() {
+        SR_MATH_NS::NoiseParams params;
+        params.octaves = 4;
+        return params;
+    }
+
+    static void FillNoiseField(BenchmarkState& state, uint32_t threads) {
+        const SR_MATH_NS::NoiseGrid grid = GetNoiseField();
+        std::vector<float_t> field(static_cast<uint64_t>(grid.sizeX) * grid.sizeY * grid.sizeZ);
+
+        for (uint64_t i = 0; i < state.GetIterations(); ++i) {
+            SR_MATH_NS::FillNoise3D(grid, GetNoiseFieldParams(), field.data(), threads);
+            DoNotOptimize(field.back());
+        }
+    }
+}
+
+using namespace SR_BENCHMARKS_NS;
+
+/// 1 + 16 + 256 + 4096 объектов, у каждого по компоненту
+SR_BENCHMARK(Scene_Update) {
+    BenchmarkWorld world;
+    world.InstanceTree("Root", 16, 3, true);
+
+    auto&& pUpdater = world.GetScene()->GetSceneUpdater();
+    pUpdater->Build(false);
+
+    state.StartTiming();
+
+    for (uint64_t i = 0; i < state.GetIterations(); ++i) {
+        pUpdater->Update(1.f / 60.f);
+    }
+
+    state.StopTiming();
+}
+
+SR_BENCHMARK(Scene_Find) {
+    BenchmarkWorld world;
+    world.InstanceTree("Root", 16, 2, false);
+
+    std::vector<std::string> names;
+    for (uint32_t i = 0; i < 16; ++i) {
+        for (uint32_t j = 0; j < 16; ++j) {
+            names.emplace_back("Root_" + std::to_string(i) + "_" + std::to_string(j));
+        }
+    }
+
+    auto&& pScene = world.GetScene();
+
+    state.StartTiming();
+
+    for (uint64_t i = 0; i < state.GetIterations(); ++i) {
+        DoNotOptimize(pScene->Find(names[i % names.size()]));
+    }
+
+    state.StopTiming();
+}
+
+SR_BENCHMARK(Transform3D_UpdateHierarchy) {
+    BenchmarkWorld world;
+    auto&& pRoot = world.InstanceTree("Root", 8, 3, false);
+
+    std::vector<SR_UTILS_NS::Transform*> leaves;
+    for (auto&& pChild : pRoot->GetChildrenRef()) {
+        for (auto&& pGrandChild : pChild->GetChildrenRef()) {
+            for (auto&& pLeaf : pGrandChild->GetChildrenRef()) {
+                leaves.emplace_back(pLeaf->GetTransform());
+            }
+        }
+    }
+
+    state.StartTiming();
+
+    /// сдвиг корня инвалидирует все дерево, листья пересчитывают матрицы через родителей
+    for (uint64_t i = 0; i < state.GetIterations(); ++i) {
+        pRoot->GetTransform()->SetTranslation(SR_MATH_NS::FVector3(static_cast<float_t>(i & 1023), 0.f, 0.f));
+
+        for (auto&& pTransform : leaves) {
+            DoNotOptimize(pTransform->GetMatrix());
+        }
+    }
+
+    state.StopTiming();
+}
+
+/// Пара с выключенным MemoryTracker показывает цену учета памяти на целом сценарии, а не на одном выделении
+static void SaveLoadRoundtrip(BenchmarkState& state, bool isTracked) {
+    const bool wasTracked = SR_UTILS_NS::MemoryTracker::IsEnabled();
+    SR_UTILS_NS::MemoryTracker::SetEnabled(isTracked);
+
+    {
+        BenchmarkWorld world;
+        auto&& pRoot = world.InstanceTree("Root", 8, 3, true);
+        auto&& pScene = world.GetScene();
+
+        state.StartTiming();
+
+        for (uint64_t i = 0; i < state.GetIterations(); ++i) {
+            auto&& pMarshal = pRoot->Save(SR_UTILS_NS::SavableSaveData(nullptr, SR_UTILS_NS::SAVABLE_FLAG_ECS_NO_ID));
+            if (!pMarshal) {
+                SRHalt("SaveLoadRoundtrip() : failed to save game object tree!");
+                break;
+            }
+
+            pMarshal->SetPosition(0);
+
+            if (auto&& pCopy = pScene->Instance(*pMarshal)) {
+                pCopy->Destroy();
+            }
+
+            pScene->Prepare();
+
+            SR_SAFE_DELETE_PTR(pMarshal);
+        }
+
+        state.StopTiming();
+    }
+
+    SR_UTILS_NS::MemoryTracker::SetEnabled(wasTracked);
+}
+
+SR_BENCHMARK(GameObject_SaveLoadRoundtrip) {
+    SaveLoadRoundtrip(state, true);
+}
+
+SR_BENCHMARK(GameObject_SaveLoadRoundtripUntracked) {
+    SaveLoadRoundtrip(state, false);
+}
+
+/// Префаб из 1 + 4 + 16 объектов с компонентами, как m_data загруженного префаба - вне сцены
+static void InstancePrefab(BenchmarkState& state, bool useTemplate) {
+    static constexpr uint32_t INSTANCES = 10000;
+
+    BenchmarkWorld world;
+    auto&& pPrefabData = world.InstanceTree("Prefab", 4, 2, true)->Copy(nullptr);
+    auto&& pScene = world.GetScene();
+
+    SR_UTILS_NS::PrefabTemplate prefabTemplate;
+    prefabTemplate.Compile(pPrefabData);
+
+    std::vector<SR_UTILS_NS::GameObject::Ptr> instances;
+    instances.reserve(INSTANCES);
+
+    for (uint64_t i = 0; i < state.GetIterations(); ++i) {
+        state.ResumeTiming();
+
+        for (uint32_t j = 0; j < INSTANCES; ++j) {
+            instances.emplace_back(useTemplate ? prefabTemplate.Instance(pScene.Get()) : pPrefabData->Copy(pScene.Get()));
+        }
+
+        pScene->Prepare();
+
+        state.StopTiming();
+
+        for (auto&& pInstance : instances) {
+            pInstance->Destroy();
+        }
+        instances.clear();
+
+        pScene->Prepare();
+    }
+
+    pPrefabData->Destroy();
+}
+
+SR_BENCHMARK(Prefab_Instance10k_Copy) {
+    InstancePrefab(state, false);
+}
+
+SR_BENCHMARK(Prefab_Instance10k_Template) {
+    InstancePrefab(state, true);
+}
+
+/// Поточечный эталон: FractalNoise в double для каждого отсчета
+SR_BENCHMARK(Noise_Field256_Scalar) {
+    const SR_MATH_NS::NoiseGrid grid = GetNoiseField();
+    const SR_MATH_NS::NoiseParams params = GetNoiseFieldParams();
+    std::vector<float_t> field(static_cast<uint64_t>(grid.sizeX) * grid.sizeY * grid.sizeZ);
+
+    for (uint64_t i = 0; i < state.GetIterations(); ++i) {
+        float_t* pValue = field.data();
+        for (uint32_t z = 0; z < grid.sizeZ; ++z) {
+            for (uint32_t y = 0; y < grid.sizeY; ++y) {
+                for (uint32_t x = 0; x < grid.sizeX; ++x) {
+                    *pValue++ = static_cast<float_t>(SR_MATH_NS::FractalNoise(
+                        grid.originX + x * grid.step, grid.originY + y * grid.step, grid.originZ + z * grid.step, params
+                    ));
+                }
+            }
+        }
+        DoNotOptimize(field.back());
+    }
+}
+
+SR_BENCHMARK(Noise_Field256_Batch) {
+    FillNoiseField(state, 0);
+}
+
+SR_BENCHMARK(Noise_Field256_BatchThreaded) {
+    FillNoiseField(state, std::max<uint32_t>(std::thread::hardware_concurrency(), 2) - 1);
+}
@@ -0,0 +1,64 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Benchmark.h>
+
+#include <Utils/Common/CmdOptions.h>
+#include <Utils/ResourceManager/ResourceManager.h>
+#include <Utils/Platform/Platform.h>
+#include <Utils/Locale/Encoding.h>
+#include <Utils/Types/Thread.h>
+#include <Utils/Debug.h>
+
+/// Использование: SRBenchmarks [-out results.json] [-filter SharedPtr] [-min-time 50] [-repetitions 5]
+/// Результаты пишутся в JSON (в stdout, если -out не указан), сравнение с эталоном Baseline.json: CI/scripts/compare_benchmarks.py
+int main(int argc, char** argv) {
+    SR_UTILS_NS::Locale::SetLocale();
+    SR_PLATFORM_NS::InitSegmentationHandler();
+
+    SR_UTILS_NS::Debug::Instance().Init(SR_PLATFORM_NS::GetApplicationPath().GetFolder().ToString(), false);
+    SR_UTILS_NS::Debug::Instance().SetLevel(SR_UTILS_NS::Debug::Level::None);
+
+    /// загрузка объектов сцены в бенчмарках сериализации спрашивает текущий поток
+    SR_HTYPES_NS::Thread::Factory::Instance().SetMainThread();
+
+    /// ресурсы в бенчмарках создаются только в памяти, папка нужна лишь для инициализации менеджера
+    SR_UTILS_NS::ResourceManager::Instance().Init(SR_PLATFORM_NS::GetApplicationPath().GetFolder());
+    SR_UTILS_NS::ResourceManager::Instance().Run();
+
+    SR_BENCHMARKS_NS::BenchmarkOptions options;
+    options.filter = SR_UTILS_NS::GetCmdOption(argv, argv + argc, "-filter");
+
+    if (auto&& minTime = SR_UTILS_NS::GetCmdOption(argv, argv + argc, "-min-time"); !minTime.empty()) {
+        options.minTimeMs = std::stod(minTime);
+    }
+
+    if (auto&& repetitions = SR_UTILS_NS::GetCmdOption(argv, argv + argc, "-repetitions"); !repetitions.empty()) {
+        options.repetitions = static_cast<uint32_t>(std::stoul(repetitions));
+    }
+
+    auto&& results = SR_BENCHMARKS_NS::BenchmarkRegistry::Instance().Run(options);
+    auto&& json = SR_BENCHMARKS_NS::ResultsToJson(results);
+
+    int32_t code = 0;
+
+    if (auto&& outPath = SR_UTILS_NS::GetCmdOption(argv, argv + argc, "-out"); !outPath.empty()) {
+        std::ofstream file(outPath);
+        if (file.is_open()) {
+            file << json;
+        }
+        else {
+            SR_PLATFORM_NS::WriteConsoleError("Failed to write benchmark results!\n\tPath: " + outPath + "\n");
+            code = 1;
+        }
+    }
+    else {
+        std::cout << json;
+    }
+
+    SR_UTILS_NS::ResourceManager::DestroySingleton();
+    SR_UTILS_NS::GetSingletonManager()->DestroyAll();
+
+    return code;
+}
@@ -34,6 +34,9 @@ namespace SR_CORE_NS {
     private:
         SR_UTILS_NS::Path m_applicationPath;
         SR_UTILS_NS::Path m_resourcesPath;
+        SR_UTILS_NS::Path m_recordPath;
+        SR_UTILS_NS::Path m_replayPath;
+        bool m_isHeadless = false;
 
         std::atomic<bool> m_isNeedReload = false;
         std::atomic<bool> m_isNeedPlaySound = true;
@@ -65,9 +65,12 @@ namespace SR_CORE_NS {
         void SetPaused(bool isPaused);
         void SetSpeed(float_t speed);
         void SetGameMode(bool enabled);
+        /// Без окна и отрисовки, кадры вызывает Application через UpdateHeadless. Только до Create
+        void SetHeadless(bool headless);
 
         void FixedUpdate();
         void FlushScene();
+        void UpdateHeadless();
 
         SR_NODISCARD bool HasSceneInQueue() const { return !m_sceneQueue.Empty(); }
         SR_NODISCARD SR_INLINE ScenePtr GetScene() const;
@@ -79,6 +82,7 @@ namespace SR_CORE_NS {
         SR_NODISCARD SR_INLINE bool IsRun() const { return m_isRun; }
         SR_NODISCARD SR_INLINE bool IsPaused() const { return m_isPaused; }
         SR_NODISCARD SR_INLINE bool IsGameMode() const { return m_isGameMode; }
+        SR_NODISCARD SR_INLINE bool IsHeadless() const { return m_isHeadless; }
         SR_NODISCARD SR_INLINE SR_CORE_GUI_NS::EditorGUI* GetEditor() const { return m_editor; }
         SR_NODISCARD SR_INLINE SR_UTILS_NS::CmdManager* GetCmdManager() const { return m_cmdManager; }
 
@@ -95,6 +99,7 @@ namespace SR_CORE_NS {
         void SynchronizeFreeResources();
 
         void DrawCallback();
+        void Frame();
         void WorldThread();
 
     private:
@@ -106,6 +111,7 @@ namespace SR_CORE_NS {
         std::atomic<bool> m_isActive = false;
         std::atomic<bool> m_isPaused = false;
         std::atomic<bool> m_autoReloadResources = false;
+        std::atomic<bool> m_isHeadless = false;
 
         float_t m_speed = 1.f;
         SR_UTILS_NS::TimePointType m_timeStart;
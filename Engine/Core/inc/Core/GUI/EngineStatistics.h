@@ -25,6 +25,8 @@ namespace SR_CORE_NS::GUI {
         void VideoMemoryPage();
         void SubmitQueuePage();
         void FlatClusterPage();
+        void ProfilerPage();
+        void MemoryPage();
 
         void DrawSubmitInfo(const EvoVulkan::SubmitInfo& submitInfo);
 
@@ -10,6 +10,7 @@
 
 namespace SR_AUDIO_NS {
     class SR_DLL_EXPORT RawSound : public SR_UTILS_NS::IResource {
+        SR_MEMORY_TAG(SR_UTILS_NS::MemoryTag::Audio)
     private:
         RawSound();
         ~RawSound() override;
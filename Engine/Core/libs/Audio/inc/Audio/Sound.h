@@ -13,6 +13,7 @@ namespace SR_AUDIO_NS {
     struct SoundData;
 
     class Sound : public SR_UTILS_NS::IResource {
+        SR_MEMORY_TAG(SR_UTILS_NS::MemoryTag::Audio)
         using Handle = void*;
     protected:
         Sound();
@@ -2,6 +2,7 @@
 
 #include "../../Graphics/src/Graphics/Pipeline/TextureHelper.cpp"
 #include "../../Graphics/src/Graphics/Pipeline/Pipeline.cpp"
+#include "../../Graphics/src/Graphics/Pipeline/CommandList.cpp"
 #include "../../Graphics/src/Graphics/Pipeline/EmptyPipeline.cpp"
 #include "../../Graphics/src/Graphics/Pipeline/FrameBufferQueue.cpp"
 
@@ -13,6 +14,7 @@
 #include "../../Graphics/src/Graphics/Lighting/SpotLight.cpp"
 #include "../../Graphics/src/Graphics/Lighting/AreaLight.cpp"
 #include "../../Graphics/src/Graphics/Lighting/ProbeLight.cpp"
+#include "../../Graphics/src/Graphics/Lighting/LightClusters.cpp"
 #include "../../Graphics/src/Graphics/Lighting/LightSystem.cpp"
 
 #include "../../Graphics/src/Graphics/Loaders/FbxLoader.cpp"
@@ -26,6 +28,7 @@
 #include "../../Graphics/src/Graphics/Memory/TextureConfigs.cpp"
 #include "../../Graphics/src/Graphics/Memory/MeshManager.cpp"
 #include "../../Graphics/src/Graphics/Memory/UBOManager.cpp"
+#include "../../Graphics/src/Graphics/Memory/UniformArena.cpp"
 #include "../../Graphics/src/Graphics/Memory/ShaderProgramManager.cpp"
 #include "../../Graphics/src/Graphics/Memory/ShaderUBOBlock.cpp"
 #include "../../Graphics/src/Graphics/Memory/CameraManager.cpp"
@@ -53,6 +56,8 @@
 #include "../../Graphics/src/Graphics/Render/MeshCluster.cpp"
 #include "../../Graphics/src/Graphics/Render/RenderContext.cpp"
 #include "../../Graphics/src/Graphics/Render/SortedMeshQueue.cpp"
+#include "../../Graphics/src/Graphics/Render/DrawList.cpp"
+#include "../../Graphics/src/Graphics/Render/RenderGraph.cpp"
 #include "../../Graphics/src/Graphics/Render/DebugRenderer.cpp"
 #include "../../Graphics/src/Graphics/Render/RenderSettings.cpp"
 
@@ -78,6 +83,7 @@
 #include "../../Graphics/src/Graphics/Types/RenderTexture.cpp"
 
 #include "../../Graphics/src/Graphics/Utils/MeshUtils.cpp"
+#include "../../Graphics/src/Graphics/Utils/ShadowCascades.cpp"
 
 #include "../../Graphics/src/Graphics/Window/Window.cpp"
 #include "../../Graphics/src/Graphics/Window/BasicWindowImpl.cpp"
@@ -89,6 +95,7 @@
 #if defined(SR_USE_VULKAN)
     #include "../../Graphics/src/Graphics/Pipeline/Vulkan/VulkanPipeline.cpp"
     #include "../../Graphics/src/Graphics/Pipeline/Vulkan/VulkanMemory.cpp"
+    #include "../../Graphics/src/Graphics/Pipeline/Vulkan/VulkanUniformArena.cpp"
     #include "../../Graphics/src/Graphics/Pipeline/Vulkan/VulkanKernel.cpp"
 
     #if defined(SR_LINUX)
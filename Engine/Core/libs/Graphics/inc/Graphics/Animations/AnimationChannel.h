@@ -6,11 +6,10 @@
 #define SRENGINE_ANIMATIONCHANNEL_H
 
 #include <Utils/ECS/EntityRef.h>
+#include <Utils/FileSystem/BakedMesh.h>
 
 #include <Graphics/Animations/AnimationKey.h>
 
-struct aiNodeAnim;
-
 namespace SR_HTYPES_NS {
     class RawMesh;
 }
@@ -25,7 +24,7 @@ namespace SR_ANIMATIONS_NS {
         ~AnimationChannel() override;
 
     public:
-        static void Load(SR_HTYPES_NS::RawMesh* pRawMesh, aiNodeAnim* pChannel, float_t ticksPerSecond, std::vector<AnimationChannel*>& channels);
+        static void Load(SR_HTYPES_NS::RawMesh* pRawMesh, const SR_UTILS_NS::BakedMesh::Channel& channel, float_t ticksPerSecond, std::vector<AnimationChannel*>& channels);
 
         SR_NODISCARD AnimationChannel* Copy() const noexcept {
             auto&& pChannel = new AnimationChannel();
@@ -7,8 +7,6 @@
 
 #include <Utils/ResourceManager/IResource.h>
 
-class aiAnimation;
-
 namespace SR_HTYPES_NS {
     class RawMesh;
 }
@@ -24,6 +24,7 @@ namespace SR_GRAPH_NS {
         SR_NODISCARD SR_FORCE_INLINE bool ExecuteInEditMode() const override { return true; }
         SR_NODISCARD bool IsUpdatable() const noexcept override { return false; }
         SR_NODISCARD virtual LightType GetLightType() const = 0;
+        SR_NODISCARD float_t GetIntensity() const noexcept { return m_intensity; }
 
         void OnAttached() override;
         void OnDestroy() override;
@@ -0,0 +1,158 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SRENGINE_LIGHTCLUSTERS_H
+#define SRENGINE_LIGHTCLUSTERS_H
+
+#include <Utils/Common/NonCopyable.h>
+#include <Utils/Math/Vector3.h>
+#include <Utils/Math/Vector4.h>
+#include <Utils/Math/Mathematics.h>
+#include <Utils/Math/SIMD.h>
+#include <Utils/Debug.h>
+
+namespace SR_GRAPH_NS {
+    /**
+     * Разбиение пирамиды видимости на сетку кластеров: X*Y тайлов экрана и Z срезов по глубине
+     * (экспоненциально от near до far). Все расчеты в пространстве вида: x вправо, y вверх,
+     * z - расстояние вдоль направления взгляда. Тайл (0, 0) - левый нижний угол экрана.
+     */
+    struct LightClusterConfig {
+        uint32_t sizeX = 16;
+        uint32_t sizeY = 9;
+        uint32_t sizeZ = 24;
+
+        float_t near = 0.1f;
+        float_t far = 1000.f;
+
+        /// вертикальный FOV в радианах
+        float_t FOV = 1.5708f;
+        float_t aspect = 16.f / 9.f;
+    };
+
+    struct ClusterLight {
+        /// Точечный источник: сфера радиуса radius вокруг position
+        SR_NODISCARD static ClusterLight Point(const SR_MATH_NS::FVector3& position, float_t radius, uint32_t index) noexcept;
+        /// Прожектор: конус с вершиной в position, высотой distance вдоль direction и радиусом основания coneRadius
+        SR_NODISCARD static ClusterLight Spot(const SR_MATH_NS::FVector3& position, const SR_MATH_NS::FVector3& direction,
+            float_t distance, float_t coneRadius, uint32_t index) noexcept;
+
+        /// для прожектора - вершина конуса
+        SR_MATH_NS::FVector3 position;
+        /// для прожектора - высота конуса
+        float_t radius = 0.f;
+
+        /// описанная сфера всего объема источника, по ней идет грубый отбор кластеров
+        SR_MATH_NS::FVector3 boundingCenter;
+        float_t boundingRadius = 0.f;
+
+        /// только для прожекторов: нормированное направление и половина угла конуса
+        SR_MATH_NS::FVector3 direction;
+        float_t cosHalfAngle = 0.f;
+        float_t sinHalfAngle = 0.f;
+        bool spot = false;
+
+        float_t intensity = 1.f;
+
+        /// индекс источника в списке, который получит шейдер
+        uint32_t index = 0;
+    };
+
+    struct LightClusterRange {
+        uint32_t offset = 0;
+        uint32_t count = 0;
+    };
+
+    struct LightClusterBounds {
+        SR_MATH_NS::FVector3 min;
+        SR_MATH_NS::FVector3 max;
+    };
+
+    /// Раскладка источников света по кластерам на CPU.
+    /// Сборка повторяет схему compute-прохода: пары (кластер, свет), подсчет, префиксная сумма и раскладка,
+    /// результат - непрерывный список индексов и диапазон на кластер, готовые к загрузке в буфер.
+    class SR_DLL_EXPORT LightClusterGrid : public SR_UTILS_NS::NonCopyable {
+    public:
+        bool Init(const LightClusterConfig& config);
+
+        void Build(const std::vector<ClusterLight>& lights);
+
+        SR_NODISCARD uint32_t GetClusterIndex(uint32_t x, uint32_t y, uint32_t z) const noexcept {
+            return x + m_config.sizeX * (y + m_config.sizeY * z);
+        }
+
+        /// Срез для глубины в пространстве вида, SR_UINT32_MAX - вне [near, far]
+        SR_NODISCARD uint32_t GetSlice(float_t depth) const noexcept;
+        SR_NODISCARD float_t GetSliceDepth(uint32_t slice) const noexcept;
+
+        SR_NODISCARD uint32_t GetClustersCount() const noexcept { return static_cast<uint32_t>(m_bounds.size()); }
+        SR_NODISCARD const LightClusterConfig& GetConfig() const noexcept { return m_config; }
+        SR_NODISCARD float_t GetTanX() const noexcept { return m_tanX; }
+        SR_NODISCARD float_t GetTanY() const noexcept { return m_tanY; }
+        SR_NODISCARD float_t GetLogDepthScale() const noexcept { return m_logDepthScale; }
+        SR_NODISCARD const LightClusterBounds& GetBounds(uint32_t cluster) const { return m_bounds[cluster]; }
+
+        SR_NODISCARD const std::vector<LightClusterRange>& GetRanges() const noexcept { return m_ranges; }
+        SR_NODISCARD const std::vector<uint32_t>& GetIndices() const noexcept { return m_indices; }
+        /// Источники, прошедшие отбор по пирамиде в последней сборке
+        SR_NODISCARD uint32_t GetVisibleLightsCount() const noexcept { return m_visibleLightsCount; }
+
+        SR_NODISCARD static bool SphereIntersectsBounds(const SR_MATH_NS::FVector3& center, float_t radius, const LightClusterBounds& bounds) noexcept;
+        SR_NODISCARD static bool ConeIntersectsSphere(const ClusterLight& light, const SR_MATH_NS::FVector3& center, float_t radius) noexcept;
+        SR_NODISCARD static bool LightIntersectsBounds(const ClusterLight& light, const LightClusterBounds& bounds) noexcept;
+
+    private:
+        void BinLight(const ClusterLight& light);
+
+    private:
+        LightClusterConfig m_config;
+
+        float_t m_tanX = 0.f;
+        float_t m_tanY = 0.f;
+        float_t m_logDepthScale = 0.f;
+
+        std::vector<LightClusterBounds> m_bounds;
+
+        /// Пирамида, расширенная до боксов кластеров: источник вне нее не пересекает ни один кластер
+        std::array<SR_MATH_NS::Plane, 6> m_planes;
+        std::vector<SR_MATH_NS::Sphere> m_spheres;
+        std::vector<uint8_t> m_visible;
+        uint32_t m_visibleLightsCount = 0;
+
+        /// пары (кластер, свет) текущей сборки
+        std::vector<std::pair<uint32_t, uint32_t>> m_pairs;
+
+        std::vector<LightClusterRange> m_ranges;
+        std::vector<uint32_t> m_indices;
+
+    };
+
+    /**
+     * Кластеры в виде встроенных uniform-массивов прохода освещения (LIGHT_CLUSTER_*, CLUSTER_LIGHTS).
+     * Размеры подобраны под 16 КБ гарантированного диапазона UBO, все, что не влезло, отбрасывается:
+     * диапазон кластера - offset | count << 16, индексы упакованы по 8 бит, на источник 3 vec4:
+     * (позиция в пространстве вида, радиус), (направление, cos половины угла), (интенсивность, прожектор, 0, 0).
+     */
+    struct LightClusterShaderData {
+        static constexpr uint32_t MaxClusters = 16 * 9 * 16;
+        static constexpr uint32_t MaxIndices = 2048;
+        static constexpr uint32_t MaxLights = 64;
+
+        void Pack(const LightClusterGrid& grid, const std::vector<ClusterLight>& lights);
+
+        /// (near, logDepthScale, tanX, tanY)
+        SR_MATH_NS::FVector4 params;
+        /// (sizeX, sizeY, sizeZ, количество источников)
+        std::array<int32_t, 4> size = { };
+
+        std::array<int32_t, MaxClusters> ranges = { };
+        std::array<int32_t, MaxIndices / 4> indices = { };
+        std::array<SR_MATH_NS::FVector4, MaxLights * 3> lights;
+
+        /// индексы, не поместившиеся в MaxIndices или указывающие на источник за MaxLights
+        uint32_t droppedIndices = 0;
+    };
+}
+
+#endif //SRENGINE_LIGHTCLUSTERS_H
@@ -6,6 +6,7 @@
 #define SRENGINE_LIGHTSYSTEM_H
 
 #include <Graphics/Pipeline/Pipeline.h>
+#include <Graphics/Lighting/LightClusters.h>
 
 namespace SR_GRAPH_NS {
     class DirectionalLight;
@@ -16,6 +17,10 @@ namespace SR_GRAPH_NS {
     class RenderScene;
     class ILightComponent;
 
+    namespace Types {
+        class Camera;
+    }
+
     class LightSystem : SR_UTILS_NS::NonCopyable {
     public:
         using RenderScenePtr = SR_HTYPES_NS::SafePtr<SR_GRAPH_NS::RenderScene>;
@@ -26,6 +31,15 @@ namespace SR_GRAPH_NS {
         void Register(ILightComponent* pLightComponent);
         void Remove(ILightComponent* pLightComponent);
 
+        /// Раскладывает точечные источники и прожекторы по кластерам пирамиды видимости камеры.
+        /// Индексы в кластерах указывают на GetClusterLights(), упакованный результат - GetClusterShaderData(),
+        /// его загружает в uniform-блок проход освещения (PostProcessPass)
+        void UpdateClusters(const Types::Camera* pCamera);
+
+        SR_NODISCARD const LightClusterGrid& GetClusters() const noexcept { return m_clusters; }
+        SR_NODISCARD const std::vector<ClusterLight>& GetClusterLights() const noexcept { return m_clusterLights; }
+        SR_NODISCARD const LightClusterShaderData& GetClusterShaderData() const noexcept { return m_clusterShaderData; }
+
     public:
         SR_MATH_NS::FVector3 m_position = SR_MATH_NS::FVector3(20, 60, 5);
         RenderScenePtr m_renderScene;
@@ -34,6 +48,12 @@ namespace SR_GRAPH_NS {
         std::set<AreaLight*> m_areaLights;
         std::set<SpotLight*> m_spotLights;
         std::set<ProbeLight*> m_probeLights;
+
+    private:
+        LightClusterGrid m_clusters;
+        std::vector<ClusterLight> m_clusterLights;
+        LightClusterShaderData m_clusterShaderData;
+
     };
 }
 
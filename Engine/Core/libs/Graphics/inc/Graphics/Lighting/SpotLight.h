@@ -9,6 +9,14 @@
 
 namespace SR_GRAPH_NS {
     class SpotLight : public ILightComponent {
+    public:
+        SR_NODISCARD LightType GetLightType() const override { return LightType::Spot; }
+
+        /// радиус основания конуса на расстоянии m_distance от источника
+        SR_NODISCARD float_t GetRadius() const noexcept { return m_radius; }
+        SR_NODISCARD float_t GetDistance() const noexcept { return m_distance; }
+        SR_NODISCARD SR_MATH_NS::FVector3 GetDirection() const;
+
     protected:
         float_t m_radius = 1.f;
         float_t m_distance = 10.f;
@@ -47,12 +47,38 @@ namespace SR_GRAPH_NS {
 
         };
 
+        /// Ключ видеопамяти меша: заранее посчитанный хеш идентификатора, для VBO смешанный с типом вершин.
+        /// Считается один раз на меш, поиск в менеджере не собирает строк и не хеширует их заново.
+        struct MeshKey {
+            using Hash = uint64_t;
+
+            template<Vertices::VertexType vertexType, MeshMemoryType memType> static MeshKey Make(std::string_view identifier) {
+                return FromIdentifierHash<vertexType, memType>(SR_HASH_STR_VIEW(identifier));
+            }
+
+            /// Для хеша идентификатора, который меш хранит у себя
+            template<Vertices::VertexType vertexType, MeshMemoryType memType> static MeshKey FromIdentifierHash(Hash identifierHash) {
+                MeshKey key;
+                key.hash = identifierHash;
+
+                if constexpr (memType == MeshMemoryType::VBO) {
+                    key.hash = SR_COMBINE_HASHES(key.hash, static_cast<Hash>(vertexType) + 1);
+                }
+
+                return key;
+            }
+
+            SR_NODISCARD bool operator==(const MeshKey& other) const noexcept { return hash == other.hash; }
+
+            Hash hash = 0;
+        };
+
         class MeshManager : public SR_UTILS_NS::Singleton<MeshManager> {
             SR_REGISTER_SINGLETON(MeshManager)
             using Hash = uint64_t;
             using HashTable = std::vector<uint64_t>;
         public:
-            typedef std::unordered_map<Hash, MeshVidMemInfo> VideoResources;
+            typedef ska::flat_hash_map<Hash, MeshVidMemInfo> VideoResources;
             typedef std::optional<VideoResources::iterator> VideoResourcesIter;
 
             enum class FreeResult {
@@ -67,45 +93,23 @@ namespace SR_GRAPH_NS {
             VideoResourcesIter FindById(int32_t id, MeshMemoryType memType);
             VideoResourcesIter FindImpl(Hash hash, MeshMemoryType memType);
 
-            bool RegisterImpl(const std::string& identifier, MeshMemoryType memType, uint32_t size, uint32_t id);
+            bool RegisterImpl(const MeshKey& key, MeshMemoryType memType, uint32_t size, uint32_t id);
             FreeResult FreeImpl(VideoResourcesIter iter, MeshMemoryType memType);
 
             void OnSingletonDestroy() override;
 
-            template<Vertices::VertexType vertexType, MeshMemoryType memType> VideoResourcesIter Find(const std::string& identifier) {
-                if constexpr (memType == MeshMemoryType::VBO) {
-                    const Hash hash = SR_HASH_STR(identifier + SR_UTILS_NS::EnumReflector::ToStringAtom<Vertices::VertexType>(vertexType).ToStringRef());
-                    return FindImpl(hash, memType);
-                }
-
-                if constexpr (memType == MeshMemoryType::IBO) {
-                    const Hash hash = SR_HASH_STR(identifier);
-                    return FindImpl(hash, memType);
-                }
-
-                SRHalt("Unknown memory type!");
-
-                return std::nullopt;
-            }
-
         public:
-            template<Vertices::VertexType vertexType, MeshMemoryType memType> bool Register(const std::string_view& identifier, uint32_t size, uint32_t id) {
-                return Register<vertexType, memType>(std::string(identifier), size, id);
-            }
+            template<MeshMemoryType memType> bool Register(const MeshKey& key, uint32_t size, uint32_t id) {
+                static_assert(memType == MeshMemoryType::VBO || memType == MeshMemoryType::IBO, "Unknown memory type!");
 
-            template<Vertices::VertexType vertexType, MeshMemoryType memType> bool Register(const std::string& identifier, uint32_t size, uint32_t id) {
                 SR_LOCK_GUARD
 
-                if (Find<vertexType, memType>(identifier).has_value()) {
+                if (FindImpl(key.hash, memType).has_value()) {
                     SRHalt("MeshManager::Register() : memory already registered!");
                     return false;
                 }
 
-                if constexpr (memType == MeshMemoryType::VBO) {
-                    return RegisterImpl(identifier + SR_UTILS_NS::EnumReflector::ToStringAtom(vertexType).ToStringRef(), memType, size, id);
-                }
-                else
-                    return RegisterImpl(identifier, memType, size, id);
+                return RegisterImpl(key, memType, size, id);
             }
 
             template<MeshMemoryType memType> FreeResult Free(int32_t id) {
@@ -120,34 +124,36 @@ namespace SR_GRAPH_NS {
                 }
             }
 
-            template<Vertices::VertexType vertexType, MeshMemoryType memType> int32_t CopyIfExists(const std::string& identifier) {
+            template<MeshMemoryType memType> int32_t CopyIfExists(const MeshKey& key) {
                 SR_LOCK_GUARD
 
-                if (auto memory = Find<vertexType, memType>(identifier); memory.has_value()) {
+                if (auto memory = FindImpl(key.hash, memType); memory.has_value()) {
                     return memory.value()->second.Copy();
                 }
 
                 return SR_ID_INVALID;
             }
 
-            template<Vertices::VertexType vertexType, MeshMemoryType memType> uint32_t Size(const std::string& identifier) {
+            template<MeshMemoryType memType> uint32_t Size(const MeshKey& key) {
                 SR_LOCK_GUARD
 
-                if (auto memory = Find<vertexType, memType>(std::string(identifier)); memory.has_value()) {
+                if (auto memory = FindImpl(key.hash, memType); memory.has_value()) {
                     return memory.value()->second.Size();
                 }
 
                 return 0;
             }
 
-            template<Vertices::VertexType vertexType, MeshMemoryType memType> int32_t CopyIfExists(const std::string_view& identifier) {
-                SR_LOCK_GUARD
+            template<Vertices::VertexType vertexType, MeshMemoryType memType> bool Register(std::string_view identifier, uint32_t size, uint32_t id) {
+                return Register<memType>(MeshKey::Make<vertexType, memType>(identifier), size, id);
+            }
 
-                if (auto memory = Find<vertexType, memType>(std::string(identifier)); memory.has_value()) {
-                    return memory.value()->second.Copy();
-                }
+            template<Vertices::VertexType vertexType, MeshMemoryType memType> int32_t CopyIfExists(std::string_view identifier) {
+                return CopyIfExists<memType>(MeshKey::Make<vertexType, memType>(identifier));
+            }
 
-                return SR_ID_INVALID;
+            template<Vertices::VertexType vertexType, MeshMemoryType memType> uint32_t Size(std::string_view identifier) {
+                return Size<memType>(MeshKey::Make<vertexType, memType>(identifier));
             }
 
         private:
@@ -58,17 +58,21 @@ namespace SR_GRAPH_NS::Memory {
 
     class TextureConfigs : public SR_UTILS_NS::Singleton<TextureConfigs> {
         friend class SR_UTILS_NS::Singleton<TextureConfigs>;
+        using Hash = uint64_t;
     private:
         ~TextureConfigs() override = default;
 
     public:
         bool Reload();
-        std::optional<TextureConfig> Find(const std::string& path);
-        TextureConfig FindOrDefault(const std::string& path);
+        std::optional<TextureConfig> Find(std::string_view path);
+        TextureConfig FindOrDefault(std::string_view path);
+
+        /// Поиск по заранее посчитанному хешу пути (SR_HASH_STR_VIEW)
+        std::optional<TextureConfig> Find(Hash pathHash);
 
     private:
         std::atomic<bool> m_loaded = false;
-        std::unordered_map<std::string, TextureConfig> m_configs;
+        ska::flat_hash_map<Hash, TextureConfig> m_configs;
 
     };
 }
@@ -0,0 +1,149 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SRENGINE_UNIFORMARENA_H
+#define SRENGINE_UNIFORMARENA_H
+
+#include <Utils/Common/NonCopyable.h>
+#include <Utils/Math/Mathematics.h>
+
+namespace SR_GRAPH_NS::Memory {
+    /**
+     * Логика линейного кольцевого буфера юниформ на кадр, без привязки к графическому API.
+     * Позиции растут монотонно, смещение в буфере - позиция по модулю емкости.
+     * Кадр N освобождает память кадра N - framesInFlight, поэтому перед BeginFrame
+     * вызывающая сторона должна дождаться fence этого кадра.
+     * Записи команд (BeginRecord) держат свою память, пока владелец не перезапишет команды,
+     * и еще framesInFlight кадров после этого, пока старые буферы команд в полете.
+     */
+    class SR_DLL_EXPORT UniformArenaAllocator : public SR_UTILS_NS::NonCopyable {
+    public:
+        static constexpr uint64_t InvalidOffset = SR_UINT64_MAX;
+
+        struct Stats {
+            uint64_t capacity = 0;
+            uint64_t frameUsage = 0;
+            uint64_t peakFrameUsage = 0;
+            uint64_t inFlightUsage = 0;
+            uint32_t allocations = 0;
+            uint32_t failedAllocations = 0;
+        };
+
+    public:
+        /// alignment - степень двойки (minUniformBufferOffsetAlignment), capacity выравнивается вниз до нее
+        bool Init(uint64_t capacity, uint64_t alignment, uint32_t framesInFlight);
+        void Reset();
+
+        void BeginFrame();
+        void EndFrame();
+
+        /// Возвращает выровненное смещение в буфере или InvalidOffset, если места не хватило
+        SR_NODISCARD uint64_t Allocate(uint64_t size);
+
+        /// Выделения после BeginRecord живут до следующей записи или ReleaseRecord того же владельца
+        void BeginRecord(const void* pOwner);
+        void ReleaseRecord(const void* pOwner);
+
+        /// Номер текущей записи владельца, 0 - записи нет. Номера не повторяются, в том числе после Reset
+        SR_NODISCARD uint64_t GetRecordId(const void* pOwner) const;
+
+        SR_NODISCARD uint64_t GetCapacity() const noexcept { return m_capacity; }
+        SR_NODISCARD uint64_t GetAlignment() const noexcept { return m_alignment; }
+        SR_NODISCARD uint32_t GetFramesInFlight() const noexcept { return static_cast<uint32_t>(m_frameEnds.size()); }
+        SR_NODISCARD uint64_t GetFrame() const noexcept { return m_frame; }
+        SR_NODISCARD bool IsFrameActive() const noexcept { return m_frameActive; }
+        SR_NODISCARD const Stats& GetStats() const noexcept { return m_stats; }
+
+    private:
+        SR_NODISCARD uint64_t AlignUp(uint64_t value) const noexcept { return (value + m_alignment - 1) & ~(m_alignment - 1); }
+
+    private:
+        uint64_t m_capacity = 0;
+        uint64_t m_alignment = 1;
+
+        /// монотонные позиции: [m_tail, m_head) занято кадрами в полете
+        uint64_t m_head = 0;
+        uint64_t m_tail = 0;
+        uint64_t m_frameBegin = 0;
+
+        /// позиция m_head на конце кадра, по слоту на каждый кадр в полете
+        std::vector<uint64_t> m_frameEnds;
+
+        struct Record {
+            uint64_t begin = 0;
+            uint64_t id = 0;
+        };
+
+        /// начала живых записей и записей, отпущенных в кадре слота. Хвост не заходит дальше них
+        std::unordered_map<const void*, Record> m_records;
+        std::vector<uint64_t> m_frameRetained;
+        uint64_t m_recordsCount = 0;
+
+        uint64_t m_frame = 0;
+        bool m_frameActive = false;
+
+        Stats m_stats;
+
+    };
+
+    /// Память, в которую пишет UniformArena: системная для тестов и CPU-путей, или отображенный буфер GPU
+    class SR_DLL_EXPORT IUniformArenaStorage : public SR_UTILS_NS::NonCopyable {
+    public:
+        ~IUniformArenaStorage() override = default;
+
+    public:
+        virtual bool Init(uint64_t capacity) = 0;
+        virtual void DeInit() = 0;
+        virtual void Write(uint64_t offset, const void* pData, uint64_t size) = 0;
+
+    };
+
+    class SR_DLL_EXPORT UniformArenaCPUStorage final : public IUniformArenaStorage {
+    public:
+        bool Init(uint64_t capacity) override;
+        void DeInit() override;
+        void Write(uint64_t offset, const void* pData, uint64_t size) override;
+
+        SR_NODISCARD const char* GetData() const noexcept { return m_data.data(); }
+
+    private:
+        std::vector<char> m_data;
+
+    };
+
+    /// Кольцевой буфер юниформ: выделение через UniformArenaAllocator и запись в хранилище.
+    /// Результат Push - динамическое смещение для привязки дескриптора.
+    class SR_DLL_EXPORT UniformArena : public SR_UTILS_NS::NonCopyable {
+    public:
+        explicit UniformArena(std::unique_ptr<IUniformArenaStorage> pStorage);
+        ~UniformArena() override;
+
+    public:
+        bool Init(uint64_t capacity, uint64_t alignment, uint32_t framesInFlight);
+        void DeInit();
+
+        void BeginFrame() { m_allocator.BeginFrame(); }
+        void EndFrame() { m_allocator.EndFrame(); }
+
+        void BeginRecord(const void* pOwner) { m_allocator.BeginRecord(pOwner); }
+        void ReleaseRecord(const void* pOwner) { m_allocator.ReleaseRecord(pOwner); }
+
+        SR_NODISCARD uint64_t Push(const void* pData, uint64_t size);
+
+        /// Резервирует место без записи, данные пишутся позже через Write по полученному смещению
+        SR_NODISCARD uint64_t Allocate(uint64_t size) { return m_allocator.Allocate(size); }
+        void Write(uint64_t offset, const void* pData, uint64_t size);
+
+        SR_NODISCARD IUniformArenaStorage* GetStorage() const noexcept { return m_storage.get(); }
+        SR_NODISCARD const UniformArenaAllocator& GetAllocator() const noexcept { return m_allocator; }
+
+    private:
+        UniformArenaAllocator m_allocator;
+        std::unique_ptr<IUniformArenaStorage> m_storage;
+        bool m_initialized = false;
+
+    };
+}
+
+#endif //SRENGINE_UNIFORMARENA_H
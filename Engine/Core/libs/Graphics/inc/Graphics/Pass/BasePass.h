@@ -32,6 +32,7 @@ namespace SR_GRAPH_NS {
     class RenderTechnique;
     class Pipeline;
     class BasePass;
+    class RenderGraphPassBuilder;
 
     typedef std::map<std::string, SR_HTYPES_NS::Function<BasePass*(const SR_XML_NS::Node&)>> RenderPassMap;
     RenderPassMap& GetRenderPassMap();
@@ -69,6 +70,10 @@ namespace SR_GRAPH_NS {
         /// Вызывается постоянно после построения
         virtual void Update() { }
 
+        /// Команды прохода устарели, но перестраивать всю сцену не нужно: достаточно перезаписать
+        /// буфер команд кадрового буфера, в котором записан проход
+        SR_NODISCARD virtual bool IsRecordOutdated() const { return false; }
+
         virtual void OnResize(const SR_MATH_NS::UVector2& size) { }
         virtual void OnSamplesChanged() { }
 
@@ -77,6 +82,9 @@ namespace SR_GRAPH_NS {
 
         SR_NODISCARD virtual std::vector<SR_GTYPES_NS::Framebuffer*> GetFrameBuffers() const { return { }; }
 
+        /// Объявляет ресурсы, которые проход читает и пишет. Вызывается при сборке графа техники
+        virtual void DeclareResources(RenderGraphPassBuilder& builder) const;
+
         virtual void SetRenderTechnique(RenderTechnique* pRenderTechnique);
         void SetName(const SR_UTILS_NS::StringAtom& name);
 
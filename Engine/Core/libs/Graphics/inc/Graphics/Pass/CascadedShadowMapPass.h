@@ -6,8 +6,16 @@
 #define SRENGINE_CASCADEDSHADOWMAPPASS_H
 
 #include <Graphics/Pass/ShaderOverridePass.h>
+#include <Graphics/Utils/ShadowCascades.h>
 
 namespace SR_GRAPH_NS {
+    /// Какие кастеры рисует проход. Static - кэш каскадов, слой перерисовывается только когда каскад
+    /// уходит за запас или в нем двигается кастер. Dynamic - только сдвинувшиеся кастеры поверх кэша
+    /// прохода StaticPass, шейдер берет ближайшую из двух глубин
+    SR_ENUM_NS_CLASS_T(ShadowCasterSet, uint8_t,
+        All, Static, Dynamic
+    )
+
     class CascadedShadowMapPass : public ShaderOverridePass {
         SR_REGISTER_LOGICAL_NODE(CascadedShadowMapPass, Cascaded Shadow Map Pass, { "Passes" })
         using Super = ShaderOverridePass;
@@ -20,9 +28,30 @@ namespace SR_GRAPH_NS {
 
         bool Load(const SR_XML_NS::Node& passNode) override;
 
+        void SR_FASTCALL OnMeshRemoved(SR_GTYPES_NS::Mesh* pMesh, bool transparent) override;
+
         SR_NODISCARD const std::vector<SR_MATH_NS::Matrix4x4>& GetCascadeMatrices() const { return m_cascadeMatrices; }
         SR_NODISCARD const std::vector<float_t>& GetSplitDepths() const { return m_cascadeSplitDepths; }
 
+        SR_NODISCARD bool IsDynamicCaster(MeshPtr pMesh) const { return m_dynamicCasters.count(pMesh) == 1; }
+        /// меняется, когда кастер переходит между статичными и динамичными
+        SR_NODISCARD uint64_t GetCastersVersion() const noexcept { return m_castersVersion; }
+
+        void DeclareResources(RenderGraphPassBuilder& builder) const override;
+
+    protected:
+        struct StaticCaster {
+            uint64_t matrixVersion = 0;
+            /// битовая маска каскадов, в которые кастер записан
+            uint32_t cascades = 0;
+        };
+
+        struct DynamicCaster {
+            uint64_t matrixVersion = 0;
+            /// сколько кадров подряд матрица не менялась
+            uint32_t stillFrames = 0;
+        };
+
     protected:
         void UseSharedUniforms(ShaderPtr pShader) override;
         void UseConstants(ShaderPtr pShader) override;
@@ -30,6 +59,21 @@ namespace SR_GRAPH_NS {
 
         bool CheckCamera();
         void UpdateCascades();
+        void UpdateCascadeMatrices(const std::vector<ShadowCascade>& cascades);
+
+        /// Маска каскадов, чье отсечение в записанных командах устарело: каскад ушел дальше запаса,
+        /// статичный кастер сдвинулся или динамичный достаточно долго стоит на месте и снова может отсекаться
+        SR_NODISCARD uint32_t GetOutdatedCascades();
+        SR_NODISCARD uint32_t UpdateCasters();
+        SR_NODISCARD uint32_t GetCascadesMask(MeshPtr pMesh) const;
+        SR_NODISCARD uint32_t GetAllCascadesMask() const noexcept { return (1u << m_cascadesCount) - 1; }
+
+        /// Записывает буфер команд кадрового буфера: рендер-проходы только для слоев из маски.
+        /// Пустая маска дает буфер без рендер-проходов, слои при исполнении не очищаются
+        void RecordCascades(uint32_t cascades);
+
+        SR_NODISCARD bool IsMeshVisible(MeshPtr pMesh) override;
+        SR_NODISCARD bool IsBlendOrderDependent() const override { return false; }
 
         SR_NODISCARD MeshClusterTypeFlag GetClusterType() const noexcept override;
 
@@ -44,12 +88,41 @@ namespace SR_GRAPH_NS {
         uint32_t m_currentCascade = 0;
         uint32_t m_cascadesCount = 0;
         float_t m_cascadeSplitLambda = 0.95f;
+        /// запас отсечения в долях радиуса каскада
+        float_t m_cullingMargin = 0.1f;
+        /// через сколько кадров без движения динамичный кастер снова становится статичным
+        uint32_t m_settleFrames = 60;
+
+        ShadowCasterSet m_casterSet = ShadowCasterSet::All;
+        SR_UTILS_NS::StringAtom m_staticPassName;
+        CascadedShadowMapPass* m_staticPass = nullptr;
+
+        /// слои, записанные в текущий буфер команд
+        uint32_t m_recordedCascades = 0;
+        bool m_recordedInBuild = false;
+        uint64_t m_castersVersion = 0;
+        uint64_t m_recordedCastersVersion = 0;
 
         bool m_usePerspective = false;
 
         std::vector<SR_MATH_NS::Matrix4x4> m_cascadeMatrices;
         std::vector<float_t> m_cascadeSplitDepths;
 
+        std::vector<ShadowCascade> m_cascades;
+        SR_MATH_NS::Matrix4x4 m_lightRotation;
+        SR_MATH_NS::FVector3 m_lightDirection;
+
+        /// Каскады и направление света, по которым отсекались кастеры при последней записи команд.
+        /// Для кэша это и есть каскады, которыми рисовались слои, шейдер получает их матрицы
+        std::vector<ShadowCascade> m_culledCascades;
+        SR_MATH_NS::FVector3 m_culledLightDirection;
+
+        /// Указатели живут до OnMeshRemoved, который приходит до освобождения меша.
+        /// Статичные кастеры отсекаются по каскадам, версия матрицы на момент записи
+        ska::flat_hash_map<MeshPtr, StaticCaster> m_staticCasters;
+        /// сдвинувшиеся кастеры рисуются во все каскады без отсечения, пока не простоят m_settleFrames кадров
+        ska::flat_hash_map<MeshPtr, DynamicCaster> m_dynamicCasters;
+
     };
 }
 
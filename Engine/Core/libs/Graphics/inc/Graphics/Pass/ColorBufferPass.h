@@ -21,6 +21,7 @@ namespace SR_GRAPH_NS {
 
         SR_NODISCARD SR_GTYPES_NS::Framebuffer* GetColorFrameBuffer() const noexcept override;
         SR_NODISCARD MeshClusterTypeFlag GetClusterType() const noexcept override;
+        SR_NODISCARD bool IsBlendOrderDependent() const override { return false; }
 
     protected:
         void UseUniforms(ShaderPtr pShader, MeshPtr pMesh) override;
@@ -28,11 +28,15 @@ namespace SR_GRAPH_NS {
 
         void Update() override;
 
+        SR_NODISCARD bool IsRecordOutdated() const override;
+
         void OnResize(const SR_MATH_NS::UVector2& size) override;
         void OnSamplesChanged() override;
 
         void SetRenderTechnique(RenderTechnique* pRenderTechnique) override;
 
+        void DeclareResources(RenderGraphPassBuilder& builder) const override;
+
         SR_NODISCARD BasePass* FindPass(const SR_UTILS_NS::StringAtom& name) const;
 
         bool ForEachPass(const SR_HTYPES_NS::Function<bool(BasePass*)>& callback) const;
@@ -8,6 +8,7 @@
 #include <Utils/Xml.h>
 #include <Graphics/Pipeline/TextureHelper.h>
 #include <Graphics/Pipeline/TextureHelper.h>
+#include <Graphics/Render/RenderGraph.h>
 
 namespace SR_GTYPES_NS {
     class Framebuffer;
@@ -28,6 +29,9 @@ namespace SR_GRAPH_NS {
     public:
         SR_NODISCARD FramebufferPtr GetFramebuffer() const noexcept { return m_framebuffer; }
         SR_NODISCARD bool IsFrameBufferRendered() const noexcept { return m_isFrameBufferRendered; }
+        SR_NODISCARD bool IsTransient() const noexcept { return m_transient; }
+
+        SR_NODISCARD RenderGraphResourceDesc GetRenderGraphDesc() const;
 
     protected:
         void LoadFramebufferSettings(const SR_XML_NS::Node& settingsNode);
@@ -40,6 +44,9 @@ namespace SR_GRAPH_NS {
         bool m_isFrameBufferRendered = false;
         bool m_dynamicResizing = false;
         bool m_depthEnabled = true;
+        /// буфер нужен только проходам этой техники и снаружи не читается: проход без читателей отсекается.
+        /// Память не экономит, буфер все равно свой, граф лишь вычисляет слоты совмещения
+        bool m_transient = false;
 
         SR_MATH_NS::FVector2 m_preScale = SR_MATH_NS::FVector2(1.f);
         SR_MATH_NS::IVector2 m_size;
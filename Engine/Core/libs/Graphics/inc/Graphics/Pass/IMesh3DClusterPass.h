@@ -6,12 +6,15 @@
 #define SRENGINE_IMESH3DCLUSTERPASS_H
 
 #include <Graphics/Pass/IMeshClusterPass.h>
+#include <Graphics/Render/DrawList.h>
+#include <Graphics/Pipeline/CommandList.h>
 
 namespace SR_GRAPH_NS {
     class IMesh3DClusterPass : public IMeshClusterPass {
         using Super = IMeshClusterPass;
     public:
         bool Init() override;
+        void DeInit() override;
 
     protected:
         bool Render() override;
@@ -19,7 +22,18 @@ namespace SR_GRAPH_NS {
 
         void OnClusterDirty() override;
 
-        virtual bool RenderCluster(MeshCluster& meshCluster);
+        SR_NODISCARD bool IsRecordOutdated() const override { return m_isTransparentOrderOutdated; }
+
+        /// Собирает активные меши всех кластеров прохода в m_drawList и сортирует по ключам
+        virtual void BuildDrawList();
+        virtual void CollectCluster(MeshCluster& meshCluster, uint64_t drawPass, bool transparent);
+        virtual bool RenderDrawList();
+
+        /// Отсечение мешей при сборке списка отрисовки
+        SR_NODISCARD virtual bool IsMeshVisible(MeshPtr pMesh) { return true; }
+        /// Зависит ли результат от порядка прозрачных мешей (смешивание), проходы глубины и выбора - нет
+        SR_NODISCARD virtual bool IsBlendOrderDependent() const { return true; }
+
         virtual void UpdateCluster(MeshCluster& meshCluster);
         virtual void MarkDirtyCluster(MeshCluster& meshCluster);
 
@@ -27,6 +41,12 @@ namespace SR_GRAPH_NS {
         ShadowMapPass* m_shadowMapPass = nullptr;
         CascadedShadowMapPass* m_cascadedShadowMapPass = nullptr;
 
+        DrawList m_drawList;
+        DrawCapture m_drawCapture;
+        /// порядок прозрачных мешей на момент записи команд
+        uint64_t m_transparentOrderHash = 0;
+        bool m_isTransparentOrderOutdated = false;
+
     };
 }
 
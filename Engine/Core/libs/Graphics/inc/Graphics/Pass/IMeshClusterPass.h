@@ -39,6 +39,8 @@ namespace SR_GRAPH_NS {
         void OnResize(const SR_MATH_NS::UVector2& size) override;
         void OnSamplesChanged() override;
 
+        void DeclareResources(RenderGraphPassBuilder& builder) const override;
+
     protected:
         SR_NODISCARD virtual MeshClusterTypeFlag GetClusterType() const noexcept;
         SR_NODISCARD virtual ShaderPtr GetShader(SR_SRSL_NS::ShaderType shaderType) const { return nullptr; }
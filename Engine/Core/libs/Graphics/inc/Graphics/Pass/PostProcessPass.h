@@ -42,6 +42,8 @@ namespace SR_GRAPH_NS {
         void OnResize(const SR_MATH_NS::UVector2& size) override;
         void OnSamplesChanged() override;
 
+        void DeclareResources(RenderGraphPassBuilder& builder) const override;
+
         bool PreRender() override;
         bool Render() override;
         void Update() override;
@@ -26,6 +26,7 @@ namespace SR_GRAPH_NS {
         void UseUniforms(ShaderPtr pShader, MeshPtr pMesh) override;
 
         SR_NODISCARD MeshClusterTypeFlag GetClusterType() const noexcept override;
+        SR_NODISCARD bool IsBlendOrderDependent() const override { return false; }
 
     private:
         SR_MATH_NS::Matrix4x4 m_lightSpaceMatrix;
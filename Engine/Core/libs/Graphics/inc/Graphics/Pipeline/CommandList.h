@@ -0,0 +1,243 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SRENGINE_COMMANDLIST_H
+#define SRENGINE_COMMANDLIST_H
+
+#include <Utils/Debug.h>
+#include <Utils/Common/NonCopyable.h>
+#include <Utils/Common/Enumerations.h>
+#include <Utils/Types/Function.h>
+
+namespace SR_GRAPH_NS {
+    SR_ENUM_NS_CLASS_T(RecordedCommandType, uint8_t,
+        UseShader,
+        UnUseShader,
+        BindVBO,
+        BindIBO,
+        BindUBO,
+        BindDescriptorSet,
+        BindTexture,
+        PushConstants,
+        SetViewport,
+        SetScissor,
+        SetFrameBufferLayer,
+        Draw,
+        DrawIndices
+    );
+
+    struct RecordedCommand {
+        RecordedCommandType type = RecordedCommandType::Draw;
+        uint32_t first = 0;
+        uint32_t second = 0;
+
+        SR_NODISCARD bool operator==(const RecordedCommand& other) const noexcept {
+            return type == other.type && first == other.first && second == other.second;
+        }
+    };
+
+    /**
+     * Контекст записи команд одного потока. Повторяет часть API Pipeline, которая пишет в буфер команд,
+     * и сохраняет поток команд вместо обращения к графическому API. Данные PushConstants копируются внутрь.
+     * Записанное исполняется на потоке отрисовки через Pipeline::ExecuteCommandList или проигрывается
+     * в любой объект с тем же API (в том числе в другой CommandList, что удобно для проверки порядка).
+     */
+    class SR_DLL_EXPORT CommandList {
+    public:
+        void Clear();
+
+        void UseShader(uint32_t shaderProgram) { Push(RecordedCommandType::UseShader, shaderProgram); }
+        void UnUseShader() { Push(RecordedCommandType::UnUseShader); }
+        void BindVBO(uint32_t VBO) { Push(RecordedCommandType::BindVBO, VBO); }
+        void BindIBO(uint32_t IBO) { Push(RecordedCommandType::BindIBO, IBO); }
+        void BindUBO(uint32_t UBO) { Push(RecordedCommandType::BindUBO, UBO); }
+        void BindDescriptorSet(uint32_t descriptorSet) { Push(RecordedCommandType::BindDescriptorSet, descriptorSet); }
+        void BindTexture(uint8_t activeTexture, uint32_t textureId) { Push(RecordedCommandType::BindTexture, activeTexture, textureId); }
+        void PushConstants(void* pData, uint64_t size);
+        void SetViewport(int32_t width = -1, int32_t height = -1);
+        void SetScissor(int32_t width = -1, int32_t height = -1);
+        void SetFrameBufferLayer(uint32_t layer) { Push(RecordedCommandType::SetFrameBufferLayer, layer); }
+        void Draw(uint32_t count) { ++m_drawCalls; Push(RecordedCommandType::Draw, count); }
+        void DrawIndices(uint32_t count) { ++m_drawCalls; Push(RecordedCommandType::DrawIndices, count); }
+
+        /// Дописывает команды другого списка в конец этого
+        void Append(const CommandList& other);
+        /// Дописывает одну команду другого списка вместе с ее данными
+        void Append(const CommandList& other, const RecordedCommand& command);
+
+        /// Проигрывает команды в target с API Pipeline
+        template<typename Target> void Replay(Target& target) const;
+
+        SR_NODISCARD const std::vector<RecordedCommand>& GetCommands() const noexcept { return m_commands; }
+        SR_NODISCARD uint32_t GetDrawCalls() const noexcept { return m_drawCalls; }
+        SR_NODISCARD bool Empty() const noexcept { return m_commands.empty(); }
+
+        SR_NODISCARD bool operator==(const CommandList& other) const noexcept {
+            return m_commands == other.m_commands && m_data == other.m_data;
+        }
+
+    private:
+        void Push(RecordedCommandType type, uint32_t first = 0, uint32_t second = 0) {
+            m_commands.emplace_back(RecordedCommand { type, first, second });
+        }
+
+    private:
+        std::vector<RecordedCommand> m_commands;
+        std::vector<char> m_data;
+        uint32_t m_drawCalls = 0;
+
+    };
+
+    template<typename Target> void CommandList::Replay(Target& target) const {
+        for (auto&& command : m_commands) {
+            switch (command.type) {
+                case RecordedCommandType::UseShader: target.UseShader(command.first); break;
+                case RecordedCommandType::UnUseShader: target.UnUseShader(); break;
+                case RecordedCommandType::BindVBO: target.BindVBO(command.first); break;
+                case RecordedCommandType::BindIBO: target.BindIBO(command.first); break;
+                case RecordedCommandType::BindUBO: target.BindUBO(command.first); break;
+                case RecordedCommandType::BindDescriptorSet: target.BindDescriptorSet(command.first); break;
+                case RecordedCommandType::BindTexture: target.BindTexture(static_cast<uint8_t>(command.first), command.second); break;
+                case RecordedCommandType::PushConstants:
+                    target.PushConstants(const_cast<char*>(m_data.data()) + command.first, command.second);
+                    break;
+                case RecordedCommandType::SetViewport:
+                    target.SetViewport(static_cast<int32_t>(command.first), static_cast<int32_t>(command.second));
+                    break;
+                case RecordedCommandType::SetScissor:
+                    target.SetScissor(static_cast<int32_t>(command.first), static_cast<int32_t>(command.second));
+                    break;
+                case RecordedCommandType::SetFrameBufferLayer: target.SetFrameBufferLayer(command.first); break;
+                case RecordedCommandType::Draw: target.Draw(command.first); break;
+                case RecordedCommandType::DrawIndices: target.DrawIndices(command.first); break;
+                default:
+                    SRHaltOnce0();
+                    break;
+            }
+        }
+    }
+
+    /**
+     * Параллельная запись команд. Задания получают собственные CommandList и выполняются на рабочих потоках
+     * (и на вызывающем), а результат сливается строго в порядке добавления заданий, поэтому поток команд
+     * не зависит от того, какой поток и когда выполнил задание.
+     * Задание не должно трогать общее состояние отрисовки (Pipeline, UBOManager, текущий шейдер) -
+     * только писать в свой список. Независимые проходы - это проходы одной глубины графа техники,
+     * большие кластеры делятся на диапазоны через Split.
+     */
+    class SR_DLL_EXPORT ParallelCommandRecorder : public SR_UTILS_NS::NonCopyable {
+    public:
+        using RecordFn = SR_HTYPES_NS::Function<void(CommandList&)>;
+
+        struct Range {
+            uint32_t offset = 0;
+            uint32_t count = 0;
+        };
+
+    public:
+        /// workers - число рабочих потоков помимо вызывающего, 0 - запись только на вызывающем потоке
+        explicit ParallelCommandRecorder(uint32_t workers);
+        ~ParallelCommandRecorder() override;
+
+    public:
+        void Begin();
+        /// Возвращает индекс задания, он же место его команд при слиянии
+        uint32_t AddJob(RecordFn function);
+        /// Выполняет все задания и ждет их завершения
+        void Record();
+
+        /// Проигрывает списки всех заданий в порядке добавления
+        template<typename Target> void Merge(Target& target) const;
+
+        SR_NODISCARD const CommandList& GetCommandList(uint32_t job) const { return m_lists[job]; }
+        SR_NODISCARD uint32_t GetJobsCount() const noexcept { return m_jobsCount; }
+        SR_NODISCARD uint32_t GetWorkersCount() const noexcept { return static_cast<uint32_t>(m_workers.size()); }
+
+        /// Делит count элементов на не более maxChunks непрерывных диапазонов размером не меньше minChunk
+        SR_NODISCARD static std::vector<Range> Split(uint32_t count, uint32_t minChunk, uint32_t maxChunks);
+
+    private:
+        void WorkerLoop();
+        void ExecuteJobs();
+
+    private:
+        std::vector<RecordFn> m_jobs;
+        std::vector<CommandList> m_lists;
+        uint32_t m_jobsCount = 0;
+
+        std::vector<std::thread> m_workers;
+        std::mutex m_mutex;
+        std::condition_variable m_startCondition;
+        std::condition_variable m_doneCondition;
+
+        /// номер записи, по которому рабочие потоки узнают о новой порции заданий
+        uint64_t m_generation = 0;
+        uint32_t m_activeWorkers = 0;
+        bool m_stop = false;
+
+        std::atomic<uint32_t> m_nextJob = 0;
+
+    };
+
+    template<typename Target> void ParallelCommandRecorder::Merge(Target& target) const {
+        for (uint32_t i = 0; i < m_jobsCount; ++i) {
+            m_lists[i].Replay(target);
+        }
+    }
+
+    /**
+     * Команды отрисовок, захваченные с конвейера на потоке отрисовки (Pipeline::SetCaptureCommandList).
+     * Захват делает все, что трогает общее состояние (вычисление мешей, UBOManager, дескрипторы), а для
+     * каждой отрисовки запоминается привязанное на ее начало состояние. Поэтому любой диапазон отрисовок
+     * можно переписать в отдельный список независимо от остальных - этим заняты задания ParallelCommandRecorder.
+     */
+    class SR_DLL_EXPORT DrawCapture : public SR_UTILS_NS::NonCopyable {
+        static constexpr uint32_t InvalidId = static_cast<uint32_t>(SR_ID_INVALID);
+
+        struct BoundState {
+            uint32_t shaderProgram = InvalidId;
+            uint32_t VBO = InvalidId;
+            uint32_t IBO = InvalidId;
+            uint32_t UBO = InvalidId;
+            uint32_t descriptorSet = InvalidId;
+            /// индекс последней команды PushConstants текущего шейдера
+            uint32_t pushConstants = InvalidId;
+        };
+
+        struct DrawSegment {
+            uint32_t command = 0;
+            BoundState state;
+        };
+
+    public:
+        void Clear();
+
+        /// Отмечает начало следующей отрисовки, команды до следующей отметки принадлежат ей
+        void BeginDraw();
+
+        /// Переписывает отрисовки [offset, offset + count) в commandList. Сначала восстанавливается
+        /// состояние на начало диапазона, затем идут его команды без повторных привязок того же состояния
+        void Emit(uint32_t offset, uint32_t count, CommandList& commandList) const;
+
+        /// Добавляет по заданию на диапазон. Диапазоны зависят только от числа отрисовок, а не от числа потоков
+        void AddJobs(ParallelCommandRecorder& recorder, uint32_t minChunk, uint32_t maxChunks) const;
+
+        SR_NODISCARD CommandList& GetCommandList() noexcept { return m_commandList; }
+        SR_NODISCARD uint32_t GetDrawsCount() const noexcept { return static_cast<uint32_t>(m_draws.size()); }
+
+    private:
+        static void Track(BoundState& state, const RecordedCommand& command, uint32_t index);
+
+    private:
+        CommandList m_commandList;
+        std::vector<DrawSegment> m_draws;
+
+        /// состояние после уже размеченных команд
+        BoundState m_state;
+        uint32_t m_trackedCommands = 0;
+
+    };
+}
+
+#endif //SRENGINE_COMMANDLIST_H
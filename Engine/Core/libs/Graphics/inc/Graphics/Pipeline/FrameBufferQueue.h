@@ -21,6 +21,10 @@ namespace SR_GRAPH_NS {
         void AddQueue(FrameBuffer pFrameBuffer, uint32_t queueIndex);
 
         void Clear();
+        /// Очередь собрана. Проход, перезаписывающий свой буфер команд между сборками,
+        /// снова привязывает свои кадровые буферы, но в очереди они уже есть
+        void Close() { m_closed = true; }
+        SR_NODISCARD bool IsClosed() const noexcept { return m_closed; }
 
         SR_NODISCARD bool Contains(FrameBuffer pFrameBuffer);
         SR_NODISCARD bool Contains(FrameBuffer pFrameBuffer, uint32_t layer);
@@ -29,6 +33,7 @@ namespace SR_GRAPH_NS {
     private:
         std::map<FrameBuffer, std::set<Layer>> m_used;
         std::vector<std::vector<FrameBuffer>> m_levels;
+        bool m_closed = false;
 
     };
 }
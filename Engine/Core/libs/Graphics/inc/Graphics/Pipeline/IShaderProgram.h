@@ -45,6 +45,11 @@ namespace SR_GRAPH_NS {
     SR_INLINE_STATIC uint64_t SHADER_VIEW_MATRIX = SR_SHADER_MAKE_HASH_NAME("VIEW_MATRIX");
     SR_INLINE_STATIC uint64_t SHADER_SSAO_NOISE = SR_SHADER_MAKE_HASH_NAME("SSAO_NOISE");
     SR_INLINE_STATIC uint64_t SHADER_SSAO_SAMPLES = SR_SHADER_MAKE_HASH_NAME("SSAO_SAMPLES");
+    SR_INLINE_STATIC uint64_t SHADER_LIGHT_CLUSTER_PARAMS = SR_SHADER_MAKE_HASH_NAME("LIGHT_CLUSTER_PARAMS");
+    SR_INLINE_STATIC uint64_t SHADER_LIGHT_CLUSTER_SIZE = SR_SHADER_MAKE_HASH_NAME("LIGHT_CLUSTER_SIZE");
+    SR_INLINE_STATIC uint64_t SHADER_LIGHT_CLUSTER_RANGES = SR_SHADER_MAKE_HASH_NAME("LIGHT_CLUSTER_RANGES");
+    SR_INLINE_STATIC uint64_t SHADER_LIGHT_CLUSTER_INDICES = SR_SHADER_MAKE_HASH_NAME("LIGHT_CLUSTER_INDICES");
+    SR_INLINE_STATIC uint64_t SHADER_CLUSTER_LIGHTS = SR_SHADER_MAKE_HASH_NAME("CLUSTER_LIGHTS");
     SR_INLINE_STATIC uint64_t SHADER_LIGHT_SPACE_MATRIX = SR_SHADER_MAKE_HASH_NAME("LIGHT_SPACE_MATRIX");
     SR_INLINE_STATIC uint64_t SHADER_VIEW_NO_TRANSLATE_MATRIX = SR_SHADER_MAKE_HASH_NAME("VIEW_NO_TRANSLATE_MATRIX");
     SR_INLINE_STATIC uint64_t SHADER_PROJECTION_MATRIX = SR_SHADER_MAKE_HASH_NAME("PROJECTION_MATRIX");
@@ -18,10 +18,16 @@ namespace SR_GTYPES_NS {
     class Framebuffer;
 }
 
+namespace SR_GRAPH_NS::Memory {
+    class UniformArena;
+}
+
 namespace SR_GRAPH_NS {
     class RenderContext;
     class Overlay;
     class Window;
+    class CommandList;
+    class ParallelCommandRecorder;
 
     class Pipeline : public SR_HTYPES_NS::SharedPtr<Pipeline> {
     public:
@@ -76,8 +82,8 @@ namespace SR_GRAPH_NS {
         /// Обязательно нужно вызвать после успешного вызова BeginRender
         virtual void EndRender();
 
-        virtual void SetViewport(int32_t width = -1, int32_t height = -1) { ++m_state.operations; };
-        virtual void SetScissor(int32_t width = -1, int32_t height = -1) { ++m_state.operations; };
+        virtual void SetViewport(int32_t width = -1, int32_t height = -1);
+        virtual void SetScissor(int32_t width = -1, int32_t height = -1);
 
         /// ------------------------------------------ Работа с Overlay ------------------------------------------------
 
@@ -118,7 +124,7 @@ namespace SR_GRAPH_NS {
 
         virtual void SetCurrentShader(ShaderPtr pShader) { ++m_state.operations; m_state.pShader = pShader; }
         virtual void SetCurrentShaderId(int32_t id) { ++m_state.operations; m_state.shaderId = id; }
-        virtual void SetFrameBufferLayer(uint32_t layer) { ++m_state.operations; m_state.frameBufferLayer = layer; }
+        virtual void SetFrameBufferLayer(uint32_t layer);
         virtual void SetCurrentFrameBuffer(FramebufferPtr pFrameBuffer);
 
         virtual void* GetOverlayTextureDescriptorSet(uint32_t textureId, OverlayType overlayType);
@@ -173,6 +179,17 @@ namespace SR_GRAPH_NS {
         virtual bool FreeShader(int32_t* id) { return false; }
         virtual bool FreeTexture(int32_t* id) { return false; }
 
+        /// Кольцевой буфер юниформ, если API его поддерживает. Кадр кольца - один DrawFrame
+        SR_NODISCARD virtual Memory::UniformArena* GetUniformArena() const { return nullptr; }
+
+        /// UBO, выделенные между BeginUniformArenaRecord и EndUniformArenaRecord, живут в кольце юниформ без
+        /// собственных буферов. Место под них выделяется при записи команд и держится до следующей записи владельца
+        virtual void BeginUniformArenaRecord(const void* pOwner) { }
+        virtual void EndUniformArenaRecord() { }
+        virtual void ReleaseUniformArenaRecord(const void* pOwner) { }
+        /// запись уже открыта снаружи, например проходом на несколько слоев кадрового буфера
+        SR_NODISCARD virtual bool IsUniformArenaRecording() const { return false; }
+
         /// ------------------------------------------ Вызовы отрисовки ------------------------------------------------
 
         /// Отрисовка вершин по индексам
@@ -215,6 +232,22 @@ namespace SR_GRAPH_NS {
 
         virtual void ResetDescriptorSet();
 
+        /// Исполняет команды, записанные в CommandList на другом потоке. По умолчанию проигрывает их
+        /// через методы конвейера, API со вторичными буферами команд может исполнять их напрямую
+        virtual void ExecuteCommandList(const CommandList& commandList);
+        /// Исполняет списки всех заданий recorder'а в порядке добавления
+        virtual void ExecuteCommandLists(const ParallelCommandRecorder& recorder);
+
+        /// Порция записи проходов одной глубины графа. API со вторичными буферами команд откладывает
+        /// их запись до EndCommandBatch и пишет буферы всех проходов порции на рабочих потоках разом
+        virtual void BeginCommandBatch() { }
+        virtual void EndCommandBatch() { }
+
+        /// Пока задан список захвата, команды отрисовки только меняют состояние конвейера и пишутся в список.
+        /// В буфер команд они попадут через ExecuteCommandList
+        void SetCaptureCommandList(CommandList* pCommandList) noexcept { m_captureList = pCommandList; }
+        SR_NODISCARD bool IsCapturing() const noexcept { return m_captureList; }
+
     protected:
         std::map<OverlayType, SR_HTYPES_NS::SharedPtr<Overlay>> m_overlays;
 
@@ -233,6 +266,8 @@ namespace SR_GRAPH_NS {
         WindowPtr m_window;
         RenderContextPtr m_renderContext;
 
+        CommandList* m_captureList = nullptr;
+
         PipelineState m_state;
         PipelineState m_previousState;
         /// Состояние, которое было на момент постоения сцены рендера
@@ -84,7 +84,8 @@ namespace SR_GRAPH_NS::VulkanTools {
 
             switch (uniform.type) {
                 case LayoutBinding::Sampler2D: type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER; break;
-                case LayoutBinding::Uniform: type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER; break;
+                /// UBO может лежать в кольце юниформ, его место передается динамическим смещением
+                case LayoutBinding::Uniform: type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC; break;
                 case LayoutBinding::Attachhment: type = VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT; break;
                 default:
                     SRHalt("VulknaTools::UniformsToDescriptorLayoutBindings() : unknown binding type!");
@@ -231,7 +232,7 @@ namespace SR_GRAPH_NS::VulkanTools {
     SR_MAYBE_UNUSED static SR_FORCE_INLINE VkDescriptorType CastAbsDescriptorTypeToVk(const DescriptorType& descriptorType) {
         switch (descriptorType) {
             case DescriptorType::Uniform:
-                return VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+                return VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
             case DescriptorType::CombinedImage:
                 return VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
             default: {
@@ -247,7 +248,7 @@ namespace SR_GRAPH_NS::VulkanTools {
         for (auto&& descriptorType : descriptorTypes) {
             switch (descriptorType) {
                 case DescriptorType::Uniform:
-                    vkDescriptorTypes.emplace_back(VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER);
+                    vkDescriptorTypes.emplace_back(VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC);
                     break;
                 case DescriptorType::CombinedImage:
                     vkDescriptorTypes.emplace_back(VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER);
@@ -265,7 +266,7 @@ namespace SR_GRAPH_NS::VulkanTools {
     SR_MAYBE_UNUSED static SR_FORCE_INLINE std::vector<uint64_t> CastAbsDescriptorTypeToVk(std::vector<uint64_t> descriptorTypes) {
         for (uint64_t& type : descriptorTypes) {
             if (type == static_cast<uint64_t>(DescriptorType::Uniform)) {
-                type = static_cast<uint64_t>(VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER);
+                type = static_cast<uint64_t>(VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC);
             }
             else if (type == static_cast<uint64_t>(DescriptorType::CombinedImage)) {
                 type = static_cast<uint64_t>(VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER);
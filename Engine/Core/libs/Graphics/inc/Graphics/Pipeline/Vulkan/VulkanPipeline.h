@@ -6,9 +6,11 @@
 #define SR_ENGINE_GRAPHICS_VULKAN_PIPELINE_H
 
 #include <Graphics/Pipeline/Pipeline.h>
+#include <Graphics/Memory/UniformArena.h>
 
 namespace SR_GRAPH_NS::VulkanTools {
     class MemoryManager;
+    class VulkanUniformArenaStorage;
 }
 
 namespace EvoVulkan::Core {
@@ -23,6 +25,28 @@ namespace EvoVulkan::Complexes {
 namespace SR_GRAPH_NS {
     class VulkanPipeline : public Pipeline {
         using Super = Pipeline;
+
+        enum class VulkanCommandType : uint8_t {
+            BindShader, BindVertexBuffer, BindIndexBuffer, BindDescriptorSet, PushConstants,
+            SetViewport, SetScissor, Draw, DrawIndexed
+        };
+
+        /// Команда с уже найденными объектами Vulkan: менеджер памяти и кольцо юниформ к ней больше не нужны
+        struct VulkanCommand {
+            VulkanCommandType type = VulkanCommandType::Draw;
+            /// число вершин или индексов, число динамических смещений или размер констант
+            uint32_t count = 0;
+            /// динамическое смещение UBO или смещение данных констант
+            uint32_t offset = 0;
+            EvoVulkan::Complexes::Shader* pShader = nullptr;
+            VkPipelineLayout layout = VK_NULL_HANDLE;
+            VkDescriptorSet descriptorSet = VK_NULL_HANDLE;
+            VkBuffer buffer = VK_NULL_HANDLE;
+            VkShaderStageFlags stages = 0;
+            VkViewport viewport = { };
+            VkRect2D scissor = { };
+        };
+
     public:
         explicit VulkanPipeline(const RenderContextPtr& pContext)
             : Super(pContext)
@@ -55,6 +79,12 @@ namespace SR_GRAPH_NS {
         SR_NODISCARD EvoVulkan::Core::VulkanKernel* GetKernel() const noexcept { return m_kernel; }
         SR_NODISCARD VulkanTools::MemoryManager* GetMemoryManager() const noexcept { return m_memory; }
         SR_NODISCARD uint64_t GetUsedMemory() const override;
+        SR_NODISCARD Memory::UniformArena* GetUniformArena() const override { return m_uniformArena.get(); }
+
+        void BeginUniformArenaRecord(const void* pOwner) override;
+        void EndUniformArenaRecord() override;
+        void ReleaseUniformArenaRecord(const void* pOwner) override;
+        SR_NODISCARD bool IsUniformArenaRecording() const override { return m_arenaRecord; }
         SR_NODISCARD bool IsShaderConstantSupport() const noexcept override { ++m_state.operations; return true; }
 
         SR_NODISCARD int32_t AllocateUBO(uint32_t uboSize) override;
@@ -124,11 +154,111 @@ namespace SR_GRAPH_NS {
 
         void ResetDescriptorSet() override;
 
+        void ExecuteCommandLists(const ParallelCommandRecorder& recorder) override;
+        void BeginCommandBatch() override;
+        void EndCommandBatch() override;
+
     private:
         bool InitEvoVulkanHooks();
+        bool InitUniformArena();
+        void DeInitUniformArena();
+
+        /// Кадр кольца юниформ открывается в PrepareFrame после fence его слота и закрывается в DrawFrame
+        void BeginUniformArenaFrame();
+        void EndUniformArenaFrame();
+
+        /// После переполнения кольцо увеличивается, а сцена перезаписывает команды заново
+        void GrowUniformArena();
+        void WriteArenaDescriptor(uint32_t arenaUBO);
+
+        /// Данные, которые пишутся по уже записанным в команды смещениям, читает предыдущий кадр
+        void WaitUniformArenaWrite();
+
+        SR_NODISCARD bool IsArenaUBO(int32_t UBO) const noexcept { return UBO >= m_arenaUBOBase; }
+        SR_NODISCARD bool IsArenaUBOPlaced(uint32_t arenaUBO) const;
+
+        /// Привязывает текущий набор дескрипторов с динамическим смещением его UBO.
+        /// false - места в кольце нет и отрисовку нужно пропустить
+        SR_NODISCARD bool BindDrawDescriptorSet();
+
+        /// Пишет команду в cmd. Обращается только к объектам Vulkan, поэтому вызывается на любом потоке
+        static void ExecuteCommand(VkCommandBuffer cmd, const VulkanCommand& command, const char* pData);
+        /// Начинает вторичный буфер внутри render pass'а. Динамическое состояние не наследуется, поэтому задается заново
+        static void BeginSecondaryCmd(VkCommandBuffer cmd, VkRenderPass renderPass, VkFramebuffer framebuffer,
+            const VkViewport& viewport, const VkRect2D& scissor);
+
+        /// Пишет команду в текущий вторичный буфер или, пока списки разрешаются, в очередь задания
+        void RecordCommand(const VulkanCommand& command, const void* pData = nullptr);
+
+        /// Вторичный буфер текущего первичного: берется из свободных или создается со своим пулом
+        SR_NODISCARD VkCommandBuffer AcquireSecondaryCmd();
+        void BeginInlineSecondaryCmd();
+        void EndInlineSecondaryCmd();
+        void ResetSecondaryCmds(VkCommandBuffer primaryCmd);
+        void DestroySecondaryCmds();
+
+        /// Пишет отложенные вторичные буферы на рабочих потоках и заканчивает первичные буферы порции
+        void FlushCommandBatch();
+
+    private:
+        /// UBO без собственного буфера: данные лежат в кольце юниформ по offset, пока жива запись recordId.
+        /// data хранит последние данные, чтобы перенести их в новое место при перезаписи команд
+        struct ArenaUBO {
+            std::vector<char> data;
+            uint64_t offset = SR_UINT64_MAX;
+            const void* pRecord = nullptr;
+            uint64_t recordId = 0;
+            int32_t descriptorSet = SR_ID_INVALID;
+            uint32_t binding = 0;
+            bool used = false;
+        };
+
+        struct ArenaFence {
+            VkFence fence = VK_NULL_HANDLE;
+            bool submitted = false;
+        };
+
+        /// Вторичный буфер с собственным пулом: пул нельзя делить между потоками без блокировки
+        struct SecondaryCmd {
+            VkCommandPool pool = VK_NULL_HANDLE;
+            VkCommandBuffer cmd = VK_NULL_HANDLE;
+        };
+
+        /// Вторичные буферы первичного буфера. Освобождаются, когда первичный начинают записывать заново
+        struct SecondaryCmdSet {
+            std::vector<SecondaryCmd> cmds;
+            uint32_t used = 0;
+        };
+
+        /// Render pass первичного буфера, исполняющий вторичные буферы [firstSecondary, firstSecondary + secondaryCount)
+        struct DeferredRenderPass {
+            VkRenderPassBeginInfo beginInfo = { };
+            std::vector<VkClearValue> clearValues;
+            uint32_t firstSecondary = 0;
+            uint32_t secondaryCount = 0;
+        };
+
+        /// Все render pass'ы команды исполняют вторичные буферы, поэтому первичный буфер дописывается целиком
+        /// после записи вторичных: его начало, render pass'ы и конец
+        struct DeferredPrimaryCmd {
+            VkCommandBuffer cmd = VK_NULL_HANDLE;
+            std::vector<DeferredRenderPass> renderPasses;
+            std::vector<VkCommandBuffer> secondaries;
+            bool ended = false;
+        };
+
+        /// Вторичный буфер, который пишет задание ParallelCommandRecorder из команд [firstCommand, firstCommand + commandsCount)
+        struct SecondaryCmdJob {
+            VkCommandBuffer cmd = VK_NULL_HANDLE;
+            VkRenderPass renderPass = VK_NULL_HANDLE;
+            VkFramebuffer framebuffer = VK_NULL_HANDLE;
+            VkViewport viewport = { };
+            VkRect2D scissor = { };
+            uint32_t firstCommand = 0;
+            uint32_t commandsCount = 0;
+        };
 
     private:
-        VkDeviceSize m_offsets[1] = { 0 };
         VkViewport m_viewport = { };
         VkRect2D m_scissor = { };
         VkRenderPassBeginInfo m_renderPassBI = { };
@@ -146,6 +276,34 @@ namespace SR_GRAPH_NS {
 
         VulkanTools::MemoryManager* m_memory = nullptr;
 
+        std::unique_ptr<Memory::UniformArena> m_uniformArena;
+        VulkanTools::VulkanUniformArenaStorage* m_uniformArenaStorage = nullptr;
+
+        /// идентификаторы UBO кольца начинаются после идентификаторов буферов менеджера памяти
+        int32_t m_arenaUBOBase = SR_INT32_MAX;
+        std::vector<ArenaUBO> m_arenaUBOs;
+        std::vector<uint32_t> m_freeArenaUBOs;
+        std::vector<ArenaFence> m_arenaFences;
+        const void* m_arenaRecord = nullptr;
+        bool m_arenaOverflow = false;
+        bool m_arenaWriteSynced = false;
+
+        /// UBO, записанный в набор дескрипторов, и число динамических юниформ в раскладке шейдера
+        std::vector<int32_t> m_descriptorSetUBOs;
+        std::vector<uint32_t> m_shaderDynamicUniforms;
+
+        /// первичный буфер открытого render pass'а, m_currentCmd внутри него указывает на вторичный
+        VkCommandBuffer m_primaryCmd = VK_NULL_HANDLE;
+        std::unordered_map<VkCommandBuffer, SecondaryCmdSet> m_secondaryCmds;
+        std::vector<DeferredPrimaryCmd> m_deferredPrimaryCmds;
+        std::vector<SecondaryCmdJob> m_secondaryCmdJobs;
+        /// разрешенные команды заданий и данные их констант, задания только читают их
+        std::vector<VulkanCommand> m_jobCommands;
+        std::vector<char> m_jobCommandsData;
+        /// пока ExecuteCommandLists разрешает списки, команды пишутся в m_jobCommands
+        bool m_resolveCommands = false;
+        bool m_commandBatch = false;
+
     };
 }
 
@@ -0,0 +1,41 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SR_ENGINE_GRAPHICS_VULKAN_UNIFORM_ARENA_H
+#define SR_ENGINE_GRAPHICS_VULKAN_UNIFORM_ARENA_H
+
+#include <Graphics/Memory/UniformArena.h>
+
+#include <EvoVulkan/VulkanKernel.h>
+#include <EvoVulkan/Types/VmaBuffer.h>
+
+namespace SR_GRAPH_NS::VulkanTools {
+    /// Хранилище кольца юниформ: один буфер, отображенный в память процесса на все время жизни.
+    /// Запись - обычный memcpy, без отображения буфера на каждое обновление
+    class VulkanUniformArenaStorage final : public Memory::IUniformArenaStorage {
+    public:
+        explicit VulkanUniformArenaStorage(EvoVulkan::Core::VulkanKernel* pKernel)
+            : m_kernel(pKernel)
+        { }
+
+        ~VulkanUniformArenaStorage() override;
+
+    public:
+        bool Init(uint64_t capacity) override;
+        void DeInit() override;
+        void Write(uint64_t offset, const void* pData, uint64_t size) override;
+
+        /// Дескриптор участка кольца для записи в набор дескрипторов
+        SR_NODISCARD VkDescriptorBufferInfo GetDescriptor(uint64_t offset, uint64_t size) const;
+
+    private:
+        EvoVulkan::Core::VulkanKernel* m_kernel = nullptr;
+        EvoVulkan::Types::VmaBuffer* m_buffer = nullptr;
+        char* m_mapped = nullptr;
+        uint64_t m_capacity = 0;
+
+    };
+}
+
+#endif //SR_ENGINE_GRAPHICS_VULKAN_UNIFORM_ARENA_H
@@ -0,0 +1,108 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SRENGINE_DRAWLIST_H
+#define SRENGINE_DRAWLIST_H
+
+#include <Utils/Debug.h>
+#include <Utils/Common/NonCopyable.h>
+#include <Utils/Common/Hashes.h>
+#include <Utils/Types/Map.h>
+
+namespace SR_GTYPES_NS {
+    class Mesh;
+    class Shader;
+    class Material;
+}
+
+namespace SR_GRAPH_NS {
+    /**
+     * 64-битный ключ сортировки отрисовки, старшие биты - наиболее значимые:
+     *  непрозрачные: | layer 4 | pass 4 | shader 14 | material 14 | depth 28 |  - по состоянию, затем спереди назад
+     *  прозрачные:   | layer 4 | pass 4 | depth 28  | shader 14 | material 14 |  - сзади наперед, затем по состоянию
+     */
+    struct SR_DLL_EXPORT DrawSortKey {
+        static constexpr uint64_t LayerBits = 4;
+        static constexpr uint64_t PassBits = 4;
+        static constexpr uint64_t ShaderBits = 14;
+        static constexpr uint64_t MaterialBits = 14;
+        static constexpr uint64_t DepthBits = 28;
+
+        static constexpr uint64_t MaxLayer = (1ull << LayerBits) - 1;
+        static constexpr uint64_t MaxPass = (1ull << PassBits) - 1;
+        static constexpr uint64_t MaxShader = (1ull << ShaderBits) - 1;
+        static constexpr uint64_t MaxMaterial = (1ull << MaterialBits) - 1;
+        static constexpr uint64_t MaxDepth = (1ull << DepthBits) - 1;
+
+        /// порядок групп кластеров внутри одного прохода
+        static constexpr uint64_t PassOpaque = 0;
+        static constexpr uint64_t PassTransparent = 1;
+        static constexpr uint64_t PassDebug = 2;
+
+        static_assert(LayerBits + PassBits + ShaderBits + MaterialBits + DepthBits == 64);
+
+        SR_NODISCARD static uint64_t Opaque(uint64_t layer, uint64_t pass, uint64_t shader, uint64_t material, uint64_t depth) noexcept;
+        SR_NODISCARD static uint64_t Transparent(uint64_t layer, uint64_t pass, uint64_t shader, uint64_t material, uint64_t depth) noexcept;
+
+        /// Линейная глубина в [near, far] -> [0, MaxDepth], значения вне диапазона прижимаются к краям
+        SR_NODISCARD static uint64_t QuantizeDepth(float_t depth, float_t near, float_t far) noexcept;
+
+        SR_NODISCARD static uint64_t GetLayer(uint64_t key) noexcept { return key >> (64 - LayerBits); }
+        SR_NODISCARD static uint64_t GetPass(uint64_t key) noexcept { return (key >> (64 - LayerBits - PassBits)) & MaxPass; }
+    };
+
+    /// Элемент сортировки: ключ и индекс отрисовки в DrawList
+    struct DrawSortItem {
+        uint64_t key = 0;
+        uint32_t index = 0;
+    };
+
+    /// LSD поразрядная сортировка по 8 бит, устойчивая. Разряды, одинаковые у всех ключей, пропускаются.
+    /// temp - буфер того же размера, переиспользуется между кадрами
+    SR_DLL_EXPORT void RadixSortDrawItems(std::vector<DrawSortItem>& items, std::vector<DrawSortItem>& temp);
+
+    /// Список отрисовок прохода на кадр. Индексы шейдеров и материалов в ключе - плотные,
+    /// выдаются в порядке первого появления, поэтому ключ не зависит от адресов объектов.
+    class SR_DLL_EXPORT DrawList : public SR_UTILS_NS::NonCopyable {
+    public:
+        using MeshPtr = SR_GTYPES_NS::Mesh*;
+        using ShaderPtr = SR_GTYPES_NS::Shader*;
+        using MaterialPtr = SR_GTYPES_NS::Material*;
+
+        struct Draw {
+            ShaderPtr pShader = nullptr;
+            MeshPtr pMesh = nullptr;
+            int32_t VBO = SR_ID_INVALID;
+        };
+
+    public:
+        void Clear();
+
+        SR_NODISCARD uint64_t GetShaderIndex(ShaderPtr pShader);
+        SR_NODISCARD uint64_t GetMaterialIndex(MaterialPtr pMaterial);
+
+        void Add(uint64_t key, const Draw& draw);
+        void Sort();
+
+        /// Хеш последовательности мешей с указанным pass в ключе, чтобы заметить смену порядка
+        SR_NODISCARD uint64_t GetOrderHash(uint64_t pass) const;
+
+        SR_NODISCARD uint32_t Size() const noexcept { return static_cast<uint32_t>(m_items.size()); }
+        SR_NODISCARD bool Empty() const noexcept { return m_items.empty(); }
+
+        SR_NODISCARD const std::vector<DrawSortItem>& GetItems() const noexcept { return m_items; }
+        SR_NODISCARD const Draw& GetDraw(const DrawSortItem& item) const { return m_draws[item.index]; }
+
+    private:
+        std::vector<Draw> m_draws;
+        std::vector<DrawSortItem> m_items;
+        std::vector<DrawSortItem> m_temp;
+
+        ska::flat_hash_map<ShaderPtr, uint64_t> m_shaders;
+        ska::flat_hash_map<MaterialPtr, uint64_t> m_materials;
+
+    };
+}
+
+#endif //SRENGINE_DRAWLIST_H
@@ -14,6 +14,7 @@
 
 #include <Graphics/Pass/GroupPass.h>
 #include <Graphics/Pass/PassQueue.h>
+#include <Graphics/Render/RenderGraph.h>
 
 namespace SR_GTYPES_NS {
     class Camera;
@@ -43,6 +44,7 @@ namespace SR_GRAPH_NS {
 
         virtual void OnResize(const SR_MATH_NS::UVector2& size);
         virtual void OnSamplesChanged();
+        virtual void OnMeshRemoved(SR_GTYPES_NS::Mesh* pMesh, bool transparent);
 
         void FreeVideoMemory() override;
 
@@ -59,16 +61,24 @@ namespace SR_GRAPH_NS {
 
         SR_GTYPES_NS::Mesh* PickMeshAt(float_t x, float_t y, const std::vector<SR_UTILS_NS::StringAtom>& passFilter) const;
         SR_NODISCARD const PassQueues& GetQueues() const { return m_queues; }
+        SR_NODISCARD const RenderGraph& GetRenderGraph() const { return m_renderGraph; }
 
         bool ForEachPass(const SR_HTYPES_NS::Function<bool(BasePass*)>& callback) const;
 
         template<typename T> SR_NODISCARD T* FindPass() const;
 
+        /// Объявляет проходы в графе в порядке списка, идентификатор прохода совпадает с индексом.
+        /// Не требует ни контекста, ни конвейера
+        static void DeclareRenderGraph(RenderGraph& graph, const std::vector<BasePass*>& passes);
+
     protected:
         virtual bool Build() { return true; }
         void SetDirty();
         void DeInitPasses();
 
+        /// Собирает граф из объявлений проходов, выставляет порядок выполнения и очереди
+        void CompileRenderGraph();
+
     protected:
         RenderScenePtr m_renderScene;
         CameraPtr m_camera = nullptr;
@@ -81,6 +91,12 @@ namespace SR_GRAPH_NS {
         std::vector<BasePass*> m_passes;
         PassQueues m_queues;
 
+        /// неотсеченные проходы в порядке графа, сгруппированные по глубине
+        std::vector<BasePass*> m_executionOrder;
+        /// глубина графа каждого прохода m_executionOrder, проходы одной глубины записываются одной порцией
+        std::vector<uint32_t> m_executionDepths;
+        RenderGraph m_renderGraph;
+
     };
 
     template<typename T> T* IRenderTechnique::FindPass() const {
@@ -110,11 +110,15 @@ namespace SR_GRAPH_NS {
 
         bool Update();
 
+        /// Вызывается перед освобождением уничтоженного меша, пока указатель еще действителен
+        void SetMeshRemovedCallback(ClusterCallback callback) { m_onMeshRemoved = std::move(callback); }
+
     protected:
         virtual bool SR_FASTCALL ChangeCluster(MeshPtr pMesh) { return false; }
 
     protected:
         ska::flat_hash_map<SR_GTYPES_NS::Shader*, ShadedMeshSubCluster> m_subClusters;
+        ClusterCallback m_onMeshRemoved;
 
     };
 
@@ -27,6 +27,7 @@ namespace SR_GRAPH_NS {
     class RenderScene;
     class IRenderTechnique;
     class Pipeline;
+    class ParallelCommandRecorder;
 
     SR_ENUM_NS_CLASS_T(RCUpdateQueueState, uint8_t,
        Begin = 0,
@@ -107,6 +108,8 @@ namespace SR_GRAPH_NS {
         SR_NODISCARD const std::vector<SR_GTYPES_NS::Material*>& GetMaterials() const noexcept;
         SR_NODISCARD const std::vector<SR_GTYPES_NS::Skybox*>& GetSkyboxes() const noexcept;
         SR_NODISCARD const RenderScenes& GetScenes() const noexcept { return m_scenes; }
+        /// Общий для всех проходов контекста, используется только на потоке отрисовки
+        SR_NODISCARD ParallelCommandRecorder& GetCommandRecorder() const noexcept { return *m_commandRecorder; }
 
         void SetCurrentShader(ShaderPtr pShader);
 
@@ -152,6 +155,8 @@ namespace SR_GRAPH_NS {
 
         PipelinePtr m_pipeline = nullptr;
 
+        ParallelCommandRecorder* m_commandRecorder = nullptr;
+
     };
 
     /// ------------------------------------------------------------------------------
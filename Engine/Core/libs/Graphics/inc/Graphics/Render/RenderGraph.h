@@ -0,0 +1,183 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SRENGINE_RENDERGRAPH_H
+#define SRENGINE_RENDERGRAPH_H
+
+#include <Utils/Debug.h>
+#include <Utils/Common/NonCopyable.h>
+#include <Utils/Common/Enumerations.h>
+#include <Utils/Types/StringAtom.h>
+#include <Utils/Types/Map.h>
+
+namespace SR_GRAPH_NS {
+    SR_ENUM_NS_CLASS_T(RenderGraphResourceState, uint8_t,
+        Undefined,
+        RenderTarget,
+        ShaderRead
+    );
+
+    /// Описание ресурса графа. Два временных ресурса могут делить память, только если описания совпадают
+    struct RenderGraphResourceDesc {
+        /// 0 - размер окна
+        uint32_t width = 0;
+        uint32_t height = 0;
+        uint32_t layers = 1;
+        uint8_t samples = 1;
+
+        /// хеш форматов всех вложений
+        uint64_t format = 0;
+
+        /// временный ресурс живет только внутри кадра и может быть совмещен с другими,
+        /// постоянный (импортированный) виден снаружи графа и никогда не отсекается
+        bool transient = false;
+
+        /// состояние постоянного ресурса на входе в граф
+        RenderGraphResourceState initialState = RenderGraphResourceState::Undefined;
+
+        SR_NODISCARD bool IsCompatible(const RenderGraphResourceDesc& other) const noexcept {
+            return width == other.width && height == other.height && layers == other.layers &&
+                samples == other.samples && format == other.format;
+        }
+    };
+
+    /**
+     * Граф проходов кадра. Проходы объявляют, какие ресурсы читают и пишут, а компиляция:
+     *  - связывает чтения с записями (чтение видит последнюю запись, объявленную до него,
+     *    а если ее нет - содержимое прошлого кадра или импортированные данные и тогда идет раньше
+     *    первой записи; у временного ресурса такого содержимого нет, это ошибка) и строит порядок
+     *    топологической сортировкой, при равенстве сохраняя порядок объявления;
+     *  - отсекает проходы, результат которых не нужен ни проходам с побочными эффектами,
+     *    ни постоянным ресурсам;
+     *  - назначает временным ресурсам с непересекающимися временами жизни общие слоты;
+     *  - вычисляет барьеры перед каждым проходом.
+     * Компиляция не обращается к графическому API. Слоты и барьеры пока только вычисляются:
+     * кадровые буферы принадлежат проходам, а переходы делают render pass'ы Vulkan.
+     */
+    class SR_DLL_EXPORT RenderGraph : public SR_UTILS_NS::NonCopyable {
+    public:
+        using ResourceId = uint32_t;
+        using PassId = uint32_t;
+
+        static constexpr uint32_t InvalidId = SR_UINT32_MAX;
+
+        struct Access {
+            ResourceId resource = InvalidId;
+            RenderGraphResourceState state = RenderGraphResourceState::Undefined;
+            bool write = false;
+        };
+
+        struct Pass {
+            SR_UTILS_NS::StringAtom name;
+            std::vector<Access> accesses;
+            /// рисует в цель вне графа (например, в swapchain), поэтому никогда не отсекается
+            bool sideEffects = false;
+            bool culled = false;
+        };
+
+        struct Resource {
+            SR_UTILS_NS::StringAtom name;
+            RenderGraphResourceDesc desc;
+            /// физический слот временного ресурса после совмещения
+            uint32_t physical = InvalidId;
+            /// первый и последний проход, использующий ресурс, в индексах скомпилированного порядка
+            uint32_t firstUse = InvalidId;
+            uint32_t lastUse = InvalidId;
+        };
+
+        struct Barrier {
+            ResourceId resource = InvalidId;
+            RenderGraphResourceState before = RenderGraphResourceState::Undefined;
+            RenderGraphResourceState after = RenderGraphResourceState::Undefined;
+        };
+
+        struct CompiledPass {
+            PassId pass = InvalidId;
+            /// длина самой длинной цепочки зависимостей до прохода, проходы одной глубины независимы
+            uint32_t depth = 0;
+            uint32_t barrierOffset = 0;
+            uint32_t barrierCount = 0;
+        };
+
+    public:
+        void Clear();
+
+        /// Создает ресурс или обновляет описание уже упомянутого
+        ResourceId DeclareResource(const SR_UTILS_NS::StringAtom& name, const RenderGraphResourceDesc& desc);
+        /// Ресурс по имени, создается с описанием по умолчанию, если его еще нет
+        ResourceId GetOrAddResource(const SR_UTILS_NS::StringAtom& name);
+        SR_NODISCARD ResourceId FindResource(const SR_UTILS_NS::StringAtom& name) const;
+
+        PassId AddPass(const SR_UTILS_NS::StringAtom& name, bool sideEffects = false);
+        void SetSideEffects(PassId pass, bool sideEffects);
+
+        void Read(PassId pass, ResourceId resource, RenderGraphResourceState state = RenderGraphResourceState::ShaderRead);
+        void Write(PassId pass, ResourceId resource, RenderGraphResourceState state = RenderGraphResourceState::RenderTarget);
+
+        bool Compile();
+
+        SR_NODISCARD bool IsCompiled() const noexcept { return m_compiled; }
+        SR_NODISCARD bool IsPassCulled(PassId pass) const { return m_passes[pass].culled; }
+
+        SR_NODISCARD const std::vector<Pass>& GetPasses() const noexcept { return m_passes; }
+        SR_NODISCARD const std::vector<Resource>& GetResources() const noexcept { return m_resources; }
+        SR_NODISCARD const std::vector<CompiledPass>& GetCompiledPasses() const noexcept { return m_compiledPasses; }
+        SR_NODISCARD const std::vector<Barrier>& GetBarriers() const noexcept { return m_barriers; }
+        /// Сколько буферов понадобилось бы временным ресурсам после совмещения.
+        /// Бэкенд его не применяет: каждый проход по-прежнему создает свой кадровый буфер
+        SR_NODISCARD uint32_t GetPhysicalResourcesCount() const noexcept { return m_physicalCount; }
+
+    private:
+        bool BuildDependencies();
+        void CullPasses();
+        bool SortPasses();
+        void AliasResources();
+        void ComputeBarriers();
+
+    private:
+        std::vector<Pass> m_passes;
+        std::vector<Resource> m_resources;
+        ska::flat_hash_map<SR_UTILS_NS::StringAtom, ResourceId> m_resourceNames;
+
+        /// проходы, чьи записи читает проход (по данным) и которые должны выполниться раньше (по порядку)
+        std::vector<std::vector<PassId>> m_producers;
+        std::vector<std::vector<PassId>> m_predecessors;
+
+        std::vector<CompiledPass> m_compiledPasses;
+        std::vector<Barrier> m_barriers;
+        uint32_t m_physicalCount = 0;
+        bool m_compiled = false;
+
+    };
+
+    /// Объявление ресурсов одного прохода, передается в BasePass::DeclareResources
+    class SR_DLL_EXPORT RenderGraphPassBuilder {
+    public:
+        RenderGraphPassBuilder(RenderGraph& graph, RenderGraph::PassId pass)
+            : m_graph(graph)
+            , m_pass(pass)
+        { }
+
+    public:
+        void Read(const SR_UTILS_NS::StringAtom& name, RenderGraphResourceState state = RenderGraphResourceState::ShaderRead) {
+            m_graph.Read(m_pass, m_graph.GetOrAddResource(name), state);
+        }
+
+        void Write(const SR_UTILS_NS::StringAtom& name, const RenderGraphResourceDesc& desc) {
+            m_graph.Write(m_pass, m_graph.DeclareResource(name, desc), RenderGraphResourceState::RenderTarget);
+        }
+
+        void SetSideEffects() { m_graph.SetSideEffects(m_pass, true); }
+
+        SR_NODISCARD RenderGraph& GetGraph() const noexcept { return m_graph; }
+        SR_NODISCARD RenderGraph::PassId GetPass() const noexcept { return m_pass; }
+
+    private:
+        RenderGraph& m_graph;
+        RenderGraph::PassId m_pass;
+
+    };
+}
+
+#endif //SRENGINE_RENDERGRAPH_H
@@ -25,6 +25,8 @@ namespace SR_GRAPH_NS {
         bool LoadSettings(const SR_XML_NS::Node &node) override;
         void ClearSettings() override;
 
+        SR_NODISCARD SR_XML_NS::ConfigSchema GetConfigSchema() const override { return { "Technique", { "Name" } }; }
+
     };
 }
 
@@ -79,6 +79,12 @@ namespace SR_SRSL_NS {
 
             { "SSAO_SAMPLES",                   "vec4[64]"      },
 
+            { "LIGHT_CLUSTER_PARAMS",           "vec4"          },
+            { "LIGHT_CLUSTER_SIZE",             "ivec4"         },
+            { "LIGHT_CLUSTER_RANGES",           "ivec4[576]"    },
+            { "LIGHT_CLUSTER_INDICES",          "ivec4[128]"    },
+            { "CLUSTER_LIGHTS",                 "vec4[192]"     },
+
             { "LINE_COLOR",                     "vec4"          },
 
             { "TIME",                           "float"         },
@@ -30,6 +30,7 @@ namespace SR_GTYPES_NS {
         void SetColor(const SR_MATH_NS::FVector4& color);
 
         void OnResourceReloaded(SR_UTILS_NS::IResource* pResource) override;
+        void OnRawMeshChanged() override;
 
         SR_NODISCARD std::vector<uint32_t> GetIndices() const override;
         SR_NODISCARD std::string GetMeshIdentifier() const override;
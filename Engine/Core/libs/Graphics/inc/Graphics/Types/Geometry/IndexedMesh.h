@@ -37,16 +37,40 @@ namespace SR_GTYPES_NS {
         bool FreeVBO();
         bool FreeIBO();
 
+    protected:
+        /// Вызывать при смене идентификатора меша: другая модель, индекс меша в ней или ее перезагрузка
+        void MarkMeshKeyDirty() { m_meshKeyDirty = true; }
+
+        template<Vertices::VertexType type, Memory::MeshMemoryType memType> SR_NODISCARD Memory::MeshKey GetMeshKey();
+
     protected:
         int32_t m_IBO = SR_ID_INVALID;
         int32_t m_VBO = SR_ID_INVALID;
         uint32_t m_countIndices = 0;
         uint32_t m_countVertices = 0;
 
+    private:
+        /// хеш GetMeshIdentifier(), строка собирается и хешируется только после MarkMeshKeyDirty
+        Memory::MeshKey::Hash m_meshKeyHash = 0;
+        bool m_meshKeyDirty = true;
+
     };
 
     /// ----------------------------------------------------------------------------------------------------------------
 
+    template<Vertices::VertexType type, Memory::MeshMemoryType memType> Memory::MeshKey IndexedMesh::GetMeshKey() {
+        if (IsUniqueMesh()) {
+            return Memory::MeshKey();
+        }
+
+        if (m_meshKeyDirty) {
+            m_meshKeyHash = SR_HASH_STR_VIEW(GetMeshIdentifier());
+            m_meshKeyDirty = false;
+        }
+
+        return Memory::MeshKey::FromIdentifierHash<type, memType>(m_meshKeyHash);
+    }
+
     template<Vertices::VertexType type, typename Vertex> bool IndexedMesh::CalculateVBO(const SR_HTYPES_NS::Function<std::vector<Vertex>()>& getter) {
         SR_TRACY_ZONE;
 
@@ -55,8 +79,10 @@ namespace SR_GTYPES_NS {
 
         using namespace Memory;
 
+        const MeshKey key = GetMeshKey<type, MeshMemoryType::VBO>();
+
         if (!IsUniqueMesh()) {
-            m_VBO = MeshManager::Instance().CopyIfExists<type, MeshMemoryType::VBO>(GetMeshIdentifier());
+            m_VBO = MeshManager::Instance().CopyIfExists<MeshMemoryType::VBO>(key);
         }
 
         if (m_VBO == SR_ID_INVALID) {
@@ -65,9 +91,7 @@ namespace SR_GTYPES_NS {
         }
 
         if (!IsUniqueMesh()) {
-            m_countVertices = MeshManager::Instance().Size<type, MeshMemoryType::VBO>(
-                GetMeshIdentifier()
-            );
+            m_countVertices = MeshManager::Instance().Size<MeshMemoryType::VBO>(key);
         }
 
         return true;
@@ -81,8 +105,10 @@ namespace SR_GTYPES_NS {
 
         using namespace Memory;
 
+        const MeshKey key = GetMeshKey<type, MeshMemoryType::VBO>();
+
         if (!IsUniqueMesh()) {
-            m_VBO = MeshManager::Instance().CopyIfExists<type, MeshMemoryType::VBO>(GetMeshIdentifier());
+            m_VBO = MeshManager::Instance().CopyIfExists<MeshMemoryType::VBO>(key);
         }
 
         if (m_VBO == SR_ID_INVALID) {
@@ -100,17 +126,11 @@ namespace SR_GTYPES_NS {
                 return true;
             }
 
-            return MeshManager::Instance().Register<type, MeshMemoryType::VBO>(
-                GetMeshIdentifier(),
-                m_countVertices,
-                m_VBO
-            );
+            return MeshManager::Instance().Register<MeshMemoryType::VBO>(key, m_countVertices, m_VBO);
         }
 
         if (!IsUniqueMesh()) {
-            m_countVertices = MeshManager::Instance().Size<type, MeshMemoryType::VBO>(
-                GetMeshIdentifier()
-            );
+            m_countVertices = MeshManager::Instance().Size<MeshMemoryType::VBO>(key);
         }
 
         return true;
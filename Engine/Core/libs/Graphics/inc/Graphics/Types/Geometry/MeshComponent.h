@@ -52,11 +52,18 @@ namespace SR_GTYPES_NS {
             return m_translation;
         }
 
+        SR_NODISCARD bool GetBoundingSphere(SR_MATH_NS::FVector3& center, float_t& radius) const override;
+        SR_NODISCARD uint64_t GetMatrixVersion() const noexcept override { return m_matrixVersion; }
+
     protected:
         std::string m_geometryName;
 
         SR_MATH_NS::Matrix4x4 m_modelMatrix = SR_MATH_NS::Matrix4x4::Identity();
         SR_MATH_NS::FVector3 m_translation = SR_MATH_NS::FVector3::Zero();
+        uint64_t m_matrixVersion = 0;
+
+        /// радиус сферы вокруг начала координат меша, отрицательный - не посчитан
+        float_t m_localBoundingRadius = -1.f;
 
         SR_MATH_NS::FVector3 m_barycenter = SR_MATH_NS::FVector3(SR_MATH_NS::UnitMAX);
 
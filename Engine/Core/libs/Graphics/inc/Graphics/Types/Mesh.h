@@ -9,6 +9,7 @@
 #include <Utils/Common/Enumerations.h>
 #include <Utils/Types/SafePointer.h>
 #include <Utils/Types/Function.h>
+#include <Utils/Profile/MemoryTracker.h>
 
 #include <Graphics/Utils/MeshTypes.h>
 #include <Graphics/Memory/IGraphicsResource.h>
@@ -33,6 +34,7 @@ namespace SR_GTYPES_NS {
     class Material;
 
     class Mesh : public SR_UTILS_NS::NonCopyable, public Memory::IGraphicsResource {
+        SR_MEMORY_TAG(SR_UTILS_NS::MemoryTag::Mesh)
         friend class Material;
     public:
         using RenderScenePtr = SR_HTYPES_NS::SafePtr<RenderScene>;
@@ -69,6 +71,10 @@ namespace SR_GTYPES_NS {
         SR_NODISCARD virtual std::string GetGeometryName() const { return std::string(); }
         SR_NODISCARD virtual std::string GetMeshIdentifier() const;
         SR_NODISCARD virtual int64_t GetSortingPriority() const { return 0; }
+        /// Описанная сфера в мировых координатах, false - границы неизвестны
+        SR_NODISCARD virtual bool GetBoundingSphere(SR_MATH_NS::FVector3& center, float_t& radius) const { return false; }
+        /// Растет при каждом изменении матрицы модели
+        SR_NODISCARD virtual uint64_t GetMatrixVersion() const noexcept { return 0; }
 
         SR_NODISCARD ShaderPtr GetShader() const;
         SR_NODISCARD MaterialPtr GetMaterial() const { return m_material; }
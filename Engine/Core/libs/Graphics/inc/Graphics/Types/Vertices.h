@@ -11,6 +11,7 @@
 
 #include <Utils/Common/StringFormat.h>
 #include <Utils/Common/Vertices.h>
+#include <Utils/FileSystem/BakedMesh.h>
 #include <Utils/Common/Enumerations.h>
 #include <Utils/Profile/TracyContext.h>
 
@@ -347,6 +348,51 @@ namespace SR_GRAPH_NS::Vertices {
 
         return vertices;
     }
+
+    static_assert(sizeof(StaticMeshVertex) == sizeof(SR_UTILS_NS::BakedStaticVertex), "Baked static vertex layout is outdated!");
+    static_assert(sizeof(SkinnedMeshVertex) == sizeof(SR_UTILS_NS::BakedSkinnedVertex), "Baked skinned vertex layout is outdated!");
+    static_assert(offsetof(StaticMeshVertex, bitang) == offsetof(SR_UTILS_NS::BakedStaticVertex, bitangent));
+    static_assert(offsetof(SkinnedMeshVertex, weights) == offsetof(SR_UTILS_NS::BakedSkinnedVertex, weights));
+
+    /// Вершины запеченной модели. Если формат подмеша совпадает с T, данные копируются одним блоком
+    template<typename T> static std::vector<T> CastVertices(const SR_UTILS_NS::BakedMesh& bakedMesh, uint32_t id) {
+        SR_TRACY_ZONE;
+
+        const uint32_t count = bakedMesh.GetSubmesh(id).vertexCount;
+
+        if constexpr (std::is_same<Vertices::StaticMeshVertex, T>::value) {
+            if (auto&& pStatic = bakedMesh.GetStaticVertices(id)) {
+                auto&& pBegin = reinterpret_cast<const T*>(pStatic);
+                return std::vector<T>(pBegin, pBegin + count);
+            }
+
+            /// подмеш с костями, веса отбрасываются
+            std::vector<T> vertices(count);
+            auto&& pSkinned = bakedMesh.GetSkinnedVertices(id);
+            for (uint32_t i = 0; i < count; ++i) {
+                std::memcpy(&vertices[i], &pSkinned[i], sizeof(T));
+            }
+            return vertices;
+        }
+        else if constexpr (std::is_same<Vertices::SkinnedMeshVertex, T>::value) {
+            if (auto&& pSkinned = bakedMesh.GetSkinnedVertices(id)) {
+                auto&& pBegin = reinterpret_cast<const T*>(pSkinned);
+                return std::vector<T>(pBegin, pBegin + count);
+            }
+
+            /// подмеш без костей, веса нулевые
+            std::vector<T> vertices(count);
+            auto&& pStatic = bakedMesh.GetStaticVertices(id);
+            for (uint32_t i = 0; i < count; ++i) {
+                std::memcpy(&vertices[i], &pStatic[i], sizeof(SR_UTILS_NS::BakedStaticVertex));
+                std::memset(&vertices[i].weights, 0, sizeof(vertices[i].weights));
+            }
+            return vertices;
+        }
+        else {
+            return CastVertices<T>(bakedMesh.GetVertices(id));
+        }
+    }
 }
 
 namespace std {
@@ -0,0 +1,57 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SRENGINE_SHADOWCASCADES_H
+#define SRENGINE_SHADOWCASCADES_H
+
+#include <Utils/Math/Matrix4x4.h>
+
+namespace SR_GRAPH_NS {
+    struct ShadowCascade {
+        SR_MATH_NS::Matrix4x4 viewProjection;
+        /// центр описанной сферы каскада после привязки к текселям
+        SR_MATH_NS::FVector3 center;
+        float_t radius = 0.f;
+        /// половина стороны ортографической проекции, не меньше radius
+        float_t extent = 0.f;
+        /// дальняя граница каскада в пространстве вида (отрицательная, как ждет шейдер)
+        float_t splitDepth = 0.f;
+    };
+
+    /// Нормированные в [0, 1] дальние границы каскадов, смешение логарифмического и равномерного разбиения
+    SR_NODISCARD std::vector<float_t> CalculateCascadeSplits(float_t near, float_t far, uint32_t count, float_t lambda);
+
+    /**
+     * Ортографический каскад для части пирамиды камеры между lastSplit и split.
+     * Центр привязывается к сетке текселей в пространстве света, поэтому при движении камеры
+     * каскад сдвигается на целое число текселей и края теней не дрожат.
+     * resolution - размер карты теней, 0 отключает привязку.
+     * extentScale расширяет проекцию сверх описанной сферы: закэшированный каскад продолжает
+     * покрывать срез пирамиды, пока центр смещен не дальше radius * (extentScale - 1)
+     */
+    SR_NODISCARD ShadowCascade CalculateShadowCascade(
+        const SR_MATH_NS::Matrix4x4& invViewProjection,
+        float_t lastSplit, float_t split, float_t near, float_t far,
+        const SR_MATH_NS::FVector3& lightDirection, uint32_t resolution, float_t extentScale = 1.f);
+
+    /// Поворот пространства света без переноса, общий для привязки и отсечения
+    SR_NODISCARD SR_MATH_NS::Matrix4x4 GetShadowLightRotation(const SR_MATH_NS::FVector3& lightDirection);
+
+    /**
+     * Может ли сфера отбросить тень в каскад: пересечение по осям X/Y пространства света
+     * и не дальше задней грани. В сторону источника объем не ограничивается - такие объекты
+     * тоже затеняют каскад. margin расширяет каскад, чтобы результат оставался верным при небольших сдвигах
+     */
+    SR_NODISCARD bool IsSphereInShadowCascade(const ShadowCascade& cascade, const SR_MATH_NS::Matrix4x4& lightRotation,
+        const SR_MATH_NS::FVector3& center, float_t radius, float_t margin);
+
+    /**
+     * Покрывает ли закэшированная проекция cached срез пирамиды нового каскада cascade.
+     * До привязки центр среза лежал в пределах текселя от cascade.center, это тоже учитывается
+     */
+    SR_NODISCARD bool IsShadowCascadeCovered(const ShadowCascade& cached, const ShadowCascade& cascade,
+        const SR_MATH_NS::Matrix4x4& lightRotation, uint32_t resolution);
+}
+
+#endif //SRENGINE_SHADOWCASCADES_H
@@ -4,6 +4,8 @@
 
 #include <Graphics/Animations/AnimationChannel.h>
 
+#include <Utils/Types/RawMesh.h>
+
 namespace SR_ANIMATIONS_NS {
     AnimationChannel::~AnimationChannel() {
         for (auto&& [time, pKey] : m_keys) {
@@ -60,26 +62,35 @@ namespace SR_ANIMATIONS_NS {
         return keyIndex;
     }
 
-    void AnimationChannel::Load(SR_HTYPES_NS::RawMesh* pRawMesh, aiNodeAnim* pChannel, float_t ticksPerSecond, std::vector<AnimationChannel*>& channels) {
+    void AnimationChannel::Load(SR_HTYPES_NS::RawMesh* pRawMesh, const SR_UTILS_NS::BakedMesh::Channel& channel, float_t ticksPerSecond, std::vector<AnimationChannel*>& channels) {
         SR_TRACY_ZONE;
 
-        auto&& boneIndex = pRawMesh->GetBoneIndex(SR_HASH_STR_VIEW(pChannel->mNodeName.C_Str()));
+        auto&& bakedMesh = *pRawMesh->GetBakedMesh();
+        auto&& name = bakedMesh.GetString(channel.nameOffset, channel.nameSize);
+
+        auto&& boneIndex = pRawMesh->GetBoneIndex(SR_HASH_STR_VIEW(name));
 
-        if (pChannel->mNumPositionKeys > 0) {
+        auto&& toVector = [](const SR_UTILS_NS::BakedVectorKey& key, float_t multiplier) {
+            return SR_MATH_NS::FVector3(key.value.x, key.value.y, key.value.z) * multiplier;
+        };
+
+        if (channel.positionKeysCount > 0) {
             static constexpr float_t mul = 0.01;
 
+            auto&& pPositionKeys = bakedMesh.GetVectorKeys(channel.positionKeysOffset);
+
             auto&& pTranslationChannel = new AnimationChannel();
-            auto&& first = AiV3ToFV3(pChannel->mPositionKeys[0].mValue, mul);
+            auto&& first = toVector(pPositionKeys[0], mul);
 
-            pTranslationChannel->SetName(pChannel->mNodeName.C_Str());
+            pTranslationChannel->SetName(name);
             pTranslationChannel->SetBoneIndex(boneIndex);
 
-            for (uint16_t positionKeyIndex = 0; positionKeyIndex < pChannel->mNumPositionKeys; ++positionKeyIndex) {
-                auto&& pPositionKey = pChannel->mPositionKeys[positionKeyIndex];
+            for (uint32_t positionKeyIndex = 0; positionKeyIndex < channel.positionKeysCount; ++positionKeyIndex) {
+                auto&& pPositionKey = pPositionKeys[positionKeyIndex];
 
-                auto&& translation = AiV3ToFV3(pPositionKey.mValue, mul);
+                auto&& translation = toVector(pPositionKey, mul);
 
-                pTranslationChannel->AddKey(pPositionKey.mTime / ticksPerSecond,
+                pTranslationChannel->AddKey(pPositionKey.time / ticksPerSecond,
                     new TranslationKey(
                         pTranslationChannel,
                         translation,
@@ -93,21 +104,27 @@ namespace SR_ANIMATIONS_NS {
 
         /// --------------------------------------------------------------------------------------------------------
 
-        if (pChannel->mNumRotationKeys > 0) {
+        if (channel.rotationKeysCount > 0) {
+            auto&& pRotationKeys = bakedMesh.GetQuatKeys(channel.rotationKeysOffset);
+
+            auto&& toQuaternion = [](const SR_UTILS_NS::BakedQuatKey& key) {
+                return SR_MATH_NS::Quaternion(key.x, key.y, key.z, key.w);
+            };
+
             auto&& pRotationChannel = new AnimationChannel();
-            auto&& first = AiQToQ(pChannel->mRotationKeys[0].mValue).Inverse();
+            auto&& first = toQuaternion(pRotationKeys[0]).Inverse();
 
-            pRotationChannel->SetName(pChannel->mNodeName.C_Str());
+            pRotationChannel->SetName(name);
             pRotationChannel->SetBoneIndex(boneIndex);
 
-            for (uint16_t rotationKeyIndex = 0; rotationKeyIndex < pChannel->mNumRotationKeys; ++rotationKeyIndex) {
-                auto&& pRotationKey = pChannel->mRotationKeys[rotationKeyIndex];
+            for (uint32_t rotationKeyIndex = 0; rotationKeyIndex < channel.rotationKeysCount; ++rotationKeyIndex) {
+                auto&& pRotationKey = pRotationKeys[rotationKeyIndex];
 
-                auto&& q = AiQToQ(pRotationKey.mValue);
+                auto&& q = toQuaternion(pRotationKey);
 
                 auto&& delta = q * first;
 
-                pRotationChannel->AddKey(pRotationKey.mTime / ticksPerSecond,
+                pRotationChannel->AddKey(pRotationKey.time / ticksPerSecond,
                      new RotationKey(pRotationChannel, q, delta)
                 );
             }
@@ -117,19 +134,21 @@ namespace SR_ANIMATIONS_NS {
 
         /// --------------------------------------------------------------------------------------------------------
 
-        if (pChannel->mNumScalingKeys > 0) {
+        if (channel.scalingKeysCount > 0) {
+            auto&& pScalingKeys = bakedMesh.GetVectorKeys(channel.scalingKeysOffset);
+
             auto&& pScalingChannel = new AnimationChannel();
-            auto&& first = AiV3ToFV3(pChannel->mScalingKeys[0].mValue, 1.f);
+            auto&& first = toVector(pScalingKeys[0], 1.f);
 
-            pScalingChannel->SetName(pChannel->mNodeName.C_Str());
+            pScalingChannel->SetName(name);
             pScalingChannel->SetBoneIndex(boneIndex);
 
-            for (uint16_t scalingKeyIndex = 0; scalingKeyIndex < pChannel->mNumScalingKeys; ++scalingKeyIndex) {
-                auto&& pScalingKey = pChannel->mScalingKeys[scalingKeyIndex];
+            for (uint32_t scalingKeyIndex = 0; scalingKeyIndex < channel.scalingKeysCount; ++scalingKeyIndex) {
+                auto&& pScalingKey = pScalingKeys[scalingKeyIndex];
 
-                auto&& scale = AiV3ToFV3(pScalingKey.mValue, 1.f);
+                auto&& scale = toVector(pScalingKey, 1.f);
 
-                pScalingChannel->AddKey(pScalingKey.mTime / ticksPerSecond,
+                pScalingChannel->AddKey(pScalingKey.time / ticksPerSecond,
                     new ScalingKey(
                         pScalingChannel,
                         scale,
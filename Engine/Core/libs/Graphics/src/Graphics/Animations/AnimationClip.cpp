@@ -2,9 +2,6 @@
 // Created by Monika on 08.01.2023.
 //
 
-#include <assimp/Importer.hpp>
-#include <assimp/scene.h>
-
 #include <Graphics/Animations/AnimationClip.h>
 #include <Graphics/Animations/AnimationChannel.h>
 
@@ -84,13 +81,14 @@ namespace SR_ANIMATIONS_NS {
     }
 
     void AnimationClip::LoadChannels(SR_HTYPES_NS::RawMesh* pRawMesh, uint32_t index) {
-        auto&& pAnimation = pRawMesh->GetAssimpScene()->mAnimations[index];
+        auto&& bakedMesh = *pRawMesh->GetBakedMesh();
+        auto&& animation = bakedMesh.GetAnimation(index);
 
-        for (uint16_t channelIndex = 0; channelIndex < pAnimation->mNumChannels; ++channelIndex) {
+        for (uint32_t channelIndex = 0; channelIndex < animation.channelsCount; ++channelIndex) {
             AnimationChannel::Load(
                 pRawMesh,
-                pAnimation->mChannels[channelIndex],
-                pAnimation->mTicksPerSecond,
+                bakedMesh.GetChannel(animation.firstChannel + channelIndex),
+                animation.ticksPerSecond,
                 m_channels
             );
         }
@@ -123,8 +121,8 @@ namespace SR_ANIMATIONS_NS {
                 return false;
             }
 
-            if (index >= pRawMesh->GetAssimpScene()->mNumAnimations) {
-                SR_ERROR("AnimationClip::Load() : wrong animation index!\n\tTotal animations: {}", pRawMesh->GetAssimpScene()->mNumAnimations);
+            if (index >= pRawMesh->GetAnimationsCount()) {
+                SR_ERROR("AnimationClip::Load() : wrong animation index!\n\tTotal animations: {}", pRawMesh->GetAnimationsCount());
                 return false;
             }
 
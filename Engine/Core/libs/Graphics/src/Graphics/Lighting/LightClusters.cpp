@@ -0,0 +1,335 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Graphics/Lighting/LightClusters.h>
+
+#include <Utils/Profile/TracyContext.h>
+
+namespace SR_GRAPH_NS {
+    ClusterLight ClusterLight::Point(const SR_MATH_NS::FVector3& position, float_t radius, uint32_t index) noexcept {
+        ClusterLight light;
+        light.position = position;
+        light.radius = radius;
+        light.boundingCenter = position;
+        light.boundingRadius = radius;
+        light.index = index;
+        return light;
+    }
+
+    ClusterLight ClusterLight::Spot(const SR_MATH_NS::FVector3& position, const SR_MATH_NS::FVector3& direction,
+        float_t distance, float_t coneRadius, uint32_t index
+    ) noexcept {
+        const float_t slant = std::sqrt(distance * distance + coneRadius * coneRadius);
+
+        ClusterLight light;
+        light.position = position;
+        light.radius = distance;
+        light.direction = direction;
+        light.cosHalfAngle = slant > 0.f ? distance / slant : 1.f;
+        light.sinHalfAngle = slant > 0.f ? coneRadius / slant : 0.f;
+        light.spot = true;
+        light.index = index;
+
+        /// край основания дальше от вершины, чем distance, поэтому сфера радиуса distance вокруг вершины конус не покрывает.
+        /// Для узкого конуса описанная сфера проходит через вершину и край основания, для широкого - через край основания
+        if (coneRadius <= distance) {
+            const float_t boundingRadius = distance > 0.f ? slant * slant / (2.f * distance) : 0.f;
+            light.boundingCenter = position + direction * boundingRadius;
+            light.boundingRadius = boundingRadius;
+        }
+        else {
+            light.boundingCenter = position + direction * distance;
+            light.boundingRadius = coneRadius;
+        }
+
+        return light;
+    }
+
+    bool LightClusterGrid::Init(const LightClusterConfig& config) {
+        if (config.sizeX == 0 || config.sizeY == 0 || config.sizeZ == 0) {
+            SR_ERROR("LightClusterGrid::Init() : invalid grid size {}x{}x{}!", config.sizeX, config.sizeY, config.sizeZ);
+            return false;
+        }
+
+        if (config.near <= 0.f || config.far <= config.near) {
+            SR_ERROR("LightClusterGrid::Init() : invalid depth range! Near: {}, far: {}", config.near, config.far);
+            return false;
+        }
+
+        m_config = config;
+
+        m_tanY = std::tan(config.FOV * 0.5f);
+        m_tanX = m_tanY * config.aspect;
+        m_logDepthScale = static_cast<float_t>(config.sizeZ) / std::log(config.far / config.near);
+
+        m_bounds.resize(static_cast<uint64_t>(config.sizeX) * config.sizeY * config.sizeZ);
+        m_ranges.assign(m_bounds.size(), LightClusterRange());
+        m_indices.clear();
+
+        for (uint32_t z = 0; z < config.sizeZ; ++z) {
+            const float_t nearDepth = GetSliceDepth(z);
+            const float_t farDepth = GetSliceDepth(z + 1);
+
+            for (uint32_t y = 0; y < config.sizeY; ++y) {
+                const float_t bottom = -m_tanY + 2.f * m_tanY * static_cast<float_t>(y) / static_cast<float_t>(config.sizeY);
+                const float_t top = -m_tanY + 2.f * m_tanY * static_cast<float_t>(y + 1) / static_cast<float_t>(config.sizeY);
+
+                for (uint32_t x = 0; x < config.sizeX; ++x) {
+                    const float_t left = -m_tanX + 2.f * m_tanX * static_cast<float_t>(x) / static_cast<float_t>(config.sizeX);
+                    const float_t right = -m_tanX + 2.f * m_tanX * static_cast<float_t>(x + 1) / static_cast<float_t>(config.sizeX);
+
+                    /// грани тайла расходятся с глубиной, поэтому берем крайние значения на обеих плоскостях среза
+                    auto&& bounds = m_bounds[GetClusterIndex(x, y, z)];
+                    bounds.min.x = SR_MIN(left * nearDepth, left * farDepth);
+                    bounds.max.x = SR_MAX(right * nearDepth, right * farDepth);
+                    bounds.min.y = SR_MIN(bottom * nearDepth, bottom * farDepth);
+                    bounds.max.y = SR_MAX(top * nearDepth, top * farDepth);
+                    bounds.min.z = nearDepth;
+                    bounds.max.z = farDepth;
+                }
+            }
+        }
+
+        /// бокс тайла на срезе доходит до right * farDepth уже на nearDepth, поэтому боковые грани
+        /// раскрываются на отношение глубин соседних срезов, с небольшим запасом на округление
+        const float_t sliceRatio = GetSliceDepth(1) / config.near * 1.001f;
+
+        auto&& makeSidePlane = [](float_t x, float_t y, float_t tangent) {
+            SR_MATH_NS::Plane plane;
+            plane.normal = SR_MATH_NS::FVector3(x, y, tangent).Normalize();
+            return plane;
+        };
+
+        m_planes[0].normal = SR_MATH_NS::FVector3(0.f, 0.f, 1.f);
+        m_planes[0].distance = -config.near;
+        m_planes[1].normal = SR_MATH_NS::FVector3(0.f, 0.f, -1.f);
+        m_planes[1].distance = config.far;
+        m_planes[2] = makeSidePlane(1.f, 0.f, m_tanX * sliceRatio);
+        m_planes[3] = makeSidePlane(-1.f, 0.f, m_tanX * sliceRatio);
+        m_planes[4] = makeSidePlane(0.f, 1.f, m_tanY * sliceRatio);
+        m_planes[5] = makeSidePlane(0.f, -1.f, m_tanY * sliceRatio);
+
+        return true;
+    }
+
+    uint32_t LightClusterGrid::GetSlice(float_t depth) const noexcept {
+        if (depth < m_config.near || depth > m_config.far) {
+            return SR_UINT32_MAX;
+        }
+
+        const auto slice = static_cast<uint32_t>(std::log(depth / m_config.near) * m_logDepthScale);
+
+        return SR_MIN(slice, m_config.sizeZ - 1);
+    }
+
+    float_t LightClusterGrid::GetSliceDepth(uint32_t slice) const noexcept {
+        return m_config.near * std::pow(m_config.far / m_config.near, static_cast<float_t>(slice) / static_cast<float_t>(m_config.sizeZ));
+    }
+
+    void LightClusterGrid::Build(const std::vector<ClusterLight>& lights) {
+        SR_TRACY_ZONE;
+
+        m_pairs.clear();
+
+        /// грубый отбор всех источников по пирамиде одним пакетным вызовом, раскладываются только видимые
+        m_spheres.resize(lights.size());
+        m_visible.resize(lights.size());
+
+        for (uint64_t i = 0; i < lights.size(); ++i) {
+            m_spheres[i].center = lights[i].boundingCenter;
+            m_spheres[i].radius = lights[i].boundingRadius;
+        }
+
+        SR_MATH_NS::SIMD::TestSpheres(m_planes.data(), static_cast<uint32_t>(m_planes.size()), m_spheres.data(), m_visible.data(), lights.size());
+
+        m_visibleLightsCount = 0;
+
+        for (uint64_t i = 0; i < lights.size(); ++i) {
+            if (m_visible[i]) {
+                ++m_visibleLightsCount;
+                BinLight(lights[i]);
+            }
+        }
+
+        /// подсчет по кластерам, префиксная сумма и раскладка индексов
+        for (auto&& range : m_ranges) {
+            range = LightClusterRange();
+        }
+
+        for (auto&& [cluster, light] : m_pairs) {
+            ++m_ranges[cluster].count;
+        }
+
+        uint32_t offset = 0;
+        for (auto&& range : m_ranges) {
+            range.offset = offset;
+            offset += range.count;
+            range.count = 0;
+        }
+
+        m_indices.resize(m_pairs.size());
+
+        for (auto&& [cluster, light] : m_pairs) {
+            auto&& range = m_ranges[cluster];
+            m_indices[range.offset + range.count++] = light;
+        }
+    }
+
+    void LightClusterGrid::BinLight(const ClusterLight& light) {
+        const SR_MATH_NS::FVector3& center = light.boundingCenter;
+        const float_t radius = light.boundingRadius;
+
+        const float_t minDepth = SR_MAX(center.z - radius, m_config.near);
+        const float_t maxDepth = SR_MIN(center.z + radius, m_config.far);
+
+        if (minDepth > maxDepth) {
+            return;
+        }
+
+        /// соседние срезы тоже проверяются, чтобы округление логарифма не теряло пересечения на границах
+        const uint32_t minSlice = SR_MAX(GetSlice(minDepth), 1u) - 1;
+        const uint32_t maxSlice = SR_MIN(GetSlice(maxDepth) + 1, m_config.sizeZ - 1);
+
+        for (uint32_t z = minSlice; z <= maxSlice; ++z) {
+            /// границы боксов монотонно растут вдоль строки и столбца тайлов,
+            /// поэтому диапазон кандидатов находится по одной оси за раз
+            uint32_t x0 = 0;
+            uint32_t x1 = m_config.sizeX;
+            while (x0 < m_config.sizeX && m_bounds[GetClusterIndex(x0, 0, z)].max.x < center.x - radius) {
+                ++x0;
+            }
+            while (x1 > x0 && m_bounds[GetClusterIndex(x1 - 1, 0, z)].min.x > center.x + radius) {
+                --x1;
+            }
+
+            uint32_t y0 = 0;
+            uint32_t y1 = m_config.sizeY;
+            while (y0 < m_config.sizeY && m_bounds[GetClusterIndex(0, y0, z)].max.y < center.y - radius) {
+                ++y0;
+            }
+            while (y1 > y0 && m_bounds[GetClusterIndex(0, y1 - 1, z)].min.y > center.y + radius) {
+                --y1;
+            }
+
+            for (uint32_t y = y0; y < y1; ++y) {
+                for (uint32_t x = x0; x < x1; ++x) {
+                    const uint32_t cluster = GetClusterIndex(x, y, z);
+
+                    if (LightIntersectsBounds(light, m_bounds[cluster])) {
+                        m_pairs.emplace_back(cluster, light.index);
+                    }
+                }
+            }
+        }
+    }
+
+    bool LightClusterGrid::SphereIntersectsBounds(const SR_MATH_NS::FVector3& center, float_t radius, const LightClusterBounds& bounds) noexcept {
+        float_t distance = 0.f;
+
+        for (uint8_t i = 0; i < 3; ++i) {
+            if (center[i] < bounds.min[i]) {
+                distance += (bounds.min[i] - center[i]) * (bounds.min[i] - center[i]);
+            }
+            else if (center[i] > bounds.max[i]) {
+                distance += (center[i] - bounds.max[i]) * (center[i] - bounds.max[i]);
+            }
+        }
+
+        return distance <= radius * radius;
+    }
+
+    bool LightClusterGrid::ConeIntersectsSphere(const ClusterLight& light, const SR_MATH_NS::FVector3& center, float_t radius) noexcept {
+        const SR_MATH_NS::FVector3 toCenter = center - light.position;
+
+        const float_t lengthSq = toCenter.Dot(toCenter);
+        const float_t alongAxis = toCenter.Dot(light.direction);
+        const float_t distanceToAxis = std::sqrt(SR_MAX(lengthSq - alongAxis * alongAxis, 0.f));
+
+        /// расстояние от центра сферы до образующей конуса
+        const float_t distanceToCone = light.cosHalfAngle * distanceToAxis - alongAxis * light.sinHalfAngle;
+
+        const bool angleCull = distanceToCone > radius;
+        const bool frontCull = alongAxis > radius + light.radius;
+        const bool backCull = alongAxis < -radius;
+
+        return !(angleCull || frontCull || backCull);
+    }
+
+    bool LightClusterGrid::LightIntersectsBounds(const ClusterLight& light, const LightClusterBounds& bounds) noexcept {
+        if (!SphereIntersectsBounds(light.boundingCenter, light.boundingRadius, bounds)) {
+            return false;
+        }
+
+        if (!light.spot) {
+            return true;
+        }
+
+        const SR_MATH_NS::FVector3 center = (bounds.min + bounds.max) * 0.5f;
+        const float_t radius = (bounds.max - bounds.min).Length() * 0.5f;
+
+        return ConeIntersectsSphere(light, center, radius);
+    }
+
+    void LightClusterShaderData::Pack(const LightClusterGrid& grid, const std::vector<ClusterLight>& clusterLights) {
+        SR_TRACY_ZONE;
+
+        auto&& config = grid.GetConfig();
+
+        params = SR_MATH_NS::FVector4(config.near, grid.GetLogDepthScale(), grid.GetTanX(), grid.GetTanY());
+
+        uint32_t lightsCount = 0;
+
+        for (auto&& light : clusterLights) {
+            if (light.index >= MaxLights) {
+                continue;
+            }
+
+            auto&& pLight = &lights[light.index * 3];
+            pLight[0] = SR_MATH_NS::FVector4(light.position, light.radius);
+            pLight[1] = SR_MATH_NS::FVector4(light.direction, light.spot ? light.cosHalfAngle : -1.f);
+            pLight[2] = SR_MATH_NS::FVector4(light.intensity, light.spot ? 1.f : 0.f, 0.f, 0.f);
+
+            lightsCount = SR_MAX(lightsCount, light.index + 1);
+        }
+
+        SRAssert2(grid.GetClustersCount() <= MaxClusters, "LightClusterShaderData::Pack() : too many clusters!");
+
+        const uint32_t clustersCount = SR_MIN(grid.GetClustersCount(), MaxClusters);
+
+        size = {
+            static_cast<int32_t>(config.sizeX),
+            static_cast<int32_t>(config.sizeY),
+            static_cast<int32_t>(clustersCount / (config.sizeX * config.sizeY)),
+            static_cast<int32_t>(lightsCount)
+        };
+
+        auto&& gridRanges = grid.GetRanges();
+        auto&& gridIndices = grid.GetIndices();
+
+        std::fill(indices.begin(), indices.end(), 0);
+        droppedIndices = 0;
+
+        uint32_t offset = 0;
+
+        for (uint32_t cluster = 0; cluster < clustersCount; ++cluster) {
+            auto&& range = gridRanges[cluster];
+            uint32_t count = 0;
+
+            for (uint32_t i = range.offset; i < range.offset + range.count; ++i) {
+                const uint32_t lightIndex = gridIndices[i];
+                if (lightIndex >= MaxLights || offset + count >= MaxIndices) {
+                    ++droppedIndices;
+                    continue;
+                }
+
+                const uint32_t slot = offset + count;
+                indices[slot / 4] |= static_cast<int32_t>(lightIndex << ((slot % 4) * 8));
+                ++count;
+            }
+
+            ranges[cluster] = static_cast<int32_t>(offset | (count << 16));
+            offset += count;
+        }
+    }
+}
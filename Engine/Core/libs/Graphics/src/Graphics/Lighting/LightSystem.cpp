@@ -4,6 +4,11 @@
 
 #include <Graphics/Render/RenderScene.h>
 #include <Graphics/Lighting/LightSystem.h>
+#include <Graphics/Lighting/PointLight.h>
+#include <Graphics/Lighting/SpotLight.h>
+#include <Graphics/Types/Camera.h>
+
+#include <Utils/ECS/Transform.h>
 
 namespace SR_GRAPH_NS {
     LightSystem::LightSystem(RenderScenePtr pRenderScene)
@@ -72,4 +77,73 @@ namespace SR_GRAPH_NS {
                 break;
         }
     }
-}
\ No newline at end of file
+
+    void LightSystem::UpdateClusters(const Types::Camera* pCamera) {
+        SR_TRACY_ZONE;
+
+        if (!pCamera) {
+            return;
+        }
+
+        auto&& config = m_clusters.GetConfig();
+
+        const auto FOV = static_cast<float_t>(SR_RAD(pCamera->GetFOV()));
+
+        if (m_clusters.GetClustersCount() == 0 || config.near != pCamera->GetNear() || config.far != pCamera->GetFar() ||
+            config.FOV != FOV || config.aspect != pCamera->GetAspect()
+        ) {
+            LightClusterConfig newConfig = config;
+            /// сетка должна поместиться в uniform-массивы прохода освещения
+            newConfig.sizeZ = LightClusterShaderData::MaxClusters / (newConfig.sizeX * newConfig.sizeY);
+            newConfig.near = pCamera->GetNear();
+            newConfig.far = pCamera->GetFar();
+            newConfig.FOV = FOV;
+            newConfig.aspect = pCamera->GetAspect();
+
+            if (!m_clusters.Init(newConfig)) {
+                return;
+            }
+        }
+
+        /// камера смотрит вдоль -Z пространства вида, в кластерах глубина положительная
+        auto&& view = pCamera->GetViewTranslateRef();
+
+        const auto toViewSpace = [&view](const SR_MATH_NS::FVector3& vector, float_t w) {
+            const SR_MATH_NS::FVector4 result = view * SR_MATH_NS::FVector4(vector, w);
+            return SR_MATH_NS::FVector3(result.x, result.y, -result.z);
+        };
+
+        m_clusterLights.clear();
+
+        for (auto&& pLight : m_pointLights) {
+            if (!pLight->IsActive()) {
+                continue;
+            }
+
+            m_clusterLights.emplace_back(ClusterLight::Point(
+                toViewSpace(pLight->GetTransform()->GetTranslation(), 1.f),
+                pLight->GetRadius(),
+                static_cast<uint32_t>(m_clusterLights.size())
+            ));
+            m_clusterLights.back().intensity = pLight->GetIntensity();
+        }
+
+        for (auto&& pLight : m_spotLights) {
+            if (!pLight->IsActive()) {
+                continue;
+            }
+
+            m_clusterLights.emplace_back(ClusterLight::Spot(
+                toViewSpace(pLight->GetTransform()->GetTranslation(), 1.f),
+                toViewSpace(pLight->GetDirection(), 0.f).Normalize(),
+                pLight->GetDistance(),
+                pLight->GetRadius(),
+                static_cast<uint32_t>(m_clusterLights.size())
+            ));
+            m_clusterLights.back().intensity = pLight->GetIntensity();
+        }
+
+        m_clusters.Build(m_clusterLights);
+        m_clusterShaderData.Pack(m_clusters, m_clusterLights);
+    }
+}
@@ -4,6 +4,14 @@
 
 #include <Graphics/Lighting/SpotLight.h>
 
+#include <Utils/ECS/Transform.h>
+
 namespace SR_GRAPH_NS {
+    SR_MATH_NS::FVector3 SpotLight::GetDirection() const {
+        if (auto&& pTransform = GetTransform()) {
+            return pTransform->GetQuaternion() * SR_MATH_NS::FVector3(0.f, 0.f, 1.f);
+        }
 
+        return SR_MATH_NS::FVector3(0.f, 0.f, 1.f);
+    }
 }
@@ -36,16 +36,16 @@ namespace SR_GRAPH_NS::Memory {
         return std::nullopt;
     }
 
-    bool MeshManager::RegisterImpl(const std::string& resourceId, MeshMemoryType memType, uint32_t size, uint32_t id) {
+    bool MeshManager::RegisterImpl(const MeshKey& key, MeshMemoryType memType, uint32_t size, uint32_t id) {
     #ifndef SR_RELEASE
         if (SR_UTILS_NS::Debug::Instance().GetLevel() >= SR_UTILS_NS::Debug::Level::High) {
-            SR_LOG("MeshManager::RegisterImpl() : register resource \"" + resourceId + "\"");
+            SR_LOG("MeshManager::RegisterImpl() : register resource {}", key.hash);
         }
     #endif
 
         SRAssert2(id <= 32768, "Buffer overflow!");
 
-        Hash hash = SR_HASH_STR(resourceId);
+        const Hash hash = key.hash;
 
         switch (memType) {
             case MeshMemoryType::VBO: {
@@ -26,7 +26,7 @@ namespace SR_GRAPH_NS::Memory {
                 const auto cpuUsage    = texture.TryGetAttribute("CPUUsage").ToBool(false);
 
                 m_configs.insert(std::make_pair(
-                        texture.GetAttribute("Path").ToString(),
+                        SR_HASH_STR(texture.GetAttribute("Path").ToString()),
                         TextureConfig(
                             format,
                             filter,
@@ -46,7 +46,7 @@ namespace SR_GRAPH_NS::Memory {
         return false;
     }
 
-    TextureConfig TextureConfigs::FindOrDefault(const std::string &path) {
+    TextureConfig TextureConfigs::FindOrDefault(std::string_view path) {
         SR_SCOPED_LOCK
 
         if (auto&& config = Find(path); config.has_value())
@@ -55,17 +55,21 @@ namespace SR_GRAPH_NS::Memory {
         return TextureConfig();
     }
 
-    std::optional<TextureConfig> TextureConfigs::Find(const std::string& path) {
+    std::optional<TextureConfig> TextureConfigs::Find(std::string_view path) {
+        return Find(static_cast<Hash>(SR_HASH_STR_VIEW(path)));
+    }
+
+    std::optional<TextureConfig> TextureConfigs::Find(Hash pathHash) {
         SR_SCOPED_LOCK
 
         if (!m_loaded) {
             Reload();
         }
 
-        if (m_configs.count(path) != 0) {
-            return m_configs.at(path);
+        if (auto&& pIt = m_configs.find(pathHash); pIt != m_configs.end()) {
+            return pIt->second;
         }
-        else
-            return std::optional<TextureConfig>();
+
+        return std::optional<TextureConfig>();
     }
 }
\ No newline at end of file
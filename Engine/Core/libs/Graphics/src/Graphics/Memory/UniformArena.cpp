@@ -0,0 +1,226 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Graphics/Memory/UniformArena.h>
+#include <Utils/Debug.h>
+
+namespace SR_GRAPH_NS::Memory {
+    bool UniformArenaAllocator::Init(uint64_t capacity, uint64_t alignment, uint32_t framesInFlight) {
+        if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+            SR_ERROR("UniformArenaAllocator::Init() : alignment must be a power of two! Alignment: {}", alignment);
+            return false;
+        }
+
+        if (framesInFlight == 0) {
+            SR_ERROR("UniformArenaAllocator::Init() : frames in flight count is zero!");
+            return false;
+        }
+
+        m_alignment = alignment;
+        m_capacity = capacity & ~(alignment - 1);
+
+        if (m_capacity == 0) {
+            SR_ERROR("UniformArenaAllocator::Init() : capacity is less than alignment! Capacity: {}", capacity);
+            return false;
+        }
+
+        m_frameEnds.assign(framesInFlight, 0);
+        m_frameRetained.assign(framesInFlight, InvalidOffset);
+
+        Reset();
+
+        return true;
+    }
+
+    void UniformArenaAllocator::Reset() {
+        m_head = 0;
+        m_tail = 0;
+        m_frameBegin = 0;
+        m_frame = 0;
+        m_frameActive = false;
+
+        std::fill(m_frameEnds.begin(), m_frameEnds.end(), 0);
+        std::fill(m_frameRetained.begin(), m_frameRetained.end(), InvalidOffset);
+        m_records.clear();
+
+        m_stats = Stats();
+        m_stats.capacity = m_capacity;
+    }
+
+    void UniformArenaAllocator::BeginFrame() {
+        SRAssert2(!m_frameActive, "UniformArenaAllocator::BeginFrame() : previous frame is not ended!");
+
+        m_frameActive = true;
+
+        /// слот текущего кадра последний раз занимал кадр frame - framesInFlight, его fence уже пройден,
+        /// а кадры завершаются по порядку, поэтому вся память до его конца свободна
+        const uint64_t slot = m_frame % m_frameEnds.size();
+        uint64_t tail = SR_MAX(m_tail, m_frameEnds[slot]);
+
+        /// записи, отпущенные в том кадре, больше никем не читаются
+        m_frameRetained[slot] = InvalidOffset;
+
+        for (auto&& retained : m_frameRetained) {
+            tail = SR_MIN(tail, retained);
+        }
+
+        for (auto&& [pOwner, record] : m_records) {
+            tail = SR_MIN(tail, record.begin);
+        }
+
+        m_tail = SR_MAX(m_tail, tail);
+
+        m_frameBegin = m_head;
+
+        m_stats.frameUsage = 0;
+        m_stats.allocations = 0;
+        m_stats.failedAllocations = 0;
+        m_stats.inFlightUsage = m_head - m_tail;
+    }
+
+    void UniformArenaAllocator::EndFrame() {
+        SRAssert2(m_frameActive, "UniformArenaAllocator::EndFrame() : frame is not begun!");
+
+        m_frameEnds[m_frame % m_frameEnds.size()] = m_head;
+        ++m_frame;
+
+        m_frameActive = false;
+    }
+
+    uint64_t UniformArenaAllocator::Allocate(uint64_t size) {
+        if (!m_frameActive) {
+            SRHalt("UniformArenaAllocator::Allocate() : allocation outside of frame!");
+            return InvalidOffset;
+        }
+
+        if (size == 0 || size > m_capacity) {
+            ++m_stats.failedAllocations;
+            return InvalidOffset;
+        }
+
+        uint64_t position = AlignUp(m_head);
+
+        /// блок не может пересекать конец буфера, переходим в начало следующего круга
+        if ((position % m_capacity) + size > m_capacity) {
+            position = (position / m_capacity + 1) * m_capacity;
+        }
+
+        if (position + size - m_tail > m_capacity) {
+            ++m_stats.failedAllocations;
+            return InvalidOffset;
+        }
+
+        m_head = position + size;
+
+        ++m_stats.allocations;
+        m_stats.frameUsage = m_head - m_frameBegin;
+        m_stats.peakFrameUsage = SR_MAX(m_stats.peakFrameUsage, m_stats.frameUsage);
+        m_stats.inFlightUsage = m_head - m_tail;
+
+        return position % m_capacity;
+    }
+
+    void UniformArenaAllocator::BeginRecord(const void* pOwner) {
+        if (m_frameEnds.empty()) {
+            SRHalt("UniformArenaAllocator::BeginRecord() : allocator is not initialized!");
+            return;
+        }
+
+        ReleaseRecord(pOwner);
+
+        auto&& record = m_records[pOwner];
+        record.begin = m_head;
+        record.id = ++m_recordsCount;
+    }
+
+    void UniformArenaAllocator::ReleaseRecord(const void* pOwner) {
+        auto&& pIt = m_records.find(pOwner);
+        if (pIt == m_records.end()) {
+            return;
+        }
+
+        /// старые команды владельца еще могут исполняться в кадрах до текущего включительно
+        auto&& retained = m_frameRetained[m_frame % m_frameRetained.size()];
+        retained = SR_MIN(retained, pIt->second.begin);
+
+        m_records.erase(pIt);
+    }
+
+    uint64_t UniformArenaAllocator::GetRecordId(const void* pOwner) const {
+        auto&& pIt = m_records.find(pOwner);
+        return pIt == m_records.end() ? 0 : pIt->second.id;
+    }
+
+    /// ----------------------------------------------------------------------------------------------------------------
+
+    bool UniformArenaCPUStorage::Init(uint64_t capacity) {
+        m_data.assign(capacity, 0);
+        return true;
+    }
+
+    void UniformArenaCPUStorage::DeInit() {
+        m_data.clear();
+        m_data.shrink_to_fit();
+    }
+
+    void UniformArenaCPUStorage::Write(uint64_t offset, const void* pData, uint64_t size) {
+        SRAssert(offset + size <= m_data.size());
+        memcpy(m_data.data() + offset, pData, size);
+    }
+
+    /// ----------------------------------------------------------------------------------------------------------------
+
+    UniformArena::UniformArena(std::unique_ptr<IUniformArenaStorage> pStorage)
+        : m_storage(std::move(pStorage))
+    { }
+
+    UniformArena::~UniformArena() {
+        DeInit();
+    }
+
+    bool UniformArena::Init(uint64_t capacity, uint64_t alignment, uint32_t framesInFlight) {
+        if (!m_storage) {
+            SR_ERROR("UniformArena::Init() : storage is nullptr!");
+            return false;
+        }
+
+        DeInit();
+
+        if (!m_allocator.Init(capacity, alignment, framesInFlight)) {
+            return false;
+        }
+
+        if (!m_storage->Init(m_allocator.GetCapacity())) {
+            SR_ERROR("UniformArena::Init() : failed to initialize storage!");
+            return false;
+        }
+
+        m_initialized = true;
+
+        return true;
+    }
+
+    void UniformArena::DeInit() {
+        if (m_initialized) {
+            m_storage->DeInit();
+            m_initialized = false;
+        }
+    }
+
+    uint64_t UniformArena::Push(const void* pData, uint64_t size) {
+        const uint64_t offset = m_allocator.Allocate(size);
+        if (offset == UniformArenaAllocator::InvalidOffset) {
+            return offset;
+        }
+
+        m_storage->Write(offset, pData, size);
+
+        return offset;
+    }
+
+    void UniformArena::Write(uint64_t offset, const void* pData, uint64_t size) {
+        SRAssert(m_initialized && offset + size <= m_allocator.GetCapacity());
+        m_storage->Write(offset, pData, size);
+    }
+}
@@ -6,6 +6,8 @@
 #include <Graphics/Render/RenderTechnique.h>
 #include <Graphics/Render/RenderContext.h>
 #include <Graphics/Render/RenderScene.h>
+#include <Graphics/Render/RenderGraph.h>
+#include <Graphics/Pass/IFramebufferPass.h>
 
 namespace SR_GRAPH_NS {
     RenderPassMap& GetRenderPassMap() {
@@ -45,6 +47,13 @@ namespace SR_GRAPH_NS {
         return m_technique->GetRenderScene();
     }
 
+    void BasePass::DeclareResources(RenderGraphPassBuilder& builder) const {
+        /// проход с собственным кадровым буфером пишет в него, другие проходы находят его по имени прохода
+        if (auto&& pFramebufferPass = dynamic_cast<const IFramebufferPass*>(this)) {
+            builder.Write(GetName(), pFramebufferPass->GetRenderGraphDesc());
+        }
+    }
+
     SR_UTILS_NS::StringAtom BasePass::GetName() const {
         return m_name;
     }
@@ -8,10 +8,22 @@ namespace SR_GRAPH_NS {
     SR_REGISTER_RENDER_PASS(CascadedShadowMapPass);
 
     bool CascadedShadowMapPass::Init() {
+        if (m_casterSet == ShadowCasterSet::Dynamic) {
+            m_staticPass = dynamic_cast<CascadedShadowMapPass*>(GetTechnique()->FindPass(m_staticPassName));
+
+            if (!m_staticPass || m_staticPass->m_casterSet != ShadowCasterSet::Static || m_staticPass->m_cascadesCount != m_cascadesCount) {
+                SR_ERROR("CascadedShadowMapPass::Init() : static cascades pass not found, all casters will be drawn!\n\tPass: {}",
+                    m_staticPassName.ToStringRef());
+                m_staticPass = nullptr;
+                m_casterSet = ShadowCasterSet::All;
+            }
+        }
+
         return Super::Init();
     }
 
     void CascadedShadowMapPass::DeInit() {
+        m_staticPass = nullptr;
         Super::DeInit();
     }
 
@@ -21,9 +33,32 @@ namespace SR_GRAPH_NS {
         m_usePerspective = passNode.TryGetAttribute("UsePerspective").ToBool(false);
         m_near = passNode.TryGetAttribute("Near").ToFloat(0.1f);
         m_far = passNode.TryGetAttribute("Far").ToFloat(100.f);
+        m_cullingMargin = passNode.TryGetAttribute("CullingMargin").ToFloat(0.1f);
+        m_settleFrames = passNode.TryGetAttribute("SettleFrames").ToUInt64(60);
+        m_casterSet = SR_UTILS_NS::EnumReflector::FromString<ShadowCasterSet>(passNode.TryGetAttribute("Casters").ToString("All"));
+        m_staticPassName = passNode.TryGetAttribute("StaticPass").ToString(std::string());
+
+        /// маска каскадов хранится в 32 битах
+        m_cascadesCount = SR_MIN(m_cascadesCount, 31u);
+
         return Super::Load(passNode);
     }
 
+    void CascadedShadowMapPass::DeclareResources(RenderGraphPassBuilder& builder) const {
+        /// кэш должен обновиться раньше: от него зависят и матрицы каскадов, и набор динамичных кастеров
+        if (m_casterSet == ShadowCasterSet::Dynamic && !m_staticPassName.Empty()) {
+            builder.Read(m_staticPassName);
+        }
+
+        Super::DeclareResources(builder);
+    }
+
+    void CascadedShadowMapPass::OnMeshRemoved(SR_GTYPES_NS::Mesh* pMesh, bool transparent) {
+        m_staticCasters.erase(pMesh);
+        m_dynamicCasters.erase(pMesh);
+        Super::OnMeshRemoved(pMesh, transparent);
+    }
+
     MeshClusterTypeFlag CascadedShadowMapPass::GetClusterType() const noexcept {
         return static_cast<uint64_t>(MeshClusterType::Opaque) | static_cast<uint64_t>(MeshClusterType::Transparent);
     }
@@ -41,10 +76,6 @@ namespace SR_GRAPH_NS {
 
         pMesh->UseModelMatrix();
 
-        if (CheckCamera()) {
-            UpdateCascades();
-        }
-
         pShader->SetValue<false>(SHADER_CASCADE_LIGHT_SPACE_MATRICES, m_cascadeMatrices.data());
 
         SR_MATH_NS::FVector3 lightPos = GetRenderScene()->GetLightSystem()->m_position;
@@ -52,100 +83,214 @@ namespace SR_GRAPH_NS {
     }
 
     void CascadedShadowMapPass::UpdateCascades() {
+        SR_TRACY_ZONE;
+
+        if (!m_camera) {
+            return;
+        }
+
         SR_MATH_NS::FVector3 lightPos = GetRenderScene()->GetLightSystem()->m_position;
 
-        std::vector<float_t> cascadeSplits;
-        cascadeSplits.resize(m_cascadesCount);
+        m_lightDirection = (-lightPos).Normalize();
+        m_lightRotation = GetShadowLightRotation(m_lightDirection);
+
+        const std::vector<float_t> cascadeSplits = CalculateCascadeSplits(m_near, m_far, m_cascadesCount, m_cascadeSplitLambda);
+
+        m_cascades.resize(m_cascadesCount);
+
+        const uint32_t resolution = m_framebuffer ? static_cast<uint32_t>(m_framebuffer->GetSize().x) : 0;
+
+        /// кэш рисуется с запасом, чтобы покрывать срез пирамиды, пока каскад не уйдет дальше m_cullingMargin
+        const float_t extentScale = m_casterSet == ShadowCasterSet::Static ? 1.f + m_cullingMargin : 1.f;
+
+        auto&& invCamera = (m_camera->GetProjectionRef() * m_camera->GetViewTranslateRef()).Inverse();
+
+        float_t lastSplitDist = 0.0;
+
+        for (uint32_t i = 0; i < m_cascadesCount; i++) {
+            m_cascades[i] = CalculateShadowCascade(invCamera, lastSplitDist, cascadeSplits[i], m_near, m_far, m_lightDirection, resolution, extentScale);
+            lastSplitDist = cascadeSplits[i];
+        }
+
+        /// кэш отдает шейдеру матрицы, которыми рисовались его слои, а не текущие
+        if (m_casterSet == ShadowCasterSet::All) {
+            UpdateCascadeMatrices(m_cascades);
+        }
+    }
 
+    void CascadedShadowMapPass::UpdateCascadeMatrices(const std::vector<ShadowCascade>& cascades) {
+        /// размер массивов в шейдере фиксирован
         m_cascadeMatrices.resize(4);
         m_cascadeSplitDepths.resize(4);
 
-        const float_t clipRange = m_far - m_near;
+        for (uint32_t i = 0; i < cascades.size() && i < m_cascadeMatrices.size(); ++i) {
+            m_cascadeSplitDepths[i] = cascades[i].splitDepth;
+
+            if (m_usePerspective && m_camera) {
+                /// TODO: not works
+                auto&& lightViewMatrix = SR_MATH_NS::Matrix4x4::LookAt(
+                    cascades[i].center - m_lightDirection * cascades[i].radius, cascades[i].center, SR_MATH_NS::FVector3(0.0f, 1.0f, 0.0f)
+                );
+                m_cascadeMatrices[i] = m_camera->GetProjectionRef() * lightViewMatrix;
+            }
+            else {
+                m_cascadeMatrices[i] = cascades[i].viewProjection;
+            }
+        }
+    }
 
-        const float_t minZ = m_near;
-        const float_t maxZ = m_near + clipRange;
+    bool CascadedShadowMapPass::IsMeshVisible(MeshPtr pMesh) {
+        if (m_casterSet == ShadowCasterSet::Dynamic) {
+            return m_staticPass->IsDynamicCaster(pMesh);
+        }
 
-        const float_t range = maxZ - minZ;
-        const float_t ratio = maxZ / minZ;
+        if (m_currentCascade >= m_culledCascades.size()) {
+            return true;
+        }
 
-        for (uint32_t i = 0; i < m_cascadesCount; i++) {
-            const float_t p = (i + 1) / static_cast<float_t>(m_cascadesCount);
-            const float_t log = minZ * std::pow(ratio, p);
-            const float_t uniform = minZ + range * p;
-            const float_t d = m_cascadeSplitLambda * (log - uniform) + uniform;
-            cascadeSplits[i] = (d - m_near) / clipRange;
+        if (m_dynamicCasters.count(pMesh) == 1) {
+            return m_casterSet == ShadowCasterSet::All;
         }
 
-        float_t lastSplitDist = 0.0;
+        auto&& caster = m_staticCasters[pMesh];
+        caster.matrixVersion = pMesh->GetMatrixVersion();
 
-        for (uint32_t i = 0; i < m_cascadesCount; i++) {
-            const float_t splitDist = cascadeSplits[i];
+        SR_MATH_NS::FVector3 center;
+        float_t radius = 0.f;
 
-            SR_MATH_NS::FVector3 frustumCorners[8] = {
-                SR_MATH_NS::FVector3(-1.0f,  1.0f, -1.0f),
-                SR_MATH_NS::FVector3( 1.0f,  1.0f, -1.0f),
-                SR_MATH_NS::FVector3( 1.0f, -1.0f, -1.0f),
-                SR_MATH_NS::FVector3(-1.0f, -1.0f, -1.0f),
-                SR_MATH_NS::FVector3(-1.0f,  1.0f,  1.0f),
-                SR_MATH_NS::FVector3( 1.0f,  1.0f,  1.0f),
-                SR_MATH_NS::FVector3( 1.0f, -1.0f,  1.0f),
-                SR_MATH_NS::FVector3(-1.0f, -1.0f,  1.0f),
-            };
+        auto&& cascade = m_culledCascades[m_currentCascade];
 
-            auto&& invCamera = (m_camera->GetProjectionRef() * m_camera->GetViewTranslateRef()).Inverse();
+        const bool visible = !pMesh->GetBoundingSphere(center, radius) ||
+            IsSphereInShadowCascade(cascade, m_lightRotation, center, radius, cascade.radius * m_cullingMargin);
 
-            for (uint32_t j = 0; j < 8; j++) {
-                SR_MATH_NS::FVector4 invCorner = invCamera * SR_MATH_NS::FVector4(frustumCorners[j], 1.0f);
-                frustumCorners[j] = (invCorner / invCorner.w).XYZ();
+        if (visible) {
+            caster.cascades |= 1u << m_currentCascade;
+        }
+
+        return visible;
+    }
+
+    uint32_t CascadedShadowMapPass::GetCascadesMask(MeshPtr pMesh) const {
+        SR_MATH_NS::FVector3 center;
+        float_t radius = 0.f;
+
+        if (!pMesh->GetBoundingSphere(center, radius)) {
+            return GetAllCascadesMask();
+        }
+
+        uint32_t cascades = 0;
+
+        for (uint32_t i = 0; i < m_culledCascades.size(); ++i) {
+            auto&& cascade = m_culledCascades[i];
+            if (IsSphereInShadowCascade(cascade, m_lightRotation, center, radius, cascade.radius * m_cullingMargin)) {
+                cascades |= 1u << i;
             }
+        }
 
-            for (uint32_t j = 0; j < 4; j++) {
-                SR_MATH_NS::FVector3 dist = frustumCorners[j + 4] - frustumCorners[j];
-                frustumCorners[j + 4] = frustumCorners[j] + (dist * splitDist);
-                frustumCorners[j] = frustumCorners[j] + (dist * lastSplitDist);
+        return cascades;
+    }
+
+    uint32_t CascadedShadowMapPass::UpdateCasters() {
+        uint32_t outdated = 0;
+
+        for (auto pIt = m_staticCasters.begin(); pIt != m_staticCasters.end(); ) {
+            auto&& [pMesh, caster] = *pIt;
+
+            if (pMesh->GetMatrixVersion() == caster.matrixVersion) {
+                ++pIt;
+                continue;
             }
 
-            SR_MATH_NS::FVector3 frustumCenter = SR_MATH_NS::FVector3(0.0f);
-            for (uint32_t j = 0; j < 8; j++) {
-                frustumCenter += frustumCorners[j];
+            DynamicCaster dynamicCaster;
+            dynamicCaster.matrixVersion = pMesh->GetMatrixVersion();
+            m_dynamicCasters[pMesh] = dynamicCaster;
+
+            /// старая тень остается только в тех слоях, куда кастер был записан
+            outdated |= caster.cascades;
+            ++m_castersVersion;
+
+            pIt = m_staticCasters.erase(pIt);
+        }
+
+        for (auto pIt = m_dynamicCasters.begin(); pIt != m_dynamicCasters.end(); ) {
+            auto&& [pMesh, caster] = *pIt;
+
+            if (pMesh->GetMatrixVersion() != caster.matrixVersion) {
+                caster.matrixVersion = pMesh->GetMatrixVersion();
+                caster.stillFrames = 0;
+                ++pIt;
+                continue;
             }
-            frustumCenter /= 8.0f;
 
-            float_t radius = 0.0f;
-            for (uint32_t j = 0; j < 8; j++) {
-                float_t distance = (frustumCorners[j] - frustumCenter).Length();
-                radius = SR_MAX(radius, distance);
+            /// остановился - перезаписываем один раз, чтобы он снова отсекался по каскадам
+            if (++caster.stillFrames >= m_settleFrames) {
+                outdated |= m_casterSet == ShadowCasterSet::Static ? GetCascadesMask(pMesh) : GetAllCascadesMask();
+                ++m_castersVersion;
+                pIt = m_dynamicCasters.erase(pIt);
+                continue;
             }
-            radius = std::ceil(radius * 16.0f) / 16.0f;
 
-            SR_MATH_NS::FVector3 maxExtents = SR_MATH_NS::FVector3(radius);
-            SR_MATH_NS::FVector3 minExtents = -maxExtents;
+            ++pIt;
+        }
+
+        return outdated;
+    }
 
-            SR_MATH_NS::FVector3 lightDir = (-lightPos).Normalize();
+    uint32_t CascadedShadowMapPass::GetOutdatedCascades() {
+        /// кастеры считаются каждый кадр, иначе кадры без движения не дойдут до m_settleFrames
+        uint32_t outdated = UpdateCasters();
 
-            SR_MATH_NS::Matrix4x4 lightViewMatrix = SR_MATH_NS::Matrix4x4::LookAt(frustumCenter - lightDir * -minExtents.z, frustumCenter, SR_MATH_NS::FVector3(0.0f, 1.0f, 0.0f));
+        if (m_culledCascades.size() != m_cascades.size() || m_culledLightDirection != m_lightDirection) {
+            return GetAllCascadesMask();
+        }
 
-            m_cascadeSplitDepths[i] = (m_near + splitDist * clipRange) * -1.0f;
+        const uint32_t resolution = m_framebuffer ? static_cast<uint32_t>(m_framebuffer->GetSize().x) : 0;
 
-            if (m_usePerspective) {
-                /// TODO: not works
-                m_cascadeMatrices[i] = m_camera->GetProjectionRef() * lightViewMatrix;
+        /// центры каскадов двигаются шагами в тексель, пока сдвиг в пределах запаса - записанный набор кастеров верен,
+        /// а кэш статики еще и должен целиком покрывать новый срез пирамиды
+        for (uint32_t i = 0; i < m_cascades.size(); ++i) {
+            auto&& cascade = m_cascades[i];
+            auto&& culled = m_culledCascades[i];
+
+            if (cascade.radius != culled.radius || cascade.center.Distance(culled.center) > culled.radius * m_cullingMargin) {
+                outdated |= 1u << i;
             }
-            else {
-                auto&& lightOrthoMatrix = SR_MATH_NS::Matrix4x4::Ortho(minExtents.x, maxExtents.x, minExtents.y, maxExtents.y, 0.0f, maxExtents.z - minExtents.z);
-                m_cascadeMatrices[i] = lightOrthoMatrix * lightViewMatrix;
+            else if (m_casterSet == ShadowCasterSet::Static && !IsShadowCascadeCovered(culled, cascade, m_lightRotation, resolution)) {
+                outdated |= 1u << i;
             }
+        }
 
-            lastSplitDist = cascadeSplits[i];
+        /// без кэша буфер команд рисует все слои каждый кадр, частично его не перезаписать
+        if (outdated != 0 && m_casterSet == ShadowCasterSet::All) {
+            return GetAllCascadesMask();
         }
+
+        return outdated;
     }
 
-    bool CascadedShadowMapPass::Render() {
-        if (m_cascadesCount == 0 || IsDirectional() || !m_framebuffer) {
-            return false;
-        }
+    void CascadedShadowMapPass::RecordCascades(uint32_t cascades) {
+        SR_TRACY_ZONE;
+
+        if (m_casterSet != ShadowCasterSet::Dynamic) {
+            m_culledCascades.resize(m_cascades.size());
+
+            for (uint32_t i = 0; i < m_cascades.size(); ++i) {
+                if (cascades & (1u << i)) {
+                    m_culledCascades[i] = m_cascades[i];
+                }
+            }
+
+            m_culledLightDirection = m_lightDirection;
 
-        bool rendered = false;
+            /// маски перерисованных слоев заполнит IsMeshVisible
+            for (auto&& [pMesh, caster] : m_staticCasters) {
+                caster.cascades &= ~cascades;
+            }
+
+            if (m_casterSet == ShadowCasterSet::Static) {
+                UpdateCascadeMatrices(m_culledCascades);
+            }
+        }
 
         m_framebuffer->Update();
         /// установим кадровый буфер, чтобы BeginCmdBuffer понимал какие значение для очистки ставить
@@ -154,7 +299,19 @@ namespace SR_GRAPH_NS {
         m_framebuffer->BeginCmdBuffer(m_clearColors, m_depth);
         m_framebuffer->SetViewportScissor();
 
+        /// одна запись в кольце юниформ на все слои: UBO меша общий, слой задает только константа каскада
+        if (cascades != 0) {
+            GetPipeline()->BeginUniformArenaRecord(this);
+        }
+        else {
+            GetPipeline()->ReleaseUniformArenaRecord(this);
+        }
+
         for (uint32_t i = 0; i < m_cascadesCount; ++i) {
+            if (!(cascades & (1u << i))) {
+                continue;
+            }
+
             m_currentCascade = i;
             GetPipeline()->SetFrameBufferLayer(i);
 
@@ -168,17 +325,86 @@ namespace SR_GRAPH_NS {
             }
 
             m_uboManager.SetIdentifier(pIdentifier);
+        }
 
-            rendered |= IsDirectional();
+        if (cascades != 0) {
+            GetPipeline()->EndUniformArenaRecord();
         }
 
         m_framebuffer->EndCmdBuffer();
 
-        return rendered;
+        m_recordedCascades = cascades;
+        m_recordedCastersVersion = m_staticPass ? m_staticPass->GetCastersVersion() : m_castersVersion;
+    }
+
+    bool CascadedShadowMapPass::Render() {
+        if (m_cascadesCount == 0 || IsDirectional() || !m_framebuffer) {
+            return false;
+        }
+
+        if (m_casterSet == ShadowCasterSet::Dynamic) {
+            m_cascadeMatrices = m_staticPass->GetCascadeMatrices();
+            m_cascadeSplitDepths = m_staticPass->GetSplitDepths();
+        }
+        else if (CheckCamera() || m_cascades.empty()) {
+            UpdateCascades();
+        }
+
+        /// полная пересборка: кадровый буфер мог пересоздаться, кэш рисуется заново целиком
+        if (m_casterSet == ShadowCasterSet::Static) {
+            m_staticCasters.clear();
+        }
+
+        RecordCascades(GetAllCascadesMask());
+        m_recordedInBuild = true;
+
+        return false;
     }
 
     void CascadedShadowMapPass::Update() {
+        if (m_cascadesCount == 0 || IsDirectional() || !m_framebuffer) {
+            return;
+        }
+
+        /// записанное при сборке в этом кадре еще ни разу не исполнялось, его слои нельзя терять
+        const bool recordedInBuild = SR_UTILS_NS::Exchange(m_recordedInBuild, false);
+
+        if (m_casterSet == ShadowCasterSet::Dynamic) {
+            m_cascadeMatrices = m_staticPass->GetCascadeMatrices();
+            m_cascadeSplitDepths = m_staticPass->GetSplitDepths();
+
+            /// набор динамичных кастеров ведет кэш
+            if (m_recordedCascades != 0 && m_recordedCastersVersion != m_staticPass->GetCastersVersion()) {
+                SR_TRACY_ZONE_N("Re-record dynamic cascades");
+                RecordCascades(GetAllCascadesMask());
+            }
+        }
+        else {
+            if (CheckCamera() || m_cascades.empty()) {
+                UpdateCascades();
+            }
+
+            /// буфер команд у прохода свой, поэтому перезаписываем только его, а не всю сцену
+            if (!m_culledCascades.empty()) {
+                const uint32_t outdated = GetOutdatedCascades();
+
+                if (outdated != 0) {
+                    SR_TRACY_ZONE_N("Re-record cascades");
+                    RecordCascades(recordedInBuild ? GetAllCascadesMask() : outdated);
+                }
+                /// кэш уже нарисован, следующие кадры исполняют буфер без рендер-проходов
+                else if (m_casterSet == ShadowCasterSet::Static && m_recordedCascades != 0 && !recordedInBuild) {
+                    RecordCascades(0);
+                    return;
+                }
+            }
+        }
+
         for (uint32_t i = 0; i < m_cascadesCount; ++i) {
+            if (!(m_recordedCascades & (1u << i))) {
+                continue;
+            }
+
             m_currentCascade = i;
             GetPipeline()->SetFrameBufferLayer(i);
             Super::Update();
@@ -216,4 +442,4 @@ namespace SR_GRAPH_NS {
 
         return true;
     }
-}
\ No newline at end of file
+}
@@ -85,6 +85,12 @@ namespace SR_GRAPH_NS {
         GroupPass::Update();
 
         m_pipeline->SetCurrentFrameBuffer(nullptr);
+
+        /// перезаписываем только свой буфер команд, остальная сцена остается как была
+        if (GroupPass::IsRecordOutdated()) {
+            SR_TRACY_ZONE_N("Re-record framebuffer");
+            Render();
+        }
     }
 
     std::vector<SR_GTYPES_NS::Framebuffer*> FramebufferPass::GetFrameBuffers() const {
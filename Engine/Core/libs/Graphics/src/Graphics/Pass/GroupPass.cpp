@@ -99,6 +99,16 @@ namespace SR_GRAPH_NS {
         BasePass::Update();
     }
 
+    bool GroupPass::IsRecordOutdated() const {
+        for (auto&& pPass : m_passes) {
+            if (pPass->IsRecordOutdated()) {
+                return true;
+            }
+        }
+
+        return BasePass::IsRecordOutdated();
+    }
+
     bool GroupPass::Overlay() {
         bool hasDrawData = false;
         for (auto&& pPass : m_passes) {
@@ -180,4 +190,12 @@ namespace SR_GRAPH_NS {
         }
         BasePass::SetRenderTechnique(pRenderTechnique);
     }
+
+    void GroupPass::DeclareResources(RenderGraphPassBuilder& builder) const {
+        BasePass::DeclareResources(builder);
+
+        for (auto&& pPass : m_passes) {
+            pPass->DeclareResources(builder);
+        }
+    }
 }
\ No newline at end of file
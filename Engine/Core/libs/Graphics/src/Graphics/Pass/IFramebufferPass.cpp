@@ -6,6 +6,8 @@
 #include <Graphics/Render/RenderContext.h>
 #include <Graphics/Types/Framebuffer.h>
 
+#include <Utils/Common/Hashes.h>
+
 namespace SR_GRAPH_NS {
     IFramebufferPass::~IFramebufferPass() {
         if (m_framebuffer) {
@@ -23,6 +25,7 @@ namespace SR_GRAPH_NS {
         m_depthEnabled = settingsNode.TryGetAttribute("DepthEnabled").ToBool(true);
         m_samples = settingsNode.TryGetAttribute("SmoothSamples").ToUInt(0);
         m_layersCount = settingsNode.TryGetAttribute("Layers").ToUInt(1);
+        m_transient = settingsNode.TryGetAttribute("Transient").ToBool(false);
 
         m_depthAspect = ImageAspect::DepthStencil;
 
@@ -65,6 +68,31 @@ namespace SR_GRAPH_NS {
         }
     }
 
+    RenderGraphResourceDesc IFramebufferPass::GetRenderGraphDesc() const {
+        RenderGraphResourceDesc desc;
+
+        desc.width = static_cast<uint32_t>(SR_MAX(m_size.x, 0));
+        desc.height = static_cast<uint32_t>(SR_MAX(m_size.y, 0));
+        desc.layers = m_layersCount;
+        desc.samples = m_samples;
+        desc.transient = m_transient;
+
+        /// масштаб входит в ключ совместимости наравне с форматами, размер 0 означает размер окна
+        uint64_t format = SR_COMBINE_HASHES(SR_HASH(m_preScale.x), SR_HASH(m_preScale.y));
+
+        for (auto&& colorFormat : m_colorFormats) {
+            format = SR_COMBINE_HASHES(format, static_cast<uint64_t>(colorFormat));
+        }
+
+        if (m_depthEnabled) {
+            format = SR_COMBINE_HASHES(format, static_cast<uint64_t>(m_depthFormat) + 1);
+        }
+
+        desc.format = format;
+
+        return desc;
+    }
+
     bool IFramebufferPass::InitializeFramebuffer(RenderContext* pContext) {
         /// fix zero size
         if (m_size.x == 0) {
@@ -12,6 +12,15 @@ namespace SR_GRAPH_NS {
         return Super::Init();
     }
 
+    void IMesh3DClusterPass::DeInit() {
+        /// память юниформ прохода вернется в кольцо, когда буферы команд с ней выйдут из полета
+        if (m_pipeline) {
+            m_pipeline->ReleaseUniformArenaRecord(this);
+        }
+
+        Super::DeInit();
+    }
+
     void IMesh3DClusterPass::MarkDirtyCluster(MeshCluster& meshCluster) {
         SR_TRACY_ZONE;
 
@@ -24,11 +33,39 @@ namespace SR_GRAPH_NS {
         }
     }
 
-    bool IMesh3DClusterPass::RenderCluster(MeshCluster& meshCluster) {
+    void IMesh3DClusterPass::BuildDrawList() {
         SR_TRACY_ZONE;
 
-        if (meshCluster.Empty()) {
-            return false;
+        m_drawList.Clear();
+
+        if (GetClusterType() & MeshClusterType::Opaque) {
+            CollectCluster(GetRenderScene()->GetOpaque(), DrawSortKey::PassOpaque, false);
+        }
+
+        if (GetClusterType() & MeshClusterType::Transparent) {
+            CollectCluster(GetRenderScene()->GetTransparent(), DrawSortKey::PassTransparent, true);
+        }
+
+        if (GetClusterType() & MeshClusterType::Debug) {
+            CollectCluster(GetRenderScene()->GetDebugCluster(), DrawSortKey::PassDebug, false);
+        }
+
+        m_drawList.Sort();
+    }
+
+    void IMesh3DClusterPass::CollectCluster(MeshCluster& meshCluster, uint64_t drawPass, bool transparent) {
+        SR_TRACY_ZONE;
+
+        SR_MATH_NS::FVector3 viewPosition;
+        SR_MATH_NS::FVector3 viewDirection;
+        float_t near = 0.f;
+        float_t far = 0.f;
+
+        if (m_camera) {
+            viewPosition = m_camera->GetPositionRef();
+            viewDirection = m_camera->GetViewDirection();
+            near = m_camera->GetNear();
+            far = m_camera->GetFar();
         }
 
         for (auto&& [pClusterShader, subCluster] : meshCluster) {
@@ -41,34 +78,113 @@ namespace SR_GRAPH_NS {
                 continue;
             }
 
-            /// Если нет ни одного активного меша, то нет смысла идти дальше
-            for (auto&& [key, meshGroup] : subCluster) {
+            const uint64_t shaderIndex = m_drawList.GetShaderIndex(pShader);
+
+            for (auto&& [VBO, meshGroup] : subCluster) {
                 for (auto&& pMesh : meshGroup) {
-                    if (pMesh->IsMeshActive()) {
-                        goto goDraw;
+                    if (!pMesh->IsMeshActive() || !IsMeshVisible(pMesh)) {
+                        continue;
                     }
+
+                    const float_t depth = (pMesh->GetTranslation() - viewPosition).Dot(viewDirection);
+
+                    const uint64_t layer = static_cast<uint64_t>(SR_CLAMP(pMesh->GetSortingPriority(), static_cast<int64_t>(DrawSortKey::MaxLayer), 0));
+                    const uint64_t materialIndex = m_drawList.GetMaterialIndex(pMesh->GetMaterial());
+                    const uint64_t depthKey = DrawSortKey::QuantizeDepth(depth, near, far);
+
+                    const uint64_t key = transparent
+                        ? DrawSortKey::Transparent(layer, drawPass, shaderIndex, materialIndex, depthKey)
+                        : DrawSortKey::Opaque(layer, drawPass, shaderIndex, materialIndex, depthKey);
+
+                    DrawList::Draw draw;
+                    draw.pShader = pShader;
+                    draw.pMesh = pMesh;
+                    draw.VBO = static_cast<int32_t>(VBO);
+
+                    m_drawList.Add(key, draw);
                 }
             }
+        }
+    }
 
-            continue;
+    bool IMesh3DClusterPass::RenderDrawList() {
+        SR_TRACY_ZONE;
 
-        goDraw:
-            if (pShader->Use() == ShaderBindResult::Failed) {
-                continue;
+        /// проход на несколько слоев держит одну запись на все слои
+        const bool ownArenaRecord = !m_pipeline->IsUniformArenaRecording();
+
+        if (m_drawList.Empty()) {
+            if (ownArenaRecord) {
+                m_pipeline->ReleaseUniformArenaRecord(this);
             }
+            return false;
+        }
 
-            UseSamplers(pShader);
-            UseConstants(pShader);
+        ShaderPtr pCurrentShader = nullptr;
+        bool shaderBound = false;
+        int32_t currentVBO = SR_ID_INVALID;
 
-            for (auto&& [key, meshGroup] : subCluster) {
-                (*meshGroup.begin())->BindMesh();
+        /// меши, UBOManager и дескрипторы не потокобезопасны, поэтому обход идет на потоке отрисовки,
+        /// но команды конвейера только захватываются, а в списки заданий их переписывает ParallelCommandRecorder
+        m_drawCapture.Clear();
+        m_pipeline->SetCaptureCommandList(&m_drawCapture.GetCommandList());
 
-                for (auto&& pMesh : meshGroup) {
-                    pMesh->Draw();
+        /// юниформы мешей обновляются каждый кадр в UpdateCluster, поэтому их UBO живут в кольце юниформ.
+        /// Выделенные здесь UBO не получают своих буферов, а место в кольце им дает DrawIndices при исполнении
+        if (ownArenaRecord) {
+            m_pipeline->BeginUniformArenaRecord(this);
+        }
+
+        /// ключи отсортированы по состоянию, поэтому шейдер и буферы меняются только на границах групп
+        for (auto&& item : m_drawList.GetItems()) {
+            auto&& draw = m_drawList.GetDraw(item);
+
+            m_drawCapture.BeginDraw();
+
+            if (draw.pShader != pCurrentShader) {
+                if (shaderBound) {
+                    pCurrentShader->UnUse();
                 }
+
+                pCurrentShader = draw.pShader;
+                currentVBO = SR_ID_INVALID;
+
+                shaderBound = pCurrentShader->Use() != ShaderBindResult::Failed;
+                if (shaderBound) {
+                    UseSamplers(pCurrentShader);
+                    UseConstants(pCurrentShader);
+                }
+            }
+
+            if (!shaderBound) {
+                continue;
             }
 
-            pShader->UnUse();
+            if (draw.VBO != currentVBO || currentVBO == SR_ID_INVALID) {
+                draw.pMesh->BindMesh();
+                currentVBO = draw.VBO;
+            }
+
+            draw.pMesh->Draw();
+        }
+
+        if (shaderBound) {
+            pCurrentShader->UnUse();
+        }
+
+        m_pipeline->SetCaptureCommandList(nullptr);
+
+        auto&& recorder = GetContext()->GetCommandRecorder();
+
+        recorder.Begin();
+        m_drawCapture.AddJobs(recorder, 256, 16);
+        recorder.Record();
+
+        /// Vulkan пишет каждое задание во вторичный буфер на рабочих потоках и исполняет их в порядке заданий
+        m_pipeline->ExecuteCommandLists(recorder);
+
+        if (ownArenaRecord) {
+            m_pipeline->EndUniformArenaRecord();
         }
 
         return true;
@@ -124,21 +240,12 @@ namespace SR_GRAPH_NS {
             return false;
         }
 
-        bool rendered = false;
+        BuildDrawList();
 
-        if (GetClusterType() & MeshClusterType::Opaque) {
-            rendered |= RenderCluster(GetRenderScene()->GetOpaque());
-        }
+        m_transparentOrderHash = m_drawList.GetOrderHash(DrawSortKey::PassTransparent);
+        m_isTransparentOrderOutdated = false;
 
-        if (GetClusterType() & MeshClusterType::Transparent) {
-            rendered |= RenderCluster(GetRenderScene()->GetTransparent());
-        }
-
-        if (GetClusterType() & MeshClusterType::Debug) {
-            rendered |= RenderCluster(GetRenderScene()->GetDebugCluster());
-        }
-
-        return rendered;
+        return RenderDrawList();
     }
 
     void IMesh3DClusterPass::Update() {
@@ -156,6 +263,14 @@ namespace SR_GRAPH_NS {
             UpdateCluster(GetRenderScene()->GetDebugCluster());
         }
 
+        /// команды записываются только при перестроении сцены, а порядок смешивания зависит от камеры.
+        /// При смене порядка прозрачных мешей кадровый буфер прохода перезапишет только свои команды
+        if ((GetClusterType() & MeshClusterType::Transparent) && IsBlendOrderDependent()) {
+            BuildDrawList();
+
+            m_isTransparentOrderOutdated = m_drawList.GetOrderHash(DrawSortKey::PassTransparent) != m_transparentOrderHash;
+        }
+
         Super::Update();
     }
 
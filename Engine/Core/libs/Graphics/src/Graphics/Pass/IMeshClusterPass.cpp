@@ -6,6 +6,7 @@
 
 #include <Graphics/Pass/ShadowMapPass.h>
 #include <Graphics/Pass/CascadedShadowMapPass.h>
+#include <Graphics/Render/RenderGraph.h>
 
 namespace SR_GRAPH_NS {
     bool IMeshClusterPass::Render() {
@@ -94,6 +95,16 @@ namespace SR_GRAPH_NS {
         Super::OnSamplesChanged();
     }
 
+    void IMeshClusterPass::DeclareResources(RenderGraphPassBuilder& builder) const {
+        for (auto&& sampler : m_samplers) {
+            if (!sampler.fboName.Empty()) {
+                builder.Read(sampler.fboName);
+            }
+        }
+
+        Super::DeclareResources(builder);
+    }
+
     void IMeshClusterPass::PrepareSamplers() {
         if (!m_dirtySamplers) {
             return;
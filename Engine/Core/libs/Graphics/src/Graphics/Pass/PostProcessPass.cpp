@@ -5,6 +5,9 @@
 #include <Graphics/Pass/PostProcessPass.h>
 #include <Graphics/Pass/FramebufferPass.h>
 #include <Graphics/Types/Texture.h>
+#include <Graphics/Render/RenderGraph.h>
+#include <Graphics/Render/RenderScene.h>
+#include <Graphics/Lighting/LightSystem.h>
 
 namespace SR_GRAPH_NS {
     SR_REGISTER_RENDER_PASS(PostProcessPass)
@@ -98,6 +101,17 @@ namespace SR_GRAPH_NS {
             m_shader->SetMat4(SHADER_VIEW_NO_TRANSLATE_MATRIX, m_camera->GetViewRef());
         }
 
+        if (m_shader) {
+            /// кластеры собраны по главной камере сцены в RenderScene::Update,
+            /// поля без использования в шейдере в блоке отсутствуют и просто пропускаются
+            auto&& clusters = GetRenderScene()->GetLightSystem()->GetClusterShaderData();
+            m_shader->SetValue<false>(SHADER_LIGHT_CLUSTER_PARAMS, &clusters.params);
+            m_shader->SetValue<false>(SHADER_LIGHT_CLUSTER_SIZE, clusters.size.data());
+            m_shader->SetValue<false>(SHADER_LIGHT_CLUSTER_RANGES, clusters.ranges.data());
+            m_shader->SetValue<false>(SHADER_LIGHT_CLUSTER_INDICES, clusters.indices.data());
+            m_shader->SetValue<false>(SHADER_CLUSTER_LIGHTS, clusters.lights.data());
+        }
+
         if (m_uboManager.BindUBO(m_virtualUBO) == Memory::UBOManager::BindResult::Duplicated) {
             SR_ERROR("PostProcessPass::Update() : memory has been duplicated!");
         }
@@ -140,6 +154,14 @@ namespace SR_GRAPH_NS {
         return Super::Load(passNode);
     }
 
+    void PostProcessPass::DeclareResources(RenderGraphPassBuilder& builder) const {
+        for (auto&& attachment : m_attachments) {
+            builder.Read(attachment.fboName);
+        }
+
+        Super::DeclareResources(builder);
+    }
+
     void PostProcessPass::SetShader(SR_GTYPES_NS::Shader* pShader) {
         if (m_shader == pShader) {
             return;
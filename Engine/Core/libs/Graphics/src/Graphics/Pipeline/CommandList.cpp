@@ -0,0 +1,310 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Graphics/Pipeline/CommandList.h>
+
+#include <Utils/Profile/TracyContext.h>
+
+namespace SR_GRAPH_NS {
+    void CommandList::Clear() {
+        m_commands.clear();
+        m_data.clear();
+        m_drawCalls = 0;
+    }
+
+    void CommandList::PushConstants(void* pData, uint64_t size) {
+        const auto offset = static_cast<uint32_t>(m_data.size());
+
+        m_data.resize(m_data.size() + size);
+        std::memcpy(m_data.data() + offset, pData, size);
+
+        Push(RecordedCommandType::PushConstants, offset, static_cast<uint32_t>(size));
+    }
+
+    void CommandList::SetViewport(int32_t width, int32_t height) {
+        Push(RecordedCommandType::SetViewport, static_cast<uint32_t>(width), static_cast<uint32_t>(height));
+    }
+
+    void CommandList::SetScissor(int32_t width, int32_t height) {
+        Push(RecordedCommandType::SetScissor, static_cast<uint32_t>(width), static_cast<uint32_t>(height));
+    }
+
+    void CommandList::Append(const CommandList& other) {
+        const auto dataOffset = static_cast<uint32_t>(m_data.size());
+
+        m_commands.reserve(m_commands.size() + other.m_commands.size());
+
+        for (auto command : other.m_commands) {
+            if (command.type == RecordedCommandType::PushConstants) {
+                command.first += dataOffset;
+            }
+            m_commands.emplace_back(command);
+        }
+
+        m_data.insert(m_data.end(), other.m_data.begin(), other.m_data.end());
+        m_drawCalls += other.m_drawCalls;
+    }
+
+    void CommandList::Append(const CommandList& other, const RecordedCommand& command) {
+        if (command.type == RecordedCommandType::PushConstants) {
+            PushConstants(const_cast<char*>(other.m_data.data()) + command.first, command.second);
+            return;
+        }
+
+        if (command.type == RecordedCommandType::Draw || command.type == RecordedCommandType::DrawIndices) {
+            ++m_drawCalls;
+        }
+
+        m_commands.emplace_back(command);
+    }
+
+    ParallelCommandRecorder::ParallelCommandRecorder(uint32_t workers) {
+        m_workers.reserve(workers);
+
+        for (uint32_t i = 0; i < workers; ++i) {
+            m_workers.emplace_back([this]() {
+                WorkerLoop();
+            });
+        }
+    }
+
+    ParallelCommandRecorder::~ParallelCommandRecorder() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+
+        m_startCondition.notify_all();
+
+        for (auto&& worker : m_workers) {
+            worker.join();
+        }
+    }
+
+    void ParallelCommandRecorder::Begin() {
+        m_jobs.clear();
+        m_jobsCount = 0;
+    }
+
+    uint32_t ParallelCommandRecorder::AddJob(RecordFn function) {
+        m_jobs.emplace_back(std::move(function));
+
+        if (m_lists.size() < m_jobs.size()) {
+            m_lists.resize(m_jobs.size());
+        }
+
+        m_lists[m_jobsCount].Clear();
+
+        return m_jobsCount++;
+    }
+
+    void ParallelCommandRecorder::Record() {
+        SR_TRACY_ZONE;
+
+        if (m_jobsCount == 0) {
+            return;
+        }
+
+        m_nextJob = 0;
+
+        /// одно задание нет смысла отдавать рабочим потокам
+        if (m_workers.empty() || m_jobsCount == 1) {
+            ExecuteJobs();
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_activeWorkers = static_cast<uint32_t>(m_workers.size());
+            ++m_generation;
+        }
+
+        m_startCondition.notify_all();
+
+        ExecuteJobs();
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_doneCondition.wait(lock, [this]() {
+            return m_activeWorkers == 0;
+        });
+    }
+
+    void ParallelCommandRecorder::ExecuteJobs() {
+        /// задания разбираются по одному, каждое пишет только в свой список
+        for (uint32_t job = m_nextJob++; job < m_jobsCount; job = m_nextJob++) {
+            m_jobs[job](m_lists[job]);
+        }
+    }
+
+    void ParallelCommandRecorder::WorkerLoop() {
+        uint64_t generation = 0;
+
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_startCondition.wait(lock, [this, generation]() {
+                    return m_stop || m_generation != generation;
+                });
+
+                if (m_stop) {
+                    return;
+                }
+
+                generation = m_generation;
+            }
+
+            ExecuteJobs();
+
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                --m_activeWorkers;
+            }
+
+            m_doneCondition.notify_one();
+        }
+    }
+
+    std::vector<ParallelCommandRecorder::Range> ParallelCommandRecorder::Split(uint32_t count, uint32_t minChunk, uint32_t maxChunks) {
+        std::vector<Range> ranges;
+
+        if (count == 0) {
+            return ranges;
+        }
+
+        const uint32_t chunks = SR_CLAMP(count / SR_MAX(minChunk, 1u), SR_MAX(maxChunks, 1u), 1u);
+
+        ranges.reserve(chunks);
+
+        /// остаток раздается первым диапазонам по одному, чтобы размеры отличались не больше чем на 1
+        const uint32_t base = count / chunks;
+        const uint32_t remainder = count % chunks;
+
+        uint32_t offset = 0;
+        for (uint32_t i = 0; i < chunks; ++i) {
+            const uint32_t size = base + (i < remainder ? 1 : 0);
+            ranges.emplace_back(Range { offset, size });
+            offset += size;
+        }
+
+        return ranges;
+    }
+
+    void DrawCapture::Clear() {
+        m_commandList.Clear();
+        m_draws.clear();
+        m_state = BoundState();
+        m_trackedCommands = 0;
+    }
+
+    void DrawCapture::BeginDraw() {
+        auto&& commands = m_commandList.GetCommands();
+
+        for (; m_trackedCommands < commands.size(); ++m_trackedCommands) {
+            Track(m_state, commands[m_trackedCommands], m_trackedCommands);
+        }
+
+        m_draws.emplace_back(DrawSegment { m_trackedCommands, m_state });
+    }
+
+    void DrawCapture::Track(BoundState& state, const RecordedCommand& command, uint32_t index) {
+        switch (command.type) {
+            case RecordedCommandType::UseShader:
+                state.shaderProgram = command.first;
+                state.pushConstants = InvalidId;
+                break;
+            case RecordedCommandType::UnUseShader:
+                state.shaderProgram = InvalidId;
+                state.pushConstants = InvalidId;
+                break;
+            case RecordedCommandType::BindVBO: state.VBO = command.first; break;
+            case RecordedCommandType::BindIBO: state.IBO = command.first; break;
+            case RecordedCommandType::BindUBO: state.UBO = command.first; break;
+            case RecordedCommandType::BindDescriptorSet: state.descriptorSet = command.first; break;
+            case RecordedCommandType::PushConstants: state.pushConstants = index; break;
+            default:
+                break;
+        }
+    }
+
+    void DrawCapture::Emit(uint32_t offset, uint32_t count, CommandList& commandList) const {
+        if (count == 0 || offset + count > m_draws.size()) {
+            SRAssert2(count == 0, "Invalid draws range!");
+            return;
+        }
+
+        auto&& commands = m_commandList.GetCommands();
+        auto&& start = m_draws[offset].state;
+
+        const uint32_t begin = m_draws[offset].command;
+        const uint32_t end = offset + count == m_draws.size() ? static_cast<uint32_t>(commands.size()) : m_draws[offset + count].command;
+
+        BoundState bound;
+
+        /// диапазон не полагается на команды предыдущих диапазонов
+        if (start.shaderProgram != InvalidId) {
+            commandList.UseShader(start.shaderProgram);
+            bound.shaderProgram = start.shaderProgram;
+
+            if (start.pushConstants != InvalidId) {
+                commandList.Append(m_commandList, commands[start.pushConstants]);
+            }
+        }
+
+        if (start.VBO != InvalidId) {
+            commandList.BindVBO(start.VBO);
+            bound.VBO = start.VBO;
+        }
+
+        if (start.IBO != InvalidId) {
+            commandList.BindIBO(start.IBO);
+            bound.IBO = start.IBO;
+        }
+
+        if (start.descriptorSet != InvalidId) {
+            commandList.BindDescriptorSet(start.descriptorSet);
+            bound.descriptorSet = start.descriptorSet;
+        }
+
+        if (start.UBO != InvalidId) {
+            commandList.BindUBO(start.UBO);
+            bound.UBO = start.UBO;
+        }
+
+        for (uint32_t i = begin; i < end; ++i) {
+            auto&& command = commands[i];
+
+            uint32_t* pBound = nullptr;
+
+            switch (command.type) {
+                case RecordedCommandType::UseShader: pBound = &bound.shaderProgram; break;
+                case RecordedCommandType::BindVBO: pBound = &bound.VBO; break;
+                case RecordedCommandType::BindIBO: pBound = &bound.IBO; break;
+                case RecordedCommandType::BindUBO: pBound = &bound.UBO; break;
+                case RecordedCommandType::BindDescriptorSet: pBound = &bound.descriptorSet; break;
+                case RecordedCommandType::UnUseShader:
+                    bound.shaderProgram = InvalidId;
+                    break;
+                default:
+                    break;
+            }
+
+            if (pBound) {
+                if (*pBound == command.first) {
+                    continue;
+                }
+                *pBound = command.first;
+            }
+
+            commandList.Append(m_commandList, command);
+        }
+    }
+
+    void DrawCapture::AddJobs(ParallelCommandRecorder& recorder, uint32_t minChunk, uint32_t maxChunks) const {
+        for (auto&& range : ParallelCommandRecorder::Split(GetDrawsCount(), minChunk, maxChunks)) {
+            recorder.AddJob([this, range](CommandList& commandList) {
+                Emit(range.offset, range.count, commandList);
+            });
+        }
+    }
+}
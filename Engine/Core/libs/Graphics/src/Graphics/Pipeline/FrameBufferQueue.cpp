@@ -35,6 +35,7 @@ namespace SR_GRAPH_NS {
     void FrameBufferQueue::Clear() {
         m_used.clear();
         m_levels.clear();
+        m_closed = false;
     }
 
     void FrameBufferQueue::AddQueue(FrameBufferQueue::FrameBuffer pFrameBuffer, uint32_t queueIndex) {
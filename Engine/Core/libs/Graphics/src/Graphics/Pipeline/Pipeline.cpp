@@ -3,11 +3,14 @@
 //
 
 #include <Graphics/Pipeline/Pipeline.h>
+#include <Graphics/Pipeline/CommandList.h>
 #include <Graphics/Overlay/Overlay.h>
 #include <Graphics/Types/Shader.h>
 #include <Graphics/Types/Framebuffer.h>
 #include <Graphics/Render/RenderContext.h>
 
+#include <Utils/Profile/Profiler.h>
+
 #ifdef SR_DEBUG
     #define SR_PIPELINE_RENDER_GUARD(ret)                   \
         if (!m_isRenderState) {                             \
@@ -34,6 +37,10 @@ namespace SR_GRAPH_NS {
         ++m_state.operations;
         m_previousState = m_state;
         m_state = PipelineState();
+
+        SR_PROFILE_COUNTER("Draw calls", m_previousState.drawCalls);
+        SR_PROFILE_COUNTER("Pipeline operations", m_previousState.operations);
+        SR_PROFILE_COUNTER("Transferred memory", m_previousState.transferredMemory);
     }
 
     bool Pipeline::BeginRender() {
@@ -62,12 +69,24 @@ namespace SR_GRAPH_NS {
 
     void Pipeline::DrawIndices(uint32_t count) {
         SR_PIPELINE_RENDER_GUARD(void())
+
+        if (m_captureList) {
+            m_captureList->DrawIndices(count);
+            return;
+        }
+
         ++m_state.operations;
         ++m_state.drawCalls;
     }
 
     void Pipeline::Draw(uint32_t count) {
         SR_PIPELINE_RENDER_GUARD(void())
+
+        if (m_captureList) {
+            m_captureList->Draw(count);
+            return;
+        }
+
         ++m_state.operations;
         ++m_state.drawCalls;
     }
@@ -120,16 +139,32 @@ namespace SR_GRAPH_NS {
     }
 
     void Pipeline::BindVBO(uint32_t VBO) {
+        if (m_captureList) {
+            m_captureList->BindVBO(VBO);
+            return;
+        }
+
         ++m_state.operations;
     }
 
     void Pipeline::BindIBO(uint32_t IBO) {
+        if (m_captureList) {
+            m_captureList->BindIBO(IBO);
+            return;
+        }
+
         ++m_state.operations;
     }
 
     void Pipeline::BindUBO(uint32_t UBO) {
-        ++m_state.operations;
         m_state.UBOId = static_cast<int32_t>(UBO);
+
+        if (m_captureList) {
+            m_captureList->BindUBO(UBO);
+            return;
+        }
+
+        ++m_state.operations;
     }
 
     void Pipeline::UpdateUBO(uint32_t UBO, void* pData, uint64_t size) {
@@ -138,11 +173,21 @@ namespace SR_GRAPH_NS {
     }
 
     void Pipeline::PushConstants(void *pData, uint64_t size) {
+        if (m_captureList) {
+            m_captureList->PushConstants(pData, size);
+            return;
+        }
+
         ++m_state.operations;
         m_state.transferredMemory += size;
     }
 
     void Pipeline::BindTexture(uint8_t activeTexture, uint32_t textureId) {
+        if (m_captureList) {
+            m_captureList->BindTexture(activeTexture, textureId);
+            return;
+        }
+
         ++m_state.operations;
         ++m_state.usedTextures;
     }
@@ -153,14 +198,55 @@ namespace SR_GRAPH_NS {
     }
 
     void Pipeline::BindDescriptorSet(uint32_t descriptorSet) {
-        ++m_state.operations;
         m_state.descriptorSetId = static_cast<int32_t>(descriptorSet);
+
+        if (m_captureList) {
+            m_captureList->BindDescriptorSet(descriptorSet);
+            return;
+        }
+
+        ++m_state.operations;
     }
 
     void Pipeline::UseShader(uint32_t shaderProgram) {
+        m_state.shaderId = static_cast<int32_t>(shaderProgram);
+
+        if (m_captureList) {
+            m_captureList->UseShader(shaderProgram);
+            return;
+        }
+
         ++m_state.operations;
         ++m_state.usedShaders;
-        m_state.shaderId = static_cast<int32_t>(shaderProgram);
+    }
+
+    void Pipeline::SetViewport(int32_t width, int32_t height) {
+        if (m_captureList) {
+            m_captureList->SetViewport(width, height);
+            return;
+        }
+
+        ++m_state.operations;
+    }
+
+    void Pipeline::SetScissor(int32_t width, int32_t height) {
+        if (m_captureList) {
+            m_captureList->SetScissor(width, height);
+            return;
+        }
+
+        ++m_state.operations;
+    }
+
+    void Pipeline::SetFrameBufferLayer(uint32_t layer) {
+        m_state.frameBufferLayer = layer;
+
+        if (m_captureList) {
+            m_captureList->SetFrameBufferLayer(layer);
+            return;
+        }
+
+        ++m_state.operations;
     }
 
     void Pipeline::OnResize(const SR_MATH_NS::UVector2& size) {
@@ -285,6 +371,7 @@ namespace SR_GRAPH_NS {
 
         if (!m_dirty) {
             m_buildState = m_state;
+            m_fboQueue.Close();
         }
     }
 
@@ -309,15 +396,33 @@ namespace SR_GRAPH_NS {
         SR_ERROR(msg);
     }
 
+    void Pipeline::ExecuteCommandList(const CommandList& commandList) {
+        SRAssert2(!m_captureList, "Command list can't be executed while capturing!");
+        ++m_state.operations;
+        commandList.Replay(*this);
+    }
+
+    void Pipeline::ExecuteCommandLists(const ParallelCommandRecorder& recorder) {
+        for (uint32_t i = 0; i < recorder.GetJobsCount(); ++i) {
+            ExecuteCommandList(recorder.GetCommandList(i));
+        }
+    }
+
     void Pipeline::ResetDescriptorSet() {
         ++m_state.operations;
         m_state.descriptorSetId = SR_ID_INVALID;
     }
 
     void Pipeline::UnUseShader() {
-        ++m_state.operations;
         m_state.shaderId = SR_ID_INVALID;
         m_state.pShader = nullptr;
+
+        if (m_captureList) {
+            m_captureList->UnUseShader();
+            return;
+        }
+
+        ++m_state.operations;
     }
 
     void Pipeline::UpdateDescriptorSets(uint32_t descriptorSet, const SRDescriptorUpdateInfos& updateInfo) {
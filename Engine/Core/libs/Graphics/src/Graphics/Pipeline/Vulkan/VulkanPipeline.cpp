@@ -9,6 +9,9 @@
 #include <Graphics/Pipeline/Vulkan/AbstractCasts.h>
 #include <Graphics/Pipeline/Vulkan/VulkanTracy.h>
 #include <Graphics/Pipeline/Vulkan/VulkanMemory.h>
+#include <Graphics/Pipeline/Vulkan/VulkanUniformArena.h>
+#include <Graphics/Pipeline/CommandList.h>
+#include <Graphics/Render/RenderContext.h>
 
 #ifdef SR_USE_IMGUI
     #include <Graphics/Overlay/VulkanImGuiOverlay.h>
@@ -54,6 +57,9 @@ namespace SR_GRAPH_NS {
 
         DestroyOverlay();
 
+        DeInitUniformArena();
+        DestroySecondaryCmds();
+
         if (m_memory) {
             m_memory->Free();
             m_memory = nullptr;
@@ -223,9 +229,573 @@ namespace SR_GRAPH_NS {
 
         m_supportedSampleCount = m_kernel->GetDevice()->GetMSAASamplesCount();
 
+        if (!InitUniformArena()) {
+            SR_WARN("VulkanPipeline::Init() : uniform arena is not available, uniforms will use their own buffers.");
+        }
+
         return Super::Init();
     }
 
+    bool VulkanPipeline::InitUniformArena() {
+        /// спецификация ограничивает minUniformBufferOffsetAlignment сверху 256 байтами,
+        /// поэтому такое выравнивание подходит любому устройству
+        constexpr uint64_t alignment = 256;
+        constexpr uint64_t capacity = 16 * 1024 * 1024;
+
+        auto&& pStorage = std::make_unique<VulkanTools::VulkanUniformArenaStorage>(m_kernel);
+        m_uniformArenaStorage = pStorage.get();
+
+        m_uniformArena = std::make_unique<Memory::UniformArena>(std::move(pStorage));
+
+        /// кадр кольца - один DrawFrame, его память возвращается после fence этого кадра
+        const uint32_t framesInFlight = SR_MAX(2, static_cast<uint32_t>(GetBuildIterationsCount()));
+
+        if (!m_uniformArena->Init(capacity, alignment, framesInFlight)) {
+            DeInitUniformArena();
+            return false;
+        }
+
+        VkFenceCreateInfo fenceInfo = { };
+        fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+
+        m_arenaFences.resize(framesInFlight);
+
+        for (auto&& arenaFence : m_arenaFences) {
+            if (vkCreateFence(*m_kernel->GetDevice(), &fenceInfo, nullptr, &arenaFence.fence) != VK_SUCCESS) {
+                SR_ERROR("VulkanPipeline::InitUniformArena() : failed to create fence!");
+                DeInitUniformArena();
+                return false;
+            }
+        }
+
+        m_arenaUBOBase = static_cast<int32_t>(m_memory->m_countUBO.first);
+
+        return true;
+    }
+
+    void VulkanPipeline::DeInitUniformArena() {
+        if (!m_arenaFences.empty()) {
+            vkDeviceWaitIdle(*m_kernel->GetDevice());
+
+            for (auto&& arenaFence : m_arenaFences) {
+                if (arenaFence.fence != VK_NULL_HANDLE) {
+                    vkDestroyFence(*m_kernel->GetDevice(), arenaFence.fence, nullptr);
+                }
+            }
+
+            m_arenaFences.clear();
+        }
+
+        m_uniformArena.reset();
+        m_uniformArenaStorage = nullptr;
+
+        m_arenaUBOs.clear();
+        m_freeArenaUBOs.clear();
+        m_arenaRecord = nullptr;
+        m_arenaOverflow = false;
+    }
+
+    void VulkanPipeline::BeginUniformArenaFrame() {
+        if (!m_uniformArena) {
+            return;
+        }
+
+        if (m_arenaOverflow) {
+            GrowUniformArena();
+        }
+
+        auto&& allocator = m_uniformArena->GetAllocator();
+
+        /// PrepareFrame без DrawFrame - кадр уже открыт
+        if (allocator.IsFrameActive()) {
+            return;
+        }
+
+        /// слот последний раз занимал кадр frame - framesInFlight, после его fence память слота свободна
+        auto&& arenaFence = m_arenaFences[allocator.GetFrame() % m_arenaFences.size()];
+        if (arenaFence.submitted) {
+            SR_TRACY_ZONE_N("Wait uniform arena frame");
+            vkWaitForFences(*m_kernel->GetDevice(), 1, &arenaFence.fence, VK_TRUE, SR_UINT64_MAX);
+            vkResetFences(*m_kernel->GetDevice(), 1, &arenaFence.fence);
+            arenaFence.submitted = false;
+        }
+
+        m_uniformArena->BeginFrame();
+        m_arenaWriteSynced = false;
+    }
+
+    void VulkanPipeline::EndUniformArenaFrame() {
+        if (!m_uniformArena || !m_uniformArena->GetAllocator().IsFrameActive()) {
+            return;
+        }
+
+        auto&& allocator = m_uniformArena->GetAllocator();
+        auto&& arenaFence = m_arenaFences[allocator.GetFrame() % m_arenaFences.size()];
+        auto&& queue = m_kernel->GetDevice()->GetQueues()->GetGraphicsQueue();
+
+        /// пустая отправка сигналит fence, когда очередь закончит всю работу до нее, то есть этот кадр
+        if (vkQueueSubmit(queue, 0, nullptr, arenaFence.fence) == VK_SUCCESS) {
+            arenaFence.submitted = true;
+        }
+        else {
+            PipelineError("VulkanPipeline::EndUniformArenaFrame() : failed to submit frame fence!");
+            vkQueueWaitIdle(queue);
+        }
+
+        m_uniformArena->EndFrame();
+        m_arenaWriteSynced = false;
+    }
+
+    void VulkanPipeline::GrowUniformArena() {
+        SR_TRACY_ZONE;
+
+        constexpr uint64_t maxCapacity = 256 * 1024 * 1024;
+
+        m_arenaOverflow = false;
+
+        auto&& allocator = m_uniformArena->GetAllocator();
+        const uint64_t oldCapacity = allocator.GetCapacity();
+        const uint64_t capacity = SR_MIN(oldCapacity * 2, maxCapacity);
+        const uint64_t alignment = allocator.GetAlignment();
+        const uint32_t framesInFlight = allocator.GetFramesInFlight();
+
+        /// записанные команды читают старый буфер, поэтому он живет, пока GPU не закончит всю работу
+        vkDeviceWaitIdle(*m_kernel->GetDevice());
+
+        for (auto&& arenaFence : m_arenaFences) {
+            if (arenaFence.submitted) {
+                vkResetFences(*m_kernel->GetDevice(), 1, &arenaFence.fence);
+                arenaFence.submitted = false;
+            }
+        }
+
+        if (!m_uniformArena->Init(capacity, alignment, framesInFlight) && !m_uniformArena->Init(oldCapacity, alignment, framesInFlight)) {
+            PipelineError("VulkanPipeline::GrowUniformArena() : failed to re-create uniform arena!");
+            return;
+        }
+
+        SR_INFO("VulkanPipeline::GrowUniformArena() : uniform arena capacity is {} bytes now.", m_uniformArena->GetAllocator().GetCapacity());
+
+        /// после Init все места в кольце сброшены, а дескрипторы должны смотреть на новый буфер
+        for (uint32_t i = 0; i < m_arenaUBOs.size(); ++i) {
+            WriteArenaDescriptor(i);
+        }
+
+        SetDirty(true);
+    }
+
+    void VulkanPipeline::WriteArenaDescriptor(uint32_t arenaUBO) {
+        auto&& ubo = m_arenaUBOs[arenaUBO];
+        if (!ubo.used || ubo.descriptorSet == SR_ID_INVALID) {
+            return;
+        }
+
+        if (ubo.descriptorSet >= static_cast<int32_t>(m_memory->m_countDescriptorSets.first) || !m_memory->m_descriptorSets[ubo.descriptorSet]) {
+            return;
+        }
+
+        auto&& descriptor = m_uniformArenaStorage->GetDescriptor(0, ubo.data.size());
+
+        auto&& writeDescriptorSet = EvoVulkan::Tools::Initializers::WriteDescriptorSet(
+            m_memory->m_descriptorSets[ubo.descriptorSet].m_self,
+            VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC,
+            ubo.binding,
+            &descriptor
+        );
+
+        vkUpdateDescriptorSets(*m_kernel->GetDevice(), 1, &writeDescriptorSet, 0, nullptr);
+    }
+
+    void VulkanPipeline::WaitUniformArenaWrite() {
+        if (m_arenaWriteSynced) {
+            return;
+        }
+
+        m_arenaWriteSynced = true;
+
+        auto&& allocator = m_uniformArena->GetAllocator();
+        if (allocator.GetFrame() == 0) {
+            return;
+        }
+
+        /// открытый кадр еще не отправлен, последний отправленный - предыдущий
+        auto&& arenaFence = m_arenaFences[(allocator.GetFrame() - 1) % m_arenaFences.size()];
+        if (arenaFence.submitted) {
+            SR_TRACY_ZONE_N("Wait uniform arena write");
+            vkWaitForFences(*m_kernel->GetDevice(), 1, &arenaFence.fence, VK_TRUE, SR_UINT64_MAX);
+        }
+    }
+
+    void VulkanPipeline::BeginUniformArenaRecord(const void* pOwner) {
+        if (!m_uniformArena) {
+            return;
+        }
+
+        /// вне кадра кольца UBO получат собственные буферы, старая запись владельца больше не нужна
+        if (!m_uniformArena->GetAllocator().IsFrameActive()) {
+            m_uniformArena->ReleaseRecord(pOwner);
+            return;
+        }
+
+        SRAssert2(!m_arenaRecord, "VulkanPipeline::BeginUniformArenaRecord() : previous record is not ended!");
+
+        m_uniformArena->BeginRecord(pOwner);
+        m_arenaRecord = pOwner;
+    }
+
+    void VulkanPipeline::EndUniformArenaRecord() {
+        m_arenaRecord = nullptr;
+    }
+
+    void VulkanPipeline::ReleaseUniformArenaRecord(const void* pOwner) {
+        if (m_uniformArena) {
+            m_uniformArena->ReleaseRecord(pOwner);
+        }
+    }
+
+    bool VulkanPipeline::IsArenaUBOPlaced(uint32_t arenaUBO) const {
+        auto&& ubo = m_arenaUBOs[arenaUBO];
+
+        if (ubo.offset == Memory::UniformArenaAllocator::InvalidOffset || !ubo.pRecord) {
+            return false;
+        }
+
+        /// место действительно, пока владелец не перезаписал свои команды
+        return m_uniformArena->GetAllocator().GetRecordId(ubo.pRecord) == ubo.recordId;
+    }
+
+    bool VulkanPipeline::BindDrawDescriptorSet() {
+        if (!m_currentDescriptorSets) {
+            return true;
+        }
+
+        const int32_t shaderId = m_state.shaderId;
+        const int32_t descriptorSet = m_state.descriptorSetId;
+
+        const uint32_t dynamicCount = shaderId >= 0 && shaderId < static_cast<int32_t>(m_shaderDynamicUniforms.size())
+            ? m_shaderDynamicUniforms[shaderId] : 0;
+
+        const int32_t UBO = dynamicCount > 0 && descriptorSet >= 0 && descriptorSet < static_cast<int32_t>(m_descriptorSetUBOs.size())
+            ? m_descriptorSetUBOs[descriptorSet] : SR_ID_INVALID;
+
+        /// у собственного буфера UBO дескриптор уже смотрит на его начало
+        uint32_t dynamicOffset = 0;
+
+        if (IsArenaUBO(UBO)) {
+            const uint32_t index = static_cast<uint32_t>(UBO - m_arenaUBOBase);
+            if (index >= m_arenaUBOs.size() || !m_arenaUBOs[index].used) {
+                SRHaltOnce("VulkanPipeline::BindDrawDescriptorSet() : arena uniform is freed!");
+                return false;
+            }
+
+            auto&& ubo = m_arenaUBOs[index];
+
+            if (!IsArenaUBOPlaced(index)) {
+                /// место выделяется только в записи владельца, иначе буфер команд переживет память кольца
+                if (!m_arenaRecord) {
+                    SRHaltOnce("VulkanPipeline::BindDrawDescriptorSet() : arena uniform is drawn outside of record!");
+                    return false;
+                }
+
+                const uint64_t offset = m_uniformArena->Allocate(ubo.data.size());
+                if (offset == Memory::UniformArenaAllocator::InvalidOffset) {
+                    if (!m_arenaOverflow) {
+                        SR_WARN("VulkanPipeline::BindDrawDescriptorSet() : uniform arena overflow! The scene will be re-recorded with a bigger arena.");
+                    }
+                    m_arenaOverflow = true;
+                    return false;
+                }
+
+                ubo.offset = offset;
+                ubo.pRecord = m_arenaRecord;
+                ubo.recordId = m_uniformArena->GetAllocator().GetRecordId(m_arenaRecord);
+
+                /// новое место еще не читал ни один кадр, поэтому fence ждать не нужно
+                m_uniformArena->Write(offset, ubo.data.data(), ubo.data.size());
+            }
+
+            dynamicOffset = static_cast<uint32_t>(ubo.offset);
+        }
+
+        VulkanCommand command;
+        command.type = VulkanCommandType::BindDescriptorSet;
+        command.layout = m_currentLayout;
+        command.descriptorSet = m_currentDescriptorSets;
+        command.count = dynamicCount;
+        command.offset = dynamicOffset;
+        RecordCommand(command);
+
+        return true;
+    }
+
+    void VulkanPipeline::ExecuteCommand(VkCommandBuffer cmd, const VulkanCommand& command, const char* pData) {
+        switch (command.type) {
+            case VulkanCommandType::BindShader:
+                command.pShader->Bind(cmd);
+                break;
+            case VulkanCommandType::BindVertexBuffer: {
+                const VkDeviceSize offsets[1] = { 0 };
+                vkCmdBindVertexBuffers(cmd, 0, 1, &command.buffer, offsets);
+                break;
+            }
+            case VulkanCommandType::BindIndexBuffer:
+                vkCmdBindIndexBuffer(cmd, command.buffer, 0, VK_INDEX_TYPE_UINT32);
+                break;
+            case VulkanCommandType::BindDescriptorSet: {
+                /// у шейдера один блок юниформ, несколько динамических привязок получат одно смещение
+                const std::array<uint32_t, 4> dynamicOffsets = { command.offset, command.offset, command.offset, command.offset };
+                SRAssert(command.count <= dynamicOffsets.size());
+
+                vkCmdBindDescriptorSets(cmd, VK_PIPELINE_BIND_POINT_GRAPHICS, command.layout, 0, 1, &command.descriptorSet,
+                    SR_MIN(command.count, static_cast<uint32_t>(dynamicOffsets.size())), dynamicOffsets.data()
+                );
+                break;
+            }
+            case VulkanCommandType::PushConstants:
+                vkCmdPushConstants(cmd, command.layout, command.stages, 0, command.count, pData + command.offset);
+                break;
+            case VulkanCommandType::SetViewport:
+                vkCmdSetViewport(cmd, 0, 1, &command.viewport);
+                break;
+            case VulkanCommandType::SetScissor:
+                vkCmdSetScissor(cmd, 0, 1, &command.scissor);
+                break;
+            case VulkanCommandType::Draw:
+                vkCmdDraw(cmd, command.count, 1, 0, 0);
+                break;
+            case VulkanCommandType::DrawIndexed:
+                vkCmdDrawIndexed(cmd, command.count, 1, 0, 0, 0);
+                break;
+            default:
+                SRHaltOnce0();
+                break;
+        }
+    }
+
+    void VulkanPipeline::RecordCommand(const VulkanCommand& command, const void* pData) {
+        if (!m_resolveCommands) {
+            ExecuteCommand(m_currentCmd, command, static_cast<const char*>(pData));
+            return;
+        }
+
+        m_jobCommands.emplace_back(command);
+
+        /// данные констант живут в списке, который переписывается следующей записью, поэтому копируются
+        if (pData) {
+            m_jobCommands.back().offset = static_cast<uint32_t>(m_jobCommandsData.size());
+            m_jobCommandsData.insert(m_jobCommandsData.end(), static_cast<const char*>(pData), static_cast<const char*>(pData) + command.count);
+        }
+    }
+
+    void VulkanPipeline::BeginSecondaryCmd(VkCommandBuffer cmd, VkRenderPass renderPass, VkFramebuffer framebuffer,
+        const VkViewport& viewport, const VkRect2D& scissor
+    ) {
+        VkCommandBufferInheritanceInfo inheritanceInfo = { };
+        inheritanceInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+        inheritanceInfo.renderPass = renderPass;
+        inheritanceInfo.subpass = 0;
+        inheritanceInfo.framebuffer = framebuffer;
+
+        VkCommandBufferBeginInfo beginInfo = { };
+        beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.flags = VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT | VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT;
+        beginInfo.pInheritanceInfo = &inheritanceInfo;
+
+        vkBeginCommandBuffer(cmd, &beginInfo);
+
+        /// до первого SetViewport прохода размеров еще нет
+        if (viewport.width > 0.f && viewport.height > 0.f) {
+            vkCmdSetViewport(cmd, 0, 1, &viewport);
+        }
+
+        if (scissor.extent.width > 0 && scissor.extent.height > 0) {
+            vkCmdSetScissor(cmd, 0, 1, &scissor);
+        }
+    }
+
+    VkCommandBuffer VulkanPipeline::AcquireSecondaryCmd() {
+        auto&& secondaryCmds = m_secondaryCmds[m_primaryCmd];
+
+        if (secondaryCmds.used < secondaryCmds.cmds.size()) {
+            return secondaryCmds.cmds[secondaryCmds.used++].cmd;
+        }
+
+        SecondaryCmd secondaryCmd;
+
+        VkCommandPoolCreateInfo poolInfo = { };
+        poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+        poolInfo.queueFamilyIndex = m_kernel->GetDevice()->GetQueues()->GetGraphicsIndex();
+
+        if (vkCreateCommandPool(*m_kernel->GetDevice(), &poolInfo, nullptr, &secondaryCmd.pool) != VK_SUCCESS) {
+            PipelineError("VulkanPipeline::AcquireSecondaryCmd() : failed to create command pool!");
+            SRHalt0();
+            return VK_NULL_HANDLE;
+        }
+
+        VkCommandBufferAllocateInfo allocateInfo = { };
+        allocateInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocateInfo.commandPool = secondaryCmd.pool;
+        allocateInfo.level = VK_COMMAND_BUFFER_LEVEL_SECONDARY;
+        allocateInfo.commandBufferCount = 1;
+
+        if (vkAllocateCommandBuffers(*m_kernel->GetDevice(), &allocateInfo, &secondaryCmd.cmd) != VK_SUCCESS) {
+            PipelineError("VulkanPipeline::AcquireSecondaryCmd() : failed to allocate secondary command buffer!");
+            vkDestroyCommandPool(*m_kernel->GetDevice(), secondaryCmd.pool, nullptr);
+            SRHalt0();
+            return VK_NULL_HANDLE;
+        }
+
+        secondaryCmds.cmds.emplace_back(secondaryCmd);
+        ++secondaryCmds.used;
+
+        return secondaryCmd.cmd;
+    }
+
+    void VulkanPipeline::BeginInlineSecondaryCmd() {
+        auto&& primary = m_deferredPrimaryCmds.back();
+        auto&& renderPass = primary.renderPasses.back();
+
+        VkCommandBuffer cmd = AcquireSecondaryCmd();
+        BeginSecondaryCmd(cmd, renderPass.beginInfo.renderPass, renderPass.beginInfo.framebuffer, m_viewport, m_scissor);
+
+        primary.secondaries.emplace_back(cmd);
+        ++renderPass.secondaryCount;
+
+        m_currentCmd = cmd;
+    }
+
+    void VulkanPipeline::EndInlineSecondaryCmd() {
+        vkEndCommandBuffer(m_currentCmd);
+        m_currentCmd = m_primaryCmd;
+    }
+
+    void VulkanPipeline::ResetSecondaryCmds(VkCommandBuffer primaryCmd) {
+        auto&& pIt = m_secondaryCmds.find(primaryCmd);
+        if (pIt == m_secondaryCmds.end()) {
+            return;
+        }
+
+        /// первичный буфер начинают записывать заново только после того, как GPU его исполнил
+        for (auto&& secondaryCmd : pIt->second.cmds) {
+            vkResetCommandPool(*m_kernel->GetDevice(), secondaryCmd.pool, 0);
+        }
+
+        pIt->second.used = 0;
+    }
+
+    void VulkanPipeline::DestroySecondaryCmds() {
+        for (auto&& [primaryCmd, secondaryCmds] : m_secondaryCmds) {
+            for (auto&& secondaryCmd : secondaryCmds.cmds) {
+                vkDestroyCommandPool(*m_kernel->GetDevice(), secondaryCmd.pool, nullptr);
+            }
+        }
+
+        m_secondaryCmds.clear();
+        m_deferredPrimaryCmds.clear();
+        m_secondaryCmdJobs.clear();
+    }
+
+    void VulkanPipeline::ExecuteCommandLists(const ParallelCommandRecorder& recorder) {
+        /// вне render pass'а вторичные буферы исполнять негде
+        if (!m_primaryCmd || IsCapturing()) {
+            Super::ExecuteCommandLists(recorder);
+            return;
+        }
+
+        SR_TRACY_ZONE;
+
+        EndInlineSecondaryCmd();
+
+        auto&& primary = m_deferredPrimaryCmds.back();
+        auto&& renderPass = primary.renderPasses.back();
+
+        /// кольцо юниформ и менеджер памяти не потокобезопасны, поэтому списки разрешаются здесь,
+        /// а рабочие потоки в EndCommandBatch только пишут готовые команды в свои вторичные буферы
+        m_resolveCommands = true;
+
+        for (uint32_t i = 0; i < recorder.GetJobsCount(); ++i) {
+            SecondaryCmdJob job;
+            job.cmd = AcquireSecondaryCmd();
+            job.renderPass = renderPass.beginInfo.renderPass;
+            job.framebuffer = renderPass.beginInfo.framebuffer;
+            job.viewport = m_viewport;
+            job.scissor = m_scissor;
+            job.firstCommand = static_cast<uint32_t>(m_jobCommands.size());
+
+            Super::ExecuteCommandList(recorder.GetCommandList(i));
+
+            job.commandsCount = static_cast<uint32_t>(m_jobCommands.size()) - job.firstCommand;
+            m_secondaryCmdJobs.emplace_back(job);
+
+            primary.secondaries.emplace_back(job.cmd);
+            ++renderPass.secondaryCount;
+        }
+
+        m_resolveCommands = false;
+
+        /// вторичные буферы исполняются в порядке заданий, а следующие команды прохода идут после них
+        BeginInlineSecondaryCmd();
+    }
+
+    void VulkanPipeline::BeginCommandBatch() {
+        SRAssert2(!m_commandBatch, "Command batch is already begun!");
+        m_commandBatch = true;
+    }
+
+    void VulkanPipeline::EndCommandBatch() {
+        SRAssert2(m_commandBatch, "Command batch is not begun!");
+        m_commandBatch = false;
+        FlushCommandBatch();
+    }
+
+    void VulkanPipeline::FlushCommandBatch() {
+        SR_TRACY_ZONE;
+
+        if (!m_secondaryCmdJobs.empty()) {
+            auto&& recorder = m_renderContext->GetCommandRecorder();
+
+            recorder.Begin();
+
+            for (auto&& job : m_secondaryCmdJobs) {
+                /// список задания не нужен, команды уже разрешены в m_jobCommands
+                recorder.AddJob([this, &job](CommandList&) {
+                    BeginSecondaryCmd(job.cmd, job.renderPass, job.framebuffer, job.viewport, job.scissor);
+
+                    for (uint32_t i = job.firstCommand; i < job.firstCommand + job.commandsCount; ++i) {
+                        ExecuteCommand(job.cmd, m_jobCommands[i], m_jobCommandsData.data());
+                    }
+
+                    vkEndCommandBuffer(job.cmd);
+                });
+            }
+
+            recorder.Record();
+        }
+
+        for (auto&& primary : m_deferredPrimaryCmds) {
+            SRAssert2(primary.ended, "Primary command buffer is not ended!");
+
+            for (auto&& renderPass : primary.renderPasses) {
+                renderPass.beginInfo.pClearValues = renderPass.clearValues.data();
+
+                vkCmdBeginRenderPass(primary.cmd, &renderPass.beginInfo, VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
+
+                if (renderPass.secondaryCount > 0) {
+                    vkCmdExecuteCommands(primary.cmd, renderPass.secondaryCount, primary.secondaries.data() + renderPass.firstSecondary);
+                }
+
+                vkCmdEndRenderPass(primary.cmd);
+            }
+
+            vkEndCommandBuffer(primary.cmd);
+        }
+
+        m_deferredPrimaryCmds.clear();
+        m_secondaryCmdJobs.clear();
+        m_jobCommands.clear();
+        m_jobCommandsData.clear();
+    }
+
     uint64_t VulkanPipeline::GetUsedMemory() const {
         return m_kernel->GetAllocator() ? m_kernel->GetAllocator()->GetGPUMemoryUsage() : 0;
     }
@@ -237,6 +807,26 @@ namespace SR_GRAPH_NS {
 
         SRAssert2(uboSize > 0, "Incorrect UBO size!");
 
+        /// UBO записи команд живет в кольце юниформ, собственный буфер ему не нужен
+        if (m_arenaRecord) {
+            uint32_t index = static_cast<uint32_t>(m_arenaUBOs.size());
+
+            if (!m_freeArenaUBOs.empty()) {
+                index = m_freeArenaUBOs.back();
+                m_freeArenaUBOs.pop_back();
+            }
+            else {
+                m_arenaUBOs.emplace_back();
+            }
+
+            auto&& ubo = m_arenaUBOs[index];
+            ubo = ArenaUBO();
+            ubo.data.resize(uboSize);
+            ubo.used = true;
+
+            return m_arenaUBOBase + static_cast<int32_t>(index);
+        }
+
         if (auto&& id = m_memory->AllocateUBO(uboSize); id >= 0) {
             return id;
         }
@@ -267,6 +857,11 @@ namespace SR_GRAPH_NS {
 
         if (auto&& id = m_memory->AllocateDescriptorSet(m_state.shaderId, vkTypes); id >= 0) {
             EVK_POP_LOG_LEVEL();
+
+            if (id < static_cast<int32_t>(m_descriptorSetUBOs.size())) {
+                m_descriptorSetUBOs[id] = SR_ID_INVALID;
+            }
+
             return id;
         }
 
@@ -327,6 +922,10 @@ namespace SR_GRAPH_NS {
     void VulkanPipeline::UseShader(uint32_t shaderProgram) {
         Pipeline::UseShader(shaderProgram);
 
+        if (IsCapturing()) {
+            return;
+        }
+
         if (shaderProgram >= m_memory->m_countShaderPrograms.first) {
             PipelineError("Vulkan::UseShader() : index out of range!");
             return;
@@ -339,7 +938,10 @@ namespace SR_GRAPH_NS {
         }
         m_currentLayout = m_currentVkShader->GetPipelineLayout();
 
-        m_currentVkShader->Bind(m_currentCmd);
+        VulkanCommand command;
+        command.type = VulkanCommandType::BindShader;
+        command.pShader = m_currentVkShader;
+        RecordCommand(command);
     }
 
     int32_t VulkanPipeline::AllocateShaderProgram(const SRShaderCreateInfo& createInfo, int32_t fbo) {
@@ -407,6 +1009,17 @@ namespace SR_GRAPH_NS {
             return SR_ID_INVALID;
         }
 
+        /// число динамических смещений в vkCmdBindDescriptorSets должно совпадать с раскладкой шейдера
+        if (static_cast<uint32_t>(shaderProgram) >= m_shaderDynamicUniforms.size()) {
+            m_shaderDynamicUniforms.resize(SR_MAX(static_cast<uint32_t>(shaderProgram) + 1, m_memory->m_countShaderPrograms.first), 0);
+        }
+
+        m_shaderDynamicUniforms[shaderProgram] = static_cast<uint32_t>(std::count_if(
+            descriptorLayoutBindings.value().begin(), descriptorLayoutBindings.value().end(), [](auto&& binding) {
+                return binding.descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC;
+            }
+        ));
+
         std::vector<EvoVulkan::Complexes::SourceShader> vkModules;
         for (auto&& module : modules) {
             VkShaderStageFlagBits stage = VulkanTools::VkShaderShaderTypeToStage(module.m_stage);
@@ -549,6 +1162,10 @@ namespace SR_GRAPH_NS {
 
     void VulkanPipeline::UnUseShader() {
         Super::UnUseShader();
+
+        if (IsCapturing()) {
+            return;
+        }
         m_currentVkShader = nullptr;
         m_currentLayout = VK_NULL_HANDLE;
     }
@@ -558,23 +1175,48 @@ namespace SR_GRAPH_NS {
 
         std::vector<VkWriteDescriptorSet> writeDescriptorSets;
 
+        /// адреса дескрипторов должны жить до vkUpdateDescriptorSets
+        std::vector<VkDescriptorBufferInfo> bufferDescriptors;
+        bufferDescriptors.reserve(updateInfo.size());
+
+        if (descriptorSet >= m_descriptorSetUBOs.size()) {
+            m_descriptorSetUBOs.resize(SR_MAX(descriptorSet + 1, m_memory->m_countDescriptorSets.first), SR_ID_INVALID);
+        }
+
         for (auto&& info : updateInfo) {
             switch (info.descriptorType) {
                 case DescriptorType::Uniform: {
                     auto&& vkDescriptorSet = m_memory->m_descriptorSets[descriptorSet].m_self;
 
-                    if (info.ubo >= m_memory->m_countUBO.first) {
+                    if (IsArenaUBO(static_cast<int32_t>(info.ubo))) {
+                        const uint32_t index = info.ubo - static_cast<uint32_t>(m_arenaUBOBase);
+                        if (index >= m_arenaUBOs.size() || !m_arenaUBOs[index].used) {
+                            SRHalt("VulkanPipeline::UpdateDescriptorSets() : arena uniform is not allocated! Index: {}", index);
+                            continue;
+                        }
+
+                        auto&& ubo = m_arenaUBOs[index];
+                        ubo.descriptorSet = static_cast<int32_t>(descriptorSet);
+                        ubo.binding = info.binding;
+
+                        /// дескриптор смотрит на начало кольца, место UBO передается динамическим смещением при привязке
+                        bufferDescriptors.emplace_back(m_uniformArenaStorage->GetDescriptor(0, ubo.data.size()));
+                    }
+                    else if (info.ubo >= m_memory->m_countUBO.first) {
                         SRHalt("VulkanPipeline::UpdateDescriptorSets() : uniform index out of range! \n\tCount uniforms: {}\n\tIndex: {}", m_memory->m_countUBO.first, info.ubo);
                         continue;
                     }
+                    else {
+                        bufferDescriptors.emplace_back(*m_memory->m_UBOs[info.ubo]->GetDescriptorRef());
+                    }
 
-                    auto&& vkUBODescriptor = m_memory->m_UBOs[info.ubo]->GetDescriptorRef();
+                    m_descriptorSetUBOs[descriptorSet] = static_cast<int32_t>(info.ubo);
 
                     writeDescriptorSets.emplace_back(EvoVulkan::Tools::Initializers::WriteDescriptorSet(
                         vkDescriptorSet,
-                        VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
+                        VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC,
                         info.binding,
-                        vkUBODescriptor
+                        &bufferDescriptors.back()
                     ));
 
                     break;
@@ -596,6 +1238,27 @@ namespace SR_GRAPH_NS {
     void VulkanPipeline::UpdateUBO(uint32_t UBO, void* pData, uint64_t size) {
         Super::UpdateUBO(UBO, pData, size);
 
+        if (IsArenaUBO(static_cast<int32_t>(UBO))) {
+            const uint32_t index = UBO - static_cast<uint32_t>(m_arenaUBOBase);
+            if (index >= m_arenaUBOs.size() || !m_arenaUBOs[index].used) {
+                SRHaltOnce0();
+                return;
+            }
+
+            auto&& ubo = m_arenaUBOs[index];
+            const uint64_t dataSize = SR_MIN(size, static_cast<uint64_t>(ubo.data.size()));
+
+            memcpy(ubo.data.data(), pData, dataSize);
+
+            /// без места в кольце данные попадут туда при записи команд
+            if (IsArenaUBOPlaced(index)) {
+                WaitUniformArenaWrite();
+                m_uniformArena->Write(ubo.offset, pData, dataSize);
+            }
+
+            return;
+        }
+
         if (UBO >= m_memory->m_countUBO.first) {
             SRHalt("VulkanPipeline::UpdateUBO() : uniform index out of range! \n\tCount uniforms: {}\n\tIndex: {}", m_memory->m_countUBO.first, UBO);
             return;
@@ -616,6 +1279,10 @@ namespace SR_GRAPH_NS {
     void VulkanPipeline::SetViewport(int32_t width, int32_t height) {
         Super::SetViewport(width, height);
 
+        if (IsCapturing()) {
+            return;
+        }
+
         if (width > 0 && height > 0) {
             m_viewport = EvoVulkan::Tools::Initializers::Viewport(
                 static_cast<float_t>(width),
@@ -636,12 +1303,19 @@ namespace SR_GRAPH_NS {
             }
         }
 
-        vkCmdSetViewport(m_currentCmd, 0, 1, &m_viewport);
+        VulkanCommand command;
+        command.type = VulkanCommandType::SetViewport;
+        command.viewport = m_viewport;
+        RecordCommand(command);
     }
 
     void VulkanPipeline::SetScissor(int32_t width, int32_t height) {
         Super::SetScissor(width, height);
 
+        if (IsCapturing()) {
+            return;
+        }
+
         if (width > 0 && height > 0) {
             m_scissor = EvoVulkan::Tools::Initializers::Rect2D(width, height, 0, 0);
         }
@@ -658,7 +1332,10 @@ namespace SR_GRAPH_NS {
             }
         }
 
-        vkCmdSetScissor(m_currentCmd, 0, 1, &m_scissor);
+        VulkanCommand command;
+        command.type = VulkanCommandType::SetScissor;
+        command.scissor = m_scissor;
+        RecordCommand(command);
     }
 
     void VulkanPipeline::BindFrameBuffer(Pipeline::FramebufferPtr pFBO) {
@@ -690,14 +1367,17 @@ namespace SR_GRAPH_NS {
             uint32_t layerIndex = SR_MIN(m_state.frameBufferLayer, layers.size() - 1);
             auto&& vkFrameBuffer = layers.at(layerIndex)->GetFramebuffer();
 
-            if (m_fboQueue.Contains(pFBO, layerIndex)) {
-                PipelineError("VulkanPipeline::BindFrameBuffer() : frame buffer (\"" + std::to_string(FBO) + "\") is already added to FBO queue!");
-                SRHalt0();
-                return;
-            }
+            /// после сборки очереди проход может перезаписать только свой буфер команд, очередь уже не меняется
+            if (!m_fboQueue.IsClosed()) {
+                if (m_fboQueue.Contains(pFBO, layerIndex)) {
+                    PipelineError("VulkanPipeline::BindFrameBuffer() : frame buffer (\"" + std::to_string(FBO) + "\") is already added to FBO queue!");
+                    SRHalt0();
+                    return;
+                }
 
-            if (!m_fboQueue.Contains(pFBO)) {
-                m_fboQueue.AddFrameBuffer(pFBO, layerIndex);
+                if (!m_fboQueue.Contains(pFBO)) {
+                    m_fboQueue.AddFrameBuffer(pFBO, layerIndex);
+                }
             }
 
             m_renderPassBI.framebuffer = vkFrameBuffer;
@@ -878,17 +1558,33 @@ namespace SR_GRAPH_NS {
             return false;
         }
 
+        /// буфер перезаписывается в той же порции, его прошлую запись нужно дописать до сброса вторичных буферов
+        if (std::any_of(m_deferredPrimaryCmds.begin(), m_deferredPrimaryCmds.end(), [this](auto&& primary) { return primary.cmd == m_currentCmd; })) {
+            FlushCommandBatch();
+        }
+
+        ResetSecondaryCmds(m_currentCmd);
+
         vkBeginCommandBuffer(m_currentCmd, &m_cmdBufInfo);
+
+        /// render pass'ы и конец буфера допишет FlushCommandBatch, когда будут готовы вторичные буферы
+        m_deferredPrimaryCmds.emplace_back().cmd = m_currentCmd;
+
         return Super::BeginCmdBuffer();
     }
 
     void VulkanPipeline::EndCmdBuffer() {
-        if (!m_currentCmd) {
+        if (!m_currentCmd || m_deferredPrimaryCmds.empty()) {
             PipelineError("VulkanPipeline::EndCmdBuffer() : cmd buffer is nullptr!");
             return;
         }
 
-        vkEndCommandBuffer(m_currentCmd);
+        m_deferredPrimaryCmds.back().ended = true;
+
+        if (!m_commandBatch) {
+            FlushCommandBatch();
+        }
+
         Super::EndCmdBuffer();
     }
 
@@ -902,19 +1598,36 @@ namespace SR_GRAPH_NS {
             return false;
         }
 
-        vkCmdBeginRenderPass(m_currentCmd, &m_renderPassBI, VK_SUBPASS_CONTENTS_INLINE);
+        if (m_deferredPrimaryCmds.empty() || m_deferredPrimaryCmds.back().cmd != m_currentCmd) {
+            PipelineError("VulkanPipeline::BeginRender() : cmd buffer is not begun!");
+            return false;
+        }
+
+        auto&& primary = m_deferredPrimaryCmds.back();
+
+        /// команды render pass'а пишутся только во вторичные буферы: часть из них записывают рабочие потоки,
+        /// а смешивать вторичные буферы с командами первичного внутри одного subpass'а Vulkan не позволяет
+        auto&& renderPass = primary.renderPasses.emplace_back();
+        renderPass.beginInfo = m_renderPassBI;
+        renderPass.clearValues.assign(m_renderPassBI.pClearValues, m_renderPassBI.pClearValues + m_renderPassBI.clearValueCount);
+        renderPass.firstSecondary = static_cast<uint32_t>(primary.secondaries.size());
+
+        m_primaryCmd = m_currentCmd;
+        BeginInlineSecondaryCmd();
+
         return true;
     }
 
     void VulkanPipeline::EndRender() {
         Super::EndRender();
 
-        if (!m_currentCmd) {
+        if (!m_currentCmd || !m_primaryCmd) {
             PipelineError("VulkanPipeline::EndRender() : cmd buffer is nullptr!");
             return;
         }
 
-        vkCmdEndRenderPass(m_currentCmd);
+        EndInlineSecondaryCmd();
+        m_primaryCmd = VK_NULL_HANDLE;
     }
 
     void VulkanPipeline::DrawFrame() {
@@ -935,6 +1648,8 @@ namespace SR_GRAPH_NS {
             default:
                 break;
         }
+
+        EndUniformArenaFrame();
     }
 
     void VulkanPipeline::ClearBuffers() {
@@ -1043,6 +1758,16 @@ namespace SR_GRAPH_NS {
         ++m_state.operations;
         ++m_state.deletions;
 
+        /// вторичные буферы кадрового буфера живут, пока жив его первичный буфер
+        if (*id > 0 && static_cast<uint32_t>(*id - 1) < m_memory->m_countFBO.first && m_memory->m_FBOs[*id - 1]) {
+            if (auto&& pIt = m_secondaryCmds.find(m_memory->m_FBOs[*id - 1]->GetCmd()); pIt != m_secondaryCmds.end()) {
+                for (auto&& secondaryCmd : pIt->second.cmds) {
+                    vkDestroyCommandPool(*m_kernel->GetDevice(), secondaryCmd.pool, nullptr);
+                }
+                m_secondaryCmds.erase(pIt);
+            }
+        }
+
         const bool result = m_memory->FreeFBO(*id - 1);
         *id = SR_ID_INVALID;
         return result;
@@ -1126,6 +1851,10 @@ namespace SR_GRAPH_NS {
         ++m_state.operations;
         ++m_state.deletions;
 
+        if (*id >= 0 && *id < static_cast<int32_t>(m_descriptorSetUBOs.size())) {
+            m_descriptorSetUBOs[*id] = SR_ID_INVALID;
+        }
+
         EVK_PUSH_LOG_LEVEL(EvoVulkan::Tools::LogLevel::ErrorsOnly);
 
         if (!m_memory->FreeDescriptorSet(*id)) {
@@ -1184,6 +1913,22 @@ namespace SR_GRAPH_NS {
         ++m_state.operations;
         ++m_state.deletions;
 
+        if (IsArenaUBO(*id)) {
+            const uint32_t index = static_cast<uint32_t>(*id - m_arenaUBOBase);
+            *id = SR_ID_INVALID;
+
+            if (index >= m_arenaUBOs.size() || !m_arenaUBOs[index].used) {
+                PipelineError("VulkanPipeline::FreeUBO() : arena uniform is not allocated! (" + std::to_string(index) + ")");
+                return false;
+            }
+
+            /// место в кольце вернется вместе с записью, которая его выделила
+            m_arenaUBOs[index] = ArenaUBO();
+            m_freeArenaUBOs.emplace_back(index);
+
+            return true;
+        }
+
         const bool result = m_memory->FreeUBO(*id);
 
         *id = SR_ID_INVALID;
@@ -1290,6 +2035,10 @@ namespace SR_GRAPH_NS {
     void VulkanPipeline::PushConstants(void* pData, uint64_t size) {
         Super::PushConstants(pData, size);
 
+        if (IsCapturing()) {
+            return;
+        }
+
         if (!m_currentVkShader) {
             SRHalt("Shader is nullptr!");
             return;
@@ -1303,10 +2052,12 @@ namespace SR_GRAPH_NS {
             return;
         }
 
-        vkCmdPushConstants(m_currentCmd, m_currentLayout,
-            pushConstants.front().stageFlags,
-            0, size, pData
-        );
+        VulkanCommand command;
+        command.type = VulkanCommandType::PushConstants;
+        command.layout = m_currentLayout;
+        command.stages = pushConstants.front().stageFlags;
+        command.count = static_cast<uint32_t>(size);
+        RecordCommand(command, pData);
     }
 
     void VulkanPipeline::PrepareFrame() {
@@ -1324,7 +2075,9 @@ namespace SR_GRAPH_NS {
             if (!pOverlay->ReCreate()) {
                 PipelineError("VulkanPipeline::PrepareFrame() : failed to re-create \"" + pOverlay->GetName() + "\" overlay!");
             }
-        }
+        }}
+
+        BeginUniformArenaFrame();
     }
 
     void VulkanPipeline::OnMultiSampleChanged() {
@@ -1338,6 +2091,10 @@ namespace SR_GRAPH_NS {
     void VulkanPipeline::BindDescriptorSet(uint32_t descriptorSet) {
         Super::BindDescriptorSet(descriptorSet);
 
+        if (IsCapturing()) {
+            return;
+        }
+
         if (descriptorSet >= m_memory->m_countDescriptorSets.first) {
             PipelineError("VulkanPipeline::BindDescriptorSet() : incorrect range! (" + std::to_string(descriptorSet) + ")");
             return;
@@ -1380,21 +2137,35 @@ namespace SR_GRAPH_NS {
     void VulkanPipeline::BindVBO(uint32_t VBO) {
         Super::BindVBO(VBO);
 
+        if (IsCapturing()) {
+            return;
+        }
+
         if (VBO == SR_ID_INVALID) {
             return;
         }
 
-        vkCmdBindVertexBuffers(m_currentCmd, 0, 1, m_memory->m_VBOs[VBO]->GetCRef(), m_offsets);
+        VulkanCommand command;
+        command.type = VulkanCommandType::BindVertexBuffer;
+        command.buffer = *m_memory->m_VBOs[VBO]->GetCRef();
+        RecordCommand(command);
     }
 
     void VulkanPipeline::BindIBO(uint32_t IBO) {
         Super::BindIBO(IBO);
 
+        if (IsCapturing()) {
+            return;
+        }
+
         if (IBO == SR_ID_INVALID) {
             return;
         }
 
-        vkCmdBindIndexBuffer(m_currentCmd, *m_memory->m_IBOs[IBO], 0, VK_INDEX_TYPE_UINT32);
+        VulkanCommand command;
+        command.type = VulkanCommandType::BindIndexBuffer;
+        command.buffer = *m_memory->m_IBOs[IBO];
+        RecordCommand(command);
     }
 
     void VulkanPipeline::BindUBO(uint32_t UBO) {
@@ -1404,6 +2175,10 @@ namespace SR_GRAPH_NS {
     void VulkanPipeline::BindTexture(uint8_t activeTexture, uint32_t textureId) {
         Super::BindTexture(activeTexture, textureId);
 
+        if (IsCapturing()) {
+            return;
+        }
+
         if (textureId >= m_memory->m_countTextures.first) {
             SRHalt("VulkanPipeline::BindTexture() : incorrect range! (" + std::to_string(textureId) + ")");
             return;
@@ -1435,21 +2210,35 @@ namespace SR_GRAPH_NS {
     void VulkanPipeline::Draw(uint32_t count) {
         Super::Draw(count);
 
-        if (m_currentDescriptorSets) {
-            vkCmdBindDescriptorSets(m_currentCmd, VK_PIPELINE_BIND_POINT_GRAPHICS, m_currentLayout, 0, 1, &m_currentDescriptorSets, 0, NULL);
+        if (IsCapturing()) {
+            return;
+        }
+
+        if (!BindDrawDescriptorSet()) {
+            return;
         }
 
-        vkCmdDraw(m_currentCmd, count, 1, 0, 0);
+        VulkanCommand command;
+        command.type = VulkanCommandType::Draw;
+        command.count = count;
+        RecordCommand(command);
     }
 
     void VulkanPipeline::DrawIndices(uint32_t count) {
         Super::DrawIndices(count);
 
-        if (m_currentDescriptorSets) {
-            vkCmdBindDescriptorSets(m_currentCmd, VK_PIPELINE_BIND_POINT_GRAPHICS, m_currentLayout, 0, 1, &m_currentDescriptorSets, 0, NULL);
+        if (IsCapturing()) {
+            return;
+        }
+
+        if (!BindDrawDescriptorSet()) {
+            return;
         }
 
-        vkCmdDrawIndexed(m_currentCmd, count, 1, 0, 0, 0);
+        VulkanCommand command;
+        command.type = VulkanCommandType::DrawIndexed;
+        command.count = count;
+        RecordCommand(command);
     }
 
     void VulkanPipeline::SetVSyncEnabled(bool enabled) {
@@ -0,0 +1,66 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Graphics/Pipeline/Vulkan/VulkanUniformArena.h>
+
+namespace SR_GRAPH_NS::VulkanTools {
+    VulkanUniformArenaStorage::~VulkanUniformArenaStorage() {
+        DeInit();
+    }
+
+    bool VulkanUniformArenaStorage::Init(uint64_t capacity) {
+        DeInit();
+
+        if (!m_kernel || !m_kernel->GetAllocator()) {
+            SR_ERROR("VulkanUniformArenaStorage::Init() : kernel is not initialized!");
+            return false;
+        }
+
+        m_buffer = EvoVulkan::Types::VmaBuffer::Create(
+            m_kernel->GetAllocator(),
+            VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT,
+            VMA_MEMORY_USAGE_CPU_TO_GPU,
+            capacity
+        );
+
+        if (!m_buffer) {
+            SR_ERROR("VulkanUniformArenaStorage::Init() : failed to create buffer! Size: {}", capacity);
+            return false;
+        }
+
+        /// буфер остается отображенным до DeInit
+        if (!m_buffer->Map() || !(m_mapped = static_cast<char*>(m_buffer->GetMappedMemory()))) {
+            SR_ERROR("VulkanUniformArenaStorage::Init() : failed to map buffer!");
+            DeInit();
+            return false;
+        }
+
+        m_capacity = capacity;
+
+        return true;
+    }
+
+    void VulkanUniformArenaStorage::DeInit() {
+        if (m_buffer && m_mapped) {
+            m_buffer->Unmap();
+        }
+
+        SR_SAFE_DELETE_PTR(m_buffer);
+
+        m_mapped = nullptr;
+        m_capacity = 0;
+    }
+
+    void VulkanUniformArenaStorage::Write(uint64_t offset, const void* pData, uint64_t size) {
+        SRAssert(m_mapped && offset + size <= m_capacity);
+        memcpy(m_mapped + offset, pData, size);
+    }
+
+    VkDescriptorBufferInfo VulkanUniformArenaStorage::GetDescriptor(uint64_t offset, uint64_t size) const {
+        VkDescriptorBufferInfo descriptor = *m_buffer->GetDescriptorRef();
+        descriptor.offset = offset;
+        descriptor.range = size;
+        return descriptor;
+    }
+}
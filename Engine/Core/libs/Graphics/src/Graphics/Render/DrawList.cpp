@@ -0,0 +1,127 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Graphics/Render/DrawList.h>
+
+#include <Utils/Profile/TracyContext.h>
+
+namespace SR_GRAPH_NS {
+    uint64_t DrawSortKey::Opaque(uint64_t layer, uint64_t pass, uint64_t shader, uint64_t material, uint64_t depth) noexcept {
+        return (SR_MIN(layer, MaxLayer) << (PassBits + ShaderBits + MaterialBits + DepthBits))
+            | (SR_MIN(pass, MaxPass) << (ShaderBits + MaterialBits + DepthBits))
+            | (SR_MIN(shader, MaxShader) << (MaterialBits + DepthBits))
+            | (SR_MIN(material, MaxMaterial) << DepthBits)
+            | SR_MIN(depth, MaxDepth);
+    }
+
+    uint64_t DrawSortKey::Transparent(uint64_t layer, uint64_t pass, uint64_t shader, uint64_t material, uint64_t depth) noexcept {
+        /// дальние объекты рисуются первыми, поэтому глубина инвертируется
+        return (SR_MIN(layer, MaxLayer) << (PassBits + DepthBits + ShaderBits + MaterialBits))
+            | (SR_MIN(pass, MaxPass) << (DepthBits + ShaderBits + MaterialBits))
+            | ((MaxDepth - SR_MIN(depth, MaxDepth)) << (ShaderBits + MaterialBits))
+            | (SR_MIN(shader, MaxShader) << MaterialBits)
+            | SR_MIN(material, MaxMaterial);
+    }
+
+    uint64_t DrawSortKey::QuantizeDepth(float_t depth, float_t near, float_t far) noexcept {
+        if (far <= near || !(depth > near)) {
+            return 0;
+        }
+
+        if (depth >= far) {
+            return MaxDepth;
+        }
+
+        return static_cast<uint64_t>(static_cast<double_t>(depth - near) / static_cast<double_t>(far - near) * static_cast<double_t>(MaxDepth));
+    }
+
+    void RadixSortDrawItems(std::vector<DrawSortItem>& items, std::vector<DrawSortItem>& temp) {
+        SR_TRACY_ZONE;
+
+        const uint64_t count = items.size();
+        if (count < 2) {
+            return;
+        }
+
+        temp.resize(count);
+
+        /// гистограммы всех восьми разрядов за один проход
+        uint32_t histograms[8][256] = { };
+
+        for (auto&& item : items) {
+            for (uint32_t digit = 0; digit < 8; ++digit) {
+                ++histograms[digit][(item.key >> (digit * 8)) & 0xFFu];
+            }
+        }
+
+        DrawSortItem* pSource = items.data();
+        DrawSortItem* pDestination = temp.data();
+
+        for (uint32_t digit = 0; digit < 8; ++digit) {
+            auto&& histogram = histograms[digit];
+
+            /// все ключи попадают в одну корзину - разряд ничего не меняет
+            if (histogram[(pSource[0].key >> (digit * 8)) & 0xFFu] == count) {
+                continue;
+            }
+
+            uint32_t offsets[256];
+            uint32_t sum = 0;
+            for (uint32_t i = 0; i < 256; ++i) {
+                offsets[i] = sum;
+                sum += histogram[i];
+            }
+
+            for (uint64_t i = 0; i < count; ++i) {
+                pDestination[offsets[(pSource[i].key >> (digit * 8)) & 0xFFu]++] = pSource[i];
+            }
+
+            std::swap(pSource, pDestination);
+        }
+
+        if (pSource != items.data()) {
+            items.swap(temp);
+        }
+    }
+
+    void DrawList::Clear() {
+        m_draws.clear();
+        m_items.clear();
+        m_shaders.clear();
+        m_materials.clear();
+    }
+
+    uint64_t DrawList::GetShaderIndex(ShaderPtr pShader) {
+        return m_shaders.insert(std::make_pair(pShader, static_cast<uint64_t>(m_shaders.size()))).first->second;
+    }
+
+    uint64_t DrawList::GetMaterialIndex(MaterialPtr pMaterial) {
+        return m_materials.insert(std::make_pair(pMaterial, static_cast<uint64_t>(m_materials.size()))).first->second;
+    }
+
+    void DrawList::Add(uint64_t key, const Draw& draw) {
+        DrawSortItem item;
+        item.key = key;
+        item.index = static_cast<uint32_t>(m_draws.size());
+
+        m_draws.emplace_back(draw);
+        m_items.emplace_back(item);
+    }
+
+    void DrawList::Sort() {
+        RadixSortDrawItems(m_items, m_temp);
+    }
+
+    uint64_t DrawList::GetOrderHash(uint64_t pass) const {
+        uint64_t hash = 0;
+
+        for (auto&& item : m_items) {
+            if (DrawSortKey::GetPass(item.key) == pass) {
+                hash = SR_COMBINE_HASHES(hash, reinterpret_cast<uint64_t>(m_draws[item.index].pMesh));
+            }
+        }
+
+        return hash;
+    }
+}
@@ -33,15 +33,26 @@ namespace SR_GRAPH_NS {
 
         bool hasDrawData = false;
 
-        for (auto&& pass : m_passes) {
+        for (auto&& pass : m_executionOrder) {
             hasDrawData |= pass->PreRender();
         }
 
-        for (auto&& pass : m_passes) {
-            hasDrawData |= pass->Render();
+        auto&& pPipeline = GetRenderScene()->GetPipeline();
+
+        /// проходы одной глубины независимы, поэтому вторичные буферы всех их команд пишутся одной порцией
+        for (uint32_t i = 0; i < static_cast<uint32_t>(m_executionOrder.size()); ++i) {
+            if (i == 0 || m_executionDepths[i] != m_executionDepths[i - 1]) {
+                pPipeline->BeginCommandBatch();
+            }
+
+            hasDrawData |= m_executionOrder[i]->Render();
+
+            if (i + 1 == m_executionOrder.size() || m_executionDepths[i + 1] != m_executionDepths[i]) {
+                pPipeline->EndCommandBatch();
+            }
         }
 
-        for (auto&& pass : m_passes) {
+        for (auto&& pass : m_executionOrder) {
             hasDrawData |= pass->PostRender();
         }
 
@@ -55,7 +66,7 @@ namespace SR_GRAPH_NS {
             return;
         }
 
-        for (auto&& pass : m_passes) {
+        for (auto&& pass : m_executionOrder) {
             pass->Prepare();
         }
     }
@@ -69,8 +80,13 @@ namespace SR_GRAPH_NS {
 
         m_uboManager.SetIdentifier(GetCamera());
 
-        for (auto&& pass : m_passes) {
+        for (auto&& pass : m_executionOrder) {
             pass->Update();
+
+            /// проход пишет прямо в буфер команд экрана, его отдельно не перезаписать
+            if (pass->IsRecordOutdated()) {
+                GetRenderScene()->SetDirty();
+            }
         }
     }
 
@@ -183,7 +199,16 @@ namespace SR_GRAPH_NS {
         }
     }
 
+    void IRenderTechnique::OnMeshRemoved(SR_GTYPES_NS::Mesh* pMesh, bool transparent) {
+        for (auto&& pPass : m_passes) {
+            pPass->OnMeshRemoved(pMesh, transparent);
+        }
+    }
+
     void IRenderTechnique::DeInitPasses() {
+        m_executionOrder.clear();
+        m_renderGraph.Clear();
+
         for (auto&& pPass : m_passes) {
             if (pPass->IsInit()) {
                 pPass->DeInit();
@@ -193,6 +218,91 @@ namespace SR_GRAPH_NS {
         m_passes.clear();
     }
 
+    void IRenderTechnique::DeclareRenderGraph(RenderGraph& graph, const std::vector<BasePass*>& passes) {
+        for (auto&& pPass : passes) {
+            RenderGraphPassBuilder builder(graph, graph.AddPass(pPass->GetName()));
+            pPass->DeclareResources(builder);
+
+            /// проход без собственного кадрового буфера рисует в цель вне техники
+            auto&& accesses = graph.GetPasses()[builder.GetPass()].accesses;
+            if (std::none_of(accesses.begin(), accesses.end(), [](auto&& access) { return access.write; })) {
+                builder.SetSideEffects();
+            }
+        }
+    }
+
+    void IRenderTechnique::CompileRenderGraph() {
+        SR_TRACY_ZONE;
+
+        m_renderGraph.Clear();
+        m_executionOrder.clear();
+        m_executionDepths.clear();
+
+        /// идентификатор прохода в графе совпадает с индексом в m_passes
+        DeclareRenderGraph(m_renderGraph, m_passes);
+
+        if (!m_renderGraph.Compile()) {
+            SR_ERROR("IRenderTechnique::CompileRenderGraph() : failed to compile render graph, passes will be executed in declaration order!"
+                "\n\tTechnique: " + std::string(GetName()));
+            m_executionOrder = m_passes;
+
+            /// о независимости проходов ничего не известно, каждый записывается своей порцией
+            for (uint32_t i = 0; i < static_cast<uint32_t>(m_passes.size()); ++i) {
+                m_executionDepths.emplace_back(i);
+            }
+
+            /// без явных очередей и без графа порядок известен только из объявления, каждый проход ждет предыдущий
+            if (m_queues.empty()) {
+                for (auto&& pPass : m_passes) {
+                    m_queues.emplace_back(PassQueue { pPass });
+                }
+            }
+
+            return;
+        }
+
+        /// глубина растет вдоль каждой зависимости, поэтому порядок по глубине тоже топологический
+        auto compiledPasses = m_renderGraph.GetCompiledPasses();
+        std::stable_sort(compiledPasses.begin(), compiledPasses.end(), [](auto&& left, auto&& right) {
+            return left.depth < right.depth;
+        });
+
+        for (auto&& compiledPass : compiledPasses) {
+            m_executionOrder.emplace_back(m_passes[compiledPass.pass]);
+            m_executionDepths.emplace_back(compiledPass.depth);
+        }
+
+        for (uint32_t i = 0; i < static_cast<uint32_t>(m_passes.size()); ++i) {
+            if (m_renderGraph.IsPassCulled(i)) {
+                SR_GRAPH_LOG("IRenderTechnique::CompileRenderGraph() : pass \"" + m_passes[i]->GetName().ToString() +
+                    "\" is culled, nothing reads its output");
+            }
+        }
+
+        /// без явных очередей каждая глубина графа становится отдельной очередью
+        if (m_queues.empty()) {
+            for (auto&& compiledPass : m_renderGraph.GetCompiledPasses()) {
+                if (m_queues.size() <= compiledPass.depth) {
+                    m_queues.resize(compiledPass.depth + 1);
+                }
+                m_queues[compiledPass.depth].emplace_back(m_passes[compiledPass.pass]);
+            }
+            return;
+        }
+
+        /// отсеченные проходы не записываются, их буферы не должны попасть в очередь отправки
+        for (auto&& queue : m_queues) {
+            queue.erase(std::remove_if(queue.begin(), queue.end(), [this](BasePass* pPass) {
+                auto&& pIt = std::find(m_passes.begin(), m_passes.end(), pPass);
+                return pIt != m_passes.end() && m_renderGraph.IsPassCulled(static_cast<uint32_t>(pIt - m_passes.begin()));
+            }), queue.end());
+        }
+
+        m_queues.erase(std::remove_if(m_queues.begin(), m_queues.end(), [](const PassQueue& queue) {
+            return queue.empty();
+        }), m_queues.end());
+    }
+
     bool IRenderTechnique::ForEachPass(const SR_HTYPES_NS::Function<bool(BasePass*)>& callback) const {
         for (auto&& pPass : m_passes) {
             if (!callback(pPass)) {
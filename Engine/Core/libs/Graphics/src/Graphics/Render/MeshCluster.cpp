@@ -100,6 +100,10 @@ namespace SR_GRAPH_NS {
                     SRAssert2(pMaterial, "Mesh have not material!");
 
                     if (pMesh->IsMeshDestroyed()) {
+                        if (m_onMeshRemoved) {
+                            m_onMeshRemoved(pMesh);
+                        }
+
                         auto&& resourceManager = SR_UTILS_NS::ResourceManager::Instance();
                         SR_MAYBE_UNUSED SR_HTYPES_NS::SingletonRecursiveLockGuard lock(&resourceManager);
 
@@ -9,6 +9,7 @@
 #include <Graphics/Window/Window.h>
 #include <Graphics/Memory/ShaderProgramManager.h>
 #include <Graphics/Pipeline/Vulkan/VulkanPipeline.h>
+#include <Graphics/Pipeline/CommandList.h>
 #include <Graphics/Pass/FramebufferPass.h>
 
 #include <Graphics/Types/Framebuffer.h>
@@ -109,6 +110,11 @@ namespace SR_GRAPH_NS {
         Memory::CameraManager::Instance().SetPipeline(m_pipeline);
         Memory::ShaderProgramManager::Instance().SetPipeline(m_pipeline);
 
+        /// вызывающий поток тоже записывает, поэтому рабочих на один меньше
+        const uint32_t threads = std::thread::hardware_concurrency();
+        const uint32_t workers = threads > 1 ? threads - 1 : 0;
+        m_commandRecorder = new ParallelCommandRecorder(SR_MIN(workers, 3u));
+
         /// ----------------------------------------------------------------------------
 
         Memory::TextureConfig config;
@@ -418,6 +424,8 @@ namespace SR_GRAPH_NS {
     RenderContext::~RenderContext() {
         SRAssert(IsEmpty());
 
+        delete m_commandRecorder;
+
         m_pipeline.AutoFree([](auto&& pPipeline) {
             pPipeline->Destroy();
             delete pPipeline;
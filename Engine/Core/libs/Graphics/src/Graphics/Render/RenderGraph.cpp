@@ -0,0 +1,388 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Graphics/Render/RenderGraph.h>
+
+#include <Utils/Profile/TracyContext.h>
+
+namespace SR_GRAPH_NS {
+    void RenderGraph::Clear() {
+        m_passes.clear();
+        m_resources.clear();
+        m_resourceNames.clear();
+        m_producers.clear();
+        m_predecessors.clear();
+        m_compiledPasses.clear();
+        m_barriers.clear();
+        m_physicalCount = 0;
+        m_compiled = false;
+    }
+
+    RenderGraph::ResourceId RenderGraph::DeclareResource(const SR_UTILS_NS::StringAtom& name, const RenderGraphResourceDesc& desc) {
+        const ResourceId id = GetOrAddResource(name);
+        m_resources[id].desc = desc;
+        return id;
+    }
+
+    RenderGraph::ResourceId RenderGraph::GetOrAddResource(const SR_UTILS_NS::StringAtom& name) {
+        if (auto&& pIt = m_resourceNames.find(name); pIt != m_resourceNames.end()) {
+            return pIt->second;
+        }
+
+        const auto id = static_cast<ResourceId>(m_resources.size());
+
+        auto&& resource = m_resources.emplace_back();
+        resource.name = name;
+
+        m_resourceNames.insert(std::make_pair(name, id));
+        m_compiled = false;
+
+        return id;
+    }
+
+    RenderGraph::ResourceId RenderGraph::FindResource(const SR_UTILS_NS::StringAtom& name) const {
+        if (auto&& pIt = m_resourceNames.find(name); pIt != m_resourceNames.end()) {
+            return pIt->second;
+        }
+
+        return InvalidId;
+    }
+
+    RenderGraph::PassId RenderGraph::AddPass(const SR_UTILS_NS::StringAtom& name, bool sideEffects) {
+        auto&& pass = m_passes.emplace_back();
+        pass.name = name;
+        pass.sideEffects = sideEffects;
+
+        m_compiled = false;
+
+        return static_cast<PassId>(m_passes.size() - 1);
+    }
+
+    void RenderGraph::SetSideEffects(PassId pass, bool sideEffects) {
+        m_passes[pass].sideEffects = sideEffects;
+        m_compiled = false;
+    }
+
+    void RenderGraph::Read(PassId pass, ResourceId resource, RenderGraphResourceState state) {
+        m_passes[pass].accesses.emplace_back(Access { resource, state, false });
+        m_compiled = false;
+    }
+
+    void RenderGraph::Write(PassId pass, ResourceId resource, RenderGraphResourceState state) {
+        m_passes[pass].accesses.emplace_back(Access { resource, state, true });
+        m_compiled = false;
+    }
+
+    bool RenderGraph::Compile() {
+        SR_TRACY_ZONE;
+
+        m_compiledPasses.clear();
+        m_barriers.clear();
+        m_physicalCount = 0;
+        m_compiled = false;
+
+        for (auto&& resource : m_resources) {
+            resource.physical = InvalidId;
+            resource.firstUse = InvalidId;
+            resource.lastUse = InvalidId;
+        }
+
+        if (!BuildDependencies()) {
+            return false;
+        }
+
+        CullPasses();
+
+        if (!SortPasses()) {
+            return false;
+        }
+
+        AliasResources();
+        ComputeBarriers();
+
+        m_compiled = true;
+
+        return true;
+    }
+
+    bool RenderGraph::BuildDependencies() {
+        const auto passesCount = static_cast<uint32_t>(m_passes.size());
+
+        m_producers.assign(passesCount, { });
+        m_predecessors.assign(passesCount, { });
+
+        auto&& addEdge = [this](PassId from, PassId to, bool data) {
+            if (from == to) {
+                return;
+            }
+
+            auto&& predecessors = m_predecessors[to];
+            if (std::find(predecessors.begin(), predecessors.end(), from) == predecessors.end()) {
+                predecessors.emplace_back(from);
+            }
+
+            auto&& producers = m_producers[to];
+            if (data && std::find(producers.begin(), producers.end(), from) == producers.end()) {
+                producers.emplace_back(from);
+            }
+        };
+
+        std::vector<PassId> lastWriters(m_resources.size(), InvalidId);
+        std::vector<std::vector<PassId>> readers(m_resources.size());
+
+        for (PassId passId = 0; passId < passesCount; ++passId) {
+            auto&& pass = m_passes[passId];
+
+            for (auto&& access : pass.accesses) {
+                if (access.write) {
+                    continue;
+                }
+
+                if (lastWriters[access.resource] != InvalidId) {
+                    addEdge(lastWriters[access.resource], passId, true);
+                }
+                /// до первой записи в кадре у временного ресурса нет содержимого
+                else if (m_resources[access.resource].desc.transient) {
+                    SR_ERROR("RenderGraph::BuildDependencies() : pass \"" + pass.name.ToString() +
+                        "\" reads transient resource \"" + m_resources[access.resource].name.ToString() + "\" before it is written!");
+                    return false;
+                }
+
+                /// чтение до первой записи видит прошлый кадр или импортированные данные,
+                /// поэтому первая запись кадра обязана идти после него
+                readers[access.resource].emplace_back(passId);
+            }
+
+            for (auto&& access : pass.accesses) {
+                if (!access.write) {
+                    continue;
+                }
+
+                /// запись после чтения и запись после записи - только порядок, данные предыдущей версии не нужны
+                for (auto&& readerId : readers[access.resource]) {
+                    addEdge(readerId, passId, false);
+                }
+                readers[access.resource].clear();
+
+                if (lastWriters[access.resource] != InvalidId) {
+                    addEdge(lastWriters[access.resource], passId, false);
+                }
+
+                lastWriters[access.resource] = passId;
+            }
+        }
+
+        return true;
+    }
+
+    void RenderGraph::CullPasses() {
+        std::vector<PassId> stack;
+        stack.reserve(m_passes.size());
+
+        for (PassId passId = 0; passId < static_cast<PassId>(m_passes.size()); ++passId) {
+            auto&& pass = m_passes[passId];
+
+            bool isRoot = pass.sideEffects;
+
+            for (auto&& access : pass.accesses) {
+                isRoot |= access.write && !m_resources[access.resource].desc.transient;
+            }
+
+            pass.culled = !isRoot;
+
+            if (isRoot) {
+                stack.emplace_back(passId);
+            }
+        }
+
+        while (!stack.empty()) {
+            const PassId passId = stack.back();
+            stack.pop_back();
+
+            for (auto&& producerId : m_producers[passId]) {
+                if (m_passes[producerId].culled) {
+                    m_passes[producerId].culled = false;
+                    stack.emplace_back(producerId);
+                }
+            }
+        }
+    }
+
+    bool RenderGraph::SortPasses() {
+        const auto passesCount = static_cast<uint32_t>(m_passes.size());
+
+        std::vector<uint32_t> inDegree(passesCount, 0);
+        std::vector<std::vector<PassId>> successors(passesCount);
+
+        uint32_t aliveCount = 0;
+
+        for (PassId passId = 0; passId < passesCount; ++passId) {
+            if (m_passes[passId].culled) {
+                continue;
+            }
+
+            ++aliveCount;
+
+            for (auto&& predecessorId : m_predecessors[passId]) {
+                if (m_passes[predecessorId].culled) {
+                    continue;
+                }
+
+                successors[predecessorId].emplace_back(passId);
+                ++inDegree[passId];
+            }
+        }
+
+        /// среди готовых проходов первым идет объявленный раньше, поэтому уже упорядоченный граф не меняется
+        std::priority_queue<PassId, std::vector<PassId>, std::greater<>> ready;
+
+        for (PassId passId = 0; passId < passesCount; ++passId) {
+            if (!m_passes[passId].culled && inDegree[passId] == 0) {
+                ready.push(passId);
+            }
+        }
+
+        m_compiledPasses.reserve(aliveCount);
+
+        std::vector<uint32_t> depths(passesCount, 0);
+
+        while (!ready.empty()) {
+            const PassId passId = ready.top();
+            ready.pop();
+
+            auto&& compiledPass = m_compiledPasses.emplace_back();
+            compiledPass.pass = passId;
+            compiledPass.depth = depths[passId];
+
+            for (auto&& successorId : successors[passId]) {
+                depths[successorId] = SR_MAX(depths[successorId], depths[passId] + 1);
+
+                if (--inDegree[successorId] == 0) {
+                    ready.push(successorId);
+                }
+            }
+        }
+
+        if (m_compiledPasses.size() != aliveCount) {
+            std::string passes;
+
+            for (PassId passId = 0; passId < passesCount; ++passId) {
+                if (!m_passes[passId].culled && inDegree[passId] > 0) {
+                    passes += "\n\t" + m_passes[passId].name.ToString();
+                }
+            }
+
+            SR_ERROR("RenderGraph::SortPasses() : dependency cycle between passes:" + passes);
+
+            m_compiledPasses.clear();
+
+            return false;
+        }
+
+        return true;
+    }
+
+    void RenderGraph::AliasResources() {
+        for (uint32_t order = 0; order < static_cast<uint32_t>(m_compiledPasses.size()); ++order) {
+            for (auto&& access : m_passes[m_compiledPasses[order].pass].accesses) {
+                auto&& resource = m_resources[access.resource];
+                resource.firstUse = SR_MIN(resource.firstUse, order);
+                resource.lastUse = resource.lastUse == InvalidId ? order : SR_MAX(resource.lastUse, order);
+            }
+        }
+
+        std::vector<ResourceId> transient;
+        transient.reserve(m_resources.size());
+
+        for (ResourceId resourceId = 0; resourceId < static_cast<ResourceId>(m_resources.size()); ++resourceId) {
+            auto&& resource = m_resources[resourceId];
+            if (resource.desc.transient && resource.firstUse != InvalidId) {
+                transient.emplace_back(resourceId);
+            }
+        }
+
+        std::stable_sort(transient.begin(), transient.end(), [this](ResourceId lhs, ResourceId rhs) {
+            return m_resources[lhs].firstUse < m_resources[rhs].firstUse;
+        });
+
+        /// для каждого физического слота - ресурс, который занимал его последним
+        std::vector<ResourceId> slots;
+
+        for (auto&& resourceId : transient) {
+            auto&& resource = m_resources[resourceId];
+
+            for (uint32_t slot = 0; slot < static_cast<uint32_t>(slots.size()); ++slot) {
+                auto&& owner = m_resources[slots[slot]];
+                if (owner.lastUse < resource.firstUse && owner.desc.IsCompatible(resource.desc)) {
+                    resource.physical = slot;
+                    slots[slot] = resourceId;
+                    break;
+                }
+            }
+
+            if (resource.physical == InvalidId) {
+                resource.physical = static_cast<uint32_t>(slots.size());
+                slots.emplace_back(resourceId);
+            }
+        }
+
+        m_physicalCount = static_cast<uint32_t>(slots.size());
+    }
+
+    void RenderGraph::ComputeBarriers() {
+        struct ResourceState {
+            RenderGraphResourceState state = RenderGraphResourceState::Undefined;
+            bool written = false;
+        };
+
+        std::vector<ResourceState> states(m_resources.size());
+        for (ResourceId resourceId = 0; resourceId < static_cast<ResourceId>(m_resources.size()); ++resourceId) {
+            auto&& desc = m_resources[resourceId].desc;
+            states[resourceId].state = desc.transient ? RenderGraphResourceState::Undefined : desc.initialState;
+        }
+
+        for (auto&& compiledPass : m_compiledPasses) {
+            auto&& accesses = m_passes[compiledPass.pass].accesses;
+
+            compiledPass.barrierOffset = static_cast<uint32_t>(m_barriers.size());
+
+            for (uint32_t i = 0; i < static_cast<uint32_t>(accesses.size()); ++i) {
+                const ResourceId resourceId = accesses[i].resource;
+
+                /// ресурс мог встретиться в проходе раньше - состояние уже выставлено
+                bool isDuplicate = false;
+                for (uint32_t j = 0; j < i; ++j) {
+                    isDuplicate |= accesses[j].resource == resourceId;
+                }
+
+                if (isDuplicate) {
+                    continue;
+                }
+
+                /// при чтении и записи в одном проходе нужно состояние записи
+                RenderGraphResourceState required = accesses[i].state;
+                bool write = accesses[i].write;
+
+                for (uint32_t j = i + 1; j < static_cast<uint32_t>(accesses.size()); ++j) {
+                    if (accesses[j].resource == resourceId && accesses[j].write && !write) {
+                        required = accesses[j].state;
+                        write = true;
+                    }
+                }
+
+                auto&& state = states[resourceId];
+
+                /// чтение после чтения в том же состоянии не требует синхронизации, все остальное требует
+                if (state.state != required || state.written) {
+                    m_barriers.emplace_back(Barrier { resourceId, state.state, required });
+                }
+
+                state.state = required;
+                state.written = write;
+            }
+
+            compiledPass.barrierCount = static_cast<uint32_t>(m_barriers.size()) - compiledPass.barrierOffset;
+        }
+    }
+}
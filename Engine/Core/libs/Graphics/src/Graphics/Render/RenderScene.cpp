@@ -4,8 +4,10 @@
 
 #include <Utils/DebugDraw.h>
 #include <Utils/Types/SafePtrLockGuard.h>
+#include <Utils/Profile/Profiler.h>
 
 #include <Graphics/Render/RenderScene.h>
+#include <Graphics/Memory/UniformArena.h>
 #include <Graphics/Render/RenderContext.h>
 #include <Graphics/Memory/CameraManager.h>
 #include <Graphics/Types/Camera.h>
@@ -26,6 +28,19 @@ namespace SR_GRAPH_NS {
         , m_transparent(&m_opaque)
         , m_flat(this)
     {
+        /// проходы могут держать меши между записями команд, узнают об удалении до освобождения
+        m_opaque.SetMeshRemovedCallback([this](MeshPtr pMesh) {
+            ForEachTechnique([pMesh](IRenderTechnique* pTechnique) {
+                pTechnique->OnMeshRemoved(pMesh, false);
+            });
+        });
+
+        m_transparent.SetMeshRemovedCallback([this](MeshPtr pMesh) {
+            ForEachTechnique([pMesh](IRenderTechnique* pTechnique) {
+                pTechnique->OnMeshRemoved(pMesh, true);
+            });
+        });
+
         m_debugRender->Init();
     }
 
@@ -49,7 +64,7 @@ namespace SR_GRAPH_NS {
     }
 
     void RenderScene::Render() noexcept {
-        SR_TRACY_ZONE_N("Render scene");
+        SR_PROFILE_ZONE_N("Render scene");
 
         PrepareFrame();
 
@@ -136,7 +151,7 @@ namespace SR_GRAPH_NS {
     }
 
     void RenderScene::Build() {
-        SR_TRACY_ZONE_N("Build render");
+        SR_PROFILE_ZONE_N("Build render");
 
         GetPipeline()->ClearFrameBuffersQueue();
 
@@ -154,13 +169,15 @@ namespace SR_GRAPH_NS {
     }
 
     void RenderScene::Update() noexcept {
-        SR_TRACY_ZONE_N("Update render");
+        SR_PROFILE_ZONE_N("Update render");
+
+        m_lightSystem->UpdateClusters(m_mainCamera.Get());
 
         SR_RENDER_TECHNIQUES_CALL(Update)
     }
 
     void RenderScene::Submit() noexcept {
-        SR_TRACY_ZONE_N("Submit frame");
+        SR_PROFILE_ZONE_N("Submit frame");
 
         GetPipeline()->DrawFrame();
     }
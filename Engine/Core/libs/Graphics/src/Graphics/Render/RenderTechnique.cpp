@@ -85,6 +85,8 @@ namespace SR_GRAPH_NS {
 
         SR_GRAPH_LOG("RenderTechnique::Build() : building \"" + std::string(GetName()) + "\" render technique...");
 
+        CompileRenderGraph();
+
         /// Инициализируем все успешно загруженнеы проходы
         for (auto&& pPass : m_passes) {
             pPass->Init();
@@ -127,11 +129,7 @@ namespace SR_GRAPH_NS {
             }
         }
 
-        if (!m_passes.empty() && m_queues.empty()) {
-            SR_ERROR("RenderTechnique::LoadSettings() : passes was loaded, but queue is empty!\n\tTechnique: " + GetResourcePath().ToStringRef());
-            return false;
-        }
-
+        /// без узла Queues очереди строятся по графу в CompileRenderGraph
         return true;
     }
 
@@ -95,6 +95,11 @@ namespace SR_GTYPES_NS {
         Mesh::OnResourceReloaded(pResource);
     }
 
+    void DebugWireframeMesh::OnRawMeshChanged() {
+        IRawMeshHolder::OnRawMeshChanged();
+        MarkMeshKeyDirty();
+    }
+
     void DebugWireframeMesh::UseMaterial() {
         Mesh::UseMaterial();
         static const uint64_t colorHashName = SR_UTILS_NS::StringAtom("color").GetHash();
@@ -28,8 +28,10 @@ namespace SR_GTYPES_NS {
 
         using namespace Memory;
 
+        const MeshKey key = GetMeshKey<Vertices::VertexType::Unknown, MeshMemoryType::IBO>();
+
         if (!IsUniqueMesh()) {
-            m_IBO = MeshManager::Instance().CopyIfExists<Vertices::VertexType::Unknown, MeshMemoryType::IBO>(GetMeshIdentifier());
+            m_IBO = MeshManager::Instance().CopyIfExists<MeshMemoryType::IBO>(key);
         }
 
         if (m_IBO == SR_ID_INVALID) {
@@ -49,17 +51,11 @@ namespace SR_GTYPES_NS {
                 return Mesh::Calculate();
             }
 
-            return MeshManager::Instance().Register<Vertices::VertexType::Unknown, MeshMemoryType::IBO>(
-                GetMeshIdentifier(),
-                m_countIndices,
-                m_IBO
-            );
+            return MeshManager::Instance().Register<MeshMemoryType::IBO>(key, m_countIndices, m_IBO);
         }
 
         if (!IsUniqueMesh()) {
-            m_countIndices = MeshManager::Instance().Size<Vertices::VertexType::Unknown, MeshMemoryType::IBO>(
-                GetMeshIdentifier()
-            );
+            m_countIndices = MeshManager::Instance().Size<MeshMemoryType::IBO>(key);
         }
 
         return true;
@@ -35,11 +35,16 @@ namespace SR_GTYPES_NS {
         }
 
         if (!CalculateVBO<Vertices::VertexType::StaticMeshVertex, Vertices::StaticMeshVertex>([this]() {
+            if (auto&& pBakedMesh = GetBakedMesh()) {
+                return Vertices::CastVertices<Vertices::StaticMeshVertex>(*pBakedMesh, GetMeshId());
+            }
             return Vertices::CastVertices<Vertices::StaticMeshVertex>(GetVertices());
         })) {
             return false;
         }
 
+        m_localBoundingRadius = GetRawMesh()->GetBoundingRadius(GetMeshId());
+
         return IndexedMesh::Calculate();
     }
 
@@ -113,6 +118,8 @@ namespace SR_GTYPES_NS {
     void Mesh3D::OnRawMeshChanged() {
         IRawMeshHolder::OnRawMeshChanged();
 
+        MarkMeshKeyDirty();
+
         if (GetRawMesh() && IsValidMeshId()) {
             SetGeometryName(GetRawMesh()->GetGeometryName(GetMeshId()));
         }
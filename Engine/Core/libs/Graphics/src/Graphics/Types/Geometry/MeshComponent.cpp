@@ -82,9 +82,28 @@ namespace SR_GTYPES_NS {
             m_translation = SR_MATH_NS::FVector3::Zero();
         }
 
+        ++m_matrixVersion;
+
         Component::OnMatrixDirty();
     }
 
+    bool MeshComponent::GetBoundingSphere(SR_MATH_NS::FVector3& center, float_t& radius) const {
+        if (m_localBoundingRadius < 0.f) {
+            return false;
+        }
+
+        /// масштаб - наибольшая длина базисных векторов матрицы модели
+        float_t scale = 0.f;
+        for (int32_t i = 0; i < 3; ++i) {
+            scale = SR_MAX(scale, m_modelMatrix[i].XYZ().Length());
+        }
+
+        center = m_translation;
+        radius = m_localBoundingRadius * scale;
+
+        return true;
+    }
+
     void MeshComponent::FreeMesh() {
         AutoFree([](auto&& pData) {
             delete pData;
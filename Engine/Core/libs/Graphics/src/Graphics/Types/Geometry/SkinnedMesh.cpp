@@ -37,6 +37,9 @@ namespace SR_GTYPES_NS {
         }
 
         if (!CalculateVBO<Vertices::VertexType::SkinnedMeshVertex, Vertices::SkinnedMeshVertex>([this]() {
+            if (auto&& pBakedMesh = GetBakedMesh()) {
+                return Vertices::CastVertices<Vertices::SkinnedMeshVertex>(*pBakedMesh, GetMeshId());
+            }
             return Vertices::CastVertices<Vertices::SkinnedMeshVertex>(GetVertices());
         })) {
             return false;
@@ -206,6 +209,8 @@ namespace SR_GTYPES_NS {
     void SkinnedMesh::OnRawMeshChanged() {
         IRawMeshHolder::OnRawMeshChanged();
 
+        MarkMeshKeyDirty();
+
         if (GetRawMesh() && IsValidMeshId()) {
             SetGeometryName(GetRawMesh()->GetGeometryName(GetMeshId()));
         }
@@ -0,0 +1,128 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Graphics/Utils/ShadowCascades.h>
+
+namespace SR_GRAPH_NS {
+    std::vector<float_t> CalculateCascadeSplits(float_t near, float_t far, uint32_t count, float_t lambda) {
+        std::vector<float_t> splits(count);
+
+        const float_t clipRange = far - near;
+        const float_t ratio = far / near;
+
+        for (uint32_t i = 0; i < count; ++i) {
+            const float_t p = static_cast<float_t>(i + 1) / static_cast<float_t>(count);
+            const float_t log = near * std::pow(ratio, p);
+            const float_t uniform = near + clipRange * p;
+            const float_t d = lambda * (log - uniform) + uniform;
+            splits[i] = (d - near) / clipRange;
+        }
+
+        return splits;
+    }
+
+    SR_MATH_NS::Matrix4x4 GetShadowLightRotation(const SR_MATH_NS::FVector3& lightDirection) {
+        return SR_MATH_NS::Matrix4x4::LookAt(SR_MATH_NS::FVector3(0.f), lightDirection, SR_MATH_NS::FVector3(0.f, 1.f, 0.f));
+    }
+
+    ShadowCascade CalculateShadowCascade(
+        const SR_MATH_NS::Matrix4x4& invViewProjection,
+        float_t lastSplit, float_t split, float_t near, float_t far,
+        const SR_MATH_NS::FVector3& lightDirection, uint32_t resolution, float_t extentScale)
+    {
+        SR_MATH_NS::FVector3 frustumCorners[8] = {
+            SR_MATH_NS::FVector3(-1.0f,  1.0f, -1.0f),
+            SR_MATH_NS::FVector3( 1.0f,  1.0f, -1.0f),
+            SR_MATH_NS::FVector3( 1.0f, -1.0f, -1.0f),
+            SR_MATH_NS::FVector3(-1.0f, -1.0f, -1.0f),
+            SR_MATH_NS::FVector3(-1.0f,  1.0f,  1.0f),
+            SR_MATH_NS::FVector3( 1.0f,  1.0f,  1.0f),
+            SR_MATH_NS::FVector3( 1.0f, -1.0f,  1.0f),
+            SR_MATH_NS::FVector3(-1.0f, -1.0f,  1.0f),
+        };
+
+        for (auto&& corner : frustumCorners) {
+            SR_MATH_NS::FVector4 invCorner = invViewProjection * SR_MATH_NS::FVector4(corner, 1.0f);
+            corner = (invCorner / invCorner.w).XYZ();
+        }
+
+        for (uint32_t j = 0; j < 4; ++j) {
+            SR_MATH_NS::FVector3 dist = frustumCorners[j + 4] - frustumCorners[j];
+            frustumCorners[j + 4] = frustumCorners[j] + (dist * split);
+            frustumCorners[j] = frustumCorners[j] + (dist * lastSplit);
+        }
+
+        SR_MATH_NS::FVector3 frustumCenter = SR_MATH_NS::FVector3(0.0f);
+        for (auto&& corner : frustumCorners) {
+            frustumCenter += corner;
+        }
+        frustumCenter /= 8.0f;
+
+        float_t radius = 0.0f;
+        for (auto&& corner : frustumCorners) {
+            radius = SR_MAX(radius, (corner - frustumCenter).Length());
+        }
+        radius = std::ceil(radius * 16.0f) / 16.0f;
+
+        const float_t extent = radius * SR_MAX(extentScale, 1.f);
+
+        if (resolution > 0) {
+            auto&& lightRotation = GetShadowLightRotation(lightDirection);
+
+            const float_t texelSize = 2.f * extent / static_cast<float_t>(resolution);
+
+            SR_MATH_NS::FVector4 lightSpaceCenter = lightRotation * SR_MATH_NS::FVector4(frustumCenter, 1.f);
+            lightSpaceCenter.x = std::floor(lightSpaceCenter.x / texelSize) * texelSize;
+            lightSpaceCenter.y = std::floor(lightSpaceCenter.y / texelSize) * texelSize;
+
+            frustumCenter = (lightRotation.Inverse() * lightSpaceCenter).XYZ();
+        }
+
+        const SR_MATH_NS::FVector3 maxExtents = SR_MATH_NS::FVector3(extent);
+        const SR_MATH_NS::FVector3 minExtents = -maxExtents;
+
+        auto&& lightViewMatrix = SR_MATH_NS::Matrix4x4::LookAt(
+            frustumCenter - lightDirection * -minExtents.z, frustumCenter, SR_MATH_NS::FVector3(0.0f, 1.0f, 0.0f)
+        );
+
+        auto&& lightOrthoMatrix = SR_MATH_NS::Matrix4x4::Ortho(
+            minExtents.x, maxExtents.x, minExtents.y, maxExtents.y, 0.0f, maxExtents.z - minExtents.z
+        );
+
+        ShadowCascade cascade;
+        cascade.viewProjection = lightOrthoMatrix * lightViewMatrix;
+        cascade.center = frustumCenter;
+        cascade.radius = radius;
+        cascade.extent = extent;
+        cascade.splitDepth = (near + split * (far - near)) * -1.0f;
+
+        return cascade;
+    }
+
+    bool IsSphereInShadowCascade(const ShadowCascade& cascade, const SR_MATH_NS::Matrix4x4& lightRotation,
+        const SR_MATH_NS::FVector3& center, float_t radius, float_t margin)
+    {
+        const SR_MATH_NS::FVector4 offset = lightRotation * SR_MATH_NS::FVector4(center - cascade.center, 0.f);
+
+        const float_t extent = cascade.radius + margin + radius;
+
+        if (std::abs(offset.x) > extent || std::abs(offset.y) > extent) {
+            return false;
+        }
+
+        /// пространство света смотрит вдоль -Z, объекты за задней гранью каскада тень в него не отбрасывают
+        return -offset.z <= extent;
+    }
+
+    bool IsShadowCascadeCovered(const ShadowCascade& cached, const ShadowCascade& cascade,
+        const SR_MATH_NS::Matrix4x4& lightRotation, uint32_t resolution)
+    {
+        const SR_MATH_NS::FVector4 offset = lightRotation * SR_MATH_NS::FVector4(cascade.center - cached.center, 0.f);
+
+        const float_t texelSize = resolution > 0 ? 2.f * cascade.extent / static_cast<float_t>(resolution) : 0.f;
+        const float_t extent = cascade.radius + texelSize;
+
+        return std::abs(offset.x) + extent <= cached.extent && std::abs(offset.y) + extent <= cached.extent;
+    }
+}
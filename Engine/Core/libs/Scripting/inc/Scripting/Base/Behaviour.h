@@ -19,6 +19,7 @@ namespace SR_SCRIPTING_NS {
     class Behaviour;
 
     class IRawBehaviour : public SR_UTILS_NS::IResource {
+        SR_MEMORY_TAG(SR_UTILS_NS::MemoryTag::Scripts)
         using Super = SR_UTILS_NS::IResource;
         using Properties = std::vector<std::string>;
         using ValueProperties = std::list<std::pair<std::string, std::any>>;
@@ -11,4 +11,5 @@
 #include "../../Utils/src/Utils/Common/EnumReflector.cpp"
 #include "../../Utils/src/Utils/Common/Hashes.cpp"
 #include "../../Utils/src/Utils/Common/HashManager.cpp"
+#include "../../Utils/src/Utils/Common/LogQueue.cpp"
 #include "../../Utils/src/Utils/Common/Vertices.cpp"
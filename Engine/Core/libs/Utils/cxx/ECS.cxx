@@ -4,6 +4,7 @@
 #include "../../Utils/src/Utils/ECS/IComponentable.cpp"
 #include "../../Utils/src/Utils/ECS/ComponentManager.cpp"
 #include "../../Utils/src/Utils/ECS/GameObject.cpp"
+#include "../../Utils/src/Utils/ECS/GameObjectPool.cpp"
 #include "../../Utils/src/Utils/ECS/ISavable.cpp"
 #include "../../Utils/src/Utils/ECS/Transform.cpp"
 #include "../../Utils/src/Utils/ECS/Entity.cpp"
@@ -14,5 +15,6 @@
 #include "../../Utils/src/Utils/ECS/EntityRef.cpp"
 #include "../../Utils/src/Utils/ECS/EntityRefUtils.cpp"
 #include "../../Utils/src/Utils/ECS/Prefab.cpp"
+#include "../../Utils/src/Utils/ECS/PrefabTemplate.cpp"
 #include "../../Utils/src/Utils/ECS/Migration.cpp"
 #include "../../Utils/src/Utils/ECS/TagManager.cpp"
\ No newline at end of file
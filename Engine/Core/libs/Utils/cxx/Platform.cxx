@@ -1,6 +1,7 @@
 #include <Utils/stdInclude.h>
 
 #ifdef SR_LINUX
+    #include "../../Utils/src/Utils/Input/EvdevInputSource.cpp"
     #include "../../Utils/src/Utils/Platform/PlatformLinux.cpp"
     #include "../../Utils/src/Utils/Platform/StacktraceLinux.cpp"
 #endif
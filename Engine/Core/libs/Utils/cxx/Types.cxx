@@ -13,4 +13,5 @@
 #include "../../Utils/src/Utils/Types/IRawMeshHolder.cpp"
 #include "../../Utils/src/Utils/Types/Mutex.cpp"
 #include "../../Utils/src/Utils/Types/LockGuard.cpp"
-#include "../../Utils/src/Utils/Types/StringAtom.cpp"
\ No newline at end of file
+#include "../../Utils/src/Utils/Types/StringAtom.cpp"
+#include "../../Utils/src/Utils/Types/SharedPtr.cpp"
\ No newline at end of file
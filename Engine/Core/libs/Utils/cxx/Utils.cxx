@@ -8,6 +8,8 @@
 #include "../../Utils/src/Utils/SRLM/LogicalNodes.cpp"
 #include "../../Utils/src/Utils/SRLM/LogicalNodeManager.cpp"
 #include "../../Utils/src/Utils/SRLM/ConvertorNode.cpp"
+#include "../../Utils/src/Utils/SRLM/LogicalCompiler.cpp"
+#include "../../Utils/src/Utils/SRLM/LogicalVM.cpp"
 
 #include "../../Utils/src/Utils/Events/EventManager.cpp"
 #include "../../Utils/src/Utils/Events/Event.cpp"
@@ -17,11 +19,13 @@
 #include "../../Utils/src/Utils/FileSystem/Path.cpp"
 #include "../../Utils/src/Utils/FileSystem/FileDialog.cpp"
 #include "../../Utils/src/Utils/FileSystem/AssimpCache.cpp"
+#include "../../Utils/src/Utils/FileSystem/BakedMesh.cpp"
 
 #include "../../Utils/src/Utils/Input/InputSystem.cpp"
 #include "../../Utils/src/Utils/Input/InputDispatcher.cpp"
 #include "../../Utils/src/Utils/Input/InputDevice.cpp"
 #include "../../Utils/src/Utils/Input/InputHandler.cpp"
+#include "../../Utils/src/Utils/Input/InputSource.cpp"
 
 #include "../../Utils/src/Utils/Math/Matrix3x3.cpp"
 #include "../../Utils/src/Utils/Math/Matrix4x4.cpp"
@@ -30,6 +34,7 @@
 #include "../../Utils/src/Utils/Math/Vector6.cpp"
 #include "../../Utils/src/Utils/Math/Noise.cpp"
 #include "../../Utils/src/Utils/Math/Rect.cpp"
+#include "../../Utils/src/Utils/Math/SIMD.cpp"
 
 #include "../../Utils/src/Utils/TaskManager/TaskManager.cpp"
 
@@ -37,12 +42,14 @@
 #include "../../Utils/src/Utils/DebugDraw.cpp"
 #include "../../Utils/src/Utils/Debug.cpp"
 #include "../../Utils/src/Utils/Xml.cpp"
+#include "../../Utils/src/Utils/CompiledConfig.cpp"
 
 #include "../../Utils/src/Utils/ResourceManager/FileWatcher.cpp"
 #include "../../Utils/src/Utils/ResourceManager/IResource.cpp"
 #include "../../Utils/src/Utils/ResourceManager/ResourceInfo.cpp"
 #include "../../Utils/src/Utils/ResourceManager/ResourcesHolder.cpp"
 #include "../../Utils/src/Utils/ResourceManager/ResourceManager.cpp"
+#include "../../Utils/src/Utils/ResourceManager/ResourceRegistry.cpp"
 #include "../../Utils/src/Utils/ResourceManager/ResourceContainer.cpp"
 #include "../../Utils/src/Utils/ResourceManager/IResourceReloader.cpp"
 
@@ -62,4 +69,8 @@
     #include "../../Utils/src/Utils/Profile/TracyContext.cpp"
 #endif
 
+#include "../../Utils/src/Utils/Profile/Profiler.cpp"
+#include "../../Utils/src/Utils/Profile/MemoryTracker.cpp"
+#include "../../Utils/src/Utils/Profile/FrameRecorder.cpp"
+
 #include "../../Utils/libs/xxHash/xxhash.c"
\ No newline at end of file
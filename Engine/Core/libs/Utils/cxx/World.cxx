@@ -4,6 +4,7 @@
 #include "../../Utils/src/Utils/World/Observer.cpp"
 #include "../../Utils/src/Utils/World/Region.cpp"
 #include "../../Utils/src/Utils/World/Scene.cpp"
+#include "../../Utils/src/Utils/World/SceneIndex.cpp"
 #include "../../Utils/src/Utils/World/SceneUpdater.cpp"
 #include "../../Utils/src/Utils/World/SceneAllocator.cpp"
 #include "../../Utils/src/Utils/World/SceneLogic.cpp"
@@ -15,6 +15,10 @@ namespace SR_UTILS_NS {
         }
         return std::string();
     }
+
+    bool HasCmdOption(char **begin, char **end, const std::string &option) {
+        return std::find(begin, end, option) != end;
+    }
 }
 
 #endif //GAMEENGINE_CMDOPTIONS_H
@@ -39,6 +39,9 @@ namespace SR_UTILS_NS {
         SR_NODISCARD bool Enabled(const std::string& name, bool def) const;
         SR_NODISCARD bool Enabled(const std::string& group, const std::string& name) const;
 
+        /// Меняет значение до следующего Reload, нужно тестам и инструментам
+        void SetEnabled(const std::string& group, const std::string& name, bool value);
+
     private:
         SR_NODISCARD const FeatureGroup& GetGroup(const std::string& name) const;
         bool Register(const std::string& group, const std::string& name, bool value);
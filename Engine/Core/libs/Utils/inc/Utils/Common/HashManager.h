@@ -17,8 +17,17 @@ namespace SR_UTILS_NS {
     };
 
     /// Не можем наследоваться от Singleton
+    /// Таблица разбита на шарды по хешу строки, чтение идет под shared-блокировкой шарда,
+    /// поэтому потоки загрузки и рендера не упираются в один общий мьютекс.
     class HashManager : SR_UTILS_NS::NonCopyable {
         using Hash = uint64_t;
+        static constexpr uint64_t ShardCount = 64;
+
+        struct alignas(64) Shard {
+            ska::flat_hash_map<Hash, StringHashInfo*> strings; /// NOLINT
+            mutable std::shared_mutex mutex;
+        };
+
     private:
         HashManager() = default;
         ~HashManager() override = default;
@@ -39,11 +48,14 @@ namespace SR_UTILS_NS {
         Hash AddHash(const char* str);
 
     private:
-        SR_NODISCARD StringHashInfo* Register(std::string str, Hash hash);
+        SR_NODISCARD StringHashInfo* GetOrAddInfo(std::string_view str, Hash hash);
+        SR_NODISCARD StringHashInfo* Find(Hash hash) const;
+
+        SR_NODISCARD Shard& GetShard(Hash hash) noexcept { return m_shards[(hash ^ (hash >> 32U)) % ShardCount]; }
+        SR_NODISCARD const Shard& GetShard(Hash hash) const noexcept { return m_shards[(hash ^ (hash >> 32U)) % ShardCount]; }
 
     private:
-        ska::flat_hash_map<Hash, StringHashInfo*> m_strings; /// NOLINT
-        mutable std::recursive_mutex m_mutex;
+        std::array<Shard, ShardCount> m_shards;
 
     };
 }
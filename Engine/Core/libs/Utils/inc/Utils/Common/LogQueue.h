@@ -0,0 +1,87 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SRENGINE_LOGQUEUE_H
+#define SRENGINE_LOGQUEUE_H
+
+#include <Utils/Common/NonCopyable.h>
+#include <Utils/Common/Enumerations.h>
+#include <Utils/Types/Function.h>
+
+namespace SR_UTILS_NS {
+    /// Что делать, если кольцевой буфер потока переполнен:
+    /// Drop - отбросить запись и посчитать ее, Block - ждать, пока поток записи освободит место
+    SR_ENUM_NS_CLASS_T(LogOverflowPolicy, uint8_t,
+        Drop, Block
+    );
+
+    /// Пишущий поток кладет только тип и текст, префикс и расход памяти добавляет поток записи
+    struct LogRecord {
+        uint64_t sequence = 0;
+        uint8_t type = 0;
+        std::string message;
+    };
+
+    /// Асинхронная очередь логов. У каждого пишущего потока свой lock-free SPSC буфер,
+    /// отдельный поток забирает записи из всех буферов, упорядочивает их по номеру и отдает пачкой в Sink.
+    class SR_DLL_EXPORT LogQueue : public NonCopyable {
+        class Ring;
+        struct ThreadRing;
+    public:
+        /// пачка записей и количество отброшенных с прошлого вызова
+        using Sink = SR_HTYPES_NS::Function<void(std::vector<LogRecord>&, uint64_t)>;
+
+        static constexpr uint64_t RingCapacity = 1024;
+
+    public:
+        ~LogQueue() override;
+
+    public:
+        void Start(const Sink& sink, LogOverflowPolicy policy);
+        /// Останавливает поток записи и дописывает все, что осталось в буферах
+        void Stop();
+
+        /// Вернет false, если очередь не запущена, тогда запись нужно вывести синхронно.
+        /// Важные записи не отбрасываются даже при политике Drop.
+        bool Push(LogRecord&& record, bool important);
+
+        /// Синхронно дописывает все буферы в вызывающем потоке
+        void Flush();
+        /// То же, что Flush, но не ждет блокировку, если ее держит упавший поток
+        void FlushOnCrash();
+
+        SR_NODISCARD bool IsRunning() const noexcept { return m_isRun; }
+        SR_NODISCARD uint64_t GetDroppedCount() const noexcept { return m_dropped; }
+
+    private:
+        SR_NODISCARD Ring& GetThreadRing();
+
+        void Thread();
+        void Drain();
+        /// вызывать под m_drainMutex
+        void DrainImpl();
+
+    private:
+        std::vector<std::shared_ptr<Ring>> m_rings;
+        std::mutex m_ringsMutex;
+
+        std::mutex m_drainMutex;
+        std::vector<LogRecord> m_batch;
+        uint64_t m_reportedDropped = 0;
+
+        std::mutex m_conditionMutex;
+        std::condition_variable m_condition;
+
+        std::atomic<bool> m_isRun = false;
+        std::atomic<uint64_t> m_sequence = 0;
+        std::atomic<uint64_t> m_dropped = 0;
+
+        LogOverflowPolicy m_policy = LogOverflowPolicy::Block;
+        Sink m_sink;
+        std::thread m_thread;
+
+    };
+}
+
+#endif //SRENGINE_LOGQUEUE_H
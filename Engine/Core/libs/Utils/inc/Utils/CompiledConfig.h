@@ -0,0 +1,138 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SRENGINE_COMPILEDCONFIG_H
+#define SRENGINE_COMPILEDCONFIG_H
+
+#include <Utils/Xml.h>
+
+namespace SR_XML_NS {
+    /// Ожидаемая структура конфига, проверяется один раз при компиляции
+    struct ConfigSchema {
+        std::string rootNode;
+        /// обязательные атрибуты корневого узла
+        std::vector<std::string> requiredAttributes;
+
+        SR_NODISCARD uint64_t GetHash() const;
+    };
+
+    struct CompiledString {
+        uint32_t offset = 0;
+        uint32_t size = 0;
+    };
+
+    /// Дети узла лежат подряд, начиная с firstChild, атрибуты - начиная с firstAttribute
+    struct CompiledNode {
+        uint32_t type = 0; /// pugi::xml_node_type
+        uint32_t name = 0;
+        uint32_t value = 0;
+        uint32_t firstAttribute = 0;
+        uint32_t attributesCount = 0;
+        uint32_t firstChild = 0;
+        uint32_t childrenCount = 0;
+        uint32_t padding = 0;
+    };
+
+    /// Значение атрибута заранее преобразовано всеми функциями pugixml, которые использует Attribute
+    struct CompiledAttribute {
+        uint32_t name = 0;
+        uint32_t value = 0;
+        int32_t int32 = 0;
+        uint32_t uint32 = 0;
+        int64_t int64 = 0;
+        uint64_t uint64 = 0;
+        double_t float64 = 0.0;
+        float_t float32 = 0.f;
+        uint32_t boolean = 0;
+    };
+
+    /**
+     * Скомпилированный XML конфиг - один блок с деревом узлов, атрибутами и таблицей строк.
+     * Имена и значения интернированы: одинаковые строки хранятся один раз и адресуются индексом.
+     * Документ проверяется по схеме один раз при компиляции, блок кешируется на диске вместе с хешем исходника
+     * и схемы. Исходником остается XML: при его изменении блок компилируется заново.
+     * Xml::Node и Xml::Attribute читают блок напрямую, поэтому существующие загрузчики настроек работают без изменений.
+     */
+    class SR_DLL_EXPORT CompiledConfig {
+    public:
+        static constexpr uint32_t MAGIC = 0x43435253; /// SRCC
+        static constexpr uint32_t VERSION = 1000;
+
+        struct Header {
+            uint32_t magic = MAGIC;
+            uint32_t version = VERSION;
+            uint64_t sourceHash = 0;
+            uint64_t schemaHash = 0;
+            uint64_t size = 0;
+
+            uint32_t nodesCount = 0;
+            uint32_t attributesCount = 0;
+            uint32_t stringsCount = 0;
+            uint32_t padding = 0;
+
+            uint64_t nodesOffset = 0;
+            uint64_t attributesOffset = 0;
+            uint64_t stringsOffset = 0;
+            uint64_t charsOffset = 0;
+            uint64_t charsSize = 0;
+        };
+
+    public:
+        CompiledConfig() = default;
+
+        /// Принимает готовый блок, проверяет заголовок, границы секций и ссылки узлов
+        static CompiledConfig FromBlob(std::vector<uint64_t>&& blob);
+        static CompiledConfig Load(const Path& path);
+
+        /// Проверяет документ по схеме и компилирует его, при ошибке возвращает невалидный конфиг
+        static CompiledConfig Compile(const Document& document, const ConfigSchema& schema, uint64_t sourceHash);
+
+        /**
+         * Загружает конфиг через кеш cachePath. Если хеш исходника и схемы совпадает с кешем, XML не разбирается.
+         * Иначе документ разбирается, проверяется и кеш перезаписывается. Документ всегда только для чтения.
+         */
+        static Document LoadDocument(const Path& path, const Path& cachePath, const ConfigSchema& schema);
+
+        bool Save(const Path& path) const;
+        void Clear();
+
+        /// Документ, читающий этот конфиг, конфиг переносится в документ
+        SR_NODISCARD Document ToDocument(const Path& path) &&;
+
+    public:
+        SR_NODISCARD bool Valid() const noexcept { return !m_blob.empty(); }
+        SR_NODISCARD uint64_t GetSourceHash() const noexcept { return GetHeader().sourceHash; }
+        SR_NODISCARD uint64_t GetSchemaHash() const noexcept { return GetHeader().schemaHash; }
+        SR_NODISCARD uint64_t GetSize() const noexcept { return Valid() ? GetHeader().size : 0; }
+        SR_NODISCARD const void* GetData() const noexcept { return m_blob.data(); }
+
+        SR_NODISCARD uint32_t GetNodesCount() const noexcept { return Valid() ? GetHeader().nodesCount : 0; }
+        SR_NODISCARD uint32_t GetAttributesCount() const noexcept { return Valid() ? GetHeader().attributesCount : 0; }
+        SR_NODISCARD uint32_t GetStringsCount() const noexcept { return Valid() ? GetHeader().stringsCount : 0; }
+
+        SR_NODISCARD const CompiledNode& GetNode(uint32_t id) const { return Section<CompiledNode>(GetHeader().nodesOffset)[id]; }
+        SR_NODISCARD const CompiledAttribute& GetAttribute(uint32_t id) const { return Section<CompiledAttribute>(GetHeader().attributesOffset)[id]; }
+        SR_NODISCARD std::string_view GetString(uint32_t id) const;
+        /// Строки хранятся с завершающим нулем
+        SR_NODISCARD const char* GetCString(uint32_t id) const;
+
+        /// Копирует узел со всеми потомками в документ pugixml, возвращает копию
+        pugi::xml_node CopyTo(pugi::xml_node parent, uint32_t id) const;
+        void CopyChildren(pugi::xml_node parent, uint32_t id) const;
+
+    private:
+        SR_NODISCARD const Header& GetHeader() const { return *reinterpret_cast<const Header*>(m_blob.data()); }
+        SR_NODISCARD bool Validate() const;
+
+        template<typename T> SR_NODISCARD const T* Section(uint64_t offset) const {
+            return reinterpret_cast<const T*>(reinterpret_cast<const char*>(m_blob.data()) + offset);
+        }
+
+    private:
+        std::vector<uint64_t> m_blob;
+
+    };
+}
+
+#endif //SRENGINE_COMPILEDCONFIG_H
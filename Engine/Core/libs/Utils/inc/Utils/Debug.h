@@ -9,6 +9,7 @@
 #include <Utils/Common/Singleton.h>
 #include <Utils/Common/Enumerations.h>
 #include <Utils/Common/StringFormat.h>
+#include <Utils/Common/LogQueue.h>
 
 namespace SR_UTILS_NS {
     SR_ENUM_NS_CLASS_T(DebugLogType, uint8_t,
@@ -47,6 +48,17 @@ namespace SR_UTILS_NS {
         void Init(const std::string& log_path, bool ShowUsedMemory, Theme colorTheme = Theme::Light);
         void OnSingletonDestroy() override;
 
+        /// Запись в консоль и файл переносится в отдельный поток, вызывающий поток только кладет запись в буфер
+        void SetAsync(bool enabled, LogOverflowPolicy policy = LogOverflowPolicy::Block);
+        SR_NODISCARD bool IsAsync() const { return m_queue.IsRunning(); }
+        /// Без консоли записи идут только в файл, например в бенчмарках, где stdout занят результатами
+        void SetConsoleOutput(bool enabled) { m_consoleOutput = enabled; }
+
+        /// Дописать все накопленные асинхронные записи
+        void Flush();
+        /// Вызывается из обработчиков падения
+        void FlushOnCrash();
+
     public:
         void Log(const std::string& msg) { Print(msg, DebugLogType::Log); }
         void VulkanLog(const std::string& msg) { Print(msg, DebugLogType::VulkanLog); }
@@ -67,8 +79,16 @@ namespace SR_UTILS_NS {
 
         void Print(std::string msg, DebugLogType type);
 
+    private:
+        void Write(const LogRecord& record);
+        void WriteBatch(std::vector<LogRecord>& records, uint64_t dropped);
+        /// вызывать под m_outputMutex
+        void WriteRecord(const LogRecord& record, const std::string& memoryUsage);
+        SR_NODISCARD std::string GetMemoryUsagePrefix() const;
+
     private:
         bool m_showUseMemory = false;
+        std::atomic<bool> m_consoleOutput = true;
         bool m_ColorThemeIsEnabled = false;
 
         Theme m_theme = Theme::Light;
@@ -76,6 +96,9 @@ namespace SR_UTILS_NS {
         std::atomic<bool> m_isInit = false;
         Path m_logPath;
         std::ofstream m_file;
+        /// консоль и файл, порядок захвата: LogQueue -> m_outputMutex
+        std::mutex m_outputMutex;
+        LogQueue m_queue;
         std::atomic<Level> m_level = Level::Low;
         size_t m_countErrors = 0;
         size_t m_countWarnings = 0;
@@ -9,6 +9,7 @@
 #include <Utils/ECS/IComponentable.h>
 #include <Utils/ECS/TagManager.h>
 #include <Utils/ECS/Prefab.h>
+#include <Utils/ECS/GameObjectPool.h>
 
 #include <Utils/Math/Vector3.h>
 #include <Utils/Types/SafePointer.h>
@@ -25,8 +26,10 @@ namespace SR_UTILS_NS {
     class Component;
 
     class SR_DLL_EXPORT GameObject : public IComponentable, public Entity {
+        SR_MEMORY_TAG(MemoryTag::Scene)
         SR_ENTITY_SET_VERSION(1008);
         friend class Component;
+        friend class PrefabTemplate;
     public:
         using Name = std::string;
         using Ptr = SR_HTYPES_NS::SharedPtr<GameObject>;
@@ -86,6 +89,7 @@ namespace SR_UTILS_NS {
         void RemoveAllChildren();
         void SetName(std::string name);
         void SetTag(const std::string& tag);
+        void SetTag(Tag tag);
 
         bool Contains(const GameObject::Ptr& child);
         void SetEnabled(bool value);
@@ -111,11 +115,19 @@ namespace SR_UTILS_NS {
         /// освобождает память объекта
         void DestroyImpl();
 
+    protected:
+        void OnComponentAttached(Component* pComponent) override;
+        void OnComponentDetached(Component* pComponent) override;
+
     private:
         void OnAttached();
 
         bool UpdateEntityPath();
 
+        /// Присоединение для PrefabTemplate: ребенок только что создан и еще не в сцене, родитель уже на своем месте,
+        /// поэтому без проверок, обхода поддерева и подъема по иерархии за путем
+        void AttachTemplateChild(const GameObject::Ptr& pChild);
+
     private:
         bool m_isEnabled = true;
         bool m_isActive = false;
@@ -135,6 +147,9 @@ namespace SR_UTILS_NS {
         Name m_name;
         Tag m_tag = 0;
 
+        /// блок пула сцены, если объект создан в нем, иначе объект в куче
+        GameObjectPool::Chunk* m_poolChunk = nullptr;
+
     };
 }
 
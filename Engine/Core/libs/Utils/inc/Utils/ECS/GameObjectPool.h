@@ -0,0 +1,40 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SRENGINE_GAMEOBJECTPOOL_H
+#define SRENGINE_GAMEOBJECTPOOL_H
+
+#include <Utils/Common/NonCopyable.h>
+
+namespace SR_UTILS_NS {
+    /**
+     * Память под игровые объекты сцены. Выделяется блоками, иерархия экземпляра префаба получает места
+     * одним вызовом и лежит подряд. Блок считает живые объекты и ссылку пула: объекты могут пережить сцену,
+     * тогда блок освобождает последний из них. Блоки без живых объектов пул заполняет заново.
+     */
+    class SR_DLL_EXPORT GameObjectPool : public NonCopyable {
+    public:
+        struct Chunk;
+
+        static constexpr uint32_t ChunkObjects = 256;
+
+    public:
+        GameObjectPool() = default;
+        ~GameObjectPool() override;
+
+    public:
+        /// Места под count объектов подряд, объекты создаются размещающим new
+        SR_NODISCARD void* Allocate(uint32_t count, Chunk*& pChunk);
+        /// Отдает место одного объекта после его деструктора, можно звать из любого потока и после смерти пула
+        static void Free(Chunk* pChunk) noexcept;
+
+    private:
+        std::mutex m_mutex;
+        std::vector<Chunk*> m_chunks;
+        Chunk* m_current = nullptr;
+
+    };
+}
+
+#endif //SRENGINE_GAMEOBJECTPOOL_H
@@ -76,6 +76,10 @@ namespace SR_UTILS_NS {
     protected:
         void DestroyComponent(Component* pComponent);
 
+        /// Компонент попал в m_components или был из него удален
+        virtual void OnComponentAttached(Component* pComponent) { }
+        virtual void OnComponentDetached(Component* pComponent) { }
+
     protected:
         Components m_components = { };
         ComponentList m_loadedComponents = { };
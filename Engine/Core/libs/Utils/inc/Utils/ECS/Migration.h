@@ -10,22 +10,48 @@
 #include <Utils/Types/Marshal.h>
 
 namespace SR_UTILS_NS {
+    class Path;
+
+    /**
+     * Мигратор читает из input только изменившиеся поля, начиная с текущей позиции, и пишет их новое представление
+     * в output. Все, что лежит в input после позиции чтения, остается как есть: прочитанный диапазон заменяется
+     * на output прямо в буфере вызывающего, без полных копий данных.
+     * Цепочки миграторов для (хеш, from, to) разрешаются один раз и запоминаются. Миграторы лежат в deque и не двигаются,
+     * поэтому цепочка, отданная по значению, остается валидной, даже если во время миграции регистрируются новые.
+     */
     class Migration : public Singleton<Migration> {
         SR_REGISTER_SINGLETON(Migration)
         using Version = uint16_t;
-        using Migrator = SR_HTYPES_NS::Function<bool(SR_HTYPES_NS::Marshal&)>;
+        using Migrator = SR_HTYPES_NS::Function<bool(SR_HTYPES_NS::Marshal& input, SR_HTYPES_NS::Marshal& output)>;
         struct MigrationInfo {
             Version from;
             Version to;
             Migrator migrator;
         };
+        using Chain = std::vector<const Migrator*>;
+        using ChainKey = std::tuple<uint64_t, Version, Version>;
     public:
-        bool Migrate(uint64_t hashName, SR_HTYPES_NS::Marshal& pMarshal, Version from, Version to) const;
+        bool Migrate(uint64_t hashName, SR_HTYPES_NS::Marshal& marshal, Version from, Version to) const;
 
         bool RegisterMigrator(uint64_t hashName, Version from, Version to, Migrator&& migrator);
 
+        /// Число успешных миграций на текущем потоке, по нему загрузчик ассета понимает, что данные устарели
+        SR_NODISCARD uint64_t GetMigratedCount() const noexcept;
+
+        /// Обновленная копия ассета из кеша, невалидна если кеш выключен или исходник изменился
+        SR_NODISCARD SR_HTYPES_NS::Marshal LoadFromCache(const Path& resourcePath, uint64_t sourceHash) const;
+        bool SaveToCache(const Path& resourcePath, uint64_t sourceHash, const SR_HTYPES_NS::Marshal& marshal) const;
+        SR_NODISCARD bool IsCacheEnabled() const;
+
+    private:
+        /// Пустая цепочка - миграция невозможна
+        SR_NODISCARD Chain ResolveChain(uint64_t hashName, Version from, Version to) const;
+        SR_NODISCARD Path GetCachePath(const Path& resourcePath) const;
+
     private:
-        std::map<uint64_t, std::vector<MigrationInfo>> m_migrators;
+        std::map<uint64_t, std::deque<MigrationInfo>> m_migrators;
+        /// пустая цепочка при from != to - миграция невозможна
+        mutable std::map<ChainKey, Chain> m_chains;
 
     };
 }
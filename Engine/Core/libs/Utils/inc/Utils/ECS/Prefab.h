@@ -7,6 +7,7 @@
 
 #include <Utils/ResourceManager/IResource.h>
 #include <Utils/Types/SharedPtr.h>
+#include <Utils/ECS/PrefabTemplate.h>
 
 namespace SR_HTYPES_NS {
     class Marshal;
@@ -42,6 +43,8 @@ namespace SR_UTILS_NS {
 
     private:
         GameObjectPtr m_data;
+        /// плоское представление m_data для быстрого создания экземпляров
+        PrefabTemplate m_template;
 
     };
 }
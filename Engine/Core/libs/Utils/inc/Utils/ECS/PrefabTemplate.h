@@ -0,0 +1,67 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SRENGINE_PREFABTEMPLATE_H
+#define SRENGINE_PREFABTEMPLATE_H
+
+#include <Utils/ECS/TagManager.h>
+#include <Utils/Types/SharedPtr.h>
+
+namespace SR_WORLD_NS {
+    class Scene;
+}
+
+namespace SR_UTILS_NS {
+    class GameObject;
+    class Component;
+    class Transform;
+    class Prefab;
+
+    /**
+     * Скомпилированный префаб. Иерархия развернута в плоский массив в порядке обхода в глубину,
+     * у каждого узла индекс родителя, прототип трансформа и диапазон компонентов-прототипов.
+     * Instance размещает всю иерархию одним выделением в пуле сцены, создает и связывает объекты одним проходом
+     * сверху вниз без обходов поддеревьев и регистрирует экземпляр в сцене одной пачкой.
+     * Шаблон ссылается на объекты исходной иерархии, поэтому живет не дольше нее.
+     */
+    class SR_DLL_EXPORT PrefabTemplate {
+    public:
+        using GameObjectPtr = SR_HTYPES_NS::SharedPtr<GameObject>;
+        using ScenePtr = SR_WORLD_NS::Scene*;
+
+        struct Node {
+            std::string name;
+            Tag tag = 0;
+            int32_t parent = SR_ID_INVALID;
+            uint32_t childrenCount = 0;
+            uint32_t firstComponent = 0;
+            uint32_t componentsCount = 0;
+            const Transform* pTransform = nullptr;
+            /// вложенный префаб, владельцем которого является узел
+            Prefab* pPrefab = nullptr;
+            bool enabled = true;
+        };
+
+    public:
+        void Compile(const GameObjectPtr& pRoot);
+        void Clear();
+
+        SR_NODISCARD GameObjectPtr Instance(const ScenePtr& scene) const;
+
+        SR_NODISCARD bool Valid() const noexcept { return !m_nodes.empty(); }
+        SR_NODISCARD const std::vector<Node>& GetNodes() const noexcept { return m_nodes; }
+
+    private:
+        void CompileNode(const GameObjectPtr& pGameObject, int32_t parent);
+
+    private:
+        std::vector<Node> m_nodes;
+        std::vector<const Component*> m_components;
+        /// владельцы вложенных префабов в обратном порядке обхода, в нем Copy назначает префабы
+        std::vector<uint32_t> m_prefabOwners;
+
+    };
+}
+
+#endif //SRENGINE_PREFABTEMPLATE_H
@@ -53,6 +53,8 @@ namespace SR_UTILS_NS {
 
     private:
         void UpdateMatrix() override;
+        /// Пересчитывает грязных 3D детей одним пакетом SIMD-ядер, вглубь не спускается
+        void UpdateChildrenMatrices();
 
     public:
         SR_INLINE static constexpr SR_MATH_NS::FVector3 RIGHT   = SR_MATH_NS::FVector3(1, 0, 0);
@@ -38,7 +38,7 @@ namespace SR_UTILS_NS {
         }
 
     private:
-        std::list<Subscription> m_subscriptions;
+        std::vector<Subscription> m_subscriptions;
 
     };
 }
@@ -0,0 +1,195 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SRENGINE_TYPEDEVENTDISPATCHER_H
+#define SRENGINE_TYPEDEVENTDISPATCHER_H
+
+#include <Utils/Debug.h>
+#include <Utils/Common/NonCopyable.h>
+
+namespace SR_UTILS_NS {
+    using EventListenerId = uint64_t;
+
+    /**
+     * Диспетчер событий с типами, известными на этапе компиляции. Идентификатор события - индекс его типа
+     * в Events, слушатели каждого типа лежат в своем непрерывном массиве, поэтому Dispatch обходится без RTTI,
+     * строк и хешей. Слушатель - объект и функция-переходник, вызов не выделяет память.
+     *
+     * Подписка и отписка внутри обработчика безопасны: новый слушатель получает события со следующей рассылки,
+     * отписанный больше не вызывается, а массив уплотняется после выхода из самой внешней рассылки.
+     * Subscribe, Unsubscribe, Dispatch и Flush вызываются с потока-владельца, Post - с любого потока:
+     * события копятся в очереди и доставляются пачкой при вызове Flush.
+     */
+    template<typename... Events> class TypedEventDispatcher : public NonCopyable {
+        template<typename T> using Invoker = void(*)(void* pObject, const T& event);
+
+        template<typename T> struct Listener {
+            void* pObject = nullptr;
+            /// nullptr - слушатель отписан во время рассылки и ждет удаления
+            Invoker<T> pInvoke = nullptr;
+            EventListenerId id = 0;
+        };
+
+        template<typename T> struct Channel {
+            std::vector<Listener<T>> listeners;
+            std::vector<T> pending;
+            std::vector<T> delivering;
+            uint32_t dispatchDepth = 0;
+            bool hasRemoved = false;
+        };
+
+        template<typename T, typename First, typename... Rest> static constexpr uint32_t IndexOf() {
+            if constexpr (std::is_same_v<T, First>) {
+                return 0;
+            }
+            else {
+                static_assert(sizeof...(Rest) > 0, "Event type is not registered in the dispatcher!");
+                return 1 + IndexOf<T, Rest...>();
+            }
+        }
+
+    public:
+        template<typename T> static constexpr uint32_t EVENT_ID = IndexOf<T, Events...>();
+
+    public:
+        ~TypedEventDispatcher() override = default;
+
+    public:
+        /// Подписывает метод объекта: dispatcher.Subscribe<KeyEvent, &Editor::OnKey>(pEditor)
+        template<typename T, auto Method, typename Class> EventListenerId Subscribe(Class* pObject) {
+            return Subscribe<T>(static_cast<void*>(pObject), [](void* pData, const T& event) {
+                (static_cast<Class*>(pData)->*Method)(event);
+            });
+        }
+
+        template<typename T> EventListenerId Subscribe(void* pObject, Invoker<T> pInvoke) {
+            SRAssert(pInvoke);
+
+            const EventListenerId id = ++m_lastListenerId;
+            GetChannel<T>().listeners.emplace_back(Listener<T> { pObject, pInvoke, id });
+
+            return id;
+        }
+
+        template<typename T> bool Unsubscribe(EventListenerId id) {
+            auto&& channel = GetChannel<T>();
+
+            for (uint64_t i = 0; i < channel.listeners.size(); ++i) {
+                if (channel.listeners[i].id != id || !channel.listeners[i].pInvoke) {
+                    continue;
+                }
+
+                if (channel.dispatchDepth > 0) {
+                    channel.listeners[i].pInvoke = nullptr;
+                    channel.hasRemoved = true;
+                }
+                else {
+                    channel.listeners.erase(channel.listeners.begin() + i);
+                }
+
+                return true;
+            }
+
+            return false;
+        }
+
+        void UnsubscribeAll() {
+            (UnsubscribeAll<Events>(), ...);
+        }
+
+        template<typename T> void Dispatch(const T& event) {
+            auto&& channel = GetChannel<T>();
+
+            ++channel.dispatchDepth;
+
+            /// слушатели, добавленные во время рассылки, в нее не попадают
+            const uint64_t count = channel.listeners.size();
+
+            for (uint64_t i = 0; i < count; ++i) {
+                /// копия: обработчик может подписать новых слушателей и переразместить массив
+                const Listener<T> listener = channel.listeners[i];
+                if (listener.pInvoke) {
+                    listener.pInvoke(listener.pObject, event);
+                }
+            }
+
+            if (--channel.dispatchDepth == 0 && channel.hasRemoved) {
+                Compact(channel);
+            }
+        }
+
+        /// Откладывает событие до Flush, потокобезопасно
+        template<typename T> void Post(T event) {
+            std::lock_guard<std::mutex> lock(m_queueMutex);
+            GetChannel<T>().pending.emplace_back(std::move(event));
+        }
+
+        /// Доставляет все отложенные события на вызывающем потоке, тип за типом в порядке Events
+        void Flush() {
+            (Flush<Events>(), ...);
+        }
+
+        template<typename T> SR_NODISCARD uint64_t GetListenersCount() const {
+            uint64_t count = 0;
+            for (auto&& listener : GetChannel<T>().listeners) {
+                count += listener.pInvoke ? 1 : 0;
+            }
+            return count;
+        }
+
+    private:
+        template<typename T> SR_NODISCARD Channel<T>& GetChannel() { return std::get<EVENT_ID<T>>(m_channels); }
+        template<typename T> SR_NODISCARD const Channel<T>& GetChannel() const { return std::get<EVENT_ID<T>>(m_channels); }
+
+        template<typename T> void UnsubscribeAll() {
+            auto&& channel = GetChannel<T>();
+
+            if (channel.dispatchDepth == 0) {
+                channel.listeners.clear();
+                return;
+            }
+
+            for (auto&& listener : channel.listeners) {
+                listener.pInvoke = nullptr;
+            }
+
+            channel.hasRemoved = true;
+        }
+
+        template<typename T> void Flush() {
+            auto&& channel = GetChannel<T>();
+
+            {
+                std::lock_guard<std::mutex> lock(m_queueMutex);
+                if (channel.pending.empty()) {
+                    return;
+                }
+                /// обмен буферами сохраняет их емкость, повторные Post не выделяют память
+                channel.pending.swap(channel.delivering);
+            }
+
+            for (auto&& event : channel.delivering) {
+                Dispatch<T>(event);
+            }
+
+            channel.delivering.clear();
+        }
+
+        template<typename T> static void Compact(Channel<T>& channel) {
+            channel.listeners.erase(std::remove_if(channel.listeners.begin(), channel.listeners.end(), [](const Listener<T>& listener) {
+                return !listener.pInvoke;
+            }), channel.listeners.end());
+
+            channel.hasRemoved = false;
+        }
+
+    private:
+        std::tuple<Channel<Events>...> m_channels;
+        std::mutex m_queueMutex;
+        EventListenerId m_lastListenerId = 0;
+
+    };
+}
+
+#endif //SRENGINE_TYPEDEVENTDISPATCHER_H
@@ -0,0 +1,286 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SRENGINE_BAKEDMESH_H
+#define SRENGINE_BAKEDMESH_H
+
+#include <Utils/Debug.h>
+#include <Utils/Common/Vertices.h>
+#include <Utils/Types/Map.h>
+#include <Utils/Math/Matrix4x4.h>
+
+namespace SR_UTILS_NS {
+    class Path;
+
+    /// Повторяет Vertices::StaticMeshVertex
+    struct BakedStaticVertex {
+        Vec3 position;
+        Vec2 uv;
+        Vec3 normal;
+        Vec3 tangent;
+        Vec3 bitangent;
+    };
+
+    /// Повторяет Vertices::SkinnedMeshVertex, x - индекс кости, y - вес
+    struct BakedSkinnedVertex {
+        Vec3 position;
+        Vec2 uv;
+        Vec3 normal;
+        Vec3 tangent;
+        Vec3 bitangent;
+        Vec2 weights[SR_MAX_BONES_ON_VERTEX];
+    };
+
+    struct BakedBounds {
+        Vec3 min { };
+        Vec3 max { };
+        /// радиус сферы вокруг начала координат меша, как в RawMesh::GetBoundingRadius
+        float_t radius = 0.f;
+    };
+
+    struct BakedBone {
+        uint64_t hash = 0;
+        uint32_t index = 0;
+        uint32_t padding = 0;
+    };
+
+    struct BakedSkeletonBone {
+        uint64_t hash = 0;
+        uint32_t index = 0;
+        uint32_t padding = 0;
+        float_t offset[16] = { };
+    };
+
+    struct BakedVectorKey {
+        double_t time = 0.0;
+        Vec3 value { };
+        float_t padding = 0.f;
+    };
+
+    struct BakedQuatKey {
+        double_t time = 0.0;
+        float_t w = 1.f, x = 0.f, y = 0.f, z = 0.f;
+    };
+
+    /// Узел иерархии модели. Меши и дочерние узлы - диапазоны в BakedMesh::GetNodeIndices
+    struct BakedNode {
+        Vec3 translation { };
+        /// углы Эйлера в радианах, как их дает aiMatrix4x4::Decompose
+        Vec3 rotation { };
+        Vec3 scaling { };
+        uint32_t nameOffset = 0;
+        uint32_t nameSize = 0;
+        uint32_t meshesOffset = 0;
+        uint32_t meshesCount = 0;
+        uint32_t childrenOffset = 0;
+        uint32_t childrenCount = 0;
+        uint32_t padding = 0;
+    };
+
+    /**
+     * Запеченная модель - один выровненный блок с готовыми чередующимися вершинами и индексами каждого подмеша,
+     * границами, иерархией узлов, скелетом и анимациями. Загружается одним чтением файла, все данные читаются прямо из блока
+     * без разбора и преобразования вершин. Подмеши с костями хранятся в формате SkinnedMeshVertex,
+     * остальные - в формате StaticMeshVertex.
+     */
+    class SR_DLL_EXPORT BakedMesh {
+    public:
+        static constexpr uint32_t MAGIC = 0x4D425253; /// SRBM
+        static constexpr uint32_t VERSION = 1001;
+        static constexpr uint64_t ALIGNMENT = 16;
+
+        struct Header {
+            uint32_t magic = MAGIC;
+            uint32_t version = VERSION;
+            uint64_t sourceHash = 0;
+            uint64_t size = 0;
+
+            uint32_t submeshesCount = 0;
+            uint32_t skeletonCount = 0;
+            uint32_t animationsCount = 0;
+            uint32_t channelsCount = 0;
+
+            uint64_t submeshesOffset = 0;
+            uint64_t skeletonOffset = 0;
+            uint64_t animationsOffset = 0;
+            uint64_t channelsOffset = 0;
+            uint64_t stringsOffset = 0;
+            uint64_t stringsSize = 0;
+
+            uint32_t nodesCount = 0;
+            uint32_t nodeIndicesCount = 0;
+            uint64_t nodesOffset = 0;
+            uint64_t nodeIndicesOffset = 0;
+
+            /// UnitScaleFactor из метаданных сцены, hasScaleFactor = 0 - его не было
+            float_t scaleFactor = 1.f;
+            uint32_t hasScaleFactor = 0;
+        };
+
+        struct Submesh {
+            uint64_t vertexOffset = 0;
+            uint64_t indexOffset = 0;
+            uint64_t bonesOffset = 0;
+            uint32_t vertexCount = 0;
+            uint32_t indexCount = 0;
+            uint32_t bonesCount = 0;
+            uint32_t skinned = 0;
+            uint32_t nameOffset = 0;
+            uint32_t nameSize = 0;
+            BakedBounds bounds;
+            uint32_t padding = 0;
+        };
+
+        struct Animation {
+            double_t duration = 0.0;
+            double_t ticksPerSecond = 0.0;
+            uint32_t nameOffset = 0;
+            uint32_t nameSize = 0;
+            uint32_t firstChannel = 0;
+            uint32_t channelsCount = 0;
+        };
+
+        struct Channel {
+            uint64_t positionKeysOffset = 0;
+            uint64_t rotationKeysOffset = 0;
+            uint64_t scalingKeysOffset = 0;
+            uint32_t positionKeysCount = 0;
+            uint32_t rotationKeysCount = 0;
+            uint32_t scalingKeysCount = 0;
+            uint32_t preState = 0;
+            uint32_t postState = 0;
+            uint32_t nameOffset = 0;
+            uint32_t nameSize = 0;
+            uint32_t padding = 0;
+        };
+
+    public:
+        BakedMesh() = default;
+
+        /// Принимает готовый блок, проверяет заголовок, границы всех секций и ссылки индексов, узлов и каналов
+        static BakedMesh FromBlob(std::vector<uint64_t>&& blob);
+        /// Читает файл целиком одним чтением
+        static BakedMesh Load(const Path& path);
+
+        bool Save(const Path& path) const;
+        void Clear();
+
+    public:
+        SR_NODISCARD bool Valid() const noexcept { return !m_blob.empty(); }
+        SR_NODISCARD uint64_t GetSourceHash() const noexcept { return GetHeader().sourceHash; }
+        SR_NODISCARD uint64_t GetSize() const noexcept { return Valid() ? GetHeader().size : 0; }
+        SR_NODISCARD const void* GetData() const noexcept { return m_blob.data(); }
+
+        SR_NODISCARD uint32_t GetSubmeshesCount() const noexcept { return Valid() ? GetHeader().submeshesCount : 0; }
+        SR_NODISCARD const Submesh& GetSubmesh(uint32_t id) const { return Section<Submesh>(GetHeader().submeshesOffset)[id]; }
+        SR_NODISCARD std::string_view GetSubmeshName(uint32_t id) const;
+        SR_NODISCARD int32_t FindSubmesh(std::string_view name) const;
+        SR_NODISCARD bool IsSkinned(uint32_t id) const { return GetSubmesh(id).skinned != 0; }
+
+        /// nullptr, если формат подмеша другой
+        SR_NODISCARD const BakedStaticVertex* GetStaticVertices(uint32_t id) const;
+        SR_NODISCARD const BakedSkinnedVertex* GetSkinnedVertices(uint32_t id) const;
+        SR_NODISCARD const uint32_t* GetIndices(uint32_t id) const { return Section<uint32_t>(GetSubmesh(id).indexOffset); }
+        SR_NODISCARD const BakedBone* GetBones(uint32_t id) const { return Section<BakedBone>(GetSubmesh(id).bonesOffset); }
+
+        /// Восстанавливает вершины в общем формате, нужно только старым потребителям RawMesh::GetVertices
+        SR_NODISCARD std::vector<Vertex> GetVertices(uint32_t id) const;
+
+        SR_NODISCARD uint32_t GetSkeletonCount() const noexcept { return Valid() ? GetHeader().skeletonCount : 0; }
+        SR_NODISCARD const BakedSkeletonBone* GetSkeleton() const { return Section<BakedSkeletonBone>(GetHeader().skeletonOffset); }
+
+        SR_NODISCARD uint32_t GetAnimationsCount() const noexcept { return Valid() ? GetHeader().animationsCount : 0; }
+        SR_NODISCARD const Animation& GetAnimation(uint32_t id) const { return Section<Animation>(GetHeader().animationsOffset)[id]; }
+        SR_NODISCARD const Channel& GetChannel(uint32_t id) const { return Section<Channel>(GetHeader().channelsOffset)[id]; }
+        SR_NODISCARD std::string_view GetString(uint32_t offset, uint32_t size) const;
+
+        /// Корневой узел - нулевой, дочерние узлы всегда идут после родителя
+        SR_NODISCARD uint32_t GetNodesCount() const noexcept { return Valid() ? GetHeader().nodesCount : 0; }
+        SR_NODISCARD const BakedNode& GetNode(uint32_t id) const { return Section<BakedNode>(GetHeader().nodesOffset)[id]; }
+        SR_NODISCARD std::string_view GetNodeName(uint32_t id) const;
+        SR_NODISCARD const uint32_t* GetNodeIndices() const { return Section<uint32_t>(GetHeader().nodeIndicesOffset); }
+
+        SR_NODISCARD std::optional<float_t> GetScaleFactor() const;
+        SR_NODISCARD const BakedVectorKey* GetVectorKeys(uint64_t offset) const { return Section<BakedVectorKey>(offset); }
+        SR_NODISCARD const BakedQuatKey* GetQuatKeys(uint64_t offset) const { return Section<BakedQuatKey>(offset); }
+
+    private:
+        SR_NODISCARD const Header& GetHeader() const { return *reinterpret_cast<const Header*>(m_blob.data()); }
+        SR_NODISCARD bool Validate() const;
+
+        template<typename T> SR_NODISCARD const T* Section(uint64_t offset) const {
+            return reinterpret_cast<const T*>(reinterpret_cast<const char*>(m_blob.data()) + offset);
+        }
+
+    private:
+        /// uint64_t дает выравнивание, достаточное для всех секций
+        std::vector<uint64_t> m_blob;
+
+    };
+
+    /// Собирает BakedMesh из уже посчитанных вершин, индексов, костей и анимаций
+    class SR_DLL_EXPORT BakedMeshBuilder {
+    public:
+        uint32_t AddSubmesh(std::string name, const std::vector<Vertex>& vertices, std::vector<uint32_t> indices,
+            const ska::flat_hash_map<uint64_t, uint32_t>& bones);
+
+        void AddSkeletonBone(uint64_t hash, uint32_t index, const SR_MATH_NS::Matrix4x4& offset);
+
+        /// Узлы добавляются в прямом порядке обхода, parent - индекс уже добавленного узла или SR_ID_INVALID у корня
+        uint32_t AddNode(std::string name, int32_t parent, const Vec3& translation, const Vec3& rotation, const Vec3& scaling,
+            std::vector<uint32_t> meshes);
+
+        void SetScaleFactor(float_t scaleFactor) { m_scaleFactor = scaleFactor; }
+
+        uint32_t AddAnimation(std::string name, double_t duration, double_t ticksPerSecond);
+        /// Канал относится к последней добавленной анимации
+        void AddChannel(std::string name, uint32_t preState, uint32_t postState,
+            std::vector<BakedVectorKey> positionKeys, std::vector<BakedQuatKey> rotationKeys, std::vector<BakedVectorKey> scalingKeys);
+
+        SR_NODISCARD BakedMesh Build(uint64_t sourceHash) const;
+
+    private:
+        struct SubmeshData {
+            std::string name;
+            std::vector<BakedStaticVertex> staticVertices;
+            std::vector<BakedSkinnedVertex> skinnedVertices;
+            std::vector<uint32_t> indices;
+            std::vector<BakedBone> bones;
+            BakedBounds bounds;
+        };
+
+        struct ChannelData {
+            std::string name;
+            uint32_t preState = 0;
+            uint32_t postState = 0;
+            std::vector<BakedVectorKey> positionKeys;
+            std::vector<BakedQuatKey> rotationKeys;
+            std::vector<BakedVectorKey> scalingKeys;
+        };
+
+        struct AnimationData {
+            std::string name;
+            double_t duration = 0.0;
+            double_t ticksPerSecond = 0.0;
+            std::vector<ChannelData> channels;
+        };
+
+        struct NodeData {
+            std::string name;
+            BakedNode node;
+            std::vector<uint32_t> meshes;
+            std::vector<uint32_t> children;
+        };
+
+    private:
+        std::vector<SubmeshData> m_submeshes;
+        std::vector<BakedSkeletonBone> m_skeleton;
+        std::vector<AnimationData> m_animations;
+        std::vector<NodeData> m_nodes;
+        std::optional<float_t> m_scaleFactor;
+
+    };
+}
+
+#endif //SRENGINE_BAKEDMESH_H
@@ -0,0 +1,64 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SRENGINE_EVDEVINPUTSOURCE_H
+#define SRENGINE_EVDEVINPUTSOURCE_H
+
+#include <Utils/Input/InputSource.h>
+#include <Utils/Types/Thread.h>
+
+#include <bitset>
+
+namespace SR_UTILS_NS {
+    /**
+     * Источник клавиш и кнопок мыши напрямую из /dev/input/event*, без X11.
+     * Устройства читаются отдельным потоком, который спит в poll до прихода событий.
+     * Время событий берется из ядра (CLOCK_MONOTONIC), поэтому задержка до кадра не зависит от потока чтения.
+     * Позиция курсора и колесо по-прежнему приходят от окна.
+     * Левый и правый Shift, Ctrl, Alt (и два Enter) дают один KeyCode: нажатия считаются по всем клавишам
+     * и устройствам, отпускание приходит, только когда отпущена последняя из них.
+     */
+    class SR_DLL_EXPORT EvdevInputSource : public InputSource {
+        /// KEY_CNT из linux/input.h
+        static constexpr uint32_t KEY_CODES_COUNT = 0x300;
+    public:
+        ~EvdevInputSource() override;
+
+    public:
+        /// false, если нет доступных устройств (например, пользователь не в группе input)
+        bool Open() override;
+        /// Уже открытые неблокирующие дескрипторы с событиями evdev (например, uinput), источник закрывает их сам
+        bool Open(std::vector<int32_t> devices);
+        void Close() override;
+        SR_NODISCARD std::string_view GetName() const override { return "Evdev"; }
+
+        SR_NODISCARD static KeyCode TranslateKey(uint16_t code);
+
+    private:
+        struct Device {
+            int32_t fd = -1;
+            /// события до SYN_REPORT после переполнения буфера ядра потеряны
+            bool isDropped = false;
+            std::bitset<KEY_CODES_COUNT> pressed;
+        };
+
+    private:
+        void ReadThread();
+        void ReadDevice(Device& device);
+        /// Перечитывает нажатые клавиши у ядра после потерянных событий
+        void SyncDevice(Device& device, InputTimestamp timestamp);
+        void SetKeyState(Device& device, uint16_t code, bool isPressed, InputTimestamp timestamp);
+
+    private:
+        std::vector<Device> m_devices;
+        /// только с потока чтения
+        uint8_t m_pressedCount[256] = { };
+        /// запись в канал будит поток чтения при закрытии
+        int32_t m_wakeup[2] = { -1, -1 };
+        SR_HTYPES_NS::Thread::Ptr m_thread = nullptr;
+
+    };
+}
+
+#endif //SRENGINE_EVDEVINPUTSOURCE_H
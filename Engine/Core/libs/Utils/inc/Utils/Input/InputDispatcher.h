@@ -6,11 +6,20 @@
 #define SRENGINE_INPUTDISPATCHER_H
 
 #include <Utils/Events/EventDispatcher.h>
+#include <Utils/Events/TypedEventDispatcher.h>
 #include <Utils/Input/InputDevice.h>
 
 namespace SR_UTILS_NS {
+    class InputHandler;
+
     class SR_DLL_EXPORT InputDispatcher : public EventDispatcher {
         using Super = EventDispatcher;
+        using Dispatcher = TypedEventDispatcher<KeyboardInputData, MouseInputData>;
+        struct Subscription {
+            InputHandler* pHandler = nullptr;
+            EventListenerId keyboard = 0;
+            EventListenerId mouse = 0;
+        };
     public:
         InputDispatcher();
         ~InputDispatcher() override;
@@ -18,6 +27,11 @@ namespace SR_UTILS_NS {
     public:
         void Check();
 
+        /// Обработчики ввода получают события через типизированный диспетчер, без поиска по имени и dynamic_cast
+        void Register(InputHandler* pHandler);
+        void Unregister(InputHandler* pHandler);
+        void UnregisterAll();
+
     private:
         void CheckKeyboard();
         void CheckMouse();
@@ -26,6 +40,9 @@ namespace SR_UTILS_NS {
         KeyboardInputData* m_keyboardData;
         MouseInputData* m_mouseData;
 
+        Dispatcher m_dispatcher;
+        std::vector<Subscription> m_subscriptions;
+
     };
 }
 
@@ -12,6 +12,7 @@
 
 namespace SR_UTILS_NS {
     class SR_DLL_EXPORT InputHandler : public Event<InputDeviceData*> {
+        friend class InputDispatcher;
     protected:
         InputHandler()
             : Event(typeid(InputHandler).name())
@@ -37,8 +38,8 @@ namespace SR_UTILS_NS {
     private:
         void Trigger(InputDeviceData* inputDeviceData) override;
 
-        void TriggerKeyboard(KeyboardInputData* keyboardInputData);
-        void TriggerMouse(MouseInputData* mouseInputData);
+        void TriggerKeyboard(const KeyboardInputData* keyboardInputData);
+        void TriggerMouse(const MouseInputData* mouseInputData);
 
     };
 }
@@ -0,0 +1,104 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SRENGINE_INPUTSOURCE_H
+#define SRENGINE_INPUTSOURCE_H
+
+#include <Utils/Input/KeyCodes.h>
+#include <Utils/Types/SPSCQueue.h>
+
+namespace SR_UTILS_NS {
+    /// Наносекунды монотонных часов, общих для всех источников
+    using InputTimestamp = uint64_t;
+
+    SR_DLL_EXPORT InputTimestamp GetInputTimestamp();
+
+    struct RawInputEvent {
+        InputTimestamp timestamp = 0;
+        KeyCode key = KeyCode::None;
+        bool pressed = false;
+    };
+
+    /**
+     * Источник сырых событий клавиш и кнопок мыши.
+     * Источник пишет события со своего потока, Input забирает их раз в кадр через Flush.
+     * При переполнении очереди новые события отбрасываются и учитываются в GetDroppedCount.
+     */
+    class SR_DLL_EXPORT InputSource : public NonCopyable {
+    public:
+        static constexpr uint64_t QUEUE_CAPACITY = 1024;
+
+    public:
+        InputSource()
+            : m_queue(QUEUE_CAPACITY)
+        { }
+
+        ~InputSource() override = default;
+
+    public:
+        virtual bool Open() = 0;
+        virtual void Close() = 0;
+        SR_NODISCARD virtual std::string_view GetName() const = 0;
+
+        /// Только с потока Input, вызывается перед Flush. Для источников без своего потока
+        virtual void Poll(InputTimestamp now) { }
+
+        /// Только с потока Input
+        template<typename Callback> uint64_t Flush(Callback&& callback) {
+            return m_queue.Flush(std::forward<Callback>(callback));
+        }
+
+        SR_NODISCARD uint64_t GetDroppedCount() const noexcept { return m_queue.GetDroppedCount(); }
+
+    protected:
+        /// Только с потока источника
+        bool Emit(const RawInputEvent& event) noexcept { return m_queue.Push(event); }
+
+    private:
+        SR_HTYPES_NS::SPSCQueue<RawInputEvent> m_queue;
+
+    };
+
+    /// Программный источник без устройства, для тестов без окна и воспроизведения ввода
+    class SR_DLL_EXPORT SyntheticInputSource : public InputSource {
+    public:
+        ~SyntheticInputSource() override = default;
+
+    public:
+        bool Open() override { return true; }
+        void Close() override { }
+        SR_NODISCARD std::string_view GetName() const override { return "Synthetic"; }
+
+        /// Нулевое время заменяется текущим
+        bool Press(KeyCode key, InputTimestamp timestamp = 0);
+        bool Release(KeyCode key, InputTimestamp timestamp = 0);
+        bool Push(const RawInputEvent& event) { return Emit(event); }
+
+    };
+
+    /**
+     * Источник для платформ без событийного ввода. Состояние клавиатуры опрашивается с потока Input,
+     * изменения с прошлого опроса становятся событиями со временем опроса, поэтому такой ввод
+     * проходит тот же путь, что и события устройств, в том числе запись и воспроизведение сессии.
+     */
+    class SR_DLL_EXPORT PolledInputSource : public InputSource {
+    public:
+        ~PolledInputSource() override = default;
+
+    public:
+        bool Open() override;
+        void Close() override { }
+        void Poll(InputTimestamp now) override;
+
+    protected:
+        /// 256 клавиш, старший бит - клавиша нажата, как у GetKeyboardState
+        virtual bool ReadKeyboardState(uint8_t* pKeys) = 0;
+
+    private:
+        bool m_isPressed[256] = { };
+
+    };
+}
+
+#endif //SRENGINE_INPUTSOURCE_H
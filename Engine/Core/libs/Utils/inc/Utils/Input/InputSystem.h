@@ -7,6 +7,7 @@
 
 #include <Utils/Math/Vector2.h>
 #include <Utils/Input/KeyCodes.h>
+#include <Utils/Input/InputSource.h>
 #include <Utils/Common/Singleton.h>
 
 namespace SR_UTILS_NS {
@@ -29,6 +30,16 @@ namespace SR_UTILS_NS {
         void Reload();
         void ResetMouse();
 
+        /**
+         * Пока есть хотя бы один источник, клавиши берутся из очередей источников, а не опросом.
+         * События разных источников сливаются по времени. Нажатие и отпускание в одном кадре
+         * дают Down в этом кадре и Up в следующем, отпускание и повторное нажатие - Up в этом и Down в следующем,
+         * поэтому ни одно нажатие не теряется и у каждого Down есть свой Up.
+         */
+        bool AddSource(std::unique_ptr<InputSource>&& pSource);
+        void ClearSources();
+        SR_NODISCARD bool HasSources() const;
+
         SR_NODISCARD SR_MATH_NS::FVector2 GetMouseDrag();
         SR_NODISCARD SR_MATH_NS::FVector2 GetMousePos() const { return m_mouse; }
         SR_NODISCARD SR_MATH_NS::FVector2 GetPrevMousePos() const { return m_mousePrev; }
@@ -46,10 +57,17 @@ namespace SR_UTILS_NS {
         bool GetKeyUp(KeyCode key);
         bool GetKey(KeyCode key);
 
+        /// Время события, которое привело клавишу в текущее состояние
+        SR_NODISCARD InputTimestamp GetKeyTimestamp(KeyCode key) const { return m_keyTimestamps[static_cast<uint8_t>(key)]; }
+        /// Время от самого раннего события, полученного в последнем Check, до этого Check, 0 если событий не было
+        SR_NODISCARD uint64_t GetInputLatency() const { return m_latency; }
+
         void LockCursor(bool isLock);
 
     private:
         void Reset();
+        bool CheckSources();
+        void ApplyEvent(const RawInputEvent& event);
 
     private:
         SR_MATH_NS::FVector2 m_mouseDrag;
@@ -64,6 +82,19 @@ namespace SR_UTILS_NS {
         State m_keys[256] = { };
         uint8_t* m_arr = nullptr;
 
+        mutable std::mutex m_sourcesMutex;
+        std::vector<std::unique_ptr<InputSource>> m_sources;
+        std::vector<RawInputEvent> m_events;
+
+        InputTimestamp m_keyTimestamps[256] = { };
+        /// отпускание клавиши, нажатой в этом же кадре, применяется в следующем
+        InputTimestamp m_pendingRelease[256] = { };
+        /// нажатие клавиши, отпущенной в этом же кадре, применяется в следующем
+        InputTimestamp m_pendingPress[256] = { };
+        /// события до последнего Reload относятся к потерянному фокусу
+        std::atomic<InputTimestamp> m_reloadTimestamp = 0;
+        uint64_t m_latency = 0;
+
     };
 }
 
@@ -0,0 +1,77 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SRENGINE_SIMD_H
+#define SRENGINE_SIMD_H
+
+#include <Utils/Math/Matrix4x4.h>
+
+namespace SR_MATH_NS {
+    struct AABB {
+        FVector3 min;
+        FVector3 max;
+    };
+
+    struct Sphere {
+        FVector3 center;
+        Unit radius = 0.f;
+    };
+
+    /// Точка p лежит с положительной стороны, если Dot(normal, p) + distance >= 0
+    struct Plane {
+        FVector3 normal;
+        Unit distance = 0.f;
+    };
+}
+
+/**
+ * Пакетные математические ядра. Каждое ядро обрабатывает массив элементов за вызов:
+ * на x86 - SSE, на процессорах с AVX2 и FMA - AVX2 (выбирается при запуске), на AArch64 - NEON.
+ * Пространство имен Scalar - эталонная реализация поверх обычных Matrix4x4 и Quaternion,
+ * с ней сравниваются векторные варианты. Результаты совпадают с эталоном с точностью до ошибок округления,
+ * Slerp - до 1e-5 из-за полиномиальных acos и sin.
+ * Входные и выходные массивы могут совпадать, но не должны частично перекрываться.
+ */
+namespace SR_MATH_NS::SIMD {
+    enum class Backend : uint8_t {
+        Scalar, SSE, AVX2, NEON
+    };
+
+    SR_DLL_EXPORT extern Backend GetBackend();
+    SR_DLL_EXPORT extern const char* GetBackendName(Backend backend);
+    SR_DLL_EXPORT extern bool IsBackendSupported(Backend backend);
+    /// Для сравнения реализаций, false если процессор не поддерживает набор инструкций
+    SR_DLL_EXPORT extern bool SetBackend(Backend backend);
+
+    /// pResult[i] = pLeft[i] * pRight[i]
+    SR_DLL_EXPORT extern void MultiplyMatrices(const Matrix4x4* pLeft, const Matrix4x4* pRight, Matrix4x4* pResult, uint64_t count);
+    /// pResult[i] = left * pRight[i], например мировые матрицы детей одного родителя
+    SR_DLL_EXPORT extern void MultiplyMatrices(const Matrix4x4& left, const Matrix4x4* pRight, Matrix4x4* pResult, uint64_t count);
+
+    /// pResult[i] = Matrix4x4(pTranslation[i], pRotation[i], pScale[i])
+    SR_DLL_EXPORT extern void ComposeTRS(const FVector3* pTranslation, const Quaternion* pRotation, const FVector3* pScale, Matrix4x4* pResult, uint64_t count);
+    /// То же, что Matrix4x4::Decompose(translation, rotation, scale)
+    SR_DLL_EXPORT extern void DecomposeTRS(const Matrix4x4* pMatrices, FVector3* pTranslation, Quaternion* pRotation, FVector3* pScale, uint64_t count);
+
+    /// pResult[i] = pFrom[i].Slerp(pTo[i], pT[i]), t в диапазоне [0, 1]
+    SR_DLL_EXPORT extern void SlerpQuaternions(const Quaternion* pFrom, const Quaternion* pTo, const float_t* pT, Quaternion* pResult, uint64_t count);
+
+    /// Описанный AABB вокруг pBounds[i], преобразованного матрицей pMatrices[i]
+    SR_DLL_EXPORT extern void TransformAABBs(const Matrix4x4* pMatrices, const AABB* pBounds, AABB* pResult, uint64_t count);
+
+    /// pVisible[i] = 1, если сфера хотя бы частично лежит с положительной стороны всех плоскостей (например, фрустума)
+    SR_DLL_EXPORT extern void TestSpheres(const Plane* pPlanes, uint32_t planesCount, const Sphere* pSpheres, uint8_t* pVisible, uint64_t count);
+
+    namespace Scalar {
+        SR_DLL_EXPORT extern void MultiplyMatrices(const Matrix4x4* pLeft, const Matrix4x4* pRight, Matrix4x4* pResult, uint64_t count);
+        SR_DLL_EXPORT extern void MultiplyMatrices(const Matrix4x4& left, const Matrix4x4* pRight, Matrix4x4* pResult, uint64_t count);
+        SR_DLL_EXPORT extern void ComposeTRS(const FVector3* pTranslation, const Quaternion* pRotation, const FVector3* pScale, Matrix4x4* pResult, uint64_t count);
+        SR_DLL_EXPORT extern void DecomposeTRS(const Matrix4x4* pMatrices, FVector3* pTranslation, Quaternion* pRotation, FVector3* pScale, uint64_t count);
+        SR_DLL_EXPORT extern void SlerpQuaternions(const Quaternion* pFrom, const Quaternion* pTo, const float_t* pT, Quaternion* pResult, uint64_t count);
+        SR_DLL_EXPORT extern void TransformAABBs(const Matrix4x4* pMatrices, const AABB* pBounds, AABB* pResult, uint64_t count);
+        SR_DLL_EXPORT extern void TestSpheres(const Plane* pPlanes, uint32_t planesCount, const Sphere* pSpheres, uint8_t* pVisible, uint64_t count);
+    }
+}
+
+#endif //SRENGINE_SIMD_H
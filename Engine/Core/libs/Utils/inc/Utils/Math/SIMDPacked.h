@@ -0,0 +1,140 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SRENGINE_SIMDPACKED_H
+#define SRENGINE_SIMDPACKED_H
+
+#include <Utils/Math/Vector3.h>
+
+/**
+ * Тонкая обертка над 4 float (SSE или NEON) для реализаций пакетных ядер.
+ * Подключается только из .cpp: тянет заголовки интринсиков и определяет SR_SIMD_* под текущую платформу.
+ */
+#if defined(__aarch64__) || defined(_M_ARM64)
+    #define SR_SIMD_NEON
+    #include <arm_neon.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define SR_SIMD_SSE
+    #define SR_SIMD_AVX2
+    #include <immintrin.h>
+
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #endif
+
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #define SR_SIMD_TARGET_AVX2
+    #else
+        #define SR_SIMD_TARGET_AVX2 __attribute__((target("avx2,fma")))
+    #endif
+#endif
+
+#if defined(SR_SIMD_SSE) || defined(SR_SIMD_NEON)
+namespace SR_MATH_NS::SIMD::Packed {
+#if defined(SR_SIMD_SSE)
+    using Float4 = __m128;
+
+    SR_FORCE_INLINE static Float4 Load(const float_t* p) { return _mm_loadu_ps(p); }
+    SR_FORCE_INLINE static void Store(float_t* p, Float4 v) { _mm_storeu_ps(p, v); }
+    SR_FORCE_INLINE static Float4 Splat(float_t value) { return _mm_set1_ps(value); }
+    SR_FORCE_INLINE static Float4 Add(Float4 a, Float4 b) { return _mm_add_ps(a, b); }
+    SR_FORCE_INLINE static Float4 Sub(Float4 a, Float4 b) { return _mm_sub_ps(a, b); }
+    SR_FORCE_INLINE static Float4 Mul(Float4 a, Float4 b) { return _mm_mul_ps(a, b); }
+    SR_FORCE_INLINE static Float4 Div(Float4 a, Float4 b) { return _mm_div_ps(a, b); }
+    SR_FORCE_INLINE static Float4 Sqrt(Float4 v) { return _mm_sqrt_ps(v); }
+    SR_FORCE_INLINE static Float4 Abs(Float4 v) { return _mm_andnot_ps(_mm_set1_ps(-0.f), v); }
+    SR_FORCE_INLINE static Float4 Negate(Float4 v) { return _mm_xor_ps(v, _mm_set1_ps(-0.f)); }
+    SR_FORCE_INLINE static Float4 Less(Float4 a, Float4 b) { return _mm_cmplt_ps(a, b); }
+    SR_FORCE_INLINE static Float4 Greater(Float4 a, Float4 b) { return _mm_cmpgt_ps(a, b); }
+    SR_FORCE_INLINE static Float4 GreaterEqual(Float4 a, Float4 b) { return _mm_cmpge_ps(a, b); }
+    /// mask ? a : b по каждой дорожке
+    SR_FORCE_INLINE static Float4 Select(Float4 mask, Float4 a, Float4 b) { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+    SR_FORCE_INLINE static uint32_t MoveMask(Float4 mask) { return static_cast<uint32_t>(_mm_movemask_ps(mask)); }
+    SR_FORCE_INLINE static void Transpose(Float4& r0, Float4& r1, Float4& r2, Float4& r3) { _MM_TRANSPOSE4_PS(r0, r1, r2, r3); }
+
+    /// SSE2 не умеет floor: усечение и поправка для отрицательных, |v| < 2^31
+    SR_FORCE_INLINE static Float4 Floor(Float4 v) {
+        const Float4 truncated = _mm_cvtepi32_ps(_mm_cvttps_epi32(v));
+        return _mm_sub_ps(truncated, _mm_and_ps(_mm_cmplt_ps(v, truncated), _mm_set1_ps(1.f)));
+    }
+
+    /// Целые значения дорожек, v уже должен быть целым
+    SR_FORCE_INLINE static void StoreInt(int32_t* p, Float4 v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), _mm_cvttps_epi32(v)); }
+
+    /// Четыре упакованных FVector3 (x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3) в x, y, z по дорожкам
+    SR_FORCE_INLINE static void LoadVector3x4(const float_t* p, Float4& x, Float4& y, Float4& z) {
+        const Float4 v0 = _mm_loadu_ps(p);
+        const Float4 v1 = _mm_loadu_ps(p + 4);
+        const Float4 v2 = _mm_loadu_ps(p + 8);
+
+        x = _mm_shuffle_ps(_mm_shuffle_ps(v0, v0, _MM_SHUFFLE(3, 3, 0, 0)), _mm_shuffle_ps(v1, v2, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+        y = _mm_shuffle_ps(_mm_shuffle_ps(v0, v1, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(v1, v2, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+        z = _mm_shuffle_ps(_mm_shuffle_ps(v0, v1, _MM_SHUFFLE(1, 1, 2, 2)), _mm_shuffle_ps(v2, v2, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+    }
+
+    SR_FORCE_INLINE static void StoreVector3x4(float_t* p, Float4 x, Float4 y, Float4 z) {
+        _mm_storeu_ps(p, _mm_shuffle_ps(_mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0)));
+        _mm_storeu_ps(p + 4, _mm_shuffle_ps(_mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0)));
+        _mm_storeu_ps(p + 8, _mm_shuffle_ps(_mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0)));
+    }
+#else
+    using Float4 = float32x4_t;
+
+    SR_FORCE_INLINE static Float4 Load(const float_t* p) { return vld1q_f32(p); }
+    SR_FORCE_INLINE static void Store(float_t* p, Float4 v) { vst1q_f32(p, v); }
+    SR_FORCE_INLINE static Float4 Splat(float_t value) { return vdupq_n_f32(value); }
+    SR_FORCE_INLINE static Float4 Add(Float4 a, Float4 b) { return vaddq_f32(a, b); }
+    SR_FORCE_INLINE static Float4 Sub(Float4 a, Float4 b) { return vsubq_f32(a, b); }
+    SR_FORCE_INLINE static Float4 Mul(Float4 a, Float4 b) { return vmulq_f32(a, b); }
+    SR_FORCE_INLINE static Float4 Div(Float4 a, Float4 b) { return vdivq_f32(a, b); }
+    SR_FORCE_INLINE static Float4 Sqrt(Float4 v) { return vsqrtq_f32(v); }
+    SR_FORCE_INLINE static Float4 Abs(Float4 v) { return vabsq_f32(v); }
+    SR_FORCE_INLINE static Float4 Negate(Float4 v) { return vnegq_f32(v); }
+    SR_FORCE_INLINE static Float4 Less(Float4 a, Float4 b) { return vreinterpretq_f32_u32(vcltq_f32(a, b)); }
+    SR_FORCE_INLINE static Float4 Greater(Float4 a, Float4 b) { return vreinterpretq_f32_u32(vcgtq_f32(a, b)); }
+    SR_FORCE_INLINE static Float4 GreaterEqual(Float4 a, Float4 b) { return vreinterpretq_f32_u32(vcgeq_f32(a, b)); }
+    SR_FORCE_INLINE static Float4 Select(Float4 mask, Float4 a, Float4 b) { return vbslq_f32(vreinterpretq_u32_f32(mask), a, b); }
+    SR_FORCE_INLINE static Float4 Floor(Float4 v) { return vrndmq_f32(v); }
+    SR_FORCE_INLINE static void StoreInt(int32_t* p, Float4 v) { vst1q_s32(p, vcvtq_s32_f32(v)); }
+
+    SR_FORCE_INLINE static uint32_t MoveMask(Float4 mask) {
+        static const int32_t shifts[4] = { 0, 1, 2, 3 };
+        const uint32x4_t bits = vshlq_u32(vshrq_n_u32(vreinterpretq_u32_f32(mask), 31), vld1q_s32(shifts));
+        return vaddvq_u32(bits);
+    }
+
+    SR_FORCE_INLINE static void Transpose(Float4& r0, Float4& r1, Float4& r2, Float4& r3) {
+        const float32x4x2_t r02 = vzipq_f32(r0, r2);
+        const float32x4x2_t r13 = vzipq_f32(r1, r3);
+        const float32x4x2_t xy = vzipq_f32(r02.val[0], r13.val[0]);
+        const float32x4x2_t zw = vzipq_f32(r02.val[1], r13.val[1]);
+
+        r0 = xy.val[0];
+        r1 = xy.val[1];
+        r2 = zw.val[0];
+        r3 = zw.val[1];
+    }
+
+    SR_FORCE_INLINE static void LoadVector3x4(const float_t* p, Float4& x, Float4& y, Float4& z) {
+        const float32x4x3_t vectors = vld3q_f32(p);
+        x = vectors.val[0];
+        y = vectors.val[1];
+        z = vectors.val[2];
+    }
+
+    SR_FORCE_INLINE static void StoreVector3x4(float_t* p, Float4 x, Float4 y, Float4 z) {
+        vst3q_f32(p, float32x4x3_t { { x, y, z } });
+    }
+#endif
+
+    /// Записывает x, y, z дорожек, не трогая память за вектором
+    SR_FORCE_INLINE static void StoreVector3(FVector3& vector, Float4 v) {
+        float_t values[4];
+        Store(values, v);
+        std::memcpy(&vector.x, values, sizeof(FVector3));
+    }
+}
+#endif
+
+#endif //SRENGINE_SIMDPACKED_H
@@ -13,6 +13,8 @@ namespace SR_UTILS_NS {
     SR_ENUM_NS_CLASS_T(PlatformType, uint8_t,
         Unknown, Windows, Linux, Android, MacOS
     );
+
+    class InputSource;
 }
 
 namespace SR_UTILS_NS::Platform {
@@ -49,6 +51,8 @@ namespace SR_UTILS_NS::Platform {
     SR_DLL_EXPORT extern bool IsExists(const Path& path);
     SR_DLL_EXPORT extern bool FileIsHidden(const Path& path);
     SR_DLL_EXPORT extern std::list<Path> GetInDirectory(const Path& dir, Path::Type type);
+    /// Открытый источник событий устройств ввода, nullptr - клавиши опрашиваются в Input::Check
+    SR_DLL_EXPORT extern std::unique_ptr<InputSource> CreateInputSource();
 }
 
 #endif //SR_ENGINE_UTILS_PLATFORM_H
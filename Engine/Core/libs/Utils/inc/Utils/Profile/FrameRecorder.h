@@ -0,0 +1,123 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SRENGINE_FRAMERECORDER_H
+#define SRENGINE_FRAMERECORDER_H
+
+#include <Utils/Common/Singleton.h>
+#include <Utils/Input/InputSource.h>
+#include <Utils/FileSystem/Path.h>
+#include <Utils/Math/Vector2.h>
+
+namespace SR_UTILS_NS {
+    enum class FrameRecorderMode : uint8_t {
+        None, Record, Replay
+    };
+
+    /// Время хранится смещением от момента опроса, поэтому при воспроизведении сохраняется задержка ввода
+    struct RecordedInputEvent {
+        int64_t age = 0;
+        KeyCode key = KeyCode::None;
+        bool pressed = false;
+    };
+
+    /// Один фиксированный шаг. Ввод опрашивается только при фокусе окна
+    struct RecordedStep {
+        bool isFocused = false;
+        SR_MATH_NS::FVector2 mouse;
+        SR_MATH_NS::FVector2 scroll;
+        std::vector<RecordedInputEvent> events;
+    };
+
+    struct RecordedFrame {
+        /// наносекунды
+        uint64_t deltaTime = 0;
+        uint32_t seed = 0;
+        uint32_t fixedSteps = 0;
+        uint64_t checksum = 0;
+        std::vector<RecordedStep> steps;
+    };
+
+    struct ReplayFrameResult {
+        uint64_t frameTime = 0;
+        uint64_t checksum = 0;
+        uint64_t expectedChecksum = 0;
+    };
+
+    /**
+     * Запись и воспроизведение сессии по кадрам: dt, число фиксированных шагов, сид генератора игровой логики,
+     * фокус и ввод каждого шага и контрольная сумма состояния сцены в конце кадра.
+     * При воспроизведении все это берется из журнала вместо часов, устройств и random_device, поэтому сессия
+     * повторяется кадр в кадр, а время кадров можно сравнивать между сборками. По окончании воспроизведения
+     * рядом с журналом пишется отчет <журнал>.csv со временем и контрольными суммами каждого кадра.
+     * Все методы кадра вызываются с потока отрисовки, без активного режима они ничего не делают.
+     */
+    class SR_DLL_EXPORT FrameRecorder : public Singleton<FrameRecorder> {
+        SR_REGISTER_SINGLETON(FrameRecorder)
+    public:
+        static constexpr uint32_t MAGIC = 0x43455253; /// SREC
+        static constexpr uint32_t VERSION = 1;
+
+    protected:
+        ~FrameRecorder() override = default;
+
+    public:
+        bool StartRecording(const Path& path);
+        bool StartReplay(const Path& path);
+        /// Сохраняет журнал или отчет воспроизведения
+        void Stop();
+
+        SR_NODISCARD FrameRecorderMode GetMode() const noexcept { return m_mode; }
+        SR_NODISCARD bool IsActive() const noexcept { return m_mode != FrameRecorderMode::None; }
+        SR_NODISCARD bool IsReplaying() const noexcept { return m_mode == FrameRecorderMode::Replay; }
+        /// Все кадры журнала воспроизведены
+        SR_NODISCARD bool IsReplayFinished() const noexcept { return m_isReplayFinished; }
+
+        /// Принимают реальное значение и возвращают то, которое должен использовать кадр
+        SR_NODISCARD uint64_t BeginFrame(uint64_t deltaTime);
+        SR_NODISCARD uint32_t ScheduleFixedSteps(uint32_t fixedSteps);
+        SR_NODISCARD bool BeginFixedStep(bool isFocused);
+        void ScheduleInput(std::vector<RawInputEvent>& events, SR_MATH_NS::FVector2& mouse, SR_MATH_NS::FVector2& scroll, InputTimestamp now);
+        void EndFrame(uint64_t checksum);
+
+        /// Генератор игровой логики и скриптов, при записи и воспроизведении пересевается каждый кадр.
+        /// Отдельно от Random и rand(): Random выдает идентификаторы, которые не должны повторяться
+        SR_NODISCARD float_t RandomFloat(float_t minimum, float_t maximum);
+        SR_NODISCARD int32_t RandomInt32(int32_t minimum, int32_t maximum);
+
+        SR_NODISCARD const std::vector<RecordedFrame>& GetFrames() const noexcept { return m_frames; }
+        SR_NODISCARD const std::vector<ReplayFrameResult>& GetReplayResults() const noexcept { return m_results; }
+        SR_NODISCARD uint64_t GetMismatchCount() const noexcept { return m_mismatches; }
+
+        SR_NODISCARD static std::string Serialize(const std::vector<RecordedFrame>& frames);
+        SR_NODISCARD static bool Deserialize(const std::string& data, std::vector<RecordedFrame>& frames);
+
+    private:
+        void Reset();
+        void SaveReport() const;
+        SR_NODISCARD RecordedStep* GetCurrentStep();
+
+    private:
+        std::atomic<FrameRecorderMode> m_mode = FrameRecorderMode::None;
+        std::atomic<bool> m_isReplayFinished = false;
+
+        Path m_path;
+        std::vector<RecordedFrame> m_frames;
+        std::vector<ReplayFrameResult> m_results;
+
+        /// кадр, который сейчас пишется или воспроизводится
+        uint64_t m_frame = 0;
+        uint64_t m_step = 0;
+        bool m_isFrameActive = false;
+        std::chrono::steady_clock::time_point m_frameStart;
+
+        uint64_t m_mismatches = 0;
+
+        std::random_device m_randomDevice;
+        std::mt19937 m_random { m_randomDevice() };
+
+    };
+}
+
+#endif //SRENGINE_FRAMERECORDER_H
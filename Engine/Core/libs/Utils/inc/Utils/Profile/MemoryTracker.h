@@ -0,0 +1,120 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SRENGINE_MEMORYTRACKER_H
+#define SRENGINE_MEMORYTRACKER_H
+
+#include <Utils/Common/Singleton.h>
+
+namespace SR_UTILS_NS {
+    enum class MemoryTag : uint8_t {
+        Unknown, Resources, Scene, Mesh, Marshal, Audio, Scripts,
+        Count
+    };
+
+    static constexpr uint64_t MemoryTagsCount = static_cast<uint64_t>(MemoryTag::Count);
+
+    SR_DLL_EXPORT const char* GetMemoryTagName(MemoryTag tag) noexcept;
+
+    struct MemoryTagStats {
+        /// живые байты и выделения
+        int64_t bytes = 0;
+        int64_t allocations = 0;
+        /// наибольшее значение bytes среди всех Update
+        int64_t peakBytes = 0;
+        uint64_t totalAllocations = 0;
+    };
+
+    struct MemorySample {
+        MemoryTag tag = MemoryTag::Unknown;
+        uint64_t size = 0;
+        std::string stacktrace;
+    };
+
+    /**
+     * Учет памяти по подсистемам. Каждое выделение помечается тегом, счетчики пишутся в буфер своего потока
+     * без блокировок и сводятся раз в кадр в Update, там же обновляются пиковые значения и счетчики профайлера.
+     * В режиме выборки у каждого N-го выделения сохраняется стек, живые выборки попадают в отчет об утечках.
+     * Трекер не уничтожается вместе с остальными синглтонами, так как память освобождается и после них.
+     */
+    class SR_DLL_EXPORT MemoryTracker : public Singleton<MemoryTracker> {
+        SR_REGISTER_SINGLETON(MemoryTracker)
+        struct ThreadCounters;
+    public:
+        static constexpr uint32_t DefaultSampleRate = 64;
+
+    protected:
+        MemoryTracker();
+        ~MemoryTracker() override;
+
+    public:
+        /// Блок с заголовком из malloc, выравнивание как у malloc
+        SR_NODISCARD static void* Allocate(MemoryTag tag, uint64_t size) noexcept;
+        /// Для типов с выравниванием больше, чем у malloc. alignment - степень двойки, освобождать тем же Free
+        SR_NODISCARD static void* Allocate(MemoryTag tag, uint64_t size, uint64_t alignment) noexcept;
+        static void Free(void* pData) noexcept;
+
+        /// Учет памяти, выделенной в обход Allocate
+        static void OnAllocate(MemoryTag tag, uint64_t size) noexcept;
+        static void OnFree(MemoryTag tag, uint64_t size) noexcept;
+
+        /// Выключенный трекер выделяет память с тем же заголовком, но без счетчиков и выборки.
+        /// Блоки, выделенные до выключения, при освобождении учитываются как обычно
+        static void SetEnabled(bool enabled) noexcept { s_enabled.store(enabled, std::memory_order_relaxed); }
+        SR_NODISCARD static bool IsEnabled() noexcept { return s_enabled.load(std::memory_order_relaxed); }
+
+        /// 0 - выборка выключена
+        static void SetSampleRate(uint32_t rate) noexcept { s_sampleRate.store(rate, std::memory_order_relaxed); }
+        SR_NODISCARD static uint32_t GetSampleRate() noexcept { return s_sampleRate.load(std::memory_order_relaxed); }
+
+        void Update();
+
+        SR_NODISCARD std::array<MemoryTagStats, MemoryTagsCount> GetStats() const;
+        SR_NODISCARD std::vector<MemorySample> GetLiveSamples() const;
+
+        /// Пишет в лог все, что еще не освобождено, возвращает число живых выделений
+        uint64_t ReportLeaks();
+
+    private:
+        SR_NODISCARD static ThreadCounters* GetThreadCounters() noexcept;
+        SR_NODISCARD static ThreadCounters* RegisterThread() noexcept;
+        static void Sample(void* pData, MemoryTag tag, uint64_t size);
+
+        SR_NODISCARD bool IsSingletonCanBeDestroyed() const final { return false; }
+
+    private:
+        static std::atomic<uint32_t> s_sampleRate;
+        static std::atomic<bool> s_enabled;
+
+        std::vector<std::unique_ptr<ThreadCounters>> m_threads;
+        std::array<MemoryTagStats, MemoryTagsCount> m_stats = { };
+
+        mutable std::mutex m_samplesMutex;
+        std::unordered_map<void*, MemorySample> m_samples;
+
+    };
+}
+
+/// Выделения объектов класса учитываются под тегом, наследники могут переопределить тег
+#define SR_MEMORY_TAG(tag)                                                                                              \
+    public:                                                                                                             \
+        static void* operator new(std::size_t size) {                                                                   \
+            if (void* pData = SR_UTILS_NS::MemoryTracker::Allocate(tag, size)) {                                        \
+                return pData;                                                                                           \
+            }                                                                                                           \
+            throw std::bad_alloc();                                                                                     \
+        }                                                                                                               \
+        static void* operator new(std::size_t size, std::align_val_t alignment) {                                       \
+            if (void* pData = SR_UTILS_NS::MemoryTracker::Allocate(tag, size, static_cast<uint64_t>(alignment))) {      \
+                return pData;                                                                                           \
+            }                                                                                                           \
+            throw std::bad_alloc();                                                                                     \
+        }                                                                                                               \
+        static void operator delete(void* pData) noexcept { SR_UTILS_NS::MemoryTracker::Free(pData); }                  \
+        static void operator delete(void* pData, std::align_val_t) noexcept { SR_UTILS_NS::MemoryTracker::Free(pData); }\
+        static void* operator new(std::size_t, void* pPlace) noexcept { return pPlace; }                                \
+        static void operator delete(void*, void*) noexcept { }                                                          \
+    private:                                                                                                            \
+
+#endif //SRENGINE_MEMORYTRACKER_H
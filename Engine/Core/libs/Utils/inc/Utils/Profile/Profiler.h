@@ -0,0 +1,150 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SRENGINE_PROFILER_H
+#define SRENGINE_PROFILER_H
+
+#include <Utils/Common/Singleton.h>
+#include <Utils/FileSystem/Path.h>
+#include <Utils/Profile/TracyContext.h>
+
+namespace SR_UTILS_NS {
+    struct ProfileZone {
+        const char* name = nullptr;
+        /// наносекунды от начала записи
+        uint64_t begin = 0;
+        uint64_t end = 0;
+        uint32_t depth = 0;
+        uint32_t threadIndex = 0;
+    };
+
+    struct ProfileCounterSample {
+        const char* name = nullptr;
+        uint64_t time = 0;
+        int64_t value = 0;
+    };
+
+    struct ProfileFrameStats {
+        uint64_t frame = 0;
+        /// наносекунды
+        uint64_t duration = 0;
+        uint64_t zones = 0;
+        uint64_t droppedZones = 0;
+        std::vector<std::pair<const char*, int64_t>> counters;
+    };
+
+    /// Встроенный профайлер, не зависит от Tracy и всегда собирается.
+    /// Зоны пишутся в заранее выделенный буфер своего потока, пока профайлер выключен,
+    /// зона стоит одну проверку атомарного флага. Имена зон и счетчиков должны быть строковыми литералами.
+    class SR_DLL_EXPORT Profiler : public Singleton<Profiler> {
+        SR_REGISTER_SINGLETON(Profiler)
+        struct ThreadBuffer;
+    public:
+        static constexpr uint64_t ThreadZonesCapacity = 1 << 16;
+        static constexpr uint32_t MaxDepth = 64;
+
+    protected:
+        /// ThreadBuffer неполный в заголовке, поэтому конструктор и деструктор определены в Profiler.cpp
+        Profiler();
+        ~Profiler() override;
+
+    public:
+        SR_NODISCARD static bool IsEnabled() noexcept { return s_isEnabled.load(std::memory_order_relaxed); }
+
+        static void BeginZone(const char* name) noexcept;
+        static void EndZone() noexcept;
+
+        /// Очищает записанное и начинает запись заново
+        void SetEnabled(bool enabled);
+        void Reset();
+
+        void BeginFrame();
+        void EndFrame();
+
+        void SetCounter(const char* name, int64_t value);
+
+        SR_NODISCARD ProfileFrameStats GetLastFrameStats() const;
+
+        SR_NODISCARD bool SaveChromeTrace(const Path& path) const;
+        SR_NODISCARD bool SaveCSV(const Path& path) const;
+
+    private:
+        SR_NODISCARD static ThreadBuffer* GetThreadBuffer() noexcept;
+        SR_NODISCARD static uint64_t Now() noexcept;
+
+        SR_NODISCARD std::vector<ProfileZone> CollectZones() const;
+        SR_NODISCARD uint64_t CountZones(uint64_t& dropped) const;
+
+        void OnSingletonDestroy() override;
+
+    private:
+        static std::atomic<bool> s_isEnabled;
+
+        std::vector<std::unique_ptr<ThreadBuffer>> m_threads;
+
+        std::vector<ProfileCounterSample> m_counters;
+        std::vector<std::pair<const char*, int64_t>> m_frameCounters;
+        std::vector<uint64_t> m_frames;
+
+        uint64_t m_frameBegin = 0;
+        uint64_t m_frameIndex = 0;
+        uint64_t m_zonesAtFrameBegin = 0;
+        uint64_t m_droppedAtFrameBegin = 0;
+        ProfileFrameStats m_lastFrame;
+
+    };
+
+    class ProfileScope : public NonCopyable {
+    public:
+        explicit ProfileScope(const char* name) noexcept
+            : m_active(Profiler::IsEnabled())
+        {
+            if (m_active) {
+                Profiler::BeginZone(name);
+            }
+        }
+
+        ~ProfileScope() override {
+            if (m_active) {
+                Profiler::EndZone();
+            }
+        }
+
+    private:
+        bool m_active = false;
+
+    };
+}
+
+#define SR_PROFILE_ZONE_N(name)                                                                 \
+    SR_TRACY_ZONE_N(name);                                                                      \
+    SR_UTILS_NS::ProfileScope SR_MACRO_CONCAT(srProfileScope, SR_LINE)(name)                    \
+
+#define SR_PROFILE_ZONE                                                                         \
+    SR_TRACY_ZONE;                                                                              \
+    SR_UTILS_NS::ProfileScope SR_MACRO_CONCAT(srProfileScope, SR_LINE)(__FUNCTION__)            \
+
+/// значение счетчика не вычисляется, если профайлер выключен
+#define SR_PROFILE_COUNTER(name, value)                                                         \
+    do {                                                                                        \
+        if (SR_UTILS_NS::Profiler::IsEnabled()) {                                               \
+            SR_UTILS_NS::Profiler::Instance().SetCounter(name, static_cast<int64_t>(value));    \
+        }                                                                                       \
+    } while (false)                                                                             \
+
+#define SR_PROFILE_FRAME_BEGIN()                                                                \
+    do {                                                                                        \
+        if (SR_UTILS_NS::Profiler::IsEnabled()) {                                               \
+            SR_UTILS_NS::Profiler::Instance().BeginFrame();                                     \
+        }                                                                                       \
+    } while (false)                                                                             \
+
+#define SR_PROFILE_FRAME_END()                                                                  \
+    do {                                                                                        \
+        if (SR_UTILS_NS::Profiler::IsEnabled()) {                                               \
+            SR_UTILS_NS::Profiler::Instance().EndFrame();                                       \
+        }                                                                                       \
+    } while (false)                                                                             \
+
+#endif //SRENGINE_PROFILER_H
@@ -12,7 +12,9 @@
 #include <Utils/Types/Function.h>
 #include <Utils/Types/SharedPtr.h>
 #include <Utils/ResourceManager/ResourceContainer.h>
+#include <Utils/ResourceManager/ResourceHandle.h>
 #include <Utils/ResourceManager/FileWatcher.h>
+#include <Utils/Profile/MemoryTracker.h>
 
 namespace SR_UTILS_NS {
     class ResourceManager;
@@ -22,7 +24,9 @@ namespace SR_UTILS_NS {
     struct ResourceInfo;
 
     class SR_DLL_EXPORT IResource : public ResourceContainer {
+        SR_MEMORY_TAG(MemoryTag::Resources)
         friend class ResourceType;
+        friend class ResourceManager;
         using Super = ResourceContainer;
         using ResourceInfoWeakPtr = std::weak_ptr<ResourceInfo>;
     public:
@@ -67,6 +71,7 @@ namespace SR_UTILS_NS {
         SR_NODISCARD uint64_t GetResourceHash() const noexcept { return m_resourceHash; }
         SR_NODISCARD ResourceInfoWeakPtr GetResourceInfo() const noexcept { return m_resourceInfo; }
         SR_NODISCARD bool IsResourceFromMemory() const noexcept { return m_isFromMemory; }
+        SR_NODISCARD ResourceHandle GetResourceHandle() const noexcept { return m_handle; }
 
         SR_NODISCARD std::string_view GetResourceName() const;
         SR_NODISCARD const Path& GetResourcePath() const;
@@ -140,7 +145,12 @@ namespace SR_UTILS_NS {
 
         uint16_t m_reloadCount = 0;
 
-        int64_t m_lifetime = 0;
+        std::atomic<int64_t> m_lifetime = 0;
+
+        /// слот в таблице ResourceManager, выдается при регистрации
+        ResourceHandle m_handle;
+        /// позиция в очереди уничтожения ResourceManager
+        uint32_t m_destroyIndex = SR_UINT32_MAX;
 
         std::atomic<bool> m_isForceDestroyed = false;
         std::atomic<bool> m_isDestroyed = false;
@@ -0,0 +1,32 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SRENGINE_RESOURCEHANDLE_H
+#define SRENGINE_RESOURCEHANDLE_H
+
+#include <Utils/Common/Hashes.h>
+
+namespace SR_UTILS_NS {
+    /// Слабая ссылка на зарегистрированный ресурс: индекс слота в ResourceManager и его поколение.
+    /// После уничтожения ресурса поколение слота увеличивается, и ResourceManager::Resolve вернет nullptr
+    /// вместо висячего указателя, даже если слот уже занят другим ресурсом.
+    struct ResourceHandle {
+        static constexpr uint32_t InvalidIndex = SR_UINT32_MAX;
+
+        uint32_t index = InvalidIndex;
+        uint32_t generation = 0;
+
+        SR_NODISCARD bool Valid() const noexcept { return index != InvalidIndex; }
+
+        SR_NODISCARD bool operator==(const ResourceHandle& other) const noexcept {
+            return index == other.index && generation == other.generation;
+        }
+
+        SR_NODISCARD bool operator!=(const ResourceHandle& other) const noexcept {
+            return !(*this == other);
+        }
+    };
+}
+
+#endif //SRENGINE_RESOURCEHANDLE_H
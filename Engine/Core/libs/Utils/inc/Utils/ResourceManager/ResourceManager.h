@@ -11,6 +11,7 @@
 #include <Utils/Common/Singleton.h>
 #include <Utils/ResourceManager/IResource.h>
 #include <Utils/ResourceManager/ResourceInfo.h>
+#include <Utils/ResourceManager/ResourceRegistry.h>
 
 namespace SR_UTILS_NS {
     class IResourceReloader;
@@ -19,8 +20,22 @@ namespace SR_UTILS_NS {
     class SR_DLL_EXPORT ResourceManager final : public Singleton<ResourceManager> {
         SR_REGISTER_SINGLETON(ResourceManager)
         using Hash = uint64_t;
+
+        struct DestroyEntry {
+            IResource* pResource = nullptr;
+            /// время последней проверки в GC, в тиках clock()
+            uint64_t time = 0;
+        };
+
+        struct ResourceSlot {
+            IResource* pResource = nullptr;
+            uint32_t generation = 0;
+        };
+
     public:
         static const uint64_t ResourceLifeTime;
+        /// Микросекунды, сколько GC может удерживать блокировку за один проход
+        static const uint64_t GCTimeBudget;
 
     public:
         SR_NODISCARD bool IsLastResource(IResource* resource);
@@ -37,6 +52,12 @@ namespace SR_UTILS_NS {
         SR_NODISCARD SR_HTYPES_NS::SharedPtr<FileWatcher> StartWatch(const Path& path);
 
         SR_NODISCARD IResource* Find(uint64_t hashTypeName, const std::string& ID);
+        /// Вернет nullptr, если ресурс по ссылке уже уничтожен. Точка использования добавляется под блокировкой
+        /// менеджера, поэтому GC не освободит ресурс, пока вызывающий не вызовет RemoveUsePoint
+        SR_NODISCARD IResource* Resolve(const ResourceHandle& handle) const;
+        SR_NODISCARD uint64_t GetDestroyQueueSize() const;
+        /// Зарегистрированные ресурсы, у каждого из них есть слот ссылки
+        SR_NODISCARD uint64_t GetResourcesCount() const;
 
         void Synchronize(bool force);
         void SetWatchingEnabled(bool enabled) { m_isWatchingEnabled = enabled; }
@@ -50,6 +71,21 @@ namespace SR_UTILS_NS {
             return dynamic_cast<T*>(Find(SR_COMPILE_TIME_CRC32_TYPE_NAME(T), id));
         }
 
+        template<typename T> T* Resolve(const ResourceHandle& handle) const {
+            auto&& pResource = Resolve(handle);
+            if (!pResource) {
+                return nullptr;
+            }
+
+            if (auto&& pTyped = dynamic_cast<T*>(pResource)) {
+                return pTyped;
+            }
+
+            pResource->RemoveUsePoint();
+
+            return nullptr;
+        }
+
         template<typename T> T* Find(const Path& path) {
             return dynamic_cast<T*>(Find(SR_COMPILE_TIME_CRC32_TYPE_NAME(T), path.ToStringRef()));
         }
@@ -84,14 +120,30 @@ namespace SR_UTILS_NS {
         bool RegisterType(const std::string& name, uint64_t hashTypeName);
         bool RegisterReloader(IResourceReloader* pReloader, uint64_t hashTypeName);
 
-        void Remove(IResource *resource);
+        /// false - ресурс снова используется, освобождать его нельзя
+        bool Remove(IResource *resource);
         void GC();
+
+        ResourceHandle AllocateHandle(IResource* pResource);
+        void FreeHandle(IResource* pResource);
+
+        void PushToDestroy(IResource* pResource);
+        void EraseFromDestroy(IResource* pResource);
         void AsyncUpdateWatchers();
         void Thread();
 
     private:
-        ResourcesList m_destroyed;
+        /// порядок не важен, удаление за O(1) через IResource::m_destroyIndex
+        std::vector<DestroyEntry> m_destroyed;
+        /// позиция, с которой продолжится следующий проход GC
+        uint64_t m_destroyCursor = 0;
+
+        std::vector<ResourceSlot> m_slots;
+        std::vector<uint32_t> m_freeSlots;
+
         ResourcesTypes m_resources;
+        /// копия индекса из m_resources для поиска без блокировки менеджера
+        ResourceRegistry m_registry;
 
         ska::flat_hash_map<Hash, Path> m_hashPaths;
 
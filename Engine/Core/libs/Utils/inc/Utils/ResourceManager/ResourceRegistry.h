@@ -0,0 +1,48 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SRENGINE_RESOURCEREGISTRY_H
+#define SRENGINE_RESOURCEREGISTRY_H
+
+#include <Utils/Common/NonCopyable.h>
+#include <Utils/Types/Map.h>
+
+namespace SR_UTILS_NS {
+    class IResource;
+
+    /// Индекс зарегистрированных ресурсов по (тип, id), разбитый на шарды.
+    /// Изменяется только под блокировкой ResourceManager, а поиск живой копии ресурса
+    /// идет под shared-блокировкой одного шарда и не трогает общий мьютекс менеджера.
+    class SR_DLL_EXPORT ResourceRegistry : public NonCopyable {
+        static constexpr uint64_t ShardCount = 32;
+
+        struct alignas(64) Shard {
+            ska::flat_hash_map<uint64_t, std::vector<IResource*>> resources;
+            mutable std::shared_mutex mutex;
+        };
+
+    public:
+        void Add(IResource* pResource);
+        /// Удаляет ресурс, только если он все еще уничтожен и не используется. Проверка и удаление идут
+        /// под одной блокировкой шарда, поэтому FindAlive не может вернуть ресурс, который GC уже решил освободить
+        SR_NODISCARD bool RemoveUnused(IResource* pResource);
+        void Clear();
+
+        /// Вернет первую не уничтоженную копию ресурса и продлит ей время жизни, пока шард еще заблокирован.
+        /// Уничтоженные ресурсы не оживляет, для этого нужно идти в ResourceType::Find под блокировкой менеджера.
+        SR_NODISCARD IResource* FindAlive(uint64_t hashTypeName, uint64_t hashId) const;
+
+    private:
+        SR_NODISCARD static uint64_t MakeKey(uint64_t hashTypeName, uint64_t hashId) noexcept;
+
+        SR_NODISCARD Shard& GetShard(uint64_t key) noexcept { return m_shards[key % ShardCount]; }
+        SR_NODISCARD const Shard& GetShard(uint64_t key) const noexcept { return m_shards[key % ShardCount]; }
+
+    private:
+        std::array<Shard, ShardCount> m_shards;
+
+    };
+}
+
+#endif //SRENGINE_RESOURCEREGISTRY_H
@@ -0,0 +1,52 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SRENGINE_LOGICALCOMPILER_H
+#define SRENGINE_LOGICALCOMPILER_H
+
+#include <Utils/SRLM/LogicalProgram.h>
+#include <Utils/SRLM/LogicalNode.h>
+
+namespace SR_SRLM_NS {
+    /// Переводит провалидированный граф в линейный байткод для LogicalVM.
+    /// Поддерживается только часть нод, если в графе встречается что-то другое,
+    /// то компиляция не удается и граф должен исполняться интерпретатором LogicalMachine.
+    class LogicalCompiler : public SR_UTILS_NS::NonCopyable {
+        static constexpr uint32_t InvalidRegister = SR_UINT32_MAX;
+        using NodeOutput = std::pair<LogicalNode*, uint32_t>;
+    public:
+        SR_NODISCARD bool Compile(const std::vector<LogicalNode*>& entryPoints, LogicalProgram& program);
+
+        SR_NODISCARD const std::string& GetError() const noexcept { return m_error; }
+
+    private:
+        SR_NODISCARD bool CompileExecutable(LogicalNode* pNode);
+        SR_NODISCARD bool CompileFlow(LogicalNode* pNode, uint32_t outputIndex, LogicalOpCode opCode);
+
+        SR_NODISCARD uint32_t CompileInput(LogicalNode* pNode, uint32_t inputIndex);
+        SR_NODISCARD uint32_t CompileCompute(LogicalNode* pNode, uint32_t outputIndex);
+
+        SR_NODISCARD uint32_t AllocateRegister(DataTypeClass dataTypeClass);
+        SR_NODISCARD uint32_t AllocateConstant(const DataType* pData);
+
+        void Emit(std::vector<LogicalInstruction>& code, LogicalOpCode opCode, uint32_t a = 0, uint32_t b = 0, DataTypeClass cls = DataTypeClass::None);
+
+        bool Fail(const std::string& error);
+
+    private:
+        LogicalProgram* m_program = nullptr;
+
+        std::map<NodeOutput, uint32_t> m_computed;
+        std::unordered_map<LogicalNode*, uint32_t> m_blocks;
+        std::list<LogicalNode*> m_queue;
+
+        /// индекс инструкции -> нода, адрес которой нужно подставить после компиляции
+        std::vector<std::pair<uint32_t, LogicalNode*>> m_patches;
+
+        std::string m_error;
+
+    };
+}
+
+#endif //SRENGINE_LOGICALCOMPILER_H
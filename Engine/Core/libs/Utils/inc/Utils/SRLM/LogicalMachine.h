@@ -12,6 +12,7 @@
 #include <Utils/ResourceManager/FileWatcher.h>
 #include <Utils/ResourceManager/ResourceManager.h>
 #include <Utils/SRLM/LogicalNode.h>
+#include <Utils/SRLM/LogicalVM.h>
 #include <Utils/Xml.h>
 
 namespace SR_SRLM_NS {
@@ -33,12 +34,24 @@ namespace SR_SRLM_NS {
         bool Init();
         virtual void UpdateMachine(float_t dt);
 
+        /// false - граф всегда исполняется интерпретатором, даже если он скомпилирован
+        void SetUseBytecode(bool enabled) { m_useBytecode = enabled; }
+
+        SR_NODISCARD bool IsCompiled() const noexcept { return m_vm.IsValid(); }
+        SR_NODISCARD bool IsBytecodeActive() const noexcept { return m_useBytecode && m_vm.IsValid(); }
+
+        /// Сборка графа без файла, Load использует те же методы. Машина становится владельцем нод
+        void AddNode(LogicalNode* pNode);
+        void Link(LogicalNode* pStartNode, uint32_t startPinIndex, LogicalNode* pEndNode, uint32_t endPinIndex);
+        /// Убирает коннекторы и компилирует граф, вызывается после добавления всех нод и связей
+        void Build();
+
     private:
         SR_NODISCARD IResource* CopyResource(SR_UTILS_NS::IResource* pDestination) const override;
 
         bool Execute(float_t dt);
-        void AddNode(LogicalNode* pNode);
         void Optimize();
+        void Compile();
         bool ProcessExecutable(float_t dt);
         bool ProcessReset(float_t dt);
 
@@ -66,6 +79,9 @@ namespace SR_SRLM_NS {
 
         std::map<std::string, LogicalNode*> m_entryPoints;
 
+        LogicalVM m_vm;
+        bool m_useBytecode = true;
+
     };
 
     template<class T> LogicalMachine* LogicalMachine::Load(const Path& rawPath) {
@@ -0,0 +1,66 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SRENGINE_LOGICALPROGRAM_H
+#define SRENGINE_LOGICALPROGRAM_H
+
+#include <Utils/SRLM/DataType.h>
+
+namespace SR_SRLM_NS {
+    SR_ENUM_NS_CLASS_T(LogicalOpCode, uint8_t,
+        Halt,           /// завершить текущий поток
+        Jump,           /// a - адрес
+        JumpIfFalse,    /// a - bool регистр, b - адрес
+        Spawn,          /// a - адрес нового потока, выполнится после текущего
+        Copy,           /// a - регистр назначения, b - регистр источника
+        CopyString,     /// a - строковый регистр назначения, b - строковый регистр источника
+        ToString,       /// a - строковый регистр назначения, b - регистр источника, cls - класс источника
+        Print           /// a - строковый регистр, b - регистр с DebugLogType
+    );
+
+    /// Регистры не упакованы в DataType, их тип известен на этапе компиляции.
+    /// Строки хранятся отдельно, в регистре лежит индекс строки.
+    union LogicalRegister {
+        bool b;
+        int64_t i;
+        uint64_t u;
+        float_t f;
+        double_t d;
+    };
+
+    struct LogicalInstruction {
+        LogicalOpCode opCode = LogicalOpCode::Halt;
+        DataTypeClass cls = DataTypeClass::None;
+        uint32_t a = 0;
+        uint32_t b = 0;
+    };
+
+    /// Результат компиляции графа LogicalMachine.
+    /// prologue выполняется один раз при инициализации и считает все compute-ноды,
+    /// code содержит блоки исполняемых нод, по адресу 0 всегда лежит Halt.
+    struct LogicalProgram {
+        SR_NODISCARD bool IsEmpty() const noexcept { return code.empty(); }
+
+        void Clear() {
+            prologue.clear();
+            code.clear();
+            entryPoints.clear();
+            registers.clear();
+            registerClasses.clear();
+            strings.clear();
+        }
+
+        std::vector<LogicalInstruction> prologue;
+        std::vector<LogicalInstruction> code;
+        std::vector<uint32_t> entryPoints;
+
+        /// начальные значения регистров
+        std::vector<LogicalRegister> registers;
+        std::vector<DataTypeClass> registerClasses;
+        std::vector<std::string> strings;
+
+    };
+}
+
+#endif //SRENGINE_LOGICALPROGRAM_H
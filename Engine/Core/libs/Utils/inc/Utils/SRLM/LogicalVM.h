@@ -0,0 +1,44 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SRENGINE_LOGICALVM_H
+#define SRENGINE_LOGICALVM_H
+
+#include <Utils/SRLM/LogicalProgram.h>
+
+namespace SR_SRLM_NS {
+    /// Регистровая машина для LogicalProgram.
+    /// Повторяет порядок исполнения интерпретатора LogicalMachine для поддерживаемых нод.
+    class LogicalVM : public SR_UTILS_NS::NonCopyable {
+    public:
+        void SetProgram(LogicalProgram&& program);
+        void Clear();
+
+        /// Сбрасывает регистры, выполняет пролог и ставит в очередь точки входа
+        void Init();
+        void Execute(float_t dt);
+
+        SR_NODISCARD bool IsValid() const noexcept { return !m_program.IsEmpty(); }
+        SR_NODISCARD bool HasActiveThreads() const noexcept { return !m_threads.empty(); }
+        SR_NODISCARD const LogicalProgram& GetProgram() const noexcept { return m_program; }
+        SR_NODISCARD const std::vector<LogicalRegister>& GetRegisters() const noexcept { return m_registers; }
+        SR_NODISCARD const std::vector<std::string>& GetStrings() const noexcept { return m_strings; }
+
+    private:
+        void Run(const std::vector<LogicalInstruction>& code, uint32_t address);
+        SR_NODISCARD std::string ToString(const LogicalRegister& value, DataTypeClass dataTypeClass) const;
+
+    private:
+        LogicalProgram m_program;
+
+        std::vector<LogicalRegister> m_registers;
+        std::vector<std::string> m_strings;
+
+        /// адреса потоков, следующий к исполнению лежит на вершине
+        std::vector<uint32_t> m_threads;
+
+    };
+}
+
+#endif //SRENGINE_LOGICALVM_H
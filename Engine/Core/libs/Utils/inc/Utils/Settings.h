@@ -5,7 +5,7 @@
 #ifndef SRENGINE_SETTINGS_H
 #define SRENGINE_SETTINGS_H
 
-#include <Utils/Xml.h>
+#include <Utils/CompiledConfig.h>
 #include <Utils/ResourceManager/IResource.h>
 #include <Utils/ResourceManager/ResourceManager.h>
 #include <Utils/Common/Singleton.h>
@@ -41,11 +41,14 @@ namespace SR_UTILS_NS {
     protected:
         virtual void ClearSettings() { }
         virtual bool LoadSettings(const Xml::Node& node) { return true; }
+        /// По схеме конфиг проверяется при компиляции в кеш
+        SR_NODISCARD virtual SR_XML_NS::ConfigSchema GetConfigSchema() const { return { "Settings" }; }
 
         bool Reload() final;
 
     protected:
         SR_NODISCARD Path GetAssociatedPath() const override;
+        /// При включенной CompiledConfigsCache документ читается из скомпилированного кеша и доступен только для чтения
         SR_NODISCARD SR_XML_NS::Document LoadDocument() const;
 
     protected:
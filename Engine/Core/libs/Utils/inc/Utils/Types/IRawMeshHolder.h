@@ -7,6 +7,10 @@
 
 #include <Utils/stdInclude.h>
 
+namespace SR_UTILS_NS {
+    class BakedMesh;
+}
+
 namespace SR_HTYPES_NS {
     class RawMesh;
 
@@ -25,6 +29,8 @@ namespace SR_HTYPES_NS {
         SR_NODISCARD std::string GetMeshStringPath() const noexcept;
         SR_NODISCARD bool IsValidMeshId() const noexcept;
         SR_NODISCARD std::vector<SR_UTILS_NS::Vertex> GetVertices() const noexcept;
+        /// Запеченная модель, если она загружена, иначе nullptr
+        SR_NODISCARD const SR_UTILS_NS::BakedMesh* GetBakedMesh() const noexcept;
 
         virtual void OnRawMeshChanged() { }
 
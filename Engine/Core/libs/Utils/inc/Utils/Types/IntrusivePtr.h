@@ -0,0 +1,115 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SRENGINE_INTRUSIVEPTR_H
+#define SRENGINE_INTRUSIVEPTR_H
+
+#include <Utils/Debug.h>
+
+namespace SR_HTYPES_NS {
+    /// Атомарный счетчик ссылок внутри самого объекта, блок управления не выделяется
+    class SR_DLL_EXPORT IntrusiveRefCounter : public SR_UTILS_NS::NonCopyable {
+    protected:
+        IntrusiveRefCounter() = default;
+        ~IntrusiveRefCounter() override = default;
+
+    public:
+        SR_FORCE_INLINE void AddRef() const noexcept {
+            m_refCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        /// Вернет true, если была освобождена последняя ссылка
+        SR_FORCE_INLINE bool Release() const noexcept {
+            return m_refCount.fetch_sub(1, std::memory_order_acq_rel) == 1;
+        }
+
+        SR_NODISCARD uint32_t GetRefCount() const noexcept { return m_refCount.load(std::memory_order_acquire); }
+
+    private:
+        mutable std::atomic<uint32_t> m_refCount = 0;
+
+    };
+
+    template<class T> class IntrusivePtr {
+    public:
+        IntrusivePtr() = default;
+
+        IntrusivePtr(T* ptr) /** NOLINT */
+            : m_ptr(ptr)
+        {
+            if (m_ptr) {
+                m_ptr->AddRef();
+            }
+        }
+
+        IntrusivePtr(const IntrusivePtr& ptr)
+            : IntrusivePtr(ptr.m_ptr)
+        { }
+
+        IntrusivePtr(IntrusivePtr&& ptr) noexcept
+            : m_ptr(SR_UTILS_NS::Exchange(ptr.m_ptr, nullptr))
+        { }
+
+        ~IntrusivePtr() {
+            Reset();
+        }
+
+    public:
+        template<typename... Args> SR_NODISCARD static IntrusivePtr<T> MakeShared(Args&&... args) {
+            return IntrusivePtr<T>(new T(std::forward<Args>(args)...));
+        }
+
+        IntrusivePtr<T>& operator=(const IntrusivePtr<T>& ptr) {
+            if (m_ptr != ptr.m_ptr) {
+                IntrusivePtr<T>(ptr).Swap(*this);
+            }
+            return *this;
+        }
+
+        IntrusivePtr<T>& operator=(IntrusivePtr<T>&& ptr) noexcept {
+            IntrusivePtr<T>(std::move(ptr)).Swap(*this);
+            return *this;
+        }
+
+        IntrusivePtr<T>& operator=(T* ptr) {
+            if (m_ptr != ptr) {
+                IntrusivePtr<T>(ptr).Swap(*this);
+            }
+            return *this;
+        }
+
+        SR_NODISCARD SR_FORCE_INLINE operator bool() const noexcept { return m_ptr; } /** NOLINT */
+        SR_NODISCARD SR_FORCE_INLINE T& operator*() const noexcept { return *m_ptr; }
+        SR_NODISCARD SR_FORCE_INLINE T* operator->() const noexcept { return m_ptr; }
+        SR_NODISCARD SR_INLINE bool operator==(const IntrusivePtr<T>& right) const noexcept { return m_ptr == right.m_ptr; }
+        SR_NODISCARD SR_INLINE bool operator!=(const IntrusivePtr<T>& right) const noexcept { return m_ptr != right.m_ptr; }
+
+        SR_NODISCARD SR_FORCE_INLINE T* Get() const noexcept { return m_ptr; }
+        SR_NODISCARD SR_FORCE_INLINE bool Valid() const noexcept { return m_ptr; }
+
+        void Swap(IntrusivePtr<T>& ptr) noexcept {
+            std::swap(m_ptr, ptr.m_ptr);
+        }
+
+        void Reset() {
+            if (T* pPtr = SR_UTILS_NS::Exchange(m_ptr, nullptr); pPtr && pPtr->Release()) {
+                delete pPtr;
+            }
+        }
+
+    private:
+        T* m_ptr = nullptr;
+
+    };
+}
+
+namespace std {
+    template<typename T> struct hash<SR_HTYPES_NS::IntrusivePtr<T>> {
+        size_t operator()(SR_HTYPES_NS::IntrusivePtr<T> const& ptr) const {
+            return std::hash<void*>()((void*)ptr.Get());
+        }
+    };
+}
+
+#endif //SRENGINE_INTRUSIVEPTR_H
@@ -10,14 +10,15 @@
 #include <Utils/Types/Map.h>
 #include <Utils/Common/Vertices.h>
 #include <Utils/Math/Matrix4x4.h>
+#include <Utils/FileSystem/BakedMesh.h>
 
 namespace Assimp {
     class Importer;
 }
 
 class aiScene;
-class aiAnimation;
 class aiMesh;
+class aiNode;
 
 namespace SR_WORLD_NS {
     class Scene;
@@ -34,6 +35,7 @@ namespace SR_HTYPES_NS {
     };
 
     class SR_DLL_EXPORT RawMesh : public IResource {
+        SR_MEMORY_TAG(SR_UTILS_NS::MemoryTag::Mesh)
         using ScenePtr = SR_HTYPES_NS::SafePtr<SR_WORLD_NS::Scene>;
         using Ptr = RawMesh*;
         using Hash = uint64_t;
@@ -61,6 +63,8 @@ namespace SR_HTYPES_NS {
 
         SR_NODISCARD uint32_t GetVerticesCount(uint32_t id) const;
         SR_NODISCARD uint32_t GetIndicesCount(uint32_t id) const;
+        /// Радиус сферы вокруг начала координат меша, содержащей все его вершины
+        SR_NODISCARD float_t GetBoundingRadius(uint32_t id) const;
         SR_NODISCARD uint32_t GetAnimationsCount() const;
         SR_UTILS_NS::Path InitializeResourcePath() const override;
         SR_NODISCARD int32_t GetMeshId(SR_UTILS_NS::StringAtom name) const;
@@ -70,24 +74,32 @@ namespace SR_HTYPES_NS {
 
         SR_NODISCARD bool IsAllowedToRevive() const override { return true; }
 
-        SR_NODISCARD const aiScene* GetAssimpScene() const noexcept { return m_scene; }
+        /// Сцена assimp освобождается после загрузки, движок читает узлы, кости и анимации из GetBakedMesh.
+        /// Для инструментов, которым нужна именно сцена, она читается заново под блокировкой и живет до выгрузки
+        SR_NODISCARD const aiScene* GetAssimpScene();
+        SR_NODISCARD const SR_UTILS_NS::BakedMesh* GetBakedMesh() const noexcept { return m_baked.Valid() ? &m_baked : nullptr; }
 
     protected:
         bool Unload() override;
         bool Load() override;
 
     private:
+        bool ReadScene();
+        void FreeScene();
+        SR_NODISCARD SR_UTILS_NS::Path GetCacheBasePath() const;
+
+        SR_NODISCARD SR_UTILS_NS::BakedMesh Bake(uint64_t sourceHash) const;
+        void BakeNode(SR_UTILS_NS::BakedMeshBuilder& builder, const aiNode* pNode, int32_t parent) const;
+        void LoadBakedSkeleton();
+
         void NormalizeWeights();
         void CalculateBones();
         void OptimizeSkeleton();
         void CalculateOffsets();
-        void CalculateAnimations();
 
         uint32_t NormalizeWeights(const aiMesh* pMesh);
 
     private:
-        ska::flat_hash_map<Hash, aiAnimation*> m_animations;
-
         std::vector<ska::flat_hash_map<Hash, uint32_t>> m_bones;
         ska::flat_hash_map<Hash, uint16_t> m_optimizedBones;
 
@@ -96,6 +108,9 @@ namespace SR_HTYPES_NS {
 
         RawMeshParams m_params;
 
+        SR_UTILS_NS::BakedMesh m_baked;
+
+        std::mutex m_sceneMutex;
         const aiScene* m_scene = nullptr;
         bool m_fromCache = false;
         Assimp::Importer* m_importer = nullptr;
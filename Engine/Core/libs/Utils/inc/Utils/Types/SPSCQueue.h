@@ -0,0 +1,102 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SRENGINE_SPSCQUEUE_H
+#define SRENGINE_SPSCQUEUE_H
+
+#include <Utils/Debug.h>
+#include <Utils/Common/NonCopyable.h>
+
+#include <bit>
+
+namespace SR_HTYPES_NS {
+    /**
+     * Кольцевая очередь без блокировок для одного писателя и одного читателя.
+     * Push вызывается только с потока-писателя, Pop и Flush - только с потока-читателя.
+     * Емкость фиксирована и округляется до степени двойки, переполненная очередь отбрасывает новые элементы.
+     */
+    template<typename T> class SPSCQueue : public SR_UTILS_NS::NonCopyable {
+        static constexpr uint64_t CACHE_LINE = 64;
+    public:
+        explicit SPSCQueue(uint64_t capacity)
+            : m_data(std::bit_ceil(std::max<uint64_t>(capacity, 2)))
+            , m_mask(m_data.size() - 1)
+        { }
+
+        ~SPSCQueue() override = default;
+
+    public:
+        /// false, если очередь заполнена
+        bool Push(const T& value) noexcept {
+            const uint64_t tail = m_tail.load(std::memory_order_relaxed);
+
+            if (tail - m_cachedHead == m_data.size()) {
+                m_cachedHead = m_head.load(std::memory_order_acquire);
+                if (tail - m_cachedHead == m_data.size()) {
+                    m_dropped.fetch_add(1, std::memory_order_relaxed);
+                    return false;
+                }
+            }
+
+            m_data[tail & m_mask] = value;
+            m_tail.store(tail + 1, std::memory_order_release);
+
+            return true;
+        }
+
+        bool Pop(T& value) noexcept {
+            const uint64_t head = m_head.load(std::memory_order_relaxed);
+
+            if (head == m_cachedTail) {
+                m_cachedTail = m_tail.load(std::memory_order_acquire);
+                if (head == m_cachedTail) {
+                    return false;
+                }
+            }
+
+            value = m_data[head & m_mask];
+            m_head.store(head + 1, std::memory_order_release);
+
+            return true;
+        }
+
+        /// Забирает все, что было записано к моменту вызова
+        template<typename Callback> uint64_t Flush(Callback&& callback) {
+            const uint64_t head = m_head.load(std::memory_order_relaxed);
+            const uint64_t tail = m_tail.load(std::memory_order_acquire);
+
+            for (uint64_t i = head; i != tail; ++i) {
+                callback(m_data[i & m_mask]);
+            }
+
+            m_cachedTail = tail;
+            m_head.store(tail, std::memory_order_release);
+
+            return tail - head;
+        }
+
+        SR_NODISCARD uint64_t Capacity() const noexcept { return m_data.size(); }
+        /// Приблизительный размер, точен только на потоке-читателе при остановленном писателе
+        SR_NODISCARD uint64_t Size() const noexcept { return m_tail.load(std::memory_order_acquire) - m_head.load(std::memory_order_acquire); }
+        SR_NODISCARD bool Empty() const noexcept { return Size() == 0; }
+        /// Число элементов, отброшенных из-за переполнения
+        SR_NODISCARD uint64_t GetDroppedCount() const noexcept { return m_dropped.load(std::memory_order_relaxed); }
+
+    private:
+        std::vector<T> m_data;
+        const uint64_t m_mask;
+
+        /// индексы писателя и читателя на разных кеш-линиях, чтобы потоки не мешали друг другу
+        alignas(CACHE_LINE) std::atomic<uint64_t> m_tail = 0;
+        uint64_t m_cachedHead = 0;
+
+        alignas(CACHE_LINE) std::atomic<uint64_t> m_head = 0;
+        uint64_t m_cachedTail = 0;
+
+        alignas(CACHE_LINE) std::atomic<uint64_t> m_dropped = 0;
+
+    };
+}
+
+#endif //SRENGINE_SPSCQUEUE_H
@@ -14,29 +14,114 @@ namespace SR_UTILS_NS {
     enum class SharedPtrPolicy : uint8_t {
         Automatic, Manually
     };
+
+    /// Plain - обычные счетчики, указатель живет в одном потоке.
+    /// Atomic - счетчики меняются атомарно, указатель можно копировать и освобождать из разных потоков.
+    enum class SharedPtrCounting : uint8_t {
+        Plain, Atomic
+    };
 }
 
 namespace SR_HTYPES_NS {
+    /// Пул блоков управления SharedPtr, чтобы не ходить в кучу на каждый объект.
+    /// У каждого потока есть небольшой локальный кэш, с общим списком он обменивается пачками.
+    class SR_DLL_EXPORT SharedPtrDataPool : public SR_UTILS_NS::NonCopyable {
+        struct ThreadCache;
+    public:
+        static constexpr uint64_t BlockSize = 16;
+        static constexpr uint64_t ChunkBlocks = 1024;
+        static constexpr uint64_t CacheBatch = 64;
+
+    private:
+        SharedPtrDataPool() = default;
+        ~SharedPtrDataPool() override = default;
+
+    public:
+        /// Пул никогда не уничтожается, блоки могут освобождаться при разрушении статических объектов
+        static SharedPtrDataPool& Instance();
+
+        SR_NODISCARD void* Allocate();
+        void Free(void* pBlock) noexcept;
+
+    private:
+        union Block {
+            Block* pNext;
+            alignas(std::max_align_t) uint8_t data[BlockSize];
+        };
+
+        SR_NODISCARD static ThreadCache& GetThreadCache();
+
+        void Pull(ThreadCache& cache);
+        void Push(ThreadCache& cache, uint64_t count) noexcept;
+
+    private:
+        std::mutex m_mutex;
+        Block* m_free = nullptr;
+
+    };
+
     struct SharedPtrDynamicData {
-        SharedPtrDynamicData(uint16_t strongCount, uint16_t weakCount, bool valid, SharedPtrPolicy policy)
+        SharedPtrDynamicData(uint16_t strongCount, uint16_t weakCount, bool valid, SharedPtrPolicy policy, SharedPtrCounting counting = SharedPtrCounting::Plain)
             : strongCount(strongCount)
             , weakCount(weakCount)
             , valid(valid)
             , policy(policy)
+            , counting(counting)
         { }
 
-        uint16_t strongCount = 0;
+        static void* operator new(std::size_t size) {
+            SRAssert(size <= SharedPtrDataPool::BlockSize);
+            return SharedPtrDataPool::Instance().Allocate();
+        }
+
+        static void operator delete(void* pBlock) noexcept {
+            SharedPtrDataPool::Instance().Free(pBlock);
+        }
+
+        SR_FORCE_INLINE void IncrementStrong() noexcept {
+            if (counting == SharedPtrCounting::Atomic) {
+                std::atomic_ref<uint16_t>(strongCount).fetch_add(1, std::memory_order_relaxed);
+            }
+            else {
+                ++strongCount;
+            }
+        }
+
+        /// Возвращает значение счетчика до уменьшения
+        SR_FORCE_INLINE uint16_t DecrementStrong() noexcept {
+            if (counting == SharedPtrCounting::Atomic) {
+                return std::atomic_ref<uint16_t>(strongCount).fetch_sub(1, std::memory_order_acq_rel);
+            }
+
+            if (strongCount == 0) {
+                return 0;
+            }
+
+            return strongCount--;
+        }
+
+        SR_NODISCARD SR_FORCE_INLINE uint16_t GetStrongCount() noexcept {
+            if (counting == SharedPtrCounting::Atomic) {
+                return std::atomic_ref<uint16_t>(strongCount).load(std::memory_order_acquire);
+            }
+            return strongCount;
+        }
+
+        alignas(std::atomic_ref<uint16_t>::required_alignment) uint16_t strongCount = 0;
         uint16_t weakCount = 0;
         bool valid = false;
         SharedPtrPolicy policy = SharedPtrPolicy::Automatic;
+        SharedPtrCounting counting = SharedPtrCounting::Plain;
 
     };
 
+    static_assert(sizeof(SharedPtrDynamicData) <= SharedPtrDataPool::BlockSize);
+
     template<class T> class SR_DLL_EXPORT SharedPtr {
     public:
         SharedPtr() = default;
         SharedPtr(const T* constPtr); /** NOLINT */
-        SharedPtr(const T* constPtr, SharedPtrPolicy policy); /** NOLINT */
+        SharedPtr(const T* constPtr, SharedPtrPolicy policy, SharedPtrCounting counting = SharedPtrCounting::Plain); /** NOLINT */
         SharedPtr(SharedPtr const &ptr);
         SharedPtr(SharedPtr&& ptr) noexcept
             : m_data(SR_UTILS_NS::Exchange(ptr.m_data, { }))
@@ -55,14 +140,14 @@ namespace SR_HTYPES_NS {
         SharedPtr<T>& operator=(T *ptr);
         SharedPtr<T>& operator=(SharedPtr<T>&& ptr) noexcept {
             if (m_data) {
-                SRAssert(m_data->strongCount > 0);
-                --m_data->strongCount;
+                SRAssert(m_data->GetStrongCount() > 0);
+                m_data->DecrementStrong();
             }
 
             m_data = SR_UTILS_NS::Exchange(ptr.m_data, {});
 
             if (m_data) {
-                ++m_data->strongCount;
+                m_data->IncrementStrong();
             }
 
             m_ptr = SR_UTILS_NS::Exchange(ptr.m_ptr, {});
@@ -118,13 +203,13 @@ namespace SR_HTYPES_NS {
         : SharedPtr(constPtr, SharedPtrPolicy::Automatic)
     { }
 
-    template<class T> SharedPtr<T>::SharedPtr(const T* constPtr, SharedPtrPolicy policy) {
+    template<class T> SharedPtr<T>::SharedPtr(const T* constPtr, SharedPtrPolicy policy, SharedPtrCounting counting) {
         T* ptr = const_cast<T*>(constPtr);
         bool needAlloc = true;
 
         if constexpr (IsDerivedFrom<SharedPtr, T>::value) {
             if (ptr && (m_data = ptr->GetPtrData())) {
-                ++(m_data->strongCount);
+                m_data->IncrementStrong();
                 needAlloc = false;
                 m_ptr = ptr;
             }
@@ -135,7 +220,8 @@ namespace SR_HTYPES_NS {
                 1,                   /// strong
                 0,                   /// weak
                 (bool)(m_ptr = ptr), /// valid
-                policy               /// policy
+                policy,              /// policy
+                counting             /// counting
             );
         }
     }
@@ -143,7 +229,7 @@ namespace SR_HTYPES_NS {
     template<class T> SharedPtr<T>::SharedPtr(const SharedPtr &ptr) {
         m_ptr = ptr.m_ptr;
         if ((m_data = ptr.m_data)) {
-            ++(m_data->strongCount);
+            m_data->IncrementStrong();
         }
     }
 
@@ -158,7 +244,7 @@ namespace SR_HTYPES_NS {
 
         if ((m_data = ptr.m_data)) {
             m_data->valid = bool(m_ptr);
-            ++(m_data->strongCount);
+            m_data->IncrementStrong();
         }
 
         return *this;
@@ -172,7 +258,7 @@ namespace SR_HTYPES_NS {
 
             if constexpr (IsDerivedFrom<SharedPtr, T>::value) {
                 if (ptr && (m_data = ptr->GetPtrData())) {
-                    ++(m_data->strongCount);
+                    m_data->IncrementStrong();
                     needAlloc = false;
                     m_ptr = ptr;
                 }
@@ -248,7 +334,8 @@ namespace SR_HTYPES_NS {
             return;
         }
 
-        if (pData->strongCount <= 1) {
+        /// для атомарных счетчиков проверка и уменьшение должны быть одной операцией
+        if (pData->DecrementStrong() <= 1) {
             if (pData->policy == SharedPtrPolicy::Manually) {
                 SR_SAFE_PTR_ASSERT(!pData->valid, "Ptr was not freed!");
                 delete pData;
@@ -263,9 +350,6 @@ namespace SR_HTYPES_NS {
                 delete pData;
             }
         }
-        else {
-            --(pData->strongCount);
-        }
     }
 }
 
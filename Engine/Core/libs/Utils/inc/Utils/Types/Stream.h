@@ -53,6 +53,9 @@ namespace SR_HTYPES_NS {
 
         void Skip(uint64_t count);
 
+        /// Заменяет count байт с offset на size байт из pSrc, хвост сдвигается на месте
+        void Replace(uint64_t offset, uint64_t count, const void* pSrc, uint64_t size);
+
     private:
         static char* Allocate(uint64_t size);
         static void Free(char* pData);
@@ -6,6 +6,7 @@
 #define SRENGINE_SCENE_H
 
 #include <Utils/ECS/IComponentable.h>
+#include <Utils/ECS/GameObjectPool.h>
 #include <Utils/Types/SafePointer.h>
 #include <Utils/Types/SharedPtr.h>
 #include <Utils/World/Observer.h>
@@ -14,9 +15,12 @@
 #include <Utils/World/CameraData.h>
 #include <Utils/Types/DataStorage.h>
 #include <Utils/World/TensorKey.h>
+#include <Utils/World/SceneIndex.h>
+#include <Utils/Profile/MemoryTracker.h>
 
 namespace SR_UTILS_NS {
     class GameObject;
+    class Component;
 }
 
 namespace SR_HTYPES_NS {
@@ -28,12 +32,14 @@ namespace SR_WORLD_NS {
     class SceneUpdater;
 
     class SR_DLL_EXPORT Scene : public SR_HTYPES_NS::SafePtr<Scene>, public SR_UTILS_NS::IComponentable {
+        SR_MEMORY_TAG(SR_UTILS_NS::MemoryTag::Scene)
     public:
         using Ptr = SR_HTYPES_NS::SafePtr<Scene>;
         using SceneLogicPtr = SR_HTYPES_NS::SafePtr<SceneLogic>;
         using Super = Ptr;
         using GameObjectPtr = SR_HTYPES_NS::SharedPtr<GameObject>;
         using GameObjects = std::vector<GameObjectPtr>;
+        using GameObjectRange = SceneIndexRange<GameObjectPtr>;
 
         SR_MAYBE_UNUSED SR_INLINE_STATIC const Path RuntimeScenePath = "Scenes/Runtime-cache-scene"; /// NOLINT
         SR_MAYBE_UNUSED SR_INLINE_STATIC const Path NewScenePath = "Scenes/New-cache-scene"; /// NOLINT
@@ -65,6 +71,7 @@ namespace SR_WORLD_NS {
         SR_NODISCARD bool IsPrefab() const;
         SR_NODISCARD SR_HTYPES_NS::DataStorage& GetDataStorage() { return m_dataStorage; }
         SR_NODISCARD const SR_HTYPES_NS::DataStorage& GetDataStorage() const { return m_dataStorage; }
+        SR_NODISCARD GameObjectPool& GetGameObjectPool() { return m_gameObjectPool; }
         SR_NODISCARD SR_INLINE SceneUpdater* GetSceneUpdater() const { return m_sceneUpdater; }
         SR_NODISCARD SR_INLINE SceneLogicPtr GetLogicBase() const { return m_logic; }
 
@@ -75,11 +82,24 @@ namespace SR_WORLD_NS {
 
         GameObjects& GetRootGameObjects();
 
+        /// Хеш иерархии, активности и трансформаций всех объектов, для сравнения состояния между запусками
+        SR_NODISCARD uint64_t CalculateChecksum();
+
         GameObjectPtr FindByComponent(const std::string& name);
+        GameObjectPtr FindByComponent(uint64_t componentHashName);
+        GameObjectPtr FindByTag(uint64_t tag);
         GameObjectPtr Find(const std::string& name);
         GameObjectPtr Find(uint64_t hashName);
 
+        /// Все объекты с заданным ключом. Диапазоны действительны до следующего изменения сцены,
+        /// порядок объектов в них не определен.
+        SR_NODISCARD GameObjectRange FindAll(uint64_t hashName) const;
+        SR_NODISCARD GameObjectRange FindAllByTag(uint64_t tag) const;
+        SR_NODISCARD GameObjectRange FindAllByComponent(uint64_t componentHashName) const;
+
         void RegisterGameObject(const GameObjectPtr& ptr);
+        /// Регистрирует готовую иерархию одной пачкой, дети не обходятся - они уже должны быть в списке
+        void RegisterGameObjects(const GameObjects& gameObjects);
 
         virtual GameObjectPtr InstanceFromFile(const std::string& path);
         virtual GameObjectPtr FindOrInstance(const std::string& name);
@@ -95,8 +115,20 @@ namespace SR_WORLD_NS {
 
         void OnChanged();
 
+        /// Поддержание индексов, вызываются из GameObject
+        void OnGameObjectNameChanged(const GameObject* pGameObject, uint64_t oldHashName);
+        void OnGameObjectTagChanged(const GameObject* pGameObject, uint64_t oldTag);
+        void OnGameObjectComponentAttached(const GameObject* pGameObject, const Component* pComponent);
+        void OnGameObjectComponentDetached(const GameObject* pGameObject, const Component* pComponent);
+
         bool Reload();
 
+    private:
+        SR_NODISCARD bool IsIndexed(const GameObject* pGameObject) const;
+
+        void AddToIndices(const GameObjectPtr& gameObject);
+        void RemoveFromIndices(const GameObjectPtr& gameObject);
+
     private:
         SceneLogicPtr m_logic;
         SceneUpdater* m_sceneUpdater = nullptr;
@@ -108,6 +140,8 @@ namespace SR_WORLD_NS {
 
         SR_HTYPES_NS::DataStorage m_dataStorage;
 
+        GameObjectPool m_gameObjectPool;
+
         std::list<uint64_t> m_freeObjIndices;
         std::list<GameObjectPtr> m_newQueue;
         std::list<GameObjectPtr> m_deleteQueue;
@@ -117,6 +151,10 @@ namespace SR_WORLD_NS {
         GameObjects m_gameObjects;
         GameObjects m_rootObjects;
 
+        SceneIndex m_nameIndex;
+        SceneIndex m_tagIndex;
+        SceneIndex m_componentIndex;
+
         Path m_path;
         Path m_absPath;
 
@@ -0,0 +1,99 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SRENGINE_SCENEINDEX_H
+#define SRENGINE_SCENEINDEX_H
+
+#include <Utils/Common/NonCopyable.h>
+
+namespace SR_WORLD_NS {
+    /// Вторичный индекс сцены: ключ (хеш имени, тег, хеш компонента) -> идентификаторы объектов в сцене.
+    /// Добавление и удаление за O(1), один и тот же идентификатор может быть добавлен несколько раз,
+    /// тогда он удаляется из индекса только после такого же количества удалений.
+    class SR_DLL_EXPORT SceneIndex : public SR_UTILS_NS::NonCopyable {
+    public:
+        using Key = uint64_t;
+        using Id = uint64_t;
+        using Ids = std::vector<Id>;
+
+    private:
+        struct Entry {
+            uint32_t position = 0;
+            uint32_t count = 0;
+        };
+
+        struct Bucket {
+            Ids ids;
+            std::unordered_map<Id, Entry> entries;
+        };
+
+    public:
+        void Add(Key key, Id id);
+        void Remove(Key key, Id id);
+        void Clear();
+
+        SR_NODISCARD const Ids& Get(Key key) const;
+        SR_NODISCARD bool Contains(Key key, Id id) const;
+
+    private:
+        std::unordered_map<Key, Bucket> m_buckets;
+
+    };
+
+    /// Диапазон объектов сцены по списку идентификаторов из SceneIndex.
+    /// Действителен до следующего изменения сцены.
+    template<typename T> class SceneIndexRange {
+        using Objects = std::vector<T>;
+        using Ids = SceneIndex::Ids;
+    public:
+        class Iterator {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const T*;
+            using reference = const T&;
+
+        public:
+            Iterator(const Objects* pObjects, Ids::const_iterator id)
+                : m_objects(pObjects)
+                , m_id(id)
+            { }
+
+            SR_NODISCARD reference operator*() const { return (*m_objects)[*m_id]; }
+            SR_NODISCARD pointer operator->() const { return &(*m_objects)[*m_id]; }
+
+            Iterator& operator++() { ++m_id; return *this; }
+            Iterator operator++(int) { Iterator copy = *this; ++m_id; return copy; } /// NOLINT
+
+            SR_NODISCARD bool operator==(const Iterator& other) const { return m_id == other.m_id; }
+            SR_NODISCARD bool operator!=(const Iterator& other) const { return m_id != other.m_id; }
+
+        private:
+            const Objects* m_objects = nullptr;
+            Ids::const_iterator m_id;
+
+        };
+
+    public:
+        SceneIndexRange(const Objects& objects, const Ids& ids)
+            : m_objects(&objects)
+            , m_ids(&ids)
+        { }
+
+        SR_NODISCARD Iterator begin() const { return Iterator(m_objects, m_ids->begin()); }
+        SR_NODISCARD Iterator end() const { return Iterator(m_objects, m_ids->end()); }
+
+        SR_NODISCARD uint64_t Size() const noexcept { return m_ids->size(); }
+        SR_NODISCARD bool Empty() const noexcept { return m_ids->empty(); }
+        SR_NODISCARD T Front() const { return Empty() ? T() : (*m_objects)[m_ids->front()]; }
+
+    private:
+        const Objects* m_objects = nullptr;
+        const Ids* m_ids = nullptr;
+
+    };
+}
+
+#endif //SRENGINE_SCENEINDEX_H
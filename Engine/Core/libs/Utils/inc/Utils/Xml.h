@@ -20,10 +20,14 @@ namespace SR_UTILS_NS::Xml {
 
     class Attribute;
     class Document;
+    class CompiledConfig;
+    struct CompiledAttribute;
 
     static int32_t g_xml_last_error = 0;
 
     class SR_DLL_EXPORT Attribute {
+        friend class Node;
+        friend class CompiledConfig;
     public:
         Attribute()
             : m_attribute()
@@ -35,9 +39,23 @@ namespace SR_UTILS_NS::Xml {
             m_valid = !m_attribute.empty();
         }
 
+    private:
+        Attribute(const CompiledConfig* pConfig, uint32_t id)
+            : m_attribute()
+            , m_valid(true)
+            , m_pConfig(pConfig)
+            , m_compiledId(id)
+        { }
+
+        SR_NODISCARD const CompiledAttribute& GetCompiled() const;
+        SR_NODISCARD const char* GetCompiledValue() const;
+
     private:
         pugi::xml_attribute m_attribute;
         bool m_valid;
+        /// атрибут скомпилированного конфига, значения уже преобразованы в числа
+        const CompiledConfig* m_pConfig = nullptr;
+        uint32_t m_compiledId = 0;
 
     private:
         SR_NODISCARD bool CheckError(const std::string &msg) const {
@@ -76,8 +94,13 @@ namespace SR_UTILS_NS::Xml {
         SR_NODISCARD bool ToBool(bool def) const;
     };
 
+    /**
+     * Узел документа pugixml или скомпилированного конфига (см. CompiledConfig).
+     * Узлы скомпилированного конфига только для чтения.
+     */
     class SR_DLL_EXPORT Node {
         friend class Document;
+        friend class CompiledConfig;
 
     public:
         Node();
@@ -87,6 +110,14 @@ namespace SR_UTILS_NS::Xml {
             m_valid = !m_node.empty();
         }
 
+    private:
+        Node(const CompiledConfig* pConfig, uint32_t id)
+            : m_node()
+            , m_valid(true)
+            , m_pConfig(pConfig)
+            , m_compiledId(id)
+        { }
+
     public:
         static Node Empty() {
             return Node();
@@ -109,7 +140,7 @@ namespace SR_UTILS_NS::Xml {
                 return {};
             }
 
-            return m_node.name();
+            return m_pConfig ? std::string(GetCompiledName()) : m_node.name();
         }
 
         SR_NODISCARD std::string_view NameView() const {
@@ -119,7 +150,7 @@ namespace SR_UTILS_NS::Xml {
                 return {};
             }
 
-            return m_node.name();
+            return m_pConfig ? GetCompiledName() : m_node.name();
         }
 
         SR_NODISCARD Document ToDocument() const;
@@ -130,11 +161,15 @@ namespace SR_UTILS_NS::Xml {
                 return Attribute();
             }
 
-            return Attribute(m_node.attribute(name.c_str()));
+            return m_pConfig ? FindCompiledAttribute(name) : Attribute(m_node.attribute(name.c_str()));
         }
 
         SR_NODISCARD Attribute TryGetAttribute(const std::string &name) const {
-            return m_valid ? Attribute(m_node.attribute(name.c_str())) : Attribute();
+            if (!m_valid) {
+                return Attribute();
+            }
+
+            return m_pConfig ? FindCompiledAttribute(name) : Attribute(m_node.attribute(name.c_str()));
         }
 
         template<typename T> SR_NODISCARD T TryGetAttribute(const T& def) const {
@@ -142,7 +177,11 @@ namespace SR_UTILS_NS::Xml {
         }
 
         SR_NODISCARD bool HasAttribute(const std::string &name) const {
-            return m_valid ? !m_node.attribute(name.c_str()).empty() : false;
+            if (!m_valid) {
+                return false;
+            }
+
+            return m_pConfig ? FindCompiledAttribute(name).Valid() : !m_node.attribute(name.c_str()).empty();
         }
 
         SR_NODISCARD std::vector<Node> TryGetNodes() const;
@@ -456,7 +495,11 @@ namespace SR_UTILS_NS::Xml {
         Node AppendNode(const Node &node) { return AppendChild(node); }
 
         SR_NODISCARD Node TryGetNode(const std::string &name) const {
-            return m_valid ? Node(m_node.child(name.c_str())) : Node();
+            if (!m_valid) {
+                return Node();
+            }
+
+            return m_pConfig ? FindCompiledNode(name) : Node(m_node.child(name.c_str()));
         }
 
         SR_NODISCARD Node GetNode(const std::string &name) const {
@@ -466,16 +509,24 @@ namespace SR_UTILS_NS::Xml {
                 return Node();
             }
 
-            return Node(m_node.child(name.c_str()));
+            return m_pConfig ? FindCompiledNode(name) : Node(m_node.child(name.c_str()));
         }
 
+    private:
+        SR_NODISCARD std::string_view GetCompiledName() const;
+        SR_NODISCARD Attribute FindCompiledAttribute(std::string_view name) const;
+        SR_NODISCARD Node FindCompiledNode(std::string_view name) const;
+
     private:
         pugi::xml_node m_node;
         bool m_valid;
+        const CompiledConfig* m_pConfig = nullptr;
+        uint32_t m_compiledId = 0;
 
     };
 
     class SR_DLL_EXPORT Document : public NonCopyable {
+        friend class CompiledConfig;
     public:
         Document() {
             m_valid = false;
@@ -485,6 +536,7 @@ namespace SR_UTILS_NS::Xml {
             : m_document(std::exchange(document.m_document, {}))
             , m_valid(std::exchange(document.m_valid, {}))
             , m_path(std::exchange(document.m_path, {}))
+            , m_compiled(std::exchange(document.m_compiled, {}))
         { }
 
         ~Document() override {
@@ -497,6 +549,7 @@ namespace SR_UTILS_NS::Xml {
             m_document = std::exchange(document.m_document, {});
             m_valid = std::exchange(document.m_valid, {});
             m_path = std::exchange(document.m_path, {});
+            m_compiled = std::exchange(document.m_compiled, {});
             return *this;
         }
 
@@ -504,6 +557,8 @@ namespace SR_UTILS_NS::Xml {
         pugi::xml_document* m_document = nullptr;
         bool m_valid;
         std::string m_path;
+        /// документ загружен из скомпилированного конфига, m_document не создается
+        std::shared_ptr<const CompiledConfig> m_compiled;
     public:
         static Document Empty() {
             return Document();
@@ -518,6 +573,8 @@ namespace SR_UTILS_NS::Xml {
         }
 
         static Document Load(const SR_UTILS_NS::Path &path);
+        /// path нужен только для сообщений об ошибках
+        static Document LoadFromString(const std::string& data, const SR_UTILS_NS::Path& path);
 
         static int32_t GetLastError() {
             auto last = Xml::g_xml_last_error;
@@ -527,8 +584,8 @@ namespace SR_UTILS_NS::Xml {
 
     public:
         Xml::Node AppendChild(const std::string& name) {
-            if (!m_valid) {
-                SRAssert2(false,"Document::AppendChild() : document is not valid!");
+            if (!m_valid || m_compiled) {
+                SRAssert2(false,"Document::AppendChild() : document is not valid or read-only!");
                 g_xml_last_error = -2;
                 return Node();
             }
@@ -541,12 +598,22 @@ namespace SR_UTILS_NS::Xml {
             if (!path.Exists()) {
                 path.Create();
             }
+            if (m_compiled) {
+                return Unpack().Save(path);
+            }
             return m_document->save_file(path.CStr());
         }
 
         SR_NODISCARD std::string Dump() const;
 
+        /// Копия в документ pugixml, который можно изменять
+        SR_NODISCARD Document Unpack() const;
+
         SR_NODISCARD Node Root() const {
+            if (m_compiled) {
+                return Node(m_compiled.get(), 0);
+            }
+
             return Node(m_document->root());
         }
 
@@ -554,12 +621,10 @@ namespace SR_UTILS_NS::Xml {
             if (!Valid())
                 return Node();
 
-            return Node(m_document->root());
+            return Root();
         }
 
-        SR_NODISCARD Node DocumentElement() const {
-            return Node(m_document->document_element());
-        }
+        SR_NODISCARD Node DocumentElement() const;
 
         SR_NODISCARD bool Valid() const { return m_valid; }
 
@@ -32,6 +32,7 @@
 #include <vector>
 #include <ostream>
 #include <queue>
+#include <deque>
 #include <mutex>
 #include <string>
 #include <cassert>
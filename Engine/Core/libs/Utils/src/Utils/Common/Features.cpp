@@ -92,6 +92,12 @@ namespace SR_UTILS_NS {
         return m_features.at(group).Register(name, value);
     }
 
+    void Features::SetEnabled(const std::string& group, const std::string& name, bool value) {
+        SR_LOCK_GUARD
+
+        m_features[group].m_values[name] = value;
+    }
+
     const FeatureGroup& Features::GetGroup(const std::string &name) const {
         SR_LOCK_GUARD
 
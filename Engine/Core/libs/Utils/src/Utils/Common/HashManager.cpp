@@ -23,56 +23,61 @@ namespace SR_UTILS_NS {
     }
 
     const std::string& HashManager::HashToString(HashManager::Hash hash) const {
-        SR_LOCK_GUARD;
         static std::string gDefault;
-        if (auto&& pIt = m_strings.find(hash); pIt != m_strings.end()) {
-            return pIt->second->data;
+        if (auto&& pInfo = Find(hash)) {
+            return pInfo->data;
         }
         return gDefault;
     }
 
     bool HashManager::Exists(HashManager::Hash hash) const {
-        SR_LOCK_GUARD;
-        return m_strings.find(hash) != m_strings.end();
+        return Find(hash) != nullptr;
     }
 
-    StringHashInfo* HashManager::Register(std::string str, Hash hash) {
-        SR_LOCK_GUARD;
+    StringHashInfo* HashManager::Find(Hash hash) const {
+        auto&& shard = GetShard(hash);
+        std::shared_lock lock(shard.mutex);
+
+        if (auto&& pIt = shard.strings.find(hash); pIt != shard.strings.end()) {
+            return pIt->second;
+        }
+
+        return nullptr;
+    }
+
+    StringHashInfo* HashManager::GetOrAddInfo(std::string_view str, Hash hash) {
+        /// StringHashInfo никогда не удаляется, поэтому указатель можно отдавать после снятия блокировки
+        if (auto&& pInfo = Find(hash)) {
+            return pInfo;
+        }
+
+        auto&& shard = GetShard(hash);
+        std::lock_guard lock(shard.mutex);
+
+        /// пока ждали блокировку, строку мог зарегистрировать другой поток
+        if (auto&& pIt = shard.strings.find(hash); pIt != shard.strings.end()) {
+            return pIt->second;
+        }
 
         auto&& pInfo = new StringHashInfo();
         pInfo->size = str.size();
-        pInfo->data = std::move(str);
+        pInfo->data = std::string(str);
         pInfo->hash = hash;
 
-        m_strings.insert(std::make_pair(hash, pInfo));
+        shard.strings.insert(std::make_pair(hash, pInfo));
 
         return pInfo;
     }
 
     StringHashInfo* HashManager::GetOrAddInfo(const std::string& str) {
-        SR_LOCK_GUARD;
-        auto&& hash = SR_HASH_STR(str);
-        if (auto&& pIt = m_strings.find(hash); pIt != m_strings.end()) {
-            return pIt->second;
-        }
-        return Register(str, hash);
+        return GetOrAddInfo(std::string_view(str), SR_HASH_STR(str));
     }
 
     StringHashInfo* HashManager::GetOrAddInfo(const std::string_view& str) {
-        SR_LOCK_GUARD;
-        auto&& hash = SR_HASH_STR_VIEW(str);
-        if (auto&& pIt = m_strings.find(hash); pIt != m_strings.end()) {
-            return pIt->second;
-        }
-        return Register(str.data(), hash);
+        return GetOrAddInfo(str, SR_HASH_STR_VIEW(str));
     }
 
     StringHashInfo* HashManager::GetOrAddInfo(const char* str) {
-        SR_LOCK_GUARD;
-        auto&& hash = SR_HASH_STR(str);
-        if (auto&& pIt = m_strings.find(hash); pIt != m_strings.end()) {
-            return pIt->second;
-        }
-        return Register(str, hash);
+        return GetOrAddInfo(std::string_view(str), SR_HASH_STR(str));
     }
-}
\ No newline at end of file
+}
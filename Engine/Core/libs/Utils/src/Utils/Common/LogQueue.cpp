@@ -0,0 +1,208 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Utils/Common/LogQueue.h>
+
+namespace SR_UTILS_NS {
+    class LogQueue::Ring {
+        static constexpr uint64_t Mask = RingCapacity - 1;
+        static_assert((RingCapacity & Mask) == 0, "Capacity must be a power of two!");
+    public:
+        /// вызывается только потоком-владельцем
+        bool TryPush(LogRecord&& record) {
+            const uint64_t head = m_head.load(std::memory_order_relaxed);
+
+            if (head - m_tail.load(std::memory_order_acquire) >= RingCapacity) {
+                return false;
+            }
+
+            m_records[head & Mask] = std::move(record);
+            m_head.store(head + 1, std::memory_order_release);
+
+            return true;
+        }
+
+        /// вызывается только под LogQueue::m_drainMutex
+        void PopAll(std::vector<LogRecord>& records) {
+            uint64_t tail = m_tail.load(std::memory_order_relaxed);
+            const uint64_t head = m_head.load(std::memory_order_acquire);
+
+            for (; tail != head; ++tail) {
+                records.emplace_back(std::move(m_records[tail & Mask]));
+            }
+
+            m_tail.store(tail, std::memory_order_release);
+        }
+
+        SR_NODISCARD bool Empty() const noexcept {
+            return m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_acquire);
+        }
+
+        SR_NODISCARD uint64_t Size() const noexcept {
+            return m_head.load(std::memory_order_acquire) - m_tail.load(std::memory_order_acquire);
+        }
+
+    public:
+        /// поток-владелец завершился, буфер удаляется после того, как опустеет
+        std::atomic<bool> orphaned = false;
+
+    private:
+        std::array<LogRecord, RingCapacity> m_records;
+
+        alignas(64) std::atomic<uint64_t> m_head = 0;
+        alignas(64) std::atomic<uint64_t> m_tail = 0;
+
+    };
+
+    struct LogQueue::ThreadRing {
+        ~ThreadRing() {
+            if (pRing) {
+                pRing->orphaned = true;
+            }
+        }
+
+        LogQueue* pOwner = nullptr;
+        std::shared_ptr<Ring> pRing;
+    };
+
+    LogQueue::~LogQueue() {
+        Stop();
+    }
+
+    void LogQueue::Start(const Sink& sink, LogOverflowPolicy policy) {
+        if (m_isRun) {
+            return;
+        }
+
+        m_sink = sink;
+        m_policy = policy;
+        m_isRun = true;
+
+        m_thread = std::thread(&LogQueue::Thread, this);
+    }
+
+    void LogQueue::Stop() {
+        if (!m_isRun.exchange(false)) {
+            return;
+        }
+
+        m_condition.notify_one();
+
+        if (m_thread.joinable()) {
+            m_thread.join();
+        }
+
+        Drain();
+    }
+
+    bool LogQueue::Push(LogRecord&& record, bool important) {
+        if (!m_isRun) {
+            return false;
+        }
+
+        auto&& ring = GetThreadRing();
+
+        record.sequence = m_sequence.fetch_add(1, std::memory_order_relaxed);
+
+        while (!ring.TryPush(std::move(record))) {
+            if (m_policy == LogOverflowPolicy::Drop && !important) {
+                ++m_dropped;
+                return true;
+            }
+
+            if (!m_isRun) {
+                return false;
+            }
+
+            m_condition.notify_one();
+            std::this_thread::yield();
+        }
+
+        /// будим поток записи заранее, не дожидаясь переполнения
+        if (ring.Size() >= RingCapacity / 2) {
+            m_condition.notify_one();
+        }
+
+        return true;
+    }
+
+    void LogQueue::Flush() {
+        Drain();
+    }
+
+    void LogQueue::FlushOnCrash() {
+        std::unique_lock lock(m_drainMutex, std::try_to_lock);
+        if (!lock.owns_lock()) {
+            return;
+        }
+
+        DrainImpl();
+    }
+
+    LogQueue::Ring& LogQueue::GetThreadRing() {
+        thread_local ThreadRing threadRing;
+
+        if (threadRing.pOwner != this || !threadRing.pRing) {
+            if (threadRing.pRing) {
+                threadRing.pRing->orphaned = true;
+            }
+
+            threadRing.pOwner = this;
+            threadRing.pRing = std::make_shared<Ring>();
+
+            std::lock_guard lock(m_ringsMutex);
+            m_rings.emplace_back(threadRing.pRing);
+        }
+
+        return *threadRing.pRing;
+    }
+
+    void LogQueue::Thread() {
+        while (m_isRun) {
+            {
+                std::unique_lock lock(m_conditionMutex);
+                m_condition.wait_for(lock, std::chrono::milliseconds(5));
+            }
+
+            Drain();
+        }
+    }
+
+    void LogQueue::Drain() {
+        std::lock_guard lock(m_drainMutex);
+        DrainImpl();
+    }
+
+    void LogQueue::DrainImpl() {
+        {
+            std::lock_guard lock(m_ringsMutex);
+
+            for (auto&& pRing : m_rings) {
+                pRing->PopAll(m_batch);
+            }
+
+            m_rings.erase(std::remove_if(m_rings.begin(), m_rings.end(), [](auto&& pRing) {
+                return pRing->orphaned && pRing->Empty();
+            }), m_rings.end());
+        }
+
+        const uint64_t dropped = m_dropped.load() - m_reportedDropped;
+        m_reportedDropped += dropped;
+
+        if (m_batch.empty() && dropped == 0) {
+            return;
+        }
+
+        /// внутри одного потока порядок и так сохранен, сортировка восстанавливает порядок между потоками
+        std::stable_sort(m_batch.begin(), m_batch.end(), [](const LogRecord& lhs, const LogRecord& rhs) {
+            return lhs.sequence < rhs.sequence;
+        });
+
+        if (m_sink) {
+            m_sink(m_batch, dropped);
+        }
+
+        m_batch.clear();
+    }
+}
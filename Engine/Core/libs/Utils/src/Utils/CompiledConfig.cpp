@@ -0,0 +1,407 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Utils/CompiledConfig.h>
+#include <Utils/Common/Hashes.h>
+#include <Utils/Platform/Platform.h>
+#include <Utils/Profile/TracyContext.h>
+
+namespace SR_XML_NS {
+    namespace {
+        constexpr uint64_t COMPILED_CONFIG_ALIGNMENT = 16;
+
+        uint64_t AlignConfigOffset(uint64_t offset) {
+            return (offset + COMPILED_CONFIG_ALIGNMENT - 1) & ~(COMPILED_CONFIG_ALIGNMENT - 1);
+        }
+
+        template<typename T> bool IsConfigRangeValid(uint64_t offset, uint64_t count, uint64_t size) {
+            if (count == 0) {
+                return offset <= size;
+            }
+
+            return offset % alignof(T) == 0 && offset <= size && count <= (size - offset) / sizeof(T);
+        }
+
+        bool IsDocumentMatchSchema(const pugi::xml_node& root, const ConfigSchema& schema, std::string& error) {
+            pugi::xml_node element;
+
+            for (auto&& child : root.children()) {
+                if (child.type() != pugi::node_element) {
+                    continue;
+                }
+
+                if (element) {
+                    error = "document has several root nodes";
+                    return false;
+                }
+
+                element = child;
+            }
+
+            if (!element) {
+                error = "document is empty";
+                return false;
+            }
+
+            if (!schema.rootNode.empty() && schema.rootNode != element.name()) {
+                error = SR_FORMAT("expected root node \"{}\", got \"{}\"", schema.rootNode, element.name());
+                return false;
+            }
+
+            for (auto&& attribute : schema.requiredAttributes) {
+                if (element.attribute(attribute.c_str()).empty()) {
+                    error = SR_FORMAT("root node has no \"{}\" attribute", attribute);
+                    return false;
+                }
+            }
+
+            /// Attribute возвращает первый атрибут с таким именем, повторы молча терялись бы
+            std::vector<pugi::xml_node> stack = { element };
+
+            while (!stack.empty()) {
+                const pugi::xml_node node = stack.back();
+                stack.pop_back();
+
+                for (auto attribute = node.first_attribute(); attribute; attribute = attribute.next_attribute()) {
+                    for (auto other = attribute.next_attribute(); other; other = other.next_attribute()) {
+                        if (std::strcmp(attribute.name(), other.name()) == 0) {
+                            error = SR_FORMAT("node \"{}\" has duplicate attribute \"{}\"", node.name(), attribute.name());
+                            return false;
+                        }
+                    }
+                }
+
+                for (auto&& child : node.children()) {
+                    if (child.type() == pugi::node_element) {
+                        stack.emplace_back(child);
+                    }
+                }
+            }
+
+            return true;
+        }
+    }
+
+    uint64_t ConfigSchema::GetHash() const {
+        uint64_t hash = SR_HASH_STR(rootNode);
+
+        for (auto&& attribute : requiredAttributes) {
+            hash = SR_UTILS_NS::HashCombine(attribute, hash);
+        }
+
+        return hash;
+    }
+
+    CompiledConfig CompiledConfig::FromBlob(std::vector<uint64_t>&& blob) {
+        CompiledConfig config;
+        config.m_blob = std::move(blob);
+
+        if (!config.Validate()) {
+            config.Clear();
+        }
+
+        return config;
+    }
+
+    CompiledConfig CompiledConfig::Load(const Path& path) {
+        SR_TRACY_ZONE;
+
+        std::ifstream file(path.ToString(), std::ios::binary | std::ios::ate);
+        if (!file.is_open()) {
+            return CompiledConfig();
+        }
+
+        const auto size = static_cast<uint64_t>(file.tellg());
+        if (size < sizeof(Header) || size % sizeof(uint64_t) != 0) {
+            SR_WARN("CompiledConfig::Load() : file has invalid size!\n\tPath: " + path.ToString());
+            return CompiledConfig();
+        }
+
+        std::vector<uint64_t> blob(size / sizeof(uint64_t));
+
+        file.seekg(0);
+        if (!file.read(reinterpret_cast<char*>(blob.data()), static_cast<std::streamsize>(size))) {
+            SR_WARN("CompiledConfig::Load() : failed to read file!\n\tPath: " + path.ToString());
+            return CompiledConfig();
+        }
+
+        auto&& config = FromBlob(std::move(blob));
+        if (!config.Valid()) {
+            SR_WARN("CompiledConfig::Load() : file is corrupted or has an old version!\n\tPath: " + path.ToString());
+        }
+
+        return config;
+    }
+
+    CompiledConfig CompiledConfig::Compile(const Document& document, const ConfigSchema& schema, uint64_t sourceHash) {
+        SR_TRACY_ZONE;
+
+        if (!document.Valid()) {
+            return CompiledConfig();
+        }
+
+        if (document.m_compiled) {
+            return Compile(document.Unpack(), schema, sourceHash);
+        }
+
+        auto&& root = document.m_document->root();
+
+        std::string error;
+        if (!IsDocumentMatchSchema(root, schema, error)) {
+            SR_ERROR("CompiledConfig::Compile() : document doesn't match the schema!\n\tPath: " + document.m_path + "\n\tReason: " + error);
+            return CompiledConfig();
+        }
+
+        std::vector<CompiledNode> nodes;
+        std::vector<CompiledAttribute> attributes;
+        std::vector<CompiledString> strings;
+        std::string chars;
+        std::unordered_map<std::string, uint32_t> interned;
+
+        auto&& intern = [&](const char* str) -> uint32_t {
+            auto&& [pIt, inserted] = interned.try_emplace(str, static_cast<uint32_t>(strings.size()));
+            if (inserted) {
+                strings.emplace_back(CompiledString { static_cast<uint32_t>(chars.size()), static_cast<uint32_t>(pIt->first.size()) });
+                chars.append(pIt->first);
+                chars.push_back('\0');
+            }
+            return pIt->second;
+        };
+
+        /// обход в ширину кладет детей каждого узла подряд
+        std::vector<pugi::xml_node> order = { root };
+
+        for (uint64_t i = 0; i < order.size(); ++i) {
+            const pugi::xml_node xmlNode = order[i];
+
+            CompiledNode node;
+            node.type = static_cast<uint32_t>(xmlNode.type());
+            node.name = intern(xmlNode.name());
+            node.value = intern(xmlNode.value());
+
+            node.firstAttribute = static_cast<uint32_t>(attributes.size());
+
+            for (auto&& xmlAttribute : xmlNode.attributes()) {
+                CompiledAttribute attribute;
+                attribute.name = intern(xmlAttribute.name());
+                attribute.value = intern(xmlAttribute.value());
+                attribute.int32 = xmlAttribute.as_int();
+                attribute.uint32 = xmlAttribute.as_uint();
+                attribute.int64 = xmlAttribute.as_llong();
+                attribute.uint64 = xmlAttribute.as_ullong();
+                attribute.float64 = xmlAttribute.as_double();
+                attribute.float32 = xmlAttribute.as_float();
+                attribute.boolean = xmlAttribute.as_bool() ? 1 : 0;
+                attributes.emplace_back(attribute);
+            }
+
+            node.attributesCount = static_cast<uint32_t>(attributes.size()) - node.firstAttribute;
+
+            node.firstChild = static_cast<uint32_t>(order.size());
+
+            for (auto&& child : xmlNode.children()) {
+                order.emplace_back(child);
+            }
+
+            node.childrenCount = static_cast<uint32_t>(order.size()) - node.firstChild;
+
+            nodes.emplace_back(node);
+        }
+
+        Header header;
+        header.sourceHash = sourceHash;
+        header.schemaHash = schema.GetHash();
+        header.nodesCount = static_cast<uint32_t>(nodes.size());
+        header.attributesCount = static_cast<uint32_t>(attributes.size());
+        header.stringsCount = static_cast<uint32_t>(strings.size());
+
+        header.nodesOffset = AlignConfigOffset(sizeof(Header));
+        header.attributesOffset = AlignConfigOffset(header.nodesOffset + nodes.size() * sizeof(CompiledNode));
+        header.stringsOffset = AlignConfigOffset(header.attributesOffset + attributes.size() * sizeof(CompiledAttribute));
+        header.charsOffset = AlignConfigOffset(header.stringsOffset + strings.size() * sizeof(CompiledString));
+        header.charsSize = chars.size();
+        header.size = AlignConfigOffset(header.charsOffset + chars.size());
+
+        std::vector<uint64_t> blob(header.size / sizeof(uint64_t), 0);
+        auto&& pData = reinterpret_cast<char*>(blob.data());
+
+        std::memcpy(pData, &header, sizeof(Header));
+        std::memcpy(pData + header.nodesOffset, nodes.data(), nodes.size() * sizeof(CompiledNode));
+        std::memcpy(pData + header.attributesOffset, attributes.data(), attributes.size() * sizeof(CompiledAttribute));
+        std::memcpy(pData + header.stringsOffset, strings.data(), strings.size() * sizeof(CompiledString));
+        std::memcpy(pData + header.charsOffset, chars.data(), chars.size());
+
+        return FromBlob(std::move(blob));
+    }
+
+    Document CompiledConfig::LoadDocument(const Path& path, const Path& cachePath, const ConfigSchema& schema) {
+        SR_TRACY_ZONE;
+        SR_TRACY_TEXT_N("Path", path.ToStringRef());
+
+        auto&& fileData = SR_PLATFORM_NS::ReadFile(path);
+        if (!fileData) {
+            SR_ERROR("CompiledConfig::LoadDocument() : file not exists! \n\tPath: " + path.ToString());
+            return Document();
+        }
+
+        const uint64_t sourceHash = SR_HASH_STR(fileData.value());
+
+        auto&& config = Load(cachePath);
+        if (config.Valid() && config.GetSourceHash() == sourceHash && config.GetSchemaHash() == schema.GetHash()) {
+            return std::move(config).ToDocument(path);
+        }
+
+        auto&& document = Document::LoadFromString(fileData.value(), path);
+        if (!document.Valid()) {
+            return document;
+        }
+
+        config = Compile(document, schema, sourceHash);
+        if (!config.Valid()) {
+            return Document();
+        }
+
+        if (!config.Save(cachePath)) {
+            SR_WARN("CompiledConfig::LoadDocument() : failed to save compiled config!\n\tPath: " + cachePath.ToString());
+        }
+
+        /// документ из блока и при промахе кеша, чтобы поведение не зависело от его состояния
+        return std::move(config).ToDocument(path);
+    }
+
+    bool CompiledConfig::Save(const Path& path) const {
+        if (!Valid() || !path.Create()) {
+            return false;
+        }
+
+        std::ofstream file(path.ToString(), std::ios::binary);
+        if (!file.is_open()) {
+            return false;
+        }
+
+        file.write(reinterpret_cast<const char*>(m_blob.data()), static_cast<std::streamsize>(GetHeader().size));
+
+        return file.good();
+    }
+
+    void CompiledConfig::Clear() {
+        m_blob.clear();
+        m_blob.shrink_to_fit();
+    }
+
+    Document CompiledConfig::ToDocument(const Path& path) && {
+        if (!Valid()) {
+            return Document();
+        }
+
+        Document document;
+        document.m_valid = true;
+        document.m_path = path.ToString();
+        document.m_compiled = std::make_shared<CompiledConfig>(std::move(*this));
+
+        return document;
+    }
+
+    std::string_view CompiledConfig::GetString(uint32_t id) const {
+        auto&& string = Section<CompiledString>(GetHeader().stringsOffset)[id];
+        return std::string_view(Section<char>(GetHeader().charsOffset) + string.offset, string.size);
+    }
+
+    const char* CompiledConfig::GetCString(uint32_t id) const {
+        return Section<char>(GetHeader().charsOffset) + Section<CompiledString>(GetHeader().stringsOffset)[id].offset;
+    }
+
+    pugi::xml_node CompiledConfig::CopyTo(pugi::xml_node parent, uint32_t id) const {
+        auto&& node = GetNode(id);
+
+        auto&& xmlNode = parent.append_child(static_cast<pugi::xml_node_type>(node.type));
+        if (xmlNode.empty()) {
+            return xmlNode;
+        }
+
+        if (!GetString(node.name).empty()) {
+            xmlNode.set_name(GetCString(node.name));
+        }
+
+        if (!GetString(node.value).empty()) {
+            xmlNode.set_value(GetCString(node.value));
+        }
+
+        for (uint32_t i = node.firstAttribute; i < node.firstAttribute + node.attributesCount; ++i) {
+            auto&& attribute = GetAttribute(i);
+            xmlNode.append_attribute(GetCString(attribute.name)).set_value(GetCString(attribute.value));
+        }
+
+        CopyChildren(xmlNode, id);
+
+        return xmlNode;
+    }
+
+    void CompiledConfig::CopyChildren(pugi::xml_node parent, uint32_t id) const {
+        auto&& node = GetNode(id);
+
+        for (uint32_t i = node.firstChild; i < node.firstChild + node.childrenCount; ++i) {
+            CopyTo(parent, i);
+        }
+    }
+
+    bool CompiledConfig::Validate() const {
+        const uint64_t blobSize = m_blob.size() * sizeof(uint64_t);
+
+        if (blobSize < sizeof(Header)) {
+            return false;
+        }
+
+        auto&& header = GetHeader();
+
+        if (header.magic != MAGIC || header.version != VERSION || header.size != blobSize || header.nodesCount == 0) {
+            return false;
+        }
+
+        const uint64_t size = header.size;
+
+        if (!IsConfigRangeValid<CompiledNode>(header.nodesOffset, header.nodesCount, size) ||
+            !IsConfigRangeValid<CompiledAttribute>(header.attributesOffset, header.attributesCount, size) ||
+            !IsConfigRangeValid<CompiledString>(header.stringsOffset, header.stringsCount, size) ||
+            !IsConfigRangeValid<char>(header.charsOffset, header.charsSize, size)
+        ) {
+            return false;
+        }
+
+        auto&& pChars = Section<char>(header.charsOffset);
+        auto&& pStrings = Section<CompiledString>(header.stringsOffset);
+
+        for (uint32_t i = 0; i < header.stringsCount; ++i) {
+            const uint64_t end = static_cast<uint64_t>(pStrings[i].offset) + pStrings[i].size;
+            if (end >= header.charsSize || pChars[end] != '\0') {
+                return false;
+            }
+        }
+
+        for (uint32_t i = 0; i < header.attributesCount; ++i) {
+            auto&& attribute = GetAttribute(i);
+            if (attribute.name >= header.stringsCount || attribute.value >= header.stringsCount) {
+                return false;
+            }
+        }
+
+        for (uint32_t i = 0; i < header.nodesCount; ++i) {
+            auto&& node = GetNode(i);
+
+            if (node.name >= header.stringsCount || node.value >= header.stringsCount ||
+                static_cast<uint64_t>(node.firstAttribute) + node.attributesCount > header.attributesCount ||
+                static_cast<uint64_t>(node.firstChild) + node.childrenCount > header.nodesCount
+            ) {
+                return false;
+            }
+
+            /// дети всегда дальше родителя, иначе обход мог бы зациклиться
+            if (node.childrenCount > 0 && node.firstChild <= i) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
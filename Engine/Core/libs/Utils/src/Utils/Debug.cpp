@@ -10,7 +10,6 @@
 
 namespace SR_UTILS_NS {
     void Debug::Print(std::string msg, DebugLogType type) {
-        SR_LOCK_GUARD;
         SR_TRACY_ZONE;
         SR_TRACY_TEXT_N("Text", msg);
 
@@ -22,24 +21,117 @@ namespace SR_UTILS_NS {
         if (type == DebugLogType::Assert) {
             msg.append("\nStack trace:\n").append(GetStacktrace());
         }
-        msg.append("\n");
 
-        auto&& prefix = SR_FORMAT("[{}]", SR_UTILS_NS::EnumReflector::ToStringAtom(type).ToCStr());
-        auto&& memoryUsage = m_showUseMemory ? SR_FORMAT("<{} KB> ", static_cast<uint32_t>(SR_PLATFORM_NS::GetProcessUsedMemory() / 1024)) : std::string();
+        /// префикс, замер памяти и перенос строки добавляет поток записи
+        LogRecord record;
+        record.type = static_cast<uint8_t>(type);
+        record.message = std::move(msg);
+
+        /// ассерты пишем сразу, следом может быть брейкпоинт или падение
+        if (type != DebugLogType::Assert) {
+            const bool important = type == DebugLogType::Error || type == DebugLogType::VulkanError || type == DebugLogType::ScriptError;
+            if (m_queue.Push(std::move(record), important)) {
+                return;
+            }
+        }
 
-        fmt::print(fmt::fg(fmt::color::dark_gray) | fmt::emphasis::faint, memoryUsage);
-        fmt::print(GetTextStyleColorByLogType(type),prefix);
-        fmt::print(fmt::emphasis::bold, " " + msg);
+        /// сохраняем порядок с уже накопленными асинхронными записями
+        m_queue.Flush();
+
+        Write(record);
+
+        volatile static bool enableBreakPoints = true;
+        if (type == DebugLogType::Assert && Platform::IsRunningUnderDebugger() && enableBreakPoints) {
+            Breakpoint();
+        }
+    }
+
+    void Debug::Write(const LogRecord& record) {
+        std::lock_guard lock(m_outputMutex);
+
+        WriteRecord(record, GetMemoryUsagePrefix());
 
         std::cout << std::flush;
+    }
+
+    void Debug::WriteBatch(std::vector<LogRecord>& records, uint64_t dropped) {
+        SR_TRACY_ZONE;
+
+        std::lock_guard lock(m_outputMutex);
+
+        if (dropped > 0) {
+            auto&& message = SR_FORMAT(" Debug::WriteBatch() : {} log records were dropped!\n", dropped);
+            if (m_consoleOutput) {
+                fmt::print(GetTextStyleColorByLogType(DebugLogType::Warn), "[Warn]");
+                fmt::print(fmt::emphasis::bold, message);
+            }
+
+            if (m_file.is_open()) {
+                m_file << "[Warn]" << message;
+            }
+        }
+
+        /// расход памяти один на пачку, записи в ней сделаны почти одновременно
+        auto&& memoryUsage = GetMemoryUsagePrefix();
+
+        for (auto&& record : records) {
+            WriteRecord(record, memoryUsage);
+        }
+
+        std::cout << std::flush;
+    }
+
+    void Debug::WriteRecord(const LogRecord& record, const std::string& memoryUsage) {
+        const auto type = static_cast<DebugLogType>(record.type);
+        auto&& prefix = SR_FORMAT("[{}]", SR_UTILS_NS::EnumReflector::ToStringAtom(type).ToCStr());
+
+        if (m_consoleOutput) {
+            fmt::print(fmt::fg(fmt::color::dark_gray) | fmt::emphasis::faint, memoryUsage);
+            fmt::print(GetTextStyleColorByLogType(type), prefix);
+            fmt::print(fmt::emphasis::bold, " {}\n", record.message);
+        }
 
         if (m_file.is_open()) {
-            m_file << (memoryUsage + prefix + " " + msg);
+            m_file << memoryUsage << prefix << " " << record.message << "\n";
         }
+    }
 
-        volatile static bool enableBreakPoints = true;
-        if (type == DebugLogType::Assert && Platform::IsRunningUnderDebugger() && enableBreakPoints) {
-            Breakpoint();
+    std::string Debug::GetMemoryUsagePrefix() const {
+        if (!m_showUseMemory) {
+            return std::string();
+        }
+
+        return SR_FORMAT("<{} KB> ", static_cast<uint32_t>(SR_PLATFORM_NS::GetProcessUsedMemory() / 1024));
+    }
+
+    void Debug::SetAsync(bool enabled, LogOverflowPolicy policy) {
+        if (!enabled) {
+            m_queue.Stop();
+            return;
+        }
+
+        m_queue.Start([this](std::vector<LogRecord>& records, uint64_t dropped) {
+            WriteBatch(records, dropped);
+        }, policy);
+    }
+
+    void Debug::Flush() {
+        m_queue.Flush();
+
+        std::lock_guard lock(m_outputMutex);
+
+        if (m_file.is_open()) {
+            m_file.flush();
+        }
+    }
+
+    void Debug::FlushOnCrash() {
+        m_queue.FlushOnCrash();
+
+        std::unique_lock lock(m_outputMutex, std::try_to_lock);
+
+        if (lock.owns_lock() && m_file.is_open()) {
+            m_file.flush();
         }
     }
 
@@ -81,6 +173,8 @@ namespace SR_UTILS_NS {
             Print(msg, DebugLogType::Debug);
         }
 
+        m_queue.Stop();
+
         if (m_file.is_open()) {
             m_file.close();
         }
@@ -81,7 +81,13 @@ namespace SR_UTILS_NS {
         /// это должно быть единственное место,
         /// где мы уничтожаем объект
         copy.AutoFree([](GameObject* pGameObject) {
-            delete pGameObject;
+            if (auto&& pChunk = pGameObject->m_poolChunk) {
+                pGameObject->~GameObject();
+                GameObjectPool::Free(pChunk);
+            }
+            else {
+                delete pGameObject;
+            }
         });
     }
 
@@ -119,11 +125,21 @@ namespace SR_UTILS_NS {
         return true;
     }
 
+    void GameObject::AttachTemplateChild(const GameObject::Ptr& pChild) {
+        pChild->m_parent = this;
+        pChild->SetEntityPath(GetEntityPath().Concat(pChild->GetEntityId()));
+
+        m_children.emplace_back(pChild);
+    }
+
     void GameObject::SetName(std::string name) {
+        const uint64_t oldHashName = m_hashName;
+
         m_name = std::move(name);
         m_hashName = SR_HASH_STR(m_name);
 
         if (m_scene) {
+            m_scene->OnGameObjectNameChanged(this, oldHashName);
             m_scene->OnChanged();
         }
     }
@@ -557,7 +573,7 @@ namespace SR_UTILS_NS {
 
                 gameObject->SetName(objectName);
                 gameObject->SetEnabled(isEnabled);
-                gameObject->m_tag = tag;
+                gameObject->SetTag(tag);
                 gameObject->SetTransform(pTransform);
                 return gameObject;
             }
@@ -597,7 +613,7 @@ namespace SR_UTILS_NS {
                     gameObject.Get()
             ));
 
-            gameObject->m_tag = tag;
+            gameObject->SetTag(tag);
 
             /// ----------------------
 
@@ -626,7 +642,7 @@ namespace SR_UTILS_NS {
 
         gameObject->SetEnabled(IsEnabled());
 
-        gameObject->m_tag = m_tag;
+        gameObject->SetTag(m_tag);
 
         if (scene) {
             scene->RegisterGameObject(gameObject);
@@ -652,7 +668,29 @@ namespace SR_UTILS_NS {
     }
 
     void GameObject::SetTag(const std::string& tag) {
-        m_tag = TagManager::Instance().HashTag(tag);
+        SetTag(TagManager::Instance().HashTag(tag));
+    }
+
+    void GameObject::SetTag(Tag tag) {
+        const Tag oldTag = m_tag;
+
+        m_tag = tag;
+
+        if (m_scene && oldTag != m_tag) {
+            m_scene->OnGameObjectTagChanged(this, oldTag);
+        }
+    }
+
+    void GameObject::OnComponentAttached(Component* pComponent) {
+        if (m_scene) {
+            m_scene->OnGameObjectComponentAttached(this, pComponent);
+        }
+    }
+
+    void GameObject::OnComponentDetached(Component* pComponent) {
+        if (m_scene) {
+            m_scene->OnGameObjectComponentDetached(this, pComponent);
+        }
     }
 
     std::string GameObject::GetTagString() const {
@@ -0,0 +1,72 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Utils/ECS/GameObjectPool.h>
+#include <Utils/ECS/GameObject.h>
+#include <Utils/Profile/MemoryTracker.h>
+
+namespace SR_UTILS_NS {
+    struct GameObjectPool::Chunk {
+        /// живые объекты плюс ссылка пула, пока он жив
+        std::atomic<uint32_t> references = 1;
+        uint32_t capacity = 0;
+        uint32_t used = 0;
+    };
+
+    namespace {
+        constexpr uint64_t CHUNK_DATA_OFFSET = (sizeof(GameObjectPool::Chunk) + alignof(GameObject) - 1) & ~(alignof(GameObject) - 1);
+    }
+
+    GameObjectPool::~GameObjectPool() {
+        for (auto&& pChunk : m_chunks) {
+            Free(pChunk);
+        }
+    }
+
+    void* GameObjectPool::Allocate(uint32_t count, Chunk*& pChunk) {
+        std::lock_guard lock(m_mutex);
+
+        if (!m_current || m_current->capacity - m_current->used < count) {
+            m_current = nullptr;
+
+            /// ссылку пула на блок без объектов больше никто не трогает, его можно заполнять с начала
+            for (auto&& pFree : m_chunks) {
+                if (pFree->capacity >= count && pFree->references.load(std::memory_order_acquire) == 1) {
+                    pFree->used = 0;
+                    m_current = pFree;
+                    break;
+                }
+            }
+
+            if (!m_current) {
+                const uint32_t capacity = SR_MAX(count, ChunkObjects);
+
+                auto&& pMemory = MemoryTracker::Allocate(MemoryTag::Scene, CHUNK_DATA_OFFSET + capacity * sizeof(GameObject), alignof(GameObject));
+                if (!pMemory) {
+                    return nullptr;
+                }
+
+                m_current = new (pMemory) Chunk();
+                m_current->capacity = capacity;
+                m_chunks.emplace_back(m_current);
+            }
+        }
+
+        m_current->references.fetch_add(count, std::memory_order_relaxed);
+
+        pChunk = m_current;
+
+        auto&& pData = reinterpret_cast<char*>(m_current) + CHUNK_DATA_OFFSET + m_current->used * sizeof(GameObject);
+        m_current->used += count;
+
+        return pData;
+    }
+
+    void GameObjectPool::Free(Chunk* pChunk) noexcept {
+        if (pChunk->references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            pChunk->~Chunk();
+            MemoryTracker::Free(pChunk);
+        }
+    }
+}
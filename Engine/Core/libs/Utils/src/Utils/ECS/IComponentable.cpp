@@ -145,6 +145,7 @@ namespace SR_UTILS_NS {
         }
         else {
             m_components.erase(pIt);
+            OnComponentDetached(pComponent);
         }
 
         SRAssert2(!pComponent->GetParent() || pComponent->GetParent() == this, "The component does not belong to the game object!");
@@ -167,6 +168,7 @@ namespace SR_UTILS_NS {
             while (!m_loadedComponents.empty()) {
                 auto&& pLoadedCmp = m_loadedComponents.front();
                 m_components.emplace_back(pLoadedCmp);
+                OnComponentAttached(pLoadedCmp);
 
                 pLoadedCmp->SetParent(this);
 
@@ -245,6 +247,7 @@ namespace SR_UTILS_NS {
         /// Используем такой проход, так как в процессе удаления может измениться список!
         for (uint32_t i = 0; i < m_components.size(); ++i) { /// NOLINT
             auto&& pComponent = m_components[i];
+            OnComponentDetached(pComponent);
             DestroyComponent(pComponent);
         }
 
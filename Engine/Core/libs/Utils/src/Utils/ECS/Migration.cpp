@@ -3,46 +3,146 @@
 //
 
 #include <Utils/ECS/Migration.h>
+#include <Utils/Common/Features.h>
+#include <Utils/FileSystem/FileSystem.h>
+#include <Utils/ResourceManager/ResourceManager.h>
+#include <Utils/Profile/TracyContext.h>
 
 namespace SR_UTILS_NS {
+    static thread_local uint64_t gMigratedCount = 0;
+
     bool Migration::Migrate(uint64_t hashName, SR_HTYPES_NS::Marshal& marshal, Version from, Version to) const {
+        SR_TRACY_ZONE;
+
+        if (from == to) {
+            return true;
+        }
+
+        const Chain chain = ResolveChain(hashName, from, to);
+        if (chain.empty()) {
+            return false;
+        }
+
+        const uint64_t position = marshal.GetPosition();
+
+        for (auto&& pMigrator : chain) {
+            SR_HTYPES_NS::Marshal migrated;
+
+            if (!(*pMigrator)(marshal, migrated)) {
+                marshal.SetPosition(position);
+                return false;
+            }
+
+            /// прочитанный мигратором диапазон заменяется его результатом, следующий шаг читает с того же места
+            marshal.Replace(position, marshal.GetPosition() - position, migrated.Stream::View(), migrated.Size());
+            marshal.SetPosition(position);
+        }
+
+        ++gMigratedCount;
+
+        return true;
+    }
+
+    Migration::Chain Migration::ResolveChain(uint64_t hashName, Version from, Version to) const {
+        SR_SCOPED_LOCK
+
+        const ChainKey key = std::make_tuple(hashName, from, to);
+
+        if (auto&& pIt = m_chains.find(key); pIt != m_chains.end()) {
+            return pIt->second;
+        }
+
+        auto&& chain = m_chains[key];
+
         auto&& pIt = m_migrators.find(hashName);
         if (pIt == m_migrators.end()) {
-            return false;
+            return Chain();
         }
 
-        SR_HTYPES_NS::Marshal migrated = marshal.FullCopy();
+        /// каждый шаг берет первый зарегистрированный мигратор со своей версии, цикл в регистрациях обрывает поиск
+        for (Version version = from; version != to; ) {
+            const MigrationInfo* pStep = nullptr;
 
-        for (auto&& migrator : pIt->second) {
-            if (migrator.from == from) {
-                if (migrator.migrator(migrated)) {
-                    from = migrator.to;
-                }
-                else {
+            for (auto&& info : pIt->second) {
+                if (info.from == version) {
+                    pStep = &info;
                     break;
                 }
             }
-        }
 
-        if (!pIt->second.empty() && pIt->second.back().to == to) {
-            marshal = migrated.FullCopy();
-            return true;
+            if (!pStep || chain.size() >= pIt->second.size()) {
+                chain.clear();
+                return Chain();
+            }
+
+            chain.emplace_back(&pStep->migrator);
+            version = pStep->to;
         }
 
-        return false;
+        return chain;
     }
 
     bool Migration::RegisterMigrator(uint64_t hashName, Migration::Version from, Migration::Version to, Migration::Migrator&& migrator) {
+        SR_SCOPED_LOCK
+
         auto&& migrators = m_migrators[hashName];
 
         MigrationInfo migrationInfo;
 
         migrationInfo.from = from;
         migrationInfo.to = to;
-        migrationInfo.migrator = migrator;
+        migrationInfo.migrator = std::move(migrator);
 
         migrators.emplace_back(std::move(migrationInfo));
 
+        /// новый мигратор может достроить цепочку, которая раньше не разрешалась, поэтому кеш собирается заново.
+        /// Уже отданные цепочки остаются валидными: миграторы в deque не двигаются
+        m_chains.clear();
+
+        return true;
+    }
+
+    uint64_t Migration::GetMigratedCount() const noexcept {
+        return gMigratedCount;
+    }
+
+    bool Migration::IsCacheEnabled() const {
+        return SR_UTILS_NS::Features::Instance().Enabled("MigratedAssetsCache", false);
+    }
+
+    Path Migration::GetCachePath(const Path& resourcePath) const {
+        return ResourceManager::Instance().GetCachePath().Concat("Migrated").Concat(resourcePath);
+    }
+
+    SR_HTYPES_NS::Marshal Migration::LoadFromCache(const Path& resourcePath, uint64_t sourceHash) const {
+        if (!IsCacheEnabled()) {
+            return SR_HTYPES_NS::Marshal();
+        }
+
+        auto&& cachePath = GetCachePath(resourcePath);
+
+        if (sourceHash != SR_UTILS_NS::FileSystem::ReadHashFromFile(cachePath.ConcatExt("hash"))) {
+            return SR_HTYPES_NS::Marshal();
+        }
+
+        return SR_HTYPES_NS::Marshal::Load(cachePath.ConcatExt("cache"));
+    }
+
+    bool Migration::SaveToCache(const Path& resourcePath, uint64_t sourceHash, const SR_HTYPES_NS::Marshal& marshal) const {
+        if (!IsCacheEnabled() || !marshal.Valid()) {
+            return false;
+        }
+
+        auto&& cachePath = GetCachePath(resourcePath);
+
+        if (!marshal.Save(cachePath.ConcatExt("cache"))) {
+            SR_WARN("Migration::SaveToCache() : failed to save migrated data!\n\tPath: " + cachePath.ToStringRef());
+            return false;
+        }
+
+        /// хеш пишется последним, недописанный кеш не совпадет с исходником
+        SR_UTILS_NS::FileSystem::WriteHashToFile(cachePath.ConcatExt("hash"), sourceHash);
+
         return true;
     }
-}
\ No newline at end of file
+}
@@ -4,6 +4,7 @@
 
 #include <Utils/ECS/Prefab.h>
 #include <Utils/ResourceManager/ResourceManager.h>
+#include <Utils/ECS/Migration.h>
 
 namespace SR_UTILS_NS {
     Prefab::Prefab()
@@ -45,6 +46,8 @@ namespace SR_UTILS_NS {
     }
 
     bool Prefab::Unload() {
+        m_template.Clear();
+
         m_data.AutoFree([](auto&& pData) {
             pData->Destroy();
         });
@@ -58,12 +61,22 @@ namespace SR_UTILS_NS {
             path = ResourceManager::Instance().GetResPath().Concat(path);
         }
 
-        auto&& marshal = SR_HTYPES_NS::Marshal::Load(path);
+        auto&& migration = Migration::Instance();
+        const uint64_t sourceHash = migration.IsCacheEnabled() ? path.GetFileHash() : 0;
+
+        /// устаревший префаб мигрирует один раз, дальше читается уже обновленная копия из кеша
+        auto&& marshal = migration.LoadFromCache(GetResourcePath(), sourceHash);
+        if (!marshal.Valid()) {
+            marshal = SR_HTYPES_NS::Marshal::Load(path);
+        }
+
         if (!marshal.Valid()) {
             SR_ERROR("Prefab::Load() : failed to load marshal data!");
             return false;
         }
 
+        const uint64_t migratedCount = migration.GetMigratedCount();
+
         m_data = SR_UTILS_NS::GameObject::Load(marshal, nullptr);
 
         if (!m_data.Valid()) {
@@ -72,13 +85,21 @@ namespace SR_UTILS_NS {
             return false;
         }
 
+        if (migratedCount != migration.GetMigratedCount() && migration.IsCacheEnabled()) {
+            if (auto&& pMarshal = m_data->Save(SavableSaveData(nullptr, SAVABLE_FLAG_ECS_NO_ID))) {
+                migration.SaveToCache(GetResourcePath(), sourceHash, *pMarshal);
+                SR_SAFE_DELETE_PTR(pMarshal);
+            }
+        }
+
+        m_template.Compile(m_data);
 
         return IResource::Load();
     }
 
     Prefab::GameObjectPtr Prefab::Instance(const Prefab::ScenePtr& scene) const {
         if (m_data) {
-            auto&& instanced = m_data->Copy(scene);
+            auto&& instanced = m_template.Valid() ? m_template.Instance(scene) : m_data->Copy(scene);
             instanced->SetPrefab(const_cast<Prefab*>(this), true);
             return instanced;
         }
@@ -0,0 +1,113 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Utils/ECS/PrefabTemplate.h>
+#include <Utils/ECS/GameObject.h>
+#include <Utils/ECS/Component.h>
+#include <Utils/ECS/Transform.h>
+#include <Utils/World/Scene.h>
+#include <Utils/Profile/TracyContext.h>
+
+namespace SR_UTILS_NS {
+    void PrefabTemplate::Clear() {
+        m_nodes.clear();
+        m_components.clear();
+        m_prefabOwners.clear();
+    }
+
+    void PrefabTemplate::Compile(const GameObjectPtr& pRoot) {
+        SR_TRACY_ZONE;
+
+        Clear();
+
+        if (pRoot) {
+            CompileNode(pRoot, SR_ID_INVALID);
+        }
+    }
+
+    void PrefabTemplate::CompileNode(const GameObjectPtr& pGameObject, int32_t parent) {
+        const auto index = static_cast<uint32_t>(m_nodes.size());
+
+        auto&& node = m_nodes.emplace_back();
+        node.name = pGameObject->GetName();
+        node.tag = pGameObject->GetTag();
+        node.parent = parent;
+        node.enabled = pGameObject->IsEnabled();
+        node.pTransform = pGameObject->GetTransform();
+        node.pPrefab = pGameObject->IsPrefabOwner() ? pGameObject->GetPrefab() : nullptr;
+        node.childrenCount = static_cast<uint32_t>(pGameObject->GetChildrenRef().size());
+        node.firstComponent = static_cast<uint32_t>(m_components.size());
+
+        /// тот же порядок, что и в GameObject::Copy
+        for (auto&& pComponent : pGameObject->GetComponents()) {
+            m_components.emplace_back(pComponent);
+        }
+
+        for (auto&& pComponent : pGameObject->GetLoadedComponents()) {
+            m_components.emplace_back(pComponent);
+        }
+
+        /// node может стать недействительной после рекурсии, дальше только по индексу
+        node.componentsCount = static_cast<uint32_t>(m_components.size()) - node.firstComponent;
+
+        for (auto&& pChild : pGameObject->GetChildrenRef()) {
+            CompileNode(pChild, static_cast<int32_t>(index));
+        }
+
+        if (m_nodes[index].pPrefab) {
+            m_prefabOwners.emplace_back(index);
+        }
+    }
+
+    PrefabTemplate::GameObjectPtr PrefabTemplate::Instance(const ScenePtr& scene) const {
+        SR_TRACY_ZONE;
+
+        if (m_nodes.empty()) {
+            return GameObjectPtr();
+        }
+
+        /// вся иерархия экземпляра лежит подряд в пуле сцены, без сцены - в куче
+        GameObjectPool::Chunk* pChunk = nullptr;
+        auto&& pMemory = scene ? static_cast<GameObject*>(scene->GetGameObjectPool().Allocate(static_cast<uint32_t>(m_nodes.size()), pChunk)) : nullptr;
+
+        std::vector<GameObjectPtr> instances;
+        instances.reserve(m_nodes.size());
+
+        for (uint32_t i = 0; i < m_nodes.size(); ++i) {
+            auto&& node = m_nodes[i];
+
+            GameObjectPtr pGameObject = pMemory
+                ? new (pMemory + i) GameObject(node.name, node.pTransform->Copy())
+                : new GameObject(node.name, node.pTransform->Copy());
+
+            pGameObject->m_poolChunk = pChunk;
+
+            pGameObject->SetEnabled(node.enabled);
+            pGameObject->SetTag(node.tag);
+            pGameObject->GetChildrenRef().reserve(node.childrenCount);
+
+            for (uint32_t j = node.firstComponent; j < node.firstComponent + node.componentsCount; ++j) {
+                pGameObject->AddComponent(m_components[j]->CopyComponent());
+            }
+
+            /// узлы идут в прямом порядке, родитель уже создан и стоит на своем месте
+            if (node.parent != SR_ID_INVALID) {
+                instances[node.parent]->AttachTemplateChild(pGameObject);
+            }
+
+            instances.emplace_back(std::move(pGameObject));
+        }
+
+        /// внутренний префаб назначается раньше внешнего, как в Copy, и внешний его не перезаписывает
+        for (auto&& index : m_prefabOwners) {
+            instances[index]->SetPrefab(m_nodes[index].pPrefab, true);
+        }
+
+        if (scene) {
+            scene->RegisterGameObjects(instances);
+        }
+
+        return instances.front();
+    }
+}
@@ -4,6 +4,7 @@
 
 #include <Utils/ECS/Transform3D.h>
 #include <Utils/ECS/GameObject.h>
+#include <Utils/Math/SIMD.h>
 
 namespace SR_UTILS_NS {
     void Transform3D::UpdateMatrix() {
@@ -26,20 +27,95 @@ namespace SR_UTILS_NS {
     }
 
     const SR_MATH_NS::Matrix4x4& Transform3D::GetMatrix() {
-        if (IsDirty()) {
-            SR_TRACY_ZONE;
+        if (!IsDirty()) {
+            return m_matrix;
+        }
+
+        SR_TRACY_ZONE;
+
+        if (auto&& pTransform = m_gameObject->GetParentTransform()) {
+            auto&& parentMatrix = pTransform->GetMatrix();
+
+            /// родитель мог пересчитать нас вместе с остальными детьми
+            if (!IsDirty()) {
+                return m_matrix;
+            }
 
             UpdateMatrix();
+            m_matrix = parentMatrix * m_localMatrix;
+        }
+        else {
+            UpdateMatrix();
+            m_matrix = m_localMatrix;
+        }
+
+        UpdateChildrenMatrices();
+
+        return m_matrix;
+    }
+
+    void Transform3D::UpdateChildrenMatrices() {
+        struct ChildrenBatch {
+            std::vector<Transform3D*> transforms;
+            std::vector<SR_MATH_NS::FVector3> translations;
+            std::vector<SR_MATH_NS::Quaternion> rotations;
+            std::vector<SR_MATH_NS::FVector3> scales;
+            std::vector<SR_MATH_NS::Matrix4x4> locals;
+            std::vector<SR_MATH_NS::Matrix4x4> matrices;
+        };
+
+        static thread_local ChildrenBatch batch;
 
-            if (auto&& pTransform = m_gameObject->GetParentTransform()) {
-                m_matrix = pTransform->GetMatrix() * m_localMatrix;
+        batch.transforms.clear();
+
+        for (auto&& pChild : m_gameObject->GetChildrenRef()) {
+            auto&& pTransform = pChild->GetTransform();
+            if (!pTransform || pTransform->GetMeasurement() != Measurement::Space3D) {
+                continue;
             }
-            else {
-                m_matrix = m_localMatrix;
+
+            if (auto&& pTransform3D = static_cast<Transform3D*>(pTransform); pTransform3D->IsDirty()) {
+                batch.transforms.emplace_back(pTransform3D);
             }
         }
 
-        return m_matrix;
+        /// одиночного ребенка нет смысла считать заранее, он пересчитается сам, когда понадобится
+        const uint64_t count = batch.transforms.size();
+        if (count < 2) {
+            return;
+        }
+
+        batch.translations.resize(count);
+        batch.rotations.resize(count);
+        batch.scales.resize(count);
+        batch.locals.resize(count);
+        batch.matrices.resize(count);
+
+        for (uint64_t i = 0; i < count; ++i) {
+            batch.translations[i] = batch.transforms[i]->m_translation;
+            batch.rotations[i] = batch.transforms[i]->m_quaternion;
+            batch.scales[i] = batch.transforms[i]->m_scale;
+        }
+
+        SR_MATH_NS::SIMD::ComposeTRS(batch.translations.data(), batch.rotations.data(), batch.scales.data(), batch.locals.data(), count);
+
+        /// ComposeTRS не знает про скос, такие матрицы собираются по одной
+        for (uint64_t i = 0; i < count; ++i) {
+            auto&& pTransform = batch.transforms[i];
+            auto&& skew = pTransform->m_skew;
+            if (skew.x != 1.f || skew.y != 1.f || skew.z != 1.f) {
+                batch.locals[i] = SR_MATH_NS::Matrix4x4(pTransform->m_translation, pTransform->m_quaternion, pTransform->m_scale, pTransform->m_skew);
+            }
+        }
+
+        SR_MATH_NS::SIMD::MultiplyMatrices(m_matrix, batch.locals.data(), batch.matrices.data(), count);
+
+        for (uint64_t i = 0; i < count; ++i) {
+            auto&& pTransform = batch.transforms[i];
+            pTransform->m_localMatrix = batch.locals[i];
+            pTransform->m_matrix = batch.matrices[i];
+            pTransform->Transform::UpdateMatrix();
+        }
     }
 
     void Transform3D::Translate(const SR_MATH_NS::FVector3& translation) {
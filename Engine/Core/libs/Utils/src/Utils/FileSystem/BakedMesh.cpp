@@ -0,0 +1,555 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Utils/FileSystem/BakedMesh.h>
+#include <Utils/FileSystem/Path.h>
+#include <Utils/Profile/TracyContext.h>
+
+namespace SR_UTILS_NS {
+    namespace {
+        uint64_t AlignBakedOffset(uint64_t offset) {
+            return (offset + BakedMesh::ALIGNMENT - 1) & ~(BakedMesh::ALIGNMENT - 1);
+        }
+
+        template<typename T> bool IsBakedRangeValid(uint64_t offset, uint64_t count, uint64_t size) {
+            if (count == 0) {
+                return offset <= size;
+            }
+
+            return offset % alignof(T) == 0 && offset <= size && count <= (size - offset) / sizeof(T);
+        }
+    }
+
+    BakedMesh BakedMesh::FromBlob(std::vector<uint64_t>&& blob) {
+        BakedMesh bakedMesh;
+        bakedMesh.m_blob = std::move(blob);
+
+        if (!bakedMesh.Validate()) {
+            bakedMesh.Clear();
+        }
+
+        return bakedMesh;
+    }
+
+    BakedMesh BakedMesh::Load(const Path& path) {
+        SR_TRACY_ZONE;
+
+        std::ifstream file(path.ToString(), std::ios::binary | std::ios::ate);
+        if (!file.is_open()) {
+            return BakedMesh();
+        }
+
+        const auto size = static_cast<uint64_t>(file.tellg());
+        if (size < sizeof(Header) || size % sizeof(uint64_t) != 0) {
+            SR_WARN("BakedMesh::Load() : file has invalid size!\n\tPath: " + path.ToString());
+            return BakedMesh();
+        }
+
+        std::vector<uint64_t> blob(size / sizeof(uint64_t));
+
+        file.seekg(0);
+        if (!file.read(reinterpret_cast<char*>(blob.data()), static_cast<std::streamsize>(size))) {
+            SR_WARN("BakedMesh::Load() : failed to read file!\n\tPath: " + path.ToString());
+            return BakedMesh();
+        }
+
+        auto&& bakedMesh = FromBlob(std::move(blob));
+        if (!bakedMesh.Valid()) {
+            SR_WARN("BakedMesh::Load() : file is corrupted or has an old version!\n\tPath: " + path.ToString());
+        }
+
+        return bakedMesh;
+    }
+
+    bool BakedMesh::Save(const Path& path) const {
+        if (!Valid() || !path.Make()) {
+            return false;
+        }
+
+        std::ofstream file(path.ToString(), std::ios::binary);
+        if (!file.is_open()) {
+            return false;
+        }
+
+        file.write(reinterpret_cast<const char*>(m_blob.data()), static_cast<std::streamsize>(GetHeader().size));
+
+        return file.good();
+    }
+
+    void BakedMesh::Clear() {
+        m_blob.clear();
+        m_blob.shrink_to_fit();
+    }
+
+    bool BakedMesh::Validate() const {
+        const uint64_t blobSize = m_blob.size() * sizeof(uint64_t);
+
+        if (blobSize < sizeof(Header)) {
+            return false;
+        }
+
+        auto&& header = GetHeader();
+
+        if (header.magic != MAGIC || header.version != VERSION || header.size != blobSize) {
+            return false;
+        }
+
+        const uint64_t size = header.size;
+
+        /// вершины не перебираются, но индексы и ссылки узлов проверяются целиком:
+        /// индекс за пределами вершин подмеша читал бы чужую память при отрисовке
+        if (!IsBakedRangeValid<Submesh>(header.submeshesOffset, header.submeshesCount, size) ||
+            !IsBakedRangeValid<BakedSkeletonBone>(header.skeletonOffset, header.skeletonCount, size) ||
+            !IsBakedRangeValid<Animation>(header.animationsOffset, header.animationsCount, size) ||
+            !IsBakedRangeValid<Channel>(header.channelsOffset, header.channelsCount, size) ||
+            !IsBakedRangeValid<char>(header.stringsOffset, header.stringsSize, size) ||
+            !IsBakedRangeValid<BakedNode>(header.nodesOffset, header.nodesCount, size) ||
+            !IsBakedRangeValid<uint32_t>(header.nodeIndicesOffset, header.nodeIndicesCount, size)
+        ) {
+            return false;
+        }
+
+        auto&& isStringValid = [&header](uint32_t offset, uint32_t stringSize) {
+            return static_cast<uint64_t>(offset) + stringSize <= header.stringsSize;
+        };
+
+        for (uint32_t i = 0; i < header.submeshesCount; ++i) {
+            auto&& submesh = GetSubmesh(i);
+
+            const bool isVerticesValid = submesh.skinned
+                ? IsBakedRangeValid<BakedSkinnedVertex>(submesh.vertexOffset, submesh.vertexCount, size)
+                : IsBakedRangeValid<BakedStaticVertex>(submesh.vertexOffset, submesh.vertexCount, size);
+
+            if (!isVerticesValid ||
+                !IsBakedRangeValid<uint32_t>(submesh.indexOffset, submesh.indexCount, size) ||
+                !IsBakedRangeValid<BakedBone>(submesh.bonesOffset, submesh.bonesCount, size) ||
+                !isStringValid(submesh.nameOffset, submesh.nameSize)
+            ) {
+                return false;
+            }
+
+            auto&& pIndices = GetIndices(i);
+            for (uint32_t index = 0; index < submesh.indexCount; ++index) {
+                if (pIndices[index] >= submesh.vertexCount) {
+                    return false;
+                }
+            }
+        }
+
+        auto&& pNodeIndices = GetNodeIndices();
+
+        for (uint32_t i = 0; i < header.nodesCount; ++i) {
+            auto&& node = GetNode(i);
+
+            if (static_cast<uint64_t>(node.meshesOffset) + node.meshesCount > header.nodeIndicesCount ||
+                static_cast<uint64_t>(node.childrenOffset) + node.childrenCount > header.nodeIndicesCount ||
+                !isStringValid(node.nameOffset, node.nameSize)
+            ) {
+                return false;
+            }
+
+            for (uint32_t mesh = 0; mesh < node.meshesCount; ++mesh) {
+                if (pNodeIndices[node.meshesOffset + mesh] >= header.submeshesCount) {
+                    return false;
+                }
+            }
+
+            /// ребенок всегда после родителя, поэтому обход иерархии не зациклится
+            for (uint32_t child = 0; child < node.childrenCount; ++child) {
+                const uint32_t childIndex = pNodeIndices[node.childrenOffset + child];
+                if (childIndex <= i || childIndex >= header.nodesCount) {
+                    return false;
+                }
+            }
+        }
+
+        for (uint32_t i = 0; i < header.animationsCount; ++i) {
+            auto&& animation = GetAnimation(i);
+
+            if (static_cast<uint64_t>(animation.firstChannel) + animation.channelsCount > header.channelsCount ||
+                !isStringValid(animation.nameOffset, animation.nameSize)
+            ) {
+                return false;
+            }
+        }
+
+        for (uint32_t i = 0; i < header.channelsCount; ++i) {
+            auto&& channel = GetChannel(i);
+
+            if (!IsBakedRangeValid<BakedVectorKey>(channel.positionKeysOffset, channel.positionKeysCount, size) ||
+                !IsBakedRangeValid<BakedQuatKey>(channel.rotationKeysOffset, channel.rotationKeysCount, size) ||
+                !IsBakedRangeValid<BakedVectorKey>(channel.scalingKeysOffset, channel.scalingKeysCount, size) ||
+                !isStringValid(channel.nameOffset, channel.nameSize)
+            ) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    std::string_view BakedMesh::GetString(uint32_t offset, uint32_t size) const {
+        return std::string_view(Section<char>(GetHeader().stringsOffset) + offset, size);
+    }
+
+    std::string_view BakedMesh::GetNodeName(uint32_t id) const {
+        auto&& node = GetNode(id);
+        return GetString(node.nameOffset, node.nameSize);
+    }
+
+    std::optional<float_t> BakedMesh::GetScaleFactor() const {
+        if (!Valid() || GetHeader().hasScaleFactor == 0) {
+            return std::nullopt;
+        }
+
+        return GetHeader().scaleFactor;
+    }
+
+    std::string_view BakedMesh::GetSubmeshName(uint32_t id) const {
+        auto&& submesh = GetSubmesh(id);
+        return GetString(submesh.nameOffset, submesh.nameSize);
+    }
+
+    int32_t BakedMesh::FindSubmesh(std::string_view name) const {
+        for (uint32_t i = 0; i < GetSubmeshesCount(); ++i) {
+            if (GetSubmeshName(i) == name) {
+                return static_cast<int32_t>(i);
+            }
+        }
+
+        return SR_ID_INVALID;
+    }
+
+    const BakedStaticVertex* BakedMesh::GetStaticVertices(uint32_t id) const {
+        auto&& submesh = GetSubmesh(id);
+        return submesh.skinned ? nullptr : Section<BakedStaticVertex>(submesh.vertexOffset);
+    }
+
+    const BakedSkinnedVertex* BakedMesh::GetSkinnedVertices(uint32_t id) const {
+        auto&& submesh = GetSubmesh(id);
+        return submesh.skinned ? Section<BakedSkinnedVertex>(submesh.vertexOffset) : nullptr;
+    }
+
+    std::vector<Vertex> BakedMesh::GetVertices(uint32_t id) const {
+        auto&& submesh = GetSubmesh(id);
+
+        std::vector<Vertex> vertices(submesh.vertexCount);
+
+        if (auto&& pStatic = GetStaticVertices(id)) {
+            for (uint32_t i = 0; i < submesh.vertexCount; ++i) {
+                vertices[i] = Vertex(pStatic[i].position, pStatic[i].uv, pStatic[i].normal, pStatic[i].tangent, pStatic[i].bitangent);
+            }
+
+            return vertices;
+        }
+
+        auto&& pSkinned = GetSkinnedVertices(id);
+
+        for (uint32_t i = 0; i < submesh.vertexCount; ++i) {
+            auto&& baked = pSkinned[i];
+            auto&& vertex = vertices[i];
+
+            vertex = Vertex(baked.position, baked.uv, baked.normal, baked.tangent, baked.bitangent);
+
+            for (uint32_t weight = 0; weight < SR_MAX_BONES_ON_VERTEX; ++weight) {
+                vertex.weights[weight].boneId = static_cast<uint32_t>(baked.weights[weight].x);
+                vertex.weights[weight].weight = baked.weights[weight].y;
+                vertex.weightsNum += baked.weights[weight].y > 0.f ? 1 : 0;
+            }
+        }
+
+        return vertices;
+    }
+
+    uint32_t BakedMeshBuilder::AddSubmesh(std::string name, const std::vector<Vertex>& vertices, std::vector<uint32_t> indices,
+        const ska::flat_hash_map<uint64_t, uint32_t>& bones
+    ) {
+        auto&& submesh = m_submeshes.emplace_back();
+
+        submesh.name = std::move(name);
+        submesh.indices = std::move(indices);
+
+        submesh.bones.reserve(bones.size());
+        for (auto&& [hash, index] : bones) {
+            submesh.bones.emplace_back(BakedBone { hash, index, 0 });
+        }
+
+        /// порядок обхода хеш-таблицы не определен, а файл должен быть одинаковым при одинаковых данных
+        std::sort(submesh.bones.begin(), submesh.bones.end(), [](const BakedBone& lhs, const BakedBone& rhs) {
+            return lhs.index < rhs.index;
+        });
+
+        float_t radiusSq = 0.f;
+
+        if (!vertices.empty()) {
+            submesh.bounds.min = vertices.front().position;
+            submesh.bounds.max = vertices.front().position;
+        }
+
+        for (auto&& vertex : vertices) {
+            auto&& position = vertex.position;
+
+            submesh.bounds.min = Vec3 { SR_MIN(submesh.bounds.min.x, position.x), SR_MIN(submesh.bounds.min.y, position.y), SR_MIN(submesh.bounds.min.z, position.z) };
+            submesh.bounds.max = Vec3 { SR_MAX(submesh.bounds.max.x, position.x), SR_MAX(submesh.bounds.max.y, position.y), SR_MAX(submesh.bounds.max.z, position.z) };
+
+            radiusSq = SR_MAX(radiusSq, position.x * position.x + position.y * position.y + position.z * position.z);
+        }
+
+        submesh.bounds.radius = std::sqrt(radiusSq);
+
+        if (submesh.bones.empty()) {
+            submesh.staticVertices.reserve(vertices.size());
+
+            for (auto&& vertex : vertices) {
+                submesh.staticVertices.emplace_back(BakedStaticVertex {
+                    vertex.position, vertex.uv, vertex.normal, vertex.tangent, vertex.bitangent
+                });
+            }
+        }
+        else {
+            submesh.skinnedVertices.reserve(vertices.size());
+
+            for (auto&& vertex : vertices) {
+                auto&& baked = submesh.skinnedVertices.emplace_back(BakedSkinnedVertex {
+                    vertex.position, vertex.uv, vertex.normal, vertex.tangent, vertex.bitangent, { }
+                });
+
+                for (uint32_t weight = 0; weight < SR_MAX_BONES_ON_VERTEX; ++weight) {
+                    baked.weights[weight].x = static_cast<float_t>(vertex.weights[weight].boneId);
+                    baked.weights[weight].y = vertex.weights[weight].weight;
+                }
+            }
+        }
+
+        return static_cast<uint32_t>(m_submeshes.size() - 1);
+    }
+
+    void BakedMeshBuilder::AddSkeletonBone(uint64_t hash, uint32_t index, const SR_MATH_NS::Matrix4x4& offset) {
+        auto&& bone = m_skeleton.emplace_back();
+        bone.hash = hash;
+        bone.index = index;
+        std::memcpy(bone.offset, &offset.self, sizeof(bone.offset));
+    }
+
+    uint32_t BakedMeshBuilder::AddNode(std::string name, int32_t parent, const Vec3& translation, const Vec3& rotation, const Vec3& scaling,
+        std::vector<uint32_t> meshes
+    ) {
+        const auto index = static_cast<uint32_t>(m_nodes.size());
+
+        if (parent != SR_ID_INVALID) {
+            if (parent < 0 || static_cast<uint32_t>(parent) >= index) {
+                SRHalt("BakedMeshBuilder::AddNode() : parent must be added before the node!");
+                return index;
+            }
+
+            m_nodes[parent].children.emplace_back(index);
+        }
+        else {
+            SRAssert2(index == 0, "BakedMeshBuilder::AddNode() : only the first node can be the root!");
+        }
+
+        auto&& node = m_nodes.emplace_back();
+        node.name = std::move(name);
+        node.node.translation = translation;
+        node.node.rotation = rotation;
+        node.node.scaling = scaling;
+        node.meshes = std::move(meshes);
+
+        return index;
+    }
+
+    uint32_t BakedMeshBuilder::AddAnimation(std::string name, double_t duration, double_t ticksPerSecond) {
+        auto&& animation = m_animations.emplace_back();
+        animation.name = std::move(name);
+        animation.duration = duration;
+        animation.ticksPerSecond = ticksPerSecond;
+        return static_cast<uint32_t>(m_animations.size() - 1);
+    }
+
+    void BakedMeshBuilder::AddChannel(std::string name, uint32_t preState, uint32_t postState,
+        std::vector<BakedVectorKey> positionKeys, std::vector<BakedQuatKey> rotationKeys, std::vector<BakedVectorKey> scalingKeys
+    ) {
+        if (m_animations.empty()) {
+            SRHalt("BakedMeshBuilder::AddChannel() : there is no animation!");
+            return;
+        }
+
+        m_animations.back().channels.emplace_back(ChannelData {
+            std::move(name), preState, postState, std::move(positionKeys), std::move(rotationKeys), std::move(scalingKeys)
+        });
+    }
+
+    BakedMesh BakedMeshBuilder::Build(uint64_t sourceHash) const {
+        SR_TRACY_ZONE;
+
+        BakedMesh::Header header;
+        header.sourceHash = sourceHash;
+        header.submeshesCount = static_cast<uint32_t>(m_submeshes.size());
+        header.skeletonCount = static_cast<uint32_t>(m_skeleton.size());
+        header.animationsCount = static_cast<uint32_t>(m_animations.size());
+
+        for (auto&& animation : m_animations) {
+            header.channelsCount += static_cast<uint32_t>(animation.channels.size());
+        }
+
+        uint64_t offset = AlignBakedOffset(sizeof(BakedMesh::Header));
+
+        auto&& reserve = [&offset](uint64_t bytes) {
+            const uint64_t sectionOffset = offset;
+            offset = AlignBakedOffset(offset + bytes);
+            return sectionOffset;
+        };
+
+        header.submeshesOffset = reserve(m_submeshes.size() * sizeof(BakedMesh::Submesh));
+        header.skeletonOffset = reserve(m_skeleton.size() * sizeof(BakedSkeletonBone));
+        header.animationsOffset = reserve(m_animations.size() * sizeof(BakedMesh::Animation));
+        header.channelsOffset = reserve(header.channelsCount * sizeof(BakedMesh::Channel));
+
+        header.nodesCount = static_cast<uint32_t>(m_nodes.size());
+        header.nodesOffset = reserve(m_nodes.size() * sizeof(BakedNode));
+
+        if (m_scaleFactor.has_value()) {
+            header.scaleFactor = m_scaleFactor.value();
+            header.hasScaleFactor = 1;
+        }
+
+        std::string strings;
+
+        auto&& addString = [&strings](const std::string& string, uint32_t& stringOffset, uint32_t& stringSize) {
+            stringOffset = static_cast<uint32_t>(strings.size());
+            stringSize = static_cast<uint32_t>(string.size());
+            strings += string;
+        };
+
+        std::vector<BakedMesh::Submesh> submeshes(m_submeshes.size());
+
+        for (uint32_t i = 0; i < static_cast<uint32_t>(m_submeshes.size()); ++i) {
+            auto&& data = m_submeshes[i];
+            auto&& submesh = submeshes[i];
+
+            submesh.skinned = data.bones.empty() ? 0 : 1;
+            submesh.vertexCount = static_cast<uint32_t>(submesh.skinned ? data.skinnedVertices.size() : data.staticVertices.size());
+            submesh.indexCount = static_cast<uint32_t>(data.indices.size());
+            submesh.bonesCount = static_cast<uint32_t>(data.bones.size());
+            submesh.bounds = data.bounds;
+
+            submesh.vertexOffset = reserve(submesh.skinned
+                ? data.skinnedVertices.size() * sizeof(BakedSkinnedVertex)
+                : data.staticVertices.size() * sizeof(BakedStaticVertex)
+            );
+            submesh.indexOffset = reserve(data.indices.size() * sizeof(uint32_t));
+            submesh.bonesOffset = reserve(data.bones.size() * sizeof(BakedBone));
+
+            addString(data.name, submesh.nameOffset, submesh.nameSize);
+        }
+
+        std::vector<BakedMesh::Animation> animations(m_animations.size());
+        std::vector<BakedMesh::Channel> channels;
+        std::vector<const ChannelData*> channelsData;
+
+        channels.reserve(header.channelsCount);
+        channelsData.reserve(header.channelsCount);
+
+        for (uint32_t i = 0; i < static_cast<uint32_t>(m_animations.size()); ++i) {
+            auto&& data = m_animations[i];
+            auto&& animation = animations[i];
+
+            animation.duration = data.duration;
+            animation.ticksPerSecond = data.ticksPerSecond;
+            animation.firstChannel = static_cast<uint32_t>(channels.size());
+            animation.channelsCount = static_cast<uint32_t>(data.channels.size());
+
+            addString(data.name, animation.nameOffset, animation.nameSize);
+
+            for (auto&& channelData : data.channels) {
+                auto&& channel = channels.emplace_back();
+
+                channel.preState = channelData.preState;
+                channel.postState = channelData.postState;
+                channel.positionKeysCount = static_cast<uint32_t>(channelData.positionKeys.size());
+                channel.rotationKeysCount = static_cast<uint32_t>(channelData.rotationKeys.size());
+                channel.scalingKeysCount = static_cast<uint32_t>(channelData.scalingKeys.size());
+
+                channel.positionKeysOffset = reserve(channelData.positionKeys.size() * sizeof(BakedVectorKey));
+                channel.rotationKeysOffset = reserve(channelData.rotationKeys.size() * sizeof(BakedQuatKey));
+                channel.scalingKeysOffset = reserve(channelData.scalingKeys.size() * sizeof(BakedVectorKey));
+
+                addString(channelData.name, channel.nameOffset, channel.nameSize);
+
+                channelsData.emplace_back(&channelData);
+            }
+        }
+
+        std::vector<BakedNode> nodes(m_nodes.size());
+        std::vector<uint32_t> nodeIndices;
+
+        for (uint32_t i = 0; i < static_cast<uint32_t>(m_nodes.size()); ++i) {
+            auto&& data = m_nodes[i];
+            auto&& node = nodes[i];
+
+            node = data.node;
+
+            node.meshesOffset = static_cast<uint32_t>(nodeIndices.size());
+            node.meshesCount = static_cast<uint32_t>(data.meshes.size());
+            nodeIndices.insert(nodeIndices.end(), data.meshes.begin(), data.meshes.end());
+
+            node.childrenOffset = static_cast<uint32_t>(nodeIndices.size());
+            node.childrenCount = static_cast<uint32_t>(data.children.size());
+            nodeIndices.insert(nodeIndices.end(), data.children.begin(), data.children.end());
+
+            addString(data.name, node.nameOffset, node.nameSize);
+        }
+
+        header.nodeIndicesCount = static_cast<uint32_t>(nodeIndices.size());
+        header.nodeIndicesOffset = reserve(nodeIndices.size() * sizeof(uint32_t));
+
+        header.stringsSize = strings.size();
+        header.stringsOffset = reserve(strings.size());
+        header.size = offset;
+
+        std::vector<uint64_t> blob(header.size / sizeof(uint64_t), 0);
+        auto&& pData = reinterpret_cast<char*>(blob.data());
+
+        auto&& write = [pData](uint64_t sectionOffset, const void* pSource, uint64_t bytes) {
+            if (bytes > 0) {
+                std::memcpy(pData + sectionOffset, pSource, bytes);
+            }
+        };
+
+        write(0, &header, sizeof(header));
+        write(header.submeshesOffset, submeshes.data(), submeshes.size() * sizeof(BakedMesh::Submesh));
+        write(header.skeletonOffset, m_skeleton.data(), m_skeleton.size() * sizeof(BakedSkeletonBone));
+        write(header.animationsOffset, animations.data(), animations.size() * sizeof(BakedMesh::Animation));
+        write(header.channelsOffset, channels.data(), channels.size() * sizeof(BakedMesh::Channel));
+        write(header.stringsOffset, strings.data(), strings.size());
+        write(header.nodesOffset, nodes.data(), nodes.size() * sizeof(BakedNode));
+        write(header.nodeIndicesOffset, nodeIndices.data(), nodeIndices.size() * sizeof(uint32_t));
+
+        for (uint32_t i = 0; i < static_cast<uint32_t>(m_submeshes.size()); ++i) {
+            auto&& data = m_submeshes[i];
+            auto&& submesh = submeshes[i];
+
+            if (submesh.skinned) {
+                write(submesh.vertexOffset, data.skinnedVertices.data(), data.skinnedVertices.size() * sizeof(BakedSkinnedVertex));
+            }
+            else {
+                write(submesh.vertexOffset, data.staticVertices.data(), data.staticVertices.size() * sizeof(BakedStaticVertex));
+            }
+
+            write(submesh.indexOffset, data.indices.data(), data.indices.size() * sizeof(uint32_t));
+            write(submesh.bonesOffset, data.bones.data(), data.bones.size() * sizeof(BakedBone));
+        }
+
+        for (uint32_t i = 0; i < static_cast<uint32_t>(channels.size()); ++i) {
+            auto&& channel = channels[i];
+            auto&& data = *channelsData[i];
+
+            write(channel.positionKeysOffset, data.positionKeys.data(), data.positionKeys.size() * sizeof(BakedVectorKey));
+            write(channel.rotationKeysOffset, data.rotationKeys.data(), data.rotationKeys.size() * sizeof(BakedQuatKey));
+            write(channel.scalingKeysOffset, data.scalingKeys.data(), data.scalingKeys.size() * sizeof(BakedVectorKey));
+        }
+
+        return BakedMesh::FromBlob(std::move(blob));
+    }
+}
@@ -0,0 +1,305 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Utils/Input/EvdevInputSource.h>
+
+#include <filesystem>
+
+#include <linux/input.h>
+#include <sys/ioctl.h>
+#include <poll.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#ifndef input_event_sec
+    #define input_event_sec time.tv_sec
+    #define input_event_usec time.tv_usec
+#endif
+
+namespace SR_UTILS_NS {
+    namespace {
+        bool TestBit(const std::vector<uint8_t>& bits, uint32_t bit) {
+            return (bits[bit / 8] >> (bit % 8)) & 1;
+        }
+    }
+
+    EvdevInputSource::~EvdevInputSource() {
+        Close();
+    }
+
+    bool EvdevInputSource::Open() {
+        if (m_thread) {
+            return true;
+        }
+
+        static_assert(KEY_CODES_COUNT == KEY_CNT);
+
+        std::vector<int32_t> devices;
+        std::vector<uint8_t> keyBits((KEY_MAX + 7) / 8);
+
+        /// устройства символьные, поэтому GetInDirectory их не видит
+        std::error_code errorCode;
+        for (auto&& entry : std::filesystem::directory_iterator("/dev/input", errorCode)) {
+            if (entry.path().filename().string().rfind("event", 0) != 0) {
+                continue;
+            }
+
+            const int32_t fd = open(entry.path().c_str(), O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+            if (fd < 0) {
+                continue;
+            }
+
+            std::fill(keyBits.begin(), keyBits.end(), 0);
+
+            /// только клавиатуры и мыши, джойстики и прочие устройства с кнопками пропускаем
+            const bool isKeyDevice = ioctl(fd, EVIOCGBIT(EV_KEY, keyBits.size()), keyBits.data()) >= 0
+                && (TestBit(keyBits, KEY_A) || TestBit(keyBits, BTN_LEFT));
+
+            int32_t clock = CLOCK_MONOTONIC;
+            if (!isKeyDevice || ioctl(fd, EVIOCSCLOCKID, &clock) < 0) {
+                close(fd);
+                continue;
+            }
+
+            devices.emplace_back(fd);
+        }
+
+        if (devices.empty()) {
+            SR_WARN("EvdevInputSource::Open() : no readable input devices found!");
+            return false;
+        }
+
+        return Open(std::move(devices));
+    }
+
+    bool EvdevInputSource::Open(std::vector<int32_t> devices) {
+        if (m_thread) {
+            for (auto&& fd : devices) {
+                close(fd);
+            }
+            return false;
+        }
+
+        for (auto&& fd : devices) {
+            m_devices.emplace_back(Device { fd });
+        }
+
+        if (pipe2(m_wakeup, O_CLOEXEC) < 0) {
+            SR_ERROR("EvdevInputSource::Open() : failed to create wakeup pipe!");
+            Close();
+            return false;
+        }
+
+        SR_LOG("EvdevInputSource::Open() : opened " + std::to_string(m_devices.size()) + " devices");
+
+        m_thread = SR_HTYPES_NS::Thread::Factory::Instance().Create(&EvdevInputSource::ReadThread, this);
+        m_thread->SetName("Input");
+
+        return true;
+    }
+
+    void EvdevInputSource::Close() {
+        if (m_thread) {
+            const char signal = 0;
+            SR_UNUSED_VARIABLE(write(m_wakeup[1], &signal, sizeof(signal)));
+            m_thread->TryJoin();
+            m_thread->Free();
+            m_thread = nullptr;
+        }
+
+        for (auto&& device : m_devices) {
+            close(device.fd);
+        }
+        m_devices.clear();
+
+        std::fill(std::begin(m_pressedCount), std::end(m_pressedCount), 0);
+
+        for (auto&& fd : m_wakeup) {
+            if (fd >= 0) {
+                close(fd);
+                fd = -1;
+            }
+        }
+    }
+
+    void EvdevInputSource::ReadThread() {
+        std::vector<pollfd> fds = { pollfd { m_wakeup[0], POLLIN, 0 } };
+        for (auto&& device : m_devices) {
+            fds.emplace_back(pollfd { device.fd, POLLIN, 0 });
+        }
+
+        while (true) {
+            if (poll(fds.data(), fds.size(), -1) < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                SR_ERROR("EvdevInputSource::ReadThread() : poll failed with error " + std::to_string(errno));
+                return;
+            }
+
+            if (fds.front().revents != 0) {
+                return;
+            }
+
+            for (uint64_t i = 1; i < fds.size(); ++i) {
+                auto&& device = m_devices[i - 1];
+
+                /// вместе с отключением могут прийти еще непрочитанные события
+                if (fds[i].revents & POLLIN) {
+                    ReadDevice(device);
+                }
+
+                if (fds[i].revents & (POLLERR | POLLHUP | POLLNVAL)) {
+                    /// устройство отключено, poll пропускает отрицательные дескрипторы.
+                    /// Его клавиши больше не придут, поэтому отпускаем их сразу
+                    fds[i].fd = -1;
+
+                    for (uint16_t code = 0; code < KEY_CNT; ++code) {
+                        SetKeyState(device, code, false, GetInputTimestamp());
+                    }
+                }
+            }
+        }
+    }
+
+    void EvdevInputSource::ReadDevice(Device& device) {
+        input_event events[64];
+
+        ssize_t size;
+        while ((size = read(device.fd, events, sizeof(events))) > 0) {
+            for (uint64_t i = 0; i < static_cast<uint64_t>(size) / sizeof(input_event); ++i) {
+                auto&& event = events[i];
+
+                const InputTimestamp timestamp = static_cast<InputTimestamp>(event.input_event_sec) * 1000000000ull
+                    + static_cast<InputTimestamp>(event.input_event_usec) * 1000ull;
+
+                /// после переполнения буфера ядра пакет до SYN_REPORT неполный, состояние берем у ядра
+                if (event.type == EV_SYN) {
+                    if (event.code == SYN_DROPPED) {
+                        device.isDropped = true;
+                    }
+                    else if (device.isDropped && event.code == SYN_REPORT) {
+                        device.isDropped = false;
+                        SyncDevice(device, timestamp);
+                    }
+                    continue;
+                }
+
+                /// value 2 - автоповтор, удержание отслеживает сам Input
+                if (device.isDropped || event.type != EV_KEY || event.value == 2) {
+                    continue;
+                }
+
+                SetKeyState(device, event.code, event.value == 1, timestamp);
+            }
+        }
+    }
+
+    void EvdevInputSource::SyncDevice(Device& device, InputTimestamp timestamp) {
+        std::vector<uint8_t> keyBits((KEY_MAX + 7) / 8);
+        if (ioctl(device.fd, EVIOCGKEY(keyBits.size()), keyBits.data()) < 0) {
+            return;
+        }
+
+        for (uint16_t code = 0; code < KEY_CNT; ++code) {
+            SetKeyState(device, code, TestBit(keyBits, code), timestamp);
+        }
+    }
+
+    void EvdevInputSource::SetKeyState(Device& device, uint16_t code, bool isPressed, InputTimestamp timestamp) {
+        if (code >= KEY_CNT || device.pressed.test(code) == isPressed) {
+            return;
+        }
+
+        device.pressed.set(code, isPressed);
+
+        const KeyCode key = TranslateKey(code);
+        if (key == KeyCode::None) {
+            return;
+        }
+
+        /// событие только на первое нажатие и последнее отпускание среди клавиш с этим KeyCode
+        auto&& count = m_pressedCount[static_cast<uint8_t>(key)];
+        if (isPressed ? count++ != 0 : --count != 0) {
+            return;
+        }
+
+        Emit(RawInputEvent { timestamp, key, isPressed });
+    }
+
+    KeyCode EvdevInputSource::TranslateKey(uint16_t code) {
+        switch (code) {
+            case BTN_LEFT: return KeyCode::MouseLeft;
+            case BTN_RIGHT: return KeyCode::MouseRight;
+            case BTN_MIDDLE: return KeyCode::MouseMiddle;
+            case KEY_BACKSPACE: return KeyCode::BackSpace;
+            case KEY_TAB: return KeyCode::Tab;
+            case KEY_ENTER: case KEY_KPENTER: return KeyCode::Enter;
+            case KEY_LEFTSHIFT: case KEY_RIGHTSHIFT: return KeyCode::LShift;
+            case KEY_LEFTCTRL: case KEY_RIGHTCTRL: return KeyCode::Ctrl;
+            case KEY_LEFTALT: case KEY_RIGHTALT: return KeyCode::Alt;
+            case KEY_ESC: return KeyCode::Esc;
+            case KEY_SPACE: return KeyCode::Space;
+            case KEY_LEFT: return KeyCode::LeftArrow;
+            case KEY_UP: return KeyCode::UpArrow;
+            case KEY_RIGHT: return KeyCode::RightArrow;
+            case KEY_DOWN: return KeyCode::DownArrow;
+            case KEY_DELETE: return KeyCode::Del;
+            case KEY_0: return KeyCode::_0;
+            case KEY_1: return KeyCode::_1;
+            case KEY_2: return KeyCode::_2;
+            case KEY_3: return KeyCode::_3;
+            case KEY_4: return KeyCode::_4;
+            case KEY_5: return KeyCode::_5;
+            case KEY_6: return KeyCode::_6;
+            case KEY_7: return KeyCode::_7;
+            case KEY_8: return KeyCode::_8;
+            case KEY_9: return KeyCode::_9;
+            case KEY_A: return KeyCode::A;
+            case KEY_B: return KeyCode::B;
+            case KEY_C: return KeyCode::C;
+            case KEY_D: return KeyCode::D;
+            case KEY_E: return KeyCode::E;
+            case KEY_F: return KeyCode::F;
+            case KEY_G: return KeyCode::G;
+            case KEY_H: return KeyCode::H;
+            case KEY_I: return KeyCode::I;
+            case KEY_J: return KeyCode::J;
+            case KEY_K: return KeyCode::K;
+            case KEY_L: return KeyCode::L;
+            case KEY_M: return KeyCode::M;
+            case KEY_N: return KeyCode::N;
+            case KEY_O: return KeyCode::O;
+            case KEY_P: return KeyCode::P;
+            case KEY_Q: return KeyCode::Q;
+            case KEY_R: return KeyCode::R;
+            case KEY_S: return KeyCode::S;
+            case KEY_T: return KeyCode::T;
+            case KEY_U: return KeyCode::U;
+            case KEY_V: return KeyCode::V;
+            case KEY_W: return KeyCode::W;
+            case KEY_X: return KeyCode::X;
+            case KEY_Y: return KeyCode::Y;
+            case KEY_Z: return KeyCode::Z;
+            case KEY_F1: return KeyCode::F1;
+            case KEY_F2: return KeyCode::F2;
+            case KEY_F3: return KeyCode::F3;
+            case KEY_F4: return KeyCode::F4;
+            case KEY_F5: return KeyCode::F5;
+            case KEY_F6: return KeyCode::F6;
+            case KEY_F7: return KeyCode::F7;
+            case KEY_F8: return KeyCode::F8;
+            case KEY_F9: return KeyCode::F9;
+            case KEY_F10: return KeyCode::F10;
+            case KEY_F11: return KeyCode::F11;
+            case KEY_F12: return KeyCode::F12;
+            case KEY_EQUAL: return KeyCode::Plus;
+            case KEY_MINUS: return KeyCode::Minus;
+            case KEY_DOT: return KeyCode::Dot;
+            case KEY_GRAVE: return KeyCode::Tilde;
+            default:
+                return KeyCode::None;
+        }
+    }
+}
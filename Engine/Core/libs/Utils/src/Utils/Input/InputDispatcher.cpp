@@ -19,6 +19,46 @@ namespace SR_UTILS_NS {
         SR_SAFE_DELETE_PTR(m_mouseData);
     }
 
+    void InputDispatcher::Register(InputHandler* pHandler) {
+        if (!pHandler) {
+            return;
+        }
+
+        Subscription subscription;
+        subscription.pHandler = pHandler;
+
+        subscription.keyboard = m_dispatcher.Subscribe<KeyboardInputData>(pHandler, [](void* pObject, const KeyboardInputData& data) {
+            static_cast<InputHandler*>(pObject)->TriggerKeyboard(&data);
+        });
+
+        subscription.mouse = m_dispatcher.Subscribe<MouseInputData>(pHandler, [](void* pObject, const MouseInputData& data) {
+            static_cast<InputHandler*>(pObject)->TriggerMouse(&data);
+        });
+
+        m_subscriptions.emplace_back(subscription);
+    }
+
+    void InputDispatcher::Unregister(InputHandler* pHandler) {
+        for (auto pIt = m_subscriptions.begin(); pIt != m_subscriptions.end(); ++pIt) {
+            if (pIt->pHandler != pHandler) {
+                continue;
+            }
+
+            m_dispatcher.Unsubscribe<KeyboardInputData>(pIt->keyboard);
+            m_dispatcher.Unsubscribe<MouseInputData>(pIt->mouse);
+            m_subscriptions.erase(pIt);
+            return;
+        }
+
+        SRHalt("InputDispatcher::Unregister() : handler is not registered!");
+    }
+
+    void InputDispatcher::UnregisterAll() {
+        m_dispatcher.UnsubscribeAll();
+        m_subscriptions.clear();
+        Super::UnregisterAll();
+    }
+
     void InputDispatcher::Check() {
         SR_TRACY_ZONE;
         CheckKeyboard();
@@ -45,7 +85,7 @@ namespace SR_UTILS_NS {
 
             m_keyboardData->m_code = code;
 
-            Dispatch<InputHandler>(dynamic_cast<InputDeviceData*>(m_keyboardData));
+            m_dispatcher.Dispatch(*m_keyboardData);
         }
     }
 
@@ -72,7 +112,7 @@ namespace SR_UTILS_NS {
             m_mouseData->m_position = input.GetMousePos();
             m_mouseData->m_prevPos = input.GetPrevMousePos();
 
-            Dispatch<InputHandler>(dynamic_cast<InputDeviceData*>(m_mouseData));
+            m_dispatcher.Dispatch(*m_mouseData);
         }
     }
 }
@@ -20,7 +20,7 @@ namespace SR_UTILS_NS {
         }
     }
 
-    void InputHandler::TriggerKeyboard(KeyboardInputData *keyboardInputData) {
+    void InputHandler::TriggerKeyboard(const KeyboardInputData* keyboardInputData) {
         if (!keyboardInputData) {
             return;
         }
@@ -41,7 +41,7 @@ namespace SR_UTILS_NS {
         }
     }
 
-    void InputHandler::TriggerMouse(MouseInputData *mouseInputData) {
+    void InputHandler::TriggerMouse(const MouseInputData* mouseInputData) {
         if (!mouseInputData) {
             return;
         }
@@ -0,0 +1,45 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Utils/Input/InputSource.h>
+
+namespace SR_UTILS_NS {
+    InputTimestamp GetInputTimestamp() {
+        return static_cast<InputTimestamp>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()
+        ).count());
+    }
+
+    bool SyntheticInputSource::Press(KeyCode key, InputTimestamp timestamp) {
+        return Emit(RawInputEvent { timestamp == 0 ? GetInputTimestamp() : timestamp, key, true });
+    }
+
+    bool SyntheticInputSource::Release(KeyCode key, InputTimestamp timestamp) {
+        return Emit(RawInputEvent { timestamp == 0 ? GetInputTimestamp() : timestamp, key, false });
+    }
+
+    bool PolledInputSource::Open() {
+        std::fill(std::begin(m_isPressed), std::end(m_isPressed), false);
+        return true;
+    }
+
+    void PolledInputSource::Poll(InputTimestamp now) {
+        uint8_t keys[256] = { };
+        if (!ReadKeyboardState(keys)) {
+            return;
+        }
+
+        for (uint16_t i = 1; i < 256; ++i) {
+            const bool isPressed = keys[i] >> 7 != 0;
+            if (isPressed == m_isPressed[i]) {
+                continue;
+            }
+
+            /// при переполнении очереди изменение повторится при следующем опросе
+            if (Emit(RawInputEvent { now, static_cast<KeyCode>(i), isPressed })) {
+                m_isPressed[i] = isPressed;
+            }
+        }
+    }
+}
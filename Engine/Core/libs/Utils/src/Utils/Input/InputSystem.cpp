@@ -5,6 +5,7 @@
 #include <Utils/Input/InputSystem.h>
 #include <Utils/Platform/Platform.h>
 #include <Utils/Profile/TracyContext.h>
+#include <Utils/Profile/FrameRecorder.h>
 
 #ifdef SR_WIN32
     #include <Windows.h>
@@ -25,11 +26,18 @@ namespace SR_UTILS_NS {
         m_mousePrev = m_mouse;
         m_mouse = SR_PLATFORM_NS::GetMousePos();
 
+        /// при воспроизведении курсор подменяется записанным
+        const bool isSources = CheckSources();
+
         m_mouseDrag = m_mouse - m_mousePrev;
 
+        if (isSources) {
+            return;
+        }
+
         if (!m_arr) {
             m_arr = new uint8_t[256];
-            memset(m_arr, 0, sizeof(256));
+            memset(m_arr, 0, 256);
         }
 
     #ifdef SR_WIN32
@@ -75,6 +83,162 @@ namespace SR_UTILS_NS {
         }
     }
 
+    bool Input::CheckSources() {
+        std::lock_guard lock(m_sourcesMutex);
+
+        auto&& recorder = FrameRecorder::Instance();
+
+        /// воспроизведение не требует устройств, ввод целиком берется из записи
+        if (m_sources.empty() && !recorder.IsReplaying()) {
+            return false;
+        }
+
+        const InputTimestamp now = GetInputTimestamp();
+        const InputTimestamp reloadTimestamp = m_reloadTimestamp;
+
+        for (uint16_t i = 0; i < 256; ++i) {
+            switch (m_keys[i]) {
+                case State::Down:
+                    if (m_pendingRelease[i] != 0) {
+                        m_keys[i] = State::Up;
+                        m_keyTimestamps[i] = m_pendingRelease[i];
+                        m_pendingRelease[i] = 0;
+                    }
+                    else {
+                        m_keys[i] = State::Pressed;
+                    }
+                    break;
+                case State::Up:
+                    if (m_pendingPress[i] != 0) {
+                        m_keys[i] = State::Down;
+                        m_keyTimestamps[i] = m_pendingPress[i];
+                        m_pendingPress[i] = 0;
+                    }
+                    else {
+                        m_keys[i] = State::UnPressed;
+                    }
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        m_events.clear();
+
+        for (auto&& pSource : m_sources) {
+            pSource->Poll(now);
+            pSource->Flush([this, reloadTimestamp](const RawInputEvent& event) {
+                if (event.timestamp >= reloadTimestamp) {
+                    m_events.emplace_back(event);
+                }
+            });
+        }
+
+        /// источники пишут независимо, общий порядок восстанавливается по времени
+        std::stable_sort(m_events.begin(), m_events.end(), [](const RawInputEvent& a, const RawInputEvent& b) {
+            return a.timestamp < b.timestamp;
+        });
+
+        recorder.ScheduleInput(m_events, m_mouse, m_mouseScroll, now);
+
+        m_latency = m_events.empty() || m_events.front().timestamp > now ? 0 : now - m_events.front().timestamp;
+
+        for (auto&& event : m_events) {
+            ApplyEvent(event);
+        }
+
+        return true;
+    }
+
+    void Input::ApplyEvent(const RawInputEvent& event) {
+        const uint8_t id = static_cast<uint8_t>(event.key);
+        if (event.key == KeyCode::None) {
+            return;
+        }
+
+        auto&& state = m_keys[id];
+
+        if (event.pressed) {
+            switch (state) {
+                case State::UnPressed:
+                    state = State::Down;
+                    m_keyTimestamps[id] = event.timestamp;
+                    break;
+                case State::Up:
+                    /// Up этого кадра не перезаписывается, нажатие применяется в следующем
+                    if (m_pendingPress[id] == 0) {
+                        m_pendingPress[id] = event.timestamp;
+                    }
+                    else {
+                        m_pendingRelease[id] = 0;
+                    }
+                    break;
+                case State::Down:
+                    /// отпущена и снова нажата в одном кадре - клавиша остается зажатой
+                    m_pendingRelease[id] = 0;
+                    break;
+                case State::Pressed:
+                    break;
+            }
+            return;
+        }
+
+        switch (state) {
+            case State::Down:
+                m_pendingRelease[id] = event.timestamp;
+                break;
+            case State::Pressed:
+                state = State::Up;
+                m_keyTimestamps[id] = event.timestamp;
+                break;
+            case State::Up:
+                /// отпускание после отложенного нажатия - Down и Up в следующих двух кадрах
+                if (m_pendingPress[id] != 0) {
+                    m_pendingRelease[id] = event.timestamp;
+                }
+                break;
+            default:
+                break;
+        }
+    }
+
+    bool Input::AddSource(std::unique_ptr<InputSource>&& pSource) {
+        if (!pSource) {
+            return false;
+        }
+
+        if (!pSource->Open()) {
+            SR_WARN("Input::AddSource() : failed to open input source \"" + std::string(pSource->GetName()) + "\"");
+            return false;
+        }
+
+        SR_LOG("Input::AddSource() : input source \"" + std::string(pSource->GetName()) + "\" added");
+
+        std::lock_guard lock(m_sourcesMutex);
+        m_sources.emplace_back(std::move(pSource));
+
+        return true;
+    }
+
+    void Input::ClearSources() {
+        std::lock_guard lock(m_sourcesMutex);
+
+        for (auto&& pSource : m_sources) {
+            if (pSource->GetDroppedCount() > 0) {
+                SR_WARN("Input::ClearSources() : input source \"" + std::string(pSource->GetName()) + "\" dropped "
+                    + std::to_string(pSource->GetDroppedCount()) + " events");
+            }
+            pSource->Close();
+        }
+
+        m_sources.clear();
+    }
+
+    bool Input::HasSources() const {
+        std::lock_guard lock(m_sourcesMutex);
+        return !m_sources.empty();
+    }
+
     bool Input::GetKeyDown(KeyCode key) {
         return m_keys[(int)key] == State::Down;
     }
@@ -96,9 +260,18 @@ namespace SR_UTILS_NS {
     }
 
     int32_t Input::DebugKey() {
+        if (HasSources()) {
+            for (uint16_t i = 0; i < 256; ++i) {
+                if (m_keys[i] == State::Down || m_keys[i] == State::Pressed) {
+                    return i;
+                }
+            }
+            return -1;
+        }
+
         if (!m_arr) {
             m_arr = new uint8_t[256];
-            memset(m_arr, 0, sizeof(256));
+            memset(m_arr, 0, 256);
         }
 
     #ifdef SR_WIN32
@@ -122,6 +295,10 @@ namespace SR_UTILS_NS {
             key = State::UnPressed;
         }
 
+        std::fill(std::begin(m_keyTimestamps), std::end(m_keyTimestamps), 0);
+        std::fill(std::begin(m_pendingRelease), std::end(m_pendingRelease), 0);
+        std::fill(std::begin(m_pendingPress), std::end(m_pendingPress), 0);
+
         ResetMouse();
     }
 
@@ -131,6 +308,7 @@ namespace SR_UTILS_NS {
     }
 
     void Input::Reload() {
+        m_reloadTimestamp = GetInputTimestamp();
         m_init = false;
         Reset();
     }
@@ -3,6 +3,7 @@
 //
 
 #include <Utils/Math/Noise.h>
+#include <Utils/Math/SIMDPacked.h>
 
 namespace SR_MATH_NS {
     double_t SNoise(double_t x, double_t y) {
@@ -16,4 +17,319 @@ namespace SR_MATH_NS {
     double_t SNoise(double_t x, double_t y, double_t z, double_t t) {
         return NoiseTemplate(TableIndex4D, x, y, z, t);
     }
-}
\ No newline at end of file
+
+    double_t FractalNoise(double_t x, double_t y, const NoiseParams& params) {
+        double_t result = 0.0;
+        double_t frequency = params.frequency;
+        double_t amplitude = params.amplitude;
+
+        for (uint32_t octave = 0; octave < params.octaves; ++octave) {
+            result += SNoise(x * frequency, y * frequency) * amplitude;
+            frequency *= params.lacunarity;
+            amplitude *= params.gain;
+        }
+
+        return result;
+    }
+
+    double_t FractalNoise(double_t x, double_t y, double_t z, const NoiseParams& params) {
+        double_t result = 0.0;
+        double_t frequency = params.frequency;
+        double_t amplitude = params.amplitude;
+
+        for (uint32_t octave = 0; octave < params.octaves; ++octave) {
+            result += SNoise(x * frequency, y * frequency, z * frequency) * amplitude;
+            frequency *= params.lacunarity;
+            amplitude *= params.gain;
+        }
+
+        return result;
+    }
+}
+
+namespace SR_MATH_NS::NoiseBatch {
+    struct Gradient {
+        float_t x = 0.f;
+        float_t y = 0.f;
+        float_t z = 0.f;
+        float_t w = 0.f;
+    };
+
+    /**
+     * Градиенты, уже переставленные по perm: gradients[k] = grads[perm[k & mask]] для k < 512.
+     * TableIndex(ix, ...) = perm[((ix & mask) + h) & mask], где h < 256 зависит только от остальных осей,
+     * поэтому градиент угла ячейки - одно чтение gradients[(ix & mask) + h] без последнего обращения к perm.
+     */
+    struct GradientTables {
+        Gradient grads2[512];
+        Gradient grads3[512];
+    };
+
+    static const GradientTables& GetGradientTables() {
+        static const GradientTables tables = []() {
+            GradientTables result;
+
+            for (uint32_t i = 0; i < 512; ++i) {
+                const uint8_t index = NoiseTable::perm[i & SR_NOISE_TABLE_MASK];
+
+                result.grads2[i].x = static_cast<float_t>(NoiseTable::grads2[index][0]);
+                result.grads2[i].y = static_cast<float_t>(NoiseTable::grads2[index][1]);
+
+                result.grads3[i].x = static_cast<float_t>(NoiseTable::grads3[index][0]);
+                result.grads3[i].y = static_cast<float_t>(NoiseTable::grads3[index][1]);
+                result.grads3[i].z = static_cast<float_t>(NoiseTable::grads3[index][2]);
+            }
+
+            return result;
+        }();
+        return tables;
+    }
+
+    /// Строка отсчетов одной октавы, координаты уже умножены на частоту
+    struct Row {
+        double_t x = 0.0;
+        double_t y = 0.0;
+        double_t z = 0.0;
+        float_t step = 0.f;
+        float_t amplitude = 0.f;
+        uint32_t count = 0;
+    };
+
+    /// Целая часть в double, дробная во float: точность не теряется вдали от начала координат
+    struct Axis {
+        explicit Axis(double_t value)
+            : cell(static_cast<int32_t>(std::floor(value)))
+            , r0(static_cast<float_t>(value - cell))
+            , r1(r0 - 1.f)
+            , s(r0 * r0 * (3.f - 2.f * r0))
+        { }
+
+        int32_t cell;
+        float_t r0;
+        float_t r1;
+        float_t s;
+    };
+
+#if defined(SR_SIMD_SSE) || defined(SR_SIMD_NEON)
+    using namespace SR_MATH_NS::SIMD::Packed;
+
+    SR_FORCE_INLINE static Float4 LerpLanes(Float4 t, Float4 a, Float4 b) {
+        return Add(a, Mul(Sub(b, a), t));
+    }
+
+    /// Дробные части и номера ячеек по x для четырех отсчетов строки, начиная с first
+    struct Lanes {
+        Lanes(const Row& row, int32_t baseCell, float_t baseFraction, uint32_t first) {
+            static const float_t offsets[4] = { 0.f, 1.f, 2.f, 3.f };
+
+            const Float4 local = Add(Splat(baseFraction), Mul(Add(Splat(static_cast<float_t>(first)), Load(offsets)), Splat(row.step)));
+            const Float4 cellOffset = Floor(local);
+
+            rx0 = Sub(local, cellOffset);
+            rx1 = Sub(rx0, Splat(1.f));
+            sx = Mul(Mul(rx0, rx0), Sub(Splat(3.f), Mul(Splat(2.f), rx0)));
+
+            StoreInt(cells, cellOffset);
+            for (auto&& cell : cells) {
+                cell = (baseCell + cell) & SR_NOISE_TABLE_MASK;
+            }
+        }
+
+        /// Градиенты угла (ix + dx, h) всех дорожек, разложенные по компонентам
+        void Gather(const Gradient* pGradients, int32_t dx, int32_t h, Float4& gx, Float4& gy, Float4& gz) const {
+            Float4 gw;
+            gx = Load(&pGradients[cells[0] + dx + h].x);
+            gy = Load(&pGradients[cells[1] + dx + h].x);
+            gz = Load(&pGradients[cells[2] + dx + h].x);
+            gw = Load(&pGradients[cells[3] + dx + h].x);
+            Transpose(gx, gy, gz, gw);
+        }
+
+        Float4 rx0;
+        Float4 rx1;
+        Float4 sx;
+        int32_t cells[4] = { };
+    };
+
+    SR_FORCE_INLINE static void AccumulateLanes(float_t* pOut, uint32_t available, Float4 value) {
+        if (available >= 4) {
+            Store(pOut, Add(Load(pOut), value));
+            return;
+        }
+
+        float_t values[4];
+        Store(values, value);
+        for (uint32_t i = 0; i < available; ++i) {
+            pOut[i] += values[i];
+        }
+    }
+
+    static void AccumulateRow2D(const Row& row, float_t* pOut) {
+        const Gradient* pGradients = GetGradientTables().grads2;
+
+        const Axis axisY(row.y);
+        const int32_t h0 = NoiseTable::perm[axisY.cell & SR_NOISE_TABLE_MASK];
+        const int32_t h1 = NoiseTable::perm[(axisY.cell + 1) & SR_NOISE_TABLE_MASK];
+
+        const auto baseCell = static_cast<int32_t>(std::floor(row.x));
+        const auto baseFraction = static_cast<float_t>(row.x - baseCell);
+
+        const Float4 ry0 = Splat(axisY.r0), ry1 = Splat(axisY.r1), sy = Splat(axisY.s);
+        const Float4 amplitude = Splat(row.amplitude);
+
+        for (uint32_t i = 0; i < row.count; i += 4) {
+            const Lanes lanes(row, baseCell, baseFraction, i);
+            Float4 gx, gy, gz;
+
+            lanes.Gather(pGradients, 0, h0, gx, gy, gz);
+            Float4 u = Add(Mul(gx, lanes.rx0), Mul(gy, ry0));
+            lanes.Gather(pGradients, 1, h0, gx, gy, gz);
+            Float4 v = Add(Mul(gx, lanes.rx1), Mul(gy, ry0));
+            const Float4 a = LerpLanes(lanes.sx, u, v);
+
+            lanes.Gather(pGradients, 0, h1, gx, gy, gz);
+            u = Add(Mul(gx, lanes.rx0), Mul(gy, ry1));
+            lanes.Gather(pGradients, 1, h1, gx, gy, gz);
+            v = Add(Mul(gx, lanes.rx1), Mul(gy, ry1));
+            const Float4 b = LerpLanes(lanes.sx, u, v);
+
+            AccumulateLanes(pOut + i, row.count - i, Mul(LerpLanes(sy, a, b), amplitude));
+        }
+    }
+
+    static void AccumulateRow3D(const Row& row, float_t* pOut) {
+        const Gradient* pGradients = GetGradientTables().grads3;
+
+        const Axis axisY(row.y);
+        const Axis axisZ(row.z);
+
+        /// perm[(iy + perm[iz & mask]) & mask] для четырех углов (y, z), общие для всей строки
+        const int32_t pz0 = NoiseTable::perm[axisZ.cell & SR_NOISE_TABLE_MASK];
+        const int32_t pz1 = NoiseTable::perm[(axisZ.cell + 1) & SR_NOISE_TABLE_MASK];
+        const int32_t h00 = NoiseTable::perm[(axisY.cell + pz0) & SR_NOISE_TABLE_MASK];
+        const int32_t h10 = NoiseTable::perm[(axisY.cell + 1 + pz0) & SR_NOISE_TABLE_MASK];
+        const int32_t h01 = NoiseTable::perm[(axisY.cell + pz1) & SR_NOISE_TABLE_MASK];
+        const int32_t h11 = NoiseTable::perm[(axisY.cell + 1 + pz1) & SR_NOISE_TABLE_MASK];
+
+        const auto baseCell = static_cast<int32_t>(std::floor(row.x));
+        const auto baseFraction = static_cast<float_t>(row.x - baseCell);
+
+        const Float4 ry0 = Splat(axisY.r0), ry1 = Splat(axisY.r1), sy = Splat(axisY.s);
+        const Float4 rz0 = Splat(axisZ.r0), rz1 = Splat(axisZ.r1), sz = Splat(axisZ.s);
+        const Float4 amplitude = Splat(row.amplitude);
+
+        for (uint32_t i = 0; i < row.count; i += 4) {
+            const Lanes lanes(row, baseCell, baseFraction, i);
+
+            auto&& edge = [&](int32_t h, Float4 ry, Float4 rz) {
+                Float4 gx, gy, gz;
+
+                lanes.Gather(pGradients, 0, h, gx, gy, gz);
+                const Float4 u = Add(Add(Mul(gx, lanes.rx0), Mul(gy, ry)), Mul(gz, rz));
+                lanes.Gather(pGradients, 1, h, gx, gy, gz);
+                const Float4 v = Add(Add(Mul(gx, lanes.rx1), Mul(gy, ry)), Mul(gz, rz));
+
+                return LerpLanes(lanes.sx, u, v);
+            };
+
+            const Float4 c = LerpLanes(sy, edge(h00, ry0, rz0), edge(h10, ry1, rz0));
+            const Float4 d = LerpLanes(sy, edge(h01, ry0, rz1), edge(h11, ry1, rz1));
+
+            AccumulateLanes(pOut + i, row.count - i, Mul(LerpLanes(sz, c, d), amplitude));
+        }
+    }
+#else
+    static void AccumulateRow2D(const Row& row, float_t* pOut) {
+        for (uint32_t i = 0; i < row.count; ++i) {
+            pOut[i] += static_cast<float_t>(SNoise(row.x + i * row.step, row.y)) * row.amplitude;
+        }
+    }
+
+    static void AccumulateRow3D(const Row& row, float_t* pOut) {
+        for (uint32_t i = 0; i < row.count; ++i) {
+            pOut[i] += static_cast<float_t>(SNoise(row.x + i * row.step, row.y, row.z)) * row.amplitude;
+        }
+    }
+#endif
+
+    /// Тайлы раздаются вызывающему и рабочим потокам по одному, пока не кончатся
+    template<typename Function> static void ForEachTile(uint32_t tilesCount, uint32_t threads, const Function& function) {
+        std::atomic<uint32_t> nextTile = 0;
+
+        auto&& worker = [&]() {
+            for (uint32_t tile = nextTile.fetch_add(1); tile < tilesCount; tile = nextTile.fetch_add(1)) {
+                function(tile);
+            }
+        };
+
+        std::vector<std::thread> workers;
+        workers.reserve(std::min(threads, tilesCount));
+
+        for (uint32_t i = 0; i + 1 < tilesCount && i < threads; ++i) {
+            workers.emplace_back(worker);
+        }
+
+        worker();
+
+        for (auto&& thread : workers) {
+            thread.join();
+        }
+    }
+
+    template<typename Accumulate> static void FillGrid(const NoiseGrid& grid, const NoiseParams& params, float_t* pOut, uint32_t threads, bool is3D, const Accumulate& accumulate) {
+        const uint32_t sizeZ = is3D ? grid.sizeZ : 1;
+        if (grid.sizeX == 0 || grid.sizeY == 0 || sizeZ == 0) {
+            return;
+        }
+
+        const uint32_t tileSize = std::max<uint32_t>(grid.tileSize, 4);
+        const uint32_t tilesX = (grid.sizeX + tileSize - 1) / tileSize;
+        const uint32_t tilesY = (grid.sizeY + tileSize - 1) / tileSize;
+        const uint32_t tilesZ = (sizeZ + tileSize - 1) / tileSize;
+
+        ForEachTile(tilesX * tilesY * tilesZ, threads, [&](uint32_t tile) {
+            const uint32_t beginX = (tile % tilesX) * tileSize;
+            const uint32_t beginY = ((tile / tilesX) % tilesY) * tileSize;
+            const uint32_t beginZ = (tile / (tilesX * tilesY)) * tileSize;
+
+            const uint32_t endX = std::min(beginX + tileSize, grid.sizeX);
+            const uint32_t endY = std::min(beginY + tileSize, grid.sizeY);
+            const uint32_t endZ = std::min(beginZ + tileSize, sizeZ);
+
+            for (uint32_t z = beginZ; z < endZ; ++z) {
+                for (uint32_t y = beginY; y < endY; ++y) {
+                    float_t* pRow = pOut + (static_cast<uint64_t>(z) * grid.sizeY + y) * grid.sizeX + beginX;
+                    std::fill(pRow, pRow + (endX - beginX), 0.f);
+
+                    double_t frequency = params.frequency;
+                    double_t amplitude = params.amplitude;
+
+                    for (uint32_t octave = 0; octave < params.octaves; ++octave) {
+                        Row row;
+                        row.x = (grid.originX + beginX * grid.step) * frequency;
+                        row.y = (grid.originY + y * grid.step) * frequency;
+                        row.z = (grid.originZ + z * grid.step) * frequency;
+                        row.step = static_cast<float_t>(grid.step * frequency);
+                        row.amplitude = static_cast<float_t>(amplitude);
+                        row.count = endX - beginX;
+
+                        accumulate(row, pRow);
+
+                        frequency *= params.lacunarity;
+                        amplitude *= params.gain;
+                    }
+                }
+            }
+        });
+    }
+}
+
+namespace SR_MATH_NS {
+    void FillNoise2D(const NoiseGrid& grid, const NoiseParams& params, float_t* pOut, uint32_t threads) {
+        NoiseBatch::FillGrid(grid, params, pOut, threads, false, NoiseBatch::AccumulateRow2D);
+    }
+
+    void FillNoise3D(const NoiseGrid& grid, const NoiseParams& params, float_t* pOut, uint32_t threads) {
+        NoiseBatch::FillGrid(grid, params, pOut, threads, true, NoiseBatch::AccumulateRow3D);
+    }
+}
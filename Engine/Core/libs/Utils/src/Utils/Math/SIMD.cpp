@@ -0,0 +1,639 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Utils/Math/SIMD.h>
+#include <Utils/Math/SIMDPacked.h>
+
+namespace SR_MATH_NS::SIMD {
+    static_assert(sizeof(Matrix4x4) == sizeof(float_t) * 16, "Matrix4x4 must be 16 packed floats!");
+    static_assert(sizeof(Quaternion) == sizeof(float_t) * 4, "Quaternion must be 4 packed floats!");
+    static_assert(sizeof(FVector3) == sizeof(float_t) * 3, "FVector3 must be 3 packed floats!");
+    static_assert(sizeof(Sphere) == sizeof(float_t) * 4 && sizeof(Plane) == sizeof(float_t) * 4, "Sphere and Plane must be 4 packed floats!");
+
+    /// Матрица хранится по столбцам: элемент (column, row) лежит по индексу column * 4 + row
+    SR_FORCE_INLINE static const float_t* MatrixData(const Matrix4x4& matrix) noexcept { return &matrix.self[0][0]; }
+    SR_FORCE_INLINE static float_t* MatrixData(Matrix4x4& matrix) noexcept { return &matrix.self[0][0]; }
+
+    struct Kernels {
+        Backend backend = Backend::Scalar;
+        /// leftStride = 0 - одна левая матрица на все элементы
+        void(*multiplyMatrices)(const Matrix4x4* pLeft, uint64_t leftStride, const Matrix4x4* pRight, Matrix4x4* pResult, uint64_t count) = nullptr;
+        void(*composeTRS)(const FVector3* pTranslation, const Quaternion* pRotation, const FVector3* pScale, Matrix4x4* pResult, uint64_t count) = nullptr;
+        void(*decomposeTRS)(const Matrix4x4* pMatrices, FVector3* pTranslation, Quaternion* pRotation, FVector3* pScale, uint64_t count) = nullptr;
+        void(*slerpQuaternions)(const Quaternion* pFrom, const Quaternion* pTo, const float_t* pT, Quaternion* pResult, uint64_t count) = nullptr;
+        void(*transformAABBs)(const Matrix4x4* pMatrices, const AABB* pBounds, AABB* pResult, uint64_t count) = nullptr;
+        void(*testSpheres)(const Plane* pPlanes, uint32_t planesCount, const Sphere* pSpheres, uint8_t* pVisible, uint64_t count) = nullptr;
+    };
+}
+
+namespace SR_MATH_NS::SIMD::Scalar {
+    static void MultiplyMatricesStrided(const Matrix4x4* pLeft, uint64_t leftStride, const Matrix4x4* pRight, Matrix4x4* pResult, uint64_t count) {
+        for (uint64_t i = 0; i < count; ++i) {
+            pResult[i] = pLeft[i * leftStride] * pRight[i];
+        }
+    }
+
+    void MultiplyMatrices(const Matrix4x4* pLeft, const Matrix4x4* pRight, Matrix4x4* pResult, uint64_t count) {
+        MultiplyMatricesStrided(pLeft, 1, pRight, pResult, count);
+    }
+
+    void MultiplyMatrices(const Matrix4x4& left, const Matrix4x4* pRight, Matrix4x4* pResult, uint64_t count) {
+        MultiplyMatricesStrided(&left, 0, pRight, pResult, count);
+    }
+
+    void ComposeTRS(const FVector3* pTranslation, const Quaternion* pRotation, const FVector3* pScale, Matrix4x4* pResult, uint64_t count) {
+        for (uint64_t i = 0; i < count; ++i) {
+            pResult[i] = Matrix4x4(pTranslation[i], pRotation[i], pScale[i]);
+        }
+    }
+
+    void DecomposeTRS(const Matrix4x4* pMatrices, FVector3* pTranslation, Quaternion* pRotation, FVector3* pScale, uint64_t count) {
+        for (uint64_t i = 0; i < count; ++i) {
+            pMatrices[i].Decompose(pTranslation[i], pRotation[i], pScale[i]);
+        }
+    }
+
+    void SlerpQuaternions(const Quaternion* pFrom, const Quaternion* pTo, const float_t* pT, Quaternion* pResult, uint64_t count) {
+        for (uint64_t i = 0; i < count; ++i) {
+            pResult[i] = Quaternion(glm::slerp(pFrom[i].self, pTo[i].self, pT[i]));
+        }
+    }
+
+    void TransformAABBs(const Matrix4x4* pMatrices, const AABB* pBounds, AABB* pResult, uint64_t count) {
+        for (uint64_t i = 0; i < count; ++i) {
+            const float_t* pMatrix = MatrixData(pMatrices[i]);
+            const AABB bounds = pBounds[i];
+
+            /// центр преобразуется матрицей, полуразмеры - модулем ее поворотной части (Arvo)
+            const FVector3 center = (bounds.min + bounds.max) * 0.5f;
+            const FVector3 extents = (bounds.max - bounds.min) * 0.5f;
+
+            for (uint32_t row = 0; row < 3; ++row) {
+                const float_t newCenter = pMatrix[row] * center.x + pMatrix[4 + row] * center.y + pMatrix[8 + row] * center.z + pMatrix[12 + row];
+                const float_t newExtent = std::abs(pMatrix[row]) * extents.x + std::abs(pMatrix[4 + row]) * extents.y + std::abs(pMatrix[8 + row]) * extents.z;
+
+                pResult[i].min[row] = newCenter - newExtent;
+                pResult[i].max[row] = newCenter + newExtent;
+            }
+        }
+    }
+
+    void TestSpheres(const Plane* pPlanes, uint32_t planesCount, const Sphere* pSpheres, uint8_t* pVisible, uint64_t count) {
+        for (uint64_t i = 0; i < count; ++i) {
+            const Sphere& sphere = pSpheres[i];
+            bool visible = true;
+
+            for (uint32_t planeIndex = 0; planeIndex < planesCount; ++planeIndex) {
+                const Plane& plane = pPlanes[planeIndex];
+                const float_t distance = plane.normal.x * sphere.center.x + plane.normal.y * sphere.center.y + plane.normal.z * sphere.center.z + plane.distance;
+
+                if (distance < -sphere.radius) {
+                    visible = false;
+                    break;
+                }
+            }
+
+            pVisible[i] = visible ? 1 : 0;
+        }
+    }
+
+    static const Kernels KERNELS = {
+        Backend::Scalar, &MultiplyMatricesStrided, &ComposeTRS, &DecomposeTRS, &SlerpQuaternions, &TransformAABBs, &TestSpheres
+    };
+}
+
+#if defined(SR_SIMD_SSE) || defined(SR_SIMD_NEON)
+/// Ядра шириной 4 float поверх тонкой обертки, общие для SSE и NEON
+namespace SR_MATH_NS::SIMD::Packed {
+    /// sin(x) рядом Тейлора до x^11, ошибка меньше 1e-7 на [-pi/2, pi/2]
+    SR_FORCE_INLINE static Float4 SinApprox(Float4 x) {
+        const Float4 x2 = Mul(x, x);
+
+        Float4 result = Splat(-1.f / 39916800.f);
+        result = Add(Mul(result, x2), Splat(1.f / 362880.f));
+        result = Add(Mul(result, x2), Splat(-1.f / 5040.f));
+        result = Add(Mul(result, x2), Splat(1.f / 120.f));
+        result = Add(Mul(result, x2), Splat(-1.f / 6.f));
+        result = Add(Mul(result, x2), Splat(1.f));
+
+        return Mul(result, x);
+    }
+
+    /// acos(x) для x в [0, 1] (Abramowitz, Stegun 4.4.46), ошибка меньше 2e-8
+    SR_FORCE_INLINE static Float4 AcosApprox(Float4 x) {
+        Float4 result = Splat(-0.0012624911f);
+        result = Add(Mul(result, x), Splat(0.0066700901f));
+        result = Add(Mul(result, x), Splat(-0.0170881256f));
+        result = Add(Mul(result, x), Splat(0.0308918810f));
+        result = Add(Mul(result, x), Splat(-0.0501743046f));
+        result = Add(Mul(result, x), Splat(0.0889789874f));
+        result = Add(Mul(result, x), Splat(-0.2145988016f));
+        result = Add(Mul(result, x), Splat(1.5707963050f));
+
+        return Mul(result, Sqrt(Sub(Splat(1.f), x)));
+    }
+
+    static void MultiplyMatrices(const Matrix4x4* pLeft, uint64_t leftStride, const Matrix4x4* pRight, Matrix4x4* pResult, uint64_t count) {
+        for (uint64_t i = 0; i < count; ++i) {
+            const float_t* pA = MatrixData(pLeft[i * leftStride]);
+            const float_t* pB = MatrixData(pRight[i]);
+
+            const Float4 a0 = Load(pA), a1 = Load(pA + 4), a2 = Load(pA + 8), a3 = Load(pA + 12);
+
+            /// все столбцы считаются до записи, поэтому pResult может совпадать с входами
+            Float4 columns[4];
+            for (uint32_t column = 0; column < 4; ++column) {
+                const float_t* pColumn = pB + column * 4;
+                columns[column] = Add(Add(Add(Mul(a0, Splat(pColumn[0])), Mul(a1, Splat(pColumn[1]))), Mul(a2, Splat(pColumn[2]))), Mul(a3, Splat(pColumn[3])));
+            }
+
+            float_t* pOut = MatrixData(pResult[i]);
+            for (uint32_t column = 0; column < 4; ++column) {
+                Store(pOut + column * 4, columns[column]);
+            }
+        }
+    }
+
+    static void ComposeTRS(const FVector3* pTranslation, const Quaternion* pRotation, const FVector3* pScale, Matrix4x4* pResult, uint64_t count) {
+        const uint64_t packedCount = count & ~static_cast<uint64_t>(3);
+
+        const Float4 zero = Splat(0.f);
+        const Float4 one = Splat(1.f);
+        const Float4 two = Splat(2.f);
+
+        for (uint64_t i = 0; i < packedCount; i += 4) {
+            Float4 qx = Load(&pRotation[i].x), qy = Load(&pRotation[i + 1].x), qz = Load(&pRotation[i + 2].x), qw = Load(&pRotation[i + 3].x);
+            Transpose(qx, qy, qz, qw);
+
+            Float4 tx, ty, tz, sx, sy, sz;
+            LoadVector3x4(&pTranslation[i].x, tx, ty, tz);
+            LoadVector3x4(&pScale[i].x, sx, sy, sz);
+
+            const Float4 qxx = Mul(qx, qx), qyy = Mul(qy, qy), qzz = Mul(qz, qz);
+            const Float4 qxz = Mul(qx, qz), qxy = Mul(qx, qy), qyz = Mul(qy, qz);
+            const Float4 qwx = Mul(qw, qx), qwy = Mul(qw, qy), qwz = Mul(qw, qz);
+
+            /// столбцы повторяют GLMRotateMat4x4, каждый домножен на свой масштаб
+            Float4 columns[4][4] = {
+                {
+                    Mul(Sub(one, Mul(two, Add(qyy, qzz))), sx),
+                    Mul(Mul(two, Add(qxy, qwz)), sx),
+                    Mul(Mul(two, Sub(qxz, qwy)), sx),
+                    zero
+                },
+                {
+                    Mul(Mul(two, Sub(qxy, qwz)), sy),
+                    Mul(Sub(one, Mul(two, Add(qxx, qzz))), sy),
+                    Mul(Mul(two, Add(qyz, qwx)), sy),
+                    zero
+                },
+                {
+                    Mul(Mul(two, Add(qxz, qwy)), sz),
+                    Mul(Mul(two, Sub(qyz, qwx)), sz),
+                    Mul(Sub(one, Mul(two, Add(qxx, qyy))), sz),
+                    zero
+                },
+                { tx, ty, tz, one }
+            };
+
+            for (uint32_t column = 0; column < 4; ++column) {
+                Transpose(columns[column][0], columns[column][1], columns[column][2], columns[column][3]);
+                for (uint32_t element = 0; element < 4; ++element) {
+                    Store(MatrixData(pResult[i + element]) + column * 4, columns[column][element]);
+                }
+            }
+        }
+
+        Scalar::ComposeTRS(pTranslation + packedCount, pRotation + packedCount, pScale + packedCount, pResult + packedCount, count - packedCount);
+    }
+
+    static void DecomposeTRS(const Matrix4x4* pMatrices, FVector3* pTranslation, Quaternion* pRotation, FVector3* pScale, uint64_t count) {
+        const uint64_t packedCount = count & ~static_cast<uint64_t>(3);
+
+        const Float4 one = Splat(1.f);
+        const Float4 half = Splat(0.5f);
+        const Float4 quarter = Splat(0.25f);
+
+        for (uint64_t i = 0; i < packedCount; i += 4) {
+            /// m[column][component], в каждой дорожке свой элемент
+            Float4 m[4][4];
+            for (uint32_t column = 0; column < 4; ++column) {
+                for (uint32_t element = 0; element < 4; ++element) {
+                    m[column][element] = Load(MatrixData(pMatrices[i + element]) + column * 4);
+                }
+                Transpose(m[column][0], m[column][1], m[column][2], m[column][3]);
+            }
+
+            Float4 scale[3];
+            for (uint32_t column = 0; column < 3; ++column) {
+                scale[column] = Sqrt(Add(Add(Mul(m[column][0], m[column][0]), Mul(m[column][1], m[column][1])), Mul(m[column][2], m[column][2])));
+                for (uint32_t row = 0; row < 3; ++row) {
+                    m[column][row] = Div(m[column][row], scale[column]);
+                }
+            }
+
+            /// glm::quat_cast без ветвлений: считаются все четыре случая и выбирается нужный
+            const Float4 fourX = Sub(Sub(m[0][0], m[1][1]), m[2][2]);
+            const Float4 fourY = Sub(Sub(m[1][1], m[0][0]), m[2][2]);
+            const Float4 fourZ = Sub(Sub(m[2][2], m[0][0]), m[1][1]);
+            const Float4 fourW = Add(Add(m[0][0], m[1][1]), m[2][2]);
+
+            Float4 biggest = fourW;
+            const Float4 isX = Greater(fourX, biggest);
+            biggest = Select(isX, fourX, biggest);
+            const Float4 isY = Greater(fourY, biggest);
+            biggest = Select(isY, fourY, biggest);
+            const Float4 isZ = Greater(fourZ, biggest);
+            biggest = Select(isZ, fourZ, biggest);
+
+            const Float4 biggestValue = Mul(Sqrt(Add(biggest, one)), half);
+            const Float4 mult = Div(quarter, biggestValue);
+
+            const Float4 d12 = Mul(Sub(m[1][2], m[2][1]), mult);
+            const Float4 d20 = Mul(Sub(m[2][0], m[0][2]), mult);
+            const Float4 d01 = Mul(Sub(m[0][1], m[1][0]), mult);
+            const Float4 s01 = Mul(Add(m[0][1], m[1][0]), mult);
+            const Float4 s20 = Mul(Add(m[2][0], m[0][2]), mult);
+            const Float4 s12 = Mul(Add(m[1][2], m[2][1]), mult);
+
+            Float4 qx = Select(isZ, s20, Select(isY, s01, Select(isX, biggestValue, d12)));
+            Float4 qy = Select(isZ, s12, Select(isY, biggestValue, Select(isX, s01, d20)));
+            Float4 qz = Select(isZ, biggestValue, Select(isY, s12, Select(isX, s20, d01)));
+            Float4 qw = Select(isZ, d01, Select(isY, d20, Select(isX, d12, biggestValue)));
+
+            Transpose(qx, qy, qz, qw);
+            Store(&pRotation[i].x, qx);
+            Store(&pRotation[i + 1].x, qy);
+            Store(&pRotation[i + 2].x, qz);
+            Store(&pRotation[i + 3].x, qw);
+
+            StoreVector3x4(&pTranslation[i].x, m[3][0], m[3][1], m[3][2]);
+            StoreVector3x4(&pScale[i].x, scale[0], scale[1], scale[2]);
+        }
+
+        Scalar::DecomposeTRS(pMatrices + packedCount, pTranslation + packedCount, pRotation + packedCount, pScale + packedCount, count - packedCount);
+    }
+
+    static void SlerpQuaternions(const Quaternion* pFrom, const Quaternion* pTo, const float_t* pT, Quaternion* pResult, uint64_t count) {
+        const uint64_t packedCount = count & ~static_cast<uint64_t>(3);
+
+        const Float4 zero = Splat(0.f);
+        const Float4 one = Splat(1.f);
+        const Float4 linearThreshold = Splat(1.f - std::numeric_limits<float_t>::epsilon());
+
+        for (uint64_t i = 0; i < packedCount; i += 4) {
+            Float4 a[4] = { Load(&pFrom[i].x), Load(&pFrom[i + 1].x), Load(&pFrom[i + 2].x), Load(&pFrom[i + 3].x) };
+            Float4 b[4] = { Load(&pTo[i].x), Load(&pTo[i + 1].x), Load(&pTo[i + 2].x), Load(&pTo[i + 3].x) };
+            Transpose(a[0], a[1], a[2], a[3]);
+            Transpose(b[0], b[1], b[2], b[3]);
+
+            const Float4 t = Load(pT + i);
+
+            /// порядок сложения как в glm::dot для кватернионов
+            Float4 cosTheta = Add(Add(Mul(a[3], b[3]), Mul(a[0], b[0])), Add(Mul(a[1], b[1]), Mul(a[2], b[2])));
+
+            /// длинный путь по сфере заменяется коротким
+            const Float4 isNegative = Less(cosTheta, zero);
+            cosTheta = Select(isNegative, Negate(cosTheta), cosTheta);
+            for (auto&& component : b) {
+                component = Select(isNegative, Negate(component), component);
+            }
+
+            const Float4 isLinear = Greater(cosTheta, linearThreshold);
+            const Float4 oneMinusT = Sub(one, t);
+
+            const Float4 angle = AcosApprox(cosTheta);
+            const Float4 invSinAngle = Div(one, SinApprox(angle));
+            const Float4 weightA = Select(isLinear, oneMinusT, Mul(SinApprox(Mul(oneMinusT, angle)), invSinAngle));
+            const Float4 weightB = Select(isLinear, t, Mul(SinApprox(Mul(t, angle)), invSinAngle));
+
+            Float4 result[4];
+            for (uint32_t component = 0; component < 4; ++component) {
+                result[component] = Add(Mul(a[component], weightA), Mul(b[component], weightB));
+            }
+
+            Transpose(result[0], result[1], result[2], result[3]);
+            for (uint32_t element = 0; element < 4; ++element) {
+                Store(&pResult[i + element].x, result[element]);
+            }
+        }
+
+        Scalar::SlerpQuaternions(pFrom + packedCount, pTo + packedCount, pT + packedCount, pResult + packedCount, count - packedCount);
+    }
+
+    static void TransformAABBs(const Matrix4x4* pMatrices, const AABB* pBounds, AABB* pResult, uint64_t count) {
+        const Float4 half = Splat(0.5f);
+
+        for (uint64_t i = 0; i < count; ++i) {
+            const float_t* pMatrix = MatrixData(pMatrices[i]);
+            const Float4 c0 = Load(pMatrix), c1 = Load(pMatrix + 4), c2 = Load(pMatrix + 8), c3 = Load(pMatrix + 12);
+
+            const AABB& bounds = pBounds[i];
+            const Float4 cx = Mul(Add(Splat(bounds.min.x), Splat(bounds.max.x)), half);
+            const Float4 cy = Mul(Add(Splat(bounds.min.y), Splat(bounds.max.y)), half);
+            const Float4 cz = Mul(Add(Splat(bounds.min.z), Splat(bounds.max.z)), half);
+            const Float4 ex = Mul(Sub(Splat(bounds.max.x), Splat(bounds.min.x)), half);
+            const Float4 ey = Mul(Sub(Splat(bounds.max.y), Splat(bounds.min.y)), half);
+            const Float4 ez = Mul(Sub(Splat(bounds.max.z), Splat(bounds.min.z)), half);
+
+            const Float4 center = Add(Add(Add(Mul(c0, cx), Mul(c1, cy)), Mul(c2, cz)), c3);
+            const Float4 extents = Add(Add(Mul(Abs(c0), ex), Mul(Abs(c1), ey)), Mul(Abs(c2), ez));
+
+            StoreVector3(pResult[i].min, Sub(center, extents));
+            StoreVector3(pResult[i].max, Add(center, extents));
+        }
+    }
+
+    static void TestSpheres(const Plane* pPlanes, uint32_t planesCount, const Sphere* pSpheres, uint8_t* pVisible, uint64_t count) {
+        const uint64_t packedCount = count & ~static_cast<uint64_t>(3);
+
+        for (uint64_t i = 0; i < packedCount; i += 4) {
+            Float4 x = Load(&pSpheres[i].center.x), y = Load(&pSpheres[i + 1].center.x), z = Load(&pSpheres[i + 2].center.x), radius = Load(&pSpheres[i + 3].center.x);
+            Transpose(x, y, z, radius);
+
+            const Float4 negativeRadius = Negate(radius);
+            uint32_t visible = 0b1111;
+
+            for (uint32_t planeIndex = 0; planeIndex < planesCount && visible != 0; ++planeIndex) {
+                const Plane& plane = pPlanes[planeIndex];
+                const Float4 distance = Add(Add(Add(Mul(Splat(plane.normal.x), x), Mul(Splat(plane.normal.y), y)), Mul(Splat(plane.normal.z), z)), Splat(plane.distance));
+                visible &= MoveMask(GreaterEqual(distance, negativeRadius));
+            }
+
+            for (uint32_t element = 0; element < 4; ++element) {
+                pVisible[i + element] = static_cast<uint8_t>((visible >> element) & 1U);
+            }
+        }
+
+        Scalar::TestSpheres(pPlanes, planesCount, pSpheres + packedCount, pVisible + packedCount, count - packedCount);
+    }
+
+    static const Kernels KERNELS = {
+    #if defined(SR_SIMD_SSE)
+        Backend::SSE,
+    #else
+        Backend::NEON,
+    #endif
+        &MultiplyMatrices, &ComposeTRS, &DecomposeTRS, &SlerpQuaternions, &TransformAABBs, &TestSpheres
+    };
+}
+#endif
+
+#if defined(SR_SIMD_AVX2)
+/// Восемь дорожек там, где это окупается. TRS и slerp упираются в перестановки данных и остаются на SSE
+namespace SR_MATH_NS::SIMD::AVX2 {
+    static bool IsSupported() {
+    #if defined(_MSC_VER)
+        int32_t info[4];
+        __cpuid(info, 0);
+        if (info[0] < 7) {
+            return false;
+        }
+
+        __cpuid(info, 1);
+        const bool hasFMA = (info[2] & (1 << 12)) != 0;
+        const bool hasOSXSave = (info[2] & (1 << 27)) != 0;
+        /// ОС должна сохранять регистры YMM
+        if (!hasFMA || !hasOSXSave || (_xgetbv(0) & 0x6) != 0x6) {
+            return false;
+        }
+
+        __cpuidex(info, 7, 0);
+        return (info[1] & (1 << 5)) != 0;
+    #else
+        return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    #endif
+    }
+
+    SR_SIMD_TARGET_AVX2 inline static __m256 LoadPair(const float_t* pLow, const float_t* pHigh) {
+        return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(pLow)), _mm_loadu_ps(pHigh), 1);
+    }
+
+    SR_SIMD_TARGET_AVX2 static void MultiplyMatrices(const Matrix4x4* pLeft, uint64_t leftStride, const Matrix4x4* pRight, Matrix4x4* pResult, uint64_t count) {
+        for (uint64_t i = 0; i < count; ++i) {
+            const float_t* pA = MatrixData(pLeft[i * leftStride]);
+            const float_t* pB = MatrixData(pRight[i]);
+
+            /// столбцы левой матрицы в обеих половинах, в половинах правой - два соседних столбца
+            const __m256 a0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(pA));
+            const __m256 a1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(pA + 4));
+            const __m256 a2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(pA + 8));
+            const __m256 a3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(pA + 12));
+
+            const __m256 b01 = _mm256_loadu_ps(pB);
+            const __m256 b23 = _mm256_loadu_ps(pB + 8);
+
+            __m256 r01 = _mm256_mul_ps(a0, _mm256_permute_ps(b01, 0x00));
+            r01 = _mm256_fmadd_ps(a1, _mm256_permute_ps(b01, 0x55), r01);
+            r01 = _mm256_fmadd_ps(a2, _mm256_permute_ps(b01, 0xAA), r01);
+            r01 = _mm256_fmadd_ps(a3, _mm256_permute_ps(b01, 0xFF), r01);
+
+            __m256 r23 = _mm256_mul_ps(a0, _mm256_permute_ps(b23, 0x00));
+            r23 = _mm256_fmadd_ps(a1, _mm256_permute_ps(b23, 0x55), r23);
+            r23 = _mm256_fmadd_ps(a2, _mm256_permute_ps(b23, 0xAA), r23);
+            r23 = _mm256_fmadd_ps(a3, _mm256_permute_ps(b23, 0xFF), r23);
+
+            float_t* pOut = MatrixData(pResult[i]);
+            _mm256_storeu_ps(pOut, r01);
+            _mm256_storeu_ps(pOut + 8, r23);
+        }
+    }
+
+    SR_SIMD_TARGET_AVX2 static void TransformAABBs(const Matrix4x4* pMatrices, const AABB* pBounds, AABB* pResult, uint64_t count) {
+        const __m256 half = _mm256_set1_ps(0.5f);
+        const __m256 absMask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+
+        uint64_t i = 0;
+
+        /// два AABB за итерацию, каждый в своей половине регистра
+        for (; i + 2 <= count; i += 2) {
+            const float_t* pLow = MatrixData(pMatrices[i]);
+            const float_t* pHigh = MatrixData(pMatrices[i + 1]);
+
+            const __m256 c0 = LoadPair(pLow, pHigh);
+            const __m256 c1 = LoadPair(pLow + 4, pHigh + 4);
+            const __m256 c2 = LoadPair(pLow + 8, pHigh + 8);
+            const __m256 c3 = LoadPair(pLow + 12, pHigh + 12);
+
+            const AABB& low = pBounds[i];
+            const AABB& high = pBounds[i + 1];
+
+            const __m256 cx = _mm256_mul_ps(_mm256_add_ps(_mm256_setr_ps(low.min.x, low.min.x, low.min.x, low.min.x, high.min.x, high.min.x, high.min.x, high.min.x),
+                _mm256_setr_ps(low.max.x, low.max.x, low.max.x, low.max.x, high.max.x, high.max.x, high.max.x, high.max.x)), half);
+            const __m256 cy = _mm256_mul_ps(_mm256_add_ps(_mm256_setr_ps(low.min.y, low.min.y, low.min.y, low.min.y, high.min.y, high.min.y, high.min.y, high.min.y),
+                _mm256_setr_ps(low.max.y, low.max.y, low.max.y, low.max.y, high.max.y, high.max.y, high.max.y, high.max.y)), half);
+            const __m256 cz = _mm256_mul_ps(_mm256_add_ps(_mm256_setr_ps(low.min.z, low.min.z, low.min.z, low.min.z, high.min.z, high.min.z, high.min.z, high.min.z),
+                _mm256_setr_ps(low.max.z, low.max.z, low.max.z, low.max.z, high.max.z, high.max.z, high.max.z, high.max.z)), half);
+            const __m256 ex = _mm256_mul_ps(_mm256_sub_ps(_mm256_setr_ps(low.max.x, low.max.x, low.max.x, low.max.x, high.max.x, high.max.x, high.max.x, high.max.x),
+                _mm256_setr_ps(low.min.x, low.min.x, low.min.x, low.min.x, high.min.x, high.min.x, high.min.x, high.min.x)), half);
+            const __m256 ey = _mm256_mul_ps(_mm256_sub_ps(_mm256_setr_ps(low.max.y, low.max.y, low.max.y, low.max.y, high.max.y, high.max.y, high.max.y, high.max.y),
+                _mm256_setr_ps(low.min.y, low.min.y, low.min.y, low.min.y, high.min.y, high.min.y, high.min.y, high.min.y)), half);
+            const __m256 ez = _mm256_mul_ps(_mm256_sub_ps(_mm256_setr_ps(low.max.z, low.max.z, low.max.z, low.max.z, high.max.z, high.max.z, high.max.z, high.max.z),
+                _mm256_setr_ps(low.min.z, low.min.z, low.min.z, low.min.z, high.min.z, high.min.z, high.min.z, high.min.z)), half);
+
+            __m256 center = _mm256_mul_ps(c0, cx);
+            center = _mm256_fmadd_ps(c1, cy, center);
+            center = _mm256_fmadd_ps(c2, cz, center);
+            center = _mm256_add_ps(center, c3);
+
+            __m256 extents = _mm256_mul_ps(_mm256_and_ps(c0, absMask), ex);
+            extents = _mm256_fmadd_ps(_mm256_and_ps(c1, absMask), ey, extents);
+            extents = _mm256_fmadd_ps(_mm256_and_ps(c2, absMask), ez, extents);
+
+            float_t minValues[8];
+            float_t maxValues[8];
+            _mm256_storeu_ps(minValues, _mm256_sub_ps(center, extents));
+            _mm256_storeu_ps(maxValues, _mm256_add_ps(center, extents));
+
+            std::memcpy(&pResult[i].min.x, minValues, sizeof(FVector3));
+            std::memcpy(&pResult[i].max.x, maxValues, sizeof(FVector3));
+            std::memcpy(&pResult[i + 1].min.x, minValues + 4, sizeof(FVector3));
+            std::memcpy(&pResult[i + 1].max.x, maxValues + 4, sizeof(FVector3));
+        }
+
+        Packed::TransformAABBs(pMatrices + i, pBounds + i, pResult + i, count - i);
+    }
+
+    SR_SIMD_TARGET_AVX2 static void TestSpheres(const Plane* pPlanes, uint32_t planesCount, const Sphere* pSpheres, uint8_t* pVisible, uint64_t count) {
+        const __m256 signMask = _mm256_set1_ps(-0.f);
+        const uint64_t packedCount = count & ~static_cast<uint64_t>(7);
+
+        for (uint64_t i = 0; i < packedCount; i += 8) {
+            /// в нижней половине сферы 0-3, в верхней 4-7, затем транспонирование 4x4 внутри половин
+            const __m256 r0 = LoadPair(&pSpheres[i].center.x, &pSpheres[i + 4].center.x);
+            const __m256 r1 = LoadPair(&pSpheres[i + 1].center.x, &pSpheres[i + 5].center.x);
+            const __m256 r2 = LoadPair(&pSpheres[i + 2].center.x, &pSpheres[i + 6].center.x);
+            const __m256 r3 = LoadPair(&pSpheres[i + 3].center.x, &pSpheres[i + 7].center.x);
+
+            const __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+            const __m256 t1 = _mm256_unpackhi_ps(r0, r1);
+            const __m256 t2 = _mm256_unpacklo_ps(r2, r3);
+            const __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+
+            const __m256 x = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+            const __m256 y = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+            const __m256 z = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+            const __m256 negativeRadius = _mm256_xor_ps(_mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2)), signMask);
+
+            uint32_t visible = 0xFF;
+
+            for (uint32_t planeIndex = 0; planeIndex < planesCount && visible != 0; ++planeIndex) {
+                const Plane& plane = pPlanes[planeIndex];
+
+                __m256 distance = _mm256_mul_ps(_mm256_set1_ps(plane.normal.x), x);
+                distance = _mm256_fmadd_ps(_mm256_set1_ps(plane.normal.y), y, distance);
+                distance = _mm256_fmadd_ps(_mm256_set1_ps(plane.normal.z), z, distance);
+                distance = _mm256_add_ps(distance, _mm256_set1_ps(plane.distance));
+
+                visible &= static_cast<uint32_t>(_mm256_movemask_ps(_mm256_cmp_ps(distance, negativeRadius, _CMP_GE_OQ)));
+            }
+
+            for (uint32_t element = 0; element < 8; ++element) {
+                pVisible[i + element] = static_cast<uint8_t>((visible >> element) & 1U);
+            }
+        }
+
+        Packed::TestSpheres(pPlanes, planesCount, pSpheres + packedCount, pVisible + packedCount, count - packedCount);
+    }
+
+    static const Kernels KERNELS = {
+        Backend::AVX2, &MultiplyMatrices, &Packed::ComposeTRS, &Packed::DecomposeTRS, &Packed::SlerpQuaternions, &TransformAABBs, &TestSpheres
+    };
+}
+#endif
+
+namespace SR_MATH_NS::SIMD {
+    static const Kernels* GetKernels(Backend backend) {
+        switch (backend) {
+            case Backend::Scalar:
+                return &Scalar::KERNELS;
+        #if defined(SR_SIMD_SSE)
+            case Backend::SSE:
+                return &Packed::KERNELS;
+        #endif
+        #if defined(SR_SIMD_AVX2)
+            case Backend::AVX2:
+                return AVX2::IsSupported() ? &AVX2::KERNELS : nullptr;
+        #endif
+        #if defined(SR_SIMD_NEON)
+            case Backend::NEON:
+                return &Packed::KERNELS;
+        #endif
+            default:
+                return nullptr;
+        }
+    }
+
+    static std::atomic<const Kernels*>& GetActiveKernels() {
+        static std::atomic<const Kernels*> kernels = []() -> const Kernels* {
+            for (auto&& backend : { Backend::AVX2, Backend::SSE, Backend::NEON }) {
+                if (auto&& pKernels = GetKernels(backend)) {
+                    return pKernels;
+                }
+            }
+            return &Scalar::KERNELS;
+        }();
+        return kernels;
+    }
+
+    SR_FORCE_INLINE static const Kernels& ActiveKernels() {
+        return *GetActiveKernels().load(std::memory_order_relaxed);
+    }
+
+    Backend GetBackend() {
+        return ActiveKernels().backend;
+    }
+
+    const char* GetBackendName(Backend backend) {
+        switch (backend) {
+            case Backend::Scalar: return "Scalar";
+            case Backend::SSE: return "SSE";
+            case Backend::AVX2: return "AVX2";
+            case Backend::NEON: return "NEON";
+            default:
+                return "Unknown";
+        }
+    }
+
+    bool IsBackendSupported(Backend backend) {
+        return GetKernels(backend) != nullptr;
+    }
+
+    bool SetBackend(Backend backend) {
+        if (auto&& pKernels = GetKernels(backend)) {
+            GetActiveKernels().store(pKernels, std::memory_order_relaxed);
+            return true;
+        }
+
+        return false;
+    }
+
+    void MultiplyMatrices(const Matrix4x4* pLeft, const Matrix4x4* pRight, Matrix4x4* pResult, uint64_t count) {
+        ActiveKernels().multiplyMatrices(pLeft, 1, pRight, pResult, count);
+    }
+
+    void MultiplyMatrices(const Matrix4x4& left, const Matrix4x4* pRight, Matrix4x4* pResult, uint64_t count) {
+        ActiveKernels().multiplyMatrices(&left, 0, pRight, pResult, count);
+    }
+
+    void ComposeTRS(const FVector3* pTranslation, const Quaternion* pRotation, const FVector3* pScale, Matrix4x4* pResult, uint64_t count) {
+        ActiveKernels().composeTRS(pTranslation, pRotation, pScale, pResult, count);
+    }
+
+    void DecomposeTRS(const Matrix4x4* pMatrices, FVector3* pTranslation, Quaternion* pRotation, FVector3* pScale, uint64_t count) {
+        ActiveKernels().decomposeTRS(pMatrices, pTranslation, pRotation, pScale, count);
+    }
+
+    void SlerpQuaternions(const Quaternion* pFrom, const Quaternion* pTo, const float_t* pT, Quaternion* pResult, uint64_t count) {
+        ActiveKernels().slerpQuaternions(pFrom, pTo, pT, pResult, count);
+    }
+
+    void TransformAABBs(const Matrix4x4* pMatrices, const AABB* pBounds, AABB* pResult, uint64_t count) {
+        ActiveKernels().transformAABBs(pMatrices, pBounds, pResult, count);
+    }
+
+    void TestSpheres(const Plane* pPlanes, uint32_t planesCount, const Sphere* pSpheres, uint8_t* pVisible, uint64_t count) {
+        ActiveKernels().testSpheres(pPlanes, planesCount, pSpheres, pVisible, count);
+    }
+}
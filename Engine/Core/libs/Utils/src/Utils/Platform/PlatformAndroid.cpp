@@ -5,6 +5,7 @@
 #include <Utils/Platform/Platform.h>
 #include <Utils/Common/StringFormat.h>
 #include <Utils/Debug.h>
+#include <Utils/Input/InputSource.h>
 
 #include <Utils/Platform/AndroidNativeAppGlue.h>
 
@@ -190,5 +191,8 @@ namespace SR_UTILS_NS::Platform {
 
         return resolutions;
     }
-}
 
+    std::unique_ptr<InputSource> CreateInputSource() {
+        return nullptr;
+    }
+}
@@ -5,6 +5,7 @@
 #include <Utils/Platform/Platform.h>
 #include <Utils/Common/StringFormat.h>
 #include <Utils/Debug.h>
+#include <Utils/Input/EvdevInputSource.h>
 
 #include <X11/Xlib.h>
 #include <X11/extensions/Xrandr.h>
@@ -19,6 +20,7 @@
 
 namespace SR_UTILS_NS::Platform {
     void SegmentationHandler(int sig) {
+        SR_UTILS_NS::Debug::Instance().FlushOnCrash();
         WriteConsoleError("Crash stacktrace: \n" + SR_UTILS_NS::GetStacktrace());
         Breakpoint();
         exit(1);
@@ -317,5 +319,12 @@ namespace SR_UTILS_NS::Platform {
     PlatformType GetType() {
         return PlatformType::Linux;
     }
-}
 
+    std::unique_ptr<InputSource> CreateInputSource() {
+        auto pSource = std::make_unique<EvdevInputSource>();
+        if (!pSource->Open()) {
+            return nullptr;
+        }
+        return pSource;
+    }
+}
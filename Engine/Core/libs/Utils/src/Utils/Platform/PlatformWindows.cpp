@@ -5,6 +5,7 @@
 #include <Utils/Platform/Platform.h>
 #include <Utils/Common/StringFormat.h>
 #include <Utils/Debug.h>
+#include <Utils/Input/InputSource.h>
 
 #include <Windows.h>
 #include <Psapi.h>
@@ -92,7 +93,48 @@ namespace SR_UTILS_NS::Platform {
 }
 
 namespace SR_UTILS_NS::Platform {
+    namespace {
+        /**
+         * Опрос идет с потока Input, а GetKeyboardState видит только очередь сообщений своего потока,
+         * поэтому состояние берется из GetAsyncKeyState, которому поток не важен.
+         * Пока активно окно другого процесса, все клавиши считаются отпущенными.
+         */
+        class AsyncKeyStateInputSource : public SR_UTILS_NS::PolledInputSource {
+        public:
+            SR_NODISCARD std::string_view GetName() const override { return "AsyncKeyState"; }
+
+        protected:
+            bool ReadKeyboardState(uint8_t* pKeys) override {
+                std::fill(pKeys, pKeys + 256, 0);
+
+                auto&& hWindow = GetForegroundWindow();
+                if (!hWindow) {
+                    return true;
+                }
+
+                DWORD processId = 0;
+                GetWindowThreadProcessId(hWindow, &processId);
+                if (processId != GetCurrentProcessId()) {
+                    return true;
+                }
+
+                for (int32_t key = 1; key < 256; ++key) {
+                    pKeys[key] = (GetAsyncKeyState(key) & 0x8000) != 0 ? 0x80 : 0;
+                }
+
+                /// GetAsyncKeyState отдает физические кнопки мыши, без учета смены левой и правой
+                if (GetSystemMetrics(SM_SWAPBUTTON) != 0) {
+                    std::swap(pKeys[VK_LBUTTON], pKeys[VK_RBUTTON]);
+                }
+
+                return true;
+            }
+
+        };
+    }
+
     void SegmentationHandler(int sig) {
+        SR_UTILS_NS::Debug::Instance().FlushOnCrash();
         WriteConsoleError("Application crashed!\n" + SR_UTILS_NS::GetStacktrace());
         Breakpoint();
         exit(1);
@@ -529,4 +571,8 @@ namespace SR_UTILS_NS::Platform {
     PlatformType GetType() {
         return PlatformType::Windows;
     }
+
+    std::unique_ptr<InputSource> CreateInputSource() {
+        return std::make_unique<AsyncKeyStateInputSource>();
+    }
 }
\ No newline at end of file
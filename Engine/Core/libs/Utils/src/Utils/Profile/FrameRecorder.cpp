@@ -0,0 +1,458 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Utils/Profile/FrameRecorder.h>
+#include <Utils/Input/InputSystem.h>
+#include <Utils/Platform/Platform.h>
+#include <Utils/Debug.h>
+
+namespace SR_UTILS_NS {
+    namespace {
+        template<typename T> void WriteValue(std::string& data, const T& value) {
+            data.append(reinterpret_cast<const char*>(&value), sizeof(T));
+        }
+
+        /// Чтение с проверкой границ, после первой ошибки все значения нулевые
+        struct RecordReader {
+            const std::string& data;
+            uint64_t position = 0;
+            bool isFailed = false;
+
+            template<typename T> T Read() {
+                T value = T();
+                if (isFailed || position + sizeof(T) > data.size()) {
+                    isFailed = true;
+                    return value;
+                }
+                std::memcpy(&value, data.data() + position, sizeof(T));
+                position += sizeof(T);
+                return value;
+            }
+
+            /// счетчик не может быть больше, чем элементов минимального размера в остатке файла
+            uint64_t ReadCount(uint64_t minElementSize) {
+                const uint64_t count = Read<uint32_t>();
+                if (count > (data.size() - SR_MIN(position, data.size())) / minElementSize) {
+                    isFailed = true;
+                    return 0;
+                }
+                return count;
+            }
+        };
+
+        constexpr uint64_t RECORDED_EVENT_SIZE = sizeof(int64_t) + 2 * sizeof(uint8_t);
+    }
+
+    void FrameRecorder::Reset() {
+        m_mode = FrameRecorderMode::None;
+        m_isReplayFinished = false;
+        m_path = Path();
+        m_frames.clear();
+        m_results.clear();
+        m_frame = 0;
+        m_step = 0;
+        m_isFrameActive = false;
+        m_mismatches = 0;
+    }
+
+    bool FrameRecorder::StartRecording(const Path& path) {
+        SR_LOCK_GUARD;
+
+        if (IsActive()) {
+            Stop();
+        }
+
+        Reset();
+
+        m_path = path;
+        m_mode = FrameRecorderMode::Record;
+
+        /// запись и воспроизведение начинаются с отпущенных клавиш
+        Input::Instance().Reload();
+
+        if (!Input::Instance().HasSources()) {
+            SR_WARN("FrameRecorder::StartRecording() : there are no input sources, keyboard will not be recorded!");
+        }
+
+        SR_LOG("FrameRecorder::StartRecording() : recording session to \"{}\"", path.ToStringRef());
+
+        return true;
+    }
+
+    bool FrameRecorder::StartReplay(const Path& path) {
+        SR_LOCK_GUARD;
+
+        if (IsActive()) {
+            Stop();
+        }
+
+        Reset();
+
+        auto&& data = SR_PLATFORM_NS::ReadFile(path);
+        if (!data) {
+            SR_ERROR("FrameRecorder::StartReplay() : file not exists!\n\tPath: {}", path.ToStringRef());
+            return false;
+        }
+
+        if (!Deserialize(data.value(), m_frames) || m_frames.empty()) {
+            SR_ERROR("FrameRecorder::StartReplay() : invalid or empty record!\n\tPath: {}", path.ToStringRef());
+            m_frames.clear();
+            return false;
+        }
+
+        m_path = path;
+        m_results.reserve(m_frames.size());
+        m_mode = FrameRecorderMode::Replay;
+
+        Input::Instance().Reload();
+
+        SR_LOG("FrameRecorder::StartReplay() : replaying {} frames from \"{}\"", m_frames.size(), path.ToStringRef());
+
+        return true;
+    }
+
+    void FrameRecorder::Stop() {
+        SR_LOCK_GUARD;
+
+        switch (m_mode) {
+            case FrameRecorderMode::Record: {
+                /// последний кадр мог прерваться на середине
+                if (m_isFrameActive) {
+                    m_frames.pop_back();
+                }
+
+                const std::string data = Serialize(m_frames);
+
+                std::ofstream file;
+                if (m_path.Create()) {
+                    file.open(m_path.ToString(), std::ios::binary);
+                }
+
+                if (file.is_open() && file.write(data.data(), static_cast<std::streamsize>(data.size()))) {
+                    SR_LOG("FrameRecorder::Stop() : recorded {} frames, {} bytes\n\tPath: {}", m_frames.size(), data.size(), m_path.ToStringRef());
+                }
+                else {
+                    SR_ERROR("FrameRecorder::Stop() : failed to save record!\n\tPath: {}", m_path.ToStringRef());
+                }
+                break;
+            }
+            case FrameRecorderMode::Replay:
+                SaveReport();
+                break;
+            default:
+                break;
+        }
+
+        Reset();
+    }
+
+    uint64_t FrameRecorder::BeginFrame(uint64_t deltaTime) {
+        if (!IsActive()) {
+            return deltaTime;
+        }
+
+        SR_LOCK_GUARD;
+
+        if (m_mode == FrameRecorderMode::Record) {
+            m_frame = m_frames.size();
+
+            auto&& frame = m_frames.emplace_back();
+            frame.deltaTime = deltaTime;
+            frame.seed = m_randomDevice();
+        }
+        else if (m_frame >= m_frames.size()) {
+            m_isReplayFinished = true;
+            return deltaTime;
+        }
+
+        auto&& frame = m_frames[m_frame];
+
+        m_random.seed(frame.seed);
+
+        m_step = 0;
+        m_isFrameActive = true;
+        m_frameStart = std::chrono::steady_clock::now();
+
+        return frame.deltaTime;
+    }
+
+    uint32_t FrameRecorder::ScheduleFixedSteps(uint32_t fixedSteps) {
+        if (!IsActive()) {
+            return fixedSteps;
+        }
+
+        SR_LOCK_GUARD;
+
+        if (!m_isFrameActive) {
+            return fixedSteps;
+        }
+
+        auto&& frame = m_frames[m_frame];
+
+        if (m_mode == FrameRecorderMode::Record) {
+            frame.fixedSteps = fixedSteps;
+        }
+
+        return frame.fixedSteps;
+    }
+
+    bool FrameRecorder::BeginFixedStep(bool isFocused) {
+        if (!IsActive()) {
+            return isFocused;
+        }
+
+        SR_LOCK_GUARD;
+
+        if (!m_isFrameActive) {
+            return isFocused;
+        }
+
+        auto&& frame = m_frames[m_frame];
+        ++m_step;
+
+        if (m_mode == FrameRecorderMode::Record) {
+            frame.steps.emplace_back().isFocused = isFocused;
+            return isFocused;
+        }
+
+        return m_step <= frame.steps.size() && frame.steps[m_step - 1].isFocused;
+    }
+
+    RecordedStep* FrameRecorder::GetCurrentStep() {
+        if (!m_isFrameActive || m_step == 0 || m_step > m_frames[m_frame].steps.size()) {
+            return nullptr;
+        }
+
+        return &m_frames[m_frame].steps[m_step - 1];
+    }
+
+    void FrameRecorder::ScheduleInput(std::vector<RawInputEvent>& events, SR_MATH_NS::FVector2& mouse, SR_MATH_NS::FVector2& scroll, InputTimestamp now) {
+        if (!IsActive()) {
+            return;
+        }
+
+        SR_LOCK_GUARD;
+
+        auto&& pStep = GetCurrentStep();
+
+        if (m_mode == FrameRecorderMode::Record) {
+            if (!pStep) {
+                return;
+            }
+
+            pStep->mouse = mouse;
+            pStep->scroll = scroll;
+            pStep->events.reserve(events.size());
+
+            for (auto&& event : events) {
+                pStep->events.emplace_back(RecordedInputEvent {
+                    static_cast<int64_t>(now - event.timestamp), event.key, event.pressed
+                });
+            }
+
+            return;
+        }
+
+        /// живой ввод при воспроизведении отбрасывается целиком
+        events.clear();
+
+        if (!pStep) {
+            return;
+        }
+
+        mouse = pStep->mouse;
+        scroll = pStep->scroll;
+
+        for (auto&& event : pStep->events) {
+            events.emplace_back(RawInputEvent {
+                static_cast<InputTimestamp>(static_cast<int64_t>(now) - event.age), event.key, event.pressed
+            });
+        }
+    }
+
+    void FrameRecorder::EndFrame(uint64_t checksum) {
+        if (!IsActive()) {
+            return;
+        }
+
+        SR_LOCK_GUARD;
+
+        if (!m_isFrameActive) {
+            return;
+        }
+
+        m_isFrameActive = false;
+
+        auto&& frame = m_frames[m_frame];
+
+        if (m_mode == FrameRecorderMode::Record) {
+            frame.checksum = checksum;
+            return;
+        }
+
+        const uint64_t frameTime = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - m_frameStart
+        ).count());
+
+        m_results.emplace_back(ReplayFrameResult { frameTime, checksum, frame.checksum });
+
+        if (checksum != frame.checksum && ++m_mismatches == 1) {
+            SR_WARN("FrameRecorder::EndFrame() : replay diverged at frame {}! Checksum {:016x}, expected {:016x}",
+                m_frame, checksum, frame.checksum);
+        }
+
+        if (++m_frame >= m_frames.size()) {
+            m_isReplayFinished = true;
+        }
+    }
+
+    float_t FrameRecorder::RandomFloat(float_t minimum, float_t maximum) {
+        SR_LOCK_GUARD;
+        std::uniform_real_distribution<float_t> distribution(minimum, maximum);
+        return distribution(m_random);
+    }
+
+    int32_t FrameRecorder::RandomInt32(int32_t minimum, int32_t maximum) {
+        SR_LOCK_GUARD;
+        std::uniform_int_distribution<int32_t> distribution(minimum, maximum);
+        return distribution(m_random);
+    }
+
+    void FrameRecorder::SaveReport() const {
+        if (m_results.empty()) {
+            SR_WARN("FrameRecorder::SaveReport() : no frames were replayed!");
+            return;
+        }
+
+        const Path reportPath = m_path.ConcatExt("csv");
+
+        std::ofstream file;
+        if (reportPath.Create()) {
+            file.open(reportPath.ToString());
+        }
+
+        if (file.is_open()) {
+            file << "Frame,DeltaTime(ms),FrameTime(ms),Checksum,Expected,Match\n";
+        }
+
+        std::vector<uint64_t> frameTimes;
+        frameTimes.reserve(m_results.size());
+
+        for (uint64_t i = 0; i < m_results.size(); ++i) {
+            auto&& result = m_results[i];
+            frameTimes.emplace_back(result.frameTime);
+
+            if (file.is_open()) {
+                file << SR_FORMAT("{},{:.3f},{:.3f},{:016x},{:016x},{}\n", i,
+                    static_cast<double_t>(m_frames[i].deltaTime) / 1e6, static_cast<double_t>(result.frameTime) / 1e6,
+                    result.checksum, result.expectedChecksum, result.checksum == result.expectedChecksum ? 1 : 0);
+            }
+        }
+
+        if (!file.is_open()) {
+            SR_ERROR("FrameRecorder::SaveReport() : failed to save report!\n\tPath: {}", reportPath.ToStringRef());
+        }
+
+        std::sort(frameTimes.begin(), frameTimes.end());
+
+        const double_t average = static_cast<double_t>(std::accumulate(frameTimes.begin(), frameTimes.end(), static_cast<uint64_t>(0)))
+            / static_cast<double_t>(frameTimes.size()) / 1e6;
+        const double_t p95 = static_cast<double_t>(frameTimes[(frameTimes.size() - 1) * 95 / 100]) / 1e6;
+
+        SR_LOG("FrameRecorder::SaveReport() : replayed {}/{} frames, {} checksum mismatches\n"
+            "\tFrame time: avg {:.3f} ms, min {:.3f} ms, p95 {:.3f} ms, max {:.3f} ms\n\tReport: {}",
+            m_results.size(), m_frames.size(), m_mismatches, average,
+            static_cast<double_t>(frameTimes.front()) / 1e6, p95, static_cast<double_t>(frameTimes.back()) / 1e6,
+            reportPath.ToStringRef());
+    }
+
+    std::string FrameRecorder::Serialize(const std::vector<RecordedFrame>& frames) {
+        std::string data;
+
+        WriteValue<uint32_t>(data, MAGIC);
+        WriteValue<uint32_t>(data, VERSION);
+        WriteValue<uint32_t>(data, static_cast<uint32_t>(frames.size()));
+
+        for (auto&& frame : frames) {
+            WriteValue<uint64_t>(data, frame.deltaTime);
+            WriteValue<uint32_t>(data, frame.seed);
+            WriteValue<uint32_t>(data, frame.fixedSteps);
+            WriteValue<uint64_t>(data, frame.checksum);
+            WriteValue<uint32_t>(data, static_cast<uint32_t>(frame.steps.size()));
+
+            for (auto&& step : frame.steps) {
+                WriteValue<uint8_t>(data, step.isFocused ? 1 : 0);
+
+                /// без фокуса ввод не опрашивается, пишется только флаг
+                if (!step.isFocused) {
+                    continue;
+                }
+
+                WriteValue<float_t>(data, step.mouse.x);
+                WriteValue<float_t>(data, step.mouse.y);
+                WriteValue<float_t>(data, step.scroll.x);
+                WriteValue<float_t>(data, step.scroll.y);
+                WriteValue<uint32_t>(data, static_cast<uint32_t>(step.events.size()));
+
+                for (auto&& event : step.events) {
+                    WriteValue<int64_t>(data, event.age);
+                    WriteValue<uint8_t>(data, static_cast<uint8_t>(event.key));
+                    WriteValue<uint8_t>(data, event.pressed ? 1 : 0);
+                }
+            }
+        }
+
+        return data;
+    }
+
+    bool FrameRecorder::Deserialize(const std::string& data, std::vector<RecordedFrame>& frames) {
+        RecordReader reader { data };
+
+        if (reader.Read<uint32_t>() != MAGIC || reader.Read<uint32_t>() != VERSION) {
+            return false;
+        }
+
+        frames.clear();
+        frames.resize(reader.ReadCount(sizeof(uint64_t)));
+
+        for (auto&& frame : frames) {
+            frame.deltaTime = reader.Read<uint64_t>();
+            frame.seed = reader.Read<uint32_t>();
+            frame.fixedSteps = reader.Read<uint32_t>();
+            frame.checksum = reader.Read<uint64_t>();
+            frame.steps.resize(reader.ReadCount(sizeof(uint8_t)));
+
+            for (auto&& step : frame.steps) {
+                step.isFocused = reader.Read<uint8_t>() != 0;
+
+                if (!step.isFocused) {
+                    continue;
+                }
+
+                step.mouse.x = reader.Read<float_t>();
+                step.mouse.y = reader.Read<float_t>();
+                step.scroll.x = reader.Read<float_t>();
+                step.scroll.y = reader.Read<float_t>();
+                step.events.resize(reader.ReadCount(RECORDED_EVENT_SIZE));
+
+                for (auto&& event : step.events) {
+                    event.age = reader.Read<int64_t>();
+                    event.key = static_cast<KeyCode>(reader.Read<uint8_t>());
+                    event.pressed = reader.Read<uint8_t>() != 0;
+                }
+            }
+
+            if (reader.isFailed) {
+                break;
+            }
+        }
+
+        if (reader.isFailed || reader.position != data.size()) {
+            frames.clear();
+            return false;
+        }
+
+        return true;
+    }
+}
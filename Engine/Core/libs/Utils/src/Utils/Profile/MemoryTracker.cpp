@@ -0,0 +1,255 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Utils/Profile/MemoryTracker.h>
+#include <Utils/Profile/Profiler.h>
+#include <Utils/Debug.h>
+
+namespace SR_UTILS_NS {
+    std::atomic<uint32_t> MemoryTracker::s_sampleRate = 0;
+    std::atomic<bool> MemoryTracker::s_enabled = true;
+
+    struct MemoryTracker::ThreadCounters {
+        /// счетчики одного тега лежат рядом, чтобы выделение трогало одну кеш-линию
+        struct Tag {
+            std::atomic<int64_t> bytes = 0;
+            std::atomic<int64_t> allocations = 0;
+            std::atomic<uint64_t> totalAllocations = 0;
+        };
+
+        /// пишет только поток-владелец, поэтому без read-modify-write, Update только читает
+        std::array<Tag, MemoryTagsCount> tags;
+
+        uint32_t sampleCounter = 0;
+        bool isSampling = false;
+    };
+
+    namespace {
+        /// размер кратен выравниванию malloc, поэтому данные за заголовком выровнены так же
+        struct alignas(alignof(std::max_align_t)) AllocationHeader {
+            uint64_t size = 0;
+            MemoryTag tag = MemoryTag::Unknown;
+            bool isSampled = false;
+            /// выделено при выключенном трекере, в счетчиках не участвует
+            bool isTracked = false;
+            /// расстояние от начала блока malloc до данных, больше заголовка только у выровненных выделений
+            uint32_t offset = 0;
+        };
+
+        constexpr const char* MEMORY_TAG_NAMES[MemoryTagsCount] = {
+            "Unknown", "Resources", "Scene", "Mesh", "Marshal", "Audio", "Scripts"
+        };
+
+        /// имена счетчиков профайлера должны быть литералами
+        constexpr const char* MEMORY_COUNTER_NAMES[MemoryTagsCount] = {
+            "Memory: Unknown", "Memory: Resources", "Memory: Scene", "Memory: Mesh",
+            "Memory: Marshal", "Memory: Audio", "Memory: Scripts"
+        };
+
+        template<typename T> void AddCounter(std::atomic<T>& counter, T value) noexcept {
+            counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+        }
+
+        void* AllocateBlock(MemoryTag tag, uint64_t size, uint64_t alignment, bool isTracked) noexcept {
+            /// запас на сдвиг данных до границы alignment, заголовок всегда лежит вплотную перед данными
+            const uint64_t padding = alignment - alignof(AllocationHeader);
+
+            auto&& pBlock = static_cast<char*>(malloc(sizeof(AllocationHeader) + padding + size));
+            if (!pBlock) {
+                return nullptr;
+            }
+
+            uint32_t offset = sizeof(AllocationHeader);
+            if (padding != 0) {
+                const auto address = reinterpret_cast<uintptr_t>(pBlock) + sizeof(AllocationHeader);
+                offset = static_cast<uint32_t>(((address + alignment - 1) & ~(alignment - 1)) - reinterpret_cast<uintptr_t>(pBlock));
+            }
+
+            auto&& pHeader = reinterpret_cast<AllocationHeader*>(pBlock + offset) - 1;
+            new (pHeader) AllocationHeader { size, tag, false, isTracked, offset };
+
+            return pHeader + 1;
+        }
+    }
+
+    MemoryTracker::MemoryTracker() = default;
+    MemoryTracker::~MemoryTracker() = default;
+
+    const char* GetMemoryTagName(MemoryTag tag) noexcept {
+        if (tag >= MemoryTag::Count) {
+            return "Invalid";
+        }
+        return MEMORY_TAG_NAMES[static_cast<uint64_t>(tag)];
+    }
+
+    MemoryTracker::ThreadCounters* MemoryTracker::GetThreadCounters() noexcept {
+        thread_local ThreadCounters* pCounters = nullptr;
+
+        /// регистрация потока вынесена отдельно, чтобы проверка встраивалась в Allocate и Free
+        if (SR_UNLIKELY(!pCounters)) {
+            pCounters = RegisterThread();
+        }
+
+        return pCounters;
+    }
+
+    MemoryTracker::ThreadCounters* MemoryTracker::RegisterThread() noexcept {
+        auto&& tracker = Instance();
+        std::lock_guard lock(tracker.m_mutex);
+
+        /// буферы не освобождаются при выходе потока, иначе потеряется его вклад в счетчики
+        return tracker.m_threads.emplace_back(std::make_unique<ThreadCounters>()).get();
+    }
+
+    void* MemoryTracker::Allocate(MemoryTag tag, uint64_t size) noexcept {
+        return Allocate(tag, size, alignof(AllocationHeader));
+    }
+
+    void* MemoryTracker::Allocate(MemoryTag tag, uint64_t size, uint64_t alignment) noexcept {
+        alignment = SR_MAX(alignment, static_cast<uint64_t>(alignof(AllocationHeader)));
+
+        if (!IsEnabled()) {
+            return AllocateBlock(tag, size, alignment, false);
+        }
+
+        auto&& pData = AllocateBlock(tag, size, alignment, true);
+        if (!pData) {
+            return nullptr;
+        }
+
+        auto&& pCounters = GetThreadCounters();
+        auto&& counters = pCounters->tags[static_cast<uint64_t>(tag)];
+
+        AddCounter<int64_t>(counters.bytes, static_cast<int64_t>(size));
+        AddCounter<int64_t>(counters.allocations, 1);
+        AddCounter<uint64_t>(counters.totalAllocations, 1);
+
+        if (const uint32_t rate = GetSampleRate(); SR_UNLIKELY(rate != 0) && !pCounters->isSampling && ++pCounters->sampleCounter >= rate) {
+            pCounters->sampleCounter = 0;
+            pCounters->isSampling = true;
+            (static_cast<AllocationHeader*>(pData) - 1)->isSampled = true;
+            Sample(pData, tag, size);
+            pCounters->isSampling = false;
+        }
+
+        return pData;
+    }
+
+    void MemoryTracker::Free(void* pData) noexcept {
+        if (!pData) {
+            return;
+        }
+
+        auto&& pHeader = static_cast<AllocationHeader*>(pData) - 1;
+
+        if (SR_UNLIKELY(pHeader->isSampled)) {
+            auto&& tracker = Instance();
+            std::lock_guard lock(tracker.m_samplesMutex);
+            tracker.m_samples.erase(pData);
+        }
+
+        if (pHeader->isTracked) {
+            OnFree(pHeader->tag, pHeader->size);
+        }
+
+        free(static_cast<char*>(pData) - pHeader->offset);
+    }
+
+    void MemoryTracker::OnAllocate(MemoryTag tag, uint64_t size) noexcept {
+        auto&& counters = GetThreadCounters()->tags[static_cast<uint64_t>(tag)];
+
+        AddCounter<int64_t>(counters.bytes, static_cast<int64_t>(size));
+        AddCounter<int64_t>(counters.allocations, 1);
+        AddCounter<uint64_t>(counters.totalAllocations, 1);
+    }
+
+    void MemoryTracker::OnFree(MemoryTag tag, uint64_t size) noexcept {
+        auto&& counters = GetThreadCounters()->tags[static_cast<uint64_t>(tag)];
+
+        AddCounter<int64_t>(counters.bytes, -static_cast<int64_t>(size));
+        AddCounter<int64_t>(counters.allocations, -1);
+    }
+
+    void MemoryTracker::Sample(void* pData, MemoryTag tag, uint64_t size) {
+        MemorySample sample;
+        sample.tag = tag;
+        sample.size = size;
+        sample.stacktrace = GetStacktrace();
+
+        auto&& tracker = Instance();
+        std::lock_guard lock(tracker.m_samplesMutex);
+        tracker.m_samples[pData] = std::move(sample);
+    }
+
+    void MemoryTracker::Update() {
+        SR_LOCK_GUARD;
+
+        for (uint64_t i = 0; i < MemoryTagsCount; ++i) {
+            auto&& stats = m_stats[i];
+
+            stats.bytes = 0;
+            stats.allocations = 0;
+            stats.totalAllocations = 0;
+
+            for (auto&& pCounters : m_threads) {
+                auto&& counters = pCounters->tags[i];
+                stats.bytes += counters.bytes.load(std::memory_order_relaxed);
+                stats.allocations += counters.allocations.load(std::memory_order_relaxed);
+                stats.totalAllocations += counters.totalAllocations.load(std::memory_order_relaxed);
+            }
+
+            stats.peakBytes = SR_MAX(stats.peakBytes, stats.bytes);
+
+            SR_PROFILE_COUNTER(MEMORY_COUNTER_NAMES[i], stats.bytes);
+        }
+    }
+
+    std::array<MemoryTagStats, MemoryTagsCount> MemoryTracker::GetStats() const {
+        SR_LOCK_GUARD;
+        return m_stats;
+    }
+
+    std::vector<MemorySample> MemoryTracker::GetLiveSamples() const {
+        std::lock_guard lock(m_samplesMutex);
+
+        std::vector<MemorySample> samples;
+        samples.reserve(m_samples.size());
+
+        for (auto&& [pData, sample] : m_samples) {
+            samples.emplace_back(sample);
+        }
+
+        return samples;
+    }
+
+    uint64_t MemoryTracker::ReportLeaks() {
+        Update();
+
+        const auto allStats = GetStats();
+        uint64_t leaks = 0;
+
+        for (uint64_t i = 0; i < MemoryTagsCount; ++i) {
+            auto&& stats = allStats[i];
+            if (stats.allocations == 0) {
+                continue;
+            }
+
+            leaks += static_cast<uint64_t>(SR_MAX(stats.allocations, 0));
+
+            SR_WARN("MemoryTracker::ReportLeaks() : {} - {} allocations, {} bytes not freed (peak {} bytes)",
+                MEMORY_TAG_NAMES[i], stats.allocations, stats.bytes, stats.peakBytes);
+        }
+
+        for (auto&& sample : GetLiveSamples()) {
+            SR_WARN("MemoryTracker::ReportLeaks() : sampled allocation of {} bytes [{}] not freed\n{}",
+                sample.size, GetMemoryTagName(sample.tag), sample.stacktrace);
+        }
+
+        if (leaks == 0) {
+            SR_LOG("MemoryTracker::ReportLeaks() : all tracked memory was freed");
+        }
+
+        return leaks;
+    }
+}
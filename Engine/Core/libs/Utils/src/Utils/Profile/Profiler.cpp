@@ -0,0 +1,318 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Utils/Profile/Profiler.h>
+#include <Utils/Types/Thread.h>
+#include <Utils/Debug.h>
+
+namespace SR_UTILS_NS {
+    std::atomic<bool> Profiler::s_isEnabled = false;
+
+    struct Profiler::ThreadBuffer {
+        /// владелец берет блокировку только на запись готовой зоны, экспорт читает под ней же
+        mutable std::mutex mutex;
+        std::vector<ProfileZone> zones;
+        uint64_t dropped = 0;
+
+        std::array<std::pair<const char*, uint64_t>, MaxDepth> stack;
+        uint32_t depth = 0;
+        uint32_t index = 0;
+    };
+
+    namespace {
+        const std::chrono::steady_clock::time_point gProfilerEpoch = std::chrono::steady_clock::now();
+
+        void WriteJsonString(std::ostream& stream, const char* str) {
+            stream << '"';
+            for (; str && *str; ++str) {
+                switch (*str) {
+                    case '"': stream << "\\\""; break;
+                    case '\\': stream << "\\\\"; break;
+                    case '\n': stream << "\\n"; break;
+                    case '\t': stream << "\\t"; break;
+                    default:
+                        if (static_cast<uint8_t>(*str) < 0x20) {
+                            stream << ' ';
+                        }
+                        else {
+                            stream << *str;
+                        }
+                        break;
+                }
+            }
+            stream << '"';
+        }
+
+        void WriteCsvString(std::ostream& stream, const char* str) {
+            stream << '"';
+            for (; str && *str; ++str) {
+                if (*str == '"') {
+                    stream << '"';
+                }
+                stream << *str;
+            }
+            stream << '"';
+        }
+    }
+
+    Profiler::Profiler() = default;
+    Profiler::~Profiler() = default;
+
+    uint64_t Profiler::Now() noexcept {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - gProfilerEpoch).count());
+    }
+
+    Profiler::ThreadBuffer* Profiler::GetThreadBuffer() noexcept {
+        thread_local ThreadBuffer* pBuffer = nullptr;
+
+        if (!pBuffer) {
+            auto&& profiler = Instance();
+            std::lock_guard lock(profiler.m_mutex);
+
+            auto&& pNewBuffer = std::make_unique<ThreadBuffer>();
+            pNewBuffer->zones.reserve(ThreadZonesCapacity);
+            pNewBuffer->index = static_cast<uint32_t>(profiler.m_threads.size());
+
+            pBuffer = pNewBuffer.get();
+            profiler.m_threads.emplace_back(std::move(pNewBuffer));
+        }
+
+        return pBuffer;
+    }
+
+    void Profiler::BeginZone(const char* name) noexcept {
+        auto&& pBuffer = GetThreadBuffer();
+
+        if (pBuffer->depth < MaxDepth) {
+            pBuffer->stack[pBuffer->depth] = std::make_pair(name, Now());
+        }
+
+        ++pBuffer->depth;
+    }
+
+    void Profiler::EndZone() noexcept {
+        auto&& pBuffer = GetThreadBuffer();
+
+        if (pBuffer->depth == 0) {
+            return;
+        }
+
+        --pBuffer->depth;
+
+        /// слишком глубокие зоны не пишем, но глубину считаем, чтобы не сломать вложенность
+        if (pBuffer->depth >= MaxDepth) {
+            return;
+        }
+
+        ProfileZone zone;
+        zone.name = pBuffer->stack[pBuffer->depth].first;
+        zone.begin = pBuffer->stack[pBuffer->depth].second;
+        zone.end = Now();
+        zone.depth = pBuffer->depth;
+        zone.threadIndex = pBuffer->index;
+
+        std::lock_guard lock(pBuffer->mutex);
+
+        if (pBuffer->zones.size() >= ThreadZonesCapacity) {
+            ++pBuffer->dropped;
+            return;
+        }
+
+        pBuffer->zones.emplace_back(zone);
+    }
+
+    void Profiler::SetEnabled(bool enabled) {
+        if (enabled && !IsEnabled()) {
+            Reset();
+        }
+
+        s_isEnabled = enabled;
+    }
+
+    void Profiler::Reset() {
+        SR_LOCK_GUARD;
+
+        for (auto&& pBuffer : m_threads) {
+            std::lock_guard lock(pBuffer->mutex);
+            pBuffer->zones.clear();
+            pBuffer->dropped = 0;
+        }
+
+        m_counters.clear();
+        m_frameCounters.clear();
+        m_frames.clear();
+
+        m_frameIndex = 0;
+        m_zonesAtFrameBegin = 0;
+        m_droppedAtFrameBegin = 0;
+        m_lastFrame = ProfileFrameStats();
+    }
+
+    void Profiler::BeginFrame() {
+        SR_LOCK_GUARD;
+
+        m_frameBegin = Now();
+        m_frames.emplace_back(m_frameBegin);
+        m_frameCounters.clear();
+        m_zonesAtFrameBegin = CountZones(m_droppedAtFrameBegin);
+    }
+
+    void Profiler::EndFrame() {
+        SR_LOCK_GUARD;
+
+        uint64_t dropped = 0;
+        const uint64_t zones = CountZones(dropped);
+
+        m_lastFrame.frame = m_frameIndex++;
+        m_lastFrame.duration = Now() - m_frameBegin;
+        m_lastFrame.zones = zones - SR_MIN(zones, m_zonesAtFrameBegin);
+        m_lastFrame.droppedZones = dropped - SR_MIN(dropped, m_droppedAtFrameBegin);
+        m_lastFrame.counters = m_frameCounters;
+    }
+
+    void Profiler::SetCounter(const char* name, int64_t value) {
+        SR_LOCK_GUARD;
+
+        /// ограничиваем историю, чтобы забытый включенным профайлер не съел всю память
+        if (m_counters.size() < ThreadZonesCapacity * 4) {
+            ProfileCounterSample sample;
+            sample.name = name;
+            sample.time = Now();
+            sample.value = value;
+            m_counters.emplace_back(sample);
+        }
+
+        for (auto&& [counterName, counterValue] : m_frameCounters) {
+            if (counterName == name || std::strcmp(counterName, name) == 0) {
+                counterValue = value;
+                return;
+            }
+        }
+
+        m_frameCounters.emplace_back(name, value);
+    }
+
+    ProfileFrameStats Profiler::GetLastFrameStats() const {
+        SR_LOCK_GUARD;
+        return m_lastFrame;
+    }
+
+    uint64_t Profiler::CountZones(uint64_t& dropped) const {
+        uint64_t count = 0;
+        dropped = 0;
+
+        for (auto&& pBuffer : m_threads) {
+            std::lock_guard lock(pBuffer->mutex);
+            count += pBuffer->zones.size();
+            dropped += pBuffer->dropped;
+        }
+
+        return count;
+    }
+
+    std::vector<ProfileZone> Profiler::CollectZones() const {
+        std::vector<ProfileZone> zones;
+
+        for (auto&& pBuffer : m_threads) {
+            std::lock_guard lock(pBuffer->mutex);
+            zones.insert(zones.end(), pBuffer->zones.begin(), pBuffer->zones.end());
+        }
+
+        std::stable_sort(zones.begin(), zones.end(), [](const ProfileZone& lhs, const ProfileZone& rhs) {
+            return lhs.begin < rhs.begin;
+        });
+
+        return zones;
+    }
+
+    bool Profiler::SaveChromeTrace(const Path& path) const {
+        SR_LOCK_GUARD;
+
+        std::ofstream stream(path.ToStringRef());
+        if (!stream.is_open()) {
+            SR_ERROR("Profiler::SaveChromeTrace() : failed to open file!\n\tPath: {}", path.ToStringRef());
+            return false;
+        }
+
+        stream << std::fixed << std::setprecision(3);
+
+        /// формат Trace Event: время в микросекундах
+        stream << "{\"traceEvents\":[";
+
+        bool first = true;
+        auto&& separator = [&stream, &first]() {
+            if (!first) {
+                stream << ",\n";
+            }
+            first = false;
+        };
+
+        for (auto&& zone : CollectZones()) {
+            separator();
+            stream << "{\"name\":";
+            WriteJsonString(stream, zone.name);
+            stream << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << zone.threadIndex
+                << ",\"ts\":" << static_cast<double_t>(zone.begin) / 1000.0
+                << ",\"dur\":" << static_cast<double_t>(zone.end - zone.begin) / 1000.0
+                << ",\"args\":{\"depth\":" << zone.depth << "}}";
+        }
+
+        for (auto&& sample : m_counters) {
+            separator();
+            stream << "{\"name\":";
+            WriteJsonString(stream, sample.name);
+            stream << ",\"ph\":\"C\",\"pid\":1,\"ts\":" << static_cast<double_t>(sample.time) / 1000.0
+                << ",\"args\":{\"value\":" << sample.value << "}}";
+        }
+
+        for (auto&& frame : m_frames) {
+            separator();
+            stream << "{\"name\":\"Frame\",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":0,\"ts\":" << static_cast<double_t>(frame) / 1000.0 << "}";
+        }
+
+        stream << "],\"displayTimeUnit\":\"ms\"}\n";
+
+        return stream.good();
+    }
+
+    bool Profiler::SaveCSV(const Path& path) const {
+        SR_LOCK_GUARD;
+
+        std::ofstream stream(path.ToStringRef());
+        if (!stream.is_open()) {
+            SR_ERROR("Profiler::SaveCSV() : failed to open file!\n\tPath: {}", path.ToStringRef());
+            return false;
+        }
+
+        stream << std::fixed << std::setprecision(3);
+
+        stream << "type,thread,name,depth,begin_us,duration_us,value\n";
+
+        for (auto&& zone : CollectZones()) {
+            stream << "zone," << zone.threadIndex << ",";
+            WriteCsvString(stream, zone.name);
+            stream << "," << zone.depth
+                << "," << static_cast<double_t>(zone.begin) / 1000.0
+                << "," << static_cast<double_t>(zone.end - zone.begin) / 1000.0
+                << ",\n";
+        }
+
+        for (auto&& sample : m_counters) {
+            stream << "counter,,";
+            WriteCsvString(stream, sample.name);
+            stream << ",," << static_cast<double_t>(sample.time) / 1000.0 << ",," << sample.value << "\n";
+        }
+
+        for (auto&& frame : m_frames) {
+            stream << "frame,,\"Frame\",," << static_cast<double_t>(frame) / 1000.0 << ",,\n";
+        }
+
+        return stream.good();
+    }
+
+    void Profiler::OnSingletonDestroy() {
+        s_isEnabled = false;
+        Singleton::OnSingletonDestroy();
+    }
+}
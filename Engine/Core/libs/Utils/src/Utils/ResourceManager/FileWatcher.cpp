@@ -6,7 +6,8 @@
 
 namespace SR_UTILS_NS {
     FileWatcher::FileWatcher(const SR_UTILS_NS::Path& path)
-        : SR_HTYPES_NS::SharedPtr<FileWatcher>(this, SharedPtrPolicy::Automatic)
+        /// копии живут и в потоке ResourceManager, и в потоках ресурсов
+        : SR_HTYPES_NS::SharedPtr<FileWatcher>(this, SharedPtrPolicy::Automatic, SharedPtrCounting::Atomic)
         , m_path(path)
         , m_name("Unnamed")
     { }
@@ -16,6 +16,7 @@ namespace SR_UTILS_NS {
     IResource::~IResource() {
         SRAssert2(GetCountUses() == 0, "Resource has uses!");
         SRAssert2(m_watchers.empty(), "Watchers has not stopped!");
+        SRAssert2(m_destroyIndex == SR_UINT32_MAX, "Resource is still in destroy queue!");
     }
 
     bool IResource::Reload() {
@@ -179,7 +180,7 @@ namespace SR_UTILS_NS {
                 Destroy();
             }
 
-            m_lifetime = 0.f;
+            m_lifetime = 0;
 
             return true;
         }
@@ -9,10 +9,13 @@
 #include <Utils/Common/Features.h>
 #include <Utils/Common/StringFormat.h>
 #include <Utils/Common/Hashes.h>
+#include <Utils/Profile/Profiler.h>
 
 namespace SR_UTILS_NS {
     /// Seconds
     const uint64_t ResourceManager::ResourceLifeTime = 30 * SR_CLOCKS_PER_SEC;
+    /// Microseconds
+    const uint64_t ResourceManager::GCTimeBudget = 2000;
 
     bool ResourceManager::Init(const SR_UTILS_NS::Path& resourcesFolder) {
     #ifdef SR_ANDROID
@@ -103,6 +106,10 @@ namespace SR_UTILS_NS {
         }
         m_resources.clear();
 
+        m_registry.Clear();
+        m_slots.clear();
+        m_freeSlots.clear();
+
         for (auto&& pFileWatcher : m_watchers) {
             if (!pFileWatcher->IsActive()) {
                 continue;
@@ -123,11 +130,116 @@ namespace SR_UTILS_NS {
 
         SR_SCOPED_LOCK
 
-        m_destroyed.emplace_back(resource);
+        PushToDestroy(resource);
 
         return true;
     }
 
+    void ResourceManager::PushToDestroy(IResource* pResource) {
+        /// ресурс оживили и снова уничтожили до того, как до него дошел GC
+        if (pResource->m_destroyIndex != SR_UINT32_MAX) {
+            m_destroyed[pResource->m_destroyIndex].time = static_cast<uint64_t>(clock());
+            return;
+        }
+
+        pResource->m_destroyIndex = static_cast<uint32_t>(m_destroyed.size());
+
+        DestroyEntry entry;
+        entry.pResource = pResource;
+        entry.time = static_cast<uint64_t>(clock());
+        m_destroyed.emplace_back(entry);
+    }
+
+    void ResourceManager::EraseFromDestroy(IResource* pResource) {
+        const uint32_t index = pResource->m_destroyIndex;
+
+        if (index >= m_destroyed.size() || m_destroyed[index].pResource != pResource) {
+            SRHalt("ResourceManager::EraseFromDestroy() : resource isn't in destroy queue!");
+            return;
+        }
+
+        if (index + 1 != m_destroyed.size()) {
+            m_destroyed[index] = m_destroyed.back();
+            m_destroyed[index].pResource->m_destroyIndex = index;
+        }
+
+        m_destroyed.pop_back();
+        pResource->m_destroyIndex = SR_UINT32_MAX;
+    }
+
+    ResourceHandle ResourceManager::AllocateHandle(IResource* pResource) {
+        ResourceHandle handle;
+
+        if (m_freeSlots.empty()) {
+            handle.index = static_cast<uint32_t>(m_slots.size());
+            m_slots.emplace_back();
+        }
+        else {
+            handle.index = m_freeSlots.back();
+            m_freeSlots.pop_back();
+        }
+
+        auto&& slot = m_slots[handle.index];
+        slot.pResource = pResource;
+        handle.generation = slot.generation;
+
+        return handle;
+    }
+
+    void ResourceManager::FreeHandle(IResource* pResource) {
+        auto&& handle = pResource->m_handle;
+
+        if (!handle.Valid()) {
+            return;
+        }
+
+        if (handle.index >= m_slots.size() || m_slots[handle.index].pResource != pResource) {
+            SRHalt("ResourceManager::FreeHandle() : invalid resource handle!");
+            return;
+        }
+
+        auto&& slot = m_slots[handle.index];
+        slot.pResource = nullptr;
+        ++slot.generation;
+
+        m_freeSlots.emplace_back(handle.index);
+
+        handle = ResourceHandle();
+    }
+
+    IResource* ResourceManager::Resolve(const ResourceHandle& handle) const {
+        SR_LOCK_GUARD
+
+        if (!handle.Valid() || handle.index >= m_slots.size()) {
+            return nullptr;
+        }
+
+        auto&& slot = m_slots[handle.index];
+
+        if (slot.generation != handle.generation) {
+            return nullptr;
+        }
+
+        /// уничтоженный ресурс еще может лежать в очереди GC, но отдавать его уже нельзя
+        if (slot.pResource->IsDestroyed()) {
+            return nullptr;
+        }
+
+        slot.pResource->AddUsePoint();
+
+        return slot.pResource;
+    }
+
+    uint64_t ResourceManager::GetDestroyQueueSize() const {
+        SR_LOCK_GUARD
+        return m_destroyed.size();
+    }
+
+    uint64_t ResourceManager::GetResourcesCount() const {
+        SR_LOCK_GUARD
+        return m_slots.size() - m_freeSlots.size();
+    }
+
     bool ResourceManager::RegisterType(const std::string& name, uint64_t hashTypeName) {
         SR_INFO("ResourceManager::RegisterType() : register new \"" + name + "\" type...");
 
@@ -144,17 +256,25 @@ namespace SR_UTILS_NS {
         return true;
     }
 
-    void ResourceManager::Remove(IResource *pResource) {
-        if (pResource->IsRegistered()) {
-            auto&& pGroupIt = m_resources.find(pResource->GetResourceHashName());
-            auto&& [name, resourcesGroup] = *pGroupIt;
-            resourcesGroup->Remove(pResource);
-        }
-        else {
+    bool ResourceManager::Remove(IResource *pResource) {
+        if (!pResource->IsRegistered()) {
            SRHalt("Resource ins't registered! "
                 "\n\tType: " + std::string(pResource->GetResourceName()) +
                 "\n\tId: " + std::string(pResource->GetResourceId()));
+           return false;
+        }
+
+        /// между проверкой в GC и этим местом ресурс мог получить точку использования
+        if (!m_registry.RemoveUnused(pResource)) {
+            return false;
         }
+
+        auto&& pGroupIt = m_resources.find(pResource->GetResourceHashName());
+        auto&& [name, resourcesGroup] = *pGroupIt;
+        resourcesGroup->Remove(pResource);
+        FreeHandle(pResource);
+
+        return true;
     }
 
     bool ResourceManager::IsLastResource(IResource* pResource) {
@@ -194,7 +314,7 @@ namespace SR_UTILS_NS {
     }
 
     void ResourceManager::GC() {
-        SR_TRACY_ZONE;
+        SR_PROFILE_ZONE_N("Resources GC");
         SR_LOCK_GUARD;
 
         /// Не можем работать, пока какие-то ресурсы не перезагружены
@@ -203,6 +323,7 @@ namespace SR_UTILS_NS {
         }
 
         if (m_destroyed.empty()) {
+            m_destroyCursor = 0;
             return;
         }
 
@@ -212,24 +333,44 @@ namespace SR_UTILS_NS {
             }
         }
 
-        auto resourceIt = m_destroyed.begin();
-        for (; resourceIt != m_destroyed.end(); ) {
-            auto pResource = *resourceIt;
+        if (m_destroyCursor >= m_destroyed.size()) {
+            m_destroyCursor = 0;
+        }
+
+        /// Проход инкрементальный: если не уложились в бюджет, следующий вызов продолжит с m_destroyCursor.
+        /// Все, что лежит до курсора, уже проверено в этом проходе, удаление перемещает в позицию курсора
+        /// последний элемент очереди, поэтому курсор в этом случае не сдвигается.
+        const auto&& beginTime = std::chrono::high_resolution_clock::now();
+        const auto now = static_cast<uint64_t>(clock());
+        uint64_t checked = 0;
+
+        while (m_destroyCursor < m_destroyed.size()) {
+            if (!m_force && ++checked % 64 == 0) {
+                auto&& elapsed = std::chrono::high_resolution_clock::now() - beginTime;
+                if (std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count() > static_cast<int64_t>(GCTimeBudget)) {
+                    break;
+                }
+            }
+
+            /// ссылку на элемент не храним, уничтожение ресурса может добавить в очередь новые элементы
+            IResource* pResource = m_destroyed[m_destroyCursor].pResource;
+
+            const uint64_t deltaTime = now > m_destroyed[m_destroyCursor].time ? now - m_destroyed[m_destroyCursor].time : 0;
+            m_destroyed[m_destroyCursor].time = now;
 
             /// ресурс был оживлен
             if (!pResource->IsDestroyed()) {
-                m_destroyed.erase(resourceIt);
-                resourceIt = m_destroyed.begin();
+                EraseFromDestroy(pResource);
                 continue;
             }
 
-            const bool usageNow = pResource->GetCountUses() > 0 || !pResource->IsDestroyed();
+            const bool usageNow = pResource->GetCountUses() > 0;
 
             if (usageNow) {
                 pResource->SetLifetime(ResourceLifeTime);
             }
             else if (IsLastResource(pResource)) {
-                pResource->SetLifetime(pResource->GetLifetime() - m_GCDt);
+                pResource->SetLifetime(pResource->GetLifetime() - static_cast<int64_t>(deltaTime));
             }
             else {
                 /// нам не нужно ждать завершения времени жизни ресурса, у которого еще есть копии
@@ -239,7 +380,7 @@ namespace SR_UTILS_NS {
             const bool resourceAlive = !pResource->IsForceDestroyed() && pResource->IsAlive() && !m_force;
 
             if (usageNow || resourceAlive) {
-                ++resourceIt;
+                ++m_destroyCursor;
                 continue;
             }
 
@@ -247,17 +388,19 @@ namespace SR_UTILS_NS {
                 SR_LOG("ResourceManager::GC() : free \"" + std::string(pResource->GetResourceId()) + "\" resource");
             }
 
-            Remove(pResource);
+            if (!Remove(pResource)) {
+                ++m_destroyCursor;
+                continue;
+            }
 
-            {
-                /// так как некоторые ресурсы рекурсивно уничтожают дочерныие ресурсы при вызове деструктора, например материал,
-                /// то он добавит в m_resourcesToDestroy новый элемент (в этом же потоке), соответственно любой итератор
-                /// инвалидируется, и здесь может потенциально случиться краш, поэтому этот порядок нужно строго союлюдать
+            /// некоторые ресурсы рекурсивно уничтожают дочерние при вызове деструктора, например материал,
+            /// они добавятся в конец m_destroyed, поэтому ресурс нужно убрать из очереди до DeleteResource
+            EraseFromDestroy(pResource);
+            pResource->DeleteResource();
+        }
 
-                m_destroyed.erase(resourceIt);
-                pResource->DeleteResource();
-                resourceIt = m_destroyed.begin();
-            }
+        if (m_destroyCursor >= m_destroyed.size()) {
+            m_destroyCursor = 0;
         }
 
         if (Debug::Instance().GetLevel() >= Debug::Level::High && m_destroyed.empty()) {
@@ -285,6 +428,11 @@ namespace SR_UTILS_NS {
         auto&& [name, resourcesGroup] = *pGroupIt;
 
         resourcesGroup->Add(pResource);
+
+        if (pResource->IsRegistered()) {
+            pResource->m_handle = AllocateHandle(pResource);
+            m_registry.Add(pResource);
+        }
     }
 
     void ResourceManager::PrintMemoryDump() {
@@ -306,7 +454,7 @@ namespace SR_UTILS_NS {
         }
 
         std::string wait;
-        for (auto&& pResource : m_destroyed) {
+        for (auto&& [pResource, time] : m_destroyed) {
             wait += "\n\t\t" + pResource->GetResourceId().ToStringRef() + "; uses = " +std::to_string(pResource->GetCountUses());
             ++count;
         }
@@ -325,6 +473,12 @@ namespace SR_UTILS_NS {
 
     IResource *ResourceManager::Find(uint64_t hashTypeName, const std::string& id) {
         SR_TRACY_ZONE;
+
+        /// в большинстве случаев ресурс жив, и его можно найти без общей блокировки
+        if (auto&& pResource = m_registry.FindAlive(hashTypeName, SR_HASH_STR(id))) {
+            return pResource;
+        }
+
         SR_SCOPED_LOCK
 
     #if defined(SR_DEBUG)
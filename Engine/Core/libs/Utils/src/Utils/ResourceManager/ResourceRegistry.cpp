@@ -0,0 +1,90 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Utils/ResourceManager/ResourceRegistry.h>
+#include <Utils/ResourceManager/IResource.h>
+
+namespace SR_UTILS_NS {
+    uint64_t ResourceRegistry::MakeKey(uint64_t hashTypeName, uint64_t hashId) noexcept {
+        return SR_UTILS_NS::CombineTwoHashes(hashId, hashTypeName);
+    }
+
+    void ResourceRegistry::Add(IResource* pResource) {
+        const uint64_t key = MakeKey(pResource->GetResourceHashName(), pResource->GetResourceId().GetHash());
+
+        auto&& shard = GetShard(key);
+        std::lock_guard lock(shard.mutex);
+
+        shard.resources[key].emplace_back(pResource);
+    }
+
+    bool ResourceRegistry::RemoveUnused(IResource* pResource) {
+        const uint64_t key = MakeKey(pResource->GetResourceHashName(), pResource->GetResourceId().GetHash());
+
+        auto&& shard = GetShard(key);
+        std::lock_guard lock(shard.mutex);
+
+        if (!pResource->IsDestroyed() || pResource->GetCountUses() > 0) {
+            return false;
+        }
+
+        auto&& pIt = shard.resources.find(key);
+        if (pIt == shard.resources.end()) {
+            SRHalt("ResourceRegistry::RemoveUnused() : resource not found!");
+            return false;
+        }
+
+        auto&& copies = pIt->second;
+
+        if (auto&& pCopyIt = std::find(copies.begin(), copies.end(), pResource); pCopyIt != copies.end()) {
+            *pCopyIt = copies.back();
+            copies.pop_back();
+        }
+        else {
+            SRHalt("ResourceRegistry::RemoveUnused() : resource not found!");
+        }
+
+        if (copies.empty()) {
+            shard.resources.erase(pIt);
+        }
+
+        return true;
+    }
+
+    void ResourceRegistry::Clear() {
+        for (auto&& shard : m_shards) {
+            std::lock_guard lock(shard.mutex);
+            shard.resources.clear();
+        }
+    }
+
+    IResource* ResourceRegistry::FindAlive(uint64_t hashTypeName, uint64_t hashId) const {
+        const uint64_t key = MakeKey(hashTypeName, hashId);
+
+        auto&& shard = GetShard(key);
+        std::shared_lock lock(shard.mutex);
+
+        auto&& pIt = shard.resources.find(key);
+        if (pIt == shard.resources.end()) {
+            return nullptr;
+        }
+
+        for (auto&& pResource : pIt->second) {
+            /// разные пары (тип, id) могут дать один ключ
+            if (pResource->GetResourceHashName() != hashTypeName || pResource->GetResourceId().GetHash() != hashId) {
+                continue;
+            }
+
+            if (!pResource->IsDestroyed()) {
+                /// раз ресурс ищем, значит он все еще может быть нужен.
+                /// После выхода из блокировки указатель защищен так же, как при поиске под мьютексом менеджера:
+                /// временем жизни и тем, что GC освобождает только уничтоженные ресурсы через RemoveUnused
+                pResource->UpdateResourceLifeTime();
+                return pResource;
+            }
+        }
+
+        return nullptr;
+    }
+}
@@ -0,0 +1,337 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Utils/SRLM/LogicalCompiler.h>
+#include <Utils/SRLM/LogicalNodes.h>
+#include <Utils/SRLM/ConvertorNode.h>
+#include <Utils/SRLM/DataType.h>
+
+namespace SR_SRLM_NS {
+    bool LogicalCompiler::Compile(const std::vector<LogicalNode*>& entryPoints, LogicalProgram& program) {
+        program.Clear();
+
+        m_program = &program;
+        m_computed.clear();
+        m_blocks.clear();
+        m_queue.clear();
+        m_patches.clear();
+        m_error.clear();
+
+        /// нулевой адрес - выход из потока, на него ведут все неподключенные flow-пины
+        Emit(m_program->code, LogicalOpCode::Halt);
+
+        for (auto&& pNode : entryPoints) {
+            m_queue.emplace_back(pNode);
+        }
+
+        while (!m_queue.empty()) {
+            LogicalNode* pNode = m_queue.front();
+            m_queue.pop_front();
+
+            if (m_blocks.count(pNode) == 1) {
+                continue;
+            }
+
+            if (!CompileExecutable(pNode)) {
+                program.Clear();
+                return false;
+            }
+        }
+
+        for (auto&& [instruction, pNode] : m_patches) {
+            auto&& code = m_program->code[instruction];
+            auto&& address = pNode ? m_blocks.at(pNode) : 0;
+
+            if (code.opCode == LogicalOpCode::JumpIfFalse) {
+                code.b = address;
+            }
+            else {
+                code.a = address;
+            }
+        }
+
+        for (auto&& pNode : entryPoints) {
+            m_program->entryPoints.emplace_back(m_blocks.at(pNode));
+        }
+
+        Emit(m_program->prologue, LogicalOpCode::Halt);
+
+        return true;
+    }
+
+    bool LogicalCompiler::CompileExecutable(LogicalNode* pNode) {
+        m_blocks[pNode] = static_cast<uint32_t>(m_program->code.size());
+
+        auto&& code = m_program->code;
+
+        if (dynamic_cast<StartNode*>(pNode)) {
+            return CompileFlow(pNode, 0, LogicalOpCode::Jump);
+        }
+
+        if (dynamic_cast<DebugPrintNode*>(pNode)) {
+            auto&& message = CompileInput(pNode, 1);
+            auto&& type = CompileInput(pNode, 2);
+            if (message == InvalidRegister || type == InvalidRegister) {
+                return false;
+            }
+
+            if (m_program->registerClasses[message] != DataTypeClass::String) {
+                return Fail("DebugPrint message is not a string");
+            }
+
+            Emit(code, LogicalOpCode::Print, message, type);
+            return CompileFlow(pNode, 0, LogicalOpCode::Jump);
+        }
+
+        if (dynamic_cast<BranchNode*>(pNode)) {
+            auto&& condition = CompileInput(pNode, 1);
+            if (condition == InvalidRegister) {
+                return false;
+            }
+
+            if (m_program->registerClasses[condition] != DataTypeClass::Bool) {
+                return Fail("Branch condition is not a bool");
+            }
+
+            if (pNode->GetOutputs().size() < 2) {
+                return Fail("Branch has no \"False\" output");
+            }
+
+            /// JumpIfFalse -> False, иначе проваливаемся в Jump -> True
+            auto&& pFalseNode = pNode->GetOutputs()[1].GetFirstNode();
+
+            Emit(code, LogicalOpCode::JumpIfFalse, condition);
+            m_patches.emplace_back(static_cast<uint32_t>(code.size() - 1), pFalseNode);
+
+            if (pFalseNode) {
+                m_queue.emplace_back(pFalseNode);
+            }
+
+            return CompileFlow(pNode, 0, LogicalOpCode::Jump);
+        }
+
+        if (dynamic_cast<SequenceNode*>(pNode)) {
+            auto&& outputs = pNode->GetOutputs();
+            if (outputs.empty()) {
+                Emit(code, LogicalOpCode::Halt);
+                return true;
+            }
+
+            /// Интерпретатор продолжает текущий поток по первому выходу, а остальные вставляет
+            /// сразу после него в исходном порядке. Потоки VM лежат в стеке, поэтому порождаем их в обратном порядке.
+            for (uint32_t i = static_cast<uint32_t>(outputs.size()) - 1; i > 0; --i) {
+                if (!CompileFlow(pNode, i, LogicalOpCode::Spawn)) {
+                    return false;
+                }
+            }
+
+            return CompileFlow(pNode, 0, LogicalOpCode::Jump);
+        }
+
+        return Fail("unsupported executable node \"" + pNode->GetNodeName() + "\"");
+    }
+
+    bool LogicalCompiler::CompileFlow(LogicalNode* pNode, uint32_t outputIndex, LogicalOpCode opCode) {
+        auto&& outputs = pNode->GetOutputs();
+        if (outputIndex >= outputs.size()) {
+            return Fail("flow output out of range in \"" + pNode->GetNodeName() + "\"");
+        }
+
+        auto&& pNextNode = outputs[outputIndex].GetFirstNode();
+
+        if (pNextNode && pNextNode->GetType() != LogicalNodeType::Executable) {
+            return Fail("flow leads to non-executable node \"" + pNextNode->GetNodeName() + "\"");
+        }
+
+        auto&& code = m_program->code;
+
+        /// поток в никуда просто не порождаем
+        if (!pNextNode && opCode == LogicalOpCode::Spawn) {
+            return true;
+        }
+
+        Emit(code, opCode);
+        m_patches.emplace_back(static_cast<uint32_t>(code.size() - 1), pNextNode);
+
+        if (pNextNode) {
+            m_queue.emplace_back(pNextNode);
+        }
+
+        return true;
+    }
+
+    uint32_t LogicalCompiler::CompileInput(LogicalNode* pNode, uint32_t inputIndex) {
+        auto&& inputs = pNode->GetInputs();
+        if (inputIndex >= inputs.size()) {
+            Fail("input out of range in \"" + pNode->GetNodeName() + "\"");
+            return InvalidRegister;
+        }
+
+        auto&& pin = inputs[inputIndex];
+        auto&& pSourceNode = pin.GetFirstNode();
+
+        if (!pSourceNode) {
+            return AllocateConstant(pin.pData);
+        }
+
+        if (pSourceNode->GetType() != LogicalNodeType::Compute) {
+            Fail("data input of \"" + pNode->GetNodeName() + "\" is connected to non-compute node");
+            return InvalidRegister;
+        }
+
+        return CompileCompute(pSourceNode, pin.GetFirstNodePin());
+    }
+
+    uint32_t LogicalCompiler::CompileCompute(LogicalNode* pNode, uint32_t outputIndex) {
+        if (auto&& pIt = m_computed.find(std::make_pair(pNode, outputIndex)); pIt != m_computed.end()) {
+            /// InvalidRegister здесь означает цикл среди compute-нод
+            if (pIt->second == InvalidRegister) {
+                Fail("cycle in compute nodes");
+            }
+            return pIt->second;
+        }
+
+        m_computed[std::make_pair(pNode, outputIndex)] = InvalidRegister;
+
+        if (outputIndex >= pNode->GetOutputs().size()) {
+            Fail("compute output out of range in \"" + pNode->GetNodeName() + "\"");
+            return InvalidRegister;
+        }
+
+        auto&& outputClass = pNode->GetOutputs()[outputIndex].pData->GetClass();
+        uint32_t result = InvalidRegister;
+
+        /// compute-ноды кэшируют результат до MarkDirty, поэтому считаем их один раз в прологе
+        if (dynamic_cast<ConstructorNode*>(pNode)) {
+            auto&& source = CompileInput(pNode, 0);
+            if (source == InvalidRegister) {
+                return InvalidRegister;
+            }
+
+            result = AllocateRegister(outputClass);
+            if (result == InvalidRegister) {
+                return InvalidRegister;
+            }
+
+            auto&& opCode = outputClass == DataTypeClass::String ? LogicalOpCode::CopyString : LogicalOpCode::Copy;
+            Emit(m_program->prologue, opCode, result, source);
+        }
+        else if (dynamic_cast<ConvertorNode*>(pNode)) {
+            if (outputClass != DataTypeClass::String) {
+                Fail("unsupported conversion in \"" + pNode->GetNodeName() + "\"");
+                return InvalidRegister;
+            }
+
+            auto&& source = CompileInput(pNode, 0);
+            if (source == InvalidRegister) {
+                return InvalidRegister;
+            }
+
+            result = AllocateRegister(DataTypeClass::String);
+
+            if (m_program->registerClasses[source] == DataTypeClass::String) {
+                Emit(m_program->prologue, LogicalOpCode::CopyString, result, source);
+            }
+            else {
+                Emit(m_program->prologue, LogicalOpCode::ToString, result, source, m_program->registerClasses[source]);
+            }
+        }
+        else {
+            Fail("unsupported compute node \"" + pNode->GetNodeName() + "\"");
+            return InvalidRegister;
+        }
+
+        m_computed[std::make_pair(pNode, outputIndex)] = result;
+
+        return result;
+    }
+
+    uint32_t LogicalCompiler::AllocateRegister(DataTypeClass dataTypeClass) {
+        LogicalRegister value;
+        value.u = 0;
+
+        switch (dataTypeClass) {
+            case DataTypeClass::String:
+                value.u = static_cast<uint64_t>(m_program->strings.size());
+                m_program->strings.emplace_back();
+                break;
+            case DataTypeClass::Bool:
+            case DataTypeClass::Float:
+            case DataTypeClass::Double:
+            case DataTypeClass::Enum:
+            case DataTypeClass::Flow:
+            case DataTypeClass::Int8:
+            case DataTypeClass::Int16:
+            case DataTypeClass::Int32:
+            case DataTypeClass::Int64:
+            case DataTypeClass::UInt8:
+            case DataTypeClass::UInt16:
+            case DataTypeClass::UInt32:
+            case DataTypeClass::UInt64:
+                break;
+            default:
+                Fail("unsupported register class \"" + SR_UTILS_NS::ToString(dataTypeClass) + "\"");
+                return InvalidRegister;
+        }
+
+        m_program->registers.emplace_back(value);
+        m_program->registerClasses.emplace_back(dataTypeClass);
+
+        return static_cast<uint32_t>(m_program->registers.size() - 1);
+    }
+
+    uint32_t LogicalCompiler::AllocateConstant(const DataType* pData) {
+        if (!pData) {
+            Fail("input data is nullptr");
+            return InvalidRegister;
+        }
+
+        auto&& index = AllocateRegister(pData->GetClass());
+        if (index == InvalidRegister) {
+            return InvalidRegister;
+        }
+
+        auto&& value = m_program->registers[index];
+
+        switch (pData->GetClass()) {
+            case DataTypeClass::String: m_program->strings[value.u] = *pData->GetString(); break;
+            case DataTypeClass::Bool: value.b = *pData->GetBool(); break;
+            case DataTypeClass::Float: value.f = *pData->GetFloat(); break;
+            case DataTypeClass::Double: value.d = *pData->GetDouble(); break;
+            case DataTypeClass::Enum:
+            case DataTypeClass::Flow:
+                value.i = *pData->GetEnum();
+                break;
+            case DataTypeClass::Int8: value.i = *pData->GetInt8(); break;
+            case DataTypeClass::Int16: value.i = *pData->GetInt16(); break;
+            case DataTypeClass::Int32: value.i = *pData->GetInt32(); break;
+            case DataTypeClass::Int64: value.i = *pData->GetInt64(); break;
+            case DataTypeClass::UInt8: value.u = *pData->GetUInt8(); break;
+            case DataTypeClass::UInt16: value.u = *pData->GetUInt16(); break;
+            case DataTypeClass::UInt32: value.u = *pData->GetUInt32(); break;
+            case DataTypeClass::UInt64: value.u = *pData->GetUInt64(); break;
+            default:
+                SRHalt("Unresolved behaviour!");
+                break;
+        }
+
+        return index;
+    }
+
+    void LogicalCompiler::Emit(std::vector<LogicalInstruction>& code, LogicalOpCode opCode, uint32_t a, uint32_t b, DataTypeClass cls) {
+        LogicalInstruction instruction;
+        instruction.opCode = opCode;
+        instruction.cls = cls;
+        instruction.a = a;
+        instruction.b = b;
+        code.emplace_back(instruction);
+    }
+
+    bool LogicalCompiler::Fail(const std::string& error) {
+        if (m_error.empty()) {
+            m_error = error;
+        }
+        return false;
+    }
+}
@@ -3,6 +3,7 @@
 //
 
 #include <Utils/SRLM/LogicalMachine.h>
+#include <Utils/SRLM/LogicalCompiler.h>
 #include <Utils/SRLM/DataType.h>
 #include <Utils/SRLM/LogicalNode.h>
 #include <Utils/SRLM/LogicalNodeManager.h>
@@ -18,6 +19,11 @@ namespace SR_SRLM_NS {
     }
 
     void LogicalMachine::UpdateMachine(float_t dt) {
+        if (IsBytecodeActive()) {
+            m_vm.Execute(dt);
+            return;
+        }
+
         for (m_currentNode = 0; m_currentNode < m_active.size(); ++m_currentNode) {
             while (Execute(dt));
 
@@ -29,6 +35,11 @@ namespace SR_SRLM_NS {
     }
 
     bool LogicalMachine::Init() {
+        if (IsBytecodeActive()) {
+            m_vm.Init();
+            return true;
+        }
+
         for (auto&& [name, pNode] : m_entryPoints) {
             ActiveNodeInfo info;
             info.pNode = pNode;
@@ -67,6 +78,27 @@ namespace SR_SRLM_NS {
         }
     }
 
+    void LogicalMachine::Compile() {
+        std::vector<LogicalNode*> entryPoints;
+        entryPoints.reserve(m_entryPoints.size());
+
+        for (auto&& [name, pNode] : m_entryPoints) {
+            entryPoints.emplace_back(pNode);
+        }
+
+        LogicalCompiler compiler;
+        LogicalProgram program;
+
+        if (!compiler.Compile(entryPoints, program)) {
+            SR_LOG("LogicalMachine::Compile() : graph will be interpreted, reason: {}\n\tPath: {}",
+                compiler.GetError(), GetResourcePath().ToStringRef());
+            m_vm.Clear();
+            return;
+        }
+
+        m_vm.SetProgram(std::move(program));
+    }
+
     void LogicalMachine::AddNode(LogicalNode* pNode) {
         m_nodes.emplace_back(pNode);
 
@@ -120,15 +152,24 @@ namespace SR_SRLM_NS {
             auto&& startPinIndex = xmlLink.GetAttribute("SP").ToUInt();
             auto&& endPinIndex = xmlLink.GetAttribute("EP").ToUInt();
 
-            nodes[startNodeId]->AddOutputConnection(nodes[endNodeId], endPinIndex, startPinIndex);
-            nodes[endNodeId]->AddInputConnection(nodes[startNodeId], startPinIndex, endPinIndex);
+            Link(nodes[startNodeId], startPinIndex, nodes[endNodeId], endPinIndex);
         }
 
-        Optimize();
+        Build();
 
         return Super::Load();
     }
 
+    void LogicalMachine::Link(LogicalNode* pStartNode, uint32_t startPinIndex, LogicalNode* pEndNode, uint32_t endPinIndex) {
+        pStartNode->AddOutputConnection(pEndNode, endPinIndex, startPinIndex);
+        pEndNode->AddInputConnection(pStartNode, startPinIndex, endPinIndex);
+    }
+
+    void LogicalMachine::Build() {
+        Optimize();
+        Compile();
+    }
+
     void LogicalMachine::Clear() {
         for (auto&& pNode : m_nodes) {
             delete pNode;
@@ -139,6 +180,8 @@ namespace SR_SRLM_NS {
         m_nodes.clear();
         m_active.clear();
         m_entryPoints.clear();
+
+        m_vm.Clear();
     }
 
     bool LogicalMachine::Unload() {
@@ -0,0 +1,106 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Utils/SRLM/LogicalVM.h>
+#include <Utils/Common/ToString.h>
+#include <Utils/Debug.h>
+
+namespace SR_SRLM_NS {
+    void LogicalVM::SetProgram(LogicalProgram&& program) {
+        Clear();
+        m_program = std::move(program);
+    }
+
+    void LogicalVM::Clear() {
+        m_program.Clear();
+        m_registers.clear();
+        m_strings.clear();
+        m_threads.clear();
+    }
+
+    void LogicalVM::Init() {
+        m_registers = m_program.registers;
+        m_strings = m_program.strings;
+        m_threads.clear();
+
+        Run(m_program.prologue, 0);
+
+        m_threads.reserve(m_program.entryPoints.size());
+        for (auto pIt = m_program.entryPoints.rbegin(); pIt != m_program.entryPoints.rend(); ++pIt) {
+            m_threads.emplace_back(*pIt);
+        }
+    }
+
+    void LogicalVM::Execute(float_t dt) {
+        SR_UNUSED_VARIABLE(dt);
+
+        while (!m_threads.empty()) {
+            const uint32_t address = m_threads.back();
+            m_threads.pop_back();
+            Run(m_program.code, address);
+        }
+    }
+
+    void LogicalVM::Run(const std::vector<LogicalInstruction>& code, uint32_t address) {
+        while (address < code.size()) {
+            auto&& instruction = code[address];
+
+            switch (instruction.opCode) {
+                case LogicalOpCode::Halt:
+                    return;
+                case LogicalOpCode::Jump:
+                    address = instruction.a;
+                    continue;
+                case LogicalOpCode::JumpIfFalse:
+                    if (!m_registers[instruction.a].b) {
+                        address = instruction.b;
+                        continue;
+                    }
+                    break;
+                case LogicalOpCode::Spawn:
+                    m_threads.emplace_back(instruction.a);
+                    break;
+                case LogicalOpCode::Copy:
+                    m_registers[instruction.a] = m_registers[instruction.b];
+                    break;
+                case LogicalOpCode::CopyString:
+                    m_strings[m_registers[instruction.a].u] = m_strings[m_registers[instruction.b].u];
+                    break;
+                case LogicalOpCode::ToString:
+                    m_strings[m_registers[instruction.a].u] = ToString(m_registers[instruction.b], instruction.cls);
+                    break;
+                case LogicalOpCode::Print:
+                    SR_UTILS_NS::Debug::Instance().Print(
+                        m_strings[m_registers[instruction.a].u],
+                        static_cast<SR_UTILS_NS::DebugLogType>(m_registers[instruction.b].i)
+                    );
+                    break;
+                default:
+                    SRHalt("LogicalVM::Run() : unknown opcode!");
+                    return;
+            }
+
+            ++address;
+        }
+    }
+
+    std::string LogicalVM::ToString(const LogicalRegister& value, DataTypeClass dataTypeClass) const {
+        switch (dataTypeClass) {
+            case DataTypeClass::UInt8: return SR_UTILS_NS::ToString(static_cast<uint8_t>(value.u));
+            case DataTypeClass::UInt16: return SR_UTILS_NS::ToString(static_cast<uint16_t>(value.u));
+            case DataTypeClass::UInt32: return SR_UTILS_NS::ToString(static_cast<uint32_t>(value.u));
+            case DataTypeClass::UInt64: return SR_UTILS_NS::ToString(value.u);
+            case DataTypeClass::Int8: return SR_UTILS_NS::ToString(static_cast<int8_t>(value.i));
+            case DataTypeClass::Int16: return SR_UTILS_NS::ToString(static_cast<int16_t>(value.i));
+            case DataTypeClass::Int32: return SR_UTILS_NS::ToString(static_cast<int32_t>(value.i));
+            case DataTypeClass::Int64: return SR_UTILS_NS::ToString(value.i);
+            case DataTypeClass::Bool: return SR_UTILS_NS::ToString(value.b);
+            case DataTypeClass::Float: return SR_UTILS_NS::ToString(value.f);
+            case DataTypeClass::Double: return SR_UTILS_NS::ToString(value.d);
+            default:
+                SRHalt("LogicalVM::ToString() : unsupported class!");
+                return std::string(); /// NOLINT
+        }
+    }
+}
@@ -3,19 +3,15 @@
 //
 
 #include <Utils/Settings.h>
+#include <Utils/Common/Features.h>
 
 namespace SR_UTILS_NS {
     bool Settings::Load() {
         bool hasErrors = false;
 
-        Path path = GetResourcePath();
-        if (!path.IsAbs()) {
-            path = GetAssociatedPath().Concat(path);
-        }
-
-        auto&& document = SR_XML_NS::Document::Load(path);
+        auto&& document = LoadDocument();
         if (!document.Valid()) {
-            SR_ERROR("Settings::Load() : file not found! \n\tPath: " + path.ToString());
+            SR_ERROR("Settings::Load() : failed to load document! \n\tPath: " + GetResourcePath().ToString());
             return false;
         }
 
@@ -23,7 +19,7 @@ namespace SR_UTILS_NS {
             LoadSettings(settings);
         }
         else {
-            SR_ERROR("Settings::Load() : \"Settings\" node not found! \n\tPath: " + path.ToString());
+            SR_ERROR("Settings::Load() : \"Settings\" node not found! \n\tPath: " + GetResourcePath().ToString());
             return false;
         }
 
@@ -61,8 +57,15 @@ namespace SR_UTILS_NS {
 
     SR_XML_NS::Document Settings::LoadDocument() const {
         Path path = GetResourcePath();
-        if (!path.IsAbs()) {
-            path = GetAssociatedPath().Concat(path);
+        if (path.IsAbs()) {
+            return std::move(SR_XML_NS::Document::Load(path));
+        }
+
+        path = GetAssociatedPath().Concat(path);
+
+        if (SR_UTILS_NS::Features::Instance().Enabled("CompiledConfigsCache", false)) {
+            Path&& cachePath = ResourceManager::Instance().GetCachePath().Concat("Configs").Concat(GetResourcePath()).ConcatExt("compiled");
+            return SR_XML_NS::CompiledConfig::LoadDocument(path, cachePath, GetConfigSchema());
         }
 
         return std::move(SR_XML_NS::Document::Load(path));
@@ -80,6 +80,14 @@ namespace SR_HTYPES_NS {
         return defaultVertices;
     }
 
+    const SR_UTILS_NS::BakedMesh* IRawMeshHolder::GetBakedMesh() const noexcept {
+        if (!IsValidMeshId()) {
+            return nullptr;
+        }
+
+        return GetRawMesh()->GetBakedMesh();
+    }
+
     void IRawMeshHolder::SetRawMesh(const SR_UTILS_NS::Path& path) {
         if (path.empty()) {
             SetRawMesh(nullptr);
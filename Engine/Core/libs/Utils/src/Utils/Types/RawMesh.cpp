@@ -7,6 +7,7 @@
 #include <Utils/FileSystem/FileSystem.h>
 #include <Utils/ResourceManager/ResourceManager.h>
 #include <Utils/FileSystem/AssimpCache.h>
+#include <Utils/Profile/TracyContext.h>
 
 #include <assimp/scene.h>
 #include <assimp/postprocess.h>
@@ -26,12 +27,8 @@ namespace SR_HTYPES_NS {
     }
 
     RawMesh::~RawMesh() {
+        FreeScene();
         delete m_importer;
-
-        if (m_fromCache) {
-            delete m_scene;
-            m_scene = nullptr;
-        }
     }
 
     SR_UTILS_NS::Path RawMesh::InitializeResourcePath() const {
@@ -82,16 +79,12 @@ namespace SR_HTYPES_NS {
     bool RawMesh::Unload() {
         bool hasErrors = !IResource::Unload();
 
-        if (m_importer) {
-            m_importer->FreeScene();
-        }
-
-        if (m_fromCache) {
-            delete m_scene;
-            m_scene = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(m_sceneMutex);
+            FreeScene();
         }
 
-        m_fromCache = false;
+        m_baked.Clear();
 
         m_bones.clear();
         m_optimizedBones.clear();
@@ -99,23 +92,63 @@ namespace SR_HTYPES_NS {
         m_boneOffsetsMap.clear();
         m_boneOffsets.clear();
 
-        m_animations.clear();
-
         return !hasErrors;
     }
 
     bool RawMesh::Load() {
         bool hasErrors = !IResource::Load();
 
-        auto&& resPath = GetResourcePath();
+        const uint64_t resourceHash = ResourceManager::Instance().GetResPath().Concat(GetResourcePath()).GetFileHash();
 
-        Path&& path = ResourceManager::Instance().GetResPath().Concat(resPath);
-        Path&& cache = ResourceManager::Instance().GetCachePath().Concat("Models").Concat(resPath);
+        /// выпуклая оболочка считается по сцене assimp, такие модели не запекаются
+        const bool supportBakedLoad = SR_UTILS_NS::Features::Instance().Enabled("BakedModelsLoad", false) && !m_params.convexHull;
 
-        if (m_params.animation) {
-            cache = cache.ConcatExt("animation");
+        Path&& baked = GetCacheBasePath().ConcatExt("baked");
+
+        if (supportBakedLoad) {
+            m_baked = SR_UTILS_NS::BakedMesh::Load(baked);
+
+            if (m_baked.Valid() && m_baked.GetSourceHash() == resourceHash) {
+                LoadBakedSkeleton();
+                return !hasErrors;
+            }
+
+            m_baked.Clear();
         }
 
+        std::lock_guard<std::mutex> lock(m_sceneMutex);
+
+        if (!ReadScene()) {
+            return false;
+        }
+
+        CalculateBones();
+        OptimizeSkeleton();
+        CalculateOffsets();
+
+        /// модель запекается и в памяти, чтобы все потребители читали одни и те же данные без сцены assimp
+        m_baked = Bake(resourceHash);
+
+        if (supportBakedLoad && !m_baked.Save(baked)) {
+            SR_WARN("RawMesh::Load() : failed to save baked model!\n\tPath: " + baked.ToString());
+        }
+
+        FreeScene();
+
+        if (!m_baked.Valid()) {
+            SR_ERROR("RawMesh::Load() : failed to bake model!\n\tPath: " + GetResourcePath().ToString());
+            return false;
+        }
+
+        return !hasErrors;
+    }
+
+    bool RawMesh::ReadScene() {
+        auto&& resPath = GetResourcePath();
+
+        Path&& path = ResourceManager::Instance().GetResPath().Concat(resPath);
+        Path&& cache = GetCacheBasePath();
+
         Path&& binary = cache.ConcatExt("cache");
         Path&& hashFile = cache.ConcatExt("hash");
 
@@ -138,7 +171,7 @@ namespace SR_HTYPES_NS {
             m_scene = m_importer->ReadFile(path.ToStringRef(), m_params.animation ? SR_RAW_MESH_ASSIMP_ANIMATION_FLAGS : SR_RAW_MESH_ASSIMP_FLAGS);
 
             if (!m_scene) {
-                SR_ERROR("RawMesh::Load() : failed to load file!\n\tPath: " + path.ToStringRef() + "\n\tReason: " + std::string(m_importer->GetErrorString()));
+                SR_ERROR("RawMesh::ReadScene() : failed to load file!\n\tPath: " + path.ToStringRef() + "\n\tReason: " + std::string(m_importer->GetErrorString()));
                 return false;
             }
 
@@ -149,7 +182,7 @@ namespace SR_HTYPES_NS {
             NormalizeWeights();
 
             if (needFastLoad) {
-                SR_LOG("RawMesh::Load() : export model to cache... \n\tPath: " + binary.ToString());
+                SR_LOG("RawMesh::ReadScene() : export model to cache... \n\tPath: " + binary.ToString());
 
                 Assimp::Exporter exporter;
                 const aiExportFormatDesc* format = exporter.GetExportFormatDescription(14);
@@ -164,21 +197,164 @@ namespace SR_HTYPES_NS {
             SR_UTILS_NS::AssimpCache::Instance().Save(binary, m_scene);
         }
 
-        if (m_scene) {
-            CalculateBones();
-            OptimizeSkeleton();
-            CalculateOffsets();
-            CalculateAnimations();
+        if (!m_scene) {
+            SR_ERROR("RawMesh::ReadScene() : failed to read file! \n\tPath: " + path.ToString() + "\n\tReason: " + m_importer->GetErrorString());
+            return false;
         }
-        else {
-            SR_ERROR("RawMesh::Load() : failed to read file! \n\tPath: " + path.ToString() + "\n\tReason: " + m_importer->GetErrorString());
-            hasErrors |= true;
+
+        return true;
+    }
+
+    SR_UTILS_NS::Path RawMesh::GetCacheBasePath() const {
+        Path&& cache = ResourceManager::Instance().GetCachePath().Concat("Models").Concat(GetResourcePath());
+
+        if (m_params.animation) {
+            cache = cache.ConcatExt("animation");
         }
 
-        return !hasErrors;
+        return cache;
+    }
+
+    void RawMesh::FreeScene() {
+        if (m_fromCache) {
+            delete m_scene;
+        }
+        else if (m_importer) {
+            m_importer->FreeScene();
+        }
+
+        m_scene = nullptr;
+        m_fromCache = false;
+    }
+
+    const aiScene* RawMesh::GetAssimpScene() {
+        std::lock_guard<std::mutex> lock(m_sceneMutex);
+
+        if (!m_scene && !ReadScene()) {
+            return nullptr;
+        }
+
+        return m_scene;
+    }
+
+    SR_UTILS_NS::BakedMesh RawMesh::Bake(uint64_t sourceHash) const {
+        SR_TRACY_ZONE;
+
+        SR_UTILS_NS::BakedMeshBuilder builder;
+
+        for (uint32_t meshId = 0; meshId < m_scene->mNumMeshes; ++meshId) {
+            builder.AddSubmesh(GetGeometryName(meshId), GetVertices(meshId), GetIndices(meshId), GetBones(meshId));
+        }
+
+        std::vector<std::pair<Hash, uint16_t>> skeleton(m_optimizedBones.begin(), m_optimizedBones.end());
+        std::sort(skeleton.begin(), skeleton.end(), [](auto&& lhs, auto&& rhs) {
+            return lhs.second == rhs.second ? lhs.first < rhs.first : lhs.second < rhs.second;
+        });
+
+        for (auto&& [hashName, index] : skeleton) {
+            builder.AddSkeletonBone(hashName, index, GetBoneOffset(hashName));
+        }
+
+        if (m_scene->mRootNode) {
+            BakeNode(builder, m_scene->mRootNode, SR_ID_INVALID);
+        }
+
+        float_t scaleFactor = 0.f;
+        if (m_scene->mMetaData && m_scene->mMetaData->Get("UnitScaleFactor", scaleFactor)) {
+            builder.SetScaleFactor(scaleFactor);
+        }
+
+        for (uint32_t animationId = 0; animationId < m_scene->mNumAnimations; ++animationId) {
+            auto&& pAnimation = m_scene->mAnimations[animationId];
+
+            builder.AddAnimation(pAnimation->mName.C_Str(), pAnimation->mDuration, pAnimation->mTicksPerSecond);
+
+            for (uint32_t channelId = 0; channelId < pAnimation->mNumChannels; ++channelId) {
+                auto&& pChannel = pAnimation->mChannels[channelId];
+
+                auto&& convertVectorKeys = [](const aiVectorKey* pKeys, uint32_t count) {
+                    std::vector<SR_UTILS_NS::BakedVectorKey> keys(count);
+                    for (uint32_t i = 0; i < count; ++i) {
+                        keys[i].time = pKeys[i].mTime;
+                        keys[i].value = Vec3 { pKeys[i].mValue.x, pKeys[i].mValue.y, pKeys[i].mValue.z };
+                    }
+                    return keys;
+                };
+
+                std::vector<SR_UTILS_NS::BakedQuatKey> rotationKeys(pChannel->mNumRotationKeys);
+                for (uint32_t i = 0; i < pChannel->mNumRotationKeys; ++i) {
+                    auto&& key = pChannel->mRotationKeys[i];
+                    rotationKeys[i] = SR_UTILS_NS::BakedQuatKey { key.mTime, key.mValue.w, key.mValue.x, key.mValue.y, key.mValue.z };
+                }
+
+                builder.AddChannel(
+                    pChannel->mNodeName.C_Str(),
+                    static_cast<uint32_t>(pChannel->mPreState),
+                    static_cast<uint32_t>(pChannel->mPostState),
+                    convertVectorKeys(pChannel->mPositionKeys, pChannel->mNumPositionKeys),
+                    std::move(rotationKeys),
+                    convertVectorKeys(pChannel->mScalingKeys, pChannel->mNumScalingKeys)
+                );
+            }
+        }
+
+        return builder.Build(sourceHash);
+    }
+
+    void RawMesh::BakeNode(SR_UTILS_NS::BakedMeshBuilder& builder, const aiNode* pNode, int32_t parent) const {
+        aiVector3D scaling, rotation, translation;
+        pNode->mTransformation.Decompose(scaling, rotation, translation);
+
+        const uint32_t index = builder.AddNode(
+            pNode->mName.C_Str(),
+            parent,
+            Vec3 { translation.x, translation.y, translation.z },
+            Vec3 { rotation.x, rotation.y, rotation.z },
+            Vec3 { scaling.x, scaling.y, scaling.z },
+            std::vector<uint32_t>(pNode->mMeshes, pNode->mMeshes + pNode->mNumMeshes)
+        );
+
+        for (uint32_t i = 0; i < pNode->mNumChildren; ++i) {
+            BakeNode(builder, pNode->mChildren[i], static_cast<int32_t>(index));
+        }
+    }
+
+    void RawMesh::LoadBakedSkeleton() {
+        m_bones.resize(m_baked.GetSubmeshesCount());
+
+        for (uint32_t meshId = 0; meshId < m_baked.GetSubmeshesCount(); ++meshId) {
+            auto&& pBones = m_baked.GetBones(meshId);
+
+            for (uint32_t i = 0; i < m_baked.GetSubmesh(meshId).bonesCount; ++i) {
+                m_bones[meshId].insert(std::make_pair(pBones[i].hash, pBones[i].index));
+            }
+        }
+
+        auto&& pSkeleton = m_baked.GetSkeleton();
+
+        for (uint32_t i = 0; i < m_baked.GetSkeletonCount(); ++i) {
+            SR_MATH_NS::Matrix4x4 offset;
+            std::memcpy(&offset.self, pSkeleton[i].offset, sizeof(pSkeleton[i].offset));
+
+            m_optimizedBones[pSkeleton[i].hash] = static_cast<uint16_t>(pSkeleton[i].index);
+            m_boneOffsetsMap.insert(std::make_pair(pSkeleton[i].hash, offset));
+        }
+
+        m_boneOffsets.resize(m_boneOffsetsMap.size());
+
+        for (uint32_t i = 0; i < m_baked.GetSkeletonCount(); ++i) {
+            if (pSkeleton[i].index >= m_boneOffsets.size()) {
+                m_boneOffsets.resize(pSkeleton[i].index + 1);
+            }
+            m_boneOffsets[pSkeleton[i].index] = m_boneOffsetsMap.at(pSkeleton[i].hash);
+        }
     }
 
     uint32_t RawMesh::GetMeshesCount() const {
+        if (m_baked.Valid()) {
+            return m_baked.GetSubmeshesCount();
+        }
+
         if (!m_scene) {
             SRHalt("RawMesh::GetMeshesCount() : assimp scene is invalid!");
             return 0;
@@ -188,6 +364,15 @@ namespace SR_HTYPES_NS {
     }
 
     std::string RawMesh::GetGeometryName(uint32_t id) const {
+        if (m_baked.Valid()) {
+            if (id < m_baked.GetSubmeshesCount()) {
+                return std::string(m_baked.GetSubmeshName(id));
+            }
+
+            SRAssert2(false, "Out of range!");
+            return {};
+        }
+
         if (!m_scene || id >= m_scene->mNumMeshes) {
             SRAssert2(false, "Out of range or invalid scene!");
             return {};
@@ -197,6 +382,15 @@ namespace SR_HTYPES_NS {
     }
 
     std::vector<SR_UTILS_NS::Vertex> RawMesh::GetVertices(uint32_t id) const {
+        if (m_baked.Valid()) {
+            if (id < m_baked.GetSubmeshesCount()) {
+                return m_baked.GetVertices(id);
+            }
+
+            SRAssert2(false, "Out of range!");
+            return {};
+        }
+
         if (!m_scene || id >= m_scene->mNumMeshes) {
             SRAssert2(false, "Out of range or invalid scene!");
             return {};
@@ -289,6 +483,16 @@ namespace SR_HTYPES_NS {
     }
 
     std::vector<uint32_t> RawMesh::GetIndices(uint32_t id) const {
+        if (m_baked.Valid()) {
+            if (id < m_baked.GetSubmeshesCount()) {
+                auto&& pIndices = m_baked.GetIndices(id);
+                return std::vector<uint32_t>(pIndices, pIndices + m_baked.GetSubmesh(id).indexCount);
+            }
+
+            SRAssert2(false, "Out of range!");
+            return {};
+        }
+
         if (!m_scene || id >= m_scene->mNumMeshes) {
             SRAssert2(false, "Out of range or invalid scene!");
             return {};
@@ -323,6 +527,15 @@ namespace SR_HTYPES_NS {
     }
 
     uint32_t RawMesh::GetVerticesCount(uint32_t id) const {
+        if (m_baked.Valid()) {
+            if (id < m_baked.GetSubmeshesCount()) {
+                return m_baked.GetSubmesh(id).vertexCount;
+            }
+
+            SRAssert2(false, "Out of range!");
+            return {};
+        }
+
         if (!m_scene || id >= m_scene->mNumMeshes) {
             SRAssert2(false, "Out of range or invalid scene!");
             return {};
@@ -331,7 +544,42 @@ namespace SR_HTYPES_NS {
         return m_scene->mMeshes[id]->mNumVertices;
     }
 
+    float_t RawMesh::GetBoundingRadius(uint32_t id) const {
+        if (m_baked.Valid()) {
+            if (id < m_baked.GetSubmeshesCount()) {
+                return m_baked.GetSubmesh(id).bounds.radius;
+            }
+
+            SRAssert2(false, "Out of range!");
+            return {};
+        }
+
+        if (!m_scene || id >= m_scene->mNumMeshes) {
+            SRAssert2(false, "Out of range or invalid scene!");
+            return 0.f;
+        }
+
+        auto&& mesh = m_scene->mMeshes[id];
+
+        float_t radiusSq = 0.f;
+
+        for (uint32_t i = 0; i < mesh->mNumVertices; ++i) {
+            radiusSq = SR_MAX(radiusSq, mesh->mVertices[i].SquareLength());
+        }
+
+        return std::sqrt(radiusSq);
+    }
+
     uint32_t RawMesh::GetIndicesCount(uint32_t id) const {
+        if (m_baked.Valid()) {
+            if (id < m_baked.GetSubmeshesCount()) {
+                return m_baked.GetSubmesh(id).indexCount;
+            }
+
+            SRAssert2(false, "Out of range!");
+            return {};
+        }
+
         if (!m_scene || id >= m_scene->mNumMeshes) {
             SRAssert2(false, "Out of range or invalid scene!");
             return {};
@@ -349,10 +597,9 @@ namespace SR_HTYPES_NS {
     }
 
     float_t RawMesh::GetScaleFactor() const {
-        float_t factor = 0.f;
-
-        if (m_scene->mMetaData->Get("UnitScaleFactor", factor))
-           return static_cast<double_t>(factor);
+        if (auto&& factor = m_baked.GetScaleFactor()) {
+            return factor.value();
+        }
 
         SRAssert(false);
 
@@ -364,6 +611,10 @@ namespace SR_HTYPES_NS {
     }
 
     uint32_t RawMesh::GetAnimationsCount() const {
+        if (m_baked.Valid()) {
+            return m_baked.GetAnimationsCount();
+        }
+
         if (!m_scene) {
             SRHalt("Invalid scene!");
             return 0;
@@ -407,17 +658,6 @@ namespace SR_HTYPES_NS {
         }
     }
 
-    void RawMesh::CalculateAnimations() {
-        if (!m_params.animation || !m_scene) {
-            return;
-        }
-
-        for (uint32_t i = 0; i < m_scene->mNumAnimations; ++i) {
-            auto&& pAnimation = m_scene->mAnimations[i];
-            m_animations[SR_HASH_STR(pAnimation->mName.C_Str())] = pAnimation;
-        }
-    }
-
     void RawMesh::OptimizeSkeleton() {
         m_optimizedBones.clear();
 
@@ -560,6 +800,10 @@ namespace SR_HTYPES_NS {
     }
 
     int32_t RawMesh::GetMeshId(SR_UTILS_NS::StringAtom name) const {
+        if (m_baked.Valid()) {
+            return m_baked.FindSubmesh(name.ToStringRef());
+        }
+
         if (!m_scene) {
             SRHalt("Invalid scene!");
             return SR_ID_INVALID;
@@ -0,0 +1,118 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Utils/Types/SharedPtr.h>
+
+namespace SR_HTYPES_NS {
+    /// thread_local кэш разрушается раньше статических объектов, после этого работаем напрямую с общим списком
+    static thread_local bool gSharedPtrThreadCacheDestroyed = false;
+
+    struct SharedPtrDataPool::ThreadCache {
+        ~ThreadCache() {
+            gSharedPtrThreadCacheDestroyed = true;
+
+            /// поток завершается, возвращаем все блоки в общий список
+            if (count > 0) {
+                SharedPtrDataPool::Instance().Push(*this, count);
+            }
+        }
+
+        Block* pFree = nullptr;
+        uint64_t count = 0;
+    };
+
+    SharedPtrDataPool& SharedPtrDataPool::Instance() {
+        static auto&& pInstance = new SharedPtrDataPool();
+        return *pInstance;
+    }
+
+    SharedPtrDataPool::ThreadCache& SharedPtrDataPool::GetThreadCache() {
+        thread_local ThreadCache cache;
+        return cache;
+    }
+
+    void* SharedPtrDataPool::Allocate() {
+        if (gSharedPtrThreadCacheDestroyed) {
+            ThreadCache cache;
+            Pull(cache);
+            Block* pBlock = cache.pFree;
+            cache.pFree = pBlock->pNext;
+            --cache.count;
+            Push(cache, cache.count);
+            return pBlock;
+        }
+
+        auto&& cache = GetThreadCache();
+
+        if (!cache.pFree) {
+            Pull(cache);
+        }
+
+        Block* pBlock = cache.pFree;
+        cache.pFree = pBlock->pNext;
+        --cache.count;
+
+        return pBlock;
+    }
+
+    void SharedPtrDataPool::Free(void* pBlock) noexcept {
+        if (!pBlock) {
+            return;
+        }
+
+        auto&& pFreeBlock = static_cast<Block*>(pBlock);
+
+        if (gSharedPtrThreadCacheDestroyed) {
+            std::lock_guard lock(m_mutex);
+            pFreeBlock->pNext = m_free;
+            m_free = pFreeBlock;
+            return;
+        }
+
+        auto&& cache = GetThreadCache();
+
+        pFreeBlock->pNext = cache.pFree;
+        cache.pFree = pFreeBlock;
+        ++cache.count;
+
+        if (cache.count >= CacheBatch * 2) {
+            Push(cache, CacheBatch);
+        }
+    }
+
+    void SharedPtrDataPool::Pull(ThreadCache& cache) {
+        std::lock_guard lock(m_mutex);
+
+        if (!m_free) {
+            /// чанки не освобождаются, блоки из них переиспользуются до конца работы программы
+            auto&& pChunk = new Block[ChunkBlocks];
+            for (uint64_t i = 0; i < ChunkBlocks; ++i) {
+                pChunk[i].pNext = i + 1 < ChunkBlocks ? &pChunk[i + 1] : m_free;
+            }
+            m_free = pChunk;
+        }
+
+        for (uint64_t i = 0; i < CacheBatch && m_free; ++i) {
+            Block* pBlock = m_free;
+            m_free = pBlock->pNext;
+
+            pBlock->pNext = cache.pFree;
+            cache.pFree = pBlock;
+            ++cache.count;
+        }
+    }
+
+    void SharedPtrDataPool::Push(ThreadCache& cache, uint64_t count) noexcept {
+        std::lock_guard lock(m_mutex);
+
+        for (uint64_t i = 0; i < count && cache.pFree; ++i) {
+            Block* pBlock = cache.pFree;
+            cache.pFree = pBlock->pNext;
+            --cache.count;
+
+            pBlock->pNext = m_free;
+            m_free = pBlock;
+        }
+    }
+}
@@ -4,6 +4,7 @@
 
 #include <Utils/Types/Stream.h>
 #include <Utils/Common/StringUtils.h>
+#include <Utils/Profile/MemoryTracker.h>
 
 namespace SR_HTYPES_NS {
     Stream::Stream(const char *pData, uint64_t size)
@@ -147,13 +148,32 @@ namespace SR_HTYPES_NS {
         m_pos += count;
     }
 
+    void Stream::Replace(uint64_t offset, uint64_t count, const void* pSrc, uint64_t size) {
+        SRAssert(offset + count <= m_size);
+
+        const uint64_t newSize = m_size - count + size;
+
+        if (newSize > m_capacity) {
+            Reserve(SR_MAX(newSize + newSize / 2, 64));
+        }
+
+        if (size != count) {
+            memmove(m_data + offset + size, m_data + offset + count, m_size - offset - count);
+        }
+
+        if (size > 0) {
+            memcpy(m_data + offset, pSrc, size);
+        }
+
+        m_size = newSize;
+    }
+
     char* Stream::Allocate(uint64_t size) {
-        char* pBlock = (char*)malloc(size);
-        return pBlock;
+        return static_cast<char*>(SR_UTILS_NS::MemoryTracker::Allocate(SR_UTILS_NS::MemoryTag::Marshal, size));
     }
 
     void Stream::Free(char* pData) {
-        free(pData);
+        SR_UTILS_NS::MemoryTracker::Free(pData);
     }
 
     std::string Stream::ToString() const noexcept {
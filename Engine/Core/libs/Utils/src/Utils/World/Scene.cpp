@@ -17,6 +17,7 @@
 
 #include <Utils/ECS/Component.h>
 #include <Utils/ECS/GameObject.h>
+#include <Utils/ECS/Transform.h>
 
 #include <Utils/Platform/Platform.h>
 
@@ -205,20 +206,118 @@ namespace SR_WORLD_NS {
         return m_rootObjects;
     }
 
-    GameObject::Ptr Scene::FindByComponent(const std::string &name) {
-        for (auto&& gameObject : m_gameObjects) {
-            if (gameObject->ContainsComponent(name)) {
-                return gameObject;
+    uint64_t Scene::CalculateChecksum() {
+        uint64_t checksum = SR_FNV_OFFSET_BASIS;
+
+        std::function<void(const GameObjectPtr&)> appendGameObject = [&](const GameObjectPtr& pGameObject) {
+            checksum = FNV1AAppendValue(checksum, pGameObject->GetHashName());
+            checksum = FNV1AAppendValue(checksum, pGameObject->IsActive());
+
+            if (auto&& pTransform = pGameObject->GetTransform()) {
+                checksum = FNV1AAppendValue(checksum, pTransform->GetTranslation());
+                checksum = FNV1AAppendValue(checksum, pTransform->GetRotation());
+                checksum = FNV1AAppendValue(checksum, pTransform->GetScale());
             }
+
+            checksum = FNV1AAppendValue(checksum, pGameObject->GetChildrenRef().size());
+
+            for (auto&& pChild : pGameObject->GetChildrenRef()) {
+                appendGameObject(pChild);
+            }
+        };
+
+        for (auto&& pGameObject : GetRootGameObjects()) {
+            appendGameObject(pGameObject);
         }
 
-        return GameObject::Ptr();
+        return checksum;
+    }
+
+    GameObject::Ptr Scene::FindByComponent(const std::string &name) {
+        return FindByComponent(SR_HASH_STR(name));
+    }
+
+    GameObject::Ptr Scene::FindByComponent(uint64_t componentHashName) {
+        return FindAllByComponent(componentHashName).Front();
+    }
+
+    GameObject::Ptr Scene::FindByTag(uint64_t tag) {
+        return FindAllByTag(tag).Front();
+    }
+
+    Scene::GameObjectRange Scene::FindAll(uint64_t hashName) const {
+        return GameObjectRange(m_gameObjects, m_nameIndex.Get(hashName));
+    }
+
+    Scene::GameObjectRange Scene::FindAllByTag(uint64_t tag) const {
+        return GameObjectRange(m_gameObjects, m_tagIndex.Get(tag));
+    }
+
+    Scene::GameObjectRange Scene::FindAllByComponent(uint64_t componentHashName) const {
+        return GameObjectRange(m_gameObjects, m_componentIndex.Get(componentHashName));
     }
 
     void Scene::OnChanged() {
         m_isHierarchyChanged = true;
     }
 
+    bool Scene::IsIndexed(const GameObject* pGameObject) const {
+        const uint64_t idInScene = pGameObject->GetIdInScene();
+        return idInScene < m_gameObjects.size() && m_gameObjects[idInScene].Get() == pGameObject;
+    }
+
+    void Scene::AddToIndices(const GameObjectPtr& gameObject) {
+        const uint64_t idInScene = gameObject->GetIdInScene();
+
+        m_nameIndex.Add(gameObject->GetHashName(), idInScene);
+        m_tagIndex.Add(gameObject->GetTag(), idInScene);
+
+        for (auto&& pComponent : gameObject->GetComponents()) {
+            m_componentIndex.Add(pComponent->GetComponentHashName(), idInScene);
+        }
+    }
+
+    void Scene::RemoveFromIndices(const GameObjectPtr& gameObject) {
+        const uint64_t idInScene = gameObject->GetIdInScene();
+
+        m_nameIndex.Remove(gameObject->GetHashName(), idInScene);
+        m_tagIndex.Remove(gameObject->GetTag(), idInScene);
+
+        for (auto&& pComponent : gameObject->GetComponents()) {
+            m_componentIndex.Remove(pComponent->GetComponentHashName(), idInScene);
+        }
+    }
+
+    void Scene::OnGameObjectNameChanged(const GameObject* pGameObject, uint64_t oldHashName) {
+        if (!IsIndexed(pGameObject)) {
+            return;
+        }
+
+        m_nameIndex.Remove(oldHashName, pGameObject->GetIdInScene());
+        m_nameIndex.Add(pGameObject->GetHashName(), pGameObject->GetIdInScene());
+    }
+
+    void Scene::OnGameObjectTagChanged(const GameObject* pGameObject, uint64_t oldTag) {
+        if (!IsIndexed(pGameObject)) {
+            return;
+        }
+
+        m_tagIndex.Remove(oldTag, pGameObject->GetIdInScene());
+        m_tagIndex.Add(pGameObject->GetTag(), pGameObject->GetIdInScene());
+    }
+
+    void Scene::OnGameObjectComponentAttached(const GameObject* pGameObject, const Component* pComponent) {
+        if (IsIndexed(pGameObject)) {
+            m_componentIndex.Add(pComponent->GetComponentHashName(), pGameObject->GetIdInScene());
+        }
+    }
+
+    void Scene::OnGameObjectComponentDetached(const GameObject* pGameObject, const Component* pComponent) {
+        if (IsIndexed(pGameObject)) {
+            m_componentIndex.Remove(pComponent->GetComponentHashName(), pGameObject->GetIdInScene());
+        }
+    }
+
     bool Scene::Save() {
         return SaveAt(m_path);
     }
@@ -269,6 +368,8 @@ namespace SR_WORLD_NS {
             return false;
         }
 
+        RemoveFromIndices(gameObject);
+
         m_gameObjects.at(idInScene) = GameObject::Ptr();
         m_freeObjIndices.emplace_back(idInScene);
 
@@ -317,15 +418,7 @@ namespace SR_WORLD_NS {
     }
 
     GameObject::Ptr Scene::Find(uint64_t hashName) {
-        for (auto&& object : m_gameObjects) {
-            /// блокировать объекты не нужно, так как уничтожиться они могут только из сцены
-            /// Но стоит предусмотреть защиту от одновременного изменения имени
-            if (object && object->GetHashName() == hashName) {
-                return object;
-            }
-        }
-
-        return GameObject::Ptr();
+        return FindAll(hashName).Front();
     }
 
     GameObject::Ptr Scene::Find(const std::string &name) {
@@ -356,6 +449,23 @@ namespace SR_WORLD_NS {
         OnChanged();
     }
 
+    void Scene::RegisterGameObjects(const Scene::GameObjects& gameObjects) {
+        SRAssert(!m_isPreDestroyed);
+
+        if (gameObjects.empty()) {
+            return;
+        }
+
+        for (auto&& gameObject : gameObjects) {
+            SRAssert(!gameObject->GetScene());
+            m_newQueue.emplace_back(gameObject);
+            gameObject->SetScene(this);
+        }
+
+        SetDirty(true);
+        OnChanged();
+    }
+
     void Scene::Prepare() {
         if (!m_deleteQueue.empty() || !m_newQueue.empty() || !m_destroyedComponents.empty()) {
             SetDirty(true);
@@ -387,6 +497,8 @@ namespace SR_WORLD_NS {
                     m_gameObjects[m_freeObjIndices.front()] = gameObject;
                     m_freeObjIndices.erase(m_freeObjIndices.begin());
                 }
+
+                AddToIndices(gameObject);
             }
         }
 
@@ -0,0 +1,75 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Utils/World/SceneIndex.h>
+
+namespace SR_WORLD_NS {
+    void SceneIndex::Add(Key key, Id id) {
+        auto&& bucket = m_buckets[key];
+
+        auto&& [pIt, inserted] = bucket.entries.try_emplace(id);
+        if (!inserted) {
+            ++pIt->second.count;
+            return;
+        }
+
+        pIt->second.position = static_cast<uint32_t>(bucket.ids.size());
+        pIt->second.count = 1;
+
+        bucket.ids.emplace_back(id);
+    }
+
+    void SceneIndex::Remove(Key key, Id id) {
+        auto&& pBucketIt = m_buckets.find(key);
+        if (pBucketIt == m_buckets.end()) {
+            return;
+        }
+
+        auto&& bucket = pBucketIt->second;
+
+        auto&& pIt = bucket.entries.find(id);
+        if (pIt == bucket.entries.end()) {
+            return;
+        }
+
+        if (--pIt->second.count > 0) {
+            return;
+        }
+
+        const uint32_t position = pIt->second.position;
+        const Id lastId = bucket.ids.back();
+
+        bucket.ids[position] = lastId;
+        bucket.entries[lastId].position = position;
+        bucket.ids.pop_back();
+
+        bucket.entries.erase(id);
+
+        if (bucket.ids.empty()) {
+            m_buckets.erase(pBucketIt);
+        }
+    }
+
+    void SceneIndex::Clear() {
+        m_buckets.clear();
+    }
+
+    const SceneIndex::Ids& SceneIndex::Get(Key key) const {
+        static const Ids empty;
+
+        if (auto&& pIt = m_buckets.find(key); pIt != m_buckets.end()) {
+            return pIt->second.ids;
+        }
+
+        return empty;
+    }
+
+    bool SceneIndex::Contains(Key key, Id id) const {
+        if (auto&& pIt = m_buckets.find(key); pIt != m_buckets.end()) {
+            return pIt->second.entries.count(id) == 1;
+        }
+
+        return false;
+    }
+}
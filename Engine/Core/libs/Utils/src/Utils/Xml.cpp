@@ -3,6 +3,7 @@
 //
 
 #include <Utils/Xml.h>
+#include <Utils/CompiledConfig.h>
 
 namespace SR_UTILS_NS {
     std::string Xml::Attribute::ToString() const {
@@ -10,7 +11,7 @@ namespace SR_UTILS_NS {
             return std::string();
         }
         else
-            return m_attribute.as_string();
+            return m_pConfig ? GetCompiledValue() : m_attribute.as_string();
     }
 
     int32_t Xml::Attribute::ToInt() const {
@@ -18,7 +19,7 @@ namespace SR_UTILS_NS {
             return 0;
         }
         else
-            return m_attribute.as_int();
+            return m_pConfig ? GetCompiled().int32 : m_attribute.as_int();
     }
 
     float_t Xml::Attribute::ToFloat() const {
@@ -26,7 +27,7 @@ namespace SR_UTILS_NS {
             return 0.f;
         }
         else
-            return m_attribute.as_float();
+            return m_pConfig ? GetCompiled().float32 : m_attribute.as_float();
     }
 
     double_t Xml::Attribute::ToDouble() const {
@@ -34,7 +35,7 @@ namespace SR_UTILS_NS {
             return 0.f;
         }
         else
-            return m_attribute.as_double();
+            return m_pConfig ? GetCompiled().float64 : m_attribute.as_double();
     }
 
     bool Xml::Attribute::ToBool() const {
@@ -42,56 +43,64 @@ namespace SR_UTILS_NS {
             return false;
         }
         else
-            return m_attribute.as_bool();
+            return m_pConfig ? GetCompiled().boolean != 0 : m_attribute.as_bool();
     }
 
     std::string Xml::Attribute::ToString(const std::string &def) const {
-        return m_valid ? m_attribute.as_string() : def;
+        return m_valid ? (m_pConfig ? GetCompiledValue() : m_attribute.as_string()) : def;
     }
 
     int32_t Xml::Attribute::ToInt(int32_t def) const {
-        return m_valid ? m_attribute.as_int() : def;
+        return m_valid ? (m_pConfig ? GetCompiled().int32 : m_attribute.as_int()) : def;
     }
 
     float_t Xml::Attribute::ToFloat(float_t def) const {
-        return m_valid ? m_attribute.as_float() : def;
+        return m_valid ? (m_pConfig ? GetCompiled().float32 : m_attribute.as_float()) : def;
     }
 
     bool Xml::Attribute::ToBool(bool def) const {
-        return m_valid ? m_attribute.as_bool() : def;
+        return m_valid ? (m_pConfig ? GetCompiled().boolean != 0 : m_attribute.as_bool()) : def;
     }
 
     int64_t Xml::Attribute::ToInt64(int64_t def) const {
-        return m_valid ? m_attribute.as_llong() : def;
+        return m_valid ? (m_pConfig ? GetCompiled().int64 : m_attribute.as_llong()) : def;
     }
 
     int64_t Xml::Attribute::ToInt64() const {
         if (!CheckError("Attribute::ToInt64() : attribute isn't valid!"))
             return 0;
         else
-            return m_attribute.as_llong();
+            return m_pConfig ? GetCompiled().int64 : m_attribute.as_llong();
     }
 
     uint64_t Xml::Attribute::ToUInt64() const {
         if (!CheckError("Attribute::ToInt64() : attribute isn't valid!"))
             return 0;
         else
-            return m_attribute.as_ullong();
+            return m_pConfig ? GetCompiled().uint64 : m_attribute.as_ullong();
     }
 
     uint32_t Xml::Attribute::ToUInt() const {
         if (!CheckError("Attribute::ToUInt() : attribute isn't valid!"))
             return 0;
         else
-            return m_attribute.as_uint();
+            return m_pConfig ? GetCompiled().uint32 : m_attribute.as_uint();
     }
 
     uint32_t Xml::Attribute::ToUInt(uint32_t def) const {
-        return m_valid ? m_attribute.as_uint() : def;
+        return m_valid ? (m_pConfig ? GetCompiled().uint32 : m_attribute.as_uint()) : def;
     }
 
     uint64_t Xml::Attribute::ToUInt64(uint64_t def) const {
-        return m_valid ? m_attribute.as_ullong() : def;
+        return m_valid ? (m_pConfig ? GetCompiled().uint64 : m_attribute.as_ullong()) : def;
+    }
+
+    const Xml::CompiledAttribute& Xml::Attribute::GetCompiled() const {
+        return m_pConfig->GetAttribute(m_compiledId);
+    }
+
+    const char* Xml::Attribute::GetCompiledValue() const {
+        return m_pConfig->GetCString(GetCompiled().value);
     }
 
     Xml::Document Xml::Document::Load(const Path &path) {
@@ -99,14 +108,19 @@ namespace SR_UTILS_NS {
         SR_TRACY_TEXT_N("Path", path.ToStringRef());
 
         auto&& fileData = SR_PLATFORM_NS::ReadFile(path);
-        auto xml = Document::New();
 
         if (!fileData) {
             SR_ERROR("Document::Load() : file not exists! \n\tPath: " + path.ToString());
             return Document(); /// NOLINT
         }
 
-        if (pugi::xml_parse_result result = xml.m_document->load_string(fileData->c_str())) {
+        return LoadFromString(*fileData, path);
+    }
+
+    Xml::Document Xml::Document::LoadFromString(const std::string& data, const Path& path) {
+        auto xml = Document::New();
+
+        if (pugi::xml_parse_result result = xml.m_document->load_string(data.c_str())) {
             xml.m_valid = true;
             xml.m_path = std::move(path.ToString());
         }
@@ -119,10 +133,46 @@ namespace SR_UTILS_NS {
         return xml;
     }
 
+    Xml::Document Xml::Document::Unpack() const {
+        if (!Valid()) {
+            return Document();
+        }
+
+        auto xml = Document::New();
+        xml.m_path = m_path;
+
+        if (m_compiled) {
+            m_compiled->CopyChildren(xml.m_document->root(), 0);
+        }
+        else {
+            xml.m_document->reset(*m_document);
+        }
+
+        return xml;
+    }
+
+    Xml::Node Xml::Document::DocumentElement() const {
+        if (!m_compiled) {
+            return Node(m_document->document_element());
+        }
+
+        for (auto&& node : Root().GetNodes()) {
+            if (m_compiled->GetNode(node.m_compiledId).type == pugi::node_element) {
+                return node;
+            }
+        }
+
+        return Node();
+    }
+
     std::string Xml::Document::Dump() const {
         if (!Valid())
             return std::string();
 
+        if (m_compiled) {
+            return Unpack().Dump();
+        }
+
         std::ostringstream stream;
         m_document->save(stream, PUGIXML_TEXT("    "));
 
@@ -134,6 +184,36 @@ namespace SR_UTILS_NS {
         , m_valid(false)
     { }
 
+    std::string_view Xml::Node::GetCompiledName() const {
+        return m_pConfig->GetString(m_pConfig->GetNode(m_compiledId).name);
+    }
+
+    Xml::Attribute Xml::Node::FindCompiledAttribute(std::string_view name) const {
+        auto&& node = m_pConfig->GetNode(m_compiledId);
+
+        for (uint32_t i = node.firstAttribute; i < node.firstAttribute + node.attributesCount; ++i) {
+            if (m_pConfig->GetString(m_pConfig->GetAttribute(i).name) == name) {
+                return Attribute(m_pConfig, i);
+            }
+        }
+
+        return Attribute();
+    }
+
+    Xml::Node Xml::Node::FindCompiledNode(std::string_view name) const {
+        auto&& node = m_pConfig->GetNode(m_compiledId);
+
+        /// как pugi::xml_node::child, ищутся только элементы
+        for (uint32_t i = node.firstChild; i < node.firstChild + node.childrenCount; ++i) {
+            auto&& child = m_pConfig->GetNode(i);
+            if (child.type == pugi::node_element && m_pConfig->GetString(child.name) == name) {
+                return Node(m_pConfig, i);
+            }
+        }
+
+        return Node();
+    }
+
     Xml::Document Xml::Node::ToDocument() const {
         auto doc = Document::New();
         doc.Root().AppendChild(*this);
@@ -147,6 +227,8 @@ namespace SR_UTILS_NS {
             return Node();
         }
 
+        SRAssert2(!m_pConfig, "Node::AppendChild() : compiled node is read-only!");
+
         return Node(m_node.append_child(name.c_str()));
     }
 
@@ -158,6 +240,15 @@ namespace SR_UTILS_NS {
         }
 
         auto&& nodes = std::vector<Node>();
+
+        if (m_pConfig) {
+            auto&& node = m_pConfig->GetNode(m_compiledId);
+            nodes.reserve(node.childrenCount);
+            for (uint32_t i = node.firstChild; i < node.firstChild + node.childrenCount; ++i)
+                nodes.emplace_back(Node(m_pConfig, i));
+            return nodes;
+        }
+
         for (const auto child : m_node.children())
             nodes.emplace_back(Node(child));
 
@@ -187,6 +278,15 @@ namespace SR_UTILS_NS {
         }
 
         auto nodes = std::vector<Node>();
+
+        if (m_pConfig) {
+            auto&& node = m_pConfig->GetNode(m_compiledId);
+            for (uint32_t i = node.firstChild; i < node.firstChild + node.childrenCount; ++i)
+                if (m_pConfig->GetString(m_pConfig->GetNode(i).name) == name)
+                    nodes.emplace_back(Node(m_pConfig, i));
+            return nodes;
+        }
+
         for (const auto child : m_node.children())
             if (std::string(child.name()) == name)
                 nodes.emplace_back(Node(child));
@@ -195,6 +295,10 @@ namespace SR_UTILS_NS {
     }
 
     Xml::Node Xml::Node::AppendChild(const Xml::Node& node) {
+        if (node.m_pConfig) {
+            return Xml::Node(node.m_pConfig->CopyTo(m_node, node.m_compiledId));
+        }
+
         return Xml::Node(m_node.append_copy(node.m_node));
     }
 }
\ No newline at end of file
@@ -8,6 +8,8 @@
 #include <Utils/Common/CmdOptions.h>
 #include <Utils/World/SceneAllocator.h>
 #include <Utils/ResourceManager/ResourceManager.h>
+#include <Utils/Profile/MemoryTracker.h>
+#include <Utils/Profile/FrameRecorder.h>
 #include <Utils/SRLM/LogicalNodeManager.h>
 #include <Utils/SRLM/DataTypeManager.h>
 
@@ -39,6 +41,23 @@ namespace SR_CORE_NS {
             m_resourcesPath = folder;
         }
 
+        /// -record <path> пишет сессию, -replay <path> повторяет ее и пишет отчет <path>.csv
+        if (auto&& path = SR_UTILS_NS::GetCmdOption(argv, argv + argc, "-record"); !path.empty()) {
+            m_recordPath = path;
+        }
+
+        if (auto&& path = SR_UTILS_NS::GetCmdOption(argv, argv + argc, "-replay"); !path.empty()) {
+            m_replayPath = path;
+        }
+
+        /// -headless воспроизводит сессию без окна и отрисовки, кадры идут без пауз
+        m_isHeadless = SR_UTILS_NS::HasCmdOption(argv, argv + argc, "-headless");
+
+        if (m_isHeadless && m_replayPath.Empty()) {
+            SR_ERROR("Application::PreInit() : headless mode requires -replay!");
+            return false;
+        }
+
         if (!m_resourcesPath.Exists(SR_UTILS_NS::Path::Type::Folder) && !FindResourcesFolder()) {
             SR_ERROR("Application::PreInit() : failed to find resources folder!");
             return false;
@@ -103,6 +122,7 @@ namespace SR_CORE_NS {
 
         SR_UTILS_NS::Debug::Instance().Init(m_applicationPath, true, SR_UTILS_NS::Debug::Theme::Dark);
         SR_UTILS_NS::Debug::Instance().SetLevel(SR_UTILS_NS::Debug::Level::Low);
+        SR_UTILS_NS::Debug::Instance().SetAsync(true, SR_UTILS_NS::LogOverflowPolicy::Block);
 
         return true;
     }
@@ -144,6 +164,7 @@ namespace SR_CORE_NS {
         });
 
         m_engine = SR_CORE_NS::Engine::MakeShared(this);
+        m_engine->SetHeadless(m_isHeadless);
 
         if (!m_engine->Create()) {
             SR_ERROR("Application::Init() : failed to create game engine!");
@@ -155,6 +176,20 @@ namespace SR_CORE_NS {
             return false;
         }
 
+        /// сессия одна на запуск, перезагрузка приложения ее завершает
+        if (!m_replayPath.Empty()) {
+            if (!SR_UTILS_NS::FrameRecorder::Instance().StartReplay(m_replayPath)) {
+                SR_ERROR("Application::Init() : failed to start replay!");
+                return false;
+            }
+        }
+        else if (!m_recordPath.Empty()) {
+            SR_UTILS_NS::FrameRecorder::Instance().StartRecording(m_recordPath);
+        }
+
+        m_replayPath = SR_UTILS_NS::Path();
+        m_recordPath = SR_UTILS_NS::Path();
+
         if (!m_engine->Run()) {
             SR_ERROR("Application::Init() : failed to run game engine!");
             return false;
@@ -186,6 +221,17 @@ namespace SR_CORE_NS {
                 break;
             }
 
+            if (SR_UTILS_NS::FrameRecorder::Instance().IsReplayFinished()) {
+                SR_SYSTEM_LOG("Application::Execute() : replay completed!");
+                break;
+            }
+
+            /// после перезагрузки приложения воспроизведение не возобновляется
+            if (m_engine->IsHeadless() && !SR_UTILS_NS::FrameRecorder::Instance().IsReplaying()) {
+                SR_SYSTEM_LOG("Application::Execute() : headless replay stopped!");
+                break;
+            }
+
             if (m_engine->GetWindow() && !m_engine->GetWindow()->IsValid()) {
                 SR_SYSTEM_LOG("Application::Execute() : window has been closed!");
                 break;
@@ -193,6 +239,11 @@ namespace SR_CORE_NS {
 
             m_engine->FlushScene();
 
+            if (m_engine->IsHeadless()) {
+                m_engine->UpdateHeadless();
+                continue;
+            }
+
             if (m_isNeedPlaySound) {
                 TryPlayStartSound();
             }
@@ -204,6 +255,8 @@ namespace SR_CORE_NS {
     }
 
     void Application::Close() {
+        SR_UTILS_NS::FrameRecorder::Instance().Stop();
+
         m_engine.AutoFree([](auto&& pEngine) {
             pEngine->Close();
             delete pEngine;
@@ -230,6 +283,8 @@ namespace SR_CORE_NS {
 
         SR_HTYPES_NS::Thread::Factory::Instance().PrintThreads();
 
+        SR_UTILS_NS::MemoryTracker::Instance().ReportLeaks();
+
         SR_UTILS_NS::GetSingletonManager()->DestroyAll();
     }
 
@@ -10,27 +10,25 @@
 
 #include <Graphics/Animations/Skeleton.h>
 
-#include <assimp/scene.h>
-#include <assimp/postprocess.h>
-#include <assimp/Importer.hpp>
-
 namespace SR_CORE_NS {
     bool Importers::ImportSkeletonFromRawMesh(const SR_HTYPES_NS::RawMesh* pRawMesh, SR_ANIMATIONS_NS::Skeleton* pSkeleton) {
-        const aiScene* pScene = pRawMesh->GetAssimpScene();
+        auto&& pBakedMesh = pRawMesh->GetBakedMesh();
 
-        if (!pScene->mRootNode) {
+        if (!pBakedMesh || pBakedMesh->GetNodesCount() == 0) {
             return false;
         }
 
-        const SR_HTYPES_NS::Function<void(aiNode*, SR_ANIMATIONS_NS::Bone*)> processNode = [&](aiNode* node, SR_ANIMATIONS_NS::Bone* pBone) {
-            pBone = pSkeleton->AddBone(pBone, node->mName.C_Str(), false);
+        const SR_HTYPES_NS::Function<void(uint32_t, SR_ANIMATIONS_NS::Bone*)> processNode = [&](uint32_t nodeId, SR_ANIMATIONS_NS::Bone* pBone) {
+            auto&& node = pBakedMesh->GetNode(nodeId);
+
+            pBone = pSkeleton->AddBone(pBone, std::string(pBakedMesh->GetNodeName(nodeId)), false);
 
-            for (uint32_t i = 0; i < node->mNumChildren; ++i) {
-                processNode(node->mChildren[i], pBone);
+            for (uint32_t i = 0; i < node.childrenCount; ++i) {
+                processNode(pBakedMesh->GetNodeIndices()[node.childrenOffset + i], pBone);
             }
         };
 
-        processNode(pScene->mRootNode, pSkeleton->GetRootBone());
+        processNode(0, pSkeleton->GetRootBone());
 
         /// если нет сцены, значит загружаем сырой компонент
         if (!pSkeleton->HasScene()) {
@@ -13,6 +13,9 @@
 #include <Utils/World/SceneUpdater.h>
 #include <Utils/Common/Features.h>
 #include <Utils/ECS/ComponentManager.h>
+#include <Utils/Profile/Profiler.h>
+#include <Utils/Profile/MemoryTracker.h>
+#include <Utils/Profile/FrameRecorder.h>
 
 #include <Graphics/GUI/WidgetManager.h>
 #include <Graphics/Render/RenderScene.h>
@@ -52,16 +55,21 @@ namespace SR_CORE_NS {
             return false;
         }
 
-        SR_INFO("Engine::Create() : create main window...");
-
-        if (!CreateMainWindow()) {
-            SR_ERROR("Engine::Create() : failed to create main window!");
-            return false;
+        if (m_isHeadless) {
+            SR_INFO("Engine::Create() : headless mode, window and render are not created");
         }
+        else {
+            SR_INFO("Engine::Create() : create main window...");
 
-        if (!InitializeRender()) {
-            SR_ERROR("Engine::Create() : failed to initialize render!");
-            return false;
+            if (!CreateMainWindow()) {
+                SR_ERROR("Engine::Create() : failed to create main window!");
+                return false;
+            }
+
+            if (!InitializeRender()) {
+                SR_ERROR("Engine::Create() : failed to initialize render!");
+                return false;
+            }
         }
 
         SR_UTILS_NS::ComponentManager::Instance().SetContextInitializer([pEngine = GetThis()](auto&& context) {
@@ -95,7 +103,8 @@ namespace SR_CORE_NS {
         m_input->Register(&Graphics::GUI::GlobalWidgetManager::Instance());
         m_input->Register(m_editor);
 
-        SetGameMode(!SR_UTILS_NS::Features::Instance().Enabled("EditorOnStartup", false));
+        /// без окна редактор не отрисовывается и не получает ввод
+        SetGameMode(m_isHeadless || !SR_UTILS_NS::Features::Instance().Enabled("EditorOnStartup", false));
 
         m_autoReloadResources = SR_UTILS_NS::Features::Instance().Enabled("AutoReloadResources", false);
 
@@ -314,6 +323,15 @@ namespace SR_CORE_NS {
 
         SR_INFO("Engine::Init() : initializing game engine...");
 
+        if (SR_UTILS_NS::Features::Instance().Enabled("MemoryCallstackSampling", false)) {
+            SR_UTILS_NS::MemoryTracker::SetSampleRate(SR_UTILS_NS::MemoryTracker::DefaultSampleRate);
+        }
+
+        /// без окна ввод берется только из записи сессии
+        if (!m_isHeadless && SR_UTILS_NS::Features::Instance().Enabled("EventDrivenInput", true)) {
+            SR_UTILS_NS::Input::Instance().AddSource(SR_PLATFORM_NS::CreateInputSource());
+        }
+
         m_isInit = true;
 
         return true;
@@ -364,6 +382,8 @@ namespace SR_CORE_NS {
         }
         SR_SAFE_DELETE_PTR(m_input);
 
+        SR_UTILS_NS::Input::Instance().ClearSources();
+
         if (m_engineScene) {
             SetScene(ScenePtr());
         }
@@ -404,13 +424,32 @@ namespace SR_CORE_NS {
             return;
         }
 
-        SR_TRACY_ZONE_N("Main frame");
+        Frame();
+    }
+
+    void Engine::UpdateHeadless() {
+        if (!m_isHeadless) {
+            SRHalt("Engine::UpdateHeadless() : engine has a window!");
+            return;
+        }
+
+        if (m_isRun) {
+            Frame();
+        }
+    }
+
+    void Engine::Frame() {
+        SR_PROFILE_FRAME_BEGIN();
+        SR_PROFILE_ZONE_N("Main frame");
 
         SR_HTYPES_NS::Time::Instance().Update();
 
+        auto&& recorder = SR_UTILS_NS::FrameRecorder::Instance();
+
         const auto now = SR_HTYPES_NS::Time::Instance().Now();
-        const auto deltaTime = now - m_timeStart; /// nanoseconds
-        const auto dt = static_cast<float_t>(deltaTime.count()) / SR_CLOCKS_PER_SEC / SR_CLOCKS_PER_SEC / SR_CLOCKS_PER_SEC; /// Seconds
+        /// при воспроизведении dt берется из записи
+        const auto deltaTime = recorder.BeginFrame(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now - m_timeStart).count())); /// nanoseconds
+        const auto dt = static_cast<float_t>(deltaTime) / SR_CLOCKS_PER_SEC / SR_CLOCKS_PER_SEC / SR_CLOCKS_PER_SEC; /// Seconds
         m_timeStart = now;
 
         SR_UTILS_NS::ResourceManager::Instance().UpdateWatchers(dt);
@@ -419,6 +458,8 @@ namespace SR_CORE_NS {
             SR_UTILS_NS::ResourceManager::Instance().ReloadResources(dt);
         }
 
+        uint64_t checksum = 0;
+
         /// синхронно отрисовываем сцену
         {
             auto&& readLock = m_sceneQueue.ReadLock();
@@ -426,11 +467,24 @@ namespace SR_CORE_NS {
             if (m_engineScene) {
                 m_engineScene->Draw(dt);
             }
+
+            if (recorder.IsActive() && m_engineScene && m_engineScene->pScene.LockIfValid()) {
+                checksum = m_engineScene->pScene->CalculateChecksum();
+                m_engineScene->pScene.Unlock();
+            }
         }
 
-        if (m_editor && m_window->IsWindowFocus()) {
+        if (m_editor && m_window && m_window->IsWindowFocus()) {
             m_editor->Update(dt);
         }
+
+        recorder.EndFrame(checksum);
+
+        SR_UTILS_NS::MemoryTracker::Instance().Update();
+
+        SR_PROFILE_COUNTER("Resources", SR_UTILS_NS::ResourceManager::Instance().GetResourcesCount());
+        SR_PROFILE_COUNTER("Resources to destroy", SR_UTILS_NS::ResourceManager::Instance().GetDestroyQueueSize());
+        SR_PROFILE_FRAME_END();
     }
 
     bool Engine::SetScene(const SR_HTYPES_NS::SafePtr<SR_WORLD_NS::Scene> &scene)  {
@@ -447,7 +501,7 @@ namespace SR_CORE_NS {
         while (m_isRun) {
             SR_HTYPES_NS::Thread::Sleep(250);
 
-            SR_TRACY_ZONE_N("World");
+            SR_PROFILE_ZONE_N("World");
 
             SR_MAYBE_UNUSED auto&& readLock = m_sceneQueue.ReadLock();
 
@@ -482,10 +536,13 @@ namespace SR_CORE_NS {
     }
 
     void Engine::FixedUpdate() {
-        SR_TRACY_ZONE;
+        SR_PROFILE_ZONE;
+
+        /// при воспроизведении фокус шага берется из записи
+        const bool isFocused = SR_UTILS_NS::FrameRecorder::Instance().BeginFixedStep(m_window && m_window->IsWindowFocus());
 
         ///В этом блоке находится обработка нажатия клавиш, которая не должна срабатывать, если окно не сфокусированно
-        if (m_window->IsWindowFocus())
+        if (isFocused)
         {
             SR_UTILS_NS::Input::Instance().Check();
             m_input->Check();
@@ -518,7 +575,7 @@ namespace SR_CORE_NS {
                 return;
             }
 
-            if (IsGameMode() && SR_UTILS_NS::Input::Instance().IsMouseMoved() && SR_UTILS_NS::Input::Instance().IsCursorLocked()) {
+            if (m_window && IsGameMode() && SR_UTILS_NS::Input::Instance().IsMouseMoved() && SR_UTILS_NS::Input::Instance().IsCursorLocked()) {
                 auto&& resolution = m_window->GetSize();
                 resolution /= 2;
                 SR_PLATFORM_NS::SetMousePos(m_window->GetPosition() + resolution.Cast<int32_t>());
@@ -526,7 +583,7 @@ namespace SR_CORE_NS {
             }
         }
 
-        if (m_editor && m_window->IsWindowFocus()) {
+        if (m_editor && isFocused) {
             m_editor->FixedUpdate();
         }
     }
@@ -543,6 +600,15 @@ namespace SR_CORE_NS {
         }
     }
 
+    void Engine::SetHeadless(bool headless) {
+        if (m_isCreate) {
+            SR_ERROR("Engine::SetHeadless() : game engine is already created!");
+            return;
+        }
+
+        m_isHeadless = headless;
+    }
+
     void Engine::SetSpeed(float_t speed) {
         m_speed = speed;
     }
@@ -10,13 +10,7 @@
 namespace SR_CORE_NS {
     bool RegisterMigrators() {
         static const auto GAME_OBJECT_HASH_NAME = SR_HASH_STR("GameObject");
-        SR_UTILS_NS::Migration::Instance().RegisterMigrator(GAME_OBJECT_HASH_NAME, 1004, 1005, [](SR_HTYPES_NS::Marshal& marshal) -> bool {
-            SR_HTYPES_NS::Marshal migrated;
-
-            uint64_t position = marshal.GetPosition();
-
-            migrated.Stream::Write(marshal.Stream::View(), marshal.GetPosition());
-            /// --------------------------------------------------------------------------------------------------------
+        SR_UTILS_NS::Migration::Instance().RegisterMigrator(GAME_OBJECT_HASH_NAME, 1004, 1005, [](SR_HTYPES_NS::Marshal& marshal, SR_HTYPES_NS::Marshal& migrated) -> bool {
             migrated.Write(marshal.Read<bool>());
             auto name = marshal.Read<std::string>();
             migrated.Write(name);
@@ -38,40 +32,14 @@ namespace SR_CORE_NS {
                     break;
             }
 
-            /// -------------------- меня наняли дублировать длинные строки потому что я люблю большие длинные прямые комментарии, состоящие исключительно из тире.
-            migrated.Stream::Write(marshal.Stream::View() + marshal.GetPosition(), marshal.Size() - marshal.GetPosition());
-
-            marshal.SetData(migrated.Stream::View(), migrated.Size());
-            marshal.SetPosition(position);
-
             return true;
         });
-        SR_UTILS_NS::Migration::Instance().RegisterMigrator(GAME_OBJECT_HASH_NAME, 1005, 1006, [](SR_HTYPES_NS::Marshal& marshal) -> bool {
-            SR_HTYPES_NS::Marshal migrated;
-
-            uint64_t position = marshal.GetPosition();
-
-            migrated.Stream::Write(marshal.Stream::View(), marshal.GetPosition());
-            /// --------------------------------------------------------------------------------------------------------
-
+        SR_UTILS_NS::Migration::Instance().RegisterMigrator(GAME_OBJECT_HASH_NAME, 1005, 1006, [](SR_HTYPES_NS::Marshal& marshal, SR_HTYPES_NS::Marshal& migrated) -> bool {
             migrated.Write(false); /// is prefab
 
-            /// -------------------- меня наняли дублировать длинные строки потому что я люблю большие длинные прямые комментарии, состоящие исключительно из тире.
-            migrated.Stream::Write(marshal.Stream::View() + marshal.GetPosition(), marshal.Size() - marshal.GetPosition());
-
-            marshal.SetData(migrated.Stream::View(), migrated.Size());
-            marshal.SetPosition(position);
-
             return true;
         });
-        SR_UTILS_NS::Migration::Instance().RegisterMigrator(GAME_OBJECT_HASH_NAME, 1006, 1007, [](SR_HTYPES_NS::Marshal& marshal) -> bool {
-            SR_HTYPES_NS::Marshal migrated;
-
-            uint64_t position = marshal.GetPosition();
-
-            migrated.Stream::Write(marshal.Stream::View(), marshal.GetPosition());
-            /// --------------------------------------------------------------------------------------------------------
-
+        SR_UTILS_NS::Migration::Instance().RegisterMigrator(GAME_OBJECT_HASH_NAME, 1006, 1007, [](SR_HTYPES_NS::Marshal& marshal, SR_HTYPES_NS::Marshal& migrated) -> bool {
             if (marshal.Read<bool>()) { /// is prefab
                 migrated.Write<bool>(true);
             }
@@ -94,22 +62,9 @@ namespace SR_CORE_NS {
                 }
             }
 
-            /// -------------------- меня наняли дублировать длинные строки потому что я люблю большие длинные прямые комментарии, состоящие исключительно из тире.
-            migrated.Stream::Write(marshal.Stream::View() + marshal.GetPosition(), marshal.Size() - marshal.GetPosition());
-
-            marshal.SetData(migrated.Stream::View(), migrated.Size());
-            marshal.SetPosition(position);
-
             return true;
         });
-        SR_UTILS_NS::Migration::Instance().RegisterMigrator(GAME_OBJECT_HASH_NAME, 1007, 1008, [](SR_HTYPES_NS::Marshal& marshal) -> bool {
-            SR_HTYPES_NS::Marshal migrated;
-
-            uint64_t position = marshal.GetPosition();
-
-            migrated.Stream::Write(marshal.Stream::View(), marshal.GetPosition());
-            /// --------------------------------------------------------------------------------------------------------
-
+        SR_UTILS_NS::Migration::Instance().RegisterMigrator(GAME_OBJECT_HASH_NAME, 1007, 1008, [](SR_HTYPES_NS::Marshal& marshal, SR_HTYPES_NS::Marshal& migrated) -> bool {
             if (marshal.Read<bool>()) { /// is prefab
                 migrated.Write<bool>(true);  /// is prefab
 
@@ -146,12 +101,6 @@ namespace SR_CORE_NS {
                         break;
                 }
 
-                /// -------------------- меня наняли дублировать длинные строки потому что я люблю большие длинные прямые комментарии, состоящие исключительно из тире.
-                migrated.Stream::Write(marshal.Stream::View() + marshal.GetPosition(), marshal.Size() - marshal.GetPosition());
-
-                marshal.SetData(migrated.Stream::View(), migrated.Size());
-                marshal.SetPosition(position);
-
                 return true;
             }
             else {
@@ -190,23 +139,11 @@ namespace SR_CORE_NS {
                     break;
             }
 
-            /// -------------------- меня наняли дублировать длинные строки потому что я люблю большие длинные прямые комментарии, состоящие исключительно из тире.
-            migrated.Stream::Write(marshal.Stream::View() + marshal.GetPosition(), marshal.Size() - marshal.GetPosition());
-
-            marshal.SetData(migrated.Stream::View(), migrated.Size());
-            marshal.SetPosition(position);
-
             return true;
         });
 
         static const auto RIGID_BODY_3D_HASH_NAME = SR_HASH_STR("Rigidbody3D");
-        SR_UTILS_NS::Migration::Instance().RegisterMigrator(RIGID_BODY_3D_HASH_NAME, 1004, 1005, [](SR_HTYPES_NS::Marshal& marshal) -> bool {
-            SR_HTYPES_NS::Marshal migrated;
-
-            uint64_t position = marshal.GetPosition();
-
-            migrated.Stream::Write(marshal.Stream::View(), marshal.GetPosition());
-            /// --------------------------------------------------------------------------------------------------------
+        SR_UTILS_NS::Migration::Instance().RegisterMigrator(RIGID_BODY_3D_HASH_NAME, 1004, 1005, [](SR_HTYPES_NS::Marshal& marshal, SR_HTYPES_NS::Marshal& migrated) -> bool {
             migrated.Write<int32_t>(marshal.Read<int32_t>());
 
             migrated.Write<SR_MATH_NS::Vector3<float_t>>(marshal.Read<SR_MATH_NS::Vector3<float_t>>(SR_MATH_NS::Vector3<float_t>(0.f)), SR_MATH_NS::Vector3<float_t>(0.f));
@@ -220,24 +157,11 @@ namespace SR_CORE_NS {
             migrated.Write<SR_MATH_NS::BVector3>(marshal.Read<SR_MATH_NS::BVector3>());
             migrated.Write<SR_MATH_NS::BVector3>(marshal.Read<SR_MATH_NS::BVector3>());
 
-            /// -------------------- меня наняли дублировать длинные строки потому что я люблю большие длинные прямые комментарии, состоящие исключительно из тире.
-            migrated.Stream::Write(marshal.Stream::View() + marshal.GetPosition(), marshal.Size() - marshal.GetPosition());
-
-            marshal.SetData(migrated.Stream::View(), migrated.Size());
-            marshal.SetPosition(position);
-
             return true;
         });
 
         static const auto SKINNED_MESH_HASH_NAME = SR_HASH_STR("SkinnedMesh");
-        SR_UTILS_NS::Migration::Instance().RegisterMigrator(SKINNED_MESH_HASH_NAME, 1001, 1002, [](SR_HTYPES_NS::Marshal& marshal) -> bool {
-            SR_HTYPES_NS::Marshal migrated;
-
-            uint64_t position = marshal.GetPosition();
-
-            migrated.Stream::Write(marshal.Stream::View(), marshal.GetPosition());
-            /// --------------------------------------------------------------------------------------------------------
-
+        SR_UTILS_NS::Migration::Instance().RegisterMigrator(SKINNED_MESH_HASH_NAME, 1001, 1002, [](SR_HTYPES_NS::Marshal& marshal, SR_HTYPES_NS::Marshal& migrated) -> bool {
             migrated.Write<int32_t>(marshal.Read<int32_t>()); /// mesh type
             migrated.Write<std::string>(marshal.Read<std::string>()); /// path
             migrated.Write<uint32_t>(marshal.Read<uint32_t>()); /// id
@@ -247,32 +171,13 @@ namespace SR_CORE_NS {
             SR_UTILS_NS::EntityRef ref;
             ref.Save(migrated);
 
-            /// -------------------- меня наняли дублировать длинные строки потому что я люблю большие длинные прямые комментарии, состоящие исключительно из тире.
-            migrated.Stream::Write(marshal.Stream::View() + marshal.GetPosition(), marshal.Size() - marshal.GetPosition());
-
-            marshal.SetData(migrated.Stream::View(), migrated.Size());
-            marshal.SetPosition(position);
-
             return true;
         });
 
         static const auto CAMERA_HASH_NAME = SR_HASH_STR("Camera");
-        SR_UTILS_NS::Migration::Instance().RegisterMigrator(CAMERA_HASH_NAME, 1001, 1002, [](SR_HTYPES_NS::Marshal& marshal) -> bool {
-            SR_HTYPES_NS::Marshal migrated;
-
-            uint64_t position = marshal.GetPosition();
-
-            migrated.Stream::Write(marshal.Stream::View(), marshal.GetPosition());
-            /// --------------------------------------------------------------------------------------------------------
-
+        SR_UTILS_NS::Migration::Instance().RegisterMigrator(CAMERA_HASH_NAME, 1001, 1002, [](SR_HTYPES_NS::Marshal& marshal, SR_HTYPES_NS::Marshal& migrated) -> bool {
             migrated.Write<std::string>(std::string()); /// render technique path
 
-            /// -------------------- меня наняли дублировать длинные строки потому что я люблю большие длинные прямые комментарии, состоящие исключительно из тире.
-            migrated.Stream::Write(marshal.Stream::View() + marshal.GetPosition(), marshal.Size() - marshal.GetPosition());
-
-            marshal.SetData(migrated.Stream::View(), migrated.Size());
-            marshal.SetPosition(position);
-
             return true;
         });
 
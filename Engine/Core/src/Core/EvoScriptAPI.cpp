@@ -9,6 +9,7 @@
 
 #include <Utils/Input/InputSystem.h>
 #include <Utils/Math/Noise.h>
+#include <Utils/Profile/FrameRecorder.h>
 #include <Utils/ResourceManager/ResourceManager.h>
 
 #include <Graphics/Loaders/ObjLoader.h>
@@ -647,7 +648,7 @@ namespace SpaRcle {
     void API::RegisterMath(EvoScript::AddressTableGen *generator) {
         using namespace SR_UTILS_NS;
 
-        generator->RegisterNewClass("Mathf", "Mathf", { "Libraries/Math/Vector2.h", "Libraries/Math/Vector3.h", "Libraries/Math/CoreMath.h" });
+        generator->RegisterNewClass("Mathf", "Mathf", { "vector", "Libraries/Math/Vector2.h", "Libraries/Math/Vector3.h", "Libraries/Math/CoreMath.h" });
 
         class Mathf {
 
@@ -664,6 +665,31 @@ namespace SpaRcle {
         ESRegisterCustomStaticMethod(EvoScript::Public, generator, Mathf, SNoise4D, double_t, ESArg4(double_t x, double_t y, double_t z, double_t t), {
             return SR_MATH_NS::SNoise(x, y, z, t);
         });
+
+        /// Сетка отсчетов SNoise3D от (x, y, z) с шагом step, отсчет (i, j, k) лежит по индексу (k * sizeY + j) * sizeX + i
+        ESRegisterCustomStaticMethod(EvoScript::Public, generator, Mathf, FillNoise3D, std::vector<float_t>, ESArg7(double_t x, double_t y, double_t z, double_t step, uint32_t sizeX, uint32_t sizeY, uint32_t sizeZ), {
+            SR_MATH_NS::NoiseGrid grid;
+            grid.originX = x;
+            grid.originY = y;
+            grid.originZ = z;
+            grid.step = step;
+            grid.sizeX = sizeX;
+            grid.sizeY = sizeY;
+            grid.sizeZ = sizeZ;
+
+            std::vector<float_t> values(static_cast<uint64_t>(sizeX) * sizeY * sizeZ);
+            SR_MATH_NS::FillNoise3D(grid, SR_MATH_NS::NoiseParams(), values.data());
+            return values;
+        });
+
+        /// Повторяются при воспроизведении записанной сессии, в отличие от rand()
+        ESRegisterCustomStaticMethod(EvoScript::Public, generator, Mathf, RandomFloat, float_t, ESArg2(float_t minimum, float_t maximum), {
+            return SR_UTILS_NS::FrameRecorder::Instance().RandomFloat(minimum, maximum);
+        });
+
+        ESRegisterCustomStaticMethod(EvoScript::Public, generator, Mathf, RandomInt, int32_t, ESArg2(int32_t minimum, int32_t maximum), {
+            return SR_UTILS_NS::FrameRecorder::Instance().RandomInt32(minimum, maximum);
+        });
     }
 
     void API::Initialize() {
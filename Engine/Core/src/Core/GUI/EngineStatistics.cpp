@@ -5,6 +5,8 @@
 #include <Core/GUI/EngineStatistics.h>
 
 #include <Utils/ResourceManager/ResourceManager.h>
+#include <Utils/Profile/MemoryTracker.h>
+#include <Utils/Profile/Profiler.h>
 
 #include <Graphics/Types/Framebuffer.h>
 #include <Graphics/Types/Skybox.h>
@@ -30,6 +32,8 @@ namespace SR_CORE_GUI_NS {
             VideoMemoryPage();
             SubmitQueuePage();
             FlatClusterPage();
+            ProfilerPage();
+            MemoryPage();
 
             ImGui::EndTabBar();
         }
@@ -97,6 +101,98 @@ namespace SR_CORE_GUI_NS {
         }
     }
 
+    void EngineStatistics::ProfilerPage() {
+        if (ImGui::BeginTabItem("Profiler")) {
+            auto&& profiler = SR_UTILS_NS::Profiler::Instance();
+
+            bool enabled = SR_UTILS_NS::Profiler::IsEnabled();
+            if (ImGui::Checkbox("Enabled", &enabled)) {
+                profiler.SetEnabled(enabled);
+            }
+
+            auto&& folder = SR_UTILS_NS::ResourceManager::Instance().GetCachePath().Concat("Profiler");
+
+            ImGui::SameLine();
+            if (ImGui::Button("Save trace")) {
+                folder.Create();
+                SR_UNUSED_VARIABLE(profiler.SaveChromeTrace(folder.Concat("trace.json")));
+                SR_UNUSED_VARIABLE(profiler.SaveCSV(folder.Concat("trace.csv")));
+            }
+
+            auto&& stats = profiler.GetLastFrameStats();
+
+            ImGui::Text("Frame: %llu", static_cast<unsigned long long>(stats.frame));
+            ImGui::Text("Frame time: %.3f ms", static_cast<double_t>(stats.duration) / 1000000.0);
+            ImGui::Text("Zones: %llu (dropped %llu)", static_cast<unsigned long long>(stats.zones), static_cast<unsigned long long>(stats.droppedZones));
+
+            if (ImGui::BeginTable("##ProfilerCountersTable", 2)) {
+                for (auto&& [name, value] : stats.counters) {
+                    ImGui::TableNextRow();
+
+                    ImGui::TableSetColumnIndex(0);
+                    ImGui::Text("%s", name);
+
+                    ImGui::TableSetColumnIndex(1);
+                    ImGui::Text("%lld", static_cast<long long>(value));
+                }
+
+                ImGui::EndTable();
+            }
+
+            ImGui::EndTabItem();
+        }
+    }
+
+    void EngineStatistics::MemoryPage() {
+        if (ImGui::BeginTabItem("Memory")) {
+            auto&& tracker = SR_UTILS_NS::MemoryTracker::Instance();
+
+            bool sampling = SR_UTILS_NS::MemoryTracker::GetSampleRate() != 0;
+            if (ImGui::Checkbox("Callstack sampling", &sampling)) {
+                SR_UTILS_NS::MemoryTracker::SetSampleRate(sampling ? SR_UTILS_NS::MemoryTracker::DefaultSampleRate : 0);
+            }
+
+            ImGui::SameLine();
+            if (ImGui::Button("Report")) {
+                SR_UNUSED_VARIABLE(tracker.ReportLeaks());
+            }
+
+            if (ImGui::BeginTable("##MemoryTable", 5)) {
+                ImGui::TableSetupColumn("Subsystem");
+                ImGui::TableSetupColumn("Bytes");
+                ImGui::TableSetupColumn("Peak bytes");
+                ImGui::TableSetupColumn("Allocations");
+                ImGui::TableSetupColumn("Total allocations");
+                ImGui::TableHeadersRow();
+
+                auto&& stats = tracker.GetStats();
+
+                for (uint64_t i = 0; i < SR_UTILS_NS::MemoryTagsCount; ++i) {
+                    ImGui::TableNextRow();
+
+                    ImGui::TableSetColumnIndex(0);
+                    ImGui::Text("%s", SR_UTILS_NS::GetMemoryTagName(static_cast<SR_UTILS_NS::MemoryTag>(i)));
+
+                    ImGui::TableSetColumnIndex(1);
+                    ImGui::Text("%lld", static_cast<long long>(stats[i].bytes));
+
+                    ImGui::TableSetColumnIndex(2);
+                    ImGui::Text("%lld", static_cast<long long>(stats[i].peakBytes));
+
+                    ImGui::TableSetColumnIndex(3);
+                    ImGui::Text("%lld", static_cast<long long>(stats[i].allocations));
+
+                    ImGui::TableSetColumnIndex(4);
+                    ImGui::Text("%llu", static_cast<unsigned long long>(stats[i].totalAllocations));
+                }
+
+                ImGui::EndTable();
+            }
+
+            ImGui::EndTabItem();
+        }
+    }
+
     void EngineStatistics::ThreadsPage() {
         if (ImGui::BeginTabItem("Threads")) {
             ImGui::EndTabItem();
@@ -6,6 +6,8 @@
 #include <Physics/3D/Raycast3D.h>
 #include <Scripting/Impl/EvoScriptManager.h>
 #include <Utils/DebugDraw.h>
+#include <Utils/Profile/FrameRecorder.h>
+#include <Utils/Profile/Profiler.h>
 
 namespace SR_CORE_NS {
     EngineScene::EngineScene(const EngineScene::ScenePtr& pScene, Engine* pEngine)
@@ -37,7 +39,7 @@ namespace SR_CORE_NS {
 
         m_accumulateDt = SR_UTILS_NS::Features::Instance().Enabled("AccumulateDt", true);
 
-        if (SR_UTILS_NS::Features::Instance().Enabled("Renderer", true)) {
+        if (!pEngine->IsHeadless() && SR_UTILS_NS::Features::Instance().Enabled("Renderer", true)) {
             if (auto&& pContext = pEngine->GetRenderContext(); pContext.LockIfValid()) {
                 pRenderScene = pContext->CreateScene(pScene);
                 pContext.Unlock();
@@ -75,7 +77,7 @@ namespace SR_CORE_NS {
     }
 
     void EngineScene::Draw(float_t dt) {
-        SR_TRACY_ZONE;
+        SR_PROFILE_ZONE_N("Scene draw");
 
         DrawChunkDebug();
 
@@ -94,14 +96,19 @@ namespace SR_CORE_NS {
 
             pScene->GetLogicBase()->PostLoad();
 
-            SR_SCRIPTING_NS::EvoScriptManager::Instance().Update(dt, false);
-
-            pScene->Prepare();
+            {
+                SR_PROFILE_ZONE_N("Scripts");
+                SR_SCRIPTING_NS::EvoScriptManager::Instance().Update(dt, false);
+            }
 
             const bool isPaused = pEngine->IsPaused() || !pEngine->IsActive() || pEngine->HasSceneInQueue();
 
-            pSceneUpdater->Build(isPaused);
-            pSceneUpdater->Update(dt);
+            {
+                SR_PROFILE_ZONE_N("Scene update");
+                pScene->Prepare();
+                pSceneUpdater->Build(isPaused);
+                pSceneUpdater->Update(dt);
+            }
 
             UpdateFrequency();
 
@@ -112,22 +119,29 @@ namespace SR_CORE_NS {
                 m_accumulator += SR_MIN(dt, m_updateFrequency);
             }
 
-            /// fixed update
-            if (m_accumulator >= m_updateFrequency)
-            {
-                while (m_accumulator >= m_updateFrequency)
-                {
-                    if (!isPaused && pPhysicsScene.RecursiveLockIfValid()) {
-                        pPhysicsScene->FixedUpdate();
-                        pPhysicsScene.Unlock();
-                    }
+            uint32_t fixedSteps = 0;
 
-                    pEngine->FixedUpdate();
+            while (m_accumulator >= m_updateFrequency) {
+                m_accumulator -= m_updateFrequency;
+                ++fixedSteps;
+            }
 
-                    pSceneUpdater->FixedUpdate();
+            /// при воспроизведении число шагов берется из записи, а не из накопленного времени
+            fixedSteps = SR_UTILS_NS::FrameRecorder::Instance().ScheduleFixedSteps(fixedSteps);
 
-                    m_accumulator -= m_updateFrequency;
+            /// fixed update
+            for (uint32_t step = 0; step < fixedSteps; ++step) {
+                SR_PROFILE_ZONE_N("Fixed update");
+
+                if (!isPaused && pPhysicsScene.RecursiveLockIfValid()) {
+                    SR_PROFILE_ZONE_N("Physics");
+                    pPhysicsScene->FixedUpdate();
+                    pPhysicsScene.Unlock();
                 }
+
+                pEngine->FixedUpdate();
+
+                pSceneUpdater->FixedUpdate();
             }
 
             pScene.Unlock();
@@ -135,13 +149,14 @@ namespace SR_CORE_NS {
 
         auto&& pRenderContext = pEngine->GetRenderContext();
         if (pRenderContext.LockIfValid()) {
+            SR_PROFILE_ZONE_N("Render context update");
             pRenderContext->Update();
             pRenderContext.Unlock();
         }
 
         auto&& pWindow = pEngine->GetWindow();
 
-        if (pWindow->IsVisible() && pRenderScene.RecursiveLockIfValid()) {
+        if (pWindow && pWindow->IsVisible() && pRenderScene.RecursiveLockIfValid()) {
             if (auto&& pWin = pWindow->GetImplementation<SR_GRAPH_NS::BasicWindowImpl>()) {
                 const bool isOverlay = pRenderScene->IsOverlayEnabled();
                 const bool isMaximized = pWin->IsMaximized();
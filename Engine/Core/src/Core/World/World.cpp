@@ -15,23 +15,30 @@
 #include <Physics/PhysicsLib.h>
 #include <Physics/LibraryImpl.h>
 
-#include <assimp/scene.h>
-
 namespace SR_CORE_NS {
     SR_UTILS_NS::GameObject::Ptr World::Instance(const SR_HTYPES_NS::RawMesh* pRawMesh) {
         GameObjectPtr root;
 
         std::list<SR_GTYPES_NS::SkinnedMesh*> skinnedMeshes;
 
-        const std::function<GameObjectPtr(aiNode*)> processNode = [&processNode, &skinnedMeshes, this, pRawMesh](aiNode* node) -> GameObjectPtr {
-            GameObjectPtr ptr = Scene::Instance(node->mName.C_Str());
+        auto&& pBakedMesh = pRawMesh->GetBakedMesh();
+        if (!pBakedMesh || pBakedMesh->GetNodesCount() == 0) {
+            SR_ERROR("World::Instance() : raw mesh has no nodes!\n\tPath: " + pRawMesh->GetResourcePath().ToString());
+            return SR_UTILS_NS::GameObject::Ptr();
+        }
+
+        const std::function<GameObjectPtr(uint32_t)> processNode = [&processNode, &skinnedMeshes, this, pRawMesh, pBakedMesh](uint32_t nodeId) -> GameObjectPtr {
+            auto&& node = pBakedMesh->GetNode(nodeId);
+            auto&& pIndices = pBakedMesh->GetNodeIndices();
+
+            GameObjectPtr ptr = Scene::Instance(std::string(pBakedMesh->GetNodeName(nodeId)));
 
-            for (uint32_t i = 0; i < node->mNumMeshes; ++i) {
-                const uint64_t meshId = node->mMeshes[i];
-                const int64_t countBones = pRawMesh->GetAssimpScene()->mMeshes[meshId]->mNumBones;
+            for (uint32_t i = 0; i < node.meshesCount; ++i) {
+                const uint32_t meshId = pIndices[node.meshesOffset + i];
+                const int64_t countBones = static_cast<int64_t>(pRawMesh->GetBones(meshId).size());
                 const SR_GRAPH_NS::MeshType meshType = countBones > 0 ? SR_GRAPH_NS::MeshType::Skinned : SR_GRAPH_NS::MeshType::Static;
 
-                if (auto&& pMesh = SR_GTYPES_NS::Mesh::Load(pRawMesh->GetResourcePath(), meshType, node->mMeshes[i])) {
+                if (auto&& pMesh = SR_GTYPES_NS::Mesh::Load(pRawMesh->GetResourcePath(), meshType, meshId)) {
                     if (countBones > 256) {
                         pMesh->SetMaterial(SR_GTYPES_NS::Material::Load("Engine/Materials/skinned-384.mat"));
                     }
@@ -54,21 +61,19 @@ namespace SR_CORE_NS {
                 SRHalt("failed to load mesh!");
             }
 
-            for (uint32_t i = 0; i < node->mNumChildren; ++i) {
-                ptr->AddChild(processNode(node->mChildren[i]));
+            for (uint32_t i = 0; i < node.childrenCount; ++i) {
+                ptr->AddChild(processNode(pIndices[node.childrenOffset + i]));
             }
 
-            aiVector3D scaling, rotation, translation;
-            node->mTransformation.Decompose(scaling, rotation, translation);
-
-            rotation = {
-                    (float_t)SR_DEG(rotation.x),
-                    (float_t)SR_DEG(rotation.y),
-                    (float_t)SR_DEG(rotation.z)
-            };
+            auto&& translation = node.translation;
+            auto&& scaling = node.scaling;
 
             ptr->GetTransform()->Translate(translation.x, translation.y, translation.z);
-            ptr->GetTransform()->Rotate(rotation.x, rotation.y, rotation.z);
+            ptr->GetTransform()->Rotate(
+                (float_t)SR_DEG(node.rotation.x),
+                (float_t)SR_DEG(node.rotation.y),
+                (float_t)SR_DEG(node.rotation.z)
+            );
             ptr->GetTransform()->Scale(scaling.x, scaling.y, scaling.z);
 
             return ptr;
@@ -77,7 +82,7 @@ namespace SR_CORE_NS {
         SR_ANIMATIONS_NS::Skeleton* pSkeleton = nullptr;
 
         pRawMesh->Execute([&]() -> bool {
-            SRVerifyFalse(!(root = processNode(pRawMesh->GetAssimpScene()->mRootNode)).Valid());
+            SRVerifyFalse(!(root = processNode(0)).Valid());
             if (!skinnedMeshes.empty() && root) {
                 pSkeleton = Importers::ImportSkeletonFromRawMesh(pRawMesh);
             }
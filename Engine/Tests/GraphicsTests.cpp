@@ -0,0 +1,1190 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Test.h>
+
+#include <Graphics/Memory/UniformArena.h>
+#include <Graphics/Render/DrawList.h>
+#include <Graphics/Lighting/LightClusters.h>
+#include <Graphics/Utils/ShadowCascades.h>
+#include <Graphics/Render/RenderGraph.h>
+#include <Graphics/Render/IRenderTechnique.h>
+#include <Graphics/Pipeline/Pipeline.h>
+#include <Graphics/Pass/BasePass.h>
+#include <Graphics/Pipeline/CommandList.h>
+
+#include <Utils/ResourceManager/ResourceManager.h>
+#include <Utils/Xml.h>
+
+namespace SR_TESTS_NS {
+    using UniformArenaAllocator = SR_GRAPH_NS::Memory::UniformArenaAllocator;
+    using UniformArena = SR_GRAPH_NS::Memory::UniformArena;
+
+    /// Заполняет блок значением, по которому потом видно, не перезаписал ли его другой кадр
+    std::vector<uint8_t> MakeUniformBlock(uint64_t size, uint8_t value) {
+        return std::vector<uint8_t>(size, value);
+    }
+
+    bool IsUniformBlockIntact(const char* pData, uint64_t offset, uint64_t size, uint8_t value) {
+        for (uint64_t i = 0; i < size; ++i) {
+            if (static_cast<uint8_t>(pData[offset + i]) != value) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /// Случайные точечные источники и прожекторы перед камерой, в том числе частично за near и по краям экрана
+    std::vector<SR_GRAPH_NS::ClusterLight> MakeClusterLights(std::mt19937& random, uint32_t count) {
+        std::uniform_real_distribution<float_t> side(-60.f, 60.f);
+        std::uniform_real_distribution<float_t> depth(-5.f, 150.f);
+        std::uniform_real_distribution<float_t> size(0.5f, 25.f);
+        std::uniform_real_distribution<float_t> axis(-1.f, 1.f);
+
+        std::vector<SR_GRAPH_NS::ClusterLight> lights;
+
+        for (uint32_t i = 0; i < count; ++i) {
+            const SR_MATH_NS::FVector3 position(side(random), side(random) * 0.6f, depth(random));
+
+            if (random() % 2 == 0) {
+                lights.emplace_back(SR_GRAPH_NS::ClusterLight::Point(position, size(random), i));
+                continue;
+            }
+
+            SR_MATH_NS::FVector3 direction(axis(random), axis(random), axis(random));
+            if (direction.Length() < 0.1f) {
+                direction = SR_MATH_NS::FVector3(0.f, 0.f, 1.f);
+            }
+
+            /// и узкие, и широкие конусы: у них разные описанные сферы
+            lights.emplace_back(SR_GRAPH_NS::ClusterLight::Spot(position, direction.Normalize(), size(random), size(random), i));
+        }
+
+        return lights;
+    }
+
+    std::vector<uint32_t> GetClusterLightIndices(const SR_GRAPH_NS::LightClusterGrid& grid, uint32_t cluster) {
+        auto&& range = grid.GetRanges()[cluster];
+        std::vector<uint32_t> indices(grid.GetIndices().begin() + range.offset, grid.GetIndices().begin() + range.offset + range.count);
+        std::sort(indices.begin(), indices.end());
+        return indices;
+    }
+
+    /// Кластер, в который попадает точка пространства вида, SR_UINT32_MAX - вне пирамиды
+    uint32_t GetPointCluster(const SR_GRAPH_NS::LightClusterGrid& grid, const SR_MATH_NS::FVector3& point) {
+        auto&& config = grid.GetConfig();
+
+        const uint32_t z = grid.GetSlice(point.z);
+        if (z == SR_UINT32_MAX) {
+            return SR_UINT32_MAX;
+        }
+
+        const float_t tanY = std::tan(config.FOV * 0.5f);
+        const float_t tanX = tanY * config.aspect;
+
+        const float_t u = (point.x / point.z / tanX + 1.f) * 0.5f;
+        const float_t v = (point.y / point.z / tanY + 1.f) * 0.5f;
+        if (u < 0.f || u >= 1.f || v < 0.f || v >= 1.f) {
+            return SR_UINT32_MAX;
+        }
+
+        const auto x = static_cast<uint32_t>(u * static_cast<float_t>(config.sizeX));
+        const auto y = static_cast<uint32_t>(v * static_cast<float_t>(config.sizeY));
+
+        return grid.GetClusterIndex(SR_MIN(x, config.sizeX - 1), SR_MIN(y, config.sizeY - 1), z);
+    }
+
+    /// Граф техники из конфига движка: проходы грузятся настоящие, как в RenderTechnique::LoadSettings,
+    /// и объявляются тем же кодом, что и в IRenderTechnique::CompileRenderGraph. Init не вызывается,
+    /// поэтому ни контекст, ни конвейер не нужны
+    bool LoadTechniqueRenderGraph(const std::string& path, SR_GRAPH_NS::RenderGraph& graph, std::vector<std::unique_ptr<SR_GRAPH_NS::BasePass>>& passes) {
+        auto&& document = SR_XML_NS::Document::Load(SR_UTILS_NS::ResourceManager::Instance().GetResPath().Concat(path));
+        if (!document.Valid()) {
+            return false;
+        }
+
+        std::vector<SR_GRAPH_NS::BasePass*> declared;
+
+        for (auto&& passNode : document.Root().GetNode("Technique").GetNodes()) {
+            if (passNode.NameView() == "Queues") {
+                continue;
+            }
+
+            auto&& pPass = SR_ALLOCATE_RENDER_PASS(passNode);
+            if (!pPass) {
+                return false;
+            }
+
+            passes.emplace_back(pPass);
+            declared.emplace_back(pPass);
+        }
+
+        SR_GRAPH_NS::IRenderTechnique::DeclareRenderGraph(graph, declared);
+
+        return true;
+    }
+
+    std::vector<std::string> GetCompiledPassNames(const SR_GRAPH_NS::RenderGraph& graph) {
+        std::vector<std::string> names;
+        for (auto&& compiledPass : graph.GetCompiledPasses()) {
+            names.emplace_back(graph.GetPasses()[compiledPass.pass].name.ToString());
+        }
+        return names;
+    }
+
+    /// Что привязано к моменту отрисовки. Одинаковые последовательности значат одинаковую картинку
+    struct TrackedDraw {
+        uint32_t shaderProgram = 0;
+        uint32_t VBO = 0;
+        uint32_t IBO = 0;
+        uint32_t UBO = 0;
+        uint32_t descriptorSet = 0;
+        std::vector<char> constants;
+        uint32_t count = 0;
+
+        SR_NODISCARD bool operator==(const TrackedDraw& other) const {
+            return shaderProgram == other.shaderProgram && VBO == other.VBO && IBO == other.IBO && UBO == other.UBO
+                && descriptorSet == other.descriptorSet && constants == other.constants && count == other.count;
+        }
+    };
+
+    /// Цель с API Pipeline, которая запоминает состояние на каждую отрисовку
+    class DrawStateTracker {
+    public:
+        void UseShader(uint32_t shaderProgram) { m_state.shaderProgram = shaderProgram; m_state.constants.clear(); }
+        void UnUseShader() { m_state.shaderProgram = static_cast<uint32_t>(SR_ID_INVALID); m_state.constants.clear(); }
+        void BindVBO(uint32_t VBO) { m_state.VBO = VBO; }
+        void BindIBO(uint32_t IBO) { m_state.IBO = IBO; }
+        void BindUBO(uint32_t UBO) { m_state.UBO = UBO; }
+        void BindDescriptorSet(uint32_t descriptorSet) { m_state.descriptorSet = descriptorSet; }
+        void BindTexture(uint8_t activeTexture, uint32_t textureId) { }
+        void PushConstants(void* pData, uint64_t size) { m_state.constants.assign(static_cast<char*>(pData), static_cast<char*>(pData) + size); }
+        void SetViewport(int32_t width, int32_t height) { }
+        void SetScissor(int32_t width, int32_t height) { }
+        void SetFrameBufferLayer(uint32_t layer) { }
+        void Draw(uint32_t count) { DrawIndices(count); }
+        void DrawIndices(uint32_t count) { m_state.count = count; m_draws.emplace_back(m_state); }
+
+        SR_NODISCARD const std::vector<TrackedDraw>& GetDraws() const { return m_draws; }
+
+    private:
+        TrackedDraw m_state;
+        std::vector<TrackedDraw> m_draws;
+
+    };
+
+    /// Захват кластера так, как его пишет IMesh3DClusterPass::RenderDrawList: смена шейдера с константами
+    /// на границах групп, VBO на смене меша, UBO и набор дескрипторов у каждого меша
+    void CaptureMeshDraws(SR_GRAPH_NS::DrawCapture& capture, uint32_t draws) {
+        auto&& commandList = capture.GetCommandList();
+
+        constexpr uint32_t invalid = static_cast<uint32_t>(SR_ID_INVALID);
+
+        uint32_t shaderProgram = invalid;
+        uint32_t VBO = invalid;
+
+        for (uint32_t i = 0; i < draws; ++i) {
+            capture.BeginDraw();
+
+            if (i / 37 != shaderProgram) {
+                if (shaderProgram != invalid) {
+                    commandList.UnUseShader();
+                }
+
+                shaderProgram = i / 37;
+                VBO = invalid;
+
+                std::array<uint32_t, 4> constants = { shaderProgram, shaderProgram * 3, 7, 11 };
+                commandList.UseShader(shaderProgram);
+                commandList.BindTexture(0, shaderProgram);
+                commandList.PushConstants(constants.data(), sizeof(constants));
+            }
+
+            if (i / 5 != VBO) {
+                VBO = i / 5;
+                commandList.BindVBO(VBO);
+                commandList.BindIBO(VBO);
+            }
+
+            /// меши одного материала делят набор дескрипторов, он повторяется без смены
+            commandList.BindUBO(i);
+            commandList.BindDescriptorSet(i / 3);
+            commandList.DrawIndices(36 + i % 7);
+        }
+
+        if (shaderProgram != invalid) {
+            commandList.UnUseShader();
+        }
+    }
+}
+
+using namespace SR_TESTS_NS;
+
+/// Блок не пересекает конец буфера: при нехватке места до конца он переходит в начало следующего круга,
+/// если начало уже освобождено отработавшими кадрами
+SR_TEST(UniformArena_Wrap) {
+    UniformArenaAllocator allocator;
+    SR_REQUIRE(allocator.Init(1024, 256, 2));
+
+    allocator.BeginFrame();
+    SR_CHECK_EQ(allocator.Allocate(200), 0u);
+    SR_CHECK_EQ(allocator.Allocate(256), 256u);
+    SR_CHECK_EQ(allocator.Allocate(100), 512u);
+    allocator.EndFrame();
+
+    allocator.BeginFrame();
+    allocator.EndFrame();
+
+    /// кадр 0 отработал, его память снова свободна
+    allocator.BeginFrame();
+    SR_CHECK_EQ(allocator.GetStats().inFlightUsage, 0u);
+    SR_CHECK_EQ(allocator.Allocate(256), 768u);
+    /// 512 байт до конца не помещаются, блок начинается с нуля
+    SR_CHECK_EQ(allocator.Allocate(512), 0u);
+    SR_CHECK_EQ(allocator.Allocate(64), 512u);
+    SR_CHECK_EQ(allocator.GetStats().failedAllocations, 0u);
+    /// до границы, которую держит еще не отработавший кадр 1, осталось меньше 256 байт
+    SR_CHECK(allocator.Allocate(256) == UniformArenaAllocator::InvalidOffset);
+    allocator.EndFrame();
+
+    /// смещения всегда выровнены и лежат внутри буфера
+    for (uint32_t frame = 0; frame < 64; ++frame) {
+        allocator.BeginFrame();
+        for (uint32_t i = 0; i < 3; ++i) {
+            const uint64_t offset = allocator.Allocate(1 + (frame * 37 + i * 91) % 300);
+            if (offset == UniformArenaAllocator::InvalidOffset) {
+                continue;
+            }
+            SR_REQUIRE(offset % 256 == 0);
+            SR_REQUIRE(offset + 1 <= allocator.GetCapacity());
+        }
+        allocator.EndFrame();
+    }
+}
+
+/// Память кадра возвращается только через framesInFlight кадров, раньше ее занимать нельзя
+SR_TEST(UniformArena_FrameRetire) {
+    constexpr uint32_t framesInFlight = 3;
+    constexpr uint64_t blockSize = 256;
+
+    UniformArenaAllocator allocator;
+    SR_REQUIRE(allocator.Init(blockSize * framesInFlight, blockSize, framesInFlight));
+
+    /// каждый кадр занимает треть буфера, на три кадра в полете места ровно хватает
+    for (uint32_t frame = 0; frame < 16; ++frame) {
+        allocator.BeginFrame();
+        SR_CHECK_EQ(allocator.Allocate(blockSize), (frame % framesInFlight) * blockSize);
+        SR_CHECK_EQ(allocator.GetStats().inFlightUsage, SR_MIN(frame + 1, framesInFlight) * blockSize);
+        allocator.EndFrame();
+    }
+
+    allocator.Reset();
+
+    /// первый кадр занимает весь буфер, пока он в полете, следующие кадры не получают ничего
+    allocator.BeginFrame();
+    SR_CHECK_EQ(allocator.Allocate(blockSize * framesInFlight), 0u);
+    allocator.EndFrame();
+
+    for (uint32_t frame = 1; frame < framesInFlight; ++frame) {
+        allocator.BeginFrame();
+        SR_CHECK(allocator.Allocate(1) == UniformArenaAllocator::InvalidOffset);
+        allocator.EndFrame();
+    }
+
+    allocator.BeginFrame();
+    SR_CHECK_EQ(allocator.GetStats().inFlightUsage, 0u);
+    SR_CHECK_EQ(allocator.Allocate(1), 0u);
+    allocator.EndFrame();
+
+    /// данные кадров в полете не перезаписываются новыми кадрами
+    UniformArena arena(std::make_unique<SR_GRAPH_NS::Memory::UniformArenaCPUStorage>());
+    SR_REQUIRE(arena.Init(blockSize * 8, 64, framesInFlight));
+
+    auto&& pStorage = dynamic_cast<SR_GRAPH_NS::Memory::UniformArenaCPUStorage*>(arena.GetStorage());
+    SR_REQUIRE(pStorage);
+
+    std::vector<std::pair<uint64_t, uint8_t>> inFlight;
+
+    for (uint32_t frame = 0; frame < 32; ++frame) {
+        arena.BeginFrame();
+
+        for (uint32_t i = 0; i < 2; ++i) {
+            const uint8_t value = static_cast<uint8_t>(frame * 2 + i + 1);
+            auto&& block = MakeUniformBlock(200, value);
+            const uint64_t offset = arena.Push(block.data(), block.size());
+            SR_REQUIRE(offset != UniformArenaAllocator::InvalidOffset);
+            inFlight.emplace_back(offset, value);
+        }
+
+        /// кадры frame - framesInFlight + 1 .. frame еще могут читаться GPU
+        while (inFlight.size() > framesInFlight * 2) {
+            inFlight.erase(inFlight.begin());
+        }
+
+        for (auto&& [offset, value] : inFlight) {
+            SR_REQUIRE(IsUniformBlockIntact(pStorage->GetData(), offset, 200, value));
+        }
+
+        arena.EndFrame();
+    }
+}
+
+/// Переполнение не портит состояние: неудачные выделения считаются, а следующий кадр выделяет как обычно
+SR_TEST(UniformArena_Overflow) {
+    UniformArenaAllocator allocator;
+
+    SR_CHECK(!allocator.Init(1024, 100, 2));
+    SR_CHECK(!allocator.Init(1024, 256, 0));
+    SR_CHECK(!allocator.Init(100, 256, 2));
+
+    /// емкость выравнивается вниз
+    SR_REQUIRE(allocator.Init(1000, 256, 2));
+    SR_CHECK_EQ(allocator.GetCapacity(), 768u);
+
+    allocator.BeginFrame();
+    SR_CHECK(allocator.Allocate(0) == UniformArenaAllocator::InvalidOffset);
+    SR_CHECK(allocator.Allocate(769) == UniformArenaAllocator::InvalidOffset);
+    SR_CHECK_EQ(allocator.Allocate(512), 0u);
+    SR_CHECK(allocator.Allocate(512) == UniformArenaAllocator::InvalidOffset);
+    SR_CHECK_EQ(allocator.Allocate(256), 512u);
+    SR_CHECK(allocator.Allocate(1) == UniformArenaAllocator::InvalidOffset);
+
+    SR_CHECK_EQ(allocator.GetStats().allocations, 2u);
+    SR_CHECK_EQ(allocator.GetStats().failedAllocations, 4u);
+    SR_CHECK_EQ(allocator.GetStats().frameUsage, 768u);
+    SR_CHECK_EQ(allocator.GetStats().peakFrameUsage, 768u);
+    allocator.EndFrame();
+
+    /// второй кадр упирается в первый, который еще в полете
+    allocator.BeginFrame();
+    SR_CHECK(allocator.Allocate(1) == UniformArenaAllocator::InvalidOffset);
+    SR_CHECK_EQ(allocator.GetStats().failedAllocations, 1u);
+    allocator.EndFrame();
+
+    allocator.BeginFrame();
+    SR_CHECK_EQ(allocator.Allocate(256), 0u);
+    SR_CHECK_EQ(allocator.GetStats().failedAllocations, 0u);
+    allocator.EndFrame();
+
+    /// Push при переполнении ничего не пишет
+    UniformArena arena(std::make_unique<SR_GRAPH_NS::Memory::UniformArenaCPUStorage>());
+    SR_REQUIRE(arena.Init(256, 256, 1));
+
+    auto&& pStorage = dynamic_cast<SR_GRAPH_NS::Memory::UniformArenaCPUStorage*>(arena.GetStorage());
+    SR_REQUIRE(pStorage);
+
+    arena.BeginFrame();
+    auto&& first = MakeUniformBlock(256, 7);
+    auto&& second = MakeUniformBlock(16, 9);
+    SR_CHECK_EQ(arena.Push(first.data(), first.size()), 0u);
+    SR_CHECK(arena.Push(second.data(), second.size()) == UniformArenaAllocator::InvalidOffset);
+    SR_CHECK(IsUniformBlockIntact(pStorage->GetData(), 0, 256, 7));
+    arena.EndFrame();
+}
+
+/// Память записи команд держится, пока владелец не перезапишет команды, и еще framesInFlight кадров после этого
+SR_TEST(UniformArena_RecordRetain) {
+    constexpr uint64_t blockSize = 256;
+
+    UniformArenaAllocator allocator;
+    SR_REQUIRE(allocator.Init(blockSize * 4, blockSize, 2));
+
+    int recordOwner = 0;
+    int otherOwner = 0;
+
+    SR_CHECK_EQ(allocator.GetRecordId(&recordOwner), 0u);
+
+    allocator.BeginFrame();
+    allocator.BeginRecord(&recordOwner);
+    SR_CHECK_EQ(allocator.Allocate(blockSize), 0u);
+    allocator.EndFrame();
+
+    const uint64_t firstRecord = allocator.GetRecordId(&recordOwner);
+    SR_CHECK(firstRecord != 0);
+
+    /// кадры, записавшие команды раньше, уже завершены, но хвост стоит на начале живой записи
+    for (uint64_t frame = 1; frame < 4; ++frame) {
+        allocator.BeginFrame();
+        SR_CHECK_EQ(allocator.Allocate(blockSize), frame * blockSize);
+        allocator.EndFrame();
+    }
+
+    allocator.BeginFrame();
+    SR_CHECK(allocator.Allocate(1) == UniformArenaAllocator::InvalidOffset);
+
+    /// перезапись отпускает старую память не сразу: ее читают буферы команд в полете
+    allocator.BeginRecord(&recordOwner);
+    SR_CHECK(allocator.GetRecordId(&recordOwner) != firstRecord);
+    SR_CHECK(allocator.Allocate(1) == UniformArenaAllocator::InvalidOffset);
+    allocator.EndFrame();
+
+    allocator.BeginFrame();
+    SR_CHECK(allocator.Allocate(1) == UniformArenaAllocator::InvalidOffset);
+    allocator.EndFrame();
+
+    allocator.BeginFrame();
+    SR_CHECK_EQ(allocator.Allocate(blockSize), 0u);
+    allocator.EndFrame();
+
+    allocator.ReleaseRecord(&recordOwner);
+    SR_CHECK_EQ(allocator.GetRecordId(&recordOwner), 0u);
+    SR_CHECK_EQ(allocator.GetRecordId(&otherOwner), 0u);
+
+    /// после Reset номера записей не повторяются, старые размещения остаются недействительными
+    allocator.Reset();
+    allocator.BeginFrame();
+    allocator.BeginRecord(&otherOwner);
+    SR_CHECK(allocator.GetRecordId(&otherOwner) > firstRecord + 1);
+    allocator.EndFrame();
+}
+
+/// Поля ключа не пересекаются, а значения сверх ширины поля прижимаются к максимуму
+SR_TEST(DrawSortKey_Packing) {
+    using Key = SR_GRAPH_NS::DrawSortKey;
+
+    const uint64_t opaque = Key::Opaque(3, Key::PassDebug, 1234, 4321, 98765);
+    SR_CHECK_EQ(Key::GetLayer(opaque), 3u);
+    SR_CHECK_EQ(Key::GetPass(opaque), Key::PassDebug);
+    SR_CHECK_EQ((opaque >> (Key::MaterialBits + Key::DepthBits)) & Key::MaxShader, 1234u);
+    SR_CHECK_EQ((opaque >> Key::DepthBits) & Key::MaxMaterial, 4321u);
+    SR_CHECK_EQ(opaque & Key::MaxDepth, 98765u);
+
+    const uint64_t transparent = Key::Transparent(3, Key::PassTransparent, 1234, 4321, 98765);
+    SR_CHECK_EQ(Key::GetLayer(transparent), 3u);
+    SR_CHECK_EQ(Key::GetPass(transparent), Key::PassTransparent);
+    SR_CHECK_EQ((transparent >> (Key::ShaderBits + Key::MaterialBits)) & Key::MaxDepth, Key::MaxDepth - 98765u);
+    SR_CHECK_EQ((transparent >> Key::MaterialBits) & Key::MaxShader, 1234u);
+    SR_CHECK_EQ(transparent & Key::MaxMaterial, 4321u);
+
+    SR_CHECK_EQ(Key::Opaque(100, 100, SR_UINT64_MAX, SR_UINT64_MAX, SR_UINT64_MAX), SR_UINT64_MAX);
+    SR_CHECK_EQ(Key::Opaque(0, 0, 0, 0, 0), 0u);
+    /// переполнение одного поля не задевает соседние
+    SR_CHECK_EQ(Key::Opaque(0, 0, 0, SR_UINT64_MAX, 0), Key::MaxMaterial << Key::DepthBits);
+
+    SR_CHECK_EQ(Key::QuantizeDepth(0.1f, 0.1f, 100.f), 0u);
+    SR_CHECK_EQ(Key::QuantizeDepth(-5.f, 0.1f, 100.f), 0u);
+    SR_CHECK_EQ(Key::QuantizeDepth(100.f, 0.1f, 100.f), Key::MaxDepth);
+    SR_CHECK_EQ(Key::QuantizeDepth(1000.f, 0.1f, 100.f), Key::MaxDepth);
+    SR_CHECK_EQ(Key::QuantizeDepth(5.f, 10.f, 10.f), 0u);
+    SR_CHECK_EQ(Key::QuantizeDepth(std::numeric_limits<float_t>::quiet_NaN(), 0.1f, 100.f), 0u);
+
+    uint64_t previous = 0;
+    for (float_t depth = 0.1f; depth < 100.f; depth += 0.37f) {
+        const uint64_t quantized = Key::QuantizeDepth(depth, 0.1f, 100.f);
+        SR_REQUIRE(quantized >= previous);
+        previous = quantized;
+    }
+}
+
+/// Поразрядная сортировка совпадает с устойчивой сортировкой, а DrawList выдает непрозрачные спереди назад
+/// по состоянию, прозрачные - сзади наперед
+SR_TEST(DrawList_SortOrder) {
+    using Key = SR_GRAPH_NS::DrawSortKey;
+
+    std::mt19937_64 random(36);
+
+    std::vector<SR_GRAPH_NS::DrawSortItem> temp;
+
+    for (uint32_t round = 0; round < 64; ++round) {
+        std::vector<SR_GRAPH_NS::DrawSortItem> items(1 + random() % 2000);
+        for (uint32_t i = 0; i < items.size(); ++i) {
+            /// узкие ключи дают много повторов и одинаковых разрядов, которые сортировка пропускает
+            items[i].key = round % 2 == 0 ? random() : (random() % 16) << (8 * (round % 8));
+            items[i].index = i;
+        }
+
+        auto&& expected = items;
+        std::stable_sort(expected.begin(), expected.end(), [](auto&& left, auto&& right) {
+            return left.key < right.key;
+        });
+
+        SR_GRAPH_NS::RadixSortDrawItems(items, temp);
+
+        for (uint32_t i = 0; i < items.size(); ++i) {
+            SR_REQUIRE(items[i].key == expected[i].key);
+            SR_REQUIRE(items[i].index == expected[i].index);
+        }
+    }
+
+    /// меши не разыменовываются, нужны только различимые адреса
+    auto&& mesh = [](uintptr_t id) {
+        return reinterpret_cast<SR_GRAPH_NS::DrawList::MeshPtr>(id * 16);
+    };
+    auto&& shader = [](uintptr_t id) {
+        return reinterpret_cast<SR_GRAPH_NS::DrawList::ShaderPtr>(id * 16);
+    };
+
+    SR_GRAPH_NS::DrawList drawList;
+
+    const uint64_t shaderA = drawList.GetShaderIndex(shader(2));
+    const uint64_t shaderB = drawList.GetShaderIndex(shader(1));
+    SR_CHECK_EQ(shaderA, 0u);
+    SR_CHECK_EQ(shaderB, 1u);
+    SR_CHECK_EQ(drawList.GetShaderIndex(shader(2)), 0u);
+
+    auto&& add = [&](uint64_t key, uintptr_t id) {
+        SR_GRAPH_NS::DrawList::Draw draw;
+        draw.pMesh = mesh(id);
+        drawList.Add(key, draw);
+    };
+
+    add(Key::Transparent(0, Key::PassTransparent, shaderA, 0, 10), 1);
+    add(Key::Transparent(0, Key::PassTransparent, shaderA, 0, 500), 2);
+    add(Key::Opaque(0, Key::PassOpaque, shaderB, 0, 10), 3);
+    add(Key::Opaque(0, Key::PassOpaque, shaderA, 1, 500), 4);
+    add(Key::Opaque(0, Key::PassOpaque, shaderA, 1, 20), 5);
+    add(Key::Opaque(1, Key::PassOpaque, shaderA, 0, 0), 6);
+    add(Key::Transparent(0, Key::PassTransparent, shaderB, 0, 500), 7);
+
+    drawList.Sort();
+
+    std::vector<uintptr_t> order;
+    for (auto&& item : drawList.GetItems()) {
+        order.emplace_back(reinterpret_cast<uintptr_t>(drawList.GetDraw(item).pMesh) / 16);
+    }
+
+    /// непрозрачные по шейдеру и материалу, внутри - по глубине; затем прозрачные от дальних к ближним,
+    /// равная глубина - по шейдеру; слой важнее всего
+    SR_CHECK(order == std::vector<uintptr_t>({ 5, 4, 3, 2, 7, 1, 6 }));
+
+    const uint64_t hash = drawList.GetOrderHash(Key::PassTransparent);
+    SR_CHECK(hash != drawList.GetOrderHash(Key::PassOpaque));
+
+    /// прозрачный меш 1 отодвинулся дальше всех - порядок прозрачных сменился, а непрозрачных нет
+    const uint64_t opaqueHash = drawList.GetOrderHash(Key::PassOpaque);
+
+    drawList.Clear();
+    SR_CHECK(drawList.Empty());
+    SR_CHECK_EQ(drawList.GetShaderIndex(shader(1)), 0u);
+
+    add(Key::Transparent(0, Key::PassTransparent, 0, 0, 900), 1);
+    add(Key::Transparent(0, Key::PassTransparent, 1, 0, 500), 2);
+    add(Key::Opaque(0, Key::PassOpaque, 1, 0, 10), 3);
+    add(Key::Opaque(0, Key::PassOpaque, 0, 1, 500), 4);
+    add(Key::Opaque(0, Key::PassOpaque, 0, 1, 20), 5);
+    add(Key::Opaque(1, Key::PassOpaque, 0, 0, 0), 6);
+    add(Key::Transparent(0, Key::PassTransparent, 1, 0, 500), 7);
+
+    drawList.Sort();
+
+    SR_CHECK(drawList.GetOrderHash(Key::PassTransparent) != hash);
+    SR_CHECK_EQ(drawList.GetOrderHash(Key::PassOpaque), opaqueHash);
+}
+
+/// Сборка с отбором кандидатов по осям дает те же списки, что и проверка каждого источника с каждым кластером
+SR_TEST(LightClusters_MatchBruteForce) {
+    SR_GRAPH_NS::LightClusterConfig config;
+    config.far = 200.f;
+
+    SR_GRAPH_NS::LightClusterGrid grid;
+    SR_REQUIRE(grid.Init(config));
+
+    std::mt19937 random(37);
+
+    for (uint32_t round = 0; round < 8; ++round) {
+        auto&& lights = MakeClusterLights(random, 64);
+        grid.Build(lights);
+
+        SR_REQUIRE(grid.GetRanges().size() == grid.GetClustersCount());
+
+        for (uint32_t cluster = 0; cluster < grid.GetClustersCount(); ++cluster) {
+            std::vector<uint32_t> expected;
+            for (auto&& light : lights) {
+                if (SR_GRAPH_NS::LightClusterGrid::LightIntersectsBounds(light, grid.GetBounds(cluster))) {
+                    expected.emplace_back(light.index);
+                }
+            }
+
+            SR_REQUIRE(GetClusterLightIndices(grid, cluster) == expected);
+        }
+    }
+}
+
+/// Любая точка внутри объема источника попадает в кластер, в списке которого этот источник есть.
+/// Для прожектора проверяются и точки у края основания, которые дальше от вершины, чем его дальность
+SR_TEST(LightClusters_VolumeCovered) {
+    SR_GRAPH_NS::LightClusterConfig config;
+    config.far = 200.f;
+
+    SR_GRAPH_NS::LightClusterGrid grid;
+    SR_REQUIRE(grid.Init(config));
+
+    std::mt19937 random(370);
+    std::uniform_real_distribution<float_t> unit(0.f, 1.f);
+
+    auto&& lights = MakeClusterLights(random, 128);
+    grid.Build(lights);
+
+    uint64_t checked = 0;
+    uint64_t missed = 0;
+
+    for (auto&& light : lights) {
+        for (uint32_t i = 0; i < 256; ++i) {
+            SR_MATH_NS::FVector3 point;
+
+            if (light.spot) {
+                /// базис, перпендикулярный оси конуса
+                const SR_MATH_NS::FVector3 helper = std::abs(light.direction.x) < 0.9f ? SR_MATH_NS::FVector3(1.f, 0.f, 0.f) : SR_MATH_NS::FVector3(0.f, 1.f, 0.f);
+                const SR_MATH_NS::FVector3 tangent = light.direction.Cross(helper).Normalize();
+                const SR_MATH_NS::FVector3 bitangent = light.direction.Cross(tangent);
+
+                /// половина точек - на самом основании конуса
+                const float_t height = (i % 2 == 0 ? 1.f : unit(random)) * light.radius;
+                const float_t coneRadius = height * light.sinHalfAngle / light.cosHalfAngle;
+                const float_t angle = unit(random) * 6.2831853f;
+                const float_t distance = (i % 4 == 0 ? 1.f : std::sqrt(unit(random))) * coneRadius * 0.999f;
+
+                point = light.position + light.direction * height + tangent * (std::cos(angle) * distance) + bitangent * (std::sin(angle) * distance);
+            }
+            else {
+                SR_MATH_NS::FVector3 offset(unit(random) * 2.f - 1.f, unit(random) * 2.f - 1.f, unit(random) * 2.f - 1.f);
+                if (offset.Length() > 1.f) {
+                    continue;
+                }
+                point = light.position + offset * (light.radius * 0.999f);
+            }
+
+            const uint32_t cluster = GetPointCluster(grid, point);
+            if (cluster == SR_UINT32_MAX) {
+                continue;
+            }
+
+            ++checked;
+
+            auto&& clusterLights = GetClusterLightIndices(grid, cluster);
+            if (!std::binary_search(clusterLights.begin(), clusterLights.end(), light.index)) {
+                ++missed;
+            }
+        }
+    }
+
+    SR_CHECK(checked > 1000);
+    SR_CHECK_EQ(missed, 0u);
+}
+
+/// Источники вне пирамиды отбрасываются пакетным тестом сфер до раскладки, на любом наборе инструкций.
+/// Источник, задевающий хотя бы один кластер, отбор проходит, поэтому списки совпадают с полным перебором
+SR_TEST(LightClusters_FrustumPreCull) {
+    SR_GRAPH_NS::LightClusterConfig config;
+    config.far = 200.f;
+
+    SR_GRAPH_NS::LightClusterGrid grid;
+    SR_REQUIRE(grid.Init(config));
+
+    const float_t tanX = std::tan(config.FOV * 0.5f) * config.aspect;
+
+    std::vector<SR_GRAPH_NS::ClusterLight> lights = {
+        SR_GRAPH_NS::ClusterLight::Point(SR_MATH_NS::FVector3(0.f, 0.f, 50.f), 1.f, 0),
+        /// за камерой, за far и далеко сбоку
+        SR_GRAPH_NS::ClusterLight::Point(SR_MATH_NS::FVector3(0.f, 0.f, -10.f), 2.f, 1),
+        SR_GRAPH_NS::ClusterLight::Point(SR_MATH_NS::FVector3(0.f, 0.f, 300.f), 50.f, 2),
+        SR_GRAPH_NS::ClusterLight::Point(SR_MATH_NS::FVector3(500.f, 0.f, 50.f), 10.f, 3),
+        /// центр снаружи, но сфера задевает край экрана
+        SR_GRAPH_NS::ClusterLight::Point(SR_MATH_NS::FVector3(tanX * 50.f + 5.f, 0.f, 50.f), 6.f, 4),
+        /// центр за near, но сфера заходит внутрь
+        SR_GRAPH_NS::ClusterLight::Point(SR_MATH_NS::FVector3(0.f, 0.f, -1.f), 2.f, 5),
+    };
+
+    std::mt19937 random(45);
+    const uint32_t fixedCount = static_cast<uint32_t>(lights.size());
+    for (auto&& light : MakeClusterLights(random, 256)) {
+        light.index += fixedCount;
+        lights.emplace_back(light);
+    }
+
+    const auto backend = SR_MATH_NS::SIMD::GetBackend();
+
+    for (auto&& candidate : { SR_MATH_NS::SIMD::Backend::Scalar, SR_MATH_NS::SIMD::Backend::SSE, SR_MATH_NS::SIMD::Backend::AVX2, SR_MATH_NS::SIMD::Backend::NEON }) {
+        if (!SR_MATH_NS::SIMD::SetBackend(candidate)) {
+            continue;
+        }
+
+        grid.Build(lights);
+
+        std::vector<bool> binned(lights.size(), false);
+        uint32_t touching = 0;
+
+        for (uint32_t cluster = 0; cluster < grid.GetClustersCount(); ++cluster) {
+            std::vector<uint32_t> expected;
+            for (auto&& light : lights) {
+                if (SR_GRAPH_NS::LightClusterGrid::LightIntersectsBounds(light, grid.GetBounds(cluster))) {
+                    expected.emplace_back(light.index);
+                }
+            }
+
+            SR_REQUIRE(GetClusterLightIndices(grid, cluster) == expected);
+
+            for (auto&& index : expected) {
+                touching += binned[index] ? 0 : 1;
+                binned[index] = true;
+            }
+        }
+
+        SR_CHECK(binned[0] && binned[4] && binned[5]);
+        SR_CHECK(!binned[1] && !binned[2] && !binned[3]);
+
+        /// прошедшие отбор, но не задевшие ни одного кластера - только с углов пирамиды
+        SR_CHECK(grid.GetVisibleLightsCount() >= touching);
+        SR_CHECK(grid.GetVisibleLightsCount() < lights.size() - 3);
+    }
+
+    SR_MATH_NS::SIMD::SetBackend(backend);
+}
+
+/// Упаковка для шейдера: распаковка так же, как в SSAO/post_process.srsl, дает те же списки кластеров
+SR_TEST(LightClusters_ShaderDataPack) {
+    using ShaderData = SR_GRAPH_NS::LightClusterShaderData;
+
+    SR_GRAPH_NS::LightClusterConfig config;
+    config.sizeZ = 16;
+    config.far = 200.f;
+
+    SR_GRAPH_NS::LightClusterGrid grid;
+    SR_REQUIRE(grid.Init(config));
+
+    auto&& pData = std::make_unique<ShaderData>();
+
+    std::mt19937 random(46);
+
+    for (const uint32_t lightsCount : { 48u, 96u, 512u }) {
+        auto&& lights = MakeClusterLights(random, lightsCount);
+        grid.Build(lights);
+        pData->Pack(grid, lights);
+
+        SR_CHECK_EQ(pData->size[0] * pData->size[1] * pData->size[2], static_cast<int32_t>(grid.GetClustersCount()));
+        SR_CHECK_EQ(pData->size[3], static_cast<int32_t>(SR_MIN(lightsCount, ShaderData::MaxLights)));
+        SR_CHECK_NEAR(pData->params.y, grid.GetLogDepthScale(), 1e-5f);
+
+        uint32_t packed = 0;
+        uint32_t expectedTotal = 0;
+        bool truncated = false;
+
+        for (uint32_t cluster = 0; cluster < grid.GetClustersCount(); ++cluster) {
+            std::vector<uint32_t> expected;
+            for (auto&& index : GetClusterLightIndices(grid, cluster)) {
+                if (index < ShaderData::MaxLights) {
+                    expected.emplace_back(index);
+                }
+            }
+            expectedTotal += static_cast<uint32_t>(expected.size());
+
+            const int32_t range = pData->ranges[cluster];
+            const int32_t offset = range & 65535;
+            const int32_t count = range >> 16;
+            SR_REQUIRE(offset + count <= static_cast<int32_t>(ShaderData::MaxIndices));
+
+            std::vector<uint32_t> unpacked;
+            for (int32_t i = 0; i < count; ++i) {
+                const int32_t slot = offset + i;
+                unpacked.emplace_back(static_cast<uint32_t>((pData->indices[slot >> 2] >> ((slot & 3) * 8)) & 255));
+                SR_REQUIRE(pData->lights[unpacked.back() * 3].w == lights[unpacked.back()].radius);
+            }
+            std::sort(unpacked.begin(), unpacked.end());
+
+            if (unpacked != expected) {
+                /// переполнение режет хвост: взятые индексы - подмножество настоящих
+                SR_REQUIRE(std::includes(expected.begin(), expected.end(), unpacked.begin(), unpacked.end()));
+                truncated = true;
+            }
+
+            packed += static_cast<uint32_t>(count);
+        }
+
+        SR_CHECK_EQ(packed + pData->droppedIndices, static_cast<uint32_t>(grid.GetIndices().size()));
+        SR_CHECK_EQ(truncated, expectedTotal > ShaderData::MaxIndices);
+    }
+}
+
+/// Описанная сфера прожектора содержит и вершину, и весь край основания
+SR_TEST(LightClusters_SpotBoundingSphere) {
+    const SR_MATH_NS::FVector3 apex(1.f, 2.f, 3.f);
+    const SR_MATH_NS::FVector3 direction(0.f, 0.f, 1.f);
+
+    for (auto&& [distance, coneRadius] : std::vector<std::pair<float_t, float_t>>({ { 10.f, 2.f }, { 10.f, 10.f }, { 2.f, 10.f } })) {
+        auto&& light = SR_GRAPH_NS::ClusterLight::Spot(apex, direction, distance, coneRadius, 0);
+
+        SR_CHECK_NEAR(light.sinHalfAngle / light.cosHalfAngle, coneRadius / distance, 1e-5f);
+        SR_CHECK((apex - light.boundingCenter).Length() <= light.boundingRadius + 1e-4f);
+
+        const SR_MATH_NS::FVector3 rim = apex + direction * distance + SR_MATH_NS::FVector3(coneRadius, 0.f, 0.f);
+        SR_CHECK((rim - light.boundingCenter).Length() <= light.boundingRadius + 1e-4f);
+
+        /// и не больше сферы вокруг вершины радиусом до края основания
+        SR_CHECK(light.boundingRadius <= std::sqrt(distance * distance + coneRadius * coneRadius) + 1e-4f);
+    }
+}
+
+/// Границы каскадов растут и заканчиваются на far, крайние lambda дают равномерное и логарифмическое разбиение
+SR_TEST(ShadowCascades_Splits) {
+    constexpr float_t near = 0.1f;
+    constexpr float_t far = 100.f;
+    constexpr uint32_t count = 4;
+
+    for (float_t lambda : { 0.f, 0.5f, 0.95f, 1.f }) {
+        auto&& splits = SR_GRAPH_NS::CalculateCascadeSplits(near, far, count, lambda);
+        SR_REQUIRE(splits.size() == count);
+
+        for (uint32_t i = 1; i < count; ++i) {
+            SR_CHECK(splits[i - 1] < splits[i]);
+        }
+
+        SR_CHECK(splits.front() > 0.f);
+        SR_CHECK_NEAR(splits.back(), 1.f, 1e-5f);
+    }
+
+    auto&& uniform = SR_GRAPH_NS::CalculateCascadeSplits(near, far, count, 0.f);
+    auto&& logarithmic = SR_GRAPH_NS::CalculateCascadeSplits(near, far, count, 1.f);
+
+    for (uint32_t i = 0; i < count; ++i) {
+        const float_t p = static_cast<float_t>(i + 1) / static_cast<float_t>(count);
+        SR_CHECK_NEAR(uniform[i], p, 1e-5f);
+        SR_CHECK_NEAR(logarithmic[i], (near * std::pow(far / near, p) - near) / (far - near), 1e-5f);
+    }
+}
+
+/// При движении камеры центр каскада остается на сетке текселей пространства света, а радиус не меняется,
+/// поэтому каскад сдвигается только на целое число текселей
+SR_TEST(ShadowCascades_TexelSnapping) {
+    constexpr float_t near = 0.1f;
+    constexpr float_t far = 100.f;
+    constexpr uint32_t resolution = 2048;
+    constexpr uint32_t count = 4;
+
+    const SR_MATH_NS::FVector3 lightDirection = SR_MATH_NS::FVector3(-0.3f, -1.f, 0.4f).Normalize();
+    auto&& lightRotation = SR_GRAPH_NS::GetShadowLightRotation(lightDirection);
+    auto&& projection = SR_MATH_NS::Matrix4x4::Perspective(static_cast<float_t>(SR_RAD(60.f)), 16.f / 9.f, near, far);
+    auto&& splits = SR_GRAPH_NS::CalculateCascadeSplits(near, far, count, 0.95f);
+
+    auto&& toLightSpace = [&lightRotation](const SR_MATH_NS::FVector3& point) {
+        return (lightRotation * SR_MATH_NS::FVector4(point, 1.f)).XYZ();
+    };
+
+    std::vector<SR_GRAPH_NS::ShadowCascade> previous;
+
+    for (uint32_t frame = 0; frame < 64; ++frame) {
+        const SR_MATH_NS::FVector3 position(0.037f * static_cast<float_t>(frame), 2.f, -0.013f * static_cast<float_t>(frame));
+        auto&& view = SR_MATH_NS::Matrix4x4::LookAt(position, position + SR_MATH_NS::FVector3(0.f, 0.f, -1.f), SR_MATH_NS::FVector3(0.f, 1.f, 0.f));
+        auto&& invCamera = (projection * view).Inverse();
+
+        std::vector<SR_GRAPH_NS::ShadowCascade> cascades;
+        float_t lastSplit = 0.f;
+
+        for (uint32_t i = 0; i < count; ++i) {
+            cascades.emplace_back(SR_GRAPH_NS::CalculateShadowCascade(invCamera, lastSplit, splits[i], near, far, lightDirection, resolution));
+            lastSplit = splits[i];
+
+            auto&& cascade = cascades.back();
+            const float_t texelSize = 2.f * cascade.radius / static_cast<float_t>(resolution);
+            const SR_MATH_NS::FVector3 center = toLightSpace(cascade.center);
+
+            /// центр совпадает с узлом сетки с точностью до погрешности обратного поворота
+            SR_CHECK_NEAR(center.x / texelSize, std::round(center.x / texelSize), 1e-2f);
+            SR_CHECK_NEAR(center.y / texelSize, std::round(center.y / texelSize), 1e-2f);
+
+            /// в пространство света центр каскада проецируется в середину карты
+            const SR_MATH_NS::FVector4 clip = cascade.viewProjection * SR_MATH_NS::FVector4(cascade.center, 1.f);
+            SR_CHECK_NEAR(clip.x / clip.w, 0.f, 1e-4f);
+            SR_CHECK_NEAR(clip.y / clip.w, 0.f, 1e-4f);
+
+            SR_CHECK_NEAR(cascade.splitDepth, -(near + splits[i] * (far - near)), 1e-3f);
+
+            if (previous.empty()) {
+                continue;
+            }
+
+            SR_CHECK_EQ(cascade.radius, previous[i].radius);
+
+            const SR_MATH_NS::FVector3 shift = center - toLightSpace(previous[i].center);
+            SR_CHECK_NEAR(shift.x / texelSize, std::round(shift.x / texelSize), 1e-2f);
+            SR_CHECK_NEAR(shift.y / texelSize, std::round(shift.y / texelSize), 1e-2f);
+        }
+
+        previous = cascades;
+    }
+}
+
+/// Отсечение кастеров не теряет сферы внутри каскада и между каскадом и источником, но отбрасывает сбоку и сзади
+SR_TEST(ShadowCascades_SphereCulling) {
+    auto&& lightRotation = SR_GRAPH_NS::GetShadowLightRotation(SR_MATH_NS::FVector3(0.2f, -1.f, 0.1f).Normalize());
+
+    SR_GRAPH_NS::ShadowCascade cascade;
+    cascade.center = SR_MATH_NS::FVector3(10.f, 0.f, -5.f);
+    cascade.radius = 8.f;
+
+    auto&& fromLightSpace = lightRotation.Inverse();
+    auto&& offset = [&](float_t x, float_t y, float_t z) {
+        return cascade.center + (fromLightSpace * SR_MATH_NS::FVector4(x, y, z, 0.f)).XYZ();
+    };
+
+    SR_CHECK(SR_GRAPH_NS::IsSphereInShadowCascade(cascade, lightRotation, cascade.center, 0.5f, 0.f));
+    SR_CHECK(SR_GRAPH_NS::IsSphereInShadowCascade(cascade, lightRotation, offset(7.9f, -7.9f, 7.9f), 0.f, 0.f));
+    /// ближе к источнику, чем каскад, - все равно отбрасывает тень
+    SR_CHECK(SR_GRAPH_NS::IsSphereInShadowCascade(cascade, lightRotation, offset(0.f, 0.f, 500.f), 1.f, 0.f));
+    /// касается каскада краем
+    SR_CHECK(SR_GRAPH_NS::IsSphereInShadowCascade(cascade, lightRotation, offset(9.f, 0.f, 0.f), 1.1f, 0.f));
+
+    SR_CHECK(!SR_GRAPH_NS::IsSphereInShadowCascade(cascade, lightRotation, offset(9.f, 0.f, 0.f), 0.9f, 0.f));
+    SR_CHECK(!SR_GRAPH_NS::IsSphereInShadowCascade(cascade, lightRotation, offset(0.f, -12.f, 0.f), 1.f, 0.f));
+    /// за задней гранью
+    SR_CHECK(!SR_GRAPH_NS::IsSphereInShadowCascade(cascade, lightRotation, offset(0.f, 0.f, -12.f), 1.f, 0.f));
+
+    /// запас расширяет каскад
+    SR_CHECK(SR_GRAPH_NS::IsSphereInShadowCascade(cascade, lightRotation, offset(9.f, 0.f, 0.f), 0.9f, 0.5f));
+}
+
+/// Кэш каскада шире описанной сферы и остается верным, пока покрывает срез пирамиды при движении камеры
+SR_TEST(ShadowCascades_CachedExtent) {
+    constexpr float_t near = 0.1f;
+    constexpr float_t far = 100.f;
+    constexpr uint32_t resolution = 2048;
+    constexpr float_t extentScale = 1.1f;
+
+    const SR_MATH_NS::FVector3 lightDirection = SR_MATH_NS::FVector3(-0.3f, -1.f, 0.4f).Normalize();
+    auto&& lightRotation = SR_GRAPH_NS::GetShadowLightRotation(lightDirection);
+    auto&& projection = SR_MATH_NS::Matrix4x4::Perspective(static_cast<float_t>(SR_RAD(60.f)), 16.f / 9.f, near, far);
+    auto&& splits = SR_GRAPH_NS::CalculateCascadeSplits(near, far, 4, 0.95f);
+
+    auto&& calculate = [&](float_t x, float_t scale, uint32_t snapResolution) {
+        const SR_MATH_NS::FVector3 position(x, 2.f, 0.f);
+        auto&& view = SR_MATH_NS::Matrix4x4::LookAt(position, position + SR_MATH_NS::FVector3(0.f, 0.f, -1.f), SR_MATH_NS::FVector3(0.f, 1.f, 0.f));
+        return SR_GRAPH_NS::CalculateShadowCascade((projection * view).Inverse(), splits[0], splits[1], near, far, lightDirection, snapResolution, scale);
+    };
+
+    auto&& cached = calculate(0.f, extentScale, resolution);
+    SR_CHECK_NEAR(cached.extent, cached.radius * extentScale, 1e-5f);
+
+    /// шаг привязки считается от расширенной проекции
+    const float_t texelSize = 2.f * cached.extent / static_cast<float_t>(resolution);
+    const SR_MATH_NS::FVector3 center = (lightRotation * SR_MATH_NS::FVector4(cached.center, 1.f)).XYZ();
+    SR_CHECK_NEAR(center.x / texelSize, std::round(center.x / texelSize), 1e-2f);
+    SR_CHECK_NEAR(center.y / texelSize, std::round(center.y / texelSize), 1e-2f);
+
+    /// без запаса кэш не переживает даже сдвига на тексель
+    auto&& tight = calculate(0.f, 1.f, resolution);
+    SR_CHECK_EQ(tight.extent, tight.radius);
+    SR_CHECK(!SR_GRAPH_NS::IsShadowCascadeCovered(tight, calculate(0.05f, 1.f, resolution), lightRotation, resolution));
+
+    bool covered = false;
+    bool uncovered = false;
+
+    for (uint32_t step = 1; step < 256; ++step) {
+        auto&& cascade = calculate(0.02f * static_cast<float_t>(step), extentScale, resolution);
+        SR_CHECK_EQ(cascade.radius, cached.radius);
+
+        if (SR_GRAPH_NS::IsShadowCascadeCovered(cached, cascade, lightRotation, resolution)) {
+            /// покрытие теряется один раз и не возвращается при удалении камеры
+            SR_CHECK(!uncovered);
+            covered = true;
+
+            /// не привязанная к текселям сфера среза целиком внутри закэшированной проекции
+            auto&& unsnapped = calculate(0.02f * static_cast<float_t>(step), extentScale, 0);
+            const SR_MATH_NS::FVector4 offset = lightRotation * SR_MATH_NS::FVector4(unsnapped.center - cached.center, 0.f);
+            SR_CHECK(std::abs(offset.x) + cascade.radius <= cached.extent + 1e-4f);
+            SR_CHECK(std::abs(offset.y) + cascade.radius <= cached.extent + 1e-4f);
+        }
+        else {
+            uncovered = true;
+        }
+    }
+
+    SR_CHECK(covered);
+    SR_CHECK(uncovered);
+}
+
+/// Чтение без записи раньше в кадре видит прошлый кадр: граф не переставляет читателя за писателя,
+/// а ставит его перед первой записью
+SR_TEST(RenderGraph_ReadBeforeFirstWrite) {
+    SR_GRAPH_NS::RenderGraphResourceDesc persistent;
+
+    SR_GRAPH_NS::RenderGraph graph;
+
+    /// TAA читает историю прошлого кадра, а затем ее же перезаписывает
+    const auto taa = graph.AddPass("TAA", true);
+    const auto scene = graph.AddPass("Scene");
+    const auto history = graph.AddPass("History");
+
+    graph.Read(taa, graph.GetOrAddResource("HistoryFBO"));
+    graph.Read(taa, graph.GetOrAddResource("SceneFBO"));
+    graph.Write(scene, graph.DeclareResource("SceneFBO", persistent));
+    graph.Read(history, graph.GetOrAddResource("SceneFBO"));
+    graph.Write(history, graph.DeclareResource("HistoryFBO", persistent));
+
+    SR_REQUIRE(graph.Compile());
+
+    /// SceneFBO тоже читается до записи, поэтому TAA идет первым, а запись истории - после всех ее чтений
+    SR_CHECK(GetCompiledPassNames(graph) == std::vector<std::string>({ "TAA", "Scene", "History" }));
+
+    /// импорт: ресурс никто не пишет
+    SR_GRAPH_NS::RenderGraph imported;
+    const auto pass = imported.AddPass("Composite", true);
+    imported.Read(pass, imported.GetOrAddResource("ExternalFBO"));
+    SR_CHECK(imported.Compile());
+    SR_CHECK_EQ(imported.GetCompiledPasses().size(), 1u);
+
+    /// временный ресурс до первой записи в кадре пуст
+    SR_GRAPH_NS::RenderGraphResourceDesc transient;
+    transient.transient = true;
+
+    SR_GRAPH_NS::RenderGraph invalid;
+    const auto reader = invalid.AddPass("Reader", true);
+    const auto writer = invalid.AddPass("Writer");
+    invalid.Read(reader, invalid.GetOrAddResource("TempFBO"));
+    invalid.Write(writer, invalid.DeclareResource("TempFBO", transient));
+
+    LogCapture capture;
+    SR_CHECK(!invalid.Compile());
+    SR_CHECK(capture.GetText().find("before it is written") != std::string::npos);
+}
+
+/// Временные ресурсы с непересекающимися временами жизни и одинаковым описанием делят слот,
+/// а неиспользуемые проходы отсекаются
+SR_TEST(RenderGraph_CullAndAlias) {
+    SR_GRAPH_NS::RenderGraphResourceDesc transient;
+    transient.transient = true;
+
+    SR_GRAPH_NS::RenderGraph graph;
+
+    SR_GRAPH_NS::RenderGraphPassBuilder a(graph, graph.AddPass("A"));
+    a.Write("AFBO", transient);
+
+    SR_GRAPH_NS::RenderGraphPassBuilder b(graph, graph.AddPass("B"));
+    b.Read("AFBO");
+    b.Write("BFBO", transient);
+
+    SR_GRAPH_NS::RenderGraphPassBuilder c(graph, graph.AddPass("C"));
+    c.Read("BFBO");
+    c.Write("CFBO", transient);
+
+    SR_GRAPH_NS::RenderGraphPassBuilder unused(graph, graph.AddPass("Unused"));
+    unused.Write("UnusedFBO", transient);
+
+    SR_GRAPH_NS::RenderGraphPassBuilder present(graph, graph.AddPass("Present", true));
+    present.Read("CFBO");
+
+    SR_REQUIRE(graph.Compile());
+
+    SR_CHECK(GetCompiledPassNames(graph) == std::vector<std::string>({ "A", "B", "C", "Present" }));
+    SR_CHECK(graph.IsPassCulled(3));
+
+    auto&& resources = graph.GetResources();
+    /// A живет до B, C начинается после B - слот A свободен
+    SR_CHECK_EQ(resources[graph.FindResource("AFBO")].physical, resources[graph.FindResource("CFBO")].physical);
+    SR_CHECK(resources[graph.FindResource("AFBO")].physical != resources[graph.FindResource("BFBO")].physical);
+    SR_CHECK_EQ(graph.GetPhysicalResourcesCount(), 2u);
+}
+
+/// Техники движка компилируются без отсечения проходов, порядок совпадает с объявлением,
+/// а временные буферы SSAO с непересекающимися временами жизни делят слот
+SR_TEST(RenderGraph_StockTechniques) {
+    {
+        SR_GRAPH_NS::RenderGraph graph;
+        std::vector<std::unique_ptr<SR_GRAPH_NS::BasePass>> passes;
+        SR_REQUIRE(LoadTechniqueRenderGraph("Engine/Configs/MainRenderTechnique.xml", graph, passes));
+        SR_REQUIRE(graph.Compile());
+
+        SR_CHECK(GetCompiledPassNames(graph) == std::vector<std::string>({ "StaticDepthFBO", "DepthFBO", "SceneViewFBO", "SwapchainPass" }));
+
+        /// кэш статики читается проходом динамичных кастеров, дальше цепочка
+        auto&& compiled = graph.GetCompiledPasses();
+        for (uint32_t i = 0; i < compiled.size(); ++i) {
+            SR_CHECK_EQ(compiled[i].depth, i);
+        }
+    }
+
+    {
+        SR_GRAPH_NS::RenderGraph graph;
+        std::vector<std::unique_ptr<SR_GRAPH_NS::BasePass>> passes;
+        SR_REQUIRE(LoadTechniqueRenderGraph("Engine/Configs/SSAORenderTechnique.xml", graph, passes));
+        SR_REQUIRE(graph.Compile());
+
+        SR_CHECK(GetCompiledPassNames(graph) == std::vector<std::string>({ "GBuffer", "SSAO", "SSAOBlurX", "SSAOBlur", "SwapchainPass" }));
+
+        /// очереди без узла Queues строятся по глубине, здесь цепочка
+        auto&& compiled = graph.GetCompiledPasses();
+        for (uint32_t i = 0; i < compiled.size(); ++i) {
+            SR_CHECK_EQ(compiled[i].depth, i);
+        }
+
+        /// SSAO читает GBuffer, поэтому перед ним нужен барьер перевода в чтение
+        auto&& barriers = graph.GetBarriers();
+        auto&& ssao = compiled[1];
+        const auto gBuffer = graph.FindResource("GBuffer");
+        SR_CHECK(std::any_of(barriers.begin() + ssao.barrierOffset, barriers.begin() + ssao.barrierOffset + ssao.barrierCount, [gBuffer](auto&& barrier) {
+            return barrier.resource == gBuffer && barrier.after == SR_GRAPH_NS::RenderGraphResourceState::ShaderRead;
+        }));
+
+        auto&& resources = graph.GetResources();
+        const auto transientCount = static_cast<uint32_t>(std::count_if(resources.begin(), resources.end(), [](auto&& resource) {
+            return resource.desc.transient;
+        }));
+        SR_CHECK_EQ(transientCount, 4u);
+        SR_CHECK(graph.GetPhysicalResourcesCount() < transientCount);
+
+        /// SSAO дочитан размытием по X раньше, чем размытие по Y начинает писать
+        SR_CHECK_EQ(resources[graph.FindResource("SSAO")].physical, resources[graph.FindResource("SSAOBlur")].physical);
+        SR_CHECK(resources[graph.FindResource("SSAO")].physical != resources[graph.FindResource("SSAOBlurX")].physical);
+        SR_CHECK(resources[graph.FindResource("GBuffer")].physical != resources[graph.FindResource("SSAOBlur")].physical);
+    }
+}
+
+/// Захваченные отрисовки, переписанные заданиями ParallelCommandRecorder, дают один и тот же поток команд
+/// при любом числе рабочих потоков, а каждый диапазон воспроизводит свои отрисовки сам по себе
+SR_TEST(DrawCapture_ParallelDeterminism) {
+    constexpr uint32_t draws = 5000;
+
+    SR_GRAPH_NS::DrawCapture capture;
+    CaptureMeshDraws(capture, draws);
+
+    SR_REQUIRE(capture.GetDrawsCount() == draws);
+
+    DrawStateTracker serial;
+    capture.GetCommandList().Replay(serial);
+
+    SR_REQUIRE(serial.GetDraws().size() == draws);
+
+    std::optional<SR_GRAPH_NS::CommandList> reference;
+
+    for (uint32_t workers : { 0u, 1u, 3u, 7u }) {
+        SR_GRAPH_NS::ParallelCommandRecorder recorder(workers);
+
+        for (uint32_t round = 0; round < 4; ++round) {
+            recorder.Begin();
+            capture.AddJobs(recorder, 64, 16);
+            recorder.Record();
+
+            SR_CHECK_EQ(recorder.GetJobsCount(), 16u);
+
+            SR_GRAPH_NS::CommandList merged;
+            recorder.Merge(merged);
+
+            SR_CHECK_EQ(merged.GetDrawCalls(), draws);
+
+            if (!reference) {
+                reference = std::move(merged);
+                continue;
+            }
+
+            SR_REQUIRE(merged == *reference);
+        }
+    }
+
+    /// повторные привязки набора дескрипторов отброшены
+    SR_CHECK(reference->GetCommands().size() < capture.GetCommandList().GetCommands().size());
+
+    DrawStateTracker merged;
+    reference->Replay(merged);
+    SR_CHECK(merged.GetDraws() == serial.GetDraws());
+
+    /// диапазон с середины группы сам восстанавливает шейдер, константы и буферы
+    for (auto&& range : SR_GRAPH_NS::ParallelCommandRecorder::Split(draws, 64, 16)) {
+        SR_GRAPH_NS::CommandList commandList;
+        capture.Emit(range.offset, range.count, commandList);
+
+        DrawStateTracker tracker;
+        commandList.Replay(tracker);
+
+        SR_REQUIRE(tracker.GetDraws().size() == range.count);
+        SR_CHECK(std::equal(tracker.GetDraws().begin(), tracker.GetDraws().end(), serial.GetDraws().begin() + range.offset));
+    }
+}
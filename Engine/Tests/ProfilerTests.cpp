@@ -0,0 +1,660 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Test.h>
+
+#include <Utils/Profile/Profiler.h>
+#include <Utils/Profile/MemoryTracker.h>
+
+#include <filesystem>
+#include <random>
+
+namespace SR_TESTS_NS {
+    struct ExportedZone {
+        std::string name;
+        uint32_t thread = 0;
+        uint32_t depth = 0;
+        double_t begin = 0.0;
+        double_t end = 0.0;
+    };
+
+    /// Делит строку CSV на поля с учетом кавычек. Вернет false, если кавычки не закрыты
+    bool SplitCSVLine(const std::string& line, std::vector<std::string>& fields) {
+        fields.clear();
+        fields.emplace_back();
+
+        bool isQuoted = false;
+
+        for (uint64_t i = 0; i < line.size(); ++i) {
+            const char c = line[i];
+
+            if (isQuoted) {
+                if (c == '"' && i + 1 < line.size() && line[i + 1] == '"') {
+                    fields.back() += '"';
+                    ++i;
+                }
+                else if (c == '"') {
+                    isQuoted = false;
+                }
+                else {
+                    fields.back() += c;
+                }
+            }
+            else if (c == '"') {
+                isQuoted = true;
+            }
+            else if (c == ',') {
+                fields.emplace_back();
+            }
+            else {
+                fields.back() += c;
+            }
+        }
+
+        return !isQuoted;
+    }
+
+    /// Проверяет синтаксис JSON целиком, без построения дерева
+    class JsonValidator : public SR_UTILS_NS::NonCopyable {
+    public:
+        explicit JsonValidator(const std::string& text)
+            : m_text(text)
+        { }
+
+    public:
+        SR_NODISCARD bool Validate() {
+            SkipSpaces();
+            if (!Value()) {
+                return false;
+            }
+            SkipSpaces();
+            return m_position == m_text.size();
+        }
+
+    private:
+        void SkipSpaces() {
+            while (m_position < m_text.size() && std::isspace(static_cast<uint8_t>(m_text[m_position]))) {
+                ++m_position;
+            }
+        }
+
+        SR_NODISCARD bool Consume(char c) {
+            SkipSpaces();
+            if (m_position < m_text.size() && m_text[m_position] == c) {
+                ++m_position;
+                return true;
+            }
+            return false;
+        }
+
+        SR_NODISCARD bool Value() {
+            SkipSpaces();
+
+            if (m_position >= m_text.size()) {
+                return false;
+            }
+
+            switch (m_text[m_position]) {
+                case '{': return Object();
+                case '[': return Array();
+                case '"': return String();
+                case 't': return Literal("true");
+                case 'f': return Literal("false");
+                case 'n': return Literal("null");
+                default:
+                    return Number();
+            }
+        }
+
+        SR_NODISCARD bool Object() {
+            ++m_position;
+            if (Consume('}')) {
+                return true;
+            }
+            do {
+                SkipSpaces();
+                if (!String() || !Consume(':') || !Value()) {
+                    return false;
+                }
+            } while (Consume(','));
+            return Consume('}');
+        }
+
+        SR_NODISCARD bool Array() {
+            ++m_position;
+            if (Consume(']')) {
+                return true;
+            }
+            do {
+                if (!Value()) {
+                    return false;
+                }
+            } while (Consume(','));
+            return Consume(']');
+        }
+
+        SR_NODISCARD bool String() {
+            if (m_position >= m_text.size() || m_text[m_position] != '"') {
+                return false;
+            }
+
+            for (++m_position; m_position < m_text.size(); ++m_position) {
+                const char c = m_text[m_position];
+                if (c == '"') {
+                    ++m_position;
+                    return true;
+                }
+                if (static_cast<uint8_t>(c) < 0x20) {
+                    return false;
+                }
+                if (c == '\\') {
+                    ++m_position;
+                    if (m_position >= m_text.size() || std::string("\"\\/bfnrtu").find(m_text[m_position]) == std::string::npos) {
+                        return false;
+                    }
+                }
+            }
+
+            return false;
+        }
+
+        SR_NODISCARD bool Number() {
+            const uint64_t begin = m_position;
+
+            if (m_position < m_text.size() && m_text[m_position] == '-') {
+                ++m_position;
+            }
+
+            while (m_position < m_text.size() && (std::isdigit(static_cast<uint8_t>(m_text[m_position])) || std::string(".eE+-").find(m_text[m_position]) != std::string::npos)) {
+                ++m_position;
+            }
+
+            if (m_position == begin) {
+                return false;
+            }
+
+            char* pEnd = nullptr;
+            const std::string number = m_text.substr(begin, m_position - begin);
+            std::strtod(number.c_str(), &pEnd);
+            return pEnd == number.c_str() + number.size();
+        }
+
+        SR_NODISCARD bool Literal(const char* literal) {
+            const uint64_t length = std::strlen(literal);
+            if (m_text.compare(m_position, length, literal) != 0) {
+                return false;
+            }
+            m_position += length;
+            return true;
+        }
+
+    private:
+        const std::string& m_text;
+        uint64_t m_position = 0;
+
+    };
+
+    std::filesystem::path GetProfilerTestPath(const std::string& name) {
+        auto&& path = std::filesystem::temp_directory_path() / "SRTests" / name;
+        std::filesystem::create_directories(path.parent_path());
+        return path;
+    }
+
+    std::string ReadTextFile(const std::filesystem::path& path) {
+        std::ifstream stream(path);
+        return std::string(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+    }
+
+    uint64_t CountSubstrings(const std::string& text, const std::string& substring) {
+        uint64_t count = 0;
+        for (auto position = text.find(substring); position != std::string::npos; position = text.find(substring, position + substring.size())) {
+            ++count;
+        }
+        return count;
+    }
+
+    struct MemoryTestObject {
+        SR_MEMORY_TAG(SR_UTILS_NS::MemoryTag::Scripts)
+    public:
+        char data[40] = { };
+    };
+
+    struct alignas(64) MemoryTestAligned {
+        SR_MEMORY_TAG(SR_UTILS_NS::MemoryTag::Scripts)
+    public:
+        char data[72] = { };
+    };
+
+    struct alignas(256) MemoryTestWideAligned {
+        SR_MEMORY_TAG(SR_UTILS_NS::MemoryTag::Scripts)
+    public:
+        char data[8] = { };
+    };
+
+    SR_UTILS_NS::MemoryTagStats GetMemoryStats(SR_UTILS_NS::MemoryTag tag) {
+        auto&& tracker = SR_UTILS_NS::MemoryTracker::Instance();
+        tracker.Update();
+        return tracker.GetStats()[static_cast<uint64_t>(tag)];
+    }
+}
+
+using namespace SR_TESTS_NS;
+
+/// Зоны, записанные параллельно в нескольких потоках, после экспорта вложены друг в друга
+/// внутри своего потока, а глубина совпадает с фактической вложенностью
+SR_TEST(Profiler_NestingAcrossThreads) {
+    auto&& profiler = SR_UTILS_NS::Profiler::Instance();
+
+    constexpr uint32_t threadsCount = 4;
+    constexpr uint32_t iterations = 1000;
+
+    profiler.SetEnabled(true);
+
+    std::vector<std::thread> threads;
+
+    for (uint32_t i = 0; i < threadsCount; ++i) {
+        threads.emplace_back([]() {
+            for (uint32_t j = 0; j < iterations; ++j) {
+                SR_PROFILE_ZONE_N("Outer");
+                {
+                    SR_PROFILE_ZONE_N("Middle");
+                    {
+                        SR_PROFILE_ZONE_N("Inner");
+                    }
+                }
+                /// вторая ветка на том же уровне, чтобы соседние зоны не считались вложенными
+                {
+                    SR_PROFILE_ZONE_N("Middle");
+                }
+            }
+        });
+    }
+
+    for (auto&& thread : threads) {
+        thread.join();
+    }
+
+    profiler.SetEnabled(false);
+
+    auto&& path = GetProfilerTestPath("ProfilerNesting.csv");
+    SR_REQUIRE(profiler.SaveCSV(SR_UTILS_NS::Path(path.string())));
+
+    std::ifstream stream(path);
+    std::string line;
+    std::vector<std::string> fields;
+
+    std::map<uint32_t, std::vector<ExportedZone>> zonesByThread;
+
+    SR_REQUIRE(std::getline(stream, line));
+
+    while (std::getline(stream, line)) {
+        SR_REQUIRE(SplitCSVLine(line, fields) && fields.size() == 7);
+
+        /// параллельно пишут и потоки движка, например GC ресурсов
+        if (fields[0] != "zone" || (fields[2] != "Outer" && fields[2] != "Middle" && fields[2] != "Inner")) {
+            continue;
+        }
+
+        ExportedZone zone;
+        zone.thread = static_cast<uint32_t>(std::stoul(fields[1]));
+        zone.name = fields[2];
+        zone.depth = static_cast<uint32_t>(std::stoul(fields[3]));
+        zone.begin = std::stod(fields[4]);
+        zone.end = zone.begin + std::stod(fields[5]);
+        zonesByThread[zone.thread].emplace_back(zone);
+    }
+
+    SR_CHECK_EQ(static_cast<uint32_t>(zonesByThread.size()), threadsCount);
+
+    /// время выгружается в микросекундах с тремя знаками, допускаем ошибку округления
+    constexpr double_t epsilon = 0.002;
+
+    for (auto&& [thread, zones] : zonesByThread) {
+        SR_CHECK_EQ(static_cast<uint32_t>(zones.size()), iterations * 4);
+
+        std::stable_sort(zones.begin(), zones.end(), [](const ExportedZone& lhs, const ExportedZone& rhs) {
+            return lhs.begin < rhs.begin || (lhs.begin == rhs.begin && lhs.depth < rhs.depth);
+        });
+
+        std::vector<const ExportedZone*> stack;
+
+        for (auto&& zone : zones) {
+            while (!stack.empty() && stack.back()->end < zone.begin + epsilon && stack.size() > zone.depth) {
+                stack.pop_back();
+            }
+
+            SR_REQUIRE(stack.size() == zone.depth);
+
+            if (!stack.empty()) {
+                SR_REQUIRE(zone.begin + epsilon >= stack.back()->begin);
+                SR_REQUIRE(zone.end <= stack.back()->end + epsilon);
+            }
+
+            const uint32_t expectedDepth = zone.name == "Outer" ? 0 : (zone.name == "Middle" ? 1 : 2);
+            SR_REQUIRE(zone.depth == expectedDepth);
+
+            stack.emplace_back(&zone);
+        }
+    }
+}
+
+/// Экспорт в Chrome trace - корректный JSON, в CSV у каждой строки одинаковое число полей,
+/// имена с кавычками и запятыми экранируются, а статистика кадра видит его зоны и счетчики
+SR_TEST(Profiler_ExportWellFormed) {
+    auto&& profiler = SR_UTILS_NS::Profiler::Instance();
+
+    profiler.SetEnabled(true);
+
+    constexpr uint32_t frames = 3;
+
+    for (uint32_t frame = 0; frame < frames; ++frame) {
+        SR_PROFILE_FRAME_BEGIN();
+        {
+            SR_PROFILE_ZONE_N("Frame \"zone\"");
+            {
+                SR_PROFILE_ZONE_N("Zone, with comma");
+            }
+            SR_PROFILE_ZONE_N("Zone\twith tab");
+        }
+        SR_PROFILE_COUNTER("Draw calls", 10 + frame);
+        SR_PROFILE_COUNTER("Resources", 100);
+        SR_PROFILE_FRAME_END();
+
+        auto&& stats = profiler.GetLastFrameStats();
+        SR_CHECK_EQ(stats.frame, static_cast<uint64_t>(frame));
+        SR_CHECK(stats.zones >= 3u);
+        SR_CHECK_EQ(stats.droppedZones, 0u);
+        SR_REQUIRE(stats.counters.size() == 2);
+        SR_CHECK_EQ(std::string(stats.counters[0].first), std::string("Draw calls"));
+        SR_CHECK_EQ(stats.counters[0].second, static_cast<int64_t>(10 + frame));
+    }
+
+    profiler.SetEnabled(false);
+
+    /// выключенный профайлер ничего не пишет
+    {
+        SR_PROFILE_ZONE_N("Disabled");
+        SR_PROFILE_COUNTER("Disabled", 1);
+    }
+
+    auto&& jsonPath = GetProfilerTestPath("ProfilerExport.json");
+    auto&& csvPath = GetProfilerTestPath("ProfilerExport.csv");
+
+    SR_REQUIRE(profiler.SaveChromeTrace(SR_UTILS_NS::Path(jsonPath.string())));
+    SR_REQUIRE(profiler.SaveCSV(SR_UTILS_NS::Path(csvPath.string())));
+
+    auto&& json = ReadTextFile(jsonPath);
+
+    SR_CHECK(JsonValidator(json).Validate());
+    /// зоны GC ресурсов из потока менеджера тоже могут попасть в запись, поэтому свои считаем по имени
+    SR_CHECK(CountSubstrings(json, "\"ph\":\"X\"") >= static_cast<uint64_t>(frames * 3));
+    SR_CHECK_EQ(CountSubstrings(json, "\"name\":\"Zone, with comma\""), static_cast<uint64_t>(frames));
+    SR_CHECK_EQ(CountSubstrings(json, "\"ph\":\"C\""), static_cast<uint64_t>(frames * 2));
+    SR_CHECK_EQ(CountSubstrings(json, "\"ph\":\"i\""), static_cast<uint64_t>(frames));
+    SR_CHECK(json.find("Frame \\\"zone\\\"") != std::string::npos);
+    SR_CHECK(json.find("Zone\\twith tab") != std::string::npos);
+    SR_CHECK(json.find("Disabled") == std::string::npos);
+
+    std::ifstream stream(csvPath);
+    std::string line;
+    std::vector<std::string> fields;
+    std::map<std::string, uint32_t> rows;
+    std::set<std::string> names;
+
+    SR_REQUIRE(std::getline(stream, line));
+    SR_CHECK_EQ(line, std::string("type,thread,name,depth,begin_us,duration_us,value"));
+
+    while (std::getline(stream, line)) {
+        SR_REQUIRE(SplitCSVLine(line, fields));
+        SR_REQUIRE(fields.size() == 7);
+        ++rows[fields[0]];
+        names.insert(fields[2]);
+    }
+
+    SR_CHECK(rows["zone"] >= frames * 3);
+    SR_CHECK_EQ(rows["counter"], frames * 2);
+    SR_CHECK_EQ(rows["frame"], frames);
+    SR_CHECK_EQ(static_cast<uint32_t>(rows.size()), 3u);
+    SR_CHECK(names.count("Frame \"zone\"") == 1);
+    SR_CHECK(names.count("Zone, with comma") == 1);
+    SR_CHECK(names.count("Disabled") == 0);
+}
+
+/// Выделения и освобождения в нескольких потоках, в том числе освобождение чужих блоков,
+/// при параллельных Update сходятся в точные счетчики
+SR_TEST(MemoryTracker_ConcurrentAccounting) {
+    using SR_UTILS_NS::MemoryTracker;
+    using SR_UTILS_NS::MemoryTag;
+
+    constexpr uint32_t threadsCount = 4;
+    constexpr uint32_t iterations = 50000;
+
+    const auto base = GetMemoryStats(MemoryTag::Audio);
+
+    std::mutex handoffMutex;
+    std::vector<std::pair<void*, uint64_t>> handoff;
+
+    std::atomic<bool> isDone = false;
+    std::atomic<uint32_t> misaligned = 0;
+
+    std::vector<std::thread> threads;
+
+    for (uint32_t i = 0; i < threadsCount; ++i) {
+        threads.emplace_back([&, i]() {
+            std::mt19937 random(i);
+            std::vector<std::pair<void*, uint64_t>> live;
+
+            for (uint32_t j = 0; j < iterations; ++j) {
+                const uint64_t size = random() % 512;
+                const uint64_t alignment = uint64_t(16) << (random() % 4);
+
+                void* pData = MemoryTracker::Allocate(MemoryTag::Audio, size, alignment);
+                if (reinterpret_cast<uintptr_t>(pData) % alignment != 0) {
+                    ++misaligned;
+                }
+                live.emplace_back(pData, size);
+
+                /// часть блоков освобождает другой поток
+                if (random() % 3 == 0) {
+                    std::lock_guard lock(handoffMutex);
+                    handoff.emplace_back(live.back());
+                    live.pop_back();
+                }
+
+                if (random() % 2 == 0 && !live.empty()) {
+                    MemoryTracker::Free(live.front().first);
+                    live.front() = live.back();
+                    live.pop_back();
+                }
+
+                if (j % 64 == 0) {
+                    std::lock_guard lock(handoffMutex);
+                    if (!handoff.empty()) {
+                        MemoryTracker::Free(handoff.back().first);
+                        handoff.pop_back();
+                    }
+                }
+            }
+
+            /// оставшиеся блоки освобождаются после проверки счетчиков
+            std::lock_guard lock(handoffMutex);
+            handoff.insert(handoff.end(), live.begin(), live.end());
+        });
+    }
+
+    std::thread updater([&]() {
+        while (!isDone) {
+            MemoryTracker::Instance().Update();
+            std::this_thread::yield();
+        }
+    });
+
+    for (auto&& thread : threads) {
+        thread.join();
+    }
+
+    isDone = true;
+    updater.join();
+
+    int64_t handoffBytes = 0;
+    for (auto&& [pData, size] : handoff) {
+        handoffBytes += static_cast<int64_t>(size);
+    }
+
+    auto stats = GetMemoryStats(MemoryTag::Audio);
+
+    SR_CHECK_EQ(misaligned.load(), 0u);
+    SR_CHECK_EQ(stats.totalAllocations - base.totalAllocations, static_cast<uint64_t>(threadsCount) * iterations);
+    SR_CHECK_EQ(stats.bytes - base.bytes, handoffBytes);
+    SR_CHECK_EQ(stats.allocations - base.allocations, static_cast<int64_t>(handoff.size()));
+    SR_CHECK(stats.peakBytes >= stats.bytes);
+
+    for (auto&& [pData, size] : handoff) {
+        MemoryTracker::Free(pData);
+    }
+
+    stats = GetMemoryStats(MemoryTag::Audio);
+
+    SR_CHECK_EQ(stats.bytes, base.bytes);
+    SR_CHECK_EQ(stats.allocations, base.allocations);
+}
+
+/// Классы с SR_MEMORY_TAG и выравниванием больше, чем у malloc, получают выровненную память
+/// через перегрузки с std::align_val_t и учитываются под своим тегом
+SR_TEST(MemoryTracker_AlignedTaggedObjects) {
+    using SR_UTILS_NS::MemoryTag;
+
+    constexpr uint32_t count = 100;
+
+    const auto base = GetMemoryStats(MemoryTag::Scripts);
+
+    std::vector<std::unique_ptr<MemoryTestObject>> objects;
+    std::vector<std::unique_ptr<MemoryTestAligned>> aligned;
+    std::vector<std::unique_ptr<MemoryTestWideAligned>> wideAligned;
+
+    for (uint32_t i = 0; i < count; ++i) {
+        objects.emplace_back(std::make_unique<MemoryTestObject>());
+        aligned.emplace_back(std::make_unique<MemoryTestAligned>());
+        wideAligned.emplace_back(std::make_unique<MemoryTestWideAligned>());
+    }
+
+    uint32_t misaligned = 0;
+    for (uint32_t i = 0; i < count; ++i) {
+        misaligned += reinterpret_cast<uintptr_t>(objects[i].get()) % alignof(std::max_align_t) != 0 ? 1 : 0;
+        misaligned += reinterpret_cast<uintptr_t>(aligned[i].get()) % alignof(MemoryTestAligned) != 0 ? 1 : 0;
+        misaligned += reinterpret_cast<uintptr_t>(wideAligned[i].get()) % alignof(MemoryTestWideAligned) != 0 ? 1 : 0;
+    }
+    SR_CHECK_EQ(misaligned, 0u);
+
+    auto stats = GetMemoryStats(MemoryTag::Scripts);
+
+    const uint64_t bytes = count * (sizeof(MemoryTestObject) + sizeof(MemoryTestAligned) + sizeof(MemoryTestWideAligned));
+    SR_CHECK_EQ(stats.bytes - base.bytes, static_cast<int64_t>(bytes));
+    SR_CHECK_EQ(stats.allocations - base.allocations, static_cast<int64_t>(count * 3));
+
+    /// placement new не проходит через трекер
+    alignas(MemoryTestAligned) char place[sizeof(MemoryTestAligned)];
+    auto&& pPlaced = new (place) MemoryTestAligned();
+    pPlaced->~MemoryTestAligned();
+
+    objects.clear();
+    aligned.clear();
+    wideAligned.clear();
+
+    stats = GetMemoryStats(MemoryTag::Scripts);
+
+    SR_CHECK_EQ(stats.bytes, base.bytes);
+    SR_CHECK_EQ(stats.allocations, base.allocations);
+    SR_CHECK_EQ(stats.totalAllocations - base.totalAllocations, static_cast<uint64_t>(count * 3));
+}
+
+/// Отчет об утечках называет тег с неосвобожденными выделениями и их стек, после освобождения тег пропадает из отчета
+SR_TEST(MemoryTracker_ReportLeaks) {
+    using SR_UTILS_NS::MemoryTracker;
+    using SR_UTILS_NS::MemoryTag;
+
+    constexpr uint64_t count = 3;
+    constexpr uint64_t size = 48;
+
+    auto&& tracker = MemoryTracker::Instance();
+
+    const auto base = GetMemoryStats(MemoryTag::Audio);
+    const uint32_t sampleRate = MemoryTracker::GetSampleRate();
+
+    MemoryTracker::SetSampleRate(1);
+
+    std::vector<void*> leaked;
+    for (uint64_t i = 0; i < count; ++i) {
+        leaked.emplace_back(MemoryTracker::Allocate(MemoryTag::Audio, size, i == 0 ? 128 : 16));
+    }
+
+    MemoryTracker::SetSampleRate(sampleRate);
+
+    {
+        LogCapture capture;
+
+        SR_CHECK(tracker.ReportLeaks() >= count);
+
+        const std::string text = capture.GetText();
+        SR_CHECK(text.find(SR_FORMAT("Audio - {} allocations, {} bytes not freed",
+            base.allocations + count, base.bytes + count * size)) != std::string::npos);
+        SR_CHECK_EQ(CountSubstrings(text, SR_FORMAT("sampled allocation of {} bytes [Audio]", size)), count);
+    }
+
+    for (auto&& pData : leaked) {
+        MemoryTracker::Free(pData);
+    }
+
+    SR_CHECK_EQ(GetMemoryStats(MemoryTag::Audio).allocations, base.allocations);
+
+    uint64_t liveSamples = 0;
+    for (auto&& sample : tracker.GetLiveSamples()) {
+        liveSamples += sample.tag == MemoryTag::Audio ? 1 : 0;
+    }
+    SR_CHECK_EQ(liveSamples, 0u);
+
+    if (base.allocations == 0) {
+        LogCapture capture;
+        tracker.ReportLeaks();
+        SR_CHECK(capture.GetText().find("Audio - ") == std::string::npos);
+    }
+}
+
+/// Выключенный трекер не считает свои выделения, а блоки из обоих режимов освобождаются в любом режиме
+/// и снимаются со счетчиков, только если были учтены
+SR_TEST(MemoryTracker_Disabled) {
+    using SR_UTILS_NS::MemoryTracker;
+    using SR_UTILS_NS::MemoryTag;
+
+    constexpr uint64_t trackedSize = 96;
+    constexpr uint64_t untrackedSize = 200;
+
+    const auto base = GetMemoryStats(MemoryTag::Audio);
+    SR_REQUIRE(MemoryTracker::IsEnabled());
+
+    void* pTracked = MemoryTracker::Allocate(MemoryTag::Audio, trackedSize);
+
+    MemoryTracker::SetEnabled(false);
+
+    void* pUntracked = MemoryTracker::Allocate(MemoryTag::Audio, untrackedSize, 64);
+    void* pUntrackedSmall = MemoryTracker::Allocate(MemoryTag::Audio, untrackedSize);
+    SR_CHECK(reinterpret_cast<uintptr_t>(pUntracked) % 64 == 0);
+
+    auto stats = GetMemoryStats(MemoryTag::Audio);
+    SR_CHECK_EQ(stats.bytes - base.bytes, static_cast<int64_t>(trackedSize));
+    SR_CHECK_EQ(stats.allocations - base.allocations, 1);
+    SR_CHECK_EQ(stats.totalAllocations - base.totalAllocations, 1u);
+
+    MemoryTracker::Free(pTracked);
+    MemoryTracker::Free(pUntrackedSmall);
+
+    MemoryTracker::SetEnabled(true);
+
+    MemoryTracker::Free(pUntracked);
+
+    stats = GetMemoryStats(MemoryTag::Audio);
+    SR_CHECK_EQ(stats.bytes, base.bytes);
+    SR_CHECK_EQ(stats.allocations, base.allocations);
+    SR_CHECK_EQ(stats.totalAllocations - base.totalAllocations, 1u);
+}
@@ -0,0 +1,225 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Test.h>
+
+#include <Utils/ResourceManager/ResourceManager.h>
+
+namespace SR_TESTS_NS {
+    /// Ресурс без файла, только для проверки учета в ResourceManager
+    class TestResource final : public SR_UTILS_NS::IResource {
+        using Super = SR_UTILS_NS::IResource;
+    public:
+        TestResource()
+            : Super(SR_COMPILE_TIME_CRC32_TYPE_NAME(TestResource))
+        {
+            m_isFromMemory = true;
+        }
+
+    public:
+        /// Типы регистрируются без блокировки менеджера, поэтому до запуска потоков
+        static void RegisterType() {
+            static const bool registered = SR_UTILS_NS::ResourceManager::Instance().RegisterType<TestResource>();
+            SR_UNUSED_VARIABLE(registered);
+        }
+
+        static TestResource* Create(const std::string& id) {
+            RegisterType();
+
+            auto&& pResource = new TestResource();
+            pResource->SetId(id);
+            return pResource;
+        }
+
+        SR_NODISCARD bool IsFileResource() const noexcept override { return false; }
+
+    };
+}
+
+using namespace SR_TESTS_NS;
+
+/// 100k ресурсов регистрируются, освобождаются и собираются GC. Старые ссылки после сборки не должны разрешаться,
+/// а ресурсы, которые еще используются, должны пережить сборку
+SR_TEST(ResourceManager_StressDestroyQueue) {
+    auto&& resourceManager = SR_UTILS_NS::ResourceManager::Instance();
+
+    constexpr uint32_t count = 100000;
+
+    std::vector<SR_UTILS_NS::ResourceHandle> handles;
+    std::vector<TestResource*> kept;
+    handles.reserve(count);
+
+    for (uint32_t i = 0; i < count; ++i) {
+        /// часть id повторяется, чтобы в группах были копии
+        auto&& pResource = TestResource::Create("stress-" + std::to_string(i % 40000));
+        handles.emplace_back(pResource->GetResourceHandle());
+
+        SR_REQUIRE(pResource->GetResourceHandle().Valid());
+
+        pResource->AddUsePoint();
+
+        if (i % 1000 == 0) {
+            kept.emplace_back(pResource);
+            continue;
+        }
+
+        pResource->RemoveUsePoint();
+        pResource->SetLifetime(0);
+    }
+
+    /// поток менеджера собирает очередь параллельно с регистрацией
+    SR_CHECK(resourceManager.GetDestroyQueueSize() <= static_cast<uint64_t>(count - kept.size()));
+
+    resourceManager.Synchronize(true);
+
+    SR_CHECK_EQ(resourceManager.GetDestroyQueueSize(), 0u);
+
+    uint32_t resolved = 0;
+
+    for (uint32_t i = 0; i < count; ++i) {
+        if (auto&& pResource = resourceManager.Resolve<TestResource>(handles[i])) {
+            SR_CHECK(i % 1000 == 0);
+            SR_CHECK(pResource == kept[i / 1000]);
+            SR_CHECK_EQ(pResource->GetCountUses(), 2u);
+            pResource->RemoveUsePoint();
+            ++resolved;
+        }
+    }
+
+    SR_CHECK_EQ(resolved, static_cast<uint32_t>(kept.size()));
+
+    /// освобожденные слоты переиспользуются, но со следующим поколением
+    auto&& pReused = TestResource::Create("stress-reused");
+    auto&& pStaleIt = std::find_if(handles.begin(), handles.end(), [pReused](auto&& handle) {
+        return handle.index == pReused->GetResourceHandle().index;
+    });
+    SR_REQUIRE(pStaleIt != handles.end());
+    SR_CHECK(*pStaleIt != pReused->GetResourceHandle());
+    SR_CHECK(resourceManager.Resolve(*pStaleIt) == nullptr);
+    pReused->AddUsePoint();
+    pReused->RemoveUsePoint();
+
+    for (auto&& pResource : kept) {
+        pResource->RemoveUsePoint();
+    }
+
+    resourceManager.Synchronize(true);
+
+    SR_CHECK_EQ(resourceManager.GetDestroyQueueSize(), 0u);
+
+    for (auto&& handle : handles) {
+        SR_CHECK(resourceManager.Resolve(handle) == nullptr);
+    }
+}
+
+/// Уничтоженный, но еще не собранный ресурс по ссылке не отдается
+SR_TEST(ResourceManager_ResolveDestroyed) {
+    auto&& resourceManager = SR_UTILS_NS::ResourceManager::Instance();
+
+    auto&& pResource = TestResource::Create("resolve-destroyed");
+    auto&& handle = pResource->GetResourceHandle();
+
+    pResource->AddUsePoint();
+
+    auto&& pResolved = resourceManager.Resolve<TestResource>(handle);
+    SR_REQUIRE(pResolved == pResource);
+    SR_CHECK_EQ(pResource->GetCountUses(), 2u);
+    pResolved->RemoveUsePoint();
+
+    pResource->RemoveUsePoint();
+    SR_CHECK(pResource->IsDestroyed());
+    SR_CHECK(resourceManager.Resolve(handle) == nullptr);
+
+    resourceManager.Synchronize(true);
+
+    SR_CHECK(resourceManager.Resolve(handle) == nullptr);
+}
+
+/// Для запуска под -fsanitize=thread (SR_TSAN). Поиск через шарды реестра и разрешение ссылок идут параллельно
+/// с регистрацией, освобождением и сборкой ресурсов в потоке менеджера
+SR_TEST(ResourceManager_ConcurrentFindStress) {
+    auto&& resourceManager = SR_UTILS_NS::ResourceManager::Instance();
+
+    constexpr uint32_t resources = 20000;
+    constexpr uint32_t finders = 8;
+    constexpr uint32_t ids = 16;
+
+    std::array<std::atomic<SR_UTILS_NS::ResourceHandle>, 64> published;
+    for (auto&& handle : published) {
+        handle = SR_UTILS_NS::ResourceHandle();
+    }
+
+    TestResource::RegisterType();
+
+    std::atomic<bool> isDone = false;
+    std::atomic<uint64_t> found = 0;
+    std::atomic<uint64_t> resolved = 0;
+    std::atomic<uint64_t> mismatches = 0;
+
+    std::vector<std::thread> threads;
+
+    for (uint32_t i = 0; i < finders; ++i) {
+        threads.emplace_back([&, i]() {
+            std::mt19937 random(i);
+
+            while (!isDone) {
+                /// указатель из Find разыменовывать нельзя: его защищает только время жизни, а тест его обнуляет
+                if (resourceManager.Find<TestResource>("concurrent-" + std::to_string(random() % ids))) {
+                    ++found;
+                }
+
+                auto&& handle = published[random() % published.size()].load();
+                if (auto&& pResource = resourceManager.Resolve<TestResource>(handle)) {
+                    if (pResource->GetResourceHandle() != handle) {
+                        ++mismatches;
+                    }
+                    pResource->RemoveUsePoint();
+                    ++resolved;
+                }
+            }
+        });
+    }
+
+    /// последние ресурсы держим живыми, чтобы потокам было что найти
+    std::deque<TestResource*> alive;
+
+    auto&& release = [&alive]() {
+        /// копий с одним id много, поэтому GC освобождает их сразу после уничтожения
+        alive.front()->SetLifetime(0);
+        alive.front()->RemoveUsePoint();
+        alive.pop_front();
+    };
+
+    for (uint32_t i = 0; i < resources; ++i) {
+        auto&& pResource = TestResource::Create("concurrent-" + std::to_string(i % ids));
+        pResource->AddUsePoint();
+        published[i % published.size()] = pResource->GetResourceHandle();
+        alive.emplace_back(pResource);
+
+        if (alive.size() > 32) {
+            release();
+        }
+    }
+
+    while (!alive.empty()) {
+        release();
+    }
+
+    isDone = true;
+
+    for (auto&& thread : threads) {
+        thread.join();
+    }
+
+    resourceManager.Synchronize(true);
+
+    SR_CHECK_EQ(mismatches.load(), 0u);
+    SR_CHECK_EQ(resourceManager.GetDestroyQueueSize(), 0u);
+    SR_CHECK(found > 0);
+    SR_CHECK(resolved > 0);
+
+    for (auto&& handle : published) {
+        SR_CHECK(resourceManager.Resolve(handle.load()) == nullptr);
+    }
+}
@@ -0,0 +1,86 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Test.h>
+
+#include <Utils/Platform/Platform.h>
+#include <Utils/Debug.h>
+
+namespace SR_TESTS_NS {
+    void TestContext::Fail(const char* file, int32_t line, const std::string& message) {
+        ++m_failures;
+        std::cerr << "\t" << file << ":" << line << ": check failed: " << message << std::endl;
+    }
+
+    TestRegistry& TestRegistry::Instance() {
+        static TestRegistry registry;
+        return registry;
+    }
+
+    bool TestRegistry::Register(std::string name, TestFn function) {
+        m_entries.emplace_back(Entry { std::move(name), std::move(function) });
+        return true;
+    }
+
+    uint32_t TestRegistry::Run(const std::string& filter) const {
+        uint32_t failed = 0;
+        uint32_t executed = 0;
+
+        for (auto&& entry : m_entries) {
+            if (!filter.empty() && entry.name.find(filter) == std::string::npos) {
+                continue;
+            }
+
+            std::cerr << "Running " << entry.name << "..." << std::endl;
+
+            TestContext context;
+            const auto begin = std::chrono::steady_clock::now();
+            entry.function(context);
+            const auto elapsed = std::chrono::duration<double_t, std::milli>(std::chrono::steady_clock::now() - begin).count();
+
+            ++executed;
+
+            if (context.GetFailures() > 0) {
+                ++failed;
+                std::cerr << "\tFAILED (" << context.GetFailures() << " checks, " << elapsed << " ms)" << std::endl;
+            }
+            else {
+                std::cerr << "\tOK (" << elapsed << " ms)" << std::endl;
+            }
+        }
+
+        std::cerr << executed - failed << "/" << executed << " tests passed" << std::endl;
+
+        return failed;
+    }
+
+    namespace {
+        SR_UTILS_NS::Path GetLogPath() {
+            return SR_PLATFORM_NS::GetApplicationPath().GetFolder().Concat("log.txt");
+        }
+
+        uint64_t GetLogSize() {
+            SR_UTILS_NS::Debug::Instance().Flush();
+            std::ifstream file(GetLogPath().ToString(), std::ios::binary | std::ios::ate);
+            return file.is_open() ? static_cast<uint64_t>(file.tellg()) : 0;
+        }
+    }
+
+    LogCapture::LogCapture()
+        : m_offset(GetLogSize())
+    { }
+
+    std::string LogCapture::GetText() const {
+        SR_UTILS_NS::Debug::Instance().Flush();
+
+        std::ifstream file(GetLogPath().ToString(), std::ios::binary);
+        if (!file.is_open()) {
+            return std::string();
+        }
+
+        file.seekg(static_cast<std::streamoff>(m_offset));
+
+        return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+}
@@ -0,0 +1,89 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#ifndef SRENGINE_TEST_H
+#define SRENGINE_TEST_H
+
+#include <Utils/Common/NonCopyable.h>
+#include <Utils/Common/StringFormat.h>
+#include <Utils/Types/Function.h>
+
+#define SR_TESTS_NS SpaRcle::Tests
+
+namespace SR_TESTS_NS {
+    /// Состояние одного теста. Проверки не прерывают тест, кроме SR_REQUIRE
+    class TestContext : public SR_UTILS_NS::NonCopyable {
+    public:
+        void Fail(const char* file, int32_t line, const std::string& message);
+
+        SR_NODISCARD uint32_t GetFailures() const noexcept { return m_failures; }
+
+    private:
+        uint32_t m_failures = 0;
+
+    };
+
+    using TestFn = SR_HTYPES_NS::Function<void(TestContext& context)>;
+
+    class TestRegistry : public SR_UTILS_NS::NonCopyable {
+        struct Entry {
+            std::string name;
+            TestFn function;
+        };
+    public:
+        static TestRegistry& Instance();
+
+        bool Register(std::string name, TestFn function);
+
+        /// Выполняет все тесты, имя которых содержит filter, возвращает число упавших
+        SR_NODISCARD uint32_t Run(const std::string& filter) const;
+
+    private:
+        std::vector<Entry> m_entries;
+
+    };
+
+    /// Все записи Debug, сделанные с момента создания объекта. Нужен инициализированный Debug с файлом лога
+    class LogCapture : public SR_UTILS_NS::NonCopyable {
+    public:
+        LogCapture();
+
+    public:
+        SR_NODISCARD std::string GetText() const;
+
+    private:
+        uint64_t m_offset = 0;
+
+    };
+}
+
+#define SR_TEST(name)                                                                                                 \
+    static void SR_MACRO_CONCAT(SRTest_, name)(SR_TESTS_NS::TestContext& context);                                   \
+    static const bool SR_MACRO_CONCAT(SRTestRegistered_, name) = SR_TESTS_NS::TestRegistry::Instance().Register(     \
+        #name, &SR_MACRO_CONCAT(SRTest_, name)                                                                        \
+    );                                                                                                               \
+    static void SR_MACRO_CONCAT(SRTest_, name)(SR_TESTS_NS::TestContext& context)
+
+#define SR_CHECK(expr)                                                                                                \
+    do { if (!(expr)) { context.Fail(__FILE__, __LINE__, #expr); } } while (false)
+
+#define SR_CHECK_EQ(a, b)                                                                                             \
+    do {                                                                                                             \
+        if (!((a) == (b))) {                                                                                         \
+            context.Fail(__FILE__, __LINE__, SR_FORMAT("{} == {} ({} != {})", #a, #b, (a), (b)));                    \
+        }                                                                                                            \
+    } while (false)
+
+#define SR_CHECK_NEAR(a, b, epsilon)                                                                                  \
+    do {                                                                                                             \
+        if (!(std::abs(static_cast<double_t>(a) - static_cast<double_t>(b)) <= static_cast<double_t>(epsilon))) {    \
+            context.Fail(__FILE__, __LINE__, SR_FORMAT("{} ~ {} ({} != {})", #a, #b, (a), (b)));                     \
+        }                                                                                                            \
+    } while (false)
+
+/// Прерывает тест, если дальше проверять бессмысленно
+#define SR_REQUIRE(expr)                                                                                              \
+    do { if (!(expr)) { context.Fail(__FILE__, __LINE__, #expr); return; } } while (false)
+
+#endif //SRENGINE_TEST_H
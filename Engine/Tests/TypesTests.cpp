@@ -0,0 +1,307 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Test.h>
+
+#include <Utils/Types/SharedPtr.h>
+#include <Utils/Types/IntrusivePtr.h>
+#include <Utils/Types/SPSCQueue.h>
+
+namespace SR_TESTS_NS {
+    /// Считает свои удаления, чтобы проверить, что последняя ссылка освобождается ровно один раз
+    struct CountedObject {
+        explicit CountedObject(std::atomic<uint32_t>* pDestroyed)
+            : pDestroyed(pDestroyed)
+        { }
+
+        ~CountedObject() {
+            ++(*pDestroyed);
+        }
+
+        std::atomic<uint32_t>* pDestroyed = nullptr;
+    };
+
+    struct CountedIntrusiveObject : public SR_HTYPES_NS::IntrusiveRefCounter {
+        explicit CountedIntrusiveObject(std::atomic<uint32_t>* pDestroyed)
+            : pDestroyed(pDestroyed)
+        { }
+
+        ~CountedIntrusiveObject() override {
+            ++(*pDestroyed);
+        }
+
+        std::atomic<uint32_t>* pDestroyed = nullptr;
+    };
+
+    /// Каждый поток получает свою копию, копирует и разрушает ее, затем все потоки отпускают копии одновременно
+    template<typename Ptr> void ReleaseOnThreads(const Ptr& pObject, uint32_t threadsCount, uint32_t copies) {
+        std::atomic<uint32_t> ready = 0;
+        std::vector<std::thread> threads;
+
+        for (uint32_t i = 0; i < threadsCount; ++i) {
+            threads.emplace_back([pCopy = pObject, &ready, threadsCount, copies]() mutable {
+                for (uint32_t j = 0; j < copies; ++j) {
+                    Ptr pLocal = pCopy;
+                    Ptr pMoved = std::move(pLocal);
+                    SR_UNUSED_VARIABLE(pMoved);
+                }
+
+                ++ready;
+                while (ready < threadsCount) {
+                    std::this_thread::yield();
+                }
+
+                pCopy.Reset();
+            });
+        }
+
+        for (auto&& thread : threads) {
+            thread.join();
+        }
+    }
+
+    /// Вторая половина - проверка, что элемент не прочитан наполовину записанным
+    struct SPSCTestItem {
+        uint64_t value = 0;
+        uint64_t check = 0;
+    };
+}
+
+using namespace SR_TESTS_NS;
+
+/// Для запуска под -fsanitize=thread (SR_TSAN). Копии SharedPtr с атомарными счетчиками живут и умирают
+/// на разных потоках, объект удаляется один раз и только после освобождения последней копии
+SR_TEST(SharedPtr_AtomicConcurrentRelease) {
+    constexpr uint32_t rounds = 200;
+
+    for (uint32_t round = 0; round < rounds; ++round) {
+        std::atomic<uint32_t> destroyed = 0;
+
+        SR_HTYPES_NS::SharedPtr<CountedObject> pObject(
+            new CountedObject(&destroyed), SR_UTILS_NS::SharedPtrPolicy::Automatic, SR_UTILS_NS::SharedPtrCounting::Atomic
+        );
+
+        /// последней копией может оказаться любая, в том числе копия главного потока
+        std::thread releaser([pCopy = pObject]() mutable {
+            std::this_thread::yield();
+            pCopy.Reset();
+        });
+
+        ReleaseOnThreads(pObject, 8, 256);
+        releaser.join();
+
+        SR_CHECK_EQ(destroyed.load(), 0u);
+        SR_CHECK_EQ(pObject.GetPtrData()->GetStrongCount(), 1u);
+
+        pObject.Reset();
+
+        SR_REQUIRE(destroyed.load() == 1u);
+    }
+
+    for (uint32_t round = 0; round < rounds; ++round) {
+        std::atomic<uint32_t> destroyed = 0;
+
+        {
+            SR_HTYPES_NS::SharedPtr<CountedObject> pObject(
+                new CountedObject(&destroyed), SR_UTILS_NS::SharedPtrPolicy::Automatic, SR_UTILS_NS::SharedPtrCounting::Atomic
+            );
+
+            std::vector<std::thread> threads;
+            for (uint32_t i = 0; i < 4; ++i) {
+                threads.emplace_back([pCopy = pObject]() mutable {
+                    pCopy.Reset();
+                });
+            }
+
+            pObject.Reset();
+
+            for (auto&& thread : threads) {
+                thread.join();
+            }
+        }
+
+        SR_REQUIRE(destroyed.load() == 1u);
+    }
+}
+
+/// Для запуска под -fsanitize=thread (SR_TSAN). То же для IntrusivePtr, счетчик внутри объекта
+SR_TEST(IntrusivePtr_ConcurrentRelease) {
+    constexpr uint32_t rounds = 200;
+
+    for (uint32_t round = 0; round < rounds; ++round) {
+        std::atomic<uint32_t> destroyed = 0;
+
+        auto&& pObject = SR_HTYPES_NS::IntrusivePtr<CountedIntrusiveObject>::MakeShared(&destroyed);
+
+        ReleaseOnThreads(pObject, 8, 256);
+
+        SR_CHECK_EQ(destroyed.load(), 0u);
+        SR_CHECK_EQ(pObject->GetRefCount(), 1u);
+
+        SR_HTYPES_NS::IntrusivePtr<CountedIntrusiveObject> pLast = std::move(pObject);
+        SR_CHECK(!pObject);
+        pLast.Reset();
+
+        SR_REQUIRE(destroyed.load() == 1u);
+    }
+}
+
+/// Для запуска под -fsanitize=thread (SR_TSAN). Блоки управления выделяются на одном потоке, а освобождаются
+/// на другом, поэтому проходят через общий список пула. Живые блоки не должны совпадать
+SR_TEST(SharedPtrDataPool_CrossThreadFree) {
+    auto&& pool = SR_HTYPES_NS::SharedPtrDataPool::Instance();
+
+    constexpr uint32_t threadsCount = 4;
+    constexpr uint32_t blocks = 4096;
+    constexpr uint32_t rounds = 16;
+
+    std::atomic<uint64_t> duplicates = 0;
+
+    for (uint32_t round = 0; round < rounds; ++round) {
+        std::vector<std::vector<void*>> allocated(threadsCount);
+        std::vector<std::thread> threads;
+
+        for (uint32_t i = 0; i < threadsCount; ++i) {
+            threads.emplace_back([&pool, &allocated, i]() {
+                allocated[i].reserve(blocks);
+                for (uint32_t j = 0; j < blocks; ++j) {
+                    auto&& pBlock = pool.Allocate();
+                    /// пишем в весь блок, чтобы TSAN увидел одновременную запись в один и тот же блок
+                    std::memset(pBlock, static_cast<int>(i), SR_HTYPES_NS::SharedPtrDataPool::BlockSize);
+                    allocated[i].emplace_back(pBlock);
+                }
+            });
+        }
+
+        for (auto&& thread : threads) {
+            thread.join();
+        }
+        threads.clear();
+
+        std::unordered_set<void*> unique;
+        for (auto&& thread : allocated) {
+            for (auto&& pBlock : thread) {
+                if (!unique.insert(pBlock).second) {
+                    ++duplicates;
+                }
+            }
+        }
+
+        /// освобождает соседний поток, блоки уходят в чужой кэш
+        for (uint32_t i = 0; i < threadsCount; ++i) {
+            threads.emplace_back([&pool, &allocated, i]() {
+                for (auto&& pBlock : allocated[(i + 1) % threadsCount]) {
+                    pool.Free(pBlock);
+                }
+            });
+        }
+
+        for (auto&& thread : threads) {
+            thread.join();
+        }
+    }
+
+    SR_CHECK_EQ(duplicates.load(), 0u);
+}
+
+/// Для запуска под -fsanitize=thread (SR_TSAN). Маленькая очередь постоянно переполняется и оборачивается,
+/// читатель чередует Pop и Flush: все элементы доходят по одному разу, по порядку и целиком,
+/// а каждая неудачная запись учтена в GetDroppedCount
+SR_TEST(SPSCQueue_StressOrder) {
+    constexpr uint64_t count = 1000000;
+
+    for (uint64_t capacity : { 2, 7, 64 }) {
+        SR_HTYPES_NS::SPSCQueue<SPSCTestItem> queue(capacity);
+        SR_CHECK_EQ(queue.Capacity(), std::bit_ceil(capacity));
+
+        uint64_t rejected = 0;
+        /// при ошибке читатель останавливается, писатель не должен ждать его вечно
+        std::atomic<bool> stopped = false;
+
+        std::thread producer([&queue, &rejected, &stopped]() {
+            for (uint64_t i = 0; i < count && !stopped; ) {
+                if (queue.Push(SPSCTestItem { i, ~i })) {
+                    ++i;
+                    continue;
+                }
+
+                ++rejected;
+                std::this_thread::yield();
+            }
+        });
+
+        std::mt19937 random(48);
+        uint64_t next = 0;
+        uint64_t errors = 0;
+
+        auto&& consume = [&next, &errors](const SPSCTestItem& item) {
+            errors += (item.value != next || item.check != ~next) ? 1 : 0;
+            next = item.value + 1;
+        };
+
+        while (next < count && errors == 0) {
+            uint64_t read = 0;
+
+            if (random() % 2 == 0) {
+                SPSCTestItem item;
+                if (queue.Pop(item)) {
+                    consume(item);
+                    read = 1;
+                }
+            }
+            else {
+                read = queue.Flush(consume);
+            }
+
+            if (read == 0) {
+                std::this_thread::yield();
+            }
+        }
+
+        stopped = true;
+        producer.join();
+
+        SR_CHECK_EQ(errors, 0u);
+        SR_CHECK_EQ(next, count);
+        SR_CHECK(queue.Empty());
+        SR_CHECK_EQ(queue.GetDroppedCount(), rejected);
+
+        SPSCTestItem item;
+        SR_CHECK(!queue.Pop(item));
+        SR_CHECK_EQ(queue.Flush([](const SPSCTestItem&) { }), 0u);
+    }
+}
+
+/// Переполненная очередь отбрасывает новые элементы и сохраняет старые
+SR_TEST(SPSCQueue_DropOnOverflow) {
+    SR_HTYPES_NS::SPSCQueue<uint64_t> queue(100);
+    SR_REQUIRE(queue.Capacity() == 128);
+
+    for (uint64_t i = 0; i < 200; ++i) {
+        SR_CHECK_EQ(queue.Push(i), i < 128);
+    }
+
+    SR_CHECK_EQ(queue.Size(), 128u);
+    SR_CHECK_EQ(queue.GetDroppedCount(), 72u);
+
+    uint64_t value = 0;
+    SR_REQUIRE(queue.Pop(value));
+    SR_CHECK_EQ(value, 0u);
+
+    /// освободилось одно место
+    SR_CHECK(queue.Push(1000));
+    SR_CHECK(!queue.Push(1001));
+
+    std::vector<uint64_t> values;
+    SR_CHECK_EQ(queue.Flush([&values](uint64_t item) { values.emplace_back(item); }), 128u);
+    SR_REQUIRE(values.size() == 128);
+
+    for (uint64_t i = 0; i < 127; ++i) {
+        SR_CHECK_EQ(values[i], i + 1);
+    }
+    SR_CHECK_EQ(values.back(), 1000u);
+
+    SR_CHECK(queue.Empty());
+    SR_CHECK_EQ(queue.GetDroppedCount(), 73u);
+}
@@ -0,0 +1,2235 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Test.h>
+
+#include <Utils/SRLM/LogicalMachine.h>
+#include <Utils/SRLM/LogicalNodeManager.h>
+#include <Utils/SRLM/LogicalNodes.h>
+#include <Utils/SRLM/DataType.h>
+#include <Utils/Common/HashManager.h>
+#include <Utils/Common/LogQueue.h>
+#include <Utils/FileSystem/BakedMesh.h>
+#include <Utils/Types/RawMesh.h>
+#include <Utils/Common/Features.h>
+#include <Utils/ECS/Migration.h>
+#include <Utils/Events/TypedEventDispatcher.h>
+#include <Utils/Math/SIMD.h>
+#include <Utils/Math/Noise.h>
+#include <Utils/CompiledConfig.h>
+#include <Utils/Input/InputSystem.h>
+#include <Utils/Input/EvdevInputSource.h>
+#include <Utils/Profile/FrameRecorder.h>
+#include <Utils/Common/Numeric.h>
+#include <Utils/Common/Hashes.h>
+#include <Utils/FileSystem/Path.h>
+#include <Utils/ResourceManager/ResourceManager.h>
+#include <Utils/Platform/Platform.h>
+
+#include <assimp/scene.h>
+
+#ifdef SR_LINUX
+    #include <linux/input.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+namespace SR_TESTS_NS {
+    /// Случайный граф из нод, которые умеет компилировать LogicalCompiler.
+    /// Один и тот же сид дает один и тот же граф, поэтому его можно собрать дважды и сравнить исполнители
+    class SRLMGraphGenerator : public SR_UTILS_NS::NonCopyable {
+    public:
+        SRLMGraphGenerator(SR_SRLM_NS::LogicalMachine* pMachine, uint32_t seed)
+            : m_machine(pMachine)
+            , m_random(seed)
+        { }
+
+    public:
+        void Generate() {
+            auto&& pStart = CreateNode("Start");
+            GenerateFlow(pStart, 0, 0);
+            m_machine->Build();
+        }
+
+    private:
+        SR_SRLM_NS::LogicalNode* CreateNode(const std::string& name) {
+            auto&& pNode = SR_SRLM_NS::LogicalNodeManager::Instance().CreateByName(name);
+            pNode->InitNode();
+            pNode->InitValues();
+            m_machine->AddNode(pNode);
+            return pNode;
+        }
+
+        SR_SRLM_NS::LogicalNode* CreateMessage() {
+            const uint32_t id = m_messages++;
+
+            switch (m_random() % 3) {
+                case 0: {
+                    auto&& pConstructor = CreateNode("String");
+                    *pConstructor->GetInputs()[0].pData->GetString() = "srlm-" + std::to_string(id);
+                    return pConstructor;
+                }
+                case 1: {
+                    auto&& pConstructor = CreateNode("Int32");
+                    *pConstructor->GetInputs()[0].pData->GetInt32() = static_cast<int32_t>(id * 1000 + m_random() % 1000) - 500;
+                    auto&& pConvertor = CreateNode("Int32 to String");
+                    m_machine->Link(pConstructor, 0, pConvertor, 0);
+                    return pConvertor;
+                }
+                default: {
+                    auto&& pConstructor = CreateNode("Bool");
+                    *pConstructor->GetInputs()[0].pData->GetBool() = m_random() % 2 == 0;
+                    auto&& pConvertor = CreateNode("Bool to String");
+                    m_machine->Link(pConstructor, 0, pConvertor, 0);
+                    return pConvertor;
+                }
+            }
+        }
+
+        void GenerateFlow(SR_SRLM_NS::LogicalNode* pFrom, uint32_t outputIndex, uint32_t depth) {
+            if (depth > 5) {
+                return;
+            }
+
+            switch (depth == 0 ? 0 : m_random() % 4) {
+                case 0:
+                case 1: {
+                    auto&& pPrint = CreateNode("Debug Print");
+                    m_machine->Link(pFrom, outputIndex, pPrint, 0);
+                    m_machine->Link(CreateMessage(), 0, pPrint, 1);
+                    GenerateFlow(pPrint, 0, depth + 1);
+                    break;
+                }
+                case 2: {
+                    auto&& pSequence = CreateNode("Sequence");
+                    m_machine->Link(pFrom, outputIndex, pSequence, 0);
+                    GenerateFlow(pSequence, 0, depth + 1);
+                    GenerateFlow(pSequence, 1, depth + 1);
+                    break;
+                }
+                default: {
+                    auto&& pBranch = CreateNode("Branch");
+                    auto&& pCondition = CreateNode("Bool");
+                    *pCondition->GetInputs()[0].pData->GetBool() = m_random() % 2 == 0;
+                    m_machine->Link(pFrom, outputIndex, pBranch, 0);
+                    m_machine->Link(pCondition, 0, pBranch, 1);
+                    GenerateFlow(pBranch, 0, depth + 1);
+                    GenerateFlow(pBranch, 1, depth + 1);
+                    break;
+                }
+            }
+        }
+
+    private:
+        SR_SRLM_NS::LogicalMachine* m_machine = nullptr;
+        std::mt19937 m_random;
+        uint32_t m_messages = 0;
+
+    };
+
+    std::string RunSRLMGraph(uint32_t seed, bool useBytecode, bool& isCompiled) {
+        auto&& pMachine = new SR_SRLM_NS::LogicalMachine();
+        pMachine->SetUseBytecode(useBytecode);
+
+        SRLMGraphGenerator(pMachine, seed).Generate();
+        isCompiled = pMachine->IsCompiled();
+
+        LogCapture capture;
+
+        pMachine->Init();
+        for (uint32_t i = 0; i < 4; ++i) {
+            pMachine->UpdateMachine(0.016f);
+        }
+
+        auto&& output = capture.GetText();
+
+        delete pMachine;
+
+        return output;
+    }
+
+    /// Что получил Sink очереди логов: номера записей по потокам в порядке вывода
+    struct LogQueueOutput {
+        std::vector<std::vector<uint64_t>> threads;
+        uint64_t dropped = 0;
+        uint64_t unordered = 0;
+    };
+
+    /// Поток пишет записи с номерами 0..count-1, в type номер потока. Каждая important-я запись важная
+    void PushLogRecords(SR_UTILS_NS::LogQueue& queue, uint32_t threadsCount, uint64_t count, uint64_t important) {
+        std::vector<std::thread> threads;
+
+        for (uint32_t i = 0; i < threadsCount; ++i) {
+            threads.emplace_back([&queue, i, count, important]() {
+                for (uint64_t j = 0; j < count; ++j) {
+                    SR_UTILS_NS::LogRecord record;
+                    record.type = static_cast<uint8_t>(i);
+                    record.message = std::to_string(j);
+                    queue.Push(std::move(record), important != 0 && j % important == 0);
+                }
+            });
+        }
+
+        for (auto&& thread : threads) {
+            thread.join();
+        }
+    }
+
+    SR_UTILS_NS::LogQueue::Sink MakeLogQueueSink(LogQueueOutput& output, uint32_t threadsCount, std::chrono::microseconds delay) {
+        output.threads.resize(threadsCount);
+
+        return [&output, delay](std::vector<SR_UTILS_NS::LogRecord>& records, uint64_t dropped) {
+            for (uint64_t i = 0; i < records.size(); ++i) {
+                if (i > 0 && records[i - 1].sequence >= records[i].sequence) {
+                    ++output.unordered;
+                }
+                output.threads[records[i].type].emplace_back(std::stoull(records[i].message));
+            }
+
+            output.dropped += dropped;
+
+            /// медленный вывод, чтобы буферы переполнялись
+            std::this_thread::sleep_for(delay);
+        };
+    }
+
+    /// Вершины со случайными атрибутами. У вершин со skinned первые веса ненулевые, как их раскладывает RawMesh::GetVertices
+    std::vector<SR_UTILS_NS::Vertex> MakeBakedVertices(std::mt19937& random, uint32_t count, uint32_t bones) {
+        std::uniform_real_distribution<float_t> value(-10.f, 10.f);
+
+        std::vector<SR_UTILS_NS::Vertex> vertices(count);
+
+        for (auto&& vertex : vertices) {
+            vertex.position = SR_UTILS_NS::Vec3 { value(random), value(random), value(random) };
+            vertex.uv = SR_UTILS_NS::Vec2 { value(random), value(random) };
+            vertex.normal = SR_UTILS_NS::Vec3 { value(random), value(random), value(random) };
+            vertex.tangent = SR_UTILS_NS::Vec3 { value(random), value(random), value(random) };
+            vertex.bitangent = SR_UTILS_NS::Vec3 { value(random), value(random), value(random) };
+
+            if (bones == 0) {
+                continue;
+            }
+
+            vertex.weightsNum = static_cast<uint8_t>(1 + random() % SR_MAX_BONES_ON_VERTEX);
+            for (uint8_t i = 0; i < vertex.weightsNum; ++i) {
+                vertex.weights[i].boneId = random() % bones;
+                vertex.weights[i].weight = 1.f / static_cast<float_t>(vertex.weightsNum);
+            }
+        }
+
+        return vertices;
+    }
+
+    bool IsSameBakedVertex(const SR_UTILS_NS::Vertex& lhs, const SR_UTILS_NS::Vertex& rhs) {
+        auto&& isSame = [](auto&& a, auto&& b) {
+            return std::memcmp(&a, &b, sizeof(a)) == 0;
+        };
+
+        if (!isSame(lhs.position, rhs.position) || !isSame(lhs.uv, rhs.uv) || !isSame(lhs.normal, rhs.normal) ||
+            !isSame(lhs.tangent, rhs.tangent) || !isSame(lhs.bitangent, rhs.bitangent) || lhs.weightsNum != rhs.weightsNum
+        ) {
+            return false;
+        }
+
+        for (uint32_t i = 0; i < SR_MAX_BONES_ON_VERTEX; ++i) {
+            if (lhs.weights[i].boneId != rhs.weights[i].boneId || lhs.weights[i].weight != rhs.weights[i].weight) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    std::vector<uint32_t> MakeBakedIndices(std::mt19937& random, uint32_t count, uint32_t vertices) {
+        std::vector<uint32_t> indices(count);
+        for (auto&& index : indices) {
+            index = random() % vertices;
+        }
+        return indices;
+    }
+
+    /// Копия блока, которую можно испортить и снова отдать в BakedMesh::FromBlob
+    std::vector<uint64_t> CopyBakedBlob(const SR_UTILS_NS::BakedMesh& bakedMesh) {
+        std::vector<uint64_t> blob(bakedMesh.GetSize() / sizeof(uint64_t));
+        std::memcpy(blob.data(), bakedMesh.GetData(), bakedMesh.GetSize());
+        return blob;
+    }
+
+    template<typename T> T* GetBakedSection(std::vector<uint64_t>& blob, uint64_t offset) {
+        return reinterpret_cast<T*>(reinterpret_cast<char*>(blob.data()) + offset);
+    }
+
+    /// Модель из двух подмешей (статичный и со скелетом), иерархии из четырех узлов и одной анимации
+    SR_UTILS_NS::BakedMeshBuilder MakeBakedModel(std::mt19937& random,
+        std::vector<std::vector<SR_UTILS_NS::Vertex>>& vertices, std::vector<std::vector<uint32_t>>& indices
+    ) {
+        SR_UTILS_NS::BakedMeshBuilder builder;
+
+        const ska::flat_hash_map<uint64_t, uint32_t> bones = { { SR_HASH_STR("Hips"), 0 }, { SR_HASH_STR("Spine"), 1 }, { SR_HASH_STR("Head"), 2 } };
+
+        vertices = { MakeBakedVertices(random, 300, 0), MakeBakedVertices(random, 200, 3) };
+        indices = { MakeBakedIndices(random, 900, 300), MakeBakedIndices(random, 600, 200) };
+
+        builder.AddSubmesh("Body", vertices[0], indices[0], { });
+        builder.AddSubmesh("Skin", vertices[1], indices[1], bones);
+
+        for (auto&& [hash, index] : bones) {
+            builder.AddSkeletonBone(hash, index, SR_MATH_NS::Matrix4x4::FromTranslate(SR_MATH_NS::FVector3(index, 2.f * index, 0.5f)));
+        }
+
+        builder.AddNode("Root", SR_ID_INVALID, { 0.f, 0.f, 0.f }, { 0.f, 0.f, 0.f }, { 1.f, 1.f, 1.f }, { });
+        builder.AddNode("Body", 0, { 1.f, 2.f, 3.f }, { 0.1f, 0.2f, 0.3f }, { 1.f, 1.f, 1.f }, { 0 });
+        builder.AddNode("Armature", 0, { 0.f, 1.f, 0.f }, { 0.f, 1.5f, 0.f }, { 0.01f, 0.01f, 0.01f }, { 1 });
+        builder.AddNode("Hips", 2, { 0.f, 0.5f, 0.f }, { 0.f, 0.f, 0.f }, { 1.f, 1.f, 1.f }, { });
+
+        builder.SetScaleFactor(100.f);
+
+        builder.AddAnimation("Walk", 48.0, 24.0);
+        builder.AddChannel("Hips", 0, 1,
+            { { 0.0, { 0.f, 0.f, 0.f } }, { 24.0, { 0.f, 1.f, 0.f } } },
+            { { 0.0, 1.f, 0.f, 0.f, 0.f }, { 24.0, 0.f, 1.f, 0.f, 0.f } },
+            { { 0.0, { 1.f, 1.f, 1.f } } }
+        );
+        builder.AddChannel("Spine", 0, 0, { }, { { 12.0, 1.f, 0.f, 0.f, 0.f } }, { });
+
+        return builder;
+    }
+
+    /// Синтетический объект для миграций. v1: id, health; v2: + speed; v3: health удвоено, + имя; v4: без speed
+    static constexpr uint16_t MIGRATION_TEST_VERSION = 4;
+    /// Модели из Resources: статичные obj, иерархии fbx и dae, скелет и анимация. Второе поле - RawMeshParams::animation
+    const std::vector<std::pair<std::string, bool>> BAKED_TEST_MODELS = {
+        { "Engine/Models/cube.obj", false },
+        { "Engine/Models/sphere.obj", false },
+        { "Engine/Models/gizmo-translation.fbx", false },
+        { "Engine/Models/terrain_simple.dae", false },
+        { "Samples/Liza/Liza.fbx", false },
+        { "Samples/Liza/Walking.fbx", true },
+    };
+
+    bool IsSameVec3(const SR_UTILS_NS::Vec3& baked, const aiVector3D& source) {
+        return baked.x == source.x && baked.y == source.y && baked.z == source.z;
+    }
+
+    /// Прямой обход, в таком же порядке узлы складывает RawMesh::BakeNode
+    void CollectAssimpNodes(const aiNode* pNode, std::vector<const aiNode*>& nodes) {
+        nodes.emplace_back(pNode);
+
+        for (uint32_t i = 0; i < pNode->mNumChildren; ++i) {
+            CollectAssimpNodes(pNode->mChildren[i], nodes);
+        }
+    }
+
+    /// Вершины, веса, индексы и кости подмеша против aiMesh. Несовпадения считаются, чтобы не засыпать лог
+    void CheckBakedSubmesh(TestContext& context, SR_HTYPES_NS::RawMesh* pRawMesh, const aiMesh* pMesh, uint32_t meshId) {
+        auto&& vertices = pRawMesh->GetVertices(meshId);
+        auto&& bones = pRawMesh->GetBones(meshId);
+
+        SR_REQUIRE(vertices.size() == pMesh->mNumVertices);
+        SR_CHECK_EQ(bones.size(), static_cast<size_t>(pMesh->mNumBones));
+
+        /// веса раскладываются по костям в том же порядке, что и в RawMesh::GetVertices
+        std::vector<std::vector<std::pair<uint32_t, float_t>>> weights(pMesh->mNumVertices);
+
+        for (uint32_t i = 0; i < pMesh->mNumBones; ++i) {
+            auto&& pBone = pMesh->mBones[i];
+            auto&& pIt = bones.find(SR_HASH_STR(pBone->mName.C_Str()));
+            SR_REQUIRE(pIt != bones.end());
+
+            for (uint32_t j = 0; j < pBone->mNumWeights; ++j) {
+                weights[pBone->mWeights[j].mVertexId].emplace_back(pIt->second, pBone->mWeights[j].mWeight);
+            }
+        }
+
+        const aiVector3D zero(0.f, 0.f, 0.f);
+
+        uint32_t mismatches = 0;
+
+        for (uint32_t i = 0; i < pMesh->mNumVertices; ++i) {
+            auto&& vertex = vertices[i];
+
+            bool same = IsSameVec3(vertex.position, pMesh->mVertices[i]);
+            same &= IsSameVec3(vertex.normal, pMesh->mNormals ? pMesh->mNormals[i] : zero);
+            same &= IsSameVec3(vertex.tangent, pMesh->mTangents ? pMesh->mTangents[i] : zero);
+            same &= IsSameVec3(vertex.bitangent, pMesh->mTangents ? pMesh->mBitangents[i] : zero);
+
+            if (pMesh->mTextureCoords[0]) {
+                same &= vertex.uv.x == pMesh->mTextureCoords[0][i].x && vertex.uv.y == pMesh->mTextureCoords[0][i].y;
+            }
+            else {
+                same &= vertex.uv.x == 0.f && vertex.uv.y == 0.f;
+            }
+
+            /// в запеченной модели хранится не больше SR_MAX_BONES_ON_VERTEX весов, нулевые не считаются
+            uint32_t weightsNum = 0;
+
+            for (uint32_t j = 0; j < weights[i].size() && j < SR_MAX_BONES_ON_VERTEX; ++j) {
+                same &= vertex.weights[j].boneId == weights[i][j].first && vertex.weights[j].weight == weights[i][j].second;
+                weightsNum += weights[i][j].second > 0.f ? 1 : 0;
+            }
+
+            same &= vertex.weightsNum == weightsNum;
+
+            mismatches += same ? 0 : 1;
+        }
+
+        SR_CHECK_EQ(mismatches, 0u);
+
+        std::vector<uint32_t> indices;
+        for (uint32_t i = 0; i < pMesh->mNumFaces; ++i) {
+            indices.insert(indices.end(), pMesh->mFaces[i].mIndices, pMesh->mFaces[i].mIndices + pMesh->mFaces[i].mNumIndices);
+        }
+
+        SR_CHECK(pRawMesh->GetIndices(meshId) == indices);
+    }
+
+    /// Иерархия узлов: имена, меши, дочерние узлы и разложенная матрица
+    void CheckBakedNodes(TestContext& context, const SR_UTILS_NS::BakedMesh* pBaked, const aiScene* pScene) {
+        std::vector<const aiNode*> nodes;
+        if (pScene->mRootNode) {
+            CollectAssimpNodes(pScene->mRootNode, nodes);
+        }
+
+        SR_REQUIRE(pBaked->GetNodesCount() == nodes.size());
+
+        std::unordered_map<const aiNode*, uint32_t> nodeIndices;
+        for (uint32_t i = 0; i < nodes.size(); ++i) {
+            nodeIndices[nodes[i]] = i;
+        }
+
+        auto&& pIndices = pBaked->GetNodeIndices();
+
+        uint32_t mismatches = 0;
+
+        for (uint32_t i = 0; i < nodes.size(); ++i) {
+            auto&& pNode = nodes[i];
+            auto&& node = pBaked->GetNode(i);
+
+            aiVector3D scaling, rotation, translation;
+            pNode->mTransformation.Decompose(scaling, rotation, translation);
+
+            bool same = pBaked->GetNodeName(i) == std::string_view(pNode->mName.C_Str());
+            same &= IsSameVec3(node.translation, translation) && IsSameVec3(node.rotation, rotation) && IsSameVec3(node.scaling, scaling);
+            same &= node.meshesCount == pNode->mNumMeshes && node.childrenCount == pNode->mNumChildren;
+
+            for (uint32_t j = 0; same && j < pNode->mNumMeshes; ++j) {
+                same &= pIndices[node.meshesOffset + j] == pNode->mMeshes[j];
+            }
+
+            for (uint32_t j = 0; same && j < pNode->mNumChildren; ++j) {
+                same &= pIndices[node.childrenOffset + j] == nodeIndices.at(pNode->mChildren[j]);
+            }
+
+            mismatches += same ? 0 : 1;
+        }
+
+        SR_CHECK_EQ(mismatches, 0u);
+    }
+
+    /// Анимации и каналы: имена, состояния и все ключи
+    void CheckBakedAnimations(TestContext& context, const SR_UTILS_NS::BakedMesh* pBaked, const aiScene* pScene) {
+        SR_REQUIRE(pBaked->GetAnimationsCount() == pScene->mNumAnimations);
+
+        uint32_t mismatches = 0;
+
+        for (uint32_t animationId = 0; animationId < pScene->mNumAnimations; ++animationId) {
+            auto&& pAnimation = pScene->mAnimations[animationId];
+            auto&& animation = pBaked->GetAnimation(animationId);
+
+            SR_CHECK(pBaked->GetString(animation.nameOffset, animation.nameSize) == std::string_view(pAnimation->mName.C_Str()));
+            SR_CHECK_EQ(animation.duration, pAnimation->mDuration);
+            SR_CHECK_EQ(animation.ticksPerSecond, pAnimation->mTicksPerSecond);
+            SR_REQUIRE(animation.channelsCount == pAnimation->mNumChannels);
+
+            for (uint32_t channelId = 0; channelId < pAnimation->mNumChannels; ++channelId) {
+                auto&& pChannel = pAnimation->mChannels[channelId];
+                auto&& channel = pBaked->GetChannel(animation.firstChannel + channelId);
+
+                bool same = pBaked->GetString(channel.nameOffset, channel.nameSize) == std::string_view(pChannel->mNodeName.C_Str());
+                same &= channel.preState == static_cast<uint32_t>(pChannel->mPreState);
+                same &= channel.postState == static_cast<uint32_t>(pChannel->mPostState);
+                same &= channel.positionKeysCount == pChannel->mNumPositionKeys;
+                same &= channel.rotationKeysCount == pChannel->mNumRotationKeys;
+                same &= channel.scalingKeysCount == pChannel->mNumScalingKeys;
+
+                if (!same) {
+                    ++mismatches;
+                    continue;
+                }
+
+                auto&& pPositions = pBaked->GetVectorKeys(channel.positionKeysOffset);
+                for (uint32_t i = 0; i < pChannel->mNumPositionKeys; ++i) {
+                    same &= pPositions[i].time == pChannel->mPositionKeys[i].mTime && IsSameVec3(pPositions[i].value, pChannel->mPositionKeys[i].mValue);
+                }
+
+                auto&& pRotations = pBaked->GetQuatKeys(channel.rotationKeysOffset);
+                for (uint32_t i = 0; i < pChannel->mNumRotationKeys; ++i) {
+                    auto&& key = pChannel->mRotationKeys[i];
+                    same &= pRotations[i].time == key.mTime && pRotations[i].w == key.mValue.w && pRotations[i].x == key.mValue.x &&
+                        pRotations[i].y == key.mValue.y && pRotations[i].z == key.mValue.z;
+                }
+
+                auto&& pScales = pBaked->GetVectorKeys(channel.scalingKeysOffset);
+                for (uint32_t i = 0; i < pChannel->mNumScalingKeys; ++i) {
+                    same &= pScales[i].time == pChannel->mScalingKeys[i].mTime && IsSameVec3(pScales[i].value, pChannel->mScalingKeys[i].mValue);
+                }
+
+                mismatches += same ? 0 : 1;
+            }
+        }
+
+        SR_CHECK_EQ(mismatches, 0u);
+    }
+
+    /// Все, что движок читает из запеченной модели, против свежего импорта того же файла через assimp
+    void CheckRawMeshMatchesAssimp(TestContext& context, SR_HTYPES_NS::RawMesh* pRawMesh) {
+        auto&& pBaked = pRawMesh->GetBakedMesh();
+        SR_REQUIRE(pBaked);
+
+        auto&& pScene = pRawMesh->GetAssimpScene();
+        SR_REQUIRE(pScene);
+
+        SR_REQUIRE(pRawMesh->GetMeshesCount() == pScene->mNumMeshes);
+
+        for (uint32_t meshId = 0; meshId < pScene->mNumMeshes; ++meshId) {
+            SR_CHECK(pRawMesh->GetGeometryName(meshId) == pScene->mMeshes[meshId]->mName.C_Str());
+            CheckBakedSubmesh(context, pRawMesh, pScene->mMeshes[meshId], meshId);
+        }
+
+        float_t scaleFactor = 0.f;
+        if (pScene->mMetaData && pScene->mMetaData->Get("UnitScaleFactor", scaleFactor)) {
+            SR_CHECK(pBaked->GetScaleFactor() == std::optional<float_t>(scaleFactor));
+        }
+        else {
+            SR_CHECK(!pBaked->GetScaleFactor().has_value());
+        }
+
+        CheckBakedNodes(context, pBaked, pScene);
+        CheckBakedAnimations(context, pBaked, pScene);
+    }
+
+    static constexpr uint32_t MIGRATION_TEST_MARKER = 0xC0FFEE;
+
+    /// Самый большой результат одного мигратора, в старой схеме каждый шаг копировал весь буфер
+    std::atomic<uint64_t> gMigrationTestMaxOutput = 0;
+
+    void TrackMigrationOutput(const SR_HTYPES_NS::Marshal& migrated) {
+        uint64_t current = gMigrationTestMaxOutput.load();
+        while (migrated.Size() > current && !gMigrationTestMaxOutput.compare_exchange_weak(current, migrated.Size())) { }
+    }
+
+    void RegisterTestMigrators(uint64_t hashName) {
+        auto&& migration = SR_UTILS_NS::Migration::Instance();
+
+        migration.RegisterMigrator(hashName, 1, 2, [](SR_HTYPES_NS::Marshal& marshal, SR_HTYPES_NS::Marshal& migrated) -> bool {
+            const auto id = marshal.Read<int32_t>();
+            migrated.Write<int32_t>(id);
+            migrated.Write<int32_t>(marshal.Read<int32_t>());
+            migrated.Write<float_t>(static_cast<float_t>(id) * 0.5f);
+            TrackMigrationOutput(migrated);
+            return true;
+        });
+
+        migration.RegisterMigrator(hashName, 2, 3, [](SR_HTYPES_NS::Marshal& marshal, SR_HTYPES_NS::Marshal& migrated) -> bool {
+            const auto id = marshal.Read<int32_t>();
+            migrated.Write<int32_t>(id);
+            migrated.Write<int32_t>(marshal.Read<int32_t>() * 2);
+            migrated.Write<float_t>(marshal.Read<float_t>());
+            migrated.Write<std::string>("Unit_" + std::to_string(id));
+            TrackMigrationOutput(migrated);
+            return true;
+        });
+
+        migration.RegisterMigrator(hashName, 3, 4, [](SR_HTYPES_NS::Marshal& marshal, SR_HTYPES_NS::Marshal& migrated) -> bool {
+            migrated.Write<int32_t>(marshal.Read<int32_t>());
+            migrated.Write<int32_t>(marshal.Read<int32_t>());
+            SR_UNUSED_VARIABLE(marshal.Read<float_t>());
+            migrated.Write<std::string>(marshal.Read<std::string>());
+            TrackMigrationOutput(migrated);
+            return true;
+        });
+    }
+
+    /// Объект с номером id в представлении версии version, как его записала бы та версия
+    void WriteVersionedObject(SR_HTYPES_NS::Marshal& marshal, uint16_t version, int32_t id) {
+        const int32_t health = id % 100;
+
+        marshal.Write<uint16_t>(version);
+        marshal.Write<int32_t>(id);
+        marshal.Write<int32_t>(version >= 3 ? health * 2 : health);
+
+        if (version == 2 || version == 3) {
+            marshal.Write<float_t>(static_cast<float_t>(id) * 0.5f);
+        }
+
+        if (version >= 3) {
+            marshal.Write<std::string>("Unit_" + std::to_string(id));
+        }
+
+        marshal.Write<uint32_t>(MIGRATION_TEST_MARKER);
+    }
+
+    /// Читает все объекты, мигрируя их до последней версии прямо в буфере, и возвращает число смен буфера
+    uint32_t ReadVersionedObjects(uint64_t hashName, SR_HTYPES_NS::Marshal& marshal, uint32_t count, uint32_t& errors) {
+        uint32_t reallocations = 0;
+
+        for (uint32_t i = 0; i < count; ++i) {
+            const auto version = marshal.Read<uint16_t>();
+            auto&& pView = marshal.Stream::View();
+
+            if (!SR_UTILS_NS::Migration::Instance().Migrate(hashName, marshal, version, MIGRATION_TEST_VERSION)) {
+                ++errors;
+                return reallocations;
+            }
+
+            if (pView != marshal.Stream::View()) {
+                ++reallocations;
+            }
+
+            const auto id = marshal.Read<int32_t>();
+            const auto health = marshal.Read<int32_t>();
+            const auto name = marshal.Read<std::string>();
+
+            if (id != static_cast<int32_t>(i) || health != (id % 100) * 2 || name != "Unit_" + std::to_string(id) ||
+                marshal.Read<uint32_t>() != MIGRATION_TEST_MARKER
+            ) {
+                ++errors;
+            }
+        }
+
+        return reallocations;
+    }
+
+    struct DispatchTestEvent {
+        uint32_t value = 0;
+    };
+
+    struct DispatchTestOtherEvent {
+        int32_t value = 0;
+    };
+
+    using TestEventDispatcher = SR_UTILS_NS::TypedEventDispatcher<DispatchTestEvent, DispatchTestOtherEvent>;
+
+    static_assert(TestEventDispatcher::EVENT_ID<DispatchTestEvent> == 0);
+    static_assert(TestEventDispatcher::EVENT_ID<DispatchTestOtherEvent> == 1);
+
+    struct DispatchModel;
+
+    struct DispatchModelListener {
+        DispatchModel* pModel = nullptr;
+        SR_UTILS_NS::EventListenerId id = 0;
+    };
+
+    /// Модель рассылки: слушатель из снимка на ее начало вызывается, если его не отписали раньше, чем до него
+    /// дошла очередь. Обработчики случайно подписывают новых слушателей и отписывают любых, в том числе себя
+    struct DispatchModel {
+        TestEventDispatcher dispatcher;
+        std::mt19937 random { 44 };
+
+        std::deque<DispatchModelListener> listeners;
+        std::vector<SR_UTILS_NS::EventListenerId> active;
+
+        std::vector<SR_UTILS_NS::EventListenerId> snapshot;
+        std::vector<SR_UTILS_NS::EventListenerId> calls;
+        std::unordered_map<SR_UTILS_NS::EventListenerId, uint64_t> removedAt;
+        uint64_t progress = 0;
+
+        static void OnEvent(void* pData, const DispatchTestEvent& event) {
+            auto&& listener = *static_cast<DispatchModelListener*>(pData);
+            listener.pModel->OnEvent(listener, event);
+        }
+
+        void Subscribe() {
+            auto&& listener = listeners.emplace_back();
+            listener.pModel = this;
+            listener.id = dispatcher.Subscribe<DispatchTestEvent>(&listener, &DispatchModel::OnEvent);
+            active.emplace_back(listener.id);
+        }
+
+        void Unsubscribe(SR_UTILS_NS::EventListenerId id) {
+            if (dispatcher.Unsubscribe<DispatchTestEvent>(id)) {
+                removedAt[id] = progress;
+                active.erase(std::find(active.begin(), active.end(), id));
+            }
+        }
+
+        void OnEvent(const DispatchModelListener& listener, const DispatchTestEvent& event) {
+            calls.emplace_back(listener.id);
+            progress = std::find(snapshot.begin(), snapshot.end(), listener.id) - snapshot.begin();
+
+            switch (random() % 4) {
+                case 0:
+                    Subscribe();
+                    break;
+                case 1:
+                    Unsubscribe(active[random() % active.size()]);
+                    break;
+                case 2:
+                    /// отписка уже отписанного ничего не меняет
+                    SR_UNUSED_VARIABLE(dispatcher.Unsubscribe<DispatchTestEvent>(listener.id + 1000000));
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        SR_NODISCARD std::vector<SR_UTILS_NS::EventListenerId> Expected() const {
+            std::vector<SR_UTILS_NS::EventListenerId> expected;
+            for (uint64_t i = 0; i < snapshot.size(); ++i) {
+                auto&& pIt = removedAt.find(snapshot[i]);
+                if (pIt == removedAt.end() || pIt->second >= i) {
+                    expected.emplace_back(snapshot[i]);
+                }
+            }
+            return expected;
+        }
+    };
+
+    /// Случайные данные для пакетных ядер: длина не кратна ни 4, ни 8, чтобы проверялись и хвосты
+    struct SIMDTestBatch {
+        std::vector<SR_MATH_NS::FVector3> translations;
+        std::vector<SR_MATH_NS::Quaternion> rotations;
+        std::vector<SR_MATH_NS::Quaternion> targetRotations;
+        std::vector<SR_MATH_NS::FVector3> scales;
+        std::vector<float_t> factors;
+        std::vector<SR_MATH_NS::Matrix4x4> matrices;
+        std::vector<SR_MATH_NS::Matrix4x4> locals;
+        std::vector<SR_MATH_NS::AABB> bounds;
+        std::vector<SR_MATH_NS::Sphere> spheres;
+        std::vector<SR_MATH_NS::Plane> planes;
+    };
+
+    SR_MATH_NS::Quaternion MakeSIMDTestQuaternion(std::mt19937& random) {
+        std::uniform_real_distribution<float_t> axis(-1.f, 1.f);
+
+        SR_MATH_NS::Quaternion quaternion(axis(random), axis(random), axis(random), axis(random));
+        if (quaternion.self.x * quaternion.self.x + quaternion.self.y * quaternion.self.y + quaternion.self.z * quaternion.self.z + quaternion.self.w * quaternion.self.w < 0.01f) {
+            return SR_MATH_NS::Quaternion::Identity();
+        }
+
+        return quaternion.Normalize();
+    }
+
+    SIMDTestBatch MakeSIMDTestBatch(std::mt19937& random, uint32_t count) {
+        std::uniform_real_distribution<float_t> position(-100.f, 100.f);
+        std::uniform_real_distribution<float_t> scale(0.1f, 4.f);
+        std::uniform_real_distribution<float_t> unit(0.f, 1.f);
+
+        SIMDTestBatch batch;
+
+        for (uint32_t i = 0; i < count; ++i) {
+            batch.translations.emplace_back(position(random), position(random), position(random));
+            batch.rotations.emplace_back(MakeSIMDTestQuaternion(random));
+            batch.scales.emplace_back(scale(random), scale(random), scale(random));
+            batch.factors.emplace_back(unit(random));
+
+            /// часть пар почти совпадает (линейная ветка) или лежит в разных полусферах (короткий путь)
+            switch (i % 4) {
+                case 0: batch.targetRotations.emplace_back(batch.rotations.back()); break;
+                case 1: batch.targetRotations.emplace_back(-batch.rotations.back()); break;
+                default: batch.targetRotations.emplace_back(MakeSIMDTestQuaternion(random)); break;
+            }
+
+            batch.matrices.emplace_back(batch.translations.back(), batch.rotations.back(), batch.scales.back());
+            batch.locals.emplace_back(SR_MATH_NS::FVector3(position(random), position(random), position(random)) * 0.1f, MakeSIMDTestQuaternion(random), SR_MATH_NS::FVector3(scale(random)));
+
+            const SR_MATH_NS::FVector3 center(position(random), position(random), position(random));
+            const SR_MATH_NS::FVector3 extents(scale(random), scale(random), scale(random));
+            batch.bounds.emplace_back(SR_MATH_NS::AABB { center - extents, center + extents });
+
+            SR_MATH_NS::Sphere sphere;
+            sphere.center = center;
+            sphere.radius = scale(random) * 5.f;
+            batch.spheres.emplace_back(sphere);
+        }
+
+        /// куб [-50, 50] со всех сторон
+        for (uint32_t axis = 0; axis < 3; ++axis) {
+            for (float_t sign : { 1.f, -1.f }) {
+                SR_MATH_NS::Plane plane;
+                plane.normal = SR_MATH_NS::FVector3(0.f);
+                plane.normal[axis] = sign;
+                plane.distance = 50.f;
+                batch.planes.emplace_back(plane);
+            }
+        }
+
+        return batch;
+    }
+
+    float_t GetMaxDifference(const float_t* pLeft, const float_t* pRight, uint64_t count) {
+        float_t difference = 0.f;
+        for (uint64_t i = 0; i < count; ++i) {
+            difference = std::max(difference, std::abs(pLeft[i] - pRight[i]));
+        }
+        return difference;
+    }
+
+    template<typename T> float_t GetMaxDifference(const std::vector<T>& left, const std::vector<T>& right) {
+        static_assert(sizeof(T) % sizeof(float_t) == 0);
+        return GetMaxDifference(reinterpret_cast<const float_t*>(left.data()), reinterpret_cast<const float_t*>(right.data()), left.size() * sizeof(T) / sizeof(float_t));
+    }
+
+    /// q и -q - один поворот
+    float_t GetMaxRotationDifference(const std::vector<SR_MATH_NS::Quaternion>& left, const std::vector<SR_MATH_NS::Quaternion>& right) {
+        float_t difference = 0.f;
+        for (uint64_t i = 0; i < left.size(); ++i) {
+            const float_t dot = left[i].self.x * right[i].self.x + left[i].self.y * right[i].self.y + left[i].self.z * right[i].self.z + left[i].self.w * right[i].self.w;
+            difference = std::max(difference, 1.f - std::abs(dot));
+        }
+        return difference;
+    }
+
+    /// Допуск пакетного шума из Noise.h: 1e-5 * amplitude на каждую октаву
+    double_t GetNoiseTolerance(const SR_MATH_NS::NoiseParams& params) {
+        double_t tolerance = 0.0;
+        double_t amplitude = params.amplitude;
+
+        for (uint32_t octave = 0; octave < params.octaves; ++octave) {
+            tolerance += 1e-5 * std::abs(amplitude);
+            amplitude *= params.gain;
+        }
+
+        return tolerance;
+    }
+
+    double_t GetMaxNoiseDifference(const SR_MATH_NS::NoiseGrid& grid, const SR_MATH_NS::NoiseParams& params, const std::vector<float_t>& values, bool is3D) {
+        double_t difference = 0.0;
+
+        for (uint32_t z = 0; z < (is3D ? grid.sizeZ : 1); ++z) {
+            for (uint32_t y = 0; y < grid.sizeY; ++y) {
+                for (uint32_t x = 0; x < grid.sizeX; ++x) {
+                    const double_t pointX = grid.originX + x * grid.step;
+                    const double_t pointY = grid.originY + y * grid.step;
+                    const double_t pointZ = grid.originZ + z * grid.step;
+
+                    const double_t expected = is3D ? SR_MATH_NS::FractalNoise(pointX, pointY, pointZ, params) : SR_MATH_NS::FractalNoise(pointX, pointY, params);
+                    difference = std::max(difference, std::abs(expected - values[(static_cast<uint64_t>(z) * grid.sizeY + y) * grid.sizeX + x]));
+                }
+            }
+        }
+
+        return difference;
+    }
+
+    /**
+     * Все, что загрузчики настроек могут прочитать из узла: имя, каждый атрибут всеми преобразованиями,
+     * отсутствующий атрибут, дети по порядку и по имени. Имена атрибутов берутся из скомпилированного конфига,
+     * у Xml::Node нет обхода атрибутов
+     */
+    void WriteConfigTranscript(const SR_XML_NS::Node& node, const SR_XML_NS::CompiledConfig& config, uint32_t id, std::vector<std::string>& transcript) {
+        transcript.emplace_back("N:" + node.Name() + "|" + std::string(node.NameView()));
+
+        auto&& compiled = config.GetNode(id);
+
+        for (uint32_t i = compiled.firstAttribute; i < compiled.firstAttribute + compiled.attributesCount; ++i) {
+            const std::string name(config.GetString(config.GetAttribute(i).name));
+            auto&& attribute = node.GetAttribute(name);
+
+            transcript.emplace_back(SR_FORMAT("A:{}={}|{}|{}|{}|{}|{}|{}|{}|{}", name, attribute.ToString(), attribute.ToInt(), attribute.ToUInt(),
+                attribute.ToInt64(), attribute.ToUInt64(), attribute.ToFloat(), attribute.ToDouble(), attribute.ToBool(), node.HasAttribute(name)));
+        }
+
+        transcript.emplace_back(SR_FORMAT("M:{}|{}", node.HasAttribute("__Missing"), node.TryGetAttribute("__Missing").ToInt(42)));
+
+        auto&& children = node.GetNodes();
+        transcript.emplace_back("C:" + std::to_string(children.size()));
+
+        for (uint32_t i = 0; i < children.size(); ++i) {
+            if (config.GetNode(compiled.firstChild + i).type == pugi::node_element) {
+                auto&& name = children[i].Name();
+                transcript.emplace_back(SR_FORMAT("B:{}|{}|{}", name, node.GetNodes(name).size(), node.TryGetNode(name).Valid()));
+            }
+
+            WriteConfigTranscript(children[i], config, compiled.firstChild + i, transcript);
+        }
+    }
+
+    void WriteTextFile(const SR_UTILS_NS::Path& path, const std::string& text) {
+        std::ofstream file(path.ToString(), std::ios::binary | std::ios::trunc);
+        file << text;
+    }
+
+    /// Клавиатура, состояние которой задает тест, как на платформах без событийного ввода
+    class ScriptedKeyboardSource : public SR_UTILS_NS::PolledInputSource {
+    public:
+        SR_NODISCARD std::string_view GetName() const override { return "ScriptedKeyboard"; }
+
+        void SetKey(SR_UTILS_NS::KeyCode key, bool pressed) { m_keys[static_cast<uint8_t>(key)] = pressed ? 0x80 : 0; }
+
+    protected:
+        bool ReadKeyboardState(uint8_t* pKeys) override {
+            std::memcpy(pKeys, m_keys, sizeof(m_keys));
+            return true;
+        }
+
+    private:
+        uint8_t m_keys[256] = { };
+
+    };
+
+    /**
+     * Кадры по схеме Engine::Frame: dt, накопитель фиксированных шагов, ввод в каждом шаге и контрольная сумма в конце.
+     * В сценарии источники получают нажатия, окно на время теряет фокус, а dt дрожит от jitterSeed.
+     * Вне сценария источники получают другой ввод, который при воспроизведении должен быть отброшен
+     */
+    std::vector<uint64_t> RunRecorderSession(SR_UTILS_NS::SyntheticInputSource* pEvents, ScriptedKeyboardSource* pKeyboard,
+        bool isScenario, uint32_t jitterSeed, uint32_t framesCount)
+    {
+        using SR_UTILS_NS::KeyCode;
+
+        auto&& recorder = SR_UTILS_NS::FrameRecorder::Instance();
+        auto&& input = SR_UTILS_NS::Input::Instance();
+
+        std::mt19937 jitter(jitterSeed);
+
+        double_t position = 0.0;
+        uint64_t hits = 0;
+        float_t accumulator = 0.f;
+
+        std::vector<uint64_t> checksums;
+
+        for (uint32_t frame = 0; frame < framesCount; ++frame) {
+            if (isScenario) {
+                if (frame == 10) { pEvents->Press(KeyCode::W); }
+                if (frame == 40) { pEvents->Release(KeyCode::W); }
+                if (frame == 70) { pEvents->Press(KeyCode::Space); pEvents->Release(KeyCode::Space); }
+                if (frame == 100) { pEvents->Press(KeyCode::W, SR_UTILS_NS::GetInputTimestamp() - 3000000); }
+                if (frame == 120) { pEvents->Release(KeyCode::W); }
+                if (frame == 20) { pKeyboard->SetKey(KeyCode::D, true); }
+                if (frame == 80) { pKeyboard->SetKey(KeyCode::D, false); }
+                if (frame % 17 == 0) { input.SetMouseScroll(0, frame % 3); }
+            }
+            else if (pEvents && pKeyboard) {
+                if (frame == 5) { pEvents->Press(KeyCode::A); }
+                if (frame == 33) { pEvents->Press(KeyCode::Space); }
+                if (frame == 90) { pEvents->Release(KeyCode::Space); }
+                if (frame == 60) { pKeyboard->SetKey(KeyCode::D, true); }
+                if (frame == 150) { pKeyboard->SetKey(KeyCode::D, false); }
+            }
+
+            const uint64_t deltaTime = recorder.BeginFrame(16000000 + jitter() % 8000000);
+            const float_t dt = static_cast<float_t>(deltaTime) / 1e9f;
+
+            accumulator += dt;
+
+            uint32_t fixedSteps = 0;
+            while (accumulator >= 1.f / 60.f) {
+                accumulator -= 1.f / 60.f;
+                ++fixedSteps;
+            }
+
+            fixedSteps = recorder.ScheduleFixedSteps(fixedSteps);
+
+            for (uint32_t step = 0; step < fixedSteps; ++step) {
+                const bool isFocused = !(isScenario && frame >= 50 && frame < 60);
+                if (!recorder.BeginFixedStep(isFocused)) {
+                    continue;
+                }
+
+                input.Check();
+
+                position += input.GetKey(KeyCode::W) ? 1.0 : 0.0;
+                position += input.GetKey(KeyCode::A) ? 1000.0 : 0.0;
+                position += input.GetKey(KeyCode::D) ? 0.25 : 0.0;
+                hits += input.GetKeyDown(KeyCode::Space) ? 1 : 0;
+                hits += input.GetInputLatency() / 1000000;
+                hits += static_cast<uint64_t>(input.GetMouseWheel());
+            }
+
+            position += dt * recorder.RandomFloat(0.f, 1.f) + recorder.RandomInt32(0, 5);
+
+            const uint64_t checksum = SR_UTILS_NS::FNV1AAppendValue(SR_UTILS_NS::FNV1AAppendValue(SR_UTILS_NS::SR_FNV_OFFSET_BASIS, position), hits);
+            checksums.emplace_back(checksum);
+            recorder.EndFrame(checksum);
+        }
+
+        return checksums;
+    }
+
+    /// Забирает хвост очередей и отложенные переходы, чтобы следующая сессия начиналась с отпущенных клавиш
+    void SettleInput() {
+        for (uint32_t i = 0; i < 4; ++i) {
+            SR_UTILS_NS::Input::Instance().Check();
+        }
+    }
+
+#ifdef SR_LINUX
+    /// Событие клавиши и SYN_REPORT за ним, как их пишет ядро
+    void WriteEvdevKey(int32_t fd, uint16_t code, int32_t value, uint64_t microseconds) {
+        input_event events[2] = { };
+
+        for (auto&& event : events) {
+            event.input_event_sec = static_cast<decltype(event.input_event_sec)>(microseconds / 1000000);
+            event.input_event_usec = static_cast<decltype(event.input_event_usec)>(microseconds % 1000000);
+        }
+
+        events[0].type = EV_KEY;
+        events[0].code = code;
+        events[0].value = value;
+        events[1].type = EV_SYN;
+        events[1].code = SYN_REPORT;
+
+        SR_UNUSED_VARIABLE(write(fd, events, sizeof(events)));
+    }
+
+    /// Ждет count событий от потока чтения, но не дольше секунды
+    std::vector<SR_UTILS_NS::RawInputEvent> WaitEvdevEvents(SR_UTILS_NS::EvdevInputSource& source, uint64_t count) {
+        std::vector<SR_UTILS_NS::RawInputEvent> events;
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+
+        while (events.size() < count && std::chrono::steady_clock::now() < deadline) {
+            source.Flush([&events](const SR_UTILS_NS::RawInputEvent& event) {
+                events.emplace_back(event);
+            });
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        return events;
+    }
+
+    bool IsSameInputEvent(const SR_UTILS_NS::RawInputEvent& event, SR_UTILS_NS::KeyCode key, bool pressed, uint64_t microseconds) {
+        return event.key == key && event.pressed == pressed && event.timestamp == microseconds * 1000;
+    }
+#endif
+}
+
+using namespace SR_TESTS_NS;
+
+/// Байткод обязан печатать то же самое и в том же порядке, что и интерпретатор
+SR_TEST(SRLM_BytecodeMatchesInterpreter) {
+    SR_SRLM_NS::LogicalNodeManager::Instance().InitializeTypes();
+
+    for (uint32_t seed = 1; seed <= 64; ++seed) {
+        bool isCompiled = false;
+        bool isInterpreterCompiled = false;
+
+        auto&& bytecode = RunSRLMGraph(seed, true, isCompiled);
+        auto&& interpreter = RunSRLMGraph(seed, false, isInterpreterCompiled);
+
+        SR_CHECK(isCompiled);
+        SR_CHECK(bytecode.find("srlm-") != std::string::npos || bytecode.find("[Log]") != std::string::npos);
+        SR_CHECK_EQ(bytecode, interpreter);
+    }
+}
+
+/// Для запуска под -fsanitize=thread (SR_TSAN). Одни и те же строки регистрируются из нескольких потоков,
+/// каждый поток сразу читает строку обратно по хешу
+SR_TEST(HashManager_ConcurrentInterning) {
+    auto&& hashManager = SR_UTILS_NS::HashManager::Instance();
+
+    constexpr uint32_t threadsCount = 8;
+    constexpr uint32_t strings = 4096;
+
+    std::atomic<uint64_t> mismatches = 0;
+    std::vector<std::thread> threads;
+
+    for (uint32_t i = 0; i < threadsCount; ++i) {
+        threads.emplace_back([&, i]() {
+            for (uint32_t j = 0; j < strings * 4; ++j) {
+                const std::string string = "interning-" + std::to_string((j * (i + 1)) % strings);
+                auto&& hash = hashManager.AddHash(string);
+
+                if (hash != SR_HASH_STR(string) || hashManager.HashToString(hash) != string) {
+                    ++mismatches;
+                }
+            }
+        });
+    }
+
+    for (auto&& thread : threads) {
+        thread.join();
+    }
+
+    SR_CHECK_EQ(mismatches.load(), 0u);
+}
+
+/// При политике Block ни одна запись не теряется, а записи каждого потока выходят в том порядке, в котором были сделаны
+SR_TEST(LogQueue_BlockNoLossNoReorder) {
+    constexpr uint32_t threadsCount = 8;
+    constexpr uint64_t count = 50000;
+
+    LogQueueOutput output;
+
+    SR_UTILS_NS::LogQueue queue;
+    queue.Start(MakeLogQueueSink(output, threadsCount, std::chrono::microseconds(200)), SR_UTILS_NS::LogOverflowPolicy::Block);
+
+    PushLogRecords(queue, threadsCount, count, 0);
+
+    queue.Stop();
+
+    SR_CHECK_EQ(output.dropped, 0u);
+    SR_CHECK_EQ(output.unordered, 0u);
+
+    for (auto&& records : output.threads) {
+        SR_REQUIRE(records.size() == count);
+        for (uint64_t i = 0; i < count; ++i) {
+            SR_REQUIRE(records[i] == i);
+        }
+    }
+}
+
+/// При политике Drop часть записей отбрасывается, но все они посчитаны, важные записи доходят всегда,
+/// а порядок внутри потока сохраняется
+SR_TEST(LogQueue_DropCountsLossKeepsOrder) {
+    constexpr uint32_t threadsCount = 8;
+    constexpr uint64_t count = 50000;
+    constexpr uint64_t important = 100;
+
+    LogQueueOutput output;
+
+    SR_UTILS_NS::LogQueue queue;
+    queue.Start(MakeLogQueueSink(output, threadsCount, std::chrono::microseconds(500)), SR_UTILS_NS::LogOverflowPolicy::Drop);
+
+    PushLogRecords(queue, threadsCount, count, important);
+
+    queue.Stop();
+
+    uint64_t received = 0;
+
+    for (auto&& records : output.threads) {
+        received += records.size();
+
+        for (uint64_t i = 1; i < records.size(); ++i) {
+            SR_REQUIRE(records[i - 1] < records[i]);
+        }
+
+        for (uint64_t i = 0; i < count; i += important) {
+            SR_REQUIRE(std::binary_search(records.begin(), records.end(), i));
+        }
+    }
+
+    SR_CHECK_EQ(output.unordered, 0u);
+    SR_CHECK_EQ(output.dropped, queue.GetDroppedCount());
+    SR_CHECK_EQ(received + output.dropped, threadsCount * count);
+    SR_CHECK(output.dropped > 0);
+}
+
+/// Запеченная модель после сохранения и загрузки отдает те же вершины, индексы, кости, узлы и анимации,
+/// что были переданы в BakedMeshBuilder, а файл совпадает с блоком побайтно
+SR_TEST(BakedMesh_RoundTrip) {
+    std::mt19937 random(41);
+
+    std::vector<std::vector<SR_UTILS_NS::Vertex>> vertices;
+    std::vector<std::vector<uint32_t>> indices;
+
+    auto&& built = MakeBakedModel(random, vertices, indices).Build(0x5EED);
+    SR_REQUIRE(built.Valid());
+
+    const SR_UTILS_NS::Path path = SR_UTILS_NS::ResourceManager::Instance().GetCachePath().Concat("Tests/RoundTrip.baked");
+    SR_REQUIRE(built.Save(path));
+
+    auto&& loaded = SR_UTILS_NS::BakedMesh::Load(path);
+    SR_REQUIRE(loaded.Valid());
+    SR_CHECK_EQ(loaded.GetSize(), built.GetSize());
+    SR_CHECK(std::memcmp(loaded.GetData(), built.GetData(), built.GetSize()) == 0);
+    SR_CHECK_EQ(loaded.GetSourceHash(), 0x5EEDu);
+
+    SR_REQUIRE(loaded.GetSubmeshesCount() == 2);
+    SR_CHECK(loaded.GetSubmeshName(0) == "Body");
+    SR_CHECK(loaded.GetSubmeshName(1) == "Skin");
+    SR_CHECK_EQ(loaded.FindSubmesh("Skin"), 1);
+    SR_CHECK(!loaded.IsSkinned(0));
+    SR_CHECK(loaded.IsSkinned(1));
+
+    for (uint32_t id = 0; id < 2; ++id) {
+        auto&& restored = loaded.GetVertices(id);
+        SR_REQUIRE(restored.size() == vertices[id].size());
+
+        for (uint32_t i = 0; i < restored.size(); ++i) {
+            SR_REQUIRE(IsSameBakedVertex(restored[i], vertices[id][i]));
+        }
+
+        auto&& submesh = loaded.GetSubmesh(id);
+        SR_REQUIRE(submesh.indexCount == indices[id].size());
+        SR_CHECK(std::equal(indices[id].begin(), indices[id].end(), loaded.GetIndices(id)));
+
+        for (auto&& vertex : vertices[id]) {
+            SR_CHECK(vertex.position.x >= submesh.bounds.min.x && vertex.position.x <= submesh.bounds.max.x);
+            SR_CHECK(std::sqrt(vertex.position.x * vertex.position.x + vertex.position.y * vertex.position.y + vertex.position.z * vertex.position.z) <= submesh.bounds.radius + 1e-4f);
+        }
+    }
+
+    SR_REQUIRE(loaded.GetSubmesh(1).bonesCount == 3);
+    for (uint32_t i = 0; i < 3; ++i) {
+        SR_CHECK_EQ(loaded.GetBones(1)[i].index, i);
+    }
+
+    SR_REQUIRE(loaded.GetSkeletonCount() == 3);
+    for (uint32_t i = 0; i < loaded.GetSkeletonCount(); ++i) {
+        auto&& bone = loaded.GetSkeleton()[i];
+        SR_CHECK_NEAR(bone.offset[12], static_cast<float_t>(bone.index), 1e-6f);
+        SR_CHECK_NEAR(bone.offset[13], 2.f * bone.index, 1e-6f);
+    }
+
+    SR_REQUIRE(loaded.GetNodesCount() == 4);
+    auto&& pNodeIndices = loaded.GetNodeIndices();
+
+    auto&& root = loaded.GetNode(0);
+    SR_CHECK(loaded.GetNodeName(0) == "Root");
+    SR_REQUIRE(root.childrenCount == 2);
+    SR_CHECK_EQ(pNodeIndices[root.childrenOffset], 1u);
+    SR_CHECK_EQ(pNodeIndices[root.childrenOffset + 1], 2u);
+    SR_CHECK_EQ(root.meshesCount, 0u);
+
+    auto&& armature = loaded.GetNode(2);
+    SR_CHECK(loaded.GetNodeName(2) == "Armature");
+    SR_REQUIRE(armature.meshesCount == 1 && armature.childrenCount == 1);
+    SR_CHECK_EQ(pNodeIndices[armature.meshesOffset], 1u);
+    SR_CHECK_EQ(pNodeIndices[armature.childrenOffset], 3u);
+    SR_CHECK_EQ(armature.rotation.y, 1.5f);
+    SR_CHECK_EQ(armature.scaling.x, 0.01f);
+
+    auto&& body = loaded.GetNode(1);
+    SR_CHECK_EQ(body.translation.z, 3.f);
+    SR_CHECK_EQ(body.rotation.x, 0.1f);
+
+    SR_REQUIRE(loaded.GetScaleFactor().has_value());
+    SR_CHECK_EQ(loaded.GetScaleFactor().value(), 100.f);
+
+    SR_REQUIRE(loaded.GetAnimationsCount() == 1);
+    auto&& animation = loaded.GetAnimation(0);
+    SR_CHECK(loaded.GetString(animation.nameOffset, animation.nameSize) == "Walk");
+    SR_CHECK_EQ(animation.ticksPerSecond, 24.0);
+    SR_REQUIRE(animation.channelsCount == 2);
+
+    auto&& hips = loaded.GetChannel(animation.firstChannel);
+    SR_CHECK(loaded.GetString(hips.nameOffset, hips.nameSize) == "Hips");
+    SR_REQUIRE(hips.positionKeysCount == 2 && hips.rotationKeysCount == 2 && hips.scalingKeysCount == 1);
+    SR_CHECK_EQ(loaded.GetVectorKeys(hips.positionKeysOffset)[1].value.y, 1.f);
+    SR_CHECK_EQ(loaded.GetQuatKeys(hips.rotationKeysOffset)[1].x, 1.f);
+    SR_CHECK_EQ(hips.postState, 1u);
+
+    auto&& spine = loaded.GetChannel(animation.firstChannel + 1);
+    SR_CHECK_EQ(spine.positionKeysCount, 0u);
+    SR_CHECK_EQ(loaded.GetQuatKeys(spine.rotationKeysOffset)[0].time, 12.0);
+
+    /// модель без узлов и масштаба тоже собирается, масштаба у нее нет
+    SR_UTILS_NS::BakedMeshBuilder empty;
+    auto&& emptyMesh = empty.Build(1);
+    SR_REQUIRE(emptyMesh.Valid());
+    SR_CHECK_EQ(emptyMesh.GetNodesCount(), 0u);
+    SR_CHECK(!emptyMesh.GetScaleFactor().has_value());
+
+    SR_PLATFORM_NS::Delete(path);
+}
+
+/// Индекс за пределами вершин подмеша, узел, ссылающийся на предка, и обрезанный файл не загружаются
+SR_TEST(BakedMesh_RejectsCorrupted) {
+    std::mt19937 random(42);
+
+    std::vector<std::vector<SR_UTILS_NS::Vertex>> vertices;
+    std::vector<std::vector<uint32_t>> indices;
+
+    auto&& built = MakeBakedModel(random, vertices, indices).Build(7);
+    SR_REQUIRE(built.Valid());
+    SR_CHECK(SR_UTILS_NS::BakedMesh::FromBlob(CopyBakedBlob(built)).Valid());
+
+    auto&& header = *reinterpret_cast<const SR_UTILS_NS::BakedMesh::Header*>(built.GetData());
+
+    {
+        auto&& blob = CopyBakedBlob(built);
+        auto&& submesh = GetBakedSection<SR_UTILS_NS::BakedMesh::Submesh>(blob, header.submeshesOffset)[1];
+        GetBakedSection<uint32_t>(blob, submesh.indexOffset)[submesh.indexCount - 1] = submesh.vertexCount;
+        SR_CHECK(!SR_UTILS_NS::BakedMesh::FromBlob(std::move(blob)).Valid());
+    }
+
+    {
+        auto&& blob = CopyBakedBlob(built);
+        auto&& armature = GetBakedSection<SR_UTILS_NS::BakedNode>(blob, header.nodesOffset)[2];
+        GetBakedSection<uint32_t>(blob, header.nodeIndicesOffset)[armature.childrenOffset] = 0;
+        SR_CHECK(!SR_UTILS_NS::BakedMesh::FromBlob(std::move(blob)).Valid());
+    }
+
+    {
+        auto&& blob = CopyBakedBlob(built);
+        auto&& body = GetBakedSection<SR_UTILS_NS::BakedNode>(blob, header.nodesOffset)[1];
+        GetBakedSection<uint32_t>(blob, header.nodeIndicesOffset)[body.meshesOffset] = 2;
+        SR_CHECK(!SR_UTILS_NS::BakedMesh::FromBlob(std::move(blob)).Valid());
+    }
+
+    {
+        std::vector<std::vector<uint32_t>> badIndices = { { 0, 1, 5 } };
+        SR_UTILS_NS::BakedMeshBuilder builder;
+        builder.AddSubmesh("Bad", MakeBakedVertices(random, 5, 0), badIndices[0], { });
+        SR_CHECK(!builder.Build(1).Valid());
+    }
+
+    const SR_UTILS_NS::Path path = SR_UTILS_NS::ResourceManager::Instance().GetCachePath().Concat("Tests/Truncated.baked");
+    SR_REQUIRE(path.GetFolder().Make(SR_UTILS_NS::Path::Type::Folder));
+
+    {
+        std::ofstream file(path.ToString(), std::ios::binary | std::ios::trunc);
+        file.write(static_cast<const char*>(built.GetData()), static_cast<std::streamsize>(built.GetSize() - 64));
+    }
+
+    LogCapture capture;
+    SR_CHECK(!SR_UTILS_NS::BakedMesh::Load(path).Valid());
+
+    SR_PLATFORM_NS::Delete(path);
+}
+
+/// Модели из Resources с BakedModelsLoad и без него дают те же вершины, индексы, кости, узлы и каналы анимаций,
+/// что и импорт assimp. С включенной фичей модель грузится дважды: первая загрузка сохраняет файл, вторая читает только его
+SR_TEST(RawMesh_BakedMatchesAssimp) {
+    auto&& features = SR_UTILS_NS::Features::Instance();
+    auto&& resourceManager = SR_UTILS_NS::ResourceManager::Instance();
+
+    const bool bakedModelsLoad = features.Enabled("BakedModelsLoad", false);
+
+    for (const bool baked : { false, true }) {
+        features.SetEnabled("Common", "BakedModelsLoad", baked);
+
+        for (auto&& [path, animation] : BAKED_TEST_MODELS) {
+            SR_HTYPES_NS::RawMeshParams params;
+            params.animation = animation;
+
+            for (uint32_t load = 0; load < (baked ? 2u : 1u); ++load) {
+                auto&& pRawMesh = SR_HTYPES_NS::RawMesh::Load(path, params);
+                SR_CHECK(pRawMesh);
+                if (!pRawMesh) {
+                    continue;
+                }
+
+                pRawMesh->AddUsePoint();
+
+                if (baked) {
+                    auto&& bakedPath = resourceManager.GetCachePath().Concat("Models").Concat(path);
+                    SR_CHECK((animation ? bakedPath.ConcatExt("animation") : bakedPath).ConcatExt("baked").Exists());
+                }
+
+                CheckRawMeshMatchesAssimp(context, pRawMesh);
+
+                pRawMesh->RemoveUsePoint();
+
+                /// следующая загрузка должна создать новый ресурс, а не найти этот
+                resourceManager.Synchronize(true);
+            }
+        }
+    }
+
+    features.SetEnabled("Common", "BakedModelsLoad", bakedModelsLoad);
+}
+
+/// Объекты версий 1-4 мигрируют до 4 цепочками до трех шагов прямо в буфере: поля и хвост верны,
+/// миграторы пишут только свои поля, а буфер не копируется целиком ни на одном шаге
+SR_TEST(Migration_InPlaceChains) {
+    static const uint64_t hashName = SR_HASH_STR("MigrationTestObject");
+    static const bool registered = (RegisterTestMigrators(hashName), true);
+    SR_UNUSED_VARIABLE(registered);
+
+    constexpr uint32_t count = 2000;
+    constexpr uint64_t sentinel = 0x5EED5EED5EED5EEDull;
+
+    std::mt19937 random(43);
+
+    SR_HTYPES_NS::Marshal marshal;
+    uint32_t legacy = 0;
+
+    for (uint32_t i = 0; i < count; ++i) {
+        const auto version = static_cast<uint16_t>(1 + random() % MIGRATION_TEST_VERSION);
+        legacy += version != MIGRATION_TEST_VERSION ? 1 : 0;
+        WriteVersionedObject(marshal, version, static_cast<int32_t>(i));
+    }
+    marshal.Write<uint64_t>(sentinel);
+
+    const uint64_t sourceSize = marshal.Size();
+    SR_HTYPES_NS::Marshal unreserved = marshal.FullCopy();
+
+    /// с запасом емкости буфер не должен меняться вовсе
+    marshal.Reserve(sourceSize * 2);
+    marshal.SetPosition(0);
+
+    gMigrationTestMaxOutput = 0;
+    const uint64_t migratedBefore = SR_UTILS_NS::Migration::Instance().GetMigratedCount();
+
+    uint32_t errors = 0;
+    SR_CHECK_EQ(ReadVersionedObjects(hashName, marshal, count, errors), 0u);
+    SR_CHECK_EQ(errors, 0u);
+    SR_CHECK_EQ(marshal.Read<uint64_t>(), sentinel);
+    SR_CHECK_EQ(marshal.GetPosition(), marshal.Size());
+    SR_CHECK_EQ(SR_UTILS_NS::Migration::Instance().GetMigratedCount() - migratedBefore, static_cast<uint64_t>(legacy));
+
+    /// миграторы видят только поля своего объекта, а не копию всего буфера
+    SR_CHECK(gMigrationTestMaxOutput.load() > 0);
+    SR_CHECK(gMigrationTestMaxOutput.load() < 64);
+
+    /// без запаса буфер растет с запасом сам, а не копируется на каждой миграции
+    unreserved.SetPosition(0);
+    const uint32_t reallocations = ReadVersionedObjects(hashName, unreserved, count, errors);
+    SR_CHECK_EQ(errors, 0u);
+    SR_CHECK(reallocations <= 4);
+    SR_CHECK_EQ(unreserved.Read<uint64_t>(), sentinel);
+}
+
+/// Цепочка с пропущенным шагом не применяется, буфер и позиция остаются как были
+SR_TEST(Migration_MissingStep) {
+    static const uint64_t hashName = SR_HASH_STR("MigrationTestBrokenObject");
+    static const bool registered = []() {
+        auto&& migration = SR_UTILS_NS::Migration::Instance();
+        migration.RegisterMigrator(hashName, 1, 2, [](SR_HTYPES_NS::Marshal& marshal, SR_HTYPES_NS::Marshal& migrated) -> bool {
+            migrated.Write<int32_t>(marshal.Read<int32_t>() + 1);
+            return true;
+        });
+        migration.RegisterMigrator(hashName, 3, 4, [](SR_HTYPES_NS::Marshal& marshal, SR_HTYPES_NS::Marshal& migrated) -> bool {
+            migrated.Write<int32_t>(marshal.Read<int32_t>() + 1);
+            return true;
+        });
+        return true;
+    }();
+    SR_UNUSED_VARIABLE(registered);
+
+    SR_HTYPES_NS::Marshal marshal;
+    marshal.Write<uint32_t>(MIGRATION_TEST_MARKER);
+    marshal.Write<int32_t>(7);
+    marshal.Write<uint32_t>(MIGRATION_TEST_MARKER);
+
+    const auto source = marshal.FullCopy();
+
+    marshal.SetPosition(sizeof(uint32_t));
+    SR_CHECK(!SR_UTILS_NS::Migration::Instance().Migrate(hashName, marshal, 1, 4));
+    SR_CHECK_EQ(marshal.GetPosition(), sizeof(uint32_t));
+    SR_REQUIRE(marshal.Size() == source.Size());
+    SR_CHECK(std::memcmp(marshal.Stream::View(), source.Stream::View(), source.Size()) == 0);
+
+    /// доступный участок цепочки работает
+    SR_CHECK(SR_UTILS_NS::Migration::Instance().Migrate(hashName, marshal, 3, 4));
+    SR_CHECK_EQ(marshal.Read<int32_t>(), 8);
+    SR_CHECK_EQ(marshal.Read<uint32_t>(), MIGRATION_TEST_MARKER);
+}
+
+/// Случайные подписки и отписки из обработчиков: новые слушатели ждут следующей рассылки, отписанные
+/// до своей очереди не вызываются, остальные вызываются ровно один раз в порядке подписки
+SR_TEST(TypedEventDispatcher_SubscribeDuringDispatch) {
+    DispatchModel model;
+
+    for (uint32_t i = 0; i < 8; ++i) {
+        model.Subscribe();
+    }
+
+    for (uint32_t round = 0; round < 2000; ++round) {
+        if (model.active.empty()) {
+            model.Subscribe();
+        }
+
+        while (model.active.size() > 32) {
+            model.Unsubscribe(model.active.front());
+        }
+
+        model.snapshot = model.active;
+        model.calls.clear();
+        model.removedAt.clear();
+        model.progress = 0;
+
+        model.dispatcher.Dispatch(DispatchTestEvent { round });
+
+        SR_REQUIRE(model.calls == model.Expected());
+        SR_REQUIRE(model.dispatcher.GetListenersCount<DispatchTestEvent>() == model.active.size());
+        SR_CHECK_EQ(model.dispatcher.GetListenersCount<DispatchTestOtherEvent>(), 0u);
+    }
+}
+
+/// Отписка во вложенной рассылке того же события действует и на внешнюю, массив уплотняется только после нее
+SR_TEST(TypedEventDispatcher_NestedDispatch) {
+    struct State {
+        TestEventDispatcher dispatcher;
+        SR_UTILS_NS::EventListenerId second = 0;
+        std::vector<std::pair<uint32_t, uint32_t>> calls;
+    } state;
+
+    state.dispatcher.Subscribe<DispatchTestEvent>(&state, [](void* pData, const DispatchTestEvent& event) {
+        auto&& state = *static_cast<State*>(pData);
+        state.calls.emplace_back(1, event.value);
+        if (event.value == 0) {
+            state.dispatcher.Dispatch(DispatchTestEvent { 1 });
+            state.dispatcher.Unsubscribe<DispatchTestEvent>(state.second);
+        }
+    });
+
+    state.second = state.dispatcher.Subscribe<DispatchTestEvent>(&state, [](void* pData, const DispatchTestEvent& event) {
+        static_cast<State*>(pData)->calls.emplace_back(2, event.value);
+    });
+
+    state.dispatcher.Subscribe<DispatchTestOtherEvent>(&state, [](void* pData, const DispatchTestOtherEvent& event) {
+        static_cast<State*>(pData)->calls.emplace_back(3, event.value);
+    });
+
+    state.dispatcher.Dispatch(DispatchTestEvent { 0 });
+
+    const std::vector<std::pair<uint32_t, uint32_t>> expected = { { 1, 0 }, { 1, 1 }, { 2, 1 } };
+    SR_CHECK(state.calls == expected);
+    SR_CHECK_EQ(state.dispatcher.GetListenersCount<DispatchTestEvent>(), 1u);
+    SR_CHECK(!state.dispatcher.Unsubscribe<DispatchTestEvent>(state.second));
+
+    state.calls.clear();
+    state.dispatcher.Dispatch(DispatchTestOtherEvent { 5 });
+    state.dispatcher.UnsubscribeAll();
+    state.dispatcher.Dispatch(DispatchTestEvent { 2 });
+    state.dispatcher.Dispatch(DispatchTestOtherEvent { 6 });
+
+    SR_CHECK(state.calls == (std::vector<std::pair<uint32_t, uint32_t>> { { 3, 5 } }));
+}
+
+/// События из разных потоков доставляются в Flush все и в порядке Post каждого потока,
+/// а Post из обработчика во время Flush ждет следующего Flush
+SR_TEST(TypedEventDispatcher_PostFlush) {
+    constexpr uint32_t threadsCount = 4;
+    constexpr uint32_t events = 5000;
+
+    struct State {
+        TestEventDispatcher dispatcher;
+        std::vector<uint32_t> last = std::vector<uint32_t>(threadsCount, 0);
+        uint64_t received = 0;
+        uint64_t reordered = 0;
+        uint64_t echoes = 0;
+    } state;
+
+    state.dispatcher.Subscribe<DispatchTestEvent>(&state, [](void* pData, const DispatchTestEvent& event) {
+        auto&& state = *static_cast<State*>(pData);
+        const uint32_t thread = event.value >> 24;
+        const uint32_t index = event.value & 0xFFFFFF;
+
+        if (index != state.last[thread] + 1) {
+            ++state.reordered;
+        }
+        state.last[thread] = index;
+        ++state.received;
+
+        if (index == events) {
+            state.dispatcher.Post(DispatchTestOtherEvent { static_cast<int32_t>(thread) });
+        }
+    });
+
+    state.dispatcher.Subscribe<DispatchTestOtherEvent>(&state, [](void* pData, const DispatchTestOtherEvent&) {
+        ++static_cast<State*>(pData)->echoes;
+    });
+
+    std::atomic<bool> isDone = false;
+    std::vector<std::thread> threads;
+
+    for (uint32_t i = 0; i < threadsCount; ++i) {
+        threads.emplace_back([&state, i]() {
+            for (uint32_t j = 1; j <= events; ++j) {
+                state.dispatcher.Post(DispatchTestEvent { (i << 24) | j });
+            }
+        });
+    }
+
+    std::thread flusher([&state, &isDone]() {
+        while (!isDone) {
+            state.dispatcher.Flush();
+        }
+    });
+
+    for (auto&& thread : threads) {
+        thread.join();
+    }
+
+    isDone = true;
+    flusher.join();
+
+    /// события второго типа, отправленные из обработчика, могли попасть только в следующий Flush
+    state.dispatcher.Flush();
+    state.dispatcher.Flush();
+
+    SR_CHECK_EQ(state.received, static_cast<uint64_t>(threadsCount) * events);
+    SR_CHECK_EQ(state.reordered, 0u);
+    SR_CHECK_EQ(state.echoes, static_cast<uint64_t>(threadsCount));
+}
+
+/// Каждое пакетное ядро на каждом доступном наборе инструкций совпадает со скалярным эталоном
+/// с точностью до округления (Slerp - до точности полиномиальных acos и sin), в том числе при записи поверх входа
+SR_TEST(SIMD_MatchesScalar) {
+    namespace SIMD = SR_MATH_NS::SIMD;
+
+    constexpr uint32_t count = 1003;
+
+    std::mt19937 random(45);
+    auto&& batch = MakeSIMDTestBatch(random, count);
+
+    std::vector<SR_MATH_NS::Matrix4x4> expectedMatrices(count), expectedParentMatrices(count), expectedComposed(count);
+    std::vector<SR_MATH_NS::FVector3> expectedTranslations(count), expectedScales(count);
+    std::vector<SR_MATH_NS::Quaternion> expectedRotations(count), expectedSlerp(count);
+    std::vector<SR_MATH_NS::AABB> expectedBounds(count);
+    std::vector<uint8_t> expectedVisible(count);
+
+    SIMD::Scalar::MultiplyMatrices(batch.matrices.data(), batch.locals.data(), expectedMatrices.data(), count);
+    SIMD::Scalar::MultiplyMatrices(batch.matrices.front(), batch.locals.data(), expectedParentMatrices.data(), count);
+    SIMD::Scalar::ComposeTRS(batch.translations.data(), batch.rotations.data(), batch.scales.data(), expectedComposed.data(), count);
+    SIMD::Scalar::DecomposeTRS(batch.matrices.data(), expectedTranslations.data(), expectedRotations.data(), expectedScales.data(), count);
+    SIMD::Scalar::SlerpQuaternions(batch.rotations.data(), batch.targetRotations.data(), batch.factors.data(), expectedSlerp.data(), count);
+    SIMD::Scalar::TransformAABBs(batch.matrices.data(), batch.bounds.data(), expectedBounds.data(), count);
+    SIMD::Scalar::TestSpheres(batch.planes.data(), static_cast<uint32_t>(batch.planes.size()), batch.spheres.data(), expectedVisible.data(), count);
+
+    /// эталон сам по себе сходится с обычной математикой
+    SR_CHECK(GetMaxDifference(expectedTranslations, batch.translations) < 1e-3f);
+    SR_CHECK(GetMaxDifference(expectedScales, batch.scales) < 1e-4f);
+    SR_CHECK(GetMaxRotationDifference(expectedRotations, batch.rotations) < 1e-5f);
+    SR_CHECK(std::count(expectedVisible.begin(), expectedVisible.end(), 0) > 0);
+    SR_CHECK(std::count(expectedVisible.begin(), expectedVisible.end(), 1) > 0);
+
+    const auto backend = SIMD::GetBackend();
+    uint32_t tested = 0;
+
+    for (auto&& candidate : { SIMD::Backend::SSE, SIMD::Backend::AVX2, SIMD::Backend::NEON }) {
+        if (!SIMD::SetBackend(candidate)) {
+            continue;
+        }
+
+        ++tested;
+        SR_CHECK(SIMD::GetBackend() == candidate);
+
+        std::vector<SR_MATH_NS::Matrix4x4> matrices(count), parentMatrices(count), composed(count);
+        std::vector<SR_MATH_NS::FVector3> translations(count), scales(count);
+        std::vector<SR_MATH_NS::Quaternion> rotations(count), slerp(count);
+        std::vector<SR_MATH_NS::AABB> bounds(count);
+        std::vector<uint8_t> visible(count);
+
+        SIMD::MultiplyMatrices(batch.matrices.data(), batch.locals.data(), matrices.data(), count);
+        SIMD::MultiplyMatrices(batch.matrices.front(), batch.locals.data(), parentMatrices.data(), count);
+        SIMD::ComposeTRS(batch.translations.data(), batch.rotations.data(), batch.scales.data(), composed.data(), count);
+        SIMD::DecomposeTRS(batch.matrices.data(), translations.data(), rotations.data(), scales.data(), count);
+        SIMD::SlerpQuaternions(batch.rotations.data(), batch.targetRotations.data(), batch.factors.data(), slerp.data(), count);
+        SIMD::TransformAABBs(batch.matrices.data(), batch.bounds.data(), bounds.data(), count);
+        SIMD::TestSpheres(batch.planes.data(), static_cast<uint32_t>(batch.planes.size()), batch.spheres.data(), visible.data(), count);
+
+        SR_CHECK(GetMaxDifference(matrices, expectedMatrices) < 1e-3f);
+        SR_CHECK(GetMaxDifference(parentMatrices, expectedParentMatrices) < 1e-3f);
+        SR_CHECK(GetMaxDifference(composed, expectedComposed) < 1e-5f);
+        SR_CHECK(GetMaxDifference(translations, expectedTranslations) < 1e-4f);
+        SR_CHECK(GetMaxDifference(scales, expectedScales) < 1e-5f);
+        SR_CHECK(GetMaxRotationDifference(rotations, expectedRotations) < 1e-6f);
+        SR_CHECK(GetMaxDifference(slerp, expectedSlerp) < 1e-5f);
+        SR_CHECK(GetMaxDifference(bounds, expectedBounds) < 1e-3f);
+
+        /// расхождение допустимо только для сфер, касающихся плоскости с точностью до округления
+        uint32_t mismatches = 0;
+        for (uint32_t i = 0; i < count; ++i) {
+            if (visible[i] == expectedVisible[i]) {
+                continue;
+            }
+
+            float_t margin = std::numeric_limits<float_t>::max();
+            for (auto&& plane : batch.planes) {
+                margin = std::min(margin, std::abs(plane.normal.Dot(batch.spheres[i].center) + plane.distance + batch.spheres[i].radius));
+            }
+
+            mismatches += margin > 1e-4f ? 1 : 0;
+        }
+        SR_CHECK_EQ(mismatches, 0u);
+
+        /// результат поверх входа совпадает с результатом в отдельный массив
+        auto inPlace = batch.locals;
+        SIMD::MultiplyMatrices(batch.matrices.data(), inPlace.data(), inPlace.data(), count);
+        SR_CHECK(GetMaxDifference(inPlace, matrices) == 0.f);
+
+        auto inPlaceBounds = batch.bounds;
+        SIMD::TransformAABBs(batch.matrices.data(), inPlaceBounds.data(), inPlaceBounds.data(), count);
+        SR_CHECK(GetMaxDifference(inPlaceBounds, bounds) == 0.f);
+    }
+
+    SIMD::SetBackend(backend);
+
+    SR_CHECK(tested > 0);
+}
+
+/// Пакетное заполнение сходится с поточечным FractalNoise в пределах заявленного допуска: на хвостах строк,
+/// на границах тайлов, вдали от начала координат и при раздаче тайлов потокам
+SR_TEST(Noise_BatchMatchesScalar) {
+    SR_MATH_NS::NoiseParams params;
+    params.octaves = 4;
+    params.frequency = 0.37;
+    params.amplitude = 2.0;
+
+    /// размеры не кратны ни ширине строки, ни тайлу
+    SR_MATH_NS::NoiseGrid grid;
+    grid.step = 0.173;
+    grid.sizeX = 37;
+    grid.sizeY = 19;
+    grid.sizeZ = 11;
+    grid.tileSize = 8;
+
+    const double_t tolerance = GetNoiseTolerance(params);
+
+    for (double_t origin : { 0.0, -12.34, 1e5 + 0.5, 65567756.0 }) {
+        grid.originX = origin;
+        grid.originY = -origin * 0.5;
+        grid.originZ = origin + 3.21;
+
+        std::vector<float_t> values2D(grid.sizeX * grid.sizeY, std::numeric_limits<float_t>::quiet_NaN());
+        SR_MATH_NS::FillNoise2D(grid, params, values2D.data());
+        SR_CHECK(GetMaxNoiseDifference(grid, params, values2D, false) <= tolerance);
+
+        std::vector<float_t> values3D(grid.sizeX * grid.sizeY * grid.sizeZ, std::numeric_limits<float_t>::quiet_NaN());
+        SR_MATH_NS::FillNoise3D(grid, params, values3D.data());
+        SR_CHECK(GetMaxNoiseDifference(grid, params, values3D, true) <= tolerance);
+
+        /// потоки берут тайлы в любом порядке, но каждый отсчет считается одинаково
+        std::vector<float_t> threaded(values3D.size(), std::numeric_limits<float_t>::quiet_NaN());
+        SR_MATH_NS::FillNoise3D(grid, params, threaded.data(), 3);
+        SR_CHECK(std::memcmp(threaded.data(), values3D.data(), values3D.size() * sizeof(float_t)) == 0);
+    }
+
+    /// одна октава с единичными параметрами - это SNoise, как у чанка процедурного мира
+    SR_MATH_NS::NoiseGrid chunk;
+    chunk.originX = chunk.originY = chunk.originZ = 65567756.0 + 1.6;
+    chunk.step = 0.1;
+    chunk.sizeX = chunk.sizeY = chunk.sizeZ = 16;
+
+    std::vector<float_t> values(chunk.sizeX * chunk.sizeY * chunk.sizeZ);
+    SR_MATH_NS::FillNoise3D(chunk, SR_MATH_NS::NoiseParams(), values.data());
+
+    double_t difference = 0.0;
+    for (uint32_t z = 0; z < chunk.sizeZ; ++z) {
+        for (uint32_t y = 0; y < chunk.sizeY; ++y) {
+            for (uint32_t x = 0; x < chunk.sizeX; ++x) {
+                const double_t expected = SR_MATH_NS::SNoise(chunk.originX + x * chunk.step, chunk.originY + y * chunk.step, chunk.originZ + z * chunk.step);
+                difference = std::max(difference, std::abs(expected - values[(z * chunk.sizeY + y) * chunk.sizeX + x]));
+            }
+        }
+    }
+    SR_CHECK(difference <= 1e-5);
+
+    /// пустая сетка ничего не пишет
+    grid.sizeX = 0;
+    float_t untouched = 1.f;
+    SR_MATH_NS::FillNoise3D(grid, params, &untouched, 2);
+    SR_CHECK_EQ(untouched, 1.f);
+}
+
+/// Каждый конфиг движка и редактора читается из скомпилированного блока, прошедшего через диск,
+/// так же, как из XML: те же имена, значения атрибутов во всех преобразованиях, дети и дамп
+SR_TEST(Config_CompiledMatchesXml) {
+    auto&& resources = SR_UTILS_NS::ResourceManager::Instance().GetResPath();
+    const SR_UTILS_NS::Path cacheFolder = SR_UTILS_NS::ResourceManager::Instance().GetCachePath().Concat("Tests/Configs");
+
+    uint32_t checked = 0;
+
+    for (auto&& folder : { "Engine/Configs", "Editor/Configs" }) {
+        for (auto&& path : resources.Concat(folder).GetFiles()) {
+            if (path.GetExtensionView() != "xml") {
+                continue;
+            }
+
+            auto&& xml = SR_XML_NS::Document::Load(path);
+            SR_REQUIRE(xml.Valid());
+
+            const SR_UTILS_NS::Path cachePath = cacheFolder.Concat(path.GetBaseNameAndExt() + ".compiled");
+            SR_REQUIRE(SR_XML_NS::CompiledConfig::Compile(xml, SR_XML_NS::ConfigSchema(), 1).Save(cachePath));
+
+            auto&& names = SR_XML_NS::CompiledConfig::Load(cachePath);
+            SR_REQUIRE(names.Valid());
+            auto&& compiled = SR_XML_NS::CompiledConfig::Load(cachePath).ToDocument(path);
+            SR_REQUIRE(compiled.Valid());
+
+            std::vector<std::string> expected, actual;
+            WriteConfigTranscript(xml.Root(), names, 0, expected);
+            WriteConfigTranscript(compiled.Root(), names, 0, actual);
+            SR_CHECK(expected == actual);
+
+            SR_CHECK(xml.Dump() == compiled.Dump());
+            SR_CHECK(xml.DocumentElement().Name() == compiled.DocumentElement().Name());
+            SR_CHECK(xml.DocumentElement().ToDocument().Dump() == compiled.DocumentElement().ToDocument().Dump());
+
+            SR_PLATFORM_NS::Delete(cachePath);
+            ++checked;
+        }
+    }
+
+    SR_CHECK(checked >= 20);
+}
+
+/// Кеш используется только при совпадении хешей исходника и схемы, схема проверяется при компиляции,
+/// испорченный или чужой блок компилируется заново из XML
+SR_TEST(Config_CompiledCache) {
+    auto&& folder = SR_UTILS_NS::ResourceManager::Instance().GetCachePath().Concat("Tests");
+    SR_REQUIRE(folder.Make(SR_UTILS_NS::Path::Type::Folder));
+
+    const SR_UTILS_NS::Path source = folder.Concat("Technique.xml");
+    const SR_UTILS_NS::Path cache = folder.Concat("Technique.xml.compiled");
+    const SR_XML_NS::ConfigSchema schema = { "Technique", { "Name" } };
+
+    auto&& getName = [](const SR_XML_NS::Document& document) {
+        return document.Root().GetNode("Technique").GetAttribute("Name").ToString();
+    };
+
+    SR_PLATFORM_NS::Delete(cache);
+
+    const std::string text = "<?xml version=\"1.0\"?>\n<Technique Name=\"A\">\n  <Pass Size=\"0x10\" F=\"1.5\" B=\"yes\"/>\n</Technique>\n";
+    WriteTextFile(source, text);
+
+    auto&& first = SR_XML_NS::CompiledConfig::LoadDocument(source, cache, schema);
+    SR_REQUIRE(first.Valid());
+    SR_CHECK(cache.Exists());
+
+    auto&& pass = first.Root().GetNode("Technique").GetNode("Pass");
+    SR_CHECK_EQ(pass.GetAttribute("Size").ToUInt(), 16u);
+    SR_CHECK_EQ(pass.GetAttribute("F").ToFloat(), 1.5f);
+    SR_CHECK(pass.GetAttribute("B").ToBool());
+    SR_CHECK(getName(first) == "A");
+
+    /// при совпадении хешей XML не разбирается: подложенный блок с тем же хешем исходника читается как есть
+    {
+        auto&& planted = SR_XML_NS::Document::LoadFromString("<?xml version=\"1.0\"?>\n<Technique Name=\"Cached\"/>\n", source);
+        SR_REQUIRE(SR_XML_NS::CompiledConfig::Compile(planted, schema, SR_HASH_STR(text)).Save(cache));
+        SR_CHECK(getName(SR_XML_NS::CompiledConfig::LoadDocument(source, cache, schema)) == "Cached");
+    }
+
+    /// исходник изменился
+    WriteTextFile(source, "<?xml version=\"1.0\"?>\n<Technique Name=\"B\"/>\n");
+    SR_CHECK(getName(SR_XML_NS::CompiledConfig::LoadDocument(source, cache, schema)) == "B");
+
+    {
+        LogCapture capture;
+
+        /// нет обязательного атрибута, повтор атрибута, другой корень
+        for (auto&& invalid : { "<Technique/>", "<Technique Name=\"C\" Name=\"D\"/>", "<Settings Name=\"C\"/>" }) {
+            WriteTextFile(source, std::string("<?xml version=\"1.0\"?>\n") + invalid + "\n");
+            SR_CHECK(!SR_XML_NS::CompiledConfig::LoadDocument(source, cache, schema).Valid());
+        }
+    }
+
+    /// схема изменилась
+    WriteTextFile(source, "<?xml version=\"1.0\"?>\n<Technique Name=\"E\"><X/></Technique>\n");
+    SR_CHECK(getName(SR_XML_NS::CompiledConfig::LoadDocument(source, cache, schema)) == "E");
+
+    const SR_XML_NS::ConfigSchema otherSchema = { "Technique" };
+    SR_CHECK(getName(SR_XML_NS::CompiledConfig::LoadDocument(source, cache, otherSchema)) == "E");
+    SR_CHECK_EQ(SR_XML_NS::CompiledConfig::Load(cache).GetSchemaHash(), otherSchema.GetHash());
+
+    /// секция атрибутов за пределами блока
+    {
+        std::fstream file(cache.ToString(), std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(offsetof(SR_XML_NS::CompiledConfig::Header, attributesOffset));
+        const uint64_t corrupted = 0xFFFFFFF00000000ull;
+        file.write(reinterpret_cast<const char*>(&corrupted), sizeof(corrupted));
+    }
+
+    {
+        LogCapture capture;
+        SR_CHECK(!SR_XML_NS::CompiledConfig::Load(cache).Valid());
+        SR_CHECK(getName(SR_XML_NS::CompiledConfig::LoadDocument(source, cache, otherSchema)) == "E");
+        SR_CHECK(SR_XML_NS::CompiledConfig::Load(cache).Valid());
+
+        std::vector<uint64_t> garbage(8, 0x1234);
+        SR_CHECK(!SR_XML_NS::CompiledConfig::FromBlob(std::move(garbage)).Valid());
+    }
+
+    SR_PLATFORM_NS::Delete(cache);
+    SR_PLATFORM_NS::Delete(source);
+}
+
+/// Источник пишет нажатия со своего потока, пока Input::Check забирает очередь каждый кадр:
+/// у каждого Down есть свой Up, клавиша в конце отпущена, а отказы записи совпадают с GetDroppedCount
+SR_TEST(InputSource_ThreadedProducer) {
+    constexpr uint32_t taps = 100000;
+
+    auto&& input = SR_UTILS_NS::Input::Instance();
+    input.ClearSources();
+
+    auto&& pSource = std::make_unique<SR_UTILS_NS::SyntheticInputSource>();
+    auto&& pProducer = pSource.get();
+    SR_REQUIRE(input.AddSource(std::move(pSource)));
+
+    input.Check();
+
+    std::atomic<bool> finished = false;
+    uint64_t rejected = 0;
+
+    std::thread producer([pProducer, &finished, &rejected]() {
+        for (uint32_t i = 0; i < taps; ++i) {
+            while (!pProducer->Press(SR_UTILS_NS::KeyCode::Z)) {
+                ++rejected;
+                std::this_thread::yield();
+            }
+
+            while (!pProducer->Release(SR_UTILS_NS::KeyCode::Z)) {
+                ++rejected;
+                std::this_thread::yield();
+            }
+        }
+
+        finished = true;
+    });
+
+    uint64_t downs = 0;
+    uint64_t ups = 0;
+    bool balanced = true;
+
+    auto&& frame = [&]() {
+        input.Check();
+        downs += input.GetKeyDown(SR_UTILS_NS::KeyCode::Z) ? 1 : 0;
+        ups += input.GetKeyUp(SR_UTILS_NS::KeyCode::Z) ? 1 : 0;
+        /// Up приходит только после своего Down
+        balanced &= ups <= downs && downs <= ups + 1;
+    };
+
+    while (!finished) {
+        frame();
+        std::this_thread::yield();
+    }
+
+    producer.join();
+
+    /// кадр забирает остаток очереди, отложенные нажатие и отпускание доходят еще за два кадра
+    for (uint32_t i = 0; i < 3; ++i) {
+        frame();
+    }
+
+    SR_CHECK(balanced);
+    SR_CHECK(downs > 0);
+    SR_CHECK(downs <= taps);
+    SR_CHECK_EQ(downs, ups);
+    SR_CHECK(!input.GetKey(SR_UTILS_NS::KeyCode::Z));
+    SR_CHECK_EQ(pProducer->GetDroppedCount(), rejected);
+
+    input.ClearSources();
+    SR_CHECK(!input.HasSources());
+}
+
+/// Нажатие и отпускание в одном кадре, отпускание и повторное нажатие в одном кадре: ни один переход не теряется
+SR_TEST(InputSource_FrameTransitions) {
+    using SR_UTILS_NS::KeyCode;
+
+    auto&& input = SR_UTILS_NS::Input::Instance();
+    input.ClearSources();
+
+    auto&& pSource = std::make_unique<SR_UTILS_NS::SyntheticInputSource>();
+    auto&& pKeys = pSource.get();
+    SR_REQUIRE(input.AddSource(std::move(pSource)));
+
+    input.Check();
+
+    /// короткое нажатие
+    pKeys->Press(KeyCode::A);
+    pKeys->Release(KeyCode::A);
+    input.Check();
+    SR_CHECK(input.GetKeyDown(KeyCode::A));
+    input.Check();
+    SR_CHECK(input.GetKeyUp(KeyCode::A));
+    input.Check();
+    SR_CHECK(!input.GetKey(KeyCode::A) && !input.GetKeyUp(KeyCode::A));
+
+    /// отпущена и снова нажата, пока зажата
+    pKeys->Press(KeyCode::B);
+    input.Check();
+    input.Check();
+    SR_CHECK(input.GetKey(KeyCode::B) && !input.GetKeyDown(KeyCode::B));
+
+    const auto pressTimestamp = SR_UTILS_NS::GetInputTimestamp() + 1000;
+    pKeys->Release(KeyCode::B);
+    pKeys->Press(KeyCode::B, pressTimestamp);
+    input.Check();
+    SR_CHECK(input.GetKeyUp(KeyCode::B));
+    input.Check();
+    SR_CHECK(input.GetKeyDown(KeyCode::B));
+    SR_CHECK_EQ(input.GetKeyTimestamp(KeyCode::B), pressTimestamp);
+    input.Check();
+    SR_CHECK(input.GetKey(KeyCode::B) && !input.GetKeyDown(KeyCode::B));
+
+    /// отпущена, нажата и снова отпущена в одном кадре
+    pKeys->Release(KeyCode::B);
+    pKeys->Press(KeyCode::B);
+    pKeys->Release(KeyCode::B);
+    input.Check();
+    SR_CHECK(input.GetKeyUp(KeyCode::B));
+    input.Check();
+    SR_CHECK(input.GetKeyDown(KeyCode::B));
+    input.Check();
+    SR_CHECK(input.GetKeyUp(KeyCode::B));
+    input.Check();
+    SR_CHECK(!input.GetKey(KeyCode::B) && !input.GetKeyUp(KeyCode::B));
+
+    input.ClearSources();
+}
+
+#ifdef SR_LINUX
+/// Левая и правая клавиши с одним KeyCode, в том числе на разных клавиатурах: Down на первое нажатие,
+/// Up только на последнее отпускание. Автоповтор пропускается, клавиши отключенного устройства отпускаются
+SR_TEST(EvdevInputSource_SharedKeyCodes) {
+    using SR_UTILS_NS::KeyCode;
+
+    int32_t first[2] = { -1, -1 };
+    int32_t second[2] = { -1, -1 };
+    SR_REQUIRE(pipe2(first, O_NONBLOCK | O_CLOEXEC) == 0);
+    SR_REQUIRE(pipe2(second, O_NONBLOCK | O_CLOEXEC) == 0);
+
+    SR_UTILS_NS::EvdevInputSource source;
+    SR_REQUIRE(source.Open({ first[0], second[0] }));
+
+    /// правый Shift нажат, пока зажат левый: отпускание левого ничего не отпускает
+    WriteEvdevKey(first[1], KEY_LEFTSHIFT, 1, 100);
+    WriteEvdevKey(first[1], KEY_RIGHTSHIFT, 1, 200);
+    WriteEvdevKey(first[1], KEY_LEFTSHIFT, 0, 300);
+    WriteEvdevKey(first[1], KEY_RIGHTSHIFT, 2, 350);
+    WriteEvdevKey(first[1], KEY_RIGHTSHIFT, 0, 400);
+
+    auto&& events = WaitEvdevEvents(source, 2);
+    SR_REQUIRE(events.size() == 2);
+    SR_CHECK(IsSameInputEvent(events[0], KeyCode::LShift, true, 100));
+    SR_CHECK(IsSameInputEvent(events[1], KeyCode::LShift, false, 400));
+
+    /// Ctrl на двух клавиатурах и два Enter
+    WriteEvdevKey(first[1], KEY_LEFTCTRL, 1, 500);
+    SR_CHECK_EQ(WaitEvdevEvents(source, 1).size(), 1u);
+
+    WriteEvdevKey(second[1], KEY_RIGHTCTRL, 1, 600);
+    WriteEvdevKey(second[1], KEY_ENTER, 1, 610);
+    WriteEvdevKey(second[1], KEY_KPENTER, 1, 620);
+    WriteEvdevKey(second[1], KEY_ENTER, 0, 630);
+    WriteEvdevKey(second[1], KEY_A, 1, 640);
+
+    events = WaitEvdevEvents(source, 2);
+    SR_REQUIRE(events.size() == 2);
+    SR_CHECK(IsSameInputEvent(events[0], KeyCode::Enter, true, 610));
+    SR_CHECK(IsSameInputEvent(events[1], KeyCode::A, true, 640));
+
+    WriteEvdevKey(first[1], KEY_LEFTCTRL, 0, 700);
+    WriteEvdevKey(first[1], KEY_B, 1, 710);
+
+    events = WaitEvdevEvents(source, 1);
+    SR_REQUIRE(events.size() == 1);
+    SR_CHECK(IsSameInputEvent(events[0], KeyCode::B, true, 710));
+
+    /// вторая клавиатура отключена с зажатыми правым Ctrl, Enter на цифровом блоке и A
+    close(second[1]);
+
+    events = WaitEvdevEvents(source, 3);
+    SR_REQUIRE(events.size() == 3);
+
+    std::set<KeyCode> released;
+    for (auto&& event : events) {
+        SR_CHECK(!event.pressed);
+        released.insert(event.key);
+    }
+    SR_CHECK(released == std::set<KeyCode>({ KeyCode::Ctrl, KeyCode::Enter, KeyCode::A }));
+
+    source.Close();
+    close(first[1]);
+}
+#endif
+
+/// Сессия из 200 кадров со сценарием ввода от событийного и опрашиваемого источников, дрожащим dt и потерей фокуса
+/// воспроизводится кадр в кадр: с конфликтующим живым вводом и совсем без источников, как в headless режиме
+SR_TEST(FrameRecorder_ReplayMatchesRecord) {
+    constexpr uint32_t framesCount = 200;
+
+    auto&& input = SR_UTILS_NS::Input::Instance();
+    auto&& recorder = SR_UTILS_NS::FrameRecorder::Instance();
+
+    auto&& folder = SR_UTILS_NS::ResourceManager::Instance().GetCachePath().Concat("Tests");
+    SR_REQUIRE(folder.Make(SR_UTILS_NS::Path::Type::Folder));
+
+    const SR_UTILS_NS::Path path = folder.Concat("Session.srrec");
+    const SR_UTILS_NS::Path reportPath = path.ConcatExt("csv");
+
+    input.ClearSources();
+
+    auto&& pEventsSource = std::make_unique<SR_UTILS_NS::SyntheticInputSource>();
+    auto&& pKeyboardSource = std::make_unique<ScriptedKeyboardSource>();
+    auto&& pEvents = pEventsSource.get();
+    auto&& pKeyboard = pKeyboardSource.get();
+
+    SR_REQUIRE(input.AddSource(std::move(pEventsSource)));
+    SR_REQUIRE(input.AddSource(std::move(pKeyboardSource)));
+    SettleInput();
+
+    SR_REQUIRE(recorder.StartRecording(path));
+    const auto recorded = RunRecorderSession(pEvents, pKeyboard, true, 1, framesCount);
+    SR_CHECK_EQ(recorder.GetFrames().size(), static_cast<uint64_t>(framesCount));
+
+    /// опрашиваемая клавиатура попадает в журнал теми же событиями, что и устройства
+    uint32_t polledEvents = 0;
+    for (auto&& frame : recorder.GetFrames()) {
+        for (auto&& step : frame.steps) {
+            for (auto&& event : step.events) {
+                polledEvents += event.key == SR_UTILS_NS::KeyCode::D ? 1 : 0;
+            }
+        }
+    }
+    SR_CHECK_EQ(polledEvents, 2u);
+
+    recorder.Stop();
+    SR_CHECK(!recorder.IsActive());
+    SettleInput();
+
+    /// живой ввод при воспроизведении отбрасывается
+    SR_REQUIRE(recorder.StartReplay(path));
+    const auto replayed = RunRecorderSession(pEvents, pKeyboard, false, 999, framesCount);
+    SR_CHECK(recorder.IsReplayFinished());
+    SR_CHECK_EQ(recorder.GetMismatchCount(), 0u);
+    SR_CHECK_EQ(recorder.GetReplayResults().size(), static_cast<uint64_t>(framesCount));
+    SR_CHECK(replayed == recorded);
+    recorder.Stop();
+
+    std::ifstream report(reportPath.ToString());
+    uint32_t reportLines = 0;
+    for (std::string line; std::getline(report, line); ) {
+        ++reportLines;
+    }
+    SR_CHECK_EQ(reportLines, framesCount + 1);
+
+    input.ClearSources();
+    SettleInput();
+
+    SR_REQUIRE(recorder.StartReplay(path));
+    const auto headless = RunRecorderSession(nullptr, nullptr, false, 7, framesCount);
+    SR_CHECK_EQ(recorder.GetMismatchCount(), 0u);
+    SR_CHECK(headless == recorded);
+    recorder.Stop();
+
+    /// без записи тот же сценарий с другим dt расходится
+    auto&& pFreeEventsSource = std::make_unique<SR_UTILS_NS::SyntheticInputSource>();
+    auto&& pFreeKeyboardSource = std::make_unique<ScriptedKeyboardSource>();
+    auto&& pFreeEvents = pFreeEventsSource.get();
+    auto&& pFreeKeyboard = pFreeKeyboardSource.get();
+
+    SR_REQUIRE(input.AddSource(std::move(pFreeEventsSource)));
+    SR_REQUIRE(input.AddSource(std::move(pFreeKeyboardSource)));
+    SettleInput();
+
+    SR_CHECK(RunRecorderSession(pFreeEvents, pFreeKeyboard, true, 2, framesCount) != recorded);
+    SettleInput();
+
+    input.ClearSources();
+
+    SR_PLATFORM_NS::Delete(path);
+    SR_PLATFORM_NS::Delete(reportPath);
+}
+
+/// Журнал читается без потерь, обрезанный или дополненный журнал отвергается,
+/// а измененный сид кадра дает расхождение ровно с этого кадра
+SR_TEST(FrameRecorder_RejectsCorrupted) {
+    constexpr uint32_t framesCount = 200;
+    constexpr uint32_t alteredFrame = 150;
+
+    auto&& input = SR_UTILS_NS::Input::Instance();
+    auto&& recorder = SR_UTILS_NS::FrameRecorder::Instance();
+
+    auto&& folder = SR_UTILS_NS::ResourceManager::Instance().GetCachePath().Concat("Tests");
+    SR_REQUIRE(folder.Make(SR_UTILS_NS::Path::Type::Folder));
+
+    const SR_UTILS_NS::Path path = folder.Concat("Corrupted.srrec");
+    const SR_UTILS_NS::Path alteredPath = folder.Concat("Altered.srrec");
+
+    input.ClearSources();
+
+    auto&& pEventsSource = std::make_unique<SR_UTILS_NS::SyntheticInputSource>();
+    auto&& pKeyboardSource = std::make_unique<ScriptedKeyboardSource>();
+    auto&& pEvents = pEventsSource.get();
+    auto&& pKeyboard = pKeyboardSource.get();
+
+    SR_REQUIRE(input.AddSource(std::move(pEventsSource)));
+    SR_REQUIRE(input.AddSource(std::move(pKeyboardSource)));
+    SettleInput();
+
+    SR_REQUIRE(recorder.StartRecording(path));
+    SR_MAYBE_UNUSED auto&& recorded = RunRecorderSession(pEvents, pKeyboard, true, 3, framesCount);
+    const auto frames = recorder.GetFrames();
+    recorder.Stop();
+
+    input.ClearSources();
+    SettleInput();
+
+    const std::string data = SR_PLATFORM_NS::ReadFile(path).value_or(std::string());
+    SR_REQUIRE(!data.empty());
+
+    std::vector<SR_UTILS_NS::RecordedFrame> loaded;
+    SR_CHECK(SR_UTILS_NS::FrameRecorder::Deserialize(data, loaded));
+    SR_CHECK_EQ(loaded.size(), frames.size());
+    SR_CHECK(SR_UTILS_NS::FrameRecorder::Serialize(loaded) == data);
+    SR_CHECK(SR_UTILS_NS::FrameRecorder::Serialize(frames) == data);
+
+    SR_CHECK(!SR_UTILS_NS::FrameRecorder::Deserialize(data.substr(0, data.size() - 1), loaded));
+    SR_CHECK(loaded.empty());
+    SR_CHECK(!SR_UTILS_NS::FrameRecorder::Deserialize(data + "x", loaded));
+    SR_CHECK(!SR_UTILS_NS::FrameRecorder::Deserialize(std::string(), loaded));
+
+    /// число кадров больше, чем может поместиться в файле
+    std::string hugeCount = data;
+    const uint32_t count = SR_UINT32_MAX;
+    std::memcpy(hugeCount.data() + 2 * sizeof(uint32_t), &count, sizeof(count));
+    SR_CHECK(!SR_UTILS_NS::FrameRecorder::Deserialize(hugeCount, loaded));
+
+    {
+        LogCapture capture;
+        WriteTextFile(alteredPath, data.substr(0, 40));
+        SR_CHECK(!recorder.StartReplay(alteredPath));
+        SR_CHECK(!recorder.IsActive());
+    }
+
+    auto altered = frames;
+    altered[alteredFrame].seed ^= 1;
+    WriteTextFile(alteredPath, SR_UTILS_NS::FrameRecorder::Serialize(altered));
+
+    {
+        LogCapture capture;
+
+        SR_REQUIRE(recorder.StartReplay(alteredPath));
+        SR_MAYBE_UNUSED auto&& replayed = RunRecorderSession(nullptr, nullptr, false, 5, framesCount);
+        SR_CHECK(recorder.GetMismatchCount() > 0);
+
+        uint32_t firstMismatch = 0;
+        for (auto&& result : recorder.GetReplayResults()) {
+            if (result.checksum != result.expectedChecksum) {
+                break;
+            }
+            ++firstMismatch;
+        }
+        SR_CHECK_EQ(firstMismatch, alteredFrame);
+
+        recorder.Stop();
+        SR_CHECK(capture.GetText().find(SR_FORMAT("replay diverged at frame {}", alteredFrame)) != std::string::npos);
+    }
+
+    /// без активного режима значения проходят насквозь
+    SR_CHECK_EQ(recorder.BeginFrame(123), 123u);
+    SR_CHECK_EQ(recorder.ScheduleFixedSteps(3), 3u);
+    SR_CHECK(!recorder.BeginFixedStep(false));
+
+    SR_PLATFORM_NS::Delete(path);
+    SR_PLATFORM_NS::Delete(alteredPath);
+    SR_PLATFORM_NS::Delete(alteredPath.ConcatExt("csv"));
+}
+
+/// Воспроизведение пересевает только генератор записи: rand() и Random, который выдает идентификаторы, не повторяются
+SR_TEST(FrameRecorder_RandomIsolation) {
+    auto&& recorder = SR_UTILS_NS::FrameRecorder::Instance();
+
+    auto&& folder = SR_UTILS_NS::ResourceManager::Instance().GetCachePath().Concat("Tests");
+    SR_REQUIRE(folder.Make(SR_UTILS_NS::Path::Type::Folder));
+
+    const SR_UTILS_NS::Path path = folder.Concat("Random.srrec");
+
+    SR_UTILS_NS::RecordedFrame frame;
+    frame.deltaTime = 16000000;
+    frame.seed = 42;
+    WriteTextFile(path, SR_UTILS_NS::FrameRecorder::Serialize({ frame, frame }));
+
+    std::vector<float_t> replayed;
+    std::vector<int64_t> identifiers;
+
+    for (uint32_t i = 0; i < 2; ++i) {
+        SR_REQUIRE(recorder.StartReplay(path));
+
+        srand(7);
+        const int32_t expected = rand();
+        srand(7);
+
+        SR_MAYBE_UNUSED auto&& deltaTime = recorder.BeginFrame(0);
+        SR_CHECK_EQ(rand(), expected);
+
+        replayed.emplace_back(recorder.RandomFloat(0.f, 1.f));
+        identifiers.emplace_back(SR_UTILS_NS::Random::Instance().Int64());
+
+        recorder.EndFrame(0);
+        recorder.Stop();
+    }
+
+    SR_CHECK_EQ(replayed[0], replayed[1]);
+    SR_CHECK(identifiers[0] != identifiers[1]);
+
+    SR_PLATFORM_NS::Delete(path);
+    SR_PLATFORM_NS::Delete(path.ConcatExt("csv"));
+}
@@ -0,0 +1,484 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Test.h>
+
+#include <Utils/World/Scene.h>
+#include <Utils/World/SceneAllocator.h>
+#include <Utils/ECS/GameObject.h>
+#include <Utils/ECS/ComponentManager.h>
+#include <Utils/ECS/Transform3D.h>
+#include <Utils/ECS/PrefabTemplate.h>
+#include <Utils/Math/SIMD.h>
+
+namespace SR_TESTS_NS {
+    class TestScene final : public SR_WORLD_NS::Scene {
+    public:
+        TestScene() = default;
+
+    };
+
+    template<typename T> class TestComponentBase : public SR_UTILS_NS::Component {
+        using Super = SR_UTILS_NS::Component;
+    public:
+        void OnDestroy() override {
+            Super::OnDestroy();
+            GetThis().AutoFree([](auto&& pData) {
+                delete pData;
+            });
+        }
+
+    };
+
+    class TestComponentA final : public TestComponentBase<TestComponentA> {
+        SR_ENTITY_SET_VERSION(1000);
+        SR_INITIALIZE_COMPONENT(TestComponentA);
+    public:
+        static SR_UTILS_NS::Component* LoadComponent(SR_HTYPES_NS::Marshal& marshal, const SR_HTYPES_NS::DataStorage* dataStorage) {
+            return new TestComponentA();
+        }
+
+    };
+
+    class TestComponentB final : public TestComponentBase<TestComponentB> {
+        SR_ENTITY_SET_VERSION(1000);
+        SR_INITIALIZE_COMPONENT(TestComponentB);
+    public:
+        static SR_UTILS_NS::Component* LoadComponent(SR_HTYPES_NS::Marshal& marshal, const SR_HTYPES_NS::DataStorage* dataStorage) {
+            return new TestComponentB();
+        }
+
+    };
+
+    SR_REGISTER_COMPONENT(TestComponentA);
+    SR_REGISTER_COMPONENT(TestComponentB);
+
+    /// Пустая сцена на время одного теста
+    class TestWorld : public SR_UTILS_NS::NonCopyable {
+    public:
+        TestWorld() {
+            static const bool initialized = SR_WORLD_NS::SceneAllocator::Instance().Init([]() -> SR_WORLD_NS::Scene* {
+                return new TestScene();
+            });
+            SR_UNUSED_VARIABLE(initialized);
+
+            m_scene = SR_WORLD_NS::Scene::Empty();
+        }
+
+        ~TestWorld() override {
+            m_scene.AutoFree([](SR_WORLD_NS::Scene* pData) {
+                pData->Destroy();
+                delete pData;
+            });
+        }
+
+    public:
+        SR_NODISCARD SR_WORLD_NS::Scene::Ptr GetScene() const { return m_scene; }
+
+    private:
+        SR_WORLD_NS::Scene::Ptr m_scene;
+
+    };
+
+    using GameObjectSet = std::set<const SR_UTILS_NS::GameObject*>;
+
+    GameObjectSet ToSet(const SR_WORLD_NS::Scene::GameObjectRange& range) {
+        GameObjectSet result;
+        for (auto&& pGameObject : range) {
+            result.insert(pGameObject.Get());
+        }
+        return result;
+    }
+
+    bool HasComponent(const SR_UTILS_NS::GameObject::Ptr& pGameObject, uint64_t componentHashName) {
+        for (auto&& pComponent : pGameObject->GetComponents()) {
+            if (pComponent->GetComponentHashName() == componentHashName) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CollectSubtree(const SR_UTILS_NS::GameObject::Ptr& pGameObject, GameObjectSet& subtree) {
+        subtree.insert(pGameObject.Get());
+        for (auto&& pChild : pGameObject->GetChildrenRef()) {
+            CollectSubtree(pChild, subtree);
+        }
+    }
+
+    /// Дерево с разными тегами, трансформами, выключенными объектами и компонентами, как m_data загруженного префаба
+    void FillPrefabTree(const SR_WORLD_NS::Scene::Ptr& pScene, const SR_UTILS_NS::GameObject::Ptr& pParent, std::mt19937& random, uint32_t depth) {
+        const uint32_t componentsCount = random() % 3;
+        for (uint32_t i = 0; i < componentsCount; ++i) {
+            if (random() % 2 == 0) {
+                pParent->AddComponent(new TestComponentA());
+            }
+            else {
+                pParent->AddComponent(new TestComponentB());
+            }
+        }
+
+        if (depth == 0) {
+            return;
+        }
+
+        const uint32_t width = 1 + random() % 3;
+        for (uint32_t i = 0; i < width; ++i) {
+            auto&& pChild = pScene->Instance(pParent->GetName() + "_" + std::to_string(i));
+            pChild->SetTag(random() % 2 == 0 ? SR_HASH_STR("Enemy") : SR_HASH_STR("Static"));
+            pChild->GetTransform()->SetTranslation(SR_MATH_NS::FVector3(static_cast<float_t>(i), 1.5f, -2.f * depth));
+            pChild->GetTransform()->SetRotation(SR_MATH_NS::FVector3(10.f * i, 45.f, 0.f));
+            pChild->GetTransform()->SetScale(SR_MATH_NS::FVector3(1.f, 2.f, 0.5f + i));
+            if (random() % 4 == 0) {
+                pChild->SetEnabled(false);
+            }
+            pParent->AddChild(pChild);
+            FillPrefabTree(pScene, pChild, random, depth - 1);
+        }
+    }
+
+    /// Сравнивает экземпляр шаблона с копией узел за узлом, включая порядок детей и компонентов
+    bool IsSameInstance(const SR_UTILS_NS::GameObject::Ptr& pInstance, const SR_UTILS_NS::GameObject::Ptr& pCopy) {
+        if (pInstance->GetName() != pCopy->GetName() || pInstance->GetTag() != pCopy->GetTag() ||
+            pInstance->IsEnabled() != pCopy->IsEnabled() || pInstance->GetScene() != pCopy->GetScene() ||
+            pInstance->GetPrefab() != pCopy->GetPrefab() || pInstance->IsPrefabOwner() != pCopy->IsPrefabOwner()
+        ) {
+            return false;
+        }
+
+        auto&& pInstanceTransform = pInstance->GetTransform();
+        auto&& pCopyTransform = pCopy->GetTransform();
+
+        if (pInstanceTransform->GetMeasurement() != pCopyTransform->GetMeasurement() ||
+            pInstanceTransform->GetTranslation() != pCopyTransform->GetTranslation() ||
+            pInstanceTransform->GetRotation() != pCopyTransform->GetRotation() ||
+            pInstanceTransform->GetScale() != pCopyTransform->GetScale() ||
+            pInstanceTransform->GetGameObject() != pInstance
+        ) {
+            return false;
+        }
+
+        auto&& instanceComponents = pInstance->GetComponents();
+        auto&& copyComponents = pCopy->GetComponents();
+
+        if (instanceComponents.size() != copyComponents.size() || pInstance->GetLoadedComponents().size() != pCopy->GetLoadedComponents().size()) {
+            return false;
+        }
+
+        for (uint32_t i = 0; i < instanceComponents.size(); ++i) {
+            if (instanceComponents[i]->GetComponentHashName() != copyComponents[i]->GetComponentHashName() ||
+                instanceComponents[i]->IsEnabled() != copyComponents[i]->IsEnabled() ||
+                instanceComponents[i]->GetParent() != pInstance.Get()
+            ) {
+                return false;
+            }
+        }
+
+        auto&& instanceChildren = pInstance->GetChildrenRef();
+        auto&& copyChildren = pCopy->GetChildrenRef();
+
+        if (instanceChildren.size() != copyChildren.size()) {
+            return false;
+        }
+
+        for (uint32_t i = 0; i < instanceChildren.size(); ++i) {
+            if (instanceChildren[i]->GetParent() != pInstance || !IsSameInstance(instanceChildren[i], copyChildren[i])) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /// Случайные трансформы, у части объектов скос
+    void FillTransformTree(const SR_WORLD_NS::Scene::Ptr& pScene, const SR_UTILS_NS::GameObject::Ptr& pParent, std::mt19937& random, uint32_t width, uint32_t depth) {
+        std::uniform_real_distribution<float_t> distribution(-1.f, 1.f);
+
+        auto&& pTransform = pParent->GetTransform();
+        pTransform->SetTranslation(SR_MATH_NS::FVector3(distribution(random), distribution(random), distribution(random)) * 5.f);
+        pTransform->SetRotation(SR_MATH_NS::FVector3(distribution(random), distribution(random), distribution(random)) * 180.f);
+        pTransform->SetScale(SR_MATH_NS::FVector3(1.f + 0.5f * distribution(random), 1.f, 1.f - 0.25f * distribution(random)));
+
+        if (random() % 4 == 0) {
+            pTransform->SetSkew(SR_MATH_NS::FVector3(1.f + 0.5f * distribution(random), 1.f, 1.f));
+        }
+
+        if (depth == 0) {
+            return;
+        }
+
+        for (uint32_t i = 0; i < width; ++i) {
+            auto&& pChild = pScene->Instance("Node");
+            pParent->AddChild(pChild);
+            FillTransformTree(pScene, pChild, random, width, depth - 1);
+        }
+    }
+
+    /// Мировая матрица по одной, без пакетов и кешей
+    SR_MATH_NS::Matrix4x4 GetReferenceMatrix(const SR_UTILS_NS::GameObject* pGameObject) {
+        auto&& pTransform = pGameObject->GetTransform();
+        const SR_MATH_NS::Matrix4x4 local(pTransform->GetTranslation(), pTransform->GetQuaternion(), pTransform->GetScale(), pTransform->GetSkew());
+        if (auto&& pParent = pGameObject->GetParent()) {
+            return GetReferenceMatrix(pParent.Get()) * local;
+        }
+        return local;
+    }
+
+    float_t GetMatrixDifference(const SR_MATH_NS::Matrix4x4& left, const SR_MATH_NS::Matrix4x4& right) {
+        float_t difference = 0.f;
+        for (uint32_t column = 0; column < 4; ++column) {
+            for (uint32_t row = 0; row < 4; ++row) {
+                const float_t scale = std::max(1.f, std::abs(right.self[column][row]));
+                difference = std::max(difference, std::abs(left.self[column][row] - right.self[column][row]) / scale);
+            }
+        }
+        return difference;
+    }
+}
+
+using namespace SR_TESTS_NS;
+
+/// Индексы сцены после случайных переименований, смены тегов, добавления и удаления компонентов и объектов
+/// должны совпадать с полным перебором
+SR_TEST(Scene_IndicesMatchBruteForce) {
+    TestWorld world;
+    auto&& pScene = world.GetScene();
+
+    std::mt19937 random(27);
+
+    const std::vector<std::string> names = { "Player", "Enemy", "Light", "Camera", "Tree", "Rock", "Spawn", "Trigger" };
+    const std::vector<SR_UTILS_NS::Tag> tags = { 0, SR_HASH_STR("Untagged"), SR_HASH_STR("Enemy"), SR_HASH_STR("Static") };
+    const std::vector<uint64_t> componentHashes = { TestComponentA::COMPONENT_HASH_NAME, TestComponentB::COMPONENT_HASH_NAME };
+
+    std::vector<SR_UTILS_NS::GameObject::Ptr> alive;
+
+    auto&& randomObject = [&]() -> SR_UTILS_NS::GameObject::Ptr {
+        return alive[random() % alive.size()];
+    };
+
+    for (uint32_t step = 0; step < 4000; ++step) {
+        const uint32_t operation = alive.empty() ? 0 : random() % 7;
+
+        switch (operation) {
+            case 0:
+            case 1: {
+                auto&& pGameObject = pScene->Instance(names[random() % names.size()]);
+                pGameObject->SetTag(tags[random() % tags.size()]);
+                if (!alive.empty() && random() % 4 == 0) {
+                    randomObject()->AddChild(pGameObject);
+                }
+                alive.emplace_back(pGameObject);
+                break;
+            }
+            case 2:
+                randomObject()->SetName(names[random() % names.size()]);
+                break;
+            case 3:
+                randomObject()->SetTag(tags[random() % tags.size()]);
+                break;
+            case 4: {
+                auto&& pGameObject = randomObject();
+                if (random() % 2 == 0) {
+                    pGameObject->AddComponent(new TestComponentA());
+                }
+                else {
+                    pGameObject->AddComponent(new TestComponentB());
+                }
+                break;
+            }
+            case 5: {
+                auto&& pGameObject = randomObject();
+                auto&& components = pGameObject->GetComponents();
+                if (!components.empty()) {
+                    pGameObject->RemoveComponent(components[random() % components.size()]);
+                }
+                break;
+            }
+            default: {
+                if (random() % 2 != 0) {
+                    break;
+                }
+
+                GameObjectSet subtree;
+                auto&& pGameObject = randomObject();
+                CollectSubtree(pGameObject, subtree);
+                pGameObject->Destroy();
+
+                alive.erase(std::remove_if(alive.begin(), alive.end(), [&subtree](auto&& pAlive) {
+                    return subtree.count(pAlive.Get()) == 1;
+                }), alive.end());
+                break;
+            }
+        }
+
+        if (step % 16 != 0) {
+            continue;
+        }
+
+        pScene->Prepare();
+
+        for (auto&& pGameObject : alive) {
+            pGameObject->PostLoad(false);
+        }
+
+        for (auto&& name : names) {
+            GameObjectSet expected;
+            for (auto&& pGameObject : alive) {
+                if (pGameObject->GetHashName() == SR_HASH_STR(name)) {
+                    expected.insert(pGameObject.Get());
+                }
+            }
+            SR_REQUIRE(ToSet(pScene->FindAll(SR_HASH_STR(name))) == expected);
+            SR_REQUIRE(expected.count(pScene->Find(name).Get()) == 1 || (expected.empty() && !pScene->Find(name)));
+        }
+
+        for (auto&& tag : tags) {
+            GameObjectSet expected;
+            for (auto&& pGameObject : alive) {
+                if (pGameObject->GetTag() == tag) {
+                    expected.insert(pGameObject.Get());
+                }
+            }
+            SR_REQUIRE(ToSet(pScene->FindAllByTag(tag)) == expected);
+        }
+
+        for (auto&& componentHash : componentHashes) {
+            GameObjectSet expected;
+            for (auto&& pGameObject : alive) {
+                if (HasComponent(pGameObject, componentHash)) {
+                    expected.insert(pGameObject.Get());
+                }
+            }
+            SR_REQUIRE(ToSet(pScene->FindAllByComponent(componentHash)) == expected);
+            SR_REQUIRE(expected.count(pScene->FindByComponent(componentHash).Get()) == 1 || (expected.empty() && !pScene->FindByComponent(componentHash)));
+        }
+    }
+}
+
+/// Экземпляр из скомпилированного шаблона должен совпадать с тем, что дает GameObject::Copy:
+/// те же имена, теги, трансформы, компоненты и порядок детей, и после Prepare оба одинаково видны в индексах сцены
+SR_TEST(Prefab_TemplateMatchesCopy) {
+    TestWorld world;
+    auto&& pScene = world.GetScene();
+
+    std::mt19937 random(42);
+
+    for (uint32_t round = 0; round < 16; ++round) {
+        auto&& pSource = pScene->Instance("Prefab");
+        pSource->SetTag(SR_HASH_STR("Untagged"));
+        FillPrefabTree(pScene, pSource, random, 3);
+        pScene->Prepare();
+
+        /// данные префаба живут вне сцены
+        auto&& pPrefabData = pSource->Copy(nullptr);
+        pSource->Destroy();
+
+        SR_UTILS_NS::PrefabTemplate prefabTemplate;
+        prefabTemplate.Compile(pPrefabData);
+        SR_REQUIRE(prefabTemplate.Valid());
+
+        GameObjectSet subtree;
+        CollectSubtree(pPrefabData, subtree);
+        SR_CHECK_EQ(prefabTemplate.GetNodes().size(), subtree.size());
+
+        auto&& pInstance = prefabTemplate.Instance(pScene.Get());
+        auto&& pCopy = pPrefabData->Copy(pScene.Get());
+
+        SR_REQUIRE(pInstance && pCopy);
+        SR_CHECK(pInstance->GetScene() == pScene.Get());
+        SR_CHECK(!pInstance->GetParent());
+        SR_REQUIRE(IsSameInstance(pInstance, pCopy));
+
+        /// шаблон не должен делить с префабом ни объекты, ни компоненты
+        GameObjectSet instanceSubtree;
+        CollectSubtree(pInstance, instanceSubtree);
+        for (auto&& pGameObject : instanceSubtree) {
+            SR_CHECK(subtree.count(pGameObject) == 0);
+        }
+
+        pScene->Prepare();
+
+        for (auto&& pGameObject : instanceSubtree) {
+            auto&& sameName = ToSet(pScene->FindAll(pGameObject->GetHashName()));
+            SR_CHECK(sameName.count(pGameObject) == 1);
+        }
+
+        GameObjectSet copySubtree;
+        CollectSubtree(pCopy, copySubtree);
+
+        for (auto&& componentHash : { TestComponentA::COMPONENT_HASH_NAME, TestComponentB::COMPONENT_HASH_NAME }) {
+            auto&& found = ToSet(pScene->FindAllByComponent(componentHash));
+
+            uint32_t fromInstance = 0;
+            uint32_t fromCopy = 0;
+            for (auto&& pGameObject : found) {
+                fromInstance += instanceSubtree.count(pGameObject);
+                fromCopy += copySubtree.count(pGameObject);
+            }
+            SR_CHECK_EQ(fromInstance, fromCopy);
+        }
+
+        pInstance->Destroy();
+        pCopy->Destroy();
+        pPrefabData->Destroy();
+
+        pScene->Prepare();
+    }
+}
+
+/// Дети пересчитываются пакетом, когда пересчитывается родитель. Мировые матрицы на каждом наборе инструкций
+/// совпадают с поэлементным расчетом, в каком бы порядке их ни запрашивали и что бы ни инвалидировалось
+SR_TEST(Transform3D_BatchedHierarchyMatchesScalar) {
+    TestWorld world;
+    auto&& pScene = world.GetScene();
+
+    std::mt19937 random(45);
+
+    auto&& pRoot = pScene->Instance("Root");
+    FillTransformTree(pScene, pRoot, random, 5, 3);
+    pScene->Prepare();
+
+    GameObjectSet subtree;
+    CollectSubtree(pRoot, subtree);
+    std::vector<const SR_UTILS_NS::GameObject*> nodes(subtree.begin(), subtree.end());
+
+    auto&& checkNodes = [&]() {
+        std::shuffle(nodes.begin(), nodes.end(), random);
+
+        float_t difference = 0.f;
+        for (auto&& pGameObject : nodes) {
+            difference = std::max(difference, GetMatrixDifference(pGameObject->GetTransform()->GetMatrix(), GetReferenceMatrix(pGameObject)));
+        }
+        return difference;
+    };
+
+    const auto backend = SR_MATH_NS::SIMD::GetBackend();
+    uint32_t step = 0;
+
+    for (auto&& candidate : { SR_MATH_NS::SIMD::Backend::Scalar, SR_MATH_NS::SIMD::Backend::SSE, SR_MATH_NS::SIMD::Backend::AVX2, SR_MATH_NS::SIMD::Backend::NEON }) {
+        if (!SR_MATH_NS::SIMD::SetBackend(candidate)) {
+            continue;
+        }
+
+        /// сдвиг корня инвалидирует все дерево
+        pRoot->GetTransform()->SetTranslation(SR_MATH_NS::FVector3(static_cast<float_t>(++step), 0.f, 0.f));
+        SR_CHECK(checkNodes() < 1e-4f);
+
+        /// поворот одного внутреннего узла инвалидирует только его поддерево
+        auto&& pMiddle = pRoot->GetChildrenRef()[step % 5]->GetChildrenRef()[1];
+        pMiddle->GetTransform()->SetRotation(SR_MATH_NS::FVector3(10.f * step, 20.f, 30.f));
+        SR_CHECK(checkNodes() < 1e-4f);
+
+        /// изменение скоса у одного из детей пакета
+        auto&& pLeaf = pMiddle->GetChildrenRef()[step % 5];
+        pLeaf->GetTransform()->SetSkew(SR_MATH_NS::FVector3(1.f, 1.25f, 1.f));
+        pMiddle->GetTransform()->SetScale(SR_MATH_NS::FVector3(1.f, 2.f, 1.f));
+        SR_CHECK(checkNodes() < 1e-4f);
+    }
+
+    SR_MATH_NS::SIMD::SetBackend(backend);
+
+    pRoot->Destroy();
+    pScene->Prepare();
+}
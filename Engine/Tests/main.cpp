@@ -0,0 +1,40 @@
+//
+// Created by Monika on 19.10.2026.
+//
+
+#include <Test.h>
+
+#include <Utils/Common/CmdOptions.h>
+#include <Utils/ResourceManager/ResourceManager.h>
+#include <Utils/Platform/Platform.h>
+#include <Utils/Locale/Encoding.h>
+#include <Utils/Debug.h>
+
+/// Использование: SRTests [-filter SharedPtr] [-resources <path>]
+/// Без -resources используется папка Resources репозитория. Код возврата - число упавших тестов, лог пишется рядом с исполняемым файлом
+int main(int argc, char** argv) {
+    SR_UTILS_NS::Locale::SetLocale();
+    SR_PLATFORM_NS::InitSegmentationHandler();
+
+    SR_UTILS_NS::Debug::Instance().Init(SR_PLATFORM_NS::GetApplicationPath().GetFolder().ToString(), false);
+    SR_UTILS_NS::Debug::Instance().SetLevel(SR_UTILS_NS::Debug::Level::None);
+
+    SR_UTILS_NS::Path resourcesPath = SR_UTILS_NS::GetCmdOption(argv, argv + argc, "-resources");
+    if (resourcesPath.Empty()) {
+        resourcesPath = SR_TESTS_RESOURCES_PATH;
+    }
+
+    SR_UTILS_NS::ResourceManager::Instance().Init(resourcesPath);
+
+    if (!SR_UTILS_NS::ResourceManager::Instance().Run()) {
+        SR_PLATFORM_NS::WriteConsoleError("SRTests : failed to initialize resources manager!");
+        return 255;
+    }
+
+    const uint32_t failed = SR_TESTS_NS::TestRegistry::Instance().Run(SR_UTILS_NS::GetCmdOption(argv, argv + argc, "-filter"));
+
+    SR_UTILS_NS::ResourceManager::DestroySingleton();
+    SR_UTILS_NS::GetSingletonManager()->DestroyAll();
+
+    return static_cast<int32_t>(SR_MIN(failed, 255u));
+}
@@ -137,22 +137,18 @@ public:
     void GenerateVoxel() {
         //Debug::Log(std::to_string(m_chunk.x) + ", " + std::to_string(m_chunk.y) + ", " + std::to_string(m_chunk.z));
 
-        m_voxel.resize(sizeX * sizeY * sizeZ);
-
-        for (int32_t x = 0; x < sizeX; ++x) {
-            for (int32_t y = 0; y < sizeY; ++y) {
-                for (int32_t z = 0; z < sizeZ; ++z) {
-                    const uint64_t position = z * sizeX * sizeY + y * sizeX + x;
-
-                    float noise = Mathf::SNoise3D(
-                        (static_cast<double>(m_chunk.x * sizeX + x) / 10.0 + seed),
-                        (static_cast<double>(m_chunk.y * sizeY + y) / 10.0 + seed),
-                        (static_cast<double>(m_chunk.z * sizeZ + z) / 10.0 + seed)
-                    );
-
-                    m_voxel[position] = noise > 0;
-                }
-            }
+        /// весь чанк одним пакетным вызовом, раскладка совпадает с m_voxel
+        auto&& noise = Mathf::FillNoise3D(
+            static_cast<double>(m_chunk.x * sizeX) / 10.0 + seed,
+            static_cast<double>(m_chunk.y * sizeY) / 10.0 + seed,
+            static_cast<double>(m_chunk.z * sizeZ) / 10.0 + seed,
+            0.1, sizeX, sizeY, sizeZ
+        );
+
+        m_voxel.resize(noise.size());
+
+        for (uint64_t position = 0; position < noise.size(); ++position) {
+            m_voxel[position] = noise[position] > 0;
         }
     }
 